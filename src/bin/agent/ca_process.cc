@@ -26,6 +26,12 @@ namespace {
 
 const long REQUEST_TIMEOUT = 10000;
 
+/// @brief Idle timeout of the persistent connections (ms).
+const long IDLE_TIMEOUT = 30000;
+
+/// @brief Maximum number of connections handled simultaneously.
+const size_t MAX_CONNECTIONS = 256;
+
 }
 
 namespace isc {
@@ -154,7 +160,9 @@ CtrlAgentProcess::configure(isc::data::ConstElementPtr config_set,
             HttpListenerPtr http_listener(new HttpListener(*getIoService(),
                                                            server_address,
                                                            server_port, rcf,
-                                                           REQUEST_TIMEOUT));
+                                                           REQUEST_TIMEOUT,
+                                                           IDLE_TIMEOUT,
+                                                           MAX_CONNECTIONS));
 
             // Instruct the http listener to actually open socket, install
             // callback and start listening.
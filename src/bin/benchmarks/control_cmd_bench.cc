@@ -0,0 +1,297 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <asiolink/io_service.h>
+#include <cc/data.h>
+#include <config/command_mgr.h>
+#include <log/logger_support.h>
+#include <stats/stats_mgr.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::stats;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: control_cmd_bench [-s statistics] [-n packets]"
+              << " [-t off|on|both] [-f socket]" << std::endl
+              << "  -s: number of subnet statistics (default: 10000)"
+              << std::endl
+              << "  -n: number of packets (default: 1000000)" << std::endl
+              << "  -t: command thread (default: both)" << std::endl
+              << "  -f: control socket name (default: control_cmd_bench.sock)"
+              << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Benchmark of the packet processing latency while the control
+/// channel is busy.
+///
+/// The packet processing is simulated by the updates of the statistics a
+/// DHCP server performs for each packet, followed by the poll of the IO
+/// service, as done by the server run loop. A client thread sends the
+/// statistic-get-all command over the control socket in a loop. Without
+/// the command thread each command is executed in the packet processing
+/// thread and delays the packets; with the command thread only the
+/// updates of the statistics contend with the command.
+class ControlCmdBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param statistics Number of subnet statistics.
+    /// @param packets Number of packets.
+    /// @param socket_name Control socket name.
+    ControlCmdBench(const size_t statistics, const size_t packets,
+                    const std::string& socket_name)
+        : statistics_(statistics), packets_(packets),
+          socket_name_(socket_name), io_service_(new IOService()),
+          stopping_(false), client_done_(false) {
+    }
+
+    /// @brief Runs the benchmark.
+    ///
+    /// @param thread Indicates if the command thread is enabled.
+    void run(const bool thread) {
+        StatsMgr::instance().removeAll();
+        for (size_t i = 0; i < statistics_; ++i) {
+            StatsMgr::instance().setValue(getSubnetStat(i),
+                                          static_cast<int64_t>(0));
+        }
+
+        CommandMgr& mgr = CommandMgr::instance();
+        mgr.setIOService(io_service_);
+        mgr.registerCommand("statistic-get-all",
+            boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
+        mgr.setCommandThreadSafe("statistic-get-all");
+        ElementPtr socket_info = Element::createMap();
+        socket_info->set("socket-type", Element::create("unix"));
+        socket_info->set("socket-name", Element::create(socket_name_));
+        mgr.openCommandSocket(socket_info);
+        mgr.setCommandThread(thread);
+
+        std::vector<std::string> names(1, "packet");
+        StageStats packet_stats(names);
+        StageStats command_stats(names);
+        {
+            Mutex::Locker lock(mutex_);
+            stopping_ = false;
+            client_done_ = false;
+        }
+        Thread client(boost::bind(&ControlCmdBench::runClient, this,
+                                  boost::ref(command_stats)));
+
+        for (size_t i = 0; i < packets_; ++i) {
+            packet_stats.startPacket();
+            StatsMgr::instance().addValue("pkt4-received",
+                                          static_cast<int64_t>(1));
+            StatsMgr::instance().addValue(getSubnetStat(i % statistics_),
+                                          static_cast<int64_t>(1));
+            io_service_->poll();
+            packet_stats.endPacket(0);
+        }
+
+        // Keep serving the commands until the client is done.
+        {
+            Mutex::Locker lock(mutex_);
+            stopping_ = true;
+        }
+        while (!isClientDone()) {
+            io_service_->poll();
+            usleep(1000);
+        }
+        client.wait();
+
+        mgr.setCommandThread(false);
+        mgr.closeCommandSocket();
+        mgr.deregisterAll();
+        io_service_->poll();
+
+        std::cout << "Command thread " << (thread ? "on" : "off") << ", "
+                  << statistics_ << " statistics" << std::endl;
+        std::cout << "Packets" << std::endl;
+        packet_stats.report(std::cout, false);
+        std::cout << "statistic-get-all" << std::endl;
+        command_stats.report(std::cout, false);
+        std::cout << std::endl;
+    }
+
+private:
+
+    /// @brief Returns the name of a subnet statistic.
+    ///
+    /// @param i Statistic index.
+    std::string getSubnetStat(const size_t i) const {
+        std::ostringstream s;
+        s << "subnet[" << (i + 1) << "].assigned-addresses";
+        return (s.str());
+    }
+
+    /// @brief Checks if the client thread has sent its last command.
+    bool isClientDone() {
+        Mutex::Locker lock(mutex_);
+        return (client_done_);
+    }
+
+    /// @brief Sends the statistic-get-all command until the packets are
+    /// processed.
+    ///
+    /// @param stats Statistics of the command round trip times.
+    void runClient(StageStats& stats) {
+        const std::string command("{ \"command\": \"statistic-get-all\" }");
+        for (;;) {
+            {
+                Mutex::Locker lock(mutex_);
+                if (stopping_) {
+                    break;
+                }
+            }
+            stats.startPacket();
+            if (!sendCommand(command)) {
+                std::cerr << "statistic-get-all failed" << std::endl;
+                break;
+            }
+            stats.endPacket(0);
+        }
+        Mutex::Locker lock(mutex_);
+        client_done_ = true;
+    }
+
+    /// @brief Sends a command and reads the whole response.
+    ///
+    /// @param command Command to be sent.
+    /// @return true if a response was received.
+    bool sendCommand(const std::string& command) const {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            return (false);
+        }
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, socket_name_.c_str(),
+                sizeof(addr.sun_path) - 1);
+        if ((connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                     sizeof(addr)) < 0) ||
+            (send(fd, command.c_str(), command.size(), 0) < 0)) {
+            close(fd);
+            return (false);
+        }
+
+        // The server closes the connection once the response is sent.
+        size_t received = 0;
+        char buf[65536];
+        ssize_t len;
+        while ((len = recv(fd, buf, sizeof(buf), 0)) > 0) {
+            received += len;
+        }
+        close(fd);
+        return (received > 0);
+    }
+
+    /// @brief Number of subnet statistics.
+    size_t statistics_;
+
+    /// @brief Number of packets.
+    size_t packets_;
+
+    /// @brief Control socket name.
+    std::string socket_name_;
+
+    /// @brief IO service polled by the packet loop.
+    IOServicePtr io_service_;
+
+    /// @brief Mutex protecting the client thread flags.
+    Mutex mutex_;
+
+    /// @brief Indicates that the client thread should stop.
+    bool stopping_;
+
+    /// @brief Indicates that the client thread has stopped.
+    bool client_done_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t statistics = 10000;
+    size_t packets = 1000000;
+    std::string thread = "both";
+    std::string socket_name = "control_cmd_bench.sock";
+
+    int ch;
+    while ((ch = getopt(argc, argv, "s:n:t:f:")) != -1) {
+        switch (ch) {
+        case 's':
+            statistics = strtoul(optarg, NULL, 10);
+            if (statistics == 0) {
+                usage();
+            }
+            break;
+        case 'n':
+            packets = strtoul(optarg, NULL, 10);
+            if (packets == 0) {
+                usage();
+            }
+            break;
+        case 't':
+            thread = optarg;
+            if ((thread != "off") && (thread != "on") && (thread != "both")) {
+                usage();
+            }
+            break;
+        case 'f':
+            socket_name = optarg;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("control_cmd_bench", isc::log::ERROR);
+        ControlCmdBench bench(statistics, packets, socket_name);
+        if (thread != "on") {
+            bench.run(false);
+        }
+        if (thread != "off") {
+            bench.run(true);
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
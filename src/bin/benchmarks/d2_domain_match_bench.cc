@@ -0,0 +1,220 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <d2/d2_config.h>
+#include <log/logger_support.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::bench;
+using namespace isc::d2;
+
+namespace {
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: d2_domain_match_bench [-n zones] [-l lookups] [-t]"
+              << std::endl
+              << "  -n: number of reverse zones (default: 10000)" << std::endl
+              << "  -l: number of lookups (default: 10000)" << std::endl
+              << "  -t: don't run the linear scan for comparison" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Matches the FQDN to the domain by scanning all domains.
+///
+/// This is the reference implementation comparing the FQDN with each
+/// domain name, as DdnsDomainListMgr::matchDomain did before it used the
+/// trie of the domain names.
+///
+/// @param domains map of the domains.
+/// @param fqdn is the name for which to look.
+///
+/// @return returns the matching domain or an empty pointer.
+DdnsDomainPtr
+linearMatch(const DdnsDomainMap& domains, const std::string& fqdn) {
+    size_t req_len = fqdn.size();
+    size_t match_len = 0;
+    DdnsDomainPtr best_match;
+    for (DdnsDomainMap::const_iterator it = domains.begin();
+         it != domains.end(); ++it) {
+        const std::string& domain_name = it->first;
+        size_t dom_len = domain_name.size();
+        if (req_len < dom_len) {
+            continue;
+        }
+        if (req_len == dom_len) {
+            if (boost::iequals(fqdn, domain_name)) {
+                return (it->second);
+            }
+        } else {
+            size_t offset = req_len - dom_len;
+            if ((fqdn[offset - 1] == '.') &&
+                (boost::iequals(fqdn.substr(offset), domain_name)) &&
+                (dom_len > match_len)) {
+                match_len = dom_len;
+                best_match = it->second;
+            }
+        }
+    }
+    return (best_match);
+}
+
+/// @brief Benchmark of the DDNS domain matching.
+///
+/// The benchmark configures a reverse domain list manager with the given
+/// number of /24 IPv4 reverse zones, e.g. "7.3.10.in-addr.arpa.", and
+/// matches the reverse names of the addresses spread over these zones,
+/// as done for each reverse DNS update. About one in eight lookups is
+/// for an address out of the configured zones. The same lookups are
+/// then repeated with the linear scan of all zones.
+class DomainMatchBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param zones Number of zones.
+    /// @param lookups Number of lookups.
+    DomainMatchBench(const size_t zones, const size_t lookups)
+        : domains_(new DdnsDomainMap()), mgr_("reverse-ddns") {
+        DnsServerInfoStoragePtr servers(new DnsServerInfoStorage());
+        for (size_t i = 0; i < zones; ++i) {
+            const std::string name = zoneName(i);
+            (*domains_)[name].reset(new DdnsDomain(name, servers));
+        }
+        mgr_.setDomains(domains_);
+
+        for (size_t i = 0; i < lookups; ++i) {
+            // Scatter the lookups over the zones and beyond them.
+            const size_t zone = (i * 7919) % (zones + zones / 7 + 1);
+            std::ostringstream fqdn;
+            fqdn << (i % 254 + 1) << "." << zoneName(zone);
+            fqdns_.push_back(fqdn.str());
+        }
+    }
+
+    /// @brief Runs the benchmark.
+    ///
+    /// @param linear Indicates if the linear scan should be run.
+    void run(const bool linear) {
+        std::vector<std::string> names(1, "match");
+
+        StageStats trie_stats(names);
+        size_t matched = 0;
+        DdnsDomainPtr domain;
+        for (size_t i = 0; i < fqdns_.size(); ++i) {
+            trie_stats.startPacket();
+            if (mgr_.matchDomain(fqdns_[i], domain)) {
+                ++matched;
+            }
+            trie_stats.endPacket(0);
+        }
+        std::cout << "Label trie match, " << domains_->size() << " zones, "
+                  << matched << " of " << fqdns_.size()
+                  << " lookups matched" << std::endl;
+        trie_stats.report(std::cout, false);
+        std::cout << std::endl;
+
+        if (!linear) {
+            return;
+        }
+
+        StageStats linear_stats(names);
+        matched = 0;
+        for (size_t i = 0; i < fqdns_.size(); ++i) {
+            linear_stats.startPacket();
+            if (linearMatch(*domains_, fqdns_[i])) {
+                ++matched;
+            }
+            linear_stats.endPacket(0);
+        }
+        std::cout << "Linear scan match, " << domains_->size() << " zones, "
+                  << matched << " of " << fqdns_.size()
+                  << " lookups matched" << std::endl;
+        linear_stats.report(std::cout, false);
+        std::cout << std::endl;
+    }
+
+private:
+
+    /// @brief Returns the name of the /24 reverse zone.
+    ///
+    /// @param index Index of the zone.
+    static std::string zoneName(const size_t index) {
+        std::ostringstream name;
+        name << index % 256 << "." << index / 256 % 256 << "."
+             << 10 + index / 65536 << ".in-addr.arpa.";
+        return (name.str());
+    }
+
+    /// @brief Configured zones.
+    DdnsDomainMapPtr domains_;
+
+    /// @brief Domain list manager holding the zones.
+    DdnsDomainListMgr mgr_;
+
+    /// @brief Names looked up.
+    std::vector<std::string> fqdns_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t zones = 10000;
+    size_t lookups = 10000;
+    bool linear = true;
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:l:t")) != -1) {
+        switch (ch) {
+        case 'n':
+            zones = strtoul(optarg, NULL, 10);
+            if (zones == 0) {
+                usage();
+            }
+            break;
+        case 'l':
+            lookups = strtoul(optarg, NULL, 10);
+            if (lookups == 0) {
+                usage();
+            }
+            break;
+        case 't':
+            linear = false;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        // The lookups out of the zones would log a warning each.
+        isc::log::initLogger("d2_domain_match_bench", isc::log::ERROR);
+        DomainMatchBench bench(zones, lookups);
+        bench.run(linear);
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,431 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/pkt_filter_queue.h>
+#include <benchmarks/stage_stats.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/libdhcp++.h>
+#include <dhcp/option_custom.h>
+#include <dhcp/option_definition.h>
+#include <dhcp4/dhcp4_srv.h>
+#include <dhcp4/json_config_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <hooks/hooks_manager.h>
+#include <log/logger_support.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::hooks;
+
+namespace {
+
+/// @brief Processing stages of the DHCPv4 packet.
+enum Stage {
+    STAGE_UNPACK,
+    STAGE_CLASSIFY,
+    STAGE_SUBNET_SELECT,
+    STAGE_ALLOCATE,
+    STAGE_PACK,
+    STAGE_OTHER
+};
+
+/// @brief Statistics of the benchmark in progress.
+///
+/// The callouts measuring the stages use this pointer.
+StageStats* stage_stats = NULL;
+
+/// @brief Name of the interface used by the benchmark.
+const char* IFACE_NAME = "eth0";
+
+/// @brief Unpacks the query and tells the server to skip unpacking.
+int
+buffer4_receive(CalloutHandle& handle) {
+    stage_stats->mark(STAGE_OTHER);
+    Pkt4Ptr query;
+    handle.getArgument("query4", query);
+    query->unpack();
+    handle.setStatus(CalloutHandle::NEXT_STEP_SKIP);
+    stage_stats->mark(STAGE_UNPACK);
+    return (0);
+}
+
+/// @brief Marks the end of the classification.
+int
+pkt4_receive(CalloutHandle&) {
+    stage_stats->mark(STAGE_CLASSIFY);
+    return (0);
+}
+
+/// @brief Marks the end of the subnet selection.
+int
+subnet4_select(CalloutHandle&) {
+    stage_stats->markOnce(STAGE_SUBNET_SELECT);
+    return (0);
+}
+
+/// @brief Marks the end of the allocation and packs the response.
+int
+pkt4_send(CalloutHandle& handle) {
+    stage_stats->mark(STAGE_ALLOCATE);
+    Pkt4Ptr response;
+    handle.getArgument("response4", response);
+    response->pack();
+    handle.setStatus(CalloutHandle::NEXT_STEP_SKIP);
+    stage_stats->mark(STAGE_PACK);
+    return (0);
+}
+
+/// @brief Names of the hook points used to measure the stages.
+const char* HOOK_POINTS[] = {
+    "buffer4_receive", "pkt4_receive", "subnet4_select", "pkt4_send"
+};
+
+/// @brief Callouts measuring the stages.
+const CalloutPtr CALLOUTS[] = {
+    buffer4_receive, pkt4_receive, subnet4_select, pkt4_send
+};
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: dhcp4_srv_bench [-n clients] [-l off|on|both]"
+              << " [-f lease-file] [-t]" << std::endl
+              << "  -n: number of clients performing the 4-way exchange"
+              << " (default: 10000)" << std::endl
+              << "  -l: lease file persistence (default: both)" << std::endl
+              << "  -f: lease file name (default: dhcp4_srv_bench.csv)"
+              << std::endl
+              << "  -t: measure the throughput only, without the stages"
+              << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Benchmark of the DHCPv4 server.
+///
+/// The benchmark configures the server with a single large subnet on a
+/// fake interface and the memfile lease database. It then simulates the
+/// specified number of clients, each performing the DORA exchange. The
+/// queries are packed by the simulated clients and passed in the wire
+/// format to the @c Dhcpv4Srv::processPacket. The responses are sent
+/// through the @c IfaceMgr to the @c PktFilterQueue from where the
+/// clients pick them.
+///
+/// Only the server side of the exchange is timed: the processing of the
+/// queries and sending the responses. When the per-stage breakdown is
+/// enabled, the callouts registered on the hook points mark the stage
+/// boundaries:
+/// - unpack: unpacking the query in the buffer4_receive callout,
+/// - classify: sanity checks and classification, up to pkt4_receive,
+/// - subnet select: up to the first subnet4_select,
+/// - allocate: lease allocation and building the response, up to pkt4_send,
+/// - pack: packing the response in the pkt4_send callout,
+/// - other: everything else, including sending the response and the
+///   overhead of the callouts.
+class Dhcpv4SrvBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param clients Number of clients.
+    /// @param lease_file Name of the lease file.
+    /// @param stages Indicates if the stages should be measured.
+    Dhcpv4SrvBench(const size_t clients, const std::string& lease_file,
+                   const bool stages)
+        : clients_(clients), lease_file_(lease_file), stages_(stages),
+          filter_(new PktFilterQueue()), acks_(0) {
+        IfaceMgr& iface_mgr = IfaceMgr::instance();
+        iface_mgr.closeSockets();
+        iface_mgr.clearIfaces();
+        iface_mgr.setTestMode(true);
+        iface_mgr.setPacketFilter(filter_);
+
+        IfacePtr iface(new Iface(IFACE_NAME, 1));
+        iface->flag_up_ = true;
+        iface->flag_running_ = true;
+        iface->flag_broadcast_ = false;
+        iface->inactive4_ = false;
+        std::vector<uint8_t> mac(6, 8);
+        iface->setMac(&mac[0], mac.size());
+        iface->setHWType(HTYPE_ETHER);
+        iface->addAddress(IOAddress("10.0.0.1"));
+        iface_mgr.addInterface(iface);
+    }
+
+    /// @brief Runs the benchmark.
+    ///
+    /// @param persist Indicates if the leases should be written to the
+    /// lease file.
+    void run(const bool persist) {
+        static_cast<void>(remove(lease_file_.c_str()));
+        configure(persist);
+
+        std::vector<std::string> names;
+        names.push_back("unpack");
+        names.push_back("classify");
+        names.push_back("subnet select");
+        names.push_back("allocate");
+        names.push_back("pack");
+        names.push_back("other");
+        StageStats stats(names);
+        stage_stats = &stats;
+        acks_ = 0;
+
+        if (stages_) {
+            for (size_t i = 0; i < sizeof(CALLOUTS) / sizeof(CALLOUTS[0]); ++i) {
+                HooksManager::preCalloutsLibraryHandle().
+                    registerCallout(HOOK_POINTS[i], CALLOUTS[i]);
+            }
+        }
+
+        for (size_t i = 0; i < clients_; ++i) {
+            doDORA(i);
+        }
+
+        if (stages_) {
+            for (size_t i = 0; i < sizeof(CALLOUTS) / sizeof(CALLOUTS[0]); ++i) {
+                HooksManager::preCalloutsLibraryHandle().
+                    deregisterAllCallouts(HOOK_POINTS[i]);
+            }
+        }
+        stage_stats = NULL;
+
+        std::cout << "DHCPv4 DORA, memfile with persistence "
+                  << (persist ? "on" : "off") << ", " << clients_
+                  << " clients, " << acks_ << " leases acknowledged"
+                  << std::endl;
+        stats.report(std::cout, stages_);
+        std::cout << std::endl;
+
+        srv_.reset();
+        IfaceMgr::instance().closeSockets();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        static_cast<void>(remove(lease_file_.c_str()));
+    }
+
+private:
+
+    /// @brief Configures the server.
+    ///
+    /// @param persist Indicates if the leases should be written to the
+    /// lease file.
+    void configure(const bool persist) {
+        CfgMgr::instance().clear();
+        srv_.reset(new Dhcpv4Srv(0));
+
+        std::ostringstream config;
+        config << "{ \"interfaces-config\": {"
+               << "    \"interfaces\": [ \"" << IFACE_NAME << "\" ],"
+               << "    \"re-detect\": false },"
+               << "  \"lease-database\": {"
+               << "    \"type\": \"memfile\","
+               << "    \"persist\": " << (persist ? "true" : "false") << ","
+               << "    \"name\": \"" << lease_file_ << "\","
+               << "    \"lfc-interval\": 0 },"
+               << "  \"valid-lifetime\": 4000,"
+               << "  \"renew-timer\": 1000,"
+               << "  \"rebind-timer\": 2000,"
+               << "  \"subnet4\": [ {"
+               << "    \"subnet\": \"10.0.0.0/8\","
+               << "    \"pools\": [ { \"pool\": \"10.1.0.0 - 10.254.255.255\" } ]"
+               << "  } ] }";
+
+        ConstElementPtr status = configureDhcp4Server(*srv_,
+            Element::fromJSON(config.str()));
+        int rcode = 0;
+        ConstElementPtr comment = config::parseAnswer(rcode, status);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "configuration failed: " << comment->str());
+        }
+
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=4");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+        CfgMgr::instance().getCurrentCfg()->getCfgIface()->
+            openSockets(AF_INET, DHCP4_SERVER_PORT, false);
+    }
+
+    /// @brief Performs the DORA exchange for a client.
+    ///
+    /// @param client Index of the client.
+    void doDORA(const size_t client) {
+        HWAddrPtr hwaddr = makeHWAddr(client);
+        const uint32_t xid = static_cast<uint32_t>(client) + 1;
+
+        Pkt4Ptr discover(new Pkt4(DHCPDISCOVER, xid));
+        discover->setHWAddr(hwaddr);
+        Pkt4Ptr offer = exchange(discover);
+        if (!offer || (offer->getType() != DHCPOFFER)) {
+            return;
+        }
+
+        Pkt4Ptr request(new Pkt4(DHCPREQUEST, xid));
+        request->setHWAddr(hwaddr);
+        OptionDefinitionPtr def =
+            LibDHCP::getOptionDef(DHCP4_OPTION_SPACE, DHO_DHCP_REQUESTED_ADDRESS);
+        OptionCustomPtr requested(new OptionCustom(*def, Option::V4));
+        requested->writeAddress(offer->getYiaddr());
+        request->addOption(requested);
+        OptionPtr server_id = offer->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+        if (server_id) {
+            request->addOption(server_id);
+        }
+        Pkt4Ptr ack = exchange(request);
+        if (ack && (ack->getType() == DHCPACK)) {
+            ++acks_;
+        }
+    }
+
+    /// @brief Passes the query to the server and returns the response.
+    ///
+    /// @param query Query built by the client.
+    /// @return Response parsed by the client or NULL if the server didn't
+    /// respond.
+    Pkt4Ptr exchange(const Pkt4Ptr& query) {
+        OptionPtr prl(new Option(Option::V4, DHO_DHCP_PARAMETER_REQUEST_LIST));
+        prl->setUint8(DHO_SUBNET_MASK);
+        query->addOption(prl);
+        query->pack();
+
+        // Simulate reception of the query from the wire.
+        const util::OutputBuffer& buf = query->getBuffer();
+        Pkt4Ptr received(new Pkt4(static_cast<const uint8_t*>(buf.getData()),
+                                  buf.getLength()));
+        received->setIface(IFACE_NAME);
+        received->setIndex(1);
+        received->setRemoteAddr(IOAddress("0.0.0.0"));
+        received->setRemotePort(DHCP4_CLIENT_PORT);
+        received->setLocalAddr(IOAddress("255.255.255.255"));
+        received->setLocalPort(DHCP4_SERVER_PORT);
+        filter_->pushReceived(received);
+
+        // This is the part of the exchange performed by the server.
+        stage_stats->startPacket();
+        IfacePtr iface = IfaceMgr::instance().getIface(IFACE_NAME);
+        Pkt4Ptr pkt = filter_->receive(*iface, SocketInfo(IOAddress("10.0.0.1"),
+                                                          DHCP4_SERVER_PORT, -1));
+        Pkt4Ptr rsp;
+        srv_->processPacket(pkt, rsp);
+        if (rsp) {
+            IfaceMgr::instance().send(rsp);
+        }
+        stage_stats->endPacket(STAGE_OTHER);
+
+        Pkt4Ptr sent = filter_->popSent();
+        if (!sent) {
+            return (Pkt4Ptr());
+        }
+        const util::OutputBuffer& rsp_buf = sent->getBuffer();
+        Pkt4Ptr response(new Pkt4(static_cast<const uint8_t*>(rsp_buf.getData()),
+                                  rsp_buf.getLength()));
+        response->unpack();
+        return (response);
+    }
+
+    /// @brief Creates unique hardware address for the client.
+    ///
+    /// @param client Index of the client.
+    static HWAddrPtr makeHWAddr(const size_t client) {
+        std::vector<uint8_t> mac(6, 0);
+        mac[0] = 0x02;
+        for (size_t i = 0; i < 4; ++i) {
+            mac[5 - i] = static_cast<uint8_t>(client >> (8 * i));
+        }
+        return (HWAddrPtr(new HWAddr(mac, HTYPE_ETHER)));
+    }
+
+    /// @brief Number of clients.
+    size_t clients_;
+
+    /// @brief Name of the lease file.
+    std::string lease_file_;
+
+    /// @brief Indicates if the stages are measured.
+    bool stages_;
+
+    /// @brief Packet filter exchanging packets with the server.
+    PktFilterQueuePtr filter_;
+
+    /// @brief Server instance.
+    boost::shared_ptr<Dhcpv4Srv> srv_;
+
+    /// @brief Number of leases acknowledged.
+    size_t acks_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t clients = 10000;
+    std::string persistence = "both";
+    std::string lease_file = "dhcp4_srv_bench.csv";
+    bool stages = true;
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:l:f:t")) != -1) {
+        switch (ch) {
+        case 'n':
+            clients = strtoul(optarg, NULL, 10);
+            if (clients == 0) {
+                usage();
+            }
+            break;
+        case 'l':
+            persistence = optarg;
+            if ((persistence != "off") && (persistence != "on") &&
+                (persistence != "both")) {
+                usage();
+            }
+            break;
+        case 'f':
+            lease_file = optarg;
+            break;
+        case 't':
+            stages = false;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("dhcp4_srv_bench", isc::log::WARN);
+        Dhcpv4SrvBench bench(clients, lease_file, stages);
+        if (persistence != "on") {
+            bench.run(false);
+        }
+        if (persistence != "off") {
+            bench.run(true);
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,433 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/pkt_filter_queue.h>
+#include <benchmarks/stage_stats.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/duid.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp6/dhcp6_srv.h>
+#include <dhcp6/json_config_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <hooks/hooks_manager.h>
+#include <log/logger_support.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::hooks;
+
+namespace {
+
+/// @brief Processing stages of the DHCPv6 packet.
+enum Stage {
+    STAGE_UNPACK,
+    STAGE_CHECK,
+    STAGE_CLASSIFY_SELECT,
+    STAGE_ALLOCATE,
+    STAGE_PACK,
+    STAGE_OTHER
+};
+
+/// @brief Statistics of the benchmark in progress.
+///
+/// The callouts measuring the stages use this pointer.
+StageStats* stage_stats = NULL;
+
+/// @brief Name of the interface used by the benchmark.
+const char* IFACE_NAME = "eth0";
+
+/// @brief Link local address of the simulated clients.
+const char* CLIENT_ADDRESS = "fe80::3a60:77ff:fed5:abcd";
+
+/// @brief Unpacks the query and tells the server to skip unpacking.
+int
+buffer6_receive(CalloutHandle& handle) {
+    stage_stats->mark(STAGE_OTHER);
+    Pkt6Ptr query;
+    handle.getArgument("query6", query);
+    query->unpack();
+    handle.setStatus(CalloutHandle::NEXT_STEP_SKIP);
+    stage_stats->mark(STAGE_UNPACK);
+    return (0);
+}
+
+/// @brief Marks the end of the sanity checks.
+int
+pkt6_receive(CalloutHandle&) {
+    stage_stats->mark(STAGE_CHECK);
+    return (0);
+}
+
+/// @brief Marks the end of the classification and subnet selection.
+int
+subnet6_select(CalloutHandle&) {
+    stage_stats->markOnce(STAGE_CLASSIFY_SELECT);
+    return (0);
+}
+
+/// @brief Marks the end of the allocation and packs the response.
+int
+pkt6_send(CalloutHandle& handle) {
+    stage_stats->mark(STAGE_ALLOCATE);
+    Pkt6Ptr response;
+    handle.getArgument("response6", response);
+    response->pack();
+    handle.setStatus(CalloutHandle::NEXT_STEP_SKIP);
+    stage_stats->mark(STAGE_PACK);
+    return (0);
+}
+
+/// @brief Names of the hook points used to measure the stages.
+const char* HOOK_POINTS[] = {
+    "buffer6_receive", "pkt6_receive", "subnet6_select", "pkt6_send"
+};
+
+/// @brief Callouts measuring the stages.
+const CalloutPtr CALLOUTS[] = {
+    buffer6_receive, pkt6_receive, subnet6_select, pkt6_send
+};
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: dhcp6_srv_bench [-n clients] [-l off|on|both]"
+              << " [-f lease-file] [-t]" << std::endl
+              << "  -n: number of clients performing the 4-way exchange"
+              << " (default: 10000)" << std::endl
+              << "  -l: lease file persistence (default: both)" << std::endl
+              << "  -f: lease file name (default: dhcp6_srv_bench.csv)"
+              << std::endl
+              << "  -t: measure the throughput only, without the stages"
+              << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Benchmark of the DHCPv6 server.
+///
+/// This is the DHCPv6 counterpart of the DHCPv4 server benchmark. The
+/// simulated clients perform the Solicit-Advertise-Request-Reply exchange,
+/// each requesting a single address in the IA_NA.
+///
+/// The per-stage breakdown differs from the DHCPv4 one because the DHCPv6
+/// server invokes the pkt6_receive callouts before classifying the query:
+/// - unpack: unpacking the query in the buffer6_receive callout,
+/// - check: sanity checks, up to pkt6_receive,
+/// - classify + select: classification and subnet selection, up to the
+///   first subnet6_select,
+/// - allocate: lease allocation and building the response, up to pkt6_send,
+/// - pack: packing the response in the pkt6_send callout,
+/// - other: everything else, including sending the response and the
+///   overhead of the callouts.
+class Dhcpv6SrvBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param clients Number of clients.
+    /// @param lease_file Name of the lease file.
+    /// @param stages Indicates if the stages should be measured.
+    Dhcpv6SrvBench(const size_t clients, const std::string& lease_file,
+                   const bool stages)
+        : clients_(clients), lease_file_(lease_file), stages_(stages),
+          filter_(new PktFilter6Queue()), replies_(0) {
+        IfaceMgr& iface_mgr = IfaceMgr::instance();
+        iface_mgr.closeSockets();
+        iface_mgr.clearIfaces();
+        iface_mgr.setTestMode(true);
+        iface_mgr.setPacketFilter(filter_);
+
+        IfacePtr iface(new Iface(IFACE_NAME, 1));
+        iface->flag_up_ = true;
+        iface->flag_running_ = true;
+        iface->flag_multicast_ = true;
+        iface->inactive6_ = false;
+        std::vector<uint8_t> mac(6, 8);
+        iface->setMac(&mac[0], mac.size());
+        iface->setHWType(HTYPE_ETHER);
+        iface->addAddress(IOAddress("fe80::3a60:77ff:fed5:cdef"));
+        iface->addAddress(IOAddress("2001:db8:1::1"));
+        iface_mgr.addInterface(iface);
+    }
+
+    /// @brief Runs the benchmark.
+    ///
+    /// @param persist Indicates if the leases should be written to the
+    /// lease file.
+    void run(const bool persist) {
+        static_cast<void>(remove(lease_file_.c_str()));
+        configure(persist);
+
+        std::vector<std::string> names;
+        names.push_back("unpack");
+        names.push_back("check");
+        names.push_back("classify+select");
+        names.push_back("allocate");
+        names.push_back("pack");
+        names.push_back("other");
+        StageStats stats(names);
+        stage_stats = &stats;
+        replies_ = 0;
+
+        if (stages_) {
+            for (size_t i = 0; i < sizeof(CALLOUTS) / sizeof(CALLOUTS[0]); ++i) {
+                HooksManager::preCalloutsLibraryHandle().
+                    registerCallout(HOOK_POINTS[i], CALLOUTS[i]);
+            }
+        }
+
+        for (size_t i = 0; i < clients_; ++i) {
+            doSARR(i);
+        }
+
+        if (stages_) {
+            for (size_t i = 0; i < sizeof(CALLOUTS) / sizeof(CALLOUTS[0]); ++i) {
+                HooksManager::preCalloutsLibraryHandle().
+                    deregisterAllCallouts(HOOK_POINTS[i]);
+            }
+        }
+        stage_stats = NULL;
+
+        std::cout << "DHCPv6 SARR, memfile with persistence "
+                  << (persist ? "on" : "off") << ", " << clients_
+                  << " clients, " << replies_ << " leases assigned"
+                  << std::endl;
+        stats.report(std::cout, stages_);
+        std::cout << std::endl;
+
+        srv_.reset();
+        IfaceMgr::instance().closeSockets();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        static_cast<void>(remove(lease_file_.c_str()));
+    }
+
+private:
+
+    /// @brief Configures the server.
+    ///
+    /// @param persist Indicates if the leases should be written to the
+    /// lease file.
+    void configure(const bool persist) {
+        CfgMgr::instance().clear();
+        srv_.reset(new Dhcpv6Srv(0));
+
+        std::ostringstream config;
+        config << "{ \"interfaces-config\": {"
+               << "    \"interfaces\": [ \"" << IFACE_NAME << "\" ],"
+               << "    \"re-detect\": false },"
+               << "  \"lease-database\": {"
+               << "    \"type\": \"memfile\","
+               << "    \"persist\": " << (persist ? "true" : "false") << ","
+               << "    \"name\": \"" << lease_file_ << "\","
+               << "    \"lfc-interval\": 0 },"
+               << "  \"preferred-lifetime\": 3000,"
+               << "  \"valid-lifetime\": 4000,"
+               << "  \"renew-timer\": 1000,"
+               << "  \"rebind-timer\": 2000,"
+               << "  \"subnet6\": [ {"
+               << "    \"subnet\": \"2001:db8:1::/48\","
+               << "    \"interface\": \"" << IFACE_NAME << "\","
+               << "    \"pools\": [ { \"pool\": \"2001:db8:1::/64\" } ]"
+               << "  } ] }";
+
+        ConstElementPtr status = configureDhcp6Server(*srv_,
+            Element::fromJSON(config.str()));
+        int rcode = 0;
+        ConstElementPtr comment = config::parseAnswer(rcode, status);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "configuration failed: " << comment->str());
+        }
+
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=6");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+        CfgMgr::instance().getCurrentCfg()->getCfgIface()->
+            openSockets(AF_INET6, DHCP6_SERVER_PORT, false);
+    }
+
+    /// @brief Performs the SARR exchange for a client.
+    ///
+    /// @param client Index of the client.
+    void doSARR(const size_t client) {
+        OptionPtr client_id = makeClientId(client);
+        const uint32_t transid = static_cast<uint32_t>(client) + 1;
+        const uint32_t iaid = 1;
+
+        Pkt6Ptr solicit(new Pkt6(DHCPV6_SOLICIT, transid));
+        solicit->addOption(client_id);
+        solicit->addOption(OptionPtr(new Option6IA(D6O_IA_NA, iaid)));
+        Pkt6Ptr advertise = exchange(solicit);
+        if (!advertise || (advertise->getType() != DHCPV6_ADVERTISE)) {
+            return;
+        }
+        OptionPtr server_id = advertise->getOption(D6O_SERVERID);
+        OptionPtr ia = advertise->getOption(D6O_IA_NA);
+        if (!server_id || !ia || !ia->getOption(D6O_IAADDR)) {
+            return;
+        }
+
+        Pkt6Ptr request(new Pkt6(DHCPV6_REQUEST, transid));
+        request->addOption(client_id);
+        request->addOption(server_id);
+        request->addOption(ia);
+        Pkt6Ptr reply = exchange(request);
+        if (reply && (reply->getType() == DHCPV6_REPLY)) {
+            ia = reply->getOption(D6O_IA_NA);
+            if (ia && ia->getOption(D6O_IAADDR)) {
+                ++replies_;
+            }
+        }
+    }
+
+    /// @brief Passes the query to the server and returns the response.
+    ///
+    /// @param query Query built by the client.
+    /// @return Response parsed by the client or NULL if the server didn't
+    /// respond.
+    Pkt6Ptr exchange(const Pkt6Ptr& query) {
+        query->pack();
+
+        // Simulate reception of the query from the wire.
+        const util::OutputBuffer& buf = query->getBuffer();
+        Pkt6Ptr received(new Pkt6(static_cast<const uint8_t*>(buf.getData()),
+                                  buf.getLength()));
+        received->setIface(IFACE_NAME);
+        received->setIndex(1);
+        received->setRemoteAddr(IOAddress(CLIENT_ADDRESS));
+        received->setRemotePort(DHCP6_CLIENT_PORT);
+        received->setLocalAddr(IOAddress(ALL_DHCP_RELAY_AGENTS_AND_SERVERS));
+        received->setLocalPort(DHCP6_SERVER_PORT);
+        filter_->pushReceived(received);
+
+        // This is the part of the exchange performed by the server.
+        stage_stats->startPacket();
+        Pkt6Ptr pkt = filter_->receive(SocketInfo(IOAddress("::"),
+                                                  DHCP6_SERVER_PORT, -1));
+        Pkt6Ptr rsp;
+        srv_->processPacket(pkt, rsp);
+        if (rsp) {
+            IfaceMgr::instance().send(rsp);
+        }
+        stage_stats->endPacket(STAGE_OTHER);
+
+        Pkt6Ptr sent = filter_->popSent();
+        if (!sent) {
+            return (Pkt6Ptr());
+        }
+        const util::OutputBuffer& rsp_buf = sent->getBuffer();
+        Pkt6Ptr response(new Pkt6(static_cast<const uint8_t*>(rsp_buf.getData()),
+                                  rsp_buf.getLength()));
+        response->unpack();
+        return (response);
+    }
+
+    /// @brief Creates unique client identifier (DUID-LL) for the client.
+    ///
+    /// @param client Index of the client.
+    static OptionPtr makeClientId(const size_t client) {
+        std::vector<uint8_t> duid(10, 0);
+        duid[1] = DUID::DUID_LL;
+        duid[3] = HTYPE_ETHER;
+        duid[4] = 0x02;
+        for (size_t i = 0; i < 4; ++i) {
+            duid[9 - i] = static_cast<uint8_t>(client >> (8 * i));
+        }
+        return (OptionPtr(new Option(Option::V6, D6O_CLIENTID, duid)));
+    }
+
+    /// @brief Number of clients.
+    size_t clients_;
+
+    /// @brief Name of the lease file.
+    std::string lease_file_;
+
+    /// @brief Indicates if the stages are measured.
+    bool stages_;
+
+    /// @brief Packet filter exchanging packets with the server.
+    PktFilter6QueuePtr filter_;
+
+    /// @brief Server instance.
+    boost::shared_ptr<Dhcpv6Srv> srv_;
+
+    /// @brief Number of leases assigned.
+    size_t replies_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t clients = 10000;
+    std::string persistence = "both";
+    std::string lease_file = "dhcp6_srv_bench.csv";
+    bool stages = true;
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:l:f:t")) != -1) {
+        switch (ch) {
+        case 'n':
+            clients = strtoul(optarg, NULL, 10);
+            if (clients == 0) {
+                usage();
+            }
+            break;
+        case 'l':
+            persistence = optarg;
+            if ((persistence != "off") && (persistence != "on") &&
+                (persistence != "both")) {
+                usage();
+            }
+            break;
+        case 'f':
+            lease_file = optarg;
+            break;
+        case 't':
+            stages = false;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("dhcp6_srv_bench", isc::log::WARN);
+        Dhcpv6SrvBench bench(clients, lease_file, stages);
+        if (persistence != "on") {
+            bench.run(false);
+        }
+        if (persistence != "off") {
+            bench.run(true);
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
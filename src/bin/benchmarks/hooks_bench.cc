@@ -0,0 +1,308 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/subnet.h>
+#include <hooks/callout_handle.h>
+#include <hooks/hooks_manager.h>
+#include <log/logger_support.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::dhcp;
+using namespace isc::hooks;
+
+namespace {
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: hooks_bench [-n packets] [-c callouts]"
+              << " [-m name|slot|all]" << std::endl
+              << "  -n: number of packets (default: 1000000)" << std::endl
+              << "  -c: callouts per hook point (default: 1)" << std::endl
+              << "  -m: argument access (default: all)" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Hook points and arguments of the benchmark.
+///
+/// These are the hook points called for each DHCPv4 packet, with the
+/// arguments the server passes to them.
+struct BenchHooks {
+    int hook_index_pkt4_receive_;   ///< index for "pkt4_receive" hook point
+    int hook_index_subnet4_select_; ///< index for "subnet4_select" hook point
+    int hook_index_lease4_select_;  ///< index for "lease4_select" hook point
+    int hook_index_pkt4_send_;      ///< index for "pkt4_send" hook point
+
+    ArgumentSlot<Pkt4Ptr> query4_arg_;      ///< "query4" argument
+    ArgumentSlot<Pkt4Ptr> response4_arg_;   ///< "response4" argument
+    ArgumentSlot<Subnet4Ptr> subnet4_arg_;  ///< "subnet4" argument
+    ArgumentSlot<Lease4Ptr> lease4_arg_;    ///< "lease4" argument
+
+    /// Constructor that registers the hook points and arguments.
+    BenchHooks()
+        : query4_arg_("query4"), response4_arg_("response4"),
+          subnet4_arg_("subnet4"), lease4_arg_("lease4") {
+        hook_index_pkt4_receive_   = HooksManager::registerHook("pkt4_receive");
+        hook_index_subnet4_select_ = HooksManager::registerHook("subnet4_select");
+        hook_index_lease4_select_  = HooksManager::registerHook("lease4_select");
+        hook_index_pkt4_send_      = HooksManager::registerHook("pkt4_send");
+    }
+};
+
+// The hook points must be registered before the callout manager is created.
+BenchHooks Hooks;
+
+/// @brief Indicates if the arguments are accessed through the slots rather
+/// than by name, by both the packet processing and the callouts.
+bool use_slots = false;
+
+/// @brief Sets an argument through its slot or by name.
+///
+/// @param handle Callout handle.
+/// @param slot Slot of the argument.
+/// @param name Name of the argument.
+/// @param value Value of the argument.
+template <typename T>
+void
+setArg(CalloutHandle& handle, const ArgumentSlot<T>& slot,
+       const std::string& name, const T& value) {
+    if (use_slots) {
+        handle.setArgument(slot, value);
+    } else {
+        handle.setArgument(name, value);
+    }
+}
+
+/// @brief Gets an argument through its slot or by name.
+///
+/// @param handle Callout handle.
+/// @param slot Slot of the argument.
+/// @param name Name of the argument.
+/// @param [out] value Value of the argument.
+template <typename T>
+void
+getArg(CalloutHandle& handle, const ArgumentSlot<T>& slot,
+       const std::string& name, T& value) {
+    if (use_slots) {
+        handle.getArgument(slot, value);
+    } else {
+        handle.getArgument(name, value);
+    }
+}
+
+/// @brief Callout of the pkt4_receive and pkt4_send hook points.
+///
+/// @param handle Callout handle.
+/// @return 0.
+int
+queryCallout(CalloutHandle& handle) {
+    Pkt4Ptr query;
+    getArg(handle, Hooks.query4_arg_, "query4", query);
+    return (0);
+}
+
+/// @brief Callout of the subnet4_select hook point.
+///
+/// Gets the query and the subnet and sets the subnet back, as a callout
+/// selecting the subnet would.
+///
+/// @param handle Callout handle.
+/// @return 0.
+int
+subnetCallout(CalloutHandle& handle) {
+    Pkt4Ptr query;
+    Subnet4Ptr subnet;
+    getArg(handle, Hooks.query4_arg_, "query4", query);
+    getArg(handle, Hooks.subnet4_arg_, "subnet4", subnet);
+    setArg(handle, Hooks.subnet4_arg_, "subnet4", subnet);
+    return (0);
+}
+
+/// @brief Callout of the lease4_select hook point.
+///
+/// @param handle Callout handle.
+/// @return 0.
+int
+leaseCallout(CalloutHandle& handle) {
+    Pkt4Ptr query;
+    Lease4Ptr lease;
+    getArg(handle, Hooks.query4_arg_, "query4", query);
+    getArg(handle, Hooks.lease4_arg_, "lease4", lease);
+    return (0);
+}
+
+/// @brief Benchmark of the calls of the callouts on the DHCPv4 packet path.
+///
+/// For each packet, the arguments of four hook points are set and their
+/// callouts, registered by the server (pre-callouts library handle), are
+/// called. The arguments are accessed:
+/// - name: by name, with a new callout handle per packet, as the servers
+///   used to do,
+/// - slot: through the argument slots, reusing the callout handle of the
+///   previous packet.
+class HooksBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param packets Number of packets.
+    /// @param callouts Number of callouts per hook point.
+    HooksBench(const size_t packets, const size_t callouts)
+        : packets_(packets),
+          query_(new Pkt4(DHCPREQUEST, 1234)),
+          response_(new Pkt4(DHCPACK, 1234)),
+          subnet_(new Subnet4(IOAddress("192.0.2.0"), 24, 1000, 2000, 3000,
+                              1)),
+          lease_(new Lease4()) {
+        LibraryHandle& handle = HooksManager::preCalloutsLibraryHandle();
+        for (size_t i = 0; i < callouts; ++i) {
+            handle.registerCallout("pkt4_receive", queryCallout);
+            handle.registerCallout("subnet4_select", subnetCallout);
+            handle.registerCallout("lease4_select", leaseCallout);
+            handle.registerCallout("pkt4_send", queryCallout);
+        }
+    }
+
+    /// @brief Runs the benchmark of the given mode.
+    ///
+    /// @param mode "name" or "slot".
+    void run(const std::string& mode) {
+        use_slots = (mode == "slot");
+
+        std::vector<std::string> names;
+        names.push_back("pkt4_receive");
+        names.push_back("subnet4_select");
+        names.push_back("lease4_select");
+        names.push_back("pkt4_send");
+        StageStats stats(names);
+
+        CalloutHandlePtr handle;
+        for (size_t i = 0; i < packets_; ++i) {
+            stats.startPacket();
+            if (use_slots) {
+                handle = HooksManager::createCalloutHandle(handle);
+            } else {
+                handle = HooksManager::createCalloutHandle();
+            }
+
+            handle->deleteAllArguments();
+            setArg(*handle, Hooks.query4_arg_, "query4", query_);
+            HooksManager::callCallouts(Hooks.hook_index_pkt4_receive_,
+                                       *handle);
+            stats.mark(0);
+
+            handle->deleteAllArguments();
+            setArg(*handle, Hooks.query4_arg_, "query4", query_);
+            setArg(*handle, Hooks.subnet4_arg_, "subnet4", subnet_);
+            HooksManager::callCallouts(Hooks.hook_index_subnet4_select_,
+                                       *handle);
+            Subnet4Ptr subnet;
+            getArg(*handle, Hooks.subnet4_arg_, "subnet4", subnet);
+            stats.mark(1);
+
+            handle->deleteAllArguments();
+            setArg(*handle, Hooks.query4_arg_, "query4", query_);
+            setArg(*handle, Hooks.lease4_arg_, "lease4", lease_);
+            HooksManager::callCallouts(Hooks.hook_index_lease4_select_,
+                                       *handle);
+            stats.mark(2);
+
+            handle->deleteAllArguments();
+            setArg(*handle, Hooks.response4_arg_, "response4", response_);
+            setArg(*handle, Hooks.query4_arg_, "query4", query_);
+            HooksManager::callCallouts(Hooks.hook_index_pkt4_send_, *handle);
+            stats.endPacket(3);
+        }
+
+        std::cout << "Arguments by " << mode << ", " << packets_
+                  << " packets" << std::endl;
+        stats.report(std::cout, true);
+        std::cout << std::endl;
+    }
+
+private:
+
+    /// @brief Number of packets.
+    size_t packets_;
+
+    /// @brief Query passed to the callouts.
+    Pkt4Ptr query_;
+
+    /// @brief Response passed to the callouts.
+    Pkt4Ptr response_;
+
+    /// @brief Subnet passed to the callouts.
+    Subnet4Ptr subnet_;
+
+    /// @brief Lease passed to the callouts.
+    Lease4Ptr lease_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t packets = 1000000;
+    size_t callouts = 1;
+    std::string mode = "all";
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:c:m:")) != -1) {
+        switch (ch) {
+        case 'n':
+            packets = strtoul(optarg, NULL, 10);
+            if (packets == 0) {
+                usage();
+            }
+            break;
+        case 'c':
+            callouts = strtoul(optarg, NULL, 10);
+            break;
+        case 'm':
+            mode = optarg;
+            if ((mode != "name") && (mode != "slot") && (mode != "all")) {
+                usage();
+            }
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("hooks_bench", isc::log::ERROR);
+        HooksBench bench(packets, callouts);
+        if ((mode == "name") || (mode == "all")) {
+            bench.run("name");
+        }
+        if ((mode == "slot") || (mode == "all")) {
+            bench.run("slot");
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,369 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <agent/ca_response_creator_factory.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <http/listener.h>
+#include <log/logger_support.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::agent;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::http;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Address of the HTTP listener.
+const char* SERVER_ADDRESS = "127.0.0.1";
+
+/// @brief Request Timeout of the HTTP listener (ms).
+const long REQUEST_TIMEOUT = 10000;
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: http_keepalive_bench [-n requests] [-b batch]"
+              << " [-p port] [-m close|keepalive|pipeline|all]" << std::endl
+              << "  -n: number of requests (default: 10000)" << std::endl
+              << "  -b: pipelined requests per write (default: 16)"
+              << std::endl
+              << "  -p: listener port on 127.0.0.1 (default: 53002)"
+              << std::endl
+              << "  -m: connection mode (default: all)" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Benchmark of the HTTP connection handling of the Control Agent.
+///
+/// The HTTP listener is created with the response creator of the Control
+/// Agent and runs in a separate thread. The benchmark sends the
+/// list-commands command, which the agent handles itself, over the
+/// loopback interface:
+/// - close: a new connection per request, closed after the response, as
+///   the HTTP listener used to do,
+/// - keepalive: all requests over a single persistent connection, each
+///   request sent after receiving the previous response,
+/// - pipeline: all requests over a single persistent connection, sent in
+///   batches without waiting for the responses.
+class HttpKeepAliveBench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param requests Number of requests.
+    /// @param batch Number of pipelined requests per write.
+    /// @param port Listener port.
+    HttpKeepAliveBench(const size_t requests, const size_t batch,
+                       const uint16_t port)
+        : requests_(requests), batch_(batch), port_(port),
+          io_service_(new IOService()) {
+    }
+
+    /// @brief Runs the benchmark of the given mode.
+    ///
+    /// @param mode "close", "keepalive" or "pipeline".
+    void run(const std::string& mode) {
+        HttpResponseCreatorFactoryPtr rcf(new CtrlAgentResponseCreatorFactory());
+        HttpListener listener(*io_service_, IOAddress(SERVER_ADDRESS), port_,
+                              rcf, REQUEST_TIMEOUT);
+        listener.start();
+        Thread server(boost::bind(&IOService::run, io_service_.get()));
+
+        std::vector<std::string> names(1, "request");
+        StageStats stats(names);
+        bool ok = true;
+        try {
+            if (mode == "close") {
+                runClose(stats);
+            } else if (mode == "keepalive") {
+                runKeepAlive(stats);
+            } else {
+                runPipeline(stats);
+            }
+        } catch (const std::exception& ex) {
+            std::cerr << mode << " failed: " << ex.what() << std::endl;
+            ok = false;
+        }
+
+        io_service_->stop();
+        server.wait();
+        listener.stop();
+        io_service_->get_io_service().reset();
+        io_service_->poll();
+
+        if (ok) {
+            std::cout << "Mode " << mode << ", " << requests_ << " requests";
+            if (mode == "pipeline") {
+                std::cout << " in batches of " << batch_
+                          << " (latency per batch)";
+            }
+            std::cout << std::endl;
+            stats.report(std::cout, false);
+            std::cout << std::endl;
+        }
+    }
+
+private:
+
+    /// @brief Returns the list-commands request.
+    ///
+    /// @param close Indicates if the request asks to close the connection.
+    std::string createRequest(const bool close) const {
+        const std::string body("{ \"command\": \"list-commands\" }");
+        std::ostringstream s;
+        s << "POST / HTTP/1.1\r\n"
+          << "Content-Type: application/json\r\n";
+        if (close) {
+            s << "Connection: close\r\n";
+        }
+        s << "Content-Length: " << body.size() << "\r\n\r\n" << body;
+        return (s.str());
+    }
+
+    /// @brief Connects to the listener.
+    ///
+    /// @return Socket descriptor.
+    int connectToServer() const {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            isc_throw(Unexpected, "socket failed");
+        }
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port_);
+        addr.sin_addr.s_addr = inet_addr(SERVER_ADDRESS);
+        if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                    sizeof(addr)) < 0) {
+            close(fd);
+            isc_throw(Unexpected, "connect failed");
+        }
+        return (fd);
+    }
+
+    /// @brief Sends the whole data.
+    ///
+    /// @param fd Socket descriptor.
+    /// @param data Data to be sent.
+    void sendAll(const int fd, const std::string& data) const {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t len = send(fd, data.data() + sent, data.size() - sent, 0);
+            if (len <= 0) {
+                isc_throw(Unexpected, "send failed");
+            }
+            sent += len;
+        }
+    }
+
+    /// @brief Receives a response.
+    ///
+    /// @param fd Socket descriptor.
+    /// @param [in,out] buffer Data received and not consumed yet, which
+    /// may include the next responses.
+    void receiveResponse(const int fd, std::string& buffer) const {
+        size_t header_end = std::string::npos;
+        size_t length = 0;
+        char buf[16384];
+        for (;;) {
+            if (header_end == std::string::npos) {
+                header_end = buffer.find("\r\n\r\n");
+                if (header_end != std::string::npos) {
+                    header_end += 4;
+                    const std::string header("Content-Length: ");
+                    size_t pos = buffer.find(header);
+                    if ((pos == std::string::npos) || (pos > header_end)) {
+                        isc_throw(Unexpected, "no Content-Length in response");
+                    }
+                    length = strtoul(buffer.c_str() + pos + header.size(),
+                                     NULL, 10);
+                }
+            }
+            if ((header_end != std::string::npos) &&
+                (buffer.size() >= header_end + length)) {
+                if (buffer.compare(0, 12, "HTTP/1.1 200") != 0) {
+                    isc_throw(Unexpected, "unexpected response "
+                              << buffer.substr(0, buffer.find("\r\n")));
+                }
+                buffer.erase(0, header_end + length);
+                return;
+            }
+            ssize_t len = recv(fd, buf, sizeof(buf), 0);
+            if (len <= 0) {
+                isc_throw(Unexpected, "connection closed by the server");
+            }
+            buffer.append(buf, len);
+        }
+    }
+
+    /// @brief Sends each request over a new connection.
+    ///
+    /// @param stats Request latency statistics.
+    void runClose(StageStats& stats) {
+        const std::string request = createRequest(true);
+        for (size_t i = 0; i < requests_; ++i) {
+            stats.startPacket();
+            int fd = connectToServer();
+            std::string buffer;
+            try {
+                sendAll(fd, request);
+                receiveResponse(fd, buffer);
+            } catch (...) {
+                close(fd);
+                throw;
+            }
+            close(fd);
+            stats.endPacket(0);
+        }
+    }
+
+    /// @brief Sends the requests one by one over a persistent connection.
+    ///
+    /// @param stats Request latency statistics.
+    void runKeepAlive(StageStats& stats) {
+        const std::string request = createRequest(false);
+        int fd = connectToServer();
+        std::string buffer;
+        try {
+            for (size_t i = 0; i < requests_; ++i) {
+                stats.startPacket();
+                sendAll(fd, request);
+                receiveResponse(fd, buffer);
+                stats.endPacket(0);
+            }
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+    }
+
+    /// @brief Sends the requests in batches over a persistent connection.
+    ///
+    /// @param stats Batch latency statistics.
+    void runPipeline(StageStats& stats) {
+        const std::string request = createRequest(false);
+        int fd = connectToServer();
+        std::string buffer;
+        try {
+            for (size_t i = 0; i < requests_; i += batch_) {
+                const size_t count = std::min(batch_, requests_ - i);
+                std::string data;
+                for (size_t j = 0; j < count; ++j) {
+                    data += request;
+                }
+                stats.startPacket();
+                sendAll(fd, data);
+                for (size_t j = 0; j < count; ++j) {
+                    receiveResponse(fd, buffer);
+                }
+                stats.endPacket(0);
+            }
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+    }
+
+    /// @brief Number of requests.
+    size_t requests_;
+
+    /// @brief Number of pipelined requests per write.
+    size_t batch_;
+
+    /// @brief Listener port.
+    uint16_t port_;
+
+    /// @brief IO service run by the server thread.
+    IOServicePtr io_service_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t requests = 10000;
+    size_t batch = 16;
+    unsigned long port = 53002;
+    std::string mode = "all";
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:b:p:m:")) != -1) {
+        switch (ch) {
+        case 'n':
+            requests = strtoul(optarg, NULL, 10);
+            if (requests == 0) {
+                usage();
+            }
+            break;
+        case 'b':
+            batch = strtoul(optarg, NULL, 10);
+            if (batch == 0) {
+                usage();
+            }
+            break;
+        case 'p':
+            port = strtoul(optarg, NULL, 10);
+            if ((port == 0) || (port > 65535)) {
+                usage();
+            }
+            break;
+        case 'm':
+            mode = optarg;
+            if ((mode != "close") && (mode != "keepalive") &&
+                (mode != "pipeline") && (mode != "all")) {
+                usage();
+            }
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("http_keepalive_bench", isc::log::ERROR);
+        HttpKeepAliveBench bench(requests, batch, port);
+        if ((mode == "close") || (mode == "all")) {
+            bench.run("close");
+        }
+        if ((mode == "keepalive") || (mode == "all")) {
+            bench.run("keepalive");
+        }
+        if ((mode == "pipeline") || (mode == "all")) {
+            bench.run("pipeline");
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
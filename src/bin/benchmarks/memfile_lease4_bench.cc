@@ -0,0 +1,271 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <log/logger_support.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: memfile_lease4_bench [-n leases] [-s storage] [-h]"
+              << std::endl
+              << "  -n: number of leases (default: 1000000)" << std::endl
+              << "  -s: lease4, compact or both (default: both)" << std::endl
+              << "  -h: don't set the hostnames" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Returns the resident set size of the process in bytes.
+size_t
+getRss() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    statm >> size >> resident;
+    return (resident * sysconf(_SC_PAGESIZE));
+}
+
+/// @brief Benchmark of the memory used by the memfile DHCPv4 leases.
+///
+/// The leases are the ones a DHCPv4 server allocates to distinct clients
+/// in a single subnet: each lease has its own hardware address and client
+/// identifier, and optionally its own hostname. They are inserted in the
+/// @c Lease4Storage container of lease pointers, which the memfile backend
+/// used to hold, or in the @c CompactLease4Storage it now holds. Each
+/// storage is benchmarked in a child process, so the resident memory
+/// growth is not affected by the memory released by the other one.
+class MemfileLease4Bench {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param leases Number of leases.
+    /// @param hostnames Indicates if the leases have hostnames.
+    MemfileLease4Bench(const size_t leases, const bool hostnames)
+        : leases_(leases), hostnames_(hostnames) {
+    }
+
+    /// @brief Runs the benchmark of the given storage in a child process.
+    ///
+    /// @param storage "lease4" or "compact".
+    void run(const std::string& storage) {
+        std::cout.flush();
+        pid_t pid = fork();
+        if (pid < 0) {
+            isc_throw(Unexpected, "fork failed");
+        }
+        if (pid == 0) {
+            int status = EXIT_SUCCESS;
+            try {
+                if (storage == "lease4") {
+                    runLease4();
+                } else {
+                    runCompact();
+                }
+            } catch (const std::exception& ex) {
+                std::cerr << "benchmark failed: " << ex.what() << std::endl;
+                status = EXIT_FAILURE;
+            }
+            std::cout.flush();
+            _exit(status);
+        }
+        int status = 0;
+        if ((waitpid(pid, &status, 0) < 0) || !WIFEXITED(status) ||
+            (WEXITSTATUS(status) != EXIT_SUCCESS)) {
+            isc_throw(Unexpected, "benchmark of " << storage << " failed");
+        }
+    }
+
+private:
+
+    /// @brief Creates the lease of the given client.
+    ///
+    /// @param i Client index.
+    Lease4Ptr createLease(const size_t i) const {
+        uint8_t hwaddr[] = { 0x08, 0x00, 0x2b, static_cast<uint8_t>(i >> 16),
+                             static_cast<uint8_t>(i >> 8),
+                             static_cast<uint8_t>(i) };
+        uint8_t client_id[] = { 0x01, hwaddr[0], hwaddr[1], hwaddr[2],
+                                hwaddr[3], hwaddr[4], hwaddr[5] };
+        std::string hostname;
+        if (hostnames_) {
+            std::ostringstream s;
+            s << "host-" << i << ".example.org";
+            hostname = s.str();
+        }
+        HWAddrPtr hw(new HWAddr(hwaddr, sizeof(hwaddr), HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(0x0a000000 + i), hw, client_id,
+                                   sizeof(client_id), 3600, 900, 1800,
+                                   time(NULL), 1, hostnames_, hostnames_,
+                                   hostname));
+        return (lease);
+    }
+
+    /// @brief Returns the client identifier of the given client.
+    ///
+    /// @param i Client index.
+    std::vector<uint8_t> getClientId(const size_t i) const {
+        return (createLease(i)->client_id_->getClientId());
+    }
+
+    /// @brief Prints the memory used by the storage.
+    ///
+    /// @param name Storage name.
+    /// @param rss Resident set size before the insertion of the leases.
+    void reportMemory(const std::string& name, const size_t rss) const {
+        const size_t used = getRss() - rss;
+        std::cout << name << ", " << leases_ << " leases, "
+                  << used / (1024 * 1024) << " MiB, "
+                  << used / leases_ << " bytes per lease" << std::endl;
+    }
+
+    /// @brief Benchmarks the container of lease pointers.
+    void runLease4() {
+        std::vector<std::string> names(1, "lease");
+        Lease4Storage storage;
+        const size_t rss = getRss();
+        StageStats insert_stats(names);
+        for (size_t i = 0; i < leases_; ++i) {
+            Lease4Ptr lease = createLease(i);
+            insert_stats.startPacket();
+            storage.insert(lease);
+            insert_stats.endPacket(0);
+        }
+        reportMemory("Lease4Storage", rss);
+        std::cout << "Insert" << std::endl;
+        insert_stats.report(std::cout, false);
+
+        // The memfile backend used to return copies of the stored leases.
+        StageStats get_stats(names);
+        const Lease4StorageClientIdSubnetIdIndex& idx =
+            storage.get<ClientIdSubnetIdIndexTag>();
+        for (size_t i = 0; i < leases_; ++i) {
+            std::vector<uint8_t> client_id = getClientId(i);
+            get_stats.startPacket();
+            Lease4StorageClientIdSubnetIdIndex::const_iterator it =
+                idx.find(boost::make_tuple(client_id, SubnetID(1)));
+            Lease4Ptr lease(new Lease4(**it));
+            get_stats.endPacket(0);
+        }
+        std::cout << "Get by client identifier" << std::endl;
+        get_stats.report(std::cout, false);
+        std::cout << std::endl;
+    }
+
+    /// @brief Benchmarks the compact storage.
+    void runCompact() {
+        std::vector<std::string> names(1, "lease");
+        CompactLease4Storage storage;
+        const size_t rss = getRss();
+        StageStats insert_stats(names);
+        for (size_t i = 0; i < leases_; ++i) {
+            Lease4Ptr lease = createLease(i);
+            insert_stats.startPacket();
+            storage.insert(lease);
+            insert_stats.endPacket(0);
+        }
+        reportMemory("CompactLease4Storage", rss);
+        std::cout << "Insert" << std::endl;
+        insert_stats.report(std::cout, false);
+
+        StageStats get_stats(names);
+        const CompactLease4StorageClientIdSubnetIdIndex& idx =
+            storage.get<ClientIdSubnetIdIndexTag>();
+        for (size_t i = 0; i < leases_; ++i) {
+            std::vector<uint8_t> client_id = getClientId(i);
+            get_stats.startPacket();
+            CompactLease4StorageClientIdSubnetIdIndex::const_iterator it =
+                idx.find(boost::make_tuple(client_id, SubnetID(1)));
+            Lease4Ptr lease = it->toLease4();
+            get_stats.endPacket(0);
+        }
+        std::cout << "Get by client identifier" << std::endl;
+        get_stats.report(std::cout, false);
+        std::cout << std::endl;
+    }
+
+    /// @brief Number of leases.
+    size_t leases_;
+
+    /// @brief Indicates if the leases have hostnames.
+    bool hostnames_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t leases = 1000000;
+    std::string storage = "both";
+    bool hostnames = true;
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:s:h")) != -1) {
+        switch (ch) {
+        case 'n':
+            leases = strtoul(optarg, NULL, 10);
+            if ((leases == 0) || (leases > 0xffffff)) {
+                usage();
+            }
+            break;
+        case 's':
+            storage = optarg;
+            if ((storage != "lease4") && (storage != "compact") &&
+                (storage != "both")) {
+                usage();
+            }
+            break;
+        case 'h':
+            hostnames = false;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("memfile_lease4_bench", isc::log::ERROR);
+        MemfileLease4Bench bench(leases, hostnames);
+        if (storage != "compact") {
+            bench.run("lease4");
+        }
+        if (storage != "lease4") {
+            bench.run("compact");
+        }
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
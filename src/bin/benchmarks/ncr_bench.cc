@@ -0,0 +1,302 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <dhcp_ddns/ncr_io.h>
+#include <dhcp_ddns/ncr_tcp.h>
+#include <dhcp_ddns/ncr_udp.h>
+#include <log/logger_support.h>
+#include <util/buffer.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::bench;
+using namespace isc::dhcp_ddns;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Prints the usage and exits.
+void
+usage() {
+    std::cerr << "Usage: ncr_bench [-n requests] [-b batch] [-p port] [-s]"
+              << std::endl
+              << "  -n: number of requests (default: 100000)" << std::endl
+              << "  -b: TCP batch size (default: 64)" << std::endl
+              << "  -p: listener port on 127.0.0.1 (default: 53001)"
+              << std::endl
+              << "  -s: don't run the send benchmarks" << std::endl;
+    exit(EXIT_FAILURE);
+}
+
+/// @brief Benchmark of the NameChangeRequest encoding, decoding and
+/// sending.
+///
+/// The requests are the ones a DHCP server generates for the leases of a
+/// /16 IPv4 range. They are encoded and decoded in each of the wire
+/// formats, then sent in process over the loopback interface by each
+/// sender/listener pair, with a single IOService driving both ends.
+class NcrBench : public NameChangeListener::RequestReceiveHandler,
+                 public NameChangeSender::RequestSendHandler {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param requests Number of requests.
+    /// @param batch Maximum number of requests in a TCP batch.
+    /// @param port Port of the listener.
+    NcrBench(const size_t requests, const size_t batch, const uint32_t port)
+        : batch_(batch), port_(port), received_(0), sent_(0), errors_(0) {
+        for (size_t i = 0; i < requests; ++i) {
+            std::ostringstream json;
+            json << "{"
+                 << "\"change-type\":" << (i % 3 == 2 ? 1 : 0) << ","
+                 << "\"forward-change\":true,"
+                 << "\"reverse-change\":true,"
+                 << "\"fqdn\":\"host-" << i << ".example.org.\","
+                 << "\"ip-address\":\"10.1." << (i / 254 % 256) << "."
+                 << (i % 254 + 1) << "\","
+                 << "\"dhcid\":\"000101" << std::hex << std::setw(24)
+                 << std::setfill('0') << i << std::dec << "\","
+                 << "\"lease-expires-on\":\"20170921132405\","
+                 << "\"lease-length\":3600"
+                 << "}";
+            ncrs_.push_back(NameChangeRequest::fromJSON(json.str()));
+        }
+    }
+
+    /// @brief Runs the benchmark.
+    ///
+    /// @param send Indicates if the send benchmarks should be run.
+    void run(const bool send) {
+        runCodec(FMT_JSON);
+        runCodec(FMT_BINARY);
+
+        if (!send) {
+            return;
+        }
+
+        runSend(NCR_UDP, FMT_JSON, 1);
+        runSend(NCR_UDP, FMT_BINARY, 1);
+        runSend(NCR_TCP, FMT_BINARY, 1);
+        runSend(NCR_TCP, FMT_BINARY, batch_);
+    }
+
+    /// @brief Implements the receive completion handler.
+    virtual void operator ()(const NameChangeListener::Result result,
+                             NameChangeRequestPtr&) {
+        if (result == NameChangeListener::SUCCESS) {
+            ++received_;
+        }
+    }
+
+    /// @brief Implements the send completion handler.
+    virtual void operator ()(const NameChangeSender::Result result,
+                             NameChangeRequestPtr&) {
+        if (result == NameChangeSender::SUCCESS) {
+            ++sent_;
+        } else {
+            ++errors_;
+        }
+    }
+
+private:
+
+    /// @brief Encodes and decodes all requests in the given format.
+    ///
+    /// @param format Wire format.
+    void runCodec(const NameChangeFormat format) {
+        std::vector<std::string> names(1, "codec");
+        std::vector<util::OutputBuffer*> buffers;
+
+        StageStats encode_stats(names);
+        size_t bytes = 0;
+        for (size_t i = 0; i < ncrs_.size(); ++i) {
+            util::OutputBuffer* buffer = new util::OutputBuffer(256);
+            encode_stats.startPacket();
+            ncrs_[i]->toFormat(format, *buffer);
+            encode_stats.endPacket(0);
+            bytes += buffer->getLength();
+            buffers.push_back(buffer);
+        }
+        std::cout << "Encode " << ncrFormatToString(format) << ", "
+                  << ncrs_.size() << " requests, "
+                  << bytes / ncrs_.size() << " bytes per request"
+                  << std::endl;
+        encode_stats.report(std::cout, false);
+        std::cout << std::endl;
+
+        StageStats decode_stats(names);
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            util::InputBuffer buffer(buffers[i]->getData(),
+                                     buffers[i]->getLength());
+            decode_stats.startPacket();
+            NameChangeRequestPtr ncr =
+                NameChangeRequest::fromFormat(format, buffer);
+            decode_stats.endPacket(0);
+        }
+        std::cout << "Decode " << ncrFormatToString(format) << ", "
+                  << buffers.size() << " requests" << std::endl;
+        decode_stats.report(std::cout, false);
+        std::cout << std::endl;
+
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            delete buffers[i];
+        }
+    }
+
+    /// @brief Sends all requests over the given transport.
+    ///
+    /// The rate is measured from the queueing of the first request to the
+    /// reception of the last one. UDP datagrams dropped by the loopback
+    /// interface are reported as lost.
+    ///
+    /// @param protocol Transport protocol.
+    /// @param format Wire format.
+    /// @param batch Maximum number of requests in a TCP batch.
+    void runSend(const NameChangeProtocol protocol,
+                 const NameChangeFormat format, const size_t batch) {
+        IOService io_service;
+        IOAddress addr("127.0.0.1");
+        NameChangeListenerPtr listener;
+        NameChangeSenderPtr sender;
+        if (protocol == NCR_UDP) {
+            listener.reset(new NameChangeUDPListener(addr, port_, format,
+                                                     *this, true));
+            sender.reset(new NameChangeUDPSender(addr, 0, addr, port_,
+                                                 format, *this,
+                                                 ncrs_.size(), true));
+        } else {
+            listener.reset(new NameChangeTCPListener(addr, port_, format,
+                                                     *this, true));
+            sender.reset(new NameChangeTCPSender(addr, 0, addr, port_,
+                                                 format, *this,
+                                                 ncrs_.size(), true, batch));
+        }
+
+        received_ = 0;
+        sent_ = 0;
+        errors_ = 0;
+        listener->startListening(io_service);
+        sender->startSending(io_service);
+
+        ptime start = microsec_clock::universal_time();
+        for (size_t i = 0; i < ncrs_.size(); ++i) {
+            sender->sendRequest(ncrs_[i]);
+        }
+        while ((sent_ + errors_ < ncrs_.size()) && (errors_ == 0)) {
+            io_service.run_one();
+        }
+        // Collect what is still in flight without waiting for the lost
+        // datagrams.
+        while ((received_ < sent_) && (io_service.get_io_service().poll() > 0)) {
+        }
+        ptime stop = microsec_clock::universal_time();
+
+        const double seconds = (stop - start).total_microseconds() / 1e6;
+        std::cout << "Send " << ncrProtocolToString(protocol) << " "
+                  << ncrFormatToString(format);
+        if (protocol == NCR_TCP) {
+            std::cout << ", batch " << batch;
+        }
+        std::cout << ", " << ncrs_.size() << " requests" << std::endl
+                  << "  sent " << sent_ << ", received " << received_
+                  << ", errors " << errors_ << std::endl
+                  << "  time " << seconds << " s, rate "
+                  << (seconds > 0. ? received_ / seconds : 0.)
+                  << " requests/s" << std::endl << std::endl;
+
+        sender->stopSending();
+        listener->stopListening();
+        io_service.get_io_service().poll();
+    }
+
+    /// @brief Requests to encode, decode and send.
+    std::vector<NameChangeRequestPtr> ncrs_;
+
+    /// @brief Maximum number of requests in a TCP batch.
+    size_t batch_;
+
+    /// @brief Port of the listener.
+    uint32_t port_;
+
+    /// @brief Number of requests received by the listener.
+    size_t received_;
+
+    /// @brief Number of requests reported as sent by the sender.
+    size_t sent_;
+
+    /// @brief Number of failed sends.
+    size_t errors_;
+};
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[]) {
+    size_t requests = 100000;
+    size_t batch = 64;
+    uint32_t port = 53001;
+    bool send = true;
+
+    int ch;
+    while ((ch = getopt(argc, argv, "n:b:p:s")) != -1) {
+        switch (ch) {
+        case 'n':
+            requests = strtoul(optarg, NULL, 10);
+            if (requests == 0) {
+                usage();
+            }
+            break;
+        case 'b':
+            batch = strtoul(optarg, NULL, 10);
+            if ((batch == 0) || (batch > 65535)) {
+                usage();
+            }
+            break;
+        case 'p':
+            port = strtoul(optarg, NULL, 10);
+            if ((port == 0) || (port > 65535)) {
+                usage();
+            }
+            break;
+        case 's':
+            send = false;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc > optind) {
+        usage();
+    }
+
+    try {
+        isc::log::initLogger("ncr_bench", isc::log::ERROR);
+        NcrBench bench(requests, batch, port);
+        bench.run(send);
+
+    } catch (const std::exception& ex) {
+        std::cerr << "benchmark failed: " << ex.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
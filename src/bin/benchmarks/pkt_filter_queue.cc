@@ -0,0 +1,103 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/pkt_filter_queue.h>
+#include <exceptions/exceptions.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Opens /dev/null to be used as a socket descriptor.
+///
+/// @throw isc::Unexpected if the file can't be opened.
+int
+openDevNull() {
+    int fd = open("/dev/null", O_RDONLY);
+    if (fd < 0) {
+        const char* errmsg = strerror(errno);
+        isc_throw(isc::Unexpected, "cannot open /dev/null: " << errmsg);
+    }
+    return (fd);
+}
+
+/// @brief Takes the first packet from the queue.
+///
+/// @param queue Queue of packets.
+/// @tparam PktPtrType Type of the pointer to the packet.
+/// @return First packet or NULL if the queue is empty.
+template<typename PktPtrType>
+PktPtrType
+popPacket(std::deque<PktPtrType>& queue) {
+    if (queue.empty()) {
+        return (PktPtrType());
+    }
+    PktPtrType pkt = queue.front();
+    queue.pop_front();
+    return (pkt);
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace bench {
+
+bool
+PktFilterQueue::isDirectResponseSupported() const {
+    return (true);
+}
+
+SocketInfo
+PktFilterQueue::openSocket(Iface&, const IOAddress& addr, const uint16_t port,
+                           const bool, const bool) {
+    return (SocketInfo(addr, port, openDevNull()));
+}
+
+Pkt4Ptr
+PktFilterQueue::receive(Iface&, const SocketInfo&) {
+    return (popPacket(rx_queue_));
+}
+
+int
+PktFilterQueue::send(const Iface&, uint16_t, const Pkt4Ptr& pkt) {
+    tx_queue_.push_back(pkt);
+    return (0);
+}
+
+Pkt4Ptr
+PktFilterQueue::popSent() {
+    return (popPacket(tx_queue_));
+}
+
+SocketInfo
+PktFilter6Queue::openSocket(const Iface&, const IOAddress& addr,
+                            const uint16_t port, const bool) {
+    return (SocketInfo(addr, port, openDevNull()));
+}
+
+Pkt6Ptr
+PktFilter6Queue::receive(const SocketInfo&) {
+    return (popPacket(rx_queue_));
+}
+
+int
+PktFilter6Queue::send(const Iface&, uint16_t, const Pkt6Ptr& pkt) {
+    tx_queue_.push_back(pkt);
+    return (0);
+}
+
+Pkt6Ptr
+PktFilter6Queue::popSent() {
+    return (popPacket(tx_queue_));
+}
+
+} // end of namespace isc::bench
+} // end of namespace isc
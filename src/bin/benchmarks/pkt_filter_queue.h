@@ -0,0 +1,162 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PKT_FILTER_QUEUE_H
+#define PKT_FILTER_QUEUE_H
+
+#include <dhcp/iface_mgr.h>
+#include <dhcp/pkt_filter.h>
+#include <dhcp/pkt_filter6.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <boost/shared_ptr.hpp>
+#include <deque>
+
+namespace isc {
+namespace bench {
+
+/// @brief Packet filter exchanging DHCPv4 packets through in-memory queues.
+///
+/// This filter replaces the socket based filters to run the server without
+/// the network interfaces. The packets "received" by the filter are taken
+/// from the receive queue filled by the benchmark. The packets "sent" by
+/// the filter are appended to the send queue, from which the benchmark
+/// picks the server's responses.
+///
+/// The sockets "opened" by the filter are descriptors of /dev/null, so as
+/// the @c IfaceMgr can close them as usual.
+class PktFilterQueue : public dhcp::PktFilter {
+public:
+
+    /// @brief Checks if the direct DHCPv4 response is supported.
+    ///
+    /// @return Always true.
+    virtual bool isDirectResponseSupported() const;
+
+    /// @brief Simulates opening of the socket.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param addr Address on the interface to be used to send packets.
+    /// @param port Port number.
+    /// @param receive_bcast Unused.
+    /// @param send_bcast Unused.
+    ///
+    /// @return A structure describing the "opened" socket.
+    /// @throw isc::Unexpected if /dev/null can't be opened.
+    virtual dhcp::SocketInfo openSocket(dhcp::Iface& iface,
+                                        const asiolink::IOAddress& addr,
+                                        const uint16_t port,
+                                        const bool receive_bcast,
+                                        const bool send_bcast);
+
+    /// @brief Takes the next packet from the receive queue.
+    ///
+    /// @param iface Unused.
+    /// @param sock_info Unused.
+    ///
+    /// @return Next packet or NULL if the queue is empty.
+    virtual dhcp::Pkt4Ptr receive(dhcp::Iface& iface,
+                                  const dhcp::SocketInfo& sock_info);
+
+    /// @brief Appends the packet to the send queue.
+    ///
+    /// @param iface Unused.
+    /// @param sockfd Unused.
+    /// @param pkt Packet to be sent, which must be packed.
+    ///
+    /// @return Always 0.
+    virtual int send(const dhcp::Iface& iface, uint16_t sockfd,
+                     const dhcp::Pkt4Ptr& pkt);
+
+    /// @brief Appends the packet to the receive queue.
+    ///
+    /// @param pkt Packet to be returned by @c receive.
+    void pushReceived(const dhcp::Pkt4Ptr& pkt) {
+        rx_queue_.push_back(pkt);
+    }
+
+    /// @brief Takes the next packet from the send queue.
+    ///
+    /// @return Next packet or NULL if the queue is empty.
+    dhcp::Pkt4Ptr popSent();
+
+private:
+
+    /// @brief Packets to be received.
+    std::deque<dhcp::Pkt4Ptr> rx_queue_;
+
+    /// @brief Packets sent.
+    std::deque<dhcp::Pkt4Ptr> tx_queue_;
+};
+
+/// @brief Pointer to the @c PktFilterQueue.
+typedef boost::shared_ptr<PktFilterQueue> PktFilterQueuePtr;
+
+/// @brief Packet filter exchanging DHCPv6 packets through in-memory queues.
+///
+/// This is the DHCPv6 counterpart of the @c PktFilterQueue.
+class PktFilter6Queue : public dhcp::PktFilter6 {
+public:
+
+    /// @brief Simulates opening of the socket.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param addr Address on the interface to be used to send packets.
+    /// @param port Port number.
+    /// @param join_multicast Unused.
+    ///
+    /// @return A structure describing the "opened" socket.
+    /// @throw isc::Unexpected if /dev/null can't be opened.
+    virtual dhcp::SocketInfo openSocket(const dhcp::Iface& iface,
+                                        const asiolink::IOAddress& addr,
+                                        const uint16_t port,
+                                        const bool join_multicast);
+
+    /// @brief Takes the next packet from the receive queue.
+    ///
+    /// @param socket_info Unused.
+    ///
+    /// @return Next packet or NULL if the queue is empty.
+    virtual dhcp::Pkt6Ptr receive(const dhcp::SocketInfo& socket_info);
+
+    /// @brief Appends the packet to the send queue.
+    ///
+    /// @param iface Unused.
+    /// @param sockfd Unused.
+    /// @param pkt Packet to be sent, which must be packed.
+    ///
+    /// @return Always 0.
+    virtual int send(const dhcp::Iface& iface, uint16_t sockfd,
+                     const dhcp::Pkt6Ptr& pkt);
+
+    /// @brief Appends the packet to the receive queue.
+    ///
+    /// @param pkt Packet to be returned by @c receive.
+    void pushReceived(const dhcp::Pkt6Ptr& pkt) {
+        rx_queue_.push_back(pkt);
+    }
+
+    /// @brief Takes the next packet from the send queue.
+    ///
+    /// @return Next packet or NULL if the queue is empty.
+    dhcp::Pkt6Ptr popSent();
+
+private:
+
+    /// @brief Packets to be received.
+    std::deque<dhcp::Pkt6Ptr> rx_queue_;
+
+    /// @brief Packets sent.
+    std::deque<dhcp::Pkt6Ptr> tx_queue_;
+};
+
+/// @brief Pointer to the @c PktFilter6Queue.
+typedef boost::shared_ptr<PktFilter6Queue> PktFilter6QueuePtr;
+
+} // end of namespace isc::bench
+} // end of namespace isc
+
+#endif // PKT_FILTER_QUEUE_H
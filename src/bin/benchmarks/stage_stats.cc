@@ -0,0 +1,103 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <benchmarks/stage_stats.h>
+#include <iomanip>
+#include <limits>
+#include <time.h>
+
+namespace isc {
+namespace bench {
+
+StageStats::StageStats(const std::vector<std::string>& names)
+    : names_(names), totals_(names.size(), 0), marked_(names.size(), false),
+      packet_start_(0), last_mark_(0), packets_(0), total_(0),
+      min_latency_(std::numeric_limits<uint64_t>::max()), max_latency_(0) {
+}
+
+void
+StageStats::startPacket() {
+    packet_start_ = now();
+    last_mark_ = packet_start_;
+    marked_.assign(marked_.size(), false);
+}
+
+void
+StageStats::mark(const size_t stage) {
+    uint64_t current = now();
+    totals_[stage] += current - last_mark_;
+    marked_[stage] = true;
+    last_mark_ = current;
+}
+
+void
+StageStats::markOnce(const size_t stage) {
+    if (!marked_[stage]) {
+        mark(stage);
+    }
+}
+
+void
+StageStats::endPacket(const size_t stage) {
+    mark(stage);
+    uint64_t latency = last_mark_ - packet_start_;
+    total_ += latency;
+    if (latency < min_latency_) {
+        min_latency_ = latency;
+    }
+    if (latency > max_latency_) {
+        max_latency_ = latency;
+    }
+    ++packets_;
+}
+
+double
+StageStats::getTotalSeconds() const {
+    return (static_cast<double>(total_) / 1e9);
+}
+
+void
+StageStats::report(std::ostream& os, const bool stages) const {
+    if (packets_ == 0) {
+        os << "no packets processed" << std::endl;
+        return;
+    }
+
+    const double seconds = getTotalSeconds();
+    os << std::fixed << std::setprecision(3)
+       << "packets:        " << packets_ << std::endl
+       << "time:           " << seconds << " s" << std::endl
+       << "rate:           " << std::setprecision(0)
+       << (seconds > 0 ? packets_ / seconds : 0) << " packets/s" << std::endl
+       << std::setprecision(2)
+       << "latency (us):   min " << min_latency_ / 1e3
+       << ", avg " << static_cast<double>(total_) / packets_ / 1e3
+       << ", max " << max_latency_ / 1e3 << std::endl;
+
+    if (!stages) {
+        return;
+    }
+
+    os << std::left << std::setw(16) << "stage" << std::right
+       << std::setw(12) << "avg (us)" << std::setw(10) << "share" << std::endl;
+    for (size_t i = 0; i < names_.size(); ++i) {
+        os << std::left << std::setw(16) << names_[i] << std::right
+           << std::setw(12) << static_cast<double>(totals_[i]) / packets_ / 1e3
+           << std::setw(9) << (100.0 * totals_[i] / total_) << "%"
+           << std::endl;
+    }
+}
+
+uint64_t
+StageStats::now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec);
+}
+
+} // end of namespace isc::bench
+} // end of namespace isc
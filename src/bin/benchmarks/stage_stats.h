@@ -0,0 +1,110 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef STAGE_STATS_H
+#define STAGE_STATS_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace bench {
+
+/// @brief Collects the packet processing time split into stages.
+///
+/// The processing of each packet starts with a call to @c startPacket and
+/// ends with a call to @c endPacket. In between, @c mark is called at the
+/// boundaries of the processing stages: the time elapsed since the previous
+/// boundary is added to the specified stage. The stages are identified by
+/// their indexes in the vector of names passed to the constructor.
+///
+/// The time is measured with the monotonic clock with the nanosecond
+/// resolution.
+class StageStats {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param names Names of the stages.
+    explicit StageStats(const std::vector<std::string>& names);
+
+    /// @brief Starts measuring the processing time of a packet.
+    void startPacket();
+
+    /// @brief Adds the time elapsed since the last boundary to the stage.
+    ///
+    /// @param stage Index of the stage.
+    void mark(const size_t stage);
+
+    /// @brief Adds the time elapsed since the last boundary to the stage
+    /// unless the stage has already been marked for the current packet.
+    ///
+    /// This is useful for the stage boundaries which can be crossed
+    /// multiple times while processing a single packet.
+    ///
+    /// @param stage Index of the stage.
+    void markOnce(const size_t stage);
+
+    /// @brief Finishes measuring the processing time of a packet.
+    ///
+    /// @param stage Index of the stage to which the time elapsed since the
+    /// last boundary is added.
+    void endPacket(const size_t stage);
+
+    /// @brief Returns the number of packets processed.
+    uint64_t getPackets() const {
+        return (packets_);
+    }
+
+    /// @brief Returns the total processing time in seconds.
+    double getTotalSeconds() const;
+
+    /// @brief Prints the statistics.
+    ///
+    /// @param os Output stream.
+    /// @param stages Indicates if the per-stage breakdown should be printed.
+    void report(std::ostream& os, const bool stages) const;
+
+private:
+
+    /// @brief Returns the monotonic time in nanoseconds.
+    static uint64_t now();
+
+    /// @brief Names of the stages.
+    std::vector<std::string> names_;
+
+    /// @brief Total time spent in each stage in nanoseconds.
+    std::vector<uint64_t> totals_;
+
+    /// @brief Indicates which stages have been marked for the current
+    /// packet.
+    std::vector<bool> marked_;
+
+    /// @brief Time at which the current packet processing started.
+    uint64_t packet_start_;
+
+    /// @brief Time of the last stage boundary.
+    uint64_t last_mark_;
+
+    /// @brief Number of packets processed.
+    uint64_t packets_;
+
+    /// @brief Total processing time of all packets in nanoseconds.
+    uint64_t total_;
+
+    /// @brief Shortest processing time of a packet in nanoseconds.
+    uint64_t min_latency_;
+
+    /// @brief Longest processing time of a packet in nanoseconds.
+    uint64_t max_latency_;
+};
+
+} // end of namespace isc::bench
+} // end of namespace isc
+
+#endif // STAGE_STATS_H
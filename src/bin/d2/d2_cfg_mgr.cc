@@ -75,6 +75,14 @@ D2CfgContext::toElement() const {
     const dhcp_ddns::NameChangeFormat& ncr_format = d2_params_->getNcrFormat();
     d2->set("ncr-format",
             Element::create(dhcp_ddns::ncrFormatToString(ncr_format)));
+    // Set dns-update-batch-window
+    size_t batch_window = d2_params_->getDnsUpdateBatchWindow();
+    d2->set("dns-update-batch-window",
+            Element::create(static_cast<int64_t>(batch_window)));
+    // Set dns-update-batch-size
+    size_t batch_size = d2_params_->getDnsUpdateBatchSize();
+    d2->set("dns-update-batch-size",
+            Element::create(static_cast<int64_t>(batch_size)));
     // Set forward-ddns
     ElementPtr forward_ddns = Element::createMap();
     forward_ddns->set("ddns-domains", forward_mgr_->toElement());
@@ -309,7 +317,9 @@ D2CfgMgr::parseElement(const std::string& element_id,
             (element_id == "ncr-protocol") ||
             (element_id == "ncr-format") ||
             (element_id == "port")  ||
-            (element_id == "dns-server-timeout"))  {
+            (element_id == "dns-server-timeout") ||
+            (element_id == "dns-update-batch-window") ||
+            (element_id == "dns-update-batch-size"))  {
             // global scalar params require nothing extra be done
         } else if (element_id == "tsig-keys") {
             TSIGKeyInfoListParser parser;
@@ -357,6 +367,8 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     uint32_t dns_server_timeout = 0;
     dhcp_ddns::NameChangeProtocol ncr_protocol = dhcp_ddns::NCR_UDP;
     dhcp_ddns::NameChangeFormat ncr_format = dhcp_ddns::FMT_JSON;
+    uint32_t dns_update_batch_window = 0;
+    uint32_t dns_update_batch_size = 0;
 
     // Assumes that params_config has had defaults added
     BOOST_FOREACH(isc::dhcp::ConfigPair param, params_config->mapValue()) {
@@ -375,22 +387,18 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
                 port = getInt<uint32_t>(entry, value);
             } else if (entry == "dns-server-timeout") {
                 dns_server_timeout = getInt<uint32_t>(entry, value);
-            } else if (entry == "ncr-protocol") {
-                ncr_protocol = getProtocol(entry, value);
-                if (ncr_protocol != dhcp_ddns::NCR_UDP) {
-                    isc_throw(D2CfgError, "ncr-protocol : "
-                              << dhcp_ddns::ncrProtocolToString(ncr_protocol)
-                              << " is not yet supported "
+            } else if (entry == "dns-update-batch-window") {
+                dns_update_batch_window = getInt<uint32_t>(entry, value);
+            } else if (entry == "dns-update-batch-size") {
+                dns_update_batch_size = getInt<uint32_t>(entry, value);
+                if (dns_update_batch_size == 0) {
+                    isc_throw(D2CfgError, "dns-update-batch-size cannot be 0"
                               << " (" << value->getPosition() << ")");
                 }
+            } else if (entry == "ncr-protocol") {
+                ncr_protocol = getProtocol(entry, value);
             } else if (entry == "ncr-format") {
                 ncr_format = getFormat(entry, value);
-                if (ncr_format != dhcp_ddns::FMT_JSON) {
-                    isc_throw(D2CfgError, "NCR Format:"
-                              << dhcp_ddns::ncrFormatToString(ncr_format)
-                              << " is not yet supported"
-                              << " (" << value->getPosition() << ")");
-                }
             } else {
                 isc_throw(D2CfgError,
                           "unsupported parameter '" << entry
@@ -407,7 +415,9 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     // Attempt to create the new client config. This ought to fly as
     // we already validated everything.
     D2ParamsPtr params(new D2Params(ip_address, port, dns_server_timeout,
-                                    ncr_protocol, ncr_format));
+                                    ncr_protocol, ncr_format,
+                                    dns_update_batch_window,
+                                    dns_update_batch_size));
 
     getD2CfgContext()->getD2Params() = params;
 }
@@ -16,6 +16,7 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <cctype>
 #include <sstream>
 #include <string>
 
@@ -31,12 +32,16 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format)
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t dns_update_batch_window,
+                   const size_t dns_update_batch_size)
     : ip_address_(ip_address),
     port_(port),
     dns_server_timeout_(dns_server_timeout),
     ncr_protocol_(ncr_protocol),
-    ncr_format_(ncr_format) {
+    ncr_format_(ncr_format),
+    dns_update_batch_window_(dns_update_batch_window),
+    dns_update_batch_size_(dns_update_batch_size) {
     validateContents();
 }
 
@@ -44,7 +49,8 @@ D2Params::D2Params()
     : ip_address_(isc::asiolink::IOAddress("127.0.0.1")),
      port_(53001), dns_server_timeout_(100),
      ncr_protocol_(dhcp_ddns::NCR_UDP),
-     ncr_format_(dhcp_ddns::FMT_JSON) {
+     ncr_format_(dhcp_ddns::FMT_JSON),
+     dns_update_batch_window_(0), dns_update_batch_size_(16) {
     validateContents();
 }
 
@@ -66,17 +72,24 @@ D2Params::validateContents() {
                   "D2Params: DNS server timeout must be larger than 0");
     }
 
-    if (ncr_format_ != dhcp_ddns::FMT_JSON) {
+    if ((ncr_format_ != dhcp_ddns::FMT_JSON) &&
+        (ncr_format_ != dhcp_ddns::FMT_BINARY)) {
         isc_throw(D2CfgError, "D2Params: NCR Format:"
                   << dhcp_ddns::ncrFormatToString(ncr_format_)
                   << " is not yet supported");
     }
 
-    if (ncr_protocol_ != dhcp_ddns::NCR_UDP) {
+    if ((ncr_protocol_ != dhcp_ddns::NCR_UDP) &&
+        (ncr_protocol_ != dhcp_ddns::NCR_TCP)) {
         isc_throw(D2CfgError, "D2Params: NCR Protocol:"
                   << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
                   << " is not yet supported");
     }
+
+    if (dns_update_batch_size_ < 1) {
+        isc_throw(D2CfgError,
+                  "D2Params: DNS update batch size must be larger than 0");
+    }
 }
 
 std::string
@@ -93,7 +106,9 @@ D2Params::operator == (const D2Params& other) const {
             (port_ == other.port_) &&
             (dns_server_timeout_ == other.dns_server_timeout_) &&
             (ncr_protocol_ == other.ncr_protocol_) &&
-            (ncr_format_ == other.ncr_format_));
+            (ncr_format_ == other.ncr_format_) &&
+            (dns_update_batch_window_ == other.dns_update_batch_window_) &&
+            (dns_update_batch_size_ == other.dns_update_batch_size_));
 }
 
 bool
@@ -111,7 +126,9 @@ D2Params::toText() const {
            << ", ncr-protocol: "
            << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
            << ", ncr-format: " << ncr_format_
-           << dhcp_ddns::ncrFormatToString(ncr_format_);
+           << dhcp_ddns::ncrFormatToString(ncr_format_)
+           << ", dns-update-batch-window: " << dns_update_batch_window_
+           << ", dns-update-batch-size: " << dns_update_batch_size_;
 
     return (stream.str());
 }
@@ -200,9 +217,9 @@ TSIGKeyInfo::toElement() const {
 // *********************** DnsServerInfo  *************************
 DnsServerInfo::DnsServerInfo(const std::string& hostname,
                              isc::asiolink::IOAddress ip_address, uint32_t port,
-                             bool enabled)
+                             bool enabled, DNSClient::Protocol protocol)
     :hostname_(hostname), ip_address_(ip_address), port_(port),
-    enabled_(enabled) {
+    enabled_(enabled), protocol_(protocol) {
 }
 
 DnsServerInfo::~DnsServerInfo() {
@@ -212,6 +229,9 @@ std::string
 DnsServerInfo::toText() const {
     std::ostringstream stream;
     stream << (getIpAddress().toText()) << " port:" << getPort();
+    if (protocol_ == DNSClient::TCP) {
+        stream << " protocol:TCP";
+    }
     return (stream.str());
 }
 
@@ -224,6 +244,10 @@ DnsServerInfo::toElement() const {
     result->set("ip-address", Element::create(ip_address_.toText()));
     // Set port
     result->set("port", Element::create(static_cast<int64_t>(port_)));
+    // Set protocol
+    result->set("protocol", Element::create(std::string(protocol_ ==
+                                                        DNSClient::TCP ?
+                                                        "TCP" : "UDP")));
 
     return (result);
 }
@@ -280,6 +304,110 @@ DdnsDomain::toElement() const {
     return (result);
 }
 
+// *********************** DdnsDomainTrie  *************************
+
+namespace {
+
+/// @brief Iterates over the labels of a name starting from the last one.
+///
+/// The labels are returned in lower case. A name with the trailing dot
+/// has an empty last label.
+class ReverseLabelIterator {
+public:
+    /// @brief Constructor
+    ///
+    /// @param name name which labels to iterate over.
+    explicit ReverseLabelIterator(const std::string& name)
+        : name_(name), end_(name.size()), done_(false) {
+    }
+
+    /// @brief Fetches the next label.
+    ///
+    /// @param label receives the label in lower case.
+    ///
+    /// @return returns false if there are no more labels, true otherwise.
+    bool next(std::string& label) {
+        if (done_) {
+            return (false);
+        }
+        size_t start = 0;
+        if (end_ > 0) {
+            size_t dot = name_.rfind('.', end_ - 1);
+            if (dot != std::string::npos) {
+                start = dot + 1;
+            }
+        }
+        label.assign(name_, start, end_ - start);
+        for (std::string::iterator c = label.begin(); c != label.end(); ++c) {
+            *c = tolower(static_cast<unsigned char>(*c));
+        }
+        if (start == 0) {
+            done_ = true;
+        } else {
+            end_ = start - 1;
+        }
+        return (true);
+    }
+
+private:
+    /// @brief Name which labels are iterated over.
+    const std::string& name_;
+
+    /// @brief Position following the next label.
+    size_t end_;
+
+    /// @brief Indicates that the first label has been returned.
+    bool done_;
+};
+
+} // end of anonymous namespace
+
+DdnsDomainTrie::DdnsDomainTrie() : root_(new Node()) {
+}
+
+void
+DdnsDomainTrie::add(const DdnsDomainPtr& domain) {
+    // The iterator holds a reference to the name, so keep it here.
+    const std::string name = domain->getName();
+    NodePtr node = root_;
+    ReverseLabelIterator labels(name);
+    std::string label;
+    while (labels.next(label)) {
+        NodePtr& child = node->children_[label];
+        if (!child) {
+            child.reset(new Node());
+        }
+        node = child;
+    }
+    node->domain_ = domain;
+}
+
+DdnsDomainPtr
+DdnsDomainTrie::match(const std::string& fqdn) const {
+    // Walk down the trie as long as the labels match, remembering the
+    // deepest node holding a domain.
+    DdnsDomainPtr best_match;
+    const Node* node = root_.get();
+    ReverseLabelIterator labels(fqdn);
+    std::string label;
+    while (labels.next(label)) {
+        NodeMap::const_iterator child = node->children_.find(label);
+        if (child == node->children_.end()) {
+            break;
+        }
+        node = child->second.get();
+        if (node->domain_) {
+            best_match = node->domain_;
+        }
+    }
+    return (best_match);
+}
+
+void
+DdnsDomainTrie::clear() {
+    root_.reset(new Node());
+}
+
 // *********************** DdnsDomainLstMgr  *************************
 
 const char* DdnsDomainListMgr::wildcard_domain_name_ = "*";
@@ -304,10 +432,20 @@ DdnsDomainListMgr::setDomains(DdnsDomainMapPtr domains) {
     // Look for the wild card domain. If present, set the member variable
     // to remember it.  This saves us from having to look for it every time
     // we attempt a match.
+    wildcard_domain_.reset();
     DdnsDomainMap::iterator gotit = domains_->find(wildcard_domain_name_);
     if (gotit != domains_->end()) {
             wildcard_domain_ = gotit->second;
     }
+
+    // Build the trie of the other domain names used for matching.
+    trie_.clear();
+    DdnsDomainMapPair map_pair;
+    BOOST_FOREACH (map_pair, *domains_) {
+        if (map_pair.second != wildcard_domain_) {
+            trie_.add(map_pair.second);
+        }
+    }
 }
 
 bool
@@ -318,47 +456,8 @@ DdnsDomainListMgr::matchDomain(const std::string& fqdn, DdnsDomainPtr& domain) {
         return (true);
     }
 
-    // Iterate over the domain map looking for the domain which matches
-    // the longest portion of the given fqdn.
-
-    size_t req_len = fqdn.size();
-    size_t match_len = 0;
-    DdnsDomainMapPair map_pair;
-    DdnsDomainPtr best_match;
-    BOOST_FOREACH (map_pair, *domains_) {
-        std::string domain_name = map_pair.first;
-        size_t dom_len = domain_name.size();
-
-        // If the domain name is longer than the fqdn, then it cant be match.
-        if (req_len < dom_len) {
-            continue;
-        }
-
-        // If the lengths are identical and the names match we're done.
-        if (req_len == dom_len) {
-            if (boost::iequals(fqdn, domain_name)) {
-                // exact match, done
-                domain = map_pair.second;
-                return (true);
-            }
-        } else {
-            // The fqdn is longer than the domain name.  Adjust the start
-            // point of comparison by the excess in length.  Only do the
-            // comparison if the adjustment lands on a boundary. This
-            // prevents "onetwo.net" from matching "two.net".
-            size_t offset = req_len - dom_len;
-            if ((fqdn[offset - 1] == '.')  &&
-               (boost::iequals(fqdn.substr(offset), domain_name))) {
-                // Fqdn contains domain name, keep it if its better than
-                // any we have matched so far.
-                if (dom_len > match_len) {
-                    match_len = dom_len;
-                    best_match = map_pair.second;
-                }
-            }
-        }
-    }
-
+    // Find the domain which matches the longest portion of the given fqdn.
+    DdnsDomainPtr best_match = trie_.match(fqdn);
     if (!best_match) {
         // There's no match. If they specified a wild card domain use it
         // otherwise there's no domain for this entry.
@@ -468,6 +567,16 @@ DnsServerInfoParser::parse(data::ConstElementPtr server_config) {
     std::string hostname = getString(server_config, "hostname");
     std::string ip_address = getString(server_config, "ip-address");
     uint32_t port = getInteger(server_config, "port");
+    std::string protocol_str = getString(server_config, "protocol");
+
+    DNSClient::Protocol protocol = DNSClient::UDP;
+    if (boost::iequals(protocol_str, "TCP")) {
+        protocol = DNSClient::TCP;
+    } else if (!boost::iequals(protocol_str, "UDP")) {
+        isc_throw(D2CfgError, "Dns Server : invalid protocol : "
+                  << protocol_str << ", expected UDP or TCP"
+                  << " (" << getPosition("protocol", server_config) << ")");
+    }
 
     // The configuration must specify one or the other.
     if (hostname.empty() == ip_address.empty()) {
@@ -498,7 +607,8 @@ DnsServerInfoParser::parse(data::ConstElementPtr server_config) {
             // Create an IOAddress from the IP address string given and then
             // create the DnsServerInfo.
             isc::asiolink::IOAddress io_addr(ip_address);
-            server_info.reset(new DnsServerInfo(hostname, io_addr, port));
+            server_info.reset(new DnsServerInfo(hostname, io_addr, port,
+                                                true, protocol));
         } catch (const isc::asiolink::IOError& ex) {
             isc_throw(D2CfgError, "Dns Server : invalid IP address : "
                       << ip_address
@@ -8,6 +8,7 @@
 #define D2_CONFIG_H
 
 #include <asiolink/io_service.h>
+#include <d2/dns_client.h>
 #include <cc/data.h>
 #include <cc/simple_parser.h>
 #include <cc/cfg_to_element.h>
@@ -17,6 +18,7 @@
 #include <process/d_cfg_mgr.h>
 
 #include <boost/foreach.hpp>
+#include <boost/unordered_map.hpp>
 
 #include <stdint.h>
 #include <string>
@@ -143,18 +145,26 @@ public:
     /// wait for a response to a single DNS update request.
     /// @param ncr_protocol socket protocol D2 should use to receive NCRS
     /// @param ncr_format packet format of the inbound NCRs
+    /// @param dns_update_batch_window amount of time in milliseconds during
+    /// which DNS updates for the same zone and server are collected to be
+    /// sent as a single update message. Zero disables the batching.
+    /// @param dns_update_batch_size maximum number of DNS updates sent
+    /// in a single update message.
     ///
     /// @throw D2CfgError if:
     /// -# ip_address is 0.0.0.0 or ::
     /// -# port is 0
     /// -# dns_server_timeout is < 1
-    /// -# ncr_protocol is invalid, currently only NCR_UDP is supported
-    /// -# ncr_format is invalid, currently only FMT_JSON is supported
+    /// -# ncr_protocol is invalid
+    /// -# ncr_format is invalid
+    /// -# dns_update_batch_size is < 1
     D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format);
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t dns_update_batch_window = 0,
+                   const size_t dns_update_batch_size = 16);
 
     /// @brief Default constructor
     /// The default constructor creates an instance that has updates disabled.
@@ -188,6 +198,18 @@ public:
         return(ncr_format_);
     }
 
+    /// @brief Return the DNS update batching window in milliseconds.
+    ///
+    /// A value of zero means that the DNS updates are not batched.
+    size_t getDnsUpdateBatchWindow() const {
+        return(dns_update_batch_window_);
+    }
+
+    /// @brief Return the maximum number of DNS updates in a batch.
+    size_t getDnsUpdateBatchSize() const {
+        return(dns_update_batch_size_);
+    }
+
     /// @brief Return summary of the configuration used by D2.
     ///
     /// The returned summary of the configuration is meant to be appended to
@@ -216,6 +238,7 @@ protected:
     /// -# dns_server_timeout is 0
     /// -# ncr_protocol is UDP
     /// -# ncr_format is JSON
+    /// -# dns_update_batch_size is not 0
     ///
     /// @throw D2CfgError if contents are invalid
     virtual void validateContents();
@@ -237,6 +260,12 @@ private:
     /// @brief Format of the inbound requests (NCRs).
     /// Currently only JSON format is supported.
     dhcp_ddns::NameChangeFormat ncr_format_;
+
+    /// @brief Time in milliseconds during which DNS updates are batched.
+    size_t dns_update_batch_window_;
+
+    /// @brief Maximum number of DNS updates in a batch.
+    size_t dns_update_batch_size_;
 };
 
 /// @brief Dumps the contents of a D2Params as text to an output stream
@@ -428,10 +457,13 @@ public:
     /// the default.)
     /// @param enabled is a flag that indicates whether this server is
     /// enabled for use. It defaults to true.
+    /// @param protocol is the transport protocol used to send the DNS
+    /// updates to the server. It defaults to UDP.
     DnsServerInfo(const std::string& hostname,
                   isc::asiolink::IOAddress ip_address,
                   uint32_t port = STANDARD_DNS_PORT,
-                  bool enabled=true);
+                  bool enabled=true,
+                  DNSClient::Protocol protocol = DNSClient::UDP);
 
     /// @brief Destructor
     virtual ~DnsServerInfo();
@@ -457,6 +489,13 @@ public:
         return (ip_address_);
     }
 
+    /// @brief Getter which returns the server's transport protocol.
+    ///
+    /// @return returns the protocol used to send the DNS updates.
+    DNSClient::Protocol getProtocol() const {
+        return (protocol_);
+    }
+
     /// @brief Convenience method which returns whether or not the
     /// server is enabled.
     ///
@@ -499,6 +538,9 @@ private:
     /// @param enabled is a flag that indicates whether this server is
     /// enabled for use. It defaults to true.
     bool enabled_;
+
+    /// @brief The transport protocol used to send the DNS updates.
+    DNSClient::Protocol protocol_;
 };
 
 std::ostream&
@@ -593,6 +635,73 @@ typedef std::pair<std::string, DdnsDomainPtr> DdnsDomainMapPair;
 /// @brief Defines a pointer to DdnsDomain storage containers.
 typedef boost::shared_ptr<DdnsDomainMap> DdnsDomainMapPtr;
 
+/// @brief Case-insensitive trie of the domain names used for the longest
+/// match of a FQDN to a domain.
+///
+/// The trie is indexed by the labels of the domain names in the reverse
+/// order, i.e. starting from the top level domain. Each node which
+/// corresponds to a configured domain holds the pointer to this domain.
+/// Finding the longest match walks the labels of the FQDN from the last
+/// one, so its cost is proportional to the number of labels in the FQDN
+/// regardless of the number of configured domains. The children of each
+/// node are held in a hash table, so large reverse zones with hundreds of
+/// sub-domains on the same level don't slow down the walk.
+///
+/// The labels are compared case-insensitively and the names are not
+/// normalized: a name with the trailing dot has an additional empty label
+/// at its end and so it matches only FQDNs with the trailing dot. This is
+/// the same as matching the name as a suffix of the FQDN ending on the
+/// label boundary.
+class DdnsDomainTrie {
+public:
+    /// @brief Constructor
+    ///
+    /// Creates an empty trie.
+    DdnsDomainTrie();
+
+    /// @brief Adds a domain to the trie.
+    ///
+    /// If a domain with the same name (ignoring case) has already been
+    /// added, it is replaced.
+    ///
+    /// @param domain domain to add.
+    void add(const DdnsDomainPtr& domain);
+
+    /// @brief Finds the domain which matches the longest part of the FQDN.
+    ///
+    /// @param fqdn is the name for which to look.
+    ///
+    /// @return returns the matching domain or an empty pointer if no
+    /// domain matches.
+    DdnsDomainPtr match(const std::string& fqdn) const;
+
+    /// @brief Removes all domains from the trie.
+    void clear();
+
+private:
+    /// @brief Forward declaration of the trie node.
+    struct Node;
+
+    /// @brief Defines a pointer to the trie node.
+    typedef boost::shared_ptr<Node> NodePtr;
+
+    /// @brief Defines the children of the node, keyed by the lower case
+    /// label.
+    typedef boost::unordered_map<std::string, NodePtr> NodeMap;
+
+    /// @brief Node of the trie.
+    struct Node {
+        /// @brief Domain which name ends at this node, if any.
+        DdnsDomainPtr domain_;
+
+        /// @brief Nodes of the sub-domains.
+        NodeMap children_;
+    };
+
+    /// @brief Root of the trie.
+    NodePtr root_;
+};
+
 /// @brief Provides storage for and management of a list of DNS domains.
 /// In addition to housing the domain list storage, it provides domain matching
 /// services.  These services are used to match a FQDN to a domain.  Currently
@@ -630,6 +739,10 @@ public:
     /// @param domain receives the matching domain. If no match is found its
     /// contents will be unchanged.
     ///
+    /// The match uses the trie of the domain names built by @c setDomains,
+    /// so its cost depends on the number of labels in the FQDN, not on the
+    /// number of domains in the list.
+    ///
     /// @return returns true if a match is found, false otherwise.
     /// @todo This is a very basic match method, which expects valid FQDNs
     /// both as input and for the DdnsDomain::getName().  Currently both are
@@ -668,7 +781,8 @@ public:
 
     /// @brief Sets the manger's domain list to the given list of domains.
     /// This method will scan the inbound list for the wild card domain and
-    /// set the internal wild card domain pointer accordingly.
+    /// set the internal wild card domain pointer accordingly. It also
+    /// builds the trie of the domain names used for matching.
     void setDomains(DdnsDomainMapPtr domains);
 
     /// @brief Unparse a configuration object
@@ -685,6 +799,9 @@ private:
 
     /// @brief Pointer to the wild card domain.
     DdnsDomainPtr wildcard_domain_;
+
+    /// @brief Trie of the domain names, excluding the wild card domain.
+    DdnsDomainTrie trie_;
 };
 
 /// @brief Defines a pointer for DdnsDomain instances.
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 62
-#define YY_END_OF_BUFFER 63
+#define YY_NUM_RULES 66
+#define YY_END_OF_BUFFER 67
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,48 +700,54 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[367] =
+static const flex_int16_t yy_accept[415] =
     {   0,
-       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
-       63,   61,   10,   11,   61,    1,   55,   52,   55,   55,
-       61,   54,   53,   61,   61,   61,   61,   61,   48,   49,
-       61,   61,   61,   50,   51,    5,    5,    5,   61,   61,
-       61,   10,   11,    0,    0,   44,    0,    0,    0,    0,
+       59,   59,    0,    0,    0,    0,    0,    0,    0,    0,
+       67,   65,   10,   11,   65,    1,   59,   56,   59,   59,
+       65,   58,   57,   65,   65,   65,   65,   65,   52,   53,
+       65,   65,   65,   54,   55,    5,    5,    5,   65,   65,
+       65,   10,   11,    0,    0,   48,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    1,   55,   55,
-        0,   54,   55,    3,    2,    6,    0,   55,    0,    0,
-        0,    0,    0,    0,    4,    0,    0,    9,    0,   45,
-        0,    0,    0,    0,    0,    0,    0,    0,   47,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,   59,
+       59,    0,   58,   59,    3,    2,   58,    6,    0,   59,
+        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
+        0,   49,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,   51,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    2,
-        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
-        0,    0,    0,    0,    0,    0,   46,    0,    0,    0,
+        0,    0,    0,    0,    2,   59,    0,    0,    0,    0,
+        0,    0,    0,    0,    8,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   50,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   60,
-       58,    0,   57,   56,    0,    0,    0,    0,    0,    0,
-       19,   18,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   59,   56,    0,    0,    0,    0,
+       64,   62,    0,   61,   60,    0,    0,    0,    0,    0,
+        0,    0,   21,   20,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,   20,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   38,    0,
-        0,    0,   14,    0,    0,    0,    0,    0,    0,    0,
-       41,   42,    0,    0,    0,    0,    0,    0,    0,   35,
+        0,    0,    0,    0,    0,    0,    0,   63,   60,    0,
+        0,    0,    0,    0,    0,    0,   22,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   42,    0,    0,    0,   14,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   45,   46,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   39,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    7,    0,   23,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    7,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   37,
-        0,    0,   34,    0,    0,   30,    0,    0,    0,    0,
-       31,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       32,   36,    0,    0,    0,    0,    0,    0,    0,   12,
-
-        0,    0,    0,    0,    0,    0,   26,    0,   24,    0,
-        0,    0,    0,   40,    0,    0,   28,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   27,    0,    0,
-       39,    0,    0,    0,    0,   13,   17,    0,    0,    0,
-        0,    0,   29,    0,   25,    0,    0,    0,    0,    0,
-       23,    0,   21,   16,    0,   22,   43,    0,    0,    0,
-       33,    0,    0,    0,   15,    0
+        0,    0,   41,    0,    0,   38,    0,    0,    0,   34,
+
+        0,    0,    0,    0,   35,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   36,   40,    0,    0,    0,
+        0,    0,    0,    0,    0,   12,    0,    0,    0,    0,
+        0,    0,    0,   29,    0,   27,    0,    0,    0,   30,
+        0,   44,    0,    0,   32,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   31,    0,    0,   43,
+        0,    0,    0,    0,    0,   13,   19,    0,    0,    0,
+        0,    0,   33,    0,   28,    0,    0,    0,    0,    0,
+        0,   26,    0,    0,   24,   18,    0,   25,   47,    0,
+        0,    0,    0,    0,   37,    0,    0,    0,    0,    0,
+
+        0,    0,   15,    0,    0,    0,    0,    0,    0,   17,
+        0,    0,   16,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -753,13 +759,13 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,    5,    5,   27,    5,   28,    5,   29,   30,   31,
-        5,   32,   33,   34,   35,    5,    5,    5,    5,    5,
-       36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
+        5,    5,   27,   28,    5,   29,    5,   30,   31,   32,
+        5,   33,   34,   35,   36,    5,    5,    5,   37,    5,
+       38,   39,   40,    5,   41,    5,   42,   43,   44,   45,
 
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,    5,   66,    5,    5,    5,    5,    5,
+       46,   47,   48,   49,   50,   28,   51,   52,   53,   54,
+       55,   56,    5,   57,   58,   59,   60,   61,   62,   63,
+       64,   65,   66,    5,   67,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -776,195 +782,268 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[67] =
+static const YY_CHAR yy_meta[68] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[378] =
+static const flex_int16_t yy_base[415] =
     {   0,
-        0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      684,  685,   89,  680,  137,    0,  192,  685,  197,  200,
-       86,  212,  685,  662,   97,   74,   63,   69,  685,  685,
-       83,   68,   78,  685,  685,  685,  124,  668,  627,    0,
-      660,  128,  675,  212,  234,  685,  623,  629,  172,  621,
-      196,  196,  257,  623,  187,  191,  619,  617,  627,  616,
-      629,   91,  609,  613,  622,  621,  209,    0,  281,  289,
-      239,  305,  293,  685,    0,  685,  257,  308,  182,  195,
-      208,  224,  248,  276,  685,  622,  657,  685,  228,  685,
-      321,  609,  619,  282,  614,  295,  297,  653,    0,  367,
-
-      612,  604,  615,  609,  597,  594,  596,  594,  639,  586,
-      602,  585,  594,  589,  586,  587,  582,  218,  593,    0,
-      296,  303,  307,  306,  310,  315,  589,  685,    0,  581,
-      583,  312,  591,  630,  629,  628,  685,  399,  579,  575,
-      572,  586,  618,  571,  566,  568,  585,  613,  577,  285,
-      578,  610,  565,  561,  574,  561,  572,  569,  323,  685,
-      685,  331,  685,  685,  555,    0,  557,  331,  606,  563,
-      685,  685,  431,  554,  598,  562,  550,  549,  558,  564,
-      550,  559,  548,  556,  551,  554,  591,  315,  537,  589,
-      538,  549,  536,  580,  685,  685,  547,    0,  535,  582,
-
-      581,  543,  685,  532,  463,  536,  540,  531,  523,  536,
-      573,  522,  537,  533,  535,  518,  509,  516,  685,  517,
-      514,  511,  685,  511,  509,  518,  515,  520,    0,  512,
-      685,  685,  509,  515,  502,  505,  514,  546,  500,  685,
-      512,  502,  497,  500,  494,  506,  543,  492,  493,  241,
-      502,  539,  486,  499,  685,  531,  478,  516,  473,  463,
-      442,  460,  440,  488,  454,  453,  452,  489,  488,  685,
-      441,  434,  685,  437,  479,  685,  420,  419,  441,  474,
-      685,  418,  429,  424,  419,  422,  422,  458,  406,  456,
-      685,  685,  421,  406,  404,  415,  445,  393,  403,  685,
-
-      442,  390,  386,  378,  379,  391,  685,  376,  685,  374,
-      389,  372,  386,  685,  422,  383,  685,  373,  413,  361,
-      346,  364,  410,  400,  351,  356,  349,  685,  348,  343,
-      685,  393,  340,  391,  339,  685,  685,  344,  340,  330,
-      328,  379,  685,  336,  685,  372,  370,  320,  366,  365,
-      685,  317,  685,  685,  311,  685,  685,  320,  338,  289,
-      685,  241,  206,  253,  685,  685,  508,  513,  518,  523,
-      528,  533,  536,  216,  130,  115,   87
+        0,    0,   67,    0,  129,    0,  131,    0,  142,    0,
+       70,    0,  147,  147,  196,  263,  319,    0,  142,  156,
+      152,  170,    0,  132,  178,  132,  130,  299,    0,    0,
+      119,  103,  116,    0,    0,    0,    0,  164,  124,  359,
+      161,    0,  179,  426,  472,    0,  309,  136,  217,  304,
+      282,  474,  475,  532,  287,  295,  291,  287,  291,  302,
+      295,  309,  310,  293,  300,  312,  452,  444,    0,    0,
+        0,    0,    0,    0,    0,  599,    0,    0,  494,  495,
+      638,  639,  633,  452,  454,  452,    0,  469,  693,    0,
+        0,    0,  755,  642,  462,  558,  731,  622,  731,  732,
+
+      812,    0,    0,  879,  623,  619,  631,  627,  618,  617,
+      621,  621,  669,  617,  634,  620,  631,  628,  627,  630,
+      633,  628,  721,  642,    0,    0,  732,  740,  745,  709,
+      719,  726,  721,    0,    0,    0,  933,  753,  716,  720,
+      747,  730,  773,  774,    0,    0,    0,  946,  726,  725,
+      724,  739,  778,  735,  734,  738,  757,  789,  755,  746,
+      759,  795,  752,  751,  752,  767,  893,  905,  904,  928,
+        0,    0,  917,    0,    0,  904,  980,  940,  908,  983,
+      960,  931,    0,    0,  994,  925,  972,  936,  927,  953,
+      937,  945,  946,  967,  960,  975,  978,  983, 1024,  986,
+
+      971, 1026,  979,  978,  997,  987, 1034,    0,    0, 1001,
+     1033, 1023,  995, 1045, 1046, 1008,    0, 1007, 1048, 1015,
+     1021, 1015, 1009, 1035, 1026, 1077, 1027, 1043, 1041, 1046,
+     1032, 1031, 1040,    0, 1043, 1042, 1041,    0, 1057, 1044,
+     1044, 1054, 1054, 1060, 1093, 1104, 1059,    0,    0, 1058,
+     1065,    0, 1061, 1066, 1076, 1112, 1067, 1080,    0, 1081,
+     1074, 1071, 1076, 1072, 1085, 1126, 1076, 1079, 1135, 1087,
+     1097, 1138, 1086, 1100,    0,    0,    0, 1136, 1090, 1143,
+     1101, 1098, 1091, 1110, 1093, 1113, 1145, 1111, 1112, 1113,
+     1154, 1155,    0, 1109, 1104,    0, 1109, 1113, 1155,    0,
+
+     1103, 1104, 1127, 1164,    0, 1118, 1130, 1127, 1124, 1129,
+     1118, 1133, 1173, 1122, 1175,    0,    0, 1140, 1128, 1128,
+     1179, 1141, 1181, 1130, 1141,    0, 1184, 1141, 1140, 1134,
+     1137, 1149, 1151,    0, 1139,    0, 1139, 1155, 1141,    0,
+     1156,    0, 1196, 1157,    0, 1150, 1199, 1148, 1196, 1197,
+     1155, 1204, 1205, 1157, 1163, 1160,    0, 1161, 1158,    0,
+     1211, 1159, 1213, 1177, 1163,    0,    0, 1170, 1168, 1166,
+     1166, 1220,    0, 1177,    0, 1186, 1223, 1224, 1177, 1226,
+     1227,    0, 1181, 1176,    0,    0, 1178,    0,    0, 1191,
+     1194, 1233, 1185, 1192,    0, 1182, 1232, 1185, 1187, 1240,
+
+     1197, 1198,    0, 1185, 1197, 1206, 1208, 1249, 1201,    0,
+     1195, 1252,    0, 1259
     } ;
 
-static const flex_int16_t yy_def[378] =
+static const flex_int16_t yy_def[415] =
     {   0,
-      366,    1,  367,  367,    1,    5,    5,    5,    5,    5,
-      366,  366,  366,  366,  366,  368,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  369,
-      366,  366,  366,  370,   15,  366,   45,   45,   45,   45,
-       45,   45,  371,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  368,  366,  366,
-      366,  366,  366,  366,  372,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  369,  366,  370,  366,
-      366,   45,   45,   45,   45,   45,   45,  373,   45,  371,
-
+      414,    1,    1,    3,    1,    5,    5,    7,    7,    9,
+      414,  414,  414,  414,  414,  414,  414,  414,   17,   19,
+      414,   19,  414,  414,  414,  414,  414,  414,  414,  414,
+       26,   27,   28,  414,  414,  414,   13,  414,  414,  414,
+      414,   13,  414,  414,   15,  414,   45,   45,   45,   45,
+       45,   45,   45,  414,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   52,   16,   20,
+       17,   25,   22,   20,  414,  414,   22,  414,   25,  414,
+      414,  414,  414,   81,   82,   83,  414,  414,  414,  414,
+       44,  414,  414,   45,   45,   45,   45,   45,   45,   99,
+
+      414,   45,   45,  414,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  372,
-      366,  366,  366,  366,  366,  366,  366,  366,  374,   45,
-       45,   45,   45,   45,   45,  373,  366,  371,   45,   45,
+       45,   45,   45,   45,   76,   80,  414,  414,  414,  127,
+      128,  129,  414,   89,  414,   44,  414,   45,   45,   45,
+       94,   45,   45,   45,  101,  414,  101,  104,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,  366,  366,
-      366,  366,  366,  366,  366,  375,   45,   45,   45,   45,
-      366,  366,  371,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  414,
+      414,  414,  170,  414,  414,  414,  414,   45,   45,   45,
+       45,   45,  414,  414,  148,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  366,  366,  366,  376,   45,   45,
 
-       45,   45,  366,   45,  371,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,  366,   45,
-       45,   45,  366,   45,   45,   45,   45,  366,  377,   45,
-      366,  366,   45,   45,   45,   45,   45,   45,   45,  366,
+       45,   45,   45,   45,   45,   45,   45,  414,  414,  414,
+      414,   45,   45,   45,   45,   45,  414,   45,  185,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  366,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  366,
-       45,   45,  366,   45,   45,  366,   45,   45,   45,   45,
-      366,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      366,  366,   45,   45,   45,   45,   45,   45,   45,  366,
-
-       45,   45,   45,   45,   45,   45,  366,   45,  366,   45,
-       45,   45,   45,  366,   45,   45,  366,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  366,   45,   45,
-      366,   45,   45,   45,   45,  366,  366,   45,   45,   45,
-       45,   45,  366,   45,  366,   45,   45,   45,   45,   45,
-      366,   45,  366,  366,   45,  366,  366,   45,   45,   45,
-      366,   45,   45,   45,  366,    0,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366
+       45,   45,   45,  414,   45,   45,   45,  414,   45,   45,
+       45,   45,   45,  414,  414,   45,   45,  414,  414,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  414,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,  414,   44,  414,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  414,   45,   45,  414,   45,   45,   45,  414,
+
+       45,   45,   45,   45,  414,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  414,  414,   45,   45,   45,
+       45,   45,   45,   45,   45,  414,   45,   45,   45,   45,
+       45,   45,   45,  414,   45,  414,   45,   45,   45,  414,
+       45,  414,   45,   45,  414,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  414,   45,   45,  414,
+       45,   45,   45,   45,   45,  414,  414,   45,   45,   45,
+       45,   45,  414,   45,  414,   45,   45,   45,   45,   45,
+       45,  414,   45,   45,  414,  414,   45,  414,  414,   45,
+       45,   45,   45,   45,  414,   45,   45,   45,   45,   45,
+
+       45,   45,  414,   45,   45,   45,   45,   45,   45,  414,
+       45,   45,  414,    0
     } ;
 
-static const flex_int16_t yy_nxt[752] =
+static const flex_int16_t yy_nxt[1327] =
     {   0,
        12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
        19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   12,   12,   34,   35,   37,   14,   37,   37,
-       14,   37,   38,   41,   40,   38,   12,   12,   40,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   41,
-       42,   89,   42,   74,   79,   12,   12,   80,   75,   12,
-
-       81,   12,   80,   79,   12,   77,   12,   77,   12,   81,
-       78,   78,   78,   79,   12,   12,   12,   12,   39,  229,
-       12,   80,   82,   12,   81,   42,   83,   42,   12,   42,
-      113,   42,  114,   84,  198,   12,   12,   44,   44,   44,
-       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
-       48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
-       51,   52,   45,   53,   45,   45,   54,   45,   45,   55,
-       45,   56,   45,   57,   58,   49,   59,   60,   61,   62,
-       63,   64,   65,   66,   67,   52,   45,   45,   45,   45,
-
-       45,   45,   45,   69,   94,   70,   70,   70,   69,  121,
-       72,   72,   72,   73,   73,   73,   71,   90,   96,   97,
-      166,   71,  122,   69,   71,   72,   72,   72,   94,  102,
-      103,   96,  121,   90,  104,   71,   71,   96,   97,  105,
-       71,  106,  123,   71,  107,  122,  273,   77,   91,   77,
-       96,  121,   78,   78,   78,   71,   45,   45,  365,  156,
-       45,   45,   99,  364,   91,  119,  123,   45,   45,   45,
-       78,   78,   78,   45,  124,  122,   45,  157,   45,  274,
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   27,
+       12,   12,   12,   12,   28,   12,   12,   29,   12,   30,
+       12,   12,   12,   12,   12,   25,   31,   12,   12,   12,
+       12,   12,   12,   32,   12,   12,   12,   12,   33,   12,
+       12,   12,   12,   12,   12,   34,   35,   36,   37,  414,
+       37,   36,   36,   36,   38,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   12,   12,   40,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   42,   43,
+       42,   78,   81,   12,   12,   73,   73,   73,   12,   75,
+       84,   41,   85,   12,   76,   82,   12,  414,   12,   74,
+       74,   74,   86,   81,   12,   12,   87,   88,   39,   90,
+       12,   43,   12,   77,   77,   77,   79,   12,   79,   82,
+       95,   80,   80,   80,   12,   12,   44,   44,   44,   45,
+
+       45,   46,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   47,   48,   49,
+       45,   45,   45,   50,   51,   45,   45,   45,   45,   45,
+       52,   53,   45,   45,   54,   45,   45,   55,   47,   45,
+       56,   45,   57,   45,   58,   59,   60,   61,   62,   63,
+       64,   65,   66,   67,   68,   53,   45,   45,   45,   45,
+       45,   45,   45,   69,   69,   96,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       70,   83,   71,   71,   71,   94,   98,   97,  105,  106,
+      107,  112,  110,   72,  108,  111,  113,  114,  109,  115,
+      116,  117,  119,  118,  120,   83,  121,  122,   94,   89,
+       89,   97,   89,   89,   72,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   91,   91,   91,   91,
+       91,   92,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   93,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   45,   45,   45,   99,  123,  100,   45,
+
+       45,  124,  414,  130,  414,  131,   45,   45,  126,  126,
+      126,  132,  133,   45,   45,  139,   45,   99,   45,  100,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   73,   73,   73,   45,  125,  363,
-
-       69,   45,   70,   70,   70,   71,   73,   73,   73,   45,
-      123,  132,   45,   71,   45,  100,   69,   71,   72,   72,
-       72,   78,   78,   78,   71,  134,   89,  135,  159,   71,
-      160,  161,   71,   89,  126,  132,   71,  160,  159,  161,
-      169,  185,  362,  361,  186,  200,  201,  195,   71,  134,
-      161,  135,  159,  160,  202,  195,  333,   89,  164,  220,
-      163,   89,  162,  360,  169,   89,  195,  359,  358,  221,
-      357,  356,  355,   89,  196,  354,   89,  353,   89,  129,
-      138,  138,  138,  352,  351,  350,  349,  138,  138,  138,
-      138,  138,  138,  348,  347,  346,  345,  344,  343,  342,
-
-      341,  340,  334,  339,  338,  337,  138,  138,  138,  138,
-      138,  138,  173,  173,  173,  336,  335,  332,  331,  173,
-      173,  173,  173,  173,  173,  330,  329,  328,  327,  326,
-      325,  324,  323,  322,  321,  320,  319,  318,  173,  173,
-      173,  173,  173,  173,  205,  205,  205,  317,  316,  315,
-      314,  205,  205,  205,  205,  205,  205,  313,  312,  311,
-      310,  309,  308,  307,  306,  305,  304,  303,  302,  301,
-      205,  205,  205,  205,  205,  205,   45,   45,   45,  300,
-      299,  298,  297,   45,   45,   45,   45,   45,   45,  296,
-      295,  294,  293,  292,  291,  290,  289,  288,  287,  286,
-
-      285,  284,   45,   45,   45,   45,   45,   45,   36,   36,
-       36,   36,   36,   68,  283,   68,   68,   68,   87,  282,
-       87,  281,   87,   89,   89,   89,   89,   89,   98,   98,
-       98,   98,   98,  120,  280,  120,  120,  120,  136,  136,
-      136,  279,  278,  277,  276,  275,  272,  271,  270,  269,
-      268,  267,  266,  265,  264,  263,  262,  261,  260,  259,
-      258,  257,  256,  255,  254,  253,  252,  251,  250,  249,
-      248,  247,  246,  245,  244,  243,  242,  241,  240,  239,
-      238,  237,  236,  235,  234,  233,  232,  231,  230,  228,
-      227,  226,  225,  224,  223,  222,  219,  218,  217,  216,
-
-      215,  214,  213,  212,  211,  210,  209,  208,  207,  206,
-      204,  203,  199,  197,  194,  193,  192,  191,  190,  189,
-      188,  187,  184,  183,  182,  181,  180,  179,  178,  177,
-      176,  175,  174,  137,  172,  171,  170,  168,  167,  165,
-      158,  155,  154,  153,  152,  151,  150,  149,  148,  147,
-      146,  145,  144,  143,  142,  141,  140,  139,  137,  133,
-      131,  130,  128,  127,  118,  117,  116,  115,  112,  111,
-      110,  109,  108,  101,   95,   93,   92,   43,   88,   86,
-       85,   76,   43,  366,   11,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+       45,   45,  101,  101,  101,  101,  101,  102,  101,  101,
+      101,  101,  101,  101,  103,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      103,  101,  101,  101,  103,  101,  101,  101,  103,  101,
+      101,  101,  101,  101,  101,  103,  101,  101,  103,  101,
+      103,  104,  101,  101,  101,  101,  101,  101,  101,  125,
+
+      125,  140,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  125,  125,  127,  128,  129,  142,
+      149,  138,  150,  151,  152,  153,  154,  155,  156,  157,
+      158,  159,  160,  161,  162,  163,  164,  165,  166,  127,
+      128,  169,  129,  134,  134,  138,  134,  134,  135,  134,
+
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      136,  141,  143,  144,  167,  170,  173,  136,  171,  172,
+      174,  175,  176,  178,  179,  180,  181,  182,  183,  184,
+      186,  168,  187,  188,  189,  141,  143,  144,  190,  170,
+      172,  171,  191,  136,  178,  192,  193,  136,  194,  195,
+
+      181,  136,  196,  197,  199,  200,  198,  201,  136,  202,
+      203,  136,  204,  136,  137,  145,  145,  146,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  148,  148,  148,  147,  147,  147,  147,  148,
+
+      148,  148,  148,  148,  148,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      148,  148,  148,  148,  148,  148,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  177,  177,  177,  205,
+      206,  207,  208,  177,  177,  177,  177,  177,  177,  185,
+      185,  185,  209,  210,  213,  217,  185,  185,  185,  185,
+      185,  185,  212,  208,  177,  177,  177,  177,  177,  177,
+      218,  220,  221,  222,  223,  226,  227,  185,  185,  185,
+      185,  185,  185,  211,  211,  211,  212,  214,  215,  228,
+
+      211,  211,  211,  211,  211,  211,  216,  219,  219,  219,
+      224,  229,  225,  230,  219,  219,  219,  219,  219,  219,
+      231,  211,  211,  211,  211,  211,  211,  232,  233,  234,
+      237,  238,  235,  239,  240,  219,  219,  219,  219,  219,
+      219,  236,  241,  242,  243,  244,  245,  245,  245,  247,
+      248,  249,  250,  245,  245,  245,  245,  245,  245,  246,
+      251,  252,  252,  252,  253,  254,  255,  256,  252,  252,
+      252,  252,  252,  252,  245,  245,  245,  245,  245,  245,
+      257,  258,  259,  260,  261,  262,  246,  263,  264,  252,
+      252,  252,  252,  252,  252,  265,  266,  267,  268,  269,
+
+      270,  271,  272,  273,  274,  275,  276,  276,  276,  277,
+      278,  279,  280,  276,  276,  276,  276,  276,  276,  281,
+      282,  283,  284,  285,  286,  287,  288,  289,  290,  291,
+      292,  293,  294,  295,  276,  276,  276,  276,  276,  276,
+      296,  298,  299,  300,  301,  302,  303,  304,  305,  306,
+      307,  308,  309,  310,  311,  312,  313,  314,  315,  316,
+      317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+      327,  328,  329,  330,  331,  297,  332,  333,  334,  335,
+      336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+      346,  347,  348,  349,  350,  351,  352,  353,  354,  355,
+
+      356,  357,  358,  359,  360,  361,  362,  364,  365,  366,
+      367,  368,  369,  370,  371,  372,  373,  374,  375,  376,
+      377,  378,  379,  380,  381,  382,  383,  384,  385,  386,
+      387,  388,  389,  390,  391,  392,  393,  394,  395,  396,
+      397,  398,  399,  400,  401,  403,  404,  405,  402,  406,
+      407,  408,  409,  363,  410,  411,  412,  413,   11,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414
     } ;
 
-static const flex_int16_t yy_chk[752] =
+static const flex_int16_t yy_chk[1327] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -972,100 +1051,164 @@ static const flex_int16_t yy_chk[752] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
-        4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  377,   13,   21,   26,    5,    5,   27,   21,    5,
-
-       28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  376,
-        8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       62,   42,   62,   33,  375,    5,    5,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    3,    3,   11,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    5,    5,    7,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    9,   13,   14,
+       13,   24,   26,    5,    5,   19,   19,   19,    5,   21,
+       31,    9,   32,    5,   21,   27,    5,   20,    5,   20,
+       20,   20,   33,   26,    5,    5,   38,   39,    5,   41,
+        7,   43,    5,   22,   22,   22,   25,    5,   25,   27,
+       48,   25,   25,   25,    5,    5,   15,   15,   15,   15,
+
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   17,   49,   17,   17,   17,   19,   79,
-       19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      374,   19,   80,   22,   20,   22,   22,   22,   49,   55,
-       55,   67,   79,   89,   55,   17,   22,   51,   52,   55,
-       19,   56,   81,   20,   56,   80,  250,   71,   44,   71,
-       67,   82,   71,   71,   71,   22,   45,   45,  364,  118,
-       45,   45,   53,  363,   89,   67,   81,   45,   45,   53,
-       77,   77,   77,   45,   82,   83,   45,  118,   45,  250,
+       15,   15,   15,   16,   16,   49,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       17,   28,   17,   17,   17,   47,   51,   50,   55,   56,
+       56,   58,   57,   17,   56,   57,   59,   60,   56,   61,
+       62,   63,   64,   63,   65,   28,   65,   66,   47,   40,
+       40,   50,   40,   40,   17,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   45,   45,   45,   52,   67,   53,   45,
+
+       45,   68,   79,   84,   79,   85,   45,   45,   80,   80,
+       80,   86,   88,   45,   45,   95,   45,   52,   45,   53,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   69,   69,   69,   53,   83,  362,
-
-       70,   53,   70,   70,   70,   69,   73,   73,   73,   53,
-       84,   94,   53,   70,   53,   53,   72,   73,   72,   72,
-       72,   78,   78,   78,   69,   96,   91,   97,  121,   72,
-      122,  123,   70,   91,   84,   94,   73,  125,  124,  126,
-      132,  150,  360,  359,  150,  168,  168,  159,   72,   96,
-      123,   97,  121,  122,  168,  162,  321,   91,  126,  188,
-      125,   91,  124,  358,  132,   91,  159,  355,  352,  188,
-      350,  349,  348,   91,  162,  347,   91,  346,   91,   91,
-      100,  100,  100,  344,  342,  341,  340,  100,  100,  100,
-      100,  100,  100,  339,  338,  335,  334,  333,  332,  330,
-
-      329,  327,  321,  326,  325,  324,  100,  100,  100,  100,
-      100,  100,  138,  138,  138,  323,  322,  320,  319,  138,
-      138,  138,  138,  138,  138,  318,  316,  315,  313,  312,
-      311,  310,  308,  306,  305,  304,  303,  302,  138,  138,
-      138,  138,  138,  138,  173,  173,  173,  301,  299,  298,
-      297,  173,  173,  173,  173,  173,  173,  296,  295,  294,
-      293,  290,  289,  288,  287,  286,  285,  284,  283,  282,
-      173,  173,  173,  173,  173,  173,  205,  205,  205,  280,
-      279,  278,  277,  205,  205,  205,  205,  205,  205,  275,
-      274,  272,  271,  269,  268,  267,  266,  265,  264,  263,
-
-      262,  261,  205,  205,  205,  205,  205,  205,  367,  367,
-      367,  367,  367,  368,  260,  368,  368,  368,  369,  259,
-      369,  258,  369,  370,  370,  370,  370,  370,  371,  371,
-      371,  371,  371,  372,  257,  372,  372,  372,  373,  373,
-      373,  256,  254,  253,  252,  251,  249,  248,  247,  246,
-      245,  244,  243,  242,  241,  239,  238,  237,  236,  235,
-      234,  233,  230,  228,  227,  226,  225,  224,  222,  221,
-      220,  218,  217,  216,  215,  214,  213,  212,  211,  210,
-      209,  208,  207,  206,  204,  202,  201,  200,  199,  197,
-      194,  193,  192,  191,  190,  189,  187,  186,  185,  184,
-
-      183,  182,  181,  180,  179,  178,  177,  176,  175,  174,
-      170,  169,  167,  165,  158,  157,  156,  155,  154,  153,
-      152,  151,  149,  148,  147,  146,  145,  144,  143,  142,
-      141,  140,  139,  136,  135,  134,  133,  131,  130,  127,
-      119,  117,  116,  115,  114,  113,  112,  111,  110,  109,
-      108,  107,  106,  105,  104,  103,  102,  101,   98,   95,
-       93,   92,   87,   86,   66,   65,   64,   63,   61,   60,
-       59,   58,   57,   54,   50,   48,   47,   43,   41,   39,
-       38,   24,   14,   11,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+       45,   45,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   76,
+
+       76,   96,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   81,   82,   83,   98,
+      105,   94,  106,  107,  108,  109,  110,  111,  112,  113,
+      114,  115,  116,  117,  118,  119,  120,  121,  122,   81,
+       82,  124,   83,   89,   89,   94,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       93,   97,   99,  100,  123,  127,  130,   93,  128,  129,
+      131,  132,  133,  138,  139,  140,  141,  142,  143,  144,
+      149,  123,  150,  151,  152,   97,   99,  100,  153,  127,
+      129,  128,  154,   93,  138,  155,  156,   93,  157,  158,
+
+      141,   93,  159,  160,  161,  162,  160,  163,   93,  164,
+      165,   93,  166,   93,   93,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  137,  137,  137,  167,
+      168,  169,  170,  137,  137,  137,  137,  137,  137,  148,
+      148,  148,  173,  176,  179,  181,  148,  148,  148,  148,
+      148,  148,  178,  170,  137,  137,  137,  137,  137,  137,
+      182,  186,  187,  188,  189,  191,  192,  148,  148,  148,
+      148,  148,  148,  177,  177,  177,  178,  180,  180,  193,
+
+      177,  177,  177,  177,  177,  177,  180,  185,  185,  185,
+      190,  194,  190,  195,  185,  185,  185,  185,  185,  185,
+      196,  177,  177,  177,  177,  177,  177,  197,  198,  199,
+      201,  202,  200,  203,  204,  185,  185,  185,  185,  185,
+      185,  200,  205,  206,  207,  210,  211,  211,  211,  213,
+      214,  215,  216,  211,  211,  211,  211,  211,  211,  212,
+      218,  219,  219,  219,  220,  221,  222,  223,  219,  219,
+      219,  219,  219,  219,  211,  211,  211,  211,  211,  211,
+      224,  225,  226,  227,  228,  229,  212,  230,  231,  219,
+      219,  219,  219,  219,  219,  232,  233,  235,  236,  237,
+
+      239,  240,  241,  242,  243,  244,  245,  245,  245,  246,
+      247,  250,  251,  245,  245,  245,  245,  245,  245,  253,
+      254,  255,  256,  257,  258,  260,  261,  262,  263,  264,
+      265,  266,  267,  268,  245,  245,  245,  245,  245,  245,
+      269,  270,  271,  272,  273,  274,  278,  279,  280,  281,
+      282,  283,  284,  285,  286,  287,  288,  289,  290,  291,
+      292,  294,  295,  297,  298,  299,  301,  302,  303,  304,
+      306,  307,  308,  309,  310,  269,  311,  312,  313,  314,
+      315,  318,  319,  320,  321,  322,  323,  324,  325,  327,
+      328,  329,  330,  331,  332,  333,  335,  337,  338,  339,
+
+      341,  343,  344,  346,  347,  348,  349,  350,  351,  352,
+      353,  354,  355,  356,  358,  359,  361,  362,  363,  364,
+      365,  368,  369,  370,  371,  372,  374,  376,  377,  378,
+      379,  380,  381,  383,  384,  387,  390,  391,  392,  393,
+      394,  396,  397,  398,  399,  400,  401,  402,  399,  404,
+      405,  406,  407,  349,  408,  409,  411,  412,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414
     } ;
 
+
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
 
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[62] =
+static const flex_int16_t yy_rule_linenum[66] =
     {   0,
       129,  131,  133,  138,  139,  144,  145,  146,  158,  161,
-      166,  172,  181,  192,  203,  212,  221,  230,  240,  250,
-      260,  269,  278,  288,  298,  308,  319,  328,  338,  348,
-      359,  368,  377,  386,  395,  404,  413,  422,  435,  444,
-      453,  462,  471,  481,  579,  584,  589,  594,  595,  596,
-      597,  598,  599,  601,  619,  632,  637,  641,  643,  645,
-      647
+      166,  172,  181,  192,  203,  212,  221,  230,  239,  248,
+      258,  268,  278,  288,  297,  306,  316,  326,  336,  346,
+      357,  366,  376,  386,  397,  406,  415,  424,  433,  442,
+      451,  460,  473,  482,  491,  500,  509,  519,  617,  622,
+      627,  632,  633,  634,  635,  636,  637,  639,  657,  670,
+      675,  679,  681,  683,  685
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1112,7 +1255,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1115 "d2_lexer.cc"
+#line 1258 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1138,8 +1281,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1141 "d2_lexer.cc"
-#line 1142 "d2_lexer.cc"
+#line 1284 "d2_lexer.cc"
+#line 1285 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1457,7 +1600,7 @@ YY_DECL
     }
 
 
-#line 1460 "d2_lexer.cc"
+#line 1603 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1486,13 +1629,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 367 )
+				if ( yy_current_state >= 415 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 366 );
+		while ( yy_current_state != 414 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1511,13 +1654,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 62 )
+			else if ( yy_act < 66 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 62 )
+			else if ( yy_act == 66 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 63 )
+			else if ( yy_act == 67 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1679,9 +1822,9 @@ YY_RULE_SETUP
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
-        return isc::d2::D2Parser::make_NCR_PROTOCOL(driver.loc_);
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_WINDOW(driver.loc_);
     default:
-        return isc::d2::D2Parser::make_STRING("ncr-protocol", driver.loc_);
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-window", driver.loc_);
     }
 }
 	YY_BREAK
@@ -1691,15 +1834,39 @@ YY_RULE_SETUP
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
-        return isc::d2::D2Parser::make_NCR_FORMAT(driver.loc_);
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_SIZE(driver.loc_);
     default:
-        return isc::d2::D2Parser::make_STRING("ncr-format", driver.loc_);
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-size", driver.loc_);
     }
 }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 230 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_NCR_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("ncr-protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 239 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_NCR_FORMAT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("ncr-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+#line 248 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1710,9 +1877,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 19:
+case 21:
 YY_RULE_SETUP
-#line 240 "d2_lexer.ll"
+#line 258 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1723,9 +1890,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 20:
+case 22:
 YY_RULE_SETUP
-#line 250 "d2_lexer.ll"
+#line 268 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
@@ -1736,9 +1903,22 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 21:
+case 23:
 YY_RULE_SETUP
-#line 260 "d2_lexer.ll"
+#line 278 "d2_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+#line 288 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1748,9 +1928,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 25:
 YY_RULE_SETUP
-#line 269 "d2_lexer.ll"
+#line 297 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1760,9 +1940,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 26:
 YY_RULE_SETUP
-#line 278 "d2_lexer.ll"
+#line 306 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::FORWARD_DDNS:
@@ -1773,9 +1953,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 27:
 YY_RULE_SETUP
-#line 288 "d2_lexer.ll"
+#line 316 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1786,9 +1966,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 28:
 YY_RULE_SETUP
-#line 298 "d2_lexer.ll"
+#line 326 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1799,9 +1979,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 29:
 YY_RULE_SETUP
-#line 308 "d2_lexer.ll"
+#line 336 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DNS_SERVER:
@@ -1812,9 +1992,22 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 30:
 YY_RULE_SETUP
-#line 319 "d2_lexer.ll"
+#line 346 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 31:
+YY_RULE_SETUP
+#line 357 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1824,9 +2017,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 32:
 YY_RULE_SETUP
-#line 328 "d2_lexer.ll"
+#line 366 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1837,9 +2030,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 33:
 YY_RULE_SETUP
-#line 338 "d2_lexer.ll"
+#line 376 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1850,9 +2043,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 34:
 YY_RULE_SETUP
-#line 348 "d2_lexer.ll"
+#line 386 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1863,9 +2056,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 35:
 YY_RULE_SETUP
-#line 359 "d2_lexer.ll"
+#line 397 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1875,9 +2068,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 36:
 YY_RULE_SETUP
-#line 368 "d2_lexer.ll"
+#line 406 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGING:
@@ -1887,9 +2080,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 37:
 YY_RULE_SETUP
-#line 377 "d2_lexer.ll"
+#line 415 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1899,9 +2092,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 38:
 YY_RULE_SETUP
-#line 386 "d2_lexer.ll"
+#line 424 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1911,9 +2104,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 39:
 YY_RULE_SETUP
-#line 395 "d2_lexer.ll"
+#line 433 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1923,9 +2116,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 40:
 YY_RULE_SETUP
-#line 404 "d2_lexer.ll"
+#line 442 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1935,9 +2128,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 41:
 YY_RULE_SETUP
-#line 413 "d2_lexer.ll"
+#line 451 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1947,9 +2140,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 42:
 YY_RULE_SETUP
-#line 422 "d2_lexer.ll"
+#line 460 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1963,9 +2156,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 43:
 YY_RULE_SETUP
-#line 435 "d2_lexer.ll"
+#line 473 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1975,9 +2168,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 44:
 YY_RULE_SETUP
-#line 444 "d2_lexer.ll"
+#line 482 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1987,9 +2180,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 45:
 YY_RULE_SETUP
-#line 453 "d2_lexer.ll"
+#line 491 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1999,9 +2192,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 46:
 YY_RULE_SETUP
-#line 462 "d2_lexer.ll"
+#line 500 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2011,9 +2204,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 47:
 YY_RULE_SETUP
-#line 471 "d2_lexer.ll"
+#line 509 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2023,9 +2216,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 48:
 YY_RULE_SETUP
-#line 481 "d2_lexer.ll"
+#line 519 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2124,65 +2317,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 45:
-/* rule 45 can match eol */
+case 49:
+/* rule 49 can match eol */
 YY_RULE_SETUP
-#line 579 "d2_lexer.ll"
+#line 617 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 46:
-/* rule 46 can match eol */
+case 50:
+/* rule 50 can match eol */
 YY_RULE_SETUP
-#line 584 "d2_lexer.ll"
+#line 622 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 47:
+case 51:
 YY_RULE_SETUP
-#line 589 "d2_lexer.ll"
+#line 627 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 48:
+case 52:
 YY_RULE_SETUP
-#line 594 "d2_lexer.ll"
+#line 632 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 49:
+case 53:
 YY_RULE_SETUP
-#line 595 "d2_lexer.ll"
+#line 633 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 50:
+case 54:
 YY_RULE_SETUP
-#line 596 "d2_lexer.ll"
+#line 634 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 55:
 YY_RULE_SETUP
-#line 597 "d2_lexer.ll"
+#line 635 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 598 "d2_lexer.ll"
+#line 636 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 599 "d2_lexer.ll"
+#line 637 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 601 "d2_lexer.ll"
+#line 639 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2201,9 +2394,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 619 "d2_lexer.ll"
+#line 657 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2217,43 +2410,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 632 "d2_lexer.ll"
+#line 670 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 637 "d2_lexer.ll"
+#line 675 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 641 "d2_lexer.ll"
+#line 679 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 643 "d2_lexer.ll"
+#line 681 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 645 "d2_lexer.ll"
+#line 683 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 647 "d2_lexer.ll"
+#line 685 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 649 "d2_lexer.ll"
+#line 687 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2277,12 +2470,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 672 "d2_lexer.ll"
+#line 710 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2285 "d2_lexer.cc"
+#line 2478 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2601,7 +2794,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 367 )
+			if ( yy_current_state >= 415 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2634,11 +2827,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 367 )
+		if ( yy_current_state >= 415 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 366);
+	yy_is_jam = (yy_current_state == 414);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3387,7 +3580,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 672 "d2_lexer.ll"
+#line 710 "d2_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -208,6 +208,24 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"dns-update-batch-window\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_WINDOW(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-window", driver.loc_);
+    }
+}
+
+\"dns-update-batch-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        return isc::d2::D2Parser::make_DNS_UPDATE_BATCH_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("dns-update-batch-size", driver.loc_);
+    }
+}
+
 \"ncr-protocol\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -256,6 +274,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 
+(?i:\"BINARY\") {
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
+        return isc::d2::D2Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
+}
+
 \"forward-ddns\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -314,6 +342,16 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"protocol\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+
 
 \"tsig-keys\" {
     switch(driver.ctx_) {
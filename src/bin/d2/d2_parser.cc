@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   d2_parser_lex
 
-// First part of user declarations.
-
-#line 39 "d2_parser.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "d2_parser.h"
 
-// User implementation prologue.
 
-#line 53 "d2_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "d2_parser.yy" // lalr1.cc:413
+#line 34 "d2_parser.yy"
 
 #include <d2/parser_context.h>
 
-#line 59 "d2_parser.cc" // lalr1.cc:413
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !D2_PARSER_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "d2_parser.yy" // lalr1.cc:479
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 145 "d2_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace d2 {
   D2Parser::~D2Parser ()
   {}
 
+  D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  D2Parser::by_state::by_state ()
+  D2Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  D2Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  D2Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  D2Parser::by_state::clear ()
+  D2Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   D2Parser::by_state::move (by_state& that)
   {
@@ -227,51 +188,84 @@ namespace isc { namespace d2 {
     that.clear ();
   }
 
-  inline
-  D2Parser::by_state::by_state (state_type s)
+  D2Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   D2Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 66: // value
-      case 93: // ncr_protocol_value
-        value.move< ElementPtr > (that.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 54: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 53: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 52: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 51: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -279,34 +273,35 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 66: // value
-      case 93: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 54: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 53: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 52: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 51: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -318,9 +313,46 @@ namespace isc { namespace d2 {
     return *this;
   }
 
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   D2Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -331,91 +363,91 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 51: // "constant string"
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 354 "d2_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "d2_parser.cc"
         break;
 
-      case 52: // "integer"
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 361 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "d2_parser.cc"
         break;
 
-      case 53: // "floating point"
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 368 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "d2_parser.cc"
         break;
 
-      case 54: // "boolean"
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 375 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "d2_parser.cc"
         break;
 
-      case 66: // value
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 382 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "d2_parser.cc"
         break;
 
-      case 93: // ncr_protocol_value
-
-#line 108 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 389 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "d2_parser.cc"
         break;
 
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 113 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "d2_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  D2Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, stack_symbol_type& s)
+  D2Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  D2Parser::yypop_ (unsigned int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -447,32 +479,37 @@ namespace isc { namespace d2 {
   }
 #endif // D2_PARSER_DEBUG
 
-  inline D2Parser::state_type
+  D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  D2Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -490,11 +527,11 @@ namespace isc { namespace d2 {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This should be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -502,48 +539,70 @@ namespace isc { namespace d2 {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -560,50 +619,53 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
+      switch (yyr1_[yyn])
     {
-      case 66: // value
-      case 93: // ncr_protocol_value
-        yylhs.value.build< ElementPtr > ();
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 54: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 53: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 52: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 51: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -611,1042 +673,1103 @@ namespace isc { namespace d2 {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 117 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 630 "d2_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 122 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 695 "d2_parser.cc"
     break;
 
-  case 4:
-#line 118 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 636 "d2_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 123 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "d2_parser.cc"
     break;
 
-  case 6:
-#line 119 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 642 "d2_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 124 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 707 "d2_parser.cc"
     break;
 
-  case 8:
-#line 120 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 648 "d2_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 125 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 713 "d2_parser.cc"
     break;
 
-  case 10:
-#line 121 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 654 "d2_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 126 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 719 "d2_parser.cc"
     break;
 
-  case 12:
-#line 122 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 660 "d2_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 127 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 725 "d2_parser.cc"
     break;
 
-  case 14:
-#line 123 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 666 "d2_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 128 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 731 "d2_parser.cc"
     break;
 
-  case 16:
-#line 124 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 672 "d2_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 129 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 737 "d2_parser.cc"
     break;
 
-  case 18:
-#line 125 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 678 "d2_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 130 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 743 "d2_parser.cc"
     break;
 
-  case 20:
-#line 133 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 684 "d2_parser.cc" // lalr1.cc:859
+  case 20: // value: "integer"
+#line 138 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 749 "d2_parser.cc"
     break;
 
-  case 21:
-#line 134 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 690 "d2_parser.cc" // lalr1.cc:859
+  case 21: // value: "floating point"
+#line 139 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 755 "d2_parser.cc"
     break;
 
-  case 22:
-#line 135 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 696 "d2_parser.cc" // lalr1.cc:859
+  case 22: // value: "boolean"
+#line 140 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 761 "d2_parser.cc"
     break;
 
-  case 23:
-#line 136 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 702 "d2_parser.cc" // lalr1.cc:859
+  case 23: // value: "constant string"
+#line 141 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 767 "d2_parser.cc"
     break;
 
-  case 24:
-#line 137 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 708 "d2_parser.cc" // lalr1.cc:859
+  case 24: // value: "null"
+#line 142 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 773 "d2_parser.cc"
     break;
 
-  case 25:
-#line 138 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 714 "d2_parser.cc" // lalr1.cc:859
+  case 25: // value: map2
+#line 143 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 779 "d2_parser.cc"
     break;
 
-  case 26:
-#line 139 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 720 "d2_parser.cc" // lalr1.cc:859
+  case 26: // value: list_generic
+#line 144 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 785 "d2_parser.cc"
     break;
 
-  case 27:
-#line 142 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 27: // sub_json: value
+#line 147 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 729 "d2_parser.cc" // lalr1.cc:859
+#line 794 "d2_parser.cc"
     break;
 
-  case 28:
-#line 147 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 28: // $@10: %empty
+#line 152 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 740 "d2_parser.cc" // lalr1.cc:859
+#line 805 "d2_parser.cc"
     break;
 
-  case 29:
-#line 152 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 157 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 750 "d2_parser.cc" // lalr1.cc:859
+#line 815 "d2_parser.cc"
     break;
 
-  case 32:
-#line 163 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 32: // not_empty_map: "constant string" ":" value
+#line 168 "d2_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 759 "d2_parser.cc" // lalr1.cc:859
+#line 824 "d2_parser.cc"
     break;
 
-  case 33:
-#line 167 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 33: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 172 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 769 "d2_parser.cc" // lalr1.cc:859
+#line 834 "d2_parser.cc"
     break;
 
-  case 34:
-#line 174 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 34: // $@11: %empty
+#line 179 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 778 "d2_parser.cc" // lalr1.cc:859
+#line 843 "d2_parser.cc"
     break;
 
-  case 35:
-#line 177 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 35: // list_generic: "[" $@11 list_content "]"
+#line 182 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 786 "d2_parser.cc" // lalr1.cc:859
+#line 851 "d2_parser.cc"
     break;
 
-  case 38:
-#line 185 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_list: value
+#line 190 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 795 "d2_parser.cc" // lalr1.cc:859
+#line 860 "d2_parser.cc"
     break;
 
-  case 39:
-#line 189 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 39: // not_empty_list: not_empty_list "," value
+#line 194 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 804 "d2_parser.cc" // lalr1.cc:859
+#line 869 "d2_parser.cc"
     break;
 
-  case 40:
-#line 200 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 40: // unknown_map_entry: "constant string" ":"
+#line 205 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 815 "d2_parser.cc" // lalr1.cc:859
+#line 880 "d2_parser.cc"
     break;
 
-  case 41:
-#line 210 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 41: // $@12: %empty
+#line 215 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 826 "d2_parser.cc" // lalr1.cc:859
+#line 891 "d2_parser.cc"
     break;
 
-  case 42:
-#line 215 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 42: // syntax_map: "{" $@12 global_objects "}"
+#line 220 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 836 "d2_parser.cc" // lalr1.cc:859
+#line 901 "d2_parser.cc"
     break;
 
-  case 51:
-#line 237 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 51: // $@13: %empty
+#line 242 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 847 "d2_parser.cc" // lalr1.cc:859
+#line 912 "d2_parser.cc"
     break;
 
-  case 52:
-#line 242 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 52: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 247 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 856 "d2_parser.cc" // lalr1.cc:859
+#line 921 "d2_parser.cc"
     break;
 
-  case 53:
-#line 247 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 53: // $@14: %empty
+#line 252 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 866 "d2_parser.cc" // lalr1.cc:859
+#line 931 "d2_parser.cc"
     break;
 
-  case 54:
-#line 251 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 54: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 256 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 874 "d2_parser.cc" // lalr1.cc:859
+#line 939 "d2_parser.cc"
     break;
 
-  case 66:
-#line 271 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 68: // $@15: %empty
+#line 278 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 882 "d2_parser.cc" // lalr1.cc:859
+#line 947 "d2_parser.cc"
     break;
 
-  case 67:
-#line 273 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 69: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 280 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 892 "d2_parser.cc" // lalr1.cc:859
+#line 957 "d2_parser.cc"
     break;
 
-  case 68:
-#line 279 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 70: // port: "port" ":" "integer"
+#line 286 "d2_parser.yy"
+                         {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 904 "d2_parser.cc" // lalr1.cc:859
+#line 969 "d2_parser.cc"
     break;
 
-  case 69:
-#line 287 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0) {
+  case 71: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 294 "d2_parser.yy"
+                                                     {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
-        ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 917 "d2_parser.cc" // lalr1.cc:859
+#line 982 "d2_parser.cc"
     break;
 
-  case 70:
-#line 296 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 72: // dns_update_batch_window: "dns-update-batch-window" ":" "integer"
+#line 303 "d2_parser.yy"
+                                                               {
+    if (yystack_[0].value.as < int64_t > () < 0) {
+        error(yystack_[0].location, "dns-update-batch-window must not be negative");
+    } else {
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ctx.stack_.back()->set("dns-update-batch-window", i);
+    }
+}
+#line 995 "d2_parser.cc"
+    break;
+
+  case 73: // dns_update_batch_size: "dns-update-batch-size" ":" "integer"
+#line 312 "d2_parser.yy"
+                                                           {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
+        error(yystack_[0].location, "dns-update-batch-size must be greater than zero");
+    } else {
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ctx.stack_.back()->set("dns-update-batch-size", i);
+    }
+}
+#line 1008 "d2_parser.cc"
+    break;
+
+  case 74: // $@16: %empty
+#line 321 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 925 "d2_parser.cc" // lalr1.cc:859
+#line 1016 "d2_parser.cc"
     break;
 
-  case 71:
-#line 298 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 75: // ncr_protocol: "ncr-protocol" $@16 ":" ncr_protocol_value
+#line 323 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 934 "d2_parser.cc" // lalr1.cc:859
+#line 1025 "d2_parser.cc"
     break;
 
-  case 72:
-#line 304 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 940 "d2_parser.cc" // lalr1.cc:859
+  case 76: // ncr_protocol_value: "UDP"
+#line 329 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1031 "d2_parser.cc"
     break;
 
-  case 73:
-#line 305 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 946 "d2_parser.cc" // lalr1.cc:859
+  case 77: // ncr_protocol_value: "TCP"
+#line 330 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1037 "d2_parser.cc"
     break;
 
-  case 74:
-#line 308 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 78: // $@17: %empty
+#line 333 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 954 "d2_parser.cc" // lalr1.cc:859
+#line 1045 "d2_parser.cc"
     break;
 
-  case 75:
-#line 310 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 79: // ncr_format: "ncr-format" $@17 ":" ncr_format_value
+#line 335 "d2_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 964 "d2_parser.cc" // lalr1.cc:859
+#line 1054 "d2_parser.cc"
     break;
 
-  case 76:
-#line 316 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 80: // ncr_format_value: "JSON"
+#line 341 "d2_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 1060 "d2_parser.cc"
+    break;
+
+  case 81: // ncr_format_value: "BINARY"
+#line 342 "d2_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 1066 "d2_parser.cc"
+    break;
+
+  case 82: // $@18: %empty
+#line 345 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 975 "d2_parser.cc" // lalr1.cc:859
+#line 1077 "d2_parser.cc"
     break;
 
-  case 77:
-#line 321 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 83: // forward_ddns: "forward-ddns" $@18 ":" "{" ddns_mgr_params "}"
+#line 350 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 984 "d2_parser.cc" // lalr1.cc:859
+#line 1086 "d2_parser.cc"
     break;
 
-  case 78:
-#line 326 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 84: // $@19: %empty
+#line 355 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 995 "d2_parser.cc" // lalr1.cc:859
+#line 1097 "d2_parser.cc"
     break;
 
-  case 79:
-#line 331 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 85: // reverse_ddns: "reverse-ddns" $@19 ":" "{" ddns_mgr_params "}"
+#line 360 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1004 "d2_parser.cc" // lalr1.cc:859
+#line 1106 "d2_parser.cc"
     break;
 
-  case 86:
-#line 350 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 92: // $@20: %empty
+#line 379 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1015 "d2_parser.cc" // lalr1.cc:859
+#line 1117 "d2_parser.cc"
     break;
 
-  case 87:
-#line 355 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 93: // ddns_domains: "ddns-domains" $@20 ":" "[" ddns_domain_list "]"
+#line 384 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1024 "d2_parser.cc" // lalr1.cc:859
+#line 1126 "d2_parser.cc"
     break;
 
-  case 88:
-#line 360 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 94: // $@21: %empty
+#line 389 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1033 "d2_parser.cc" // lalr1.cc:859
+#line 1135 "d2_parser.cc"
     break;
 
-  case 89:
-#line 363 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 95: // sub_ddns_domains: "[" $@21 ddns_domain_list "]"
+#line 392 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1041 "d2_parser.cc" // lalr1.cc:859
+#line 1143 "d2_parser.cc"
     break;
 
-  case 94:
-#line 375 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 100: // $@22: %empty
+#line 404 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1051 "d2_parser.cc" // lalr1.cc:859
+#line 1153 "d2_parser.cc"
     break;
 
-  case 95:
-#line 379 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 101: // ddns_domain: "{" $@22 ddns_domain_params "}"
+#line 408 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1059 "d2_parser.cc" // lalr1.cc:859
+#line 1161 "d2_parser.cc"
     break;
 
-  case 96:
-#line 383 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 102: // $@23: %empty
+#line 412 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1068 "d2_parser.cc" // lalr1.cc:859
+#line 1170 "d2_parser.cc"
     break;
 
-  case 97:
-#line 386 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 103: // sub_ddns_domain: "{" $@23 ddns_domain_params "}"
+#line 415 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1076 "d2_parser.cc" // lalr1.cc:859
+#line 1178 "d2_parser.cc"
     break;
 
-  case 104:
-#line 401 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 110: // $@24: %empty
+#line 430 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1084 "d2_parser.cc" // lalr1.cc:859
+#line 1186 "d2_parser.cc"
     break;
 
-  case 105:
-#line 403 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 111: // ddns_domain_name: "name" $@24 ":" "constant string"
+#line 432 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1098 "d2_parser.cc" // lalr1.cc:859
+#line 1200 "d2_parser.cc"
     break;
 
-  case 106:
-#line 413 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 112: // $@25: %empty
+#line 442 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1106 "d2_parser.cc" // lalr1.cc:859
+#line 1208 "d2_parser.cc"
     break;
 
-  case 107:
-#line 415 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 113: // ddns_domain_key_name: "key-name" $@25 ":" "constant string"
+#line 444 "d2_parser.yy"
+               {
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1117 "d2_parser.cc" // lalr1.cc:859
+#line 1219 "d2_parser.cc"
     break;
 
-  case 108:
-#line 425 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 114: // $@26: %empty
+#line 454 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1128 "d2_parser.cc" // lalr1.cc:859
+#line 1230 "d2_parser.cc"
     break;
 
-  case 109:
-#line 430 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 115: // dns_servers: "dns-servers" $@26 ":" "[" dns_server_list "]"
+#line 459 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1137 "d2_parser.cc" // lalr1.cc:859
+#line 1239 "d2_parser.cc"
     break;
 
-  case 110:
-#line 435 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 116: // $@27: %empty
+#line 464 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1146 "d2_parser.cc" // lalr1.cc:859
+#line 1248 "d2_parser.cc"
     break;
 
-  case 111:
-#line 438 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 117: // sub_dns_servers: "[" $@27 dns_server_list "]"
+#line 467 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1154 "d2_parser.cc" // lalr1.cc:859
+#line 1256 "d2_parser.cc"
     break;
 
-  case 114:
-#line 446 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 120: // $@28: %empty
+#line 475 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1164 "d2_parser.cc" // lalr1.cc:859
+#line 1266 "d2_parser.cc"
     break;
 
-  case 115:
-#line 450 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 121: // dns_server: "{" $@28 dns_server_params "}"
+#line 479 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1172 "d2_parser.cc" // lalr1.cc:859
+#line 1274 "d2_parser.cc"
     break;
 
-  case 116:
-#line 454 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 122: // $@29: %empty
+#line 483 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1181 "d2_parser.cc" // lalr1.cc:859
+#line 1283 "d2_parser.cc"
     break;
 
-  case 117:
-#line 457 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 123: // sub_dns_server: "{" $@29 dns_server_params "}"
+#line 486 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1189 "d2_parser.cc" // lalr1.cc:859
+#line 1291 "d2_parser.cc"
     break;
 
-  case 124:
-#line 471 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 131: // $@30: %empty
+#line 501 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1197 "d2_parser.cc" // lalr1.cc:859
+#line 1299 "d2_parser.cc"
     break;
 
-  case 125:
-#line 473 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () != "") {
+  case 132: // dns_server_hostname: "hostname" $@30 ":" "constant string"
+#line 503 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1211 "d2_parser.cc" // lalr1.cc:859
+#line 1313 "d2_parser.cc"
     break;
 
-  case 126:
-#line 483 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 133: // $@31: %empty
+#line 513 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1219 "d2_parser.cc" // lalr1.cc:859
+#line 1321 "d2_parser.cc"
     break;
 
-  case 127:
-#line 485 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 134: // dns_server_ip_address: "ip-address" $@31 ":" "constant string"
+#line 515 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1229 "d2_parser.cc" // lalr1.cc:859
+#line 1331 "d2_parser.cc"
     break;
 
-  case 128:
-#line 491 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 135: // dns_server_port: "port" ":" "integer"
+#line 521 "d2_parser.yy"
+                                    {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1241 "d2_parser.cc" // lalr1.cc:859
+#line 1343 "d2_parser.cc"
     break;
 
-  case 129:
-#line 505 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 136: // $@32: %empty
+#line 529 "d2_parser.yy"
+                              {
+    ctx.enter(ctx.NCR_PROTOCOL);
+}
+#line 1351 "d2_parser.cc"
+    break;
+
+  case 137: // dns_server_protocol: "protocol" $@32 ":" ncr_protocol_value
+#line 531 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("protocol", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1360 "d2_parser.cc"
+    break;
+
+  case 138: // $@33: %empty
+#line 542 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1252 "d2_parser.cc" // lalr1.cc:859
+#line 1371 "d2_parser.cc"
     break;
 
-  case 130:
-#line 510 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 139: // tsig_keys: "tsig-keys" $@33 ":" "[" tsig_keys_list "]"
+#line 547 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1261 "d2_parser.cc" // lalr1.cc:859
+#line 1380 "d2_parser.cc"
     break;
 
-  case 131:
-#line 515 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 140: // $@34: %empty
+#line 552 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1270 "d2_parser.cc" // lalr1.cc:859
+#line 1389 "d2_parser.cc"
     break;
 
-  case 132:
-#line 518 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 141: // sub_tsig_keys: "[" $@34 tsig_keys_list "]"
+#line 555 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1278 "d2_parser.cc" // lalr1.cc:859
+#line 1397 "d2_parser.cc"
     break;
 
-  case 137:
-#line 530 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 146: // $@35: %empty
+#line 567 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1288 "d2_parser.cc" // lalr1.cc:859
+#line 1407 "d2_parser.cc"
     break;
 
-  case 138:
-#line 534 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 147: // tsig_key: "{" $@35 tsig_key_params "}"
+#line 571 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1296 "d2_parser.cc" // lalr1.cc:859
+#line 1415 "d2_parser.cc"
     break;
 
-  case 139:
-#line 538 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 148: // $@36: %empty
+#line 575 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1306 "d2_parser.cc" // lalr1.cc:859
+#line 1425 "d2_parser.cc"
     break;
 
-  case 140:
-#line 542 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 149: // sub_tsig_key: "{" $@36 tsig_key_params "}"
+#line 579 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1314 "d2_parser.cc" // lalr1.cc:859
+#line 1433 "d2_parser.cc"
     break;
 
-  case 148:
-#line 558 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 157: // $@37: %empty
+#line 595 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1322 "d2_parser.cc" // lalr1.cc:859
+#line 1441 "d2_parser.cc"
     break;
 
-  case 149:
-#line 560 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 158: // tsig_key_name: "name" $@37 ":" "constant string"
+#line 597 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1336 "d2_parser.cc" // lalr1.cc:859
+#line 1455 "d2_parser.cc"
     break;
 
-  case 150:
-#line 570 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 159: // $@38: %empty
+#line 607 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1344 "d2_parser.cc" // lalr1.cc:859
+#line 1463 "d2_parser.cc"
     break;
 
-  case 151:
-#line 572 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 160: // tsig_key_algorithm: "algorithm" $@38 ":" "constant string"
+#line 609 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1357 "d2_parser.cc" // lalr1.cc:859
+#line 1476 "d2_parser.cc"
     break;
 
-  case 152:
-#line 581 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () < 0 || (yystack_[0].value.as< int64_t > () > 0  && (yystack_[0].value.as< int64_t > () % 8 != 0))) {
+  case 161: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 618 "d2_parser.yy"
+                                                {
+    if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
-    ElementPtr elem(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1369 "d2_parser.cc" // lalr1.cc:859
+#line 1488 "d2_parser.cc"
     break;
 
-  case 153:
-#line 589 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 162: // $@39: %empty
+#line 626 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1377 "d2_parser.cc" // lalr1.cc:859
+#line 1496 "d2_parser.cc"
     break;
 
-  case 154:
-#line 591 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 163: // tsig_key_secret: "secret" $@39 ":" "constant string"
+#line 628 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1390 "d2_parser.cc" // lalr1.cc:859
+#line 1509 "d2_parser.cc"
     break;
 
-  case 155:
-#line 604 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 164: // $@40: %empty
+#line 641 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1398 "d2_parser.cc" // lalr1.cc:859
+#line 1517 "d2_parser.cc"
     break;
 
-  case 156:
-#line 606 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 165: // dhcp6_json_object: "Dhcp6" $@40 ":" value
+#line 643 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1407 "d2_parser.cc" // lalr1.cc:859
+#line 1526 "d2_parser.cc"
     break;
 
-  case 157:
-#line 611 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 166: // $@41: %empty
+#line 648 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1415 "d2_parser.cc" // lalr1.cc:859
+#line 1534 "d2_parser.cc"
     break;
 
-  case 158:
-#line 613 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 167: // dhcp4_json_object: "Dhcp4" $@41 ":" value
+#line 650 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1424 "d2_parser.cc" // lalr1.cc:859
+#line 1543 "d2_parser.cc"
     break;
 
-  case 159:
-#line 618 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 168: // $@42: %empty
+#line 655 "d2_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1432 "d2_parser.cc" // lalr1.cc:859
+#line 1551 "d2_parser.cc"
     break;
 
-  case 160:
-#line 620 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 169: // control_agent_json_object: "Control-agent" $@42 ":" value
+#line 657 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1441 "d2_parser.cc" // lalr1.cc:859
+#line 1560 "d2_parser.cc"
     break;
 
-  case 161:
-#line 630 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 170: // $@43: %empty
+#line 667 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1452 "d2_parser.cc" // lalr1.cc:859
+#line 1571 "d2_parser.cc"
     break;
 
-  case 162:
-#line 635 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 171: // logging_object: "Logging" $@43 ":" "{" logging_params "}"
+#line 672 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1461 "d2_parser.cc" // lalr1.cc:859
+#line 1580 "d2_parser.cc"
     break;
 
-  case 166:
-#line 652 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 175: // $@44: %empty
+#line 689 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1472 "d2_parser.cc" // lalr1.cc:859
+#line 1591 "d2_parser.cc"
     break;
 
-  case 167:
-#line 657 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 176: // loggers: "loggers" $@44 ":" "[" loggers_entries "]"
+#line 694 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1481 "d2_parser.cc" // lalr1.cc:859
+#line 1600 "d2_parser.cc"
     break;
 
-  case 170:
-#line 669 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 179: // $@45: %empty
+#line 706 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1491 "d2_parser.cc" // lalr1.cc:859
+#line 1610 "d2_parser.cc"
     break;
 
-  case 171:
-#line 673 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 180: // logger_entry: "{" $@45 logger_params "}"
+#line 710 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1499 "d2_parser.cc" // lalr1.cc:859
+#line 1618 "d2_parser.cc"
     break;
 
-  case 179:
-#line 688 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 188: // $@46: %empty
+#line 725 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1507 "d2_parser.cc" // lalr1.cc:859
+#line 1626 "d2_parser.cc"
     break;
 
-  case 180:
-#line 690 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 189: // name: "name" $@46 ":" "constant string"
+#line 727 "d2_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1517 "d2_parser.cc" // lalr1.cc:859
+#line 1636 "d2_parser.cc"
     break;
 
-  case 181:
-#line 696 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 190: // debuglevel: "debuglevel" ":" "integer"
+#line 733 "d2_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1526 "d2_parser.cc" // lalr1.cc:859
+#line 1645 "d2_parser.cc"
     break;
 
-  case 182:
-#line 700 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 191: // $@47: %empty
+#line 737 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1534 "d2_parser.cc" // lalr1.cc:859
+#line 1653 "d2_parser.cc"
     break;
 
-  case 183:
-#line 702 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 192: // severity: "severity" $@47 ":" "constant string"
+#line 739 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1544 "d2_parser.cc" // lalr1.cc:859
+#line 1663 "d2_parser.cc"
     break;
 
-  case 184:
-#line 708 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 193: // $@48: %empty
+#line 745 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1555 "d2_parser.cc" // lalr1.cc:859
+#line 1674 "d2_parser.cc"
     break;
 
-  case 185:
-#line 713 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 194: // output_options_list: "output_options" $@48 ":" "[" output_options_list_content "]"
+#line 750 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1564 "d2_parser.cc" // lalr1.cc:859
+#line 1683 "d2_parser.cc"
     break;
 
-  case 188:
-#line 722 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 197: // $@49: %empty
+#line 759 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1574 "d2_parser.cc" // lalr1.cc:859
+#line 1693 "d2_parser.cc"
     break;
 
-  case 189:
-#line 726 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 198: // output_entry: "{" $@49 output_params_list "}"
+#line 763 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1582 "d2_parser.cc" // lalr1.cc:859
+#line 1701 "d2_parser.cc"
     break;
 
-  case 196:
-#line 740 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 205: // $@50: %empty
+#line 777 "d2_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1590 "d2_parser.cc" // lalr1.cc:859
+#line 1709 "d2_parser.cc"
     break;
 
-  case 197:
-#line 742 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 206: // output: "output" $@50 ":" "constant string"
+#line 779 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1600 "d2_parser.cc" // lalr1.cc:859
+#line 1719 "d2_parser.cc"
     break;
 
-  case 198:
-#line 748 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 207: // flush: "flush" ":" "boolean"
+#line 785 "d2_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1609 "d2_parser.cc" // lalr1.cc:859
+#line 1728 "d2_parser.cc"
     break;
 
-  case 199:
-#line 753 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 208: // maxsize: "maxsize" ":" "integer"
+#line 790 "d2_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1618 "d2_parser.cc" // lalr1.cc:859
+#line 1737 "d2_parser.cc"
     break;
 
-  case 200:
-#line 758 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 209: // maxver: "maxver" ":" "integer"
+#line 795 "d2_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1627 "d2_parser.cc" // lalr1.cc:859
+#line 1746 "d2_parser.cc"
     break;
 
 
-#line 1631 "d2_parser.cc" // lalr1.cc:859
+#line 1750 "d2_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1655,7 +1778,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1666,7 +1791,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1683,69 +1808,81 @@ namespace isc { namespace d2 {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1753,6 +1890,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1761,12 +1899,12 @@ namespace isc { namespace d2 {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -1777,26 +1915,112 @@ namespace isc { namespace d2 {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   D2Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
 
+
+
+
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1815,41 +2039,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1858,22 +2073,23 @@ namespace isc { namespace d2 {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1882,48 +2098,49 @@ namespace isc { namespace d2 {
   }
 
 
-  const signed char D2Parser::yypact_ninf_ = -111;
+  const signed char D2Parser::yypact_ninf_ = -112;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   D2Parser::yypact_[] =
   {
-      20,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-      24,    -2,    35,    51,    96,    31,   100,   101,   102,   103,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,    -2,    59,
-       2,     3,    10,   104,     4,   105,    -6,   106,  -111,   109,
-     114,   115,   110,   117,  -111,  -111,  -111,  -111,  -111,   119,
-    -111,     8,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   121,
-     122,  -111,  -111,  -111,  -111,  -111,  -111,    19,  -111,  -111,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   123,  -111,
-    -111,  -111,    25,  -111,  -111,  -111,  -111,  -111,  -111,   125,
-     118,  -111,  -111,  -111,  -111,  -111,    68,  -111,  -111,  -111,
-    -111,  -111,   127,   126,  -111,  -111,   124,  -111,  -111,    69,
-    -111,  -111,  -111,  -111,  -111,    29,  -111,  -111,    -2,    -2,
-    -111,    83,   131,   132,   133,   134,   135,  -111,     2,  -111,
-     136,    92,    93,   142,   143,   144,   145,   146,     3,  -111,
-     147,   107,   148,   149,    10,  -111,    10,  -111,   104,   150,
-     151,   152,     4,  -111,     4,  -111,   105,   153,   108,   154,
-      -6,  -111,    -6,   106,  -111,  -111,  -111,   157,    -2,    -2,
-      -2,   155,   156,  -111,   113,  -111,  -111,    77,   158,   159,
-     160,   163,  -111,   120,  -111,   129,   130,  -111,    71,  -111,
-     137,   164,   138,  -111,    72,  -111,   139,  -111,   140,  -111,
-      75,  -111,    -2,  -111,  -111,  -111,     3,   141,  -111,  -111,
-    -111,  -111,  -111,   -14,   -14,   104,  -111,  -111,  -111,  -111,
-    -111,   106,  -111,  -111,  -111,  -111,  -111,  -111,    78,  -111,
-      79,  -111,  -111,  -111,  -111,    81,  -111,  -111,  -111,    82,
-     166,    94,  -111,   161,   141,  -111,   169,   -14,  -111,  -111,
-    -111,  -111,   165,  -111,   171,  -111,   170,   105,  -111,    98,
-    -111,   172,    22,   170,  -111,  -111,  -111,  -111,   178,  -111,
-    -111,    85,  -111,  -111,  -111,  -111,  -111,  -111,   181,   182,
-     162,   183,    22,  -111,   167,   187,  -111,   168,  -111,  -111,
-     186,  -111,  -111,    99,  -111,     7,   186,  -111,  -111,   190,
-     191,   192,    91,  -111,  -111,  -111,  -111,  -111,  -111,   193,
-     173,   174,   176,     7,  -111,   179,  -111,  -111,  -111,  -111,
-    -111
+      16,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+       9,    -2,    23,    53,   102,    11,   106,   107,   108,   109,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,    -2,    48,
+       2,     3,     6,   110,    -5,   111,    -4,   112,  -112,   114,
+     113,   117,   115,   122,  -112,  -112,  -112,  -112,  -112,   123,
+    -112,    29,  -112,  -112,  -112,  -112,  -112,  -112,  -112,   124,
+     125,   127,   129,  -112,  -112,  -112,  -112,  -112,  -112,    44,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,  -112,   130,  -112,  -112,  -112,    69,  -112,  -112,  -112,
+    -112,  -112,  -112,   120,   132,  -112,  -112,  -112,  -112,  -112,
+      70,  -112,  -112,  -112,  -112,  -112,   131,   133,  -112,  -112,
+     134,  -112,  -112,  -112,    76,  -112,  -112,  -112,  -112,  -112,
+    -112,    28,  -112,  -112,    -2,    -2,  -112,    85,   138,   139,
+     140,   141,   142,  -112,     2,  -112,   143,    92,    93,    99,
+     100,   149,   150,   153,   154,   155,     3,  -112,   156,   116,
+     157,   158,     6,  -112,     6,  -112,   110,   159,   160,   161,
+      -5,  -112,    -5,  -112,   111,   162,   118,   163,   164,    -4,
+    -112,    -4,   112,  -112,  -112,  -112,   165,    -2,    -2,    -2,
+     166,   168,  -112,   121,  -112,  -112,  -112,  -112,    72,    25,
+     170,   171,   174,  -112,   126,  -112,   128,   135,  -112,    77,
+    -112,   136,   175,   137,  -112,    78,  -112,   144,  -112,   145,
+      72,  -112,    79,  -112,    -2,  -112,  -112,  -112,     3,   147,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,   -19,   -19,   110,
+    -112,  -112,  -112,  -112,  -112,   112,  -112,  -112,  -112,  -112,
+    -112,  -112,  -112,    80,  -112,    86,  -112,  -112,  -112,  -112,
+      87,  -112,  -112,  -112,    88,   176,    96,  -112,   167,   147,
+    -112,   181,   -19,  -112,  -112,  -112,  -112,   183,  -112,   184,
+    -112,   179,   111,  -112,   104,  -112,   187,     4,   179,  -112,
+    -112,  -112,  -112,   190,  -112,  -112,    97,  -112,  -112,  -112,
+    -112,  -112,  -112,   191,   192,   146,   197,     4,  -112,   148,
+     199,  -112,   151,  -112,  -112,   198,  -112,  -112,   105,  -112,
+      31,   198,  -112,  -112,   203,   204,   205,    98,  -112,  -112,
+    -112,  -112,  -112,  -112,   206,   169,   172,   173,    31,  -112,
+     178,  -112,  -112,  -112,  -112,  -112
   };
 
   const unsigned char
@@ -1932,207 +2149,211 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    34,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    41,     5,    53,     7,   139,     9,   131,    11,
-      96,    13,    88,    15,   116,    17,   110,    19,    36,    30,
-       0,     0,     0,   133,     0,    90,     0,     0,    38,     0,
-      37,     0,     0,    31,   155,   157,   159,    51,   161,     0,
-      50,     0,    43,    48,    45,    47,    49,    46,    66,     0,
-       0,    70,    74,    76,    78,   129,    65,     0,    55,    57,
-      58,    59,    60,    61,    62,    63,    64,   150,     0,   153,
-     148,   147,     0,   141,   143,   144,   145,   146,   137,     0,
-     134,   135,   106,   108,   104,   103,     0,    98,   100,   101,
-     102,    94,     0,    91,    92,   126,     0,   124,   123,     0,
-     118,   120,   121,   122,   114,     0,   112,    35,     0,     0,
-      29,     0,     0,     0,     0,     0,     0,    40,     0,    42,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    54,
-       0,     0,     0,     0,     0,   140,     0,   132,     0,     0,
-       0,     0,     0,    97,     0,    89,     0,     0,     0,     0,
-       0,   117,     0,     0,   111,    39,    32,     0,     0,     0,
-       0,     0,     0,    44,     0,    68,    69,     0,     0,     0,
-       0,     0,    56,     0,   152,     0,     0,   142,     0,   136,
-       0,     0,     0,    99,     0,    93,     0,   128,     0,   119,
-       0,   113,     0,   156,   158,   160,     0,     0,    67,    72,
-      73,    71,    75,    80,    80,   133,   151,   154,   149,   138,
-     107,     0,   105,    95,   127,   125,   115,    33,     0,   166,
-       0,   163,   165,    86,    85,     0,    81,    82,    84,     0,
-       0,     0,    52,     0,     0,   162,     0,     0,    77,    79,
-     130,   109,     0,   164,     0,    83,     0,    90,   170,     0,
-     168,     0,     0,     0,   167,    87,   179,   184,     0,   182,
-     178,     0,   172,   174,   176,   177,   175,   169,     0,     0,
-       0,     0,     0,   171,     0,     0,   181,     0,   173,   180,
-       0,   183,   188,     0,   186,     0,     0,   185,   196,     0,
-       0,     0,     0,   190,   192,   193,   194,   195,   187,     0,
-       0,     0,     0,     0,   189,     0,   198,   199,   200,   191,
-     197
+      25,    26,    41,     5,    53,     7,   148,     9,   140,    11,
+     102,    13,    94,    15,   122,    17,   116,    19,    36,    30,
+       0,     0,     0,   142,     0,    96,     0,     0,    38,     0,
+      37,     0,     0,    31,   164,   166,   168,    51,   170,     0,
+      50,     0,    43,    48,    45,    47,    49,    46,    68,     0,
+       0,     0,     0,    74,    78,    82,    84,   138,    67,     0,
+      55,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,   159,     0,   162,   157,   156,     0,   150,   152,   153,
+     154,   155,   146,     0,   143,   144,   112,   114,   110,   109,
+       0,   104,   106,   107,   108,   100,     0,    97,    98,   133,
+       0,   131,   136,   130,     0,   124,   126,   127,   128,   129,
+     120,     0,   118,    35,     0,     0,    29,     0,     0,     0,
+       0,     0,     0,    40,     0,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    54,     0,     0,
+       0,     0,     0,   149,     0,   141,     0,     0,     0,     0,
+       0,   103,     0,    95,     0,     0,     0,     0,     0,     0,
+     123,     0,     0,   117,    39,    32,     0,     0,     0,     0,
+       0,     0,    44,     0,    70,    71,    72,    73,     0,     0,
+       0,     0,     0,    56,     0,   161,     0,     0,   151,     0,
+     145,     0,     0,     0,   105,     0,    99,     0,   135,     0,
+       0,   125,     0,   119,     0,   165,   167,   169,     0,     0,
+      69,    76,    77,    75,    80,    81,    79,    86,    86,   142,
+     160,   163,   158,   147,   113,     0,   111,   101,   134,   132,
+     137,   121,    33,     0,   175,     0,   172,   174,    92,    91,
+       0,    87,    88,    90,     0,     0,     0,    52,     0,     0,
+     171,     0,     0,    83,    85,   139,   115,     0,   173,     0,
+      89,     0,    96,   179,     0,   177,     0,     0,     0,   176,
+      93,   188,   193,     0,   191,   187,     0,   181,   183,   185,
+     186,   184,   178,     0,     0,     0,     0,     0,   180,     0,
+       0,   190,     0,   182,   189,     0,   192,   197,     0,   195,
+       0,     0,   194,   205,     0,     0,     0,     0,   199,   201,
+     202,   203,   204,   196,     0,     0,     0,     0,     0,   198,
+       0,   207,   208,   209,   200,   206
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,   -47,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,   -50,  -111,  -111,  -111,    50,  -111,  -111,  -111,  -111,
-     -27,    42,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,  -111,   -33,  -111,   -65,  -111,  -111,
-    -111,  -111,   -74,  -111,    28,  -111,  -111,  -111,    32,    33,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   -34,    26,
-    -111,  -111,  -111,    30,    36,  -111,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,   -25,  -111,    40,  -111,  -111,  -111,
-      45,    49,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   -49,  -111,
-    -111,  -111,   -63,  -111,  -111,   -81,  -111,  -111,  -111,  -111,
-    -111,  -111,  -111,  -111,   -94,  -111,  -111,  -110,  -111,  -111,
-    -111,  -111,  -111
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,   -47,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,   -50,  -112,  -112,  -112,    57,  -112,  -112,  -112,  -112,
+     -68,    46,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+     -17,  -112,  -112,  -112,  -112,  -112,  -112,  -112,   -34,  -112,
+     -67,  -112,  -112,  -112,  -112,   -76,  -112,    33,  -112,  -112,
+    -112,    36,    39,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,   -35,    30,  -112,  -112,  -112,    32,    35,  -112,  -112,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,   -28,
+    -112,    49,  -112,  -112,  -112,    52,    58,  -112,  -112,  -112,
+    -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,
+    -112,  -112,  -112,   -48,  -112,  -112,  -112,   -64,  -112,  -112,
+     -82,  -112,  -112,  -112,  -112,  -112,  -112,  -112,  -112,   -95,
+    -112,  -112,  -111,  -112,  -112,  -112,  -112,  -112
   };
 
-  const short int
+  const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    28,    29,    30,    49,    62,    63,    31,    48,    59,
-      60,    86,    33,    50,    71,    72,    73,   145,    35,    51,
-      87,    88,    89,   150,    90,    91,    92,   153,   231,    93,
-     154,    94,   155,    95,   156,   255,   256,   257,   258,   266,
-      43,    55,   122,   123,   124,   174,    41,    54,   116,   117,
-     118,   171,   119,   169,   120,   170,    47,    57,   135,   136,
-     182,    45,    56,   129,   130,   131,   179,   132,   177,   133,
-      96,   157,    39,    53,   109,   110,   111,   166,    37,    52,
-     102,   103,   104,   163,   105,   160,   106,   107,   162,    74,
-     142,    75,   143,    76,   144,    77,   146,   250,   251,   252,
-     263,   279,   280,   282,   291,   292,   293,   298,   294,   295,
-     301,   296,   299,   313,   314,   315,   322,   323,   324,   329,
-     325,   326,   327
+      60,    88,    33,    50,    71,    72,    73,   151,    35,    51,
+      89,    90,    91,   156,    92,    93,    94,    95,    96,   161,
+     243,    97,   162,   246,    98,   163,    99,   164,   270,   271,
+     272,   273,   281,    43,    55,   126,   127,   128,   182,    41,
+      54,   120,   121,   122,   179,   123,   177,   124,   178,    47,
+      57,   141,   142,   191,    45,    56,   134,   135,   136,   187,
+     137,   185,   138,   139,   188,   100,   165,    39,    53,   113,
+     114,   115,   174,    37,    52,   106,   107,   108,   171,   109,
+     168,   110,   111,   170,    74,   148,    75,   149,    76,   150,
+      77,   152,   265,   266,   267,   278,   294,   295,   297,   306,
+     307,   308,   313,   309,   310,   316,   311,   314,   328,   329,
+     330,   337,   338,   339,   344,   340,   341,   342
   };
 
-  const unsigned short int
+  const short
   D2Parser::yytable_[] =
   {
-      70,    58,   101,    21,   115,    22,   128,    23,   125,   126,
-     253,   148,    64,    65,    66,    67,   149,    78,    79,    80,
-      81,   127,   158,    82,    20,    83,    84,   159,   164,   112,
-     113,    85,   183,   165,    68,   184,    38,    69,   114,    97,
-      98,    99,    32,   318,   100,    69,   319,   320,   321,    24,
-      25,    26,    27,    69,    69,    69,   286,   287,    34,   288,
-     289,    69,     1,     2,     3,     4,     5,     6,     7,     8,
-       9,   172,   180,    69,   164,   172,   173,   181,   180,   239,
-     243,   158,   264,   246,   267,   267,   262,   265,   302,   268,
-     269,   185,   186,   303,   333,   229,   230,   183,    70,   334,
-     271,   283,   316,    36,   284,   317,    42,    40,    46,    44,
-      61,   108,   121,   134,   101,   137,   101,   138,   140,   139,
-     141,   168,   115,   147,   115,   151,   152,   161,   178,   176,
-     128,   167,   128,   175,   187,   188,   189,   190,   191,   192,
-     194,   223,   224,   225,   195,   196,   197,   198,   199,   200,
-     201,   203,   205,   206,   210,   211,   212,   216,   218,   204,
-     217,   222,   226,   227,   228,   272,   233,   234,   235,   241,
-     276,   236,   270,   274,   249,   247,   277,   278,   285,   232,
-     237,   238,   300,   254,   254,   304,   305,   307,   240,   242,
-     244,   245,   310,   312,   330,   331,   332,   335,   193,   248,
-     202,   259,   275,   281,   215,   213,   214,   261,   209,   221,
-     260,   208,   220,   207,   306,   273,   219,   254,   309,   311,
-     297,   308,   328,   339,     0,     0,   337,   336,   338,     0,
-     340,     0,   290,     0,     0,     0,     0,     0,     0,     0,
+      70,    58,   105,    21,   119,    22,   133,    23,   268,    20,
+     129,   130,    64,    65,    66,    67,    38,    78,    79,    80,
+      81,    82,    83,   116,   117,    84,   131,   132,    85,    86,
+      32,   192,   154,   118,   193,    87,    69,   155,    68,   101,
+     102,   103,   301,   302,   104,   303,   304,   166,   244,   245,
+      69,    69,   167,    24,    25,    26,    27,    69,    69,    69,
+      34,    69,     1,     2,     3,     4,     5,     6,     7,     8,
+       9,   333,   172,   180,   334,   335,   336,   173,   181,   189,
+     172,   180,   189,   166,   190,   253,   257,   261,   277,   279,
+     282,   282,   241,   242,   280,   283,   284,   194,   195,   192,
+     317,   348,   286,    61,    70,   318,   349,   298,   331,    36,
+     299,   332,    42,    40,    46,    44,   144,   112,   125,   140,
+     143,   145,   105,   146,   105,   147,   175,   153,   157,   158,
+     119,   159,   119,   160,   169,   176,   184,   183,   186,   133,
+     196,   133,   197,   198,   199,   200,   201,   203,   204,   205,
+     235,   236,   237,   208,   209,   206,   207,   210,   211,   212,
+     214,   216,   217,   221,   222,   223,   227,   229,   230,   234,
+     263,   287,   215,   238,   228,   239,   240,   247,   248,   249,
+     255,   250,   285,   251,   264,   289,   293,   262,   291,   292,
+     252,   254,   256,   300,   315,   319,   320,   269,   269,   258,
+     259,   322,   321,   324,   325,   327,   326,   345,   346,   347,
+     350,   202,   213,   260,   274,   290,   296,   226,   225,   224,
+     276,   275,   233,   232,   231,   220,   219,   351,   352,   353,
+     218,   288,   269,   355,   312,   323,   343,   354,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   305,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   290
+       0,     0,     0,     0,     0,     0,     0,   305
   };
 
-  const short int
+  const short
   D2Parser::yycheck_[] =
   {
-      50,    48,    52,     5,    54,     7,    56,     9,    14,    15,
-      24,     3,    10,    11,    12,    13,     8,    14,    15,    16,
-      17,    27,     3,    20,     0,    22,    23,     8,     3,    25,
-      26,    28,     3,     8,    32,     6,     5,    51,    34,    29,
-      30,    31,     7,    36,    34,    51,    39,    40,    41,    51,
-      52,    53,    54,    51,    51,    51,    34,    35,     7,    37,
-      38,    51,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,     3,     3,    51,     3,     3,     8,     8,     3,     8,
-       8,     3,     3,     8,     3,     3,     8,     8,     3,     8,
-       8,   138,   139,     8,     3,    18,    19,     3,   148,     8,
-       6,     3,     3,     7,     6,     6,     5,     7,     5,     7,
-      51,     7,     7,     7,   164,     6,   166,     3,     8,     4,
-       3,     3,   172,     4,   174,     4,     4,     4,     4,     3,
-     180,     6,   182,     6,    51,     4,     4,     4,     4,     4,
-       4,   188,   189,   190,    52,    52,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,    52,
-      52,     4,     7,     7,    51,     4,     7,     7,     5,     5,
-       5,    51,     6,     4,    33,   222,     5,     7,     6,    21,
-      51,    51,     4,   233,   234,     4,     4,     4,    51,    51,
-      51,    51,     5,     7,     4,     4,     4,     4,   148,   226,
-     158,   234,   267,   277,   176,   172,   174,   241,   168,   183,
-     235,   166,   182,   164,    52,   264,   180,   267,    51,    51,
-     283,   302,   316,   333,    -1,    -1,    52,    54,    52,    -1,
-      51,    -1,   282,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      50,    48,    52,     5,    54,     7,    56,     9,    27,     0,
+      14,    15,    10,    11,    12,    13,     5,    14,    15,    16,
+      17,    18,    19,    28,    29,    22,    30,    31,    25,    26,
+       7,     3,     3,    38,     6,    32,    55,     8,    36,    33,
+      34,    35,    38,    39,    38,    41,    42,     3,    23,    24,
+      55,    55,     8,    55,    56,    57,    58,    55,    55,    55,
+       7,    55,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    40,     3,     3,    43,    44,    45,     8,     8,     3,
+       3,     3,     3,     3,     8,     8,     8,     8,     8,     3,
+       3,     3,    20,    21,     8,     8,     8,   144,   145,     3,
+       3,     3,     6,    55,   154,     8,     8,     3,     3,     7,
+       6,     6,     5,     7,     5,     7,     3,     7,     7,     7,
+       6,     4,   172,     8,   174,     3,     6,     4,     4,     4,
+     180,     4,   182,     4,     4,     3,     3,     6,     4,   189,
+      55,   191,     4,     4,     4,     4,     4,     4,    56,    56,
+     197,   198,   199,     4,     4,    56,    56,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+     238,     4,    56,     7,    56,     7,    55,     7,     7,     5,
+       5,    55,     6,    55,    37,     4,     7,   234,     5,     5,
+      55,    55,    55,     6,     4,     4,     4,   247,   248,    55,
+      55,     4,    56,    55,     5,     7,    55,     4,     4,     4,
+       4,   154,   166,   230,   248,   282,   292,   184,   182,   180,
+     255,   249,   192,   191,   189,   176,   174,    58,    56,    56,
+     172,   279,   282,    55,   298,   317,   331,   348,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   297,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   302
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   317
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-       0,     5,     7,     9,    51,    52,    53,    54,    66,    67,
-      68,    72,     7,    77,     7,    83,     7,   143,     5,   137,
-       7,   111,     5,   105,     7,   126,     5,   121,    73,    69,
-      78,    84,   144,   138,   112,   106,   127,   122,    66,    74,
-      75,    51,    70,    71,    10,    11,    12,    13,    32,    51,
-      76,    79,    80,    81,   154,   156,   158,   160,    14,    15,
-      16,    17,    20,    22,    23,    28,    76,    85,    86,    87,
-      89,    90,    91,    94,    96,    98,   135,    29,    30,    31,
-      34,    76,   145,   146,   147,   149,   151,   152,     7,   139,
-     140,   141,    25,    26,    34,    76,   113,   114,   115,   117,
-     119,     7,   107,   108,   109,    14,    15,    27,    76,   128,
-     129,   130,   132,   134,     7,   123,   124,     6,     3,     4,
-       8,     3,   155,   157,   159,    82,   161,     4,     3,     8,
-      88,     4,     4,    92,    95,    97,    99,   136,     3,     8,
-     150,     4,   153,   148,     3,     8,   142,     6,     3,   118,
-     120,   116,     3,     8,   110,     6,     3,   133,     4,   131,
-       3,     8,   125,     3,     6,    66,    66,    51,     4,     4,
-       4,     4,     4,    80,     4,    52,    52,     4,     4,     4,
-       4,     4,    86,     4,    52,     4,     4,   146,   145,   141,
-       4,     4,     4,   114,   113,   109,     4,    52,     4,   129,
-     128,   124,     4,    66,    66,    66,     7,     7,    51,    18,
-      19,    93,    21,     7,     7,     5,    51,    51,    51,     8,
-      51,     5,    51,     8,    51,    51,     8,    66,    85,    33,
-     162,   163,   164,    24,    76,   100,   101,   102,   103,   100,
-     139,   123,     8,   165,     3,     8,   104,     3,     8,     8,
-       6,     6,     4,   163,     4,   102,     5,     5,     7,   166,
-     167,   107,   168,     3,     6,     6,    34,    35,    37,    38,
-      76,   169,   170,   171,   173,   174,   176,   167,   172,   177,
-       4,   175,     3,     8,     4,     4,    52,     4,   170,    51,
-       5,    51,     7,   178,   179,   180,     3,     6,    36,    39,
-      40,    41,   181,   182,   183,   185,   186,   187,   179,   184,
-       4,     4,     4,     3,     8,     4,    54,    52,    52,   182,
-      51
+       0,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+       0,     5,     7,     9,    55,    56,    57,    58,    70,    71,
+      72,    76,     7,    81,     7,    87,     7,   152,     5,   146,
+       7,   118,     5,   112,     7,   133,     5,   128,    77,    73,
+      82,    88,   153,   147,   119,   113,   134,   129,    70,    78,
+      79,    55,    74,    75,    10,    11,    12,    13,    36,    55,
+      80,    83,    84,    85,   163,   165,   167,   169,    14,    15,
+      16,    17,    18,    19,    22,    25,    26,    32,    80,    89,
+      90,    91,    93,    94,    95,    96,    97,   100,   103,   105,
+     144,    33,    34,    35,    38,    80,   154,   155,   156,   158,
+     160,   161,     7,   148,   149,   150,    28,    29,    38,    80,
+     120,   121,   122,   124,   126,     7,   114,   115,   116,    14,
+      15,    30,    31,    80,   135,   136,   137,   139,   141,   142,
+       7,   130,   131,     6,     3,     4,     8,     3,   164,   166,
+     168,    86,   170,     4,     3,     8,    92,     4,     4,     4,
+       4,    98,   101,   104,   106,   145,     3,     8,   159,     4,
+     162,   157,     3,     8,   151,     6,     3,   125,   127,   123,
+       3,     8,   117,     6,     3,   140,     4,   138,   143,     3,
+       8,   132,     3,     6,    70,    70,    55,     4,     4,     4,
+       4,     4,    84,     4,    56,    56,    56,    56,     4,     4,
+       4,     4,     4,    90,     4,    56,     4,     4,   155,   154,
+     150,     4,     4,     4,   121,   120,   116,     4,    56,     4,
+       4,   136,   135,   131,     4,    70,    70,    70,     7,     7,
+      55,    20,    21,    99,    23,    24,   102,     7,     7,     5,
+      55,    55,    55,     8,    55,     5,    55,     8,    55,    55,
+      99,     8,    70,    89,    37,   171,   172,   173,    27,    80,
+     107,   108,   109,   110,   107,   148,   130,     8,   174,     3,
+       8,   111,     3,     8,     8,     6,     6,     4,   172,     4,
+     109,     5,     5,     7,   175,   176,   114,   177,     3,     6,
+       6,    38,    39,    41,    42,    80,   178,   179,   180,   182,
+     183,   185,   176,   181,   186,     4,   184,     3,     8,     4,
+       4,    56,     4,   179,    55,     5,    55,     7,   187,   188,
+     189,     3,     6,    40,    43,    44,    45,   190,   191,   192,
+     194,   195,   196,   188,   193,     4,     4,     4,     3,     8,
+       4,    58,    56,    56,   191,    55
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    55,    57,    56,    58,    56,    59,    56,    60,    56,
-      61,    56,    62,    56,    63,    56,    64,    56,    65,    56,
-      66,    66,    66,    66,    66,    66,    66,    67,    69,    68,
-      70,    70,    71,    71,    73,    72,    74,    74,    75,    75,
-      76,    78,    77,    79,    79,    80,    80,    80,    80,    80,
-      80,    82,    81,    84,    83,    85,    85,    86,    86,    86,
-      86,    86,    86,    86,    86,    86,    88,    87,    89,    90,
-      92,    91,    93,    93,    95,    94,    97,    96,    99,    98,
-     100,   100,   101,   101,   102,   102,   104,   103,   106,   105,
-     107,   107,   108,   108,   110,   109,   112,   111,   113,   113,
-     114,   114,   114,   114,   116,   115,   118,   117,   120,   119,
-     122,   121,   123,   123,   125,   124,   127,   126,   128,   128,
-     129,   129,   129,   129,   131,   130,   133,   132,   134,   136,
-     135,   138,   137,   139,   139,   140,   140,   142,   141,   144,
-     143,   145,   145,   146,   146,   146,   146,   146,   148,   147,
-     150,   149,   151,   153,   152,   155,   154,   157,   156,   159,
-     158,   161,   160,   162,   162,   163,   165,   164,   166,   166,
-     168,   167,   169,   169,   170,   170,   170,   170,   170,   172,
-     171,   173,   175,   174,   177,   176,   178,   178,   180,   179,
-     181,   181,   182,   182,   182,   182,   184,   183,   185,   186,
-     187
+       0,    59,    61,    60,    62,    60,    63,    60,    64,    60,
+      65,    60,    66,    60,    67,    60,    68,    60,    69,    60,
+      70,    70,    70,    70,    70,    70,    70,    71,    73,    72,
+      74,    74,    75,    75,    77,    76,    78,    78,    79,    79,
+      80,    82,    81,    83,    83,    84,    84,    84,    84,    84,
+      84,    86,    85,    88,    87,    89,    89,    90,    90,    90,
+      90,    90,    90,    90,    90,    90,    90,    90,    92,    91,
+      93,    94,    95,    96,    98,    97,    99,    99,   101,   100,
+     102,   102,   104,   103,   106,   105,   107,   107,   108,   108,
+     109,   109,   111,   110,   113,   112,   114,   114,   115,   115,
+     117,   116,   119,   118,   120,   120,   121,   121,   121,   121,
+     123,   122,   125,   124,   127,   126,   129,   128,   130,   130,
+     132,   131,   134,   133,   135,   135,   136,   136,   136,   136,
+     136,   138,   137,   140,   139,   141,   143,   142,   145,   144,
+     147,   146,   148,   148,   149,   149,   151,   150,   153,   152,
+     154,   154,   155,   155,   155,   155,   155,   157,   156,   159,
+     158,   160,   162,   161,   164,   163,   166,   165,   168,   167,
+     170,   169,   171,   171,   172,   174,   173,   175,   175,   177,
+     176,   178,   178,   179,   179,   179,   179,   179,   181,   180,
+     182,   184,   183,   186,   185,   187,   187,   189,   188,   190,
+     190,   191,   191,   191,   191,   193,   192,   194,   195,   196
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2141,123 +2362,125 @@ namespace isc { namespace d2 {
        0,     1,     3,     5,     0,     4,     0,     1,     1,     3,
        2,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        1,     0,     6,     0,     4,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     3,     3,
-       0,     4,     1,     1,     0,     4,     0,     6,     0,     6,
-       0,     1,     1,     3,     1,     1,     0,     6,     0,     4,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     4,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     0,     4,     3,     0,
-       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       3,     3,     3,     3,     0,     4,     1,     1,     0,     4,
+       1,     1,     0,     6,     0,     6,     0,     1,     1,     3,
+       1,     1,     0,     6,     0,     4,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     3,     0,     4,     0,     6,
+       0,     4,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     3,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     0,     6,     1,     3,     0,
        4,     1,     3,     1,     1,     1,     1,     1,     0,     4,
-       0,     4,     3,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     6,     1,     3,     1,     0,     6,     1,     3,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     0,
-       4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"Control-agent\"", "\"DhcpDdns\"", "\"ip-address\"", "\"port\"",
-  "\"dns-server-timeout\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
-  "\"ncr-format\"", "\"JSON\"", "\"forward-ddns\"", "\"reverse-ddns\"",
-  "\"ddns-domains\"", "\"key-name\"", "\"dns-servers\"", "\"hostname\"",
-  "\"tsig-keys\"", "\"algorithm\"", "\"digest-bits\"", "\"secret\"",
-  "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
-  "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
-  "\"maxsize\"", "\"maxver\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS",
-  "SUB_DHCPDDNS", "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN",
-  "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER", "SUB_DNS_SERVERS",
-  "\"constant string\"", "\"integer\"", "\"floating point\"",
-  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
-  "$@6", "$@7", "$@8", "$@9", "value", "sub_json", "map2", "$@10",
-  "map_content", "not_empty_map", "list_generic", "$@11", "list_content",
-  "not_empty_list", "unknown_map_entry", "syntax_map", "$@12",
-  "global_objects", "global_object", "dhcpddns_object", "$@13",
-  "sub_dhcpddns", "$@14", "dhcpddns_params", "dhcpddns_param",
-  "ip_address", "$@15", "port", "dns_server_timeout", "ncr_protocol",
-  "$@16", "ncr_protocol_value", "ncr_format", "$@17", "forward_ddns",
-  "$@18", "reverse_ddns", "$@19", "ddns_mgr_params",
-  "not_empty_ddns_mgr_params", "ddns_mgr_param", "ddns_domains", "$@20",
-  "sub_ddns_domains", "$@21", "ddns_domain_list",
+  "\"dns-server-timeout\"", "\"dns-update-batch-window\"",
+  "\"dns-update-batch-size\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
+  "\"ncr-format\"", "\"JSON\"", "\"BINARY\"", "\"forward-ddns\"",
+  "\"reverse-ddns\"", "\"ddns-domains\"", "\"key-name\"",
+  "\"dns-servers\"", "\"hostname\"", "\"protocol\"", "\"tsig-keys\"",
+  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"Logging\"",
+  "\"loggers\"", "\"name\"", "\"output_options\"", "\"output\"",
+  "\"debuglevel\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS",
+  "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS",
+  "SUB_DNS_SERVER", "SUB_DNS_SERVERS", "\"constant string\"",
+  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
+  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value",
+  "sub_json", "map2", "$@10", "map_content", "not_empty_map",
+  "list_generic", "$@11", "list_content", "not_empty_list",
+  "unknown_map_entry", "syntax_map", "$@12", "global_objects",
+  "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
+  "dhcpddns_params", "dhcpddns_param", "ip_address", "$@15", "port",
+  "dns_server_timeout", "dns_update_batch_window", "dns_update_batch_size",
+  "ncr_protocol", "$@16", "ncr_protocol_value", "ncr_format", "$@17",
+  "ncr_format_value", "forward_ddns", "$@18", "reverse_ddns", "$@19",
+  "ddns_mgr_params", "not_empty_ddns_mgr_params", "ddns_mgr_param",
+  "ddns_domains", "$@20", "sub_ddns_domains", "$@21", "ddns_domain_list",
   "not_empty_ddns_domain_list", "ddns_domain", "$@22", "sub_ddns_domain",
   "$@23", "ddns_domain_params", "ddns_domain_param", "ddns_domain_name",
   "$@24", "ddns_domain_key_name", "$@25", "dns_servers", "$@26",
   "sub_dns_servers", "$@27", "dns_server_list", "dns_server", "$@28",
   "sub_dns_server", "$@29", "dns_server_params", "dns_server_param",
   "dns_server_hostname", "$@30", "dns_server_ip_address", "$@31",
-  "dns_server_port", "tsig_keys", "$@32", "sub_tsig_keys", "$@33",
-  "tsig_keys_list", "not_empty_tsig_keys_list", "tsig_key", "$@34",
-  "sub_tsig_key", "$@35", "tsig_key_params", "tsig_key_param",
-  "tsig_key_name", "$@36", "tsig_key_algorithm", "$@37",
-  "tsig_key_digest_bits", "tsig_key_secret", "$@38", "dhcp6_json_object",
-  "$@39", "dhcp4_json_object", "$@40", "control_agent_json_object", "$@41",
-  "logging_object", "$@42", "logging_params", "logging_param", "loggers",
-  "$@43", "loggers_entries", "logger_entry", "$@44", "logger_params",
-  "logger_param", "name", "$@45", "debuglevel", "severity", "$@46",
-  "output_options_list", "$@47", "output_options_list_content",
-  "output_entry", "$@48", "output_params_list", "output_params", "output",
-  "$@49", "flush", "maxsize", "maxver", YY_NULLPTR
+  "dns_server_port", "dns_server_protocol", "$@32", "tsig_keys", "$@33",
+  "sub_tsig_keys", "$@34", "tsig_keys_list", "not_empty_tsig_keys_list",
+  "tsig_key", "$@35", "sub_tsig_key", "$@36", "tsig_key_params",
+  "tsig_key_param", "tsig_key_name", "$@37", "tsig_key_algorithm", "$@38",
+  "tsig_key_digest_bits", "tsig_key_secret", "$@39", "dhcp6_json_object",
+  "$@40", "dhcp4_json_object", "$@41", "control_agent_json_object", "$@42",
+  "logging_object", "$@43", "logging_params", "logging_param", "loggers",
+  "$@44", "loggers_entries", "logger_entry", "$@45", "logger_params",
+  "logger_param", "name", "$@46", "debuglevel", "severity", "$@47",
+  "output_options_list", "$@48", "output_options_list_content",
+  "output_entry", "$@49", "output_params_list", "output_params", "output",
+  "$@50", "flush", "maxsize", "maxver", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short int
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   117,   117,   117,   118,   118,   119,   119,   120,   120,
-     121,   121,   122,   122,   123,   123,   124,   124,   125,   125,
-     133,   134,   135,   136,   137,   138,   139,   142,   147,   147,
-     159,   160,   163,   167,   174,   174,   181,   182,   185,   189,
-     200,   210,   210,   222,   223,   227,   228,   229,   230,   231,
-     232,   237,   237,   247,   247,   255,   256,   260,   261,   262,
-     263,   264,   265,   266,   267,   268,   271,   271,   279,   287,
-     296,   296,   304,   305,   308,   308,   316,   316,   326,   326,
-     336,   337,   340,   341,   344,   345,   350,   350,   360,   360,
-     367,   368,   371,   372,   375,   375,   383,   383,   390,   391,
-     394,   395,   396,   397,   401,   401,   413,   413,   425,   425,
-     435,   435,   442,   443,   446,   446,   454,   454,   461,   462,
-     465,   466,   467,   468,   471,   471,   483,   483,   491,   505,
-     505,   515,   515,   522,   523,   526,   527,   530,   530,   538,
-     538,   547,   548,   551,   552,   553,   554,   555,   558,   558,
-     570,   570,   581,   589,   589,   604,   604,   611,   611,   618,
-     618,   630,   630,   643,   644,   648,   652,   652,   664,   665,
-     669,   669,   677,   678,   681,   682,   683,   684,   685,   688,
-     688,   696,   700,   700,   708,   708,   718,   719,   722,   722,
-     730,   731,   734,   735,   736,   737,   740,   740,   748,   753,
-     758
+       0,   122,   122,   122,   123,   123,   124,   124,   125,   125,
+     126,   126,   127,   127,   128,   128,   129,   129,   130,   130,
+     138,   139,   140,   141,   142,   143,   144,   147,   152,   152,
+     164,   165,   168,   172,   179,   179,   186,   187,   190,   194,
+     205,   215,   215,   227,   228,   232,   233,   234,   235,   236,
+     237,   242,   242,   252,   252,   260,   261,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   278,   278,
+     286,   294,   303,   312,   321,   321,   329,   330,   333,   333,
+     341,   342,   345,   345,   355,   355,   365,   366,   369,   370,
+     373,   374,   379,   379,   389,   389,   396,   397,   400,   401,
+     404,   404,   412,   412,   419,   420,   423,   424,   425,   426,
+     430,   430,   442,   442,   454,   454,   464,   464,   471,   472,
+     475,   475,   483,   483,   490,   491,   494,   495,   496,   497,
+     498,   501,   501,   513,   513,   521,   529,   529,   542,   542,
+     552,   552,   559,   560,   563,   564,   567,   567,   575,   575,
+     584,   585,   588,   589,   590,   591,   592,   595,   595,   607,
+     607,   618,   626,   626,   641,   641,   648,   648,   655,   655,
+     667,   667,   680,   681,   685,   689,   689,   701,   702,   706,
+     706,   714,   715,   718,   719,   720,   721,   722,   725,   725,
+     733,   737,   737,   745,   745,   755,   756,   759,   759,   767,
+     768,   771,   772,   773,   774,   777,   777,   785,   790,   795
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -2266,10 +2489,11 @@ namespace isc { namespace d2 {
 #endif // D2_PARSER_DEBUG
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:1167
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2272 "d2_parser.cc" // lalr1.cc:1167
-#line 763 "d2_parser.yy" // lalr1.cc:1168
+#line 2495 "d2_parser.cc"
+
+#line 800 "d2_parser.yy"
 
 
 void
@@ -57,17 +57,21 @@ using namespace std;
   IP_ADDRESS "ip-address"
   PORT "port"
   DNS_SERVER_TIMEOUT "dns-server-timeout"
+  DNS_UPDATE_BATCH_WINDOW "dns-update-batch-window"
+  DNS_UPDATE_BATCH_SIZE "dns-update-batch-size"
   NCR_PROTOCOL "ncr-protocol"
   UDP "UDP"
   TCP "TCP"
   NCR_FORMAT "ncr-format"
   JSON "JSON"
+  BINARY "BINARY"
   FORWARD_DDNS "forward-ddns"
   REVERSE_DDNS "reverse-ddns"
   DDNS_DOMAINS "ddns-domains"
   KEY_NAME "key-name"
   DNS_SERVERS "dns-servers"
   HOSTNAME "hostname"
+  PROTOCOL "protocol"
   TSIG_KEYS "tsig-keys"
   ALGORITHM "algorithm"
   DIGEST_BITS "digest-bits"
@@ -104,6 +108,7 @@ using namespace std;
 
 %type <ElementPtr> value
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 
 %printer { yyoutput << $$; } <*>;
 
@@ -260,6 +265,8 @@ dhcpddns_params: dhcpddns_param
 dhcpddns_param: ip_address
               | port
               | dns_server_timeout
+              | dns_update_batch_window
+              | dns_update_batch_size
               | ncr_protocol
               | ncr_format
               | forward_ddns
@@ -293,6 +300,24 @@ dns_server_timeout: DNS_SERVER_TIMEOUT COLON INTEGER {
     }
 };
 
+dns_update_batch_window: DNS_UPDATE_BATCH_WINDOW COLON INTEGER {
+    if ($3 < 0) {
+        error(@3, "dns-update-batch-window must not be negative");
+    } else {
+        ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+        ctx.stack_.back()->set("dns-update-batch-window", i);
+    }
+};
+
+dns_update_batch_size: DNS_UPDATE_BATCH_SIZE COLON INTEGER {
+    if ($3 <= 0) {
+        error(@3, "dns-update-batch-size must be greater than zero");
+    } else {
+        ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+        ctx.stack_.back()->set("dns-update-batch-size", i);
+    }
+};
+
 ncr_protocol: NCR_PROTOCOL {
     ctx.enter(ctx.NCR_PROTOCOL);
 } COLON ncr_protocol_value {
@@ -307,12 +332,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 forward_ddns : FORWARD_DDNS {
     ElementPtr m(new MapElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("forward-ddns", m);
@@ -465,6 +494,7 @@ dns_server_params: dns_server_param
 dns_server_param: dns_server_hostname
               | dns_server_ip_address
               | dns_server_port
+              | dns_server_protocol
               | unknown_map_entry
               ;
 
@@ -496,6 +526,13 @@ dns_server_port: PORT COLON INTEGER {
     ctx.stack_.back()->set("port", i);
 };
 
+dns_server_protocol: PROTOCOL {
+    ctx.enter(ctx.NCR_PROTOCOL);
+} COLON ncr_protocol_value {
+    ctx.stack_.back()->set("protocol", $4);
+    ctx.leave();
+};
+
 // --- end of dns-servers ---------------------------------
 
 
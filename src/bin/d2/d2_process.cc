@@ -131,7 +131,7 @@ D2Process::canShutdown() const {
             // process all of the requests in the receive queue first.
             all_clear = (((queue_mgr_->getMgrState() != D2QueueMgr::RUNNING) &&
                           (queue_mgr_->getMgrState() != D2QueueMgr::STOPPING))
-                          && (queue_mgr_->getQueueSize() == 0)
+                          && (update_mgr_->getQueueCount() == 0)
                           && (update_mgr_->getTransactionCount() == 0));
             break;
 
@@ -342,8 +342,11 @@ D2Process::reconfigureQueueMgr() {
             queue_mgr_->initUDPListener(d2_params->getIpAddress(),
                                         d2_params->getPort(),
                                         d2_params->getNcrFormat(), true);
+        } else if (d2_params->getNcrProtocol() == dhcp_ddns::NCR_TCP) {
+            queue_mgr_->initTCPListener(d2_params->getIpAddress(),
+                                        d2_params->getPort(),
+                                        d2_params->getNcrFormat(), true);
         } else {
-            /// @todo Add TCP/IP once it's supported
             // We should never get this far but if we do deal with it.
             isc_throw(DProcessBaseError, "Unsupported NCR listener protocol:"
                       << dhcp_ddns::ncrProtocolToString(d2_params->
@@ -7,6 +7,7 @@
 #include <config.h>
 #include <d2/d2_log.h>
 #include <d2/d2_queue_mgr.h>
+#include <dhcp_ddns/ncr_tcp.h>
 #include <dhcp_ddns/ncr_udp.h>
 
 namespace isc {
@@ -114,6 +115,25 @@ D2QueueMgr::initUDPListener(const isc::asiolink::IOAddress& ip_address,
     mgr_state_ = INITTED;
 }
 
+void
+D2QueueMgr::initTCPListener(const isc::asiolink::IOAddress& ip_address,
+                            const uint32_t port,
+                            const dhcp_ddns::NameChangeFormat format,
+                            const bool reuse_address) {
+
+    if (listener_) {
+        isc_throw(D2QueueMgrError,
+                  "D2QueueMgr listener is already initialized");
+    }
+
+    // Instantiate a TCP listener and set state to INITTED.
+    // Note TCP listener constructor does not throw.
+    listener_.reset(new dhcp_ddns::
+                    NameChangeTCPListener(ip_address, port, format, *this,
+                                          reuse_address));
+    mgr_state_ = INITTED;
+}
+
 void
 D2QueueMgr::startListening() {
     // We can't listen if we haven't initialized the listener yet.
@@ -88,11 +88,10 @@ public:
 ///
 ///     * INITTED - The listener has been initialized, but it is not open for
 ///     listening.   To move from NOT_INITTED to INITTED, one of the D2QueueMgr
-///     listener initialization methods must be invoked.  Currently there is
-///     only one type of listener, NameChangeUDPListener, hence there is only
-///     one listener initialization method, initUDPListener.  As more listener
-///     types are created, listener initialization methods will need to be
-///     added.
+///     listener initialization methods must be invoked: initUDPListener
+///     for the NameChangeUDPListener or initTCPListener for the
+///     NameChangeTCPListener.  As more listener types are created, listener
+///     initialization methods will need to be added.
 ///
 ///     * RUNNING - The listener is open and listening for requests.
 ///     Once initialized, in order to begin listening for requests, the
@@ -181,6 +180,22 @@ public:
                          const dhcp_ddns::NameChangeFormat format,
                          const bool reuse_address = false);
 
+    /// @brief Initializes the listener as a TCP listener.
+    ///
+    /// Instantiates the listener_ member as NameChangeTCPListener passing
+    /// the given parameters.  Upon successful completion, the D2QueueMgr state
+    /// will be INITTED.
+    ///
+    /// @param ip_address is the network address on which to listen
+    /// @param port is the IP port on which to listen
+    /// @param format is the wire format of the inbound requests.
+    /// @param reuse_address enables IP address sharing when true
+    /// It defaults to false.
+    void initTCPListener(const isc::asiolink::IOAddress& ip_address,
+                         const uint32_t port,
+                         const dhcp_ddns::NameChangeFormat format,
+                         const bool reuse_address = false);
+
     /// @brief Starts actively listening for requests.
     ///
     /// Invokes the listener's startListening method passing in our
@@ -38,7 +38,9 @@ const SimpleDefaults D2SimpleParser::D2_GLOBAL_DEFAULTS = {
     { "port",               Element::integer, "53001" },
     { "dns-server-timeout", Element::integer, "100" }, // in seconds
     { "ncr-protocol",       Element::string, "UDP" },
-    { "ncr-format",         Element::string, "JSON" }
+    { "ncr-format",         Element::string, "JSON" },
+    { "dns-update-batch-window", Element::integer, "0" }, // in milliseconds
+    { "dns-update-batch-size", Element::integer, "16" }
 };
 
 /// Supplies defaults for ddns-domains list elements (i.e. DdnsDomains)
@@ -64,6 +66,7 @@ const SimpleDefaults D2SimpleParser::DDNS_DOMAIN_DEFAULTS = {
 const SimpleDefaults D2SimpleParser::DNS_SERVER_DEFAULTS = {
     { "hostname", Element::string, "" },
     { "port",     Element::integer, "53" },
+    { "protocol", Element::string, "UDP" },
 };
 
 /// @}
@@ -0,0 +1,390 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_log.h>
+#include <d2/d2_update_batcher.h>
+#include <dns/rcode.h>
+#include <util/random/qid_gen.h>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/bind.hpp>
+#include <sstream>
+
+using namespace isc::util::random;
+
+namespace isc {
+namespace d2 {
+
+// *********************** D2UpdateBatch  *************************
+
+D2UpdateBatch::D2UpdateBatch(D2UpdateBatcher& batcher,
+                             asiolink::IOService& io_service,
+                             const std::string& key,
+                             const asiolink::IOAddress& ns_addr,
+                             const uint16_t ns_port, const D2Zone& zone,
+                             const unsigned int wait,
+                             const dns::TSIGKeyPtr& tsig_key,
+                             const DNSClient::Protocol proto)
+    : batcher_(batcher), key_(key), ns_addr_(ns_addr), ns_port_(ns_port),
+      zone_name_(zone.getName()), zone_class_(zone.getClass()), wait_(wait),
+      tsig_key_(tsig_key), proto_(proto), members_(), names_(), request_(), response_(),
+      client_(), timer_(io_service) {
+}
+
+D2UpdateBatch::~D2UpdateBatch() {
+}
+
+void
+D2UpdateBatch::operator()(DNSClient::Status status) {
+    batcher_.batchCompleted(*this, status);
+}
+
+bool
+D2UpdateBatch::conflicts(const D2UpdateMessage& request) const {
+    const D2UpdateMessage::UpdateMsgSection sections[] = {
+        D2UpdateMessage::SECTION_PREREQUISITE,
+        D2UpdateMessage::SECTION_UPDATE
+    };
+    for (int i = 0; i < 2; ++i) {
+        for (dns::RRsetIterator it = request.beginSection(sections[i]);
+             it != request.endSection(sections[i]); ++it) {
+            if (names_.count((*it)->getName()) > 0) {
+                return (true);
+            }
+        }
+    }
+    return (false);
+}
+
+void
+D2UpdateBatch::addMember(const D2BatchMember& member) {
+    const D2UpdateMessage::UpdateMsgSection sections[] = {
+        D2UpdateMessage::SECTION_PREREQUISITE,
+        D2UpdateMessage::SECTION_UPDATE
+    };
+    for (int i = 0; i < 2; ++i) {
+        for (dns::RRsetIterator it = member.request_->beginSection(sections[i]);
+             it != member.request_->endSection(sections[i]); ++it) {
+            names_.insert((*it)->getName());
+        }
+    }
+    members_.push_back(member);
+}
+
+bool
+D2UpdateBatch::removeMember(DNSClient::Callback* callback) {
+    for (MemberList::iterator it = members_.begin(); it != members_.end();
+         ++it) {
+        if (it->callback_ == callback) {
+            // The names are left in place: they only prevent merging other
+            // requests for them until the batch is sent.
+            members_.erase(it);
+            return (true);
+        }
+    }
+    return (false);
+}
+
+D2UpdateMessagePtr
+D2UpdateBatch::buildRequest() const {
+    D2UpdateMessagePtr request(new D2UpdateMessage(D2UpdateMessage::OUTBOUND));
+    request->setId(QidGenerator::getInstance().generateQid());
+    request->setZone(zone_name_, zone_class_);
+
+    // All prerequisites go first, in the order the members were added.
+    // Their owner names are disjoint, so each member's prerequisites are
+    // evaluated as if its request was sent alone.
+    const D2UpdateMessage::UpdateMsgSection sections[] = {
+        D2UpdateMessage::SECTION_PREREQUISITE,
+        D2UpdateMessage::SECTION_UPDATE
+    };
+    for (int i = 0; i < 2; ++i) {
+        for (MemberList::const_iterator member = members_.begin();
+             member != members_.end(); ++member) {
+            const D2UpdateMessagePtr& source = member->request_;
+            for (dns::RRsetIterator it = source->beginSection(sections[i]);
+                 it != source->endSection(sections[i]); ++it) {
+                request->addRRset(sections[i], *it);
+            }
+        }
+    }
+
+    return (request);
+}
+
+void
+D2UpdateBatch::send(asiolink::IOService& io_service) {
+    request_ = buildRequest();
+    response_.reset();
+    client_.reset(new DNSClient(response_, this, proto_,
+                                batcher_.getTCPPool()));
+    client_->doUpdate(io_service, ns_addr_, ns_port_, *request_, wait_,
+                      tsig_key_);
+}
+
+// *********************** D2UpdateBatcher  *************************
+
+D2UpdateBatcher::D2UpdateBatcher(const asiolink::IOServicePtr& io_service,
+                                 const size_t window, const size_t max_size,
+                                 const DNSTCPConnectionPoolPtr& tcp_pool)
+    : io_service_(io_service), window_(window), max_size_(max_size),
+      tcp_pool_(tcp_pool), collecting_(), in_flight_() {
+    if (!io_service_) {
+        isc_throw(D2UpdateBatcherError, "IOServicePtr cannot be null");
+    }
+
+    if (window_ == 0) {
+        isc_throw(D2UpdateBatcherError, "batch window must be greater than 0");
+    }
+
+    if (max_size_ == 0) {
+        isc_throw(D2UpdateBatcherError, "batch size must be greater than 0");
+    }
+}
+
+D2UpdateBatcher::~D2UpdateBatcher() {
+    for (BatchMap::iterator it = collecting_.begin(); it != collecting_.end();
+         ++it) {
+        it->second->getTimer().cancel();
+    }
+}
+
+std::string
+D2UpdateBatcher::makeKey(const asiolink::IOAddress& ns_addr,
+                         const uint16_t ns_port, const D2Zone& zone,
+                         const dns::TSIGKeyPtr& tsig_key,
+                         const DNSClient::Protocol proto) {
+    std::ostringstream key;
+    key << ns_addr.toText() << "#" << ns_port << "/"
+        << boost::algorithm::to_lower_copy(zone.getName().toText()) << "/"
+        << zone.getClass().toText();
+    if (tsig_key) {
+        key << "/" << tsig_key->getKeyName().toText();
+    }
+    if (proto == DNSClient::TCP) {
+        key << "/tcp";
+    }
+    return (key.str());
+}
+
+void
+D2UpdateBatcher::submit(const DNSClientPtr& client,
+                        D2UpdateMessagePtr& response,
+                        DNSClient::Callback* callback,
+                        const asiolink::IOAddress& ns_addr,
+                        const uint16_t ns_port,
+                        const D2UpdateMessagePtr& request,
+                        const unsigned int wait,
+                        const dns::TSIGKeyPtr& tsig_key,
+                        const DNSClient::Protocol proto) {
+    D2BatchMember member(client, response, callback, ns_addr, ns_port,
+                         request, wait, tsig_key);
+
+    D2ZonePtr zone = request->getZone();
+    if (!zone || (max_size_ == 1)) {
+        // Nothing to merge it with.
+        sendMember(member);
+        return;
+    }
+
+    const std::string key = makeKey(ns_addr, ns_port, *zone, tsig_key, proto);
+    BatchMap::iterator it = collecting_.find(key);
+    if ((it != collecting_.end()) && it->second->conflicts(*request)) {
+        // The request must not share the message with another request for
+        // the same name, so send what was collected so far.
+        dispatch(it);
+        it = collecting_.end();
+    }
+
+    if (it == collecting_.end()) {
+        D2UpdateBatchPtr batch(new D2UpdateBatch(*this, *io_service_, key,
+                                                 ns_addr, ns_port, *zone,
+                                                 wait, tsig_key, proto));
+        it = collecting_.insert(std::make_pair(key, batch)).first;
+        batch->getTimer().setup(boost::bind(&D2UpdateBatcher::windowExpired,
+                                            this, key),
+                                window_, asiolink::IntervalTimer::ONE_SHOT);
+    }
+
+    it->second->addMember(member);
+    if (it->second->getMembers().size() >= max_size_) {
+        dispatch(it);
+    }
+}
+
+void
+D2UpdateBatcher::cancel(DNSClient::Callback* callback) {
+    for (BatchMap::iterator it = collecting_.begin(); it != collecting_.end();
+         ++it) {
+        if (it->second->removeMember(callback)) {
+            if (it->second->getMembers().empty()) {
+                it->second->getTimer().cancel();
+                collecting_.erase(it);
+            }
+            return;
+        }
+    }
+
+    // A batch in flight stays there until its exchange completes, as it is
+    // the callback of its DNSClient.
+    for (std::set<D2UpdateBatchPtr>::iterator it = in_flight_.begin();
+         it != in_flight_.end(); ++it) {
+        if ((*it)->removeMember(callback)) {
+            return;
+        }
+    }
+}
+
+void
+D2UpdateBatcher::flush() {
+    while (!collecting_.empty()) {
+        dispatch(collecting_.begin());
+    }
+}
+
+size_t
+D2UpdateBatcher::getQueuedCount() const {
+    size_t count = 0;
+    for (BatchMap::const_iterator it = collecting_.begin();
+         it != collecting_.end(); ++it) {
+        count += it->second->getMembers().size();
+    }
+    return (count);
+}
+
+void
+D2UpdateBatcher::windowExpired(const std::string& key) {
+    BatchMap::iterator it = collecting_.find(key);
+    if (it != collecting_.end()) {
+        dispatch(it);
+    }
+}
+
+void
+D2UpdateBatcher::dispatch(BatchMap::iterator it) {
+    D2UpdateBatchPtr batch = it->second;
+    batch->getTimer().cancel();
+    collecting_.erase(it);
+    sendBatch(batch);
+}
+
+void
+D2UpdateBatcher::sendBatch(const D2UpdateBatchPtr& batch) {
+    D2UpdateBatch::MemberList& members = batch->getMembers();
+    if (members.size() == 1) {
+        try {
+            sendMember(members.front());
+        } catch (const std::exception& ex) {
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_UPDATE_BATCH_SEND_ERROR)
+                .arg(batch->getKey()).arg(ex.what());
+            in_flight_.insert(batch);
+            io_service_->post(boost::bind(&D2UpdateBatcher::completeMembers,
+                                          this, batch, DNSClient::OTHER));
+        }
+        return;
+    }
+
+    in_flight_.insert(batch);
+    try {
+        sendMerged(batch);
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_UPDATE_BATCH_SENT)
+            .arg(batch->getKey()).arg(members.size());
+    } catch (const std::exception& ex) {
+        // The members are not completed right away, as they may be still
+        // submitting their requests.
+        LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_UPDATE_BATCH_SEND_ERROR)
+            .arg(batch->getKey()).arg(ex.what());
+        io_service_->post(boost::bind(&D2UpdateBatcher::completeMembers,
+                                      this, batch, DNSClient::OTHER));
+    }
+}
+
+void
+D2UpdateBatcher::sendMerged(const D2UpdateBatchPtr& batch) {
+    batch->send(*io_service_);
+}
+
+void
+D2UpdateBatcher::sendMember(const D2BatchMember& member) {
+    member.client_->doUpdate(*io_service_, member.ns_addr_, member.ns_port_,
+                             *member.request_, member.wait_,
+                             member.tsig_key_);
+}
+
+void
+D2UpdateBatcher::batchCompleted(D2UpdateBatch& batch,
+                                DNSClient::Status status) {
+    D2UpdateBatchPtr completed;
+    for (std::set<D2UpdateBatchPtr>::iterator it = in_flight_.begin();
+         it != in_flight_.end(); ++it) {
+        if (it->get() == &batch) {
+            completed = *it;
+            break;
+        }
+    }
+    if (!completed) {
+        return;
+    }
+
+    const D2UpdateMessagePtr& response = completed->getResponse();
+    if ((status == DNSClient::SUCCESS) && response) {
+        const dns::Rcode& rcode = response->getRcode();
+        if ((rcode == dns::Rcode::YXDOMAIN()) ||
+            (rcode == dns::Rcode::YXRRSET()) ||
+            (rcode == dns::Rcode::NXDOMAIN()) ||
+            (rcode == dns::Rcode::NXRRSET()) ||
+            (rcode == dns::Rcode::NOTZONE())) {
+            // Some prerequisite failed and nothing was updated. The response
+            // code cannot be attributed to any of the requests, so each is
+            // sent alone to get its own.
+            LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                      DHCP_DDNS_UPDATE_BATCH_SPLIT)
+                .arg(completed->getKey())
+                .arg(rcode.toText())
+                .arg(completed->getMembers().size());
+            resendMembers(completed);
+            return;
+        }
+    }
+
+    completeMembers(completed, status);
+}
+
+void
+D2UpdateBatcher::resendMembers(const D2UpdateBatchPtr& batch) {
+    D2UpdateBatch::MemberList& members = batch->getMembers();
+    while (!members.empty()) {
+        D2BatchMember member = members.front();
+        members.pop_front();
+        try {
+            sendMember(member);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_UPDATE_BATCH_SEND_ERROR)
+                .arg(batch->getKey()).arg(ex.what());
+            (*member.callback_)(DNSClient::OTHER);
+        }
+    }
+    in_flight_.erase(batch);
+}
+
+void
+D2UpdateBatcher::completeMembers(const D2UpdateBatchPtr& batch,
+                                 DNSClient::Status status) {
+    D2UpdateBatch::MemberList& members = batch->getMembers();
+    while (!members.empty()) {
+        D2BatchMember member = members.front();
+        members.pop_front();
+        *member.response_ = batch->getResponse();
+        (*member.callback_)(status);
+    }
+    in_flight_.erase(batch);
+}
+
+} // namespace isc::d2
+} // namespace isc
@@ -0,0 +1,476 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef D2_UPDATE_BATCHER_H
+#define D2_UPDATE_BATCHER_H
+
+/// @file d2_update_batcher.h This file defines the class D2UpdateBatcher.
+
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <d2/d2_update_message.h>
+#include <d2/dns_client.h>
+#include <dns/name.h>
+#include <dns/tsig.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+#include <list>
+#include <set>
+#include <string>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Thrown if the update batcher encounters a general error.
+class D2UpdateBatcherError : public isc::Exception {
+public:
+    D2UpdateBatcherError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+class D2UpdateBatcher;
+
+/// @brief Single DNS update request waiting to be sent within a batch.
+struct D2BatchMember {
+    /// @brief Constructor
+    ///
+    /// @param client DNSClient of the transaction.
+    /// @param response placeholder for the response of the transaction.
+    /// @param callback callback of the transaction.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param request request of the transaction.
+    /// @param wait timeout (in milliseconds) for the response.
+    /// @param tsig_key TSIG key used to sign the request, may be null.
+    D2BatchMember(const DNSClientPtr& client, D2UpdateMessagePtr& response,
+                  DNSClient::Callback* callback,
+                  const asiolink::IOAddress& ns_addr, const uint16_t ns_port,
+                  const D2UpdateMessagePtr& request, const unsigned int wait,
+                  const dns::TSIGKeyPtr& tsig_key)
+        : client_(client), response_(&response), callback_(callback),
+          ns_addr_(ns_addr), ns_port_(ns_port), request_(request),
+          wait_(wait), tsig_key_(tsig_key) {
+    }
+
+    /// @brief DNSClient of the transaction, used to send the request alone.
+    DNSClientPtr client_;
+
+    /// @brief Placeholder for the response of the transaction.
+    D2UpdateMessagePtr* response_;
+
+    /// @brief Callback of the transaction.
+    DNSClient::Callback* callback_;
+
+    /// @brief DNS server address.
+    asiolink::IOAddress ns_addr_;
+
+    /// @brief DNS server port.
+    uint16_t ns_port_;
+
+    /// @brief Request of the transaction.
+    D2UpdateMessagePtr request_;
+
+    /// @brief Timeout for the response in milliseconds.
+    unsigned int wait_;
+
+    /// @brief TSIG key used to sign the request.
+    dns::TSIGKeyPtr tsig_key_;
+};
+
+/// @brief Collects the DNS update requests for the same zone and server
+/// and sends them as a single update message.
+///
+/// The batch is the @c DNSClient callback of the merged update message.
+/// It does not process the response itself but hands it over to the
+/// @c D2UpdateBatcher which created it.
+class D2UpdateBatch : public DNSClient::Callback, public boost::noncopyable {
+public:
+    /// @brief List of the members of the batch.
+    typedef std::list<D2BatchMember> MemberList;
+
+    /// @brief Constructor
+    ///
+    /// @param batcher batcher to which the response is handed over.
+    /// @param io_service IO service used by the batch's timer.
+    /// @param key key of the batch, see @c D2UpdateBatcher::makeKey.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param zone zone to update.
+    /// @param wait timeout (in milliseconds) for the response.
+    /// @param tsig_key TSIG key used to sign the update, may be null.
+    /// @param proto transport protocol used to send the update.
+    D2UpdateBatch(D2UpdateBatcher& batcher, asiolink::IOService& io_service,
+                  const std::string& key,
+                  const asiolink::IOAddress& ns_addr, const uint16_t ns_port,
+                  const D2Zone& zone, const unsigned int wait,
+                  const dns::TSIGKeyPtr& tsig_key,
+                  const DNSClient::Protocol proto = DNSClient::UDP);
+
+    /// @brief Destructor
+    virtual ~D2UpdateBatch();
+
+    /// @brief Serves as the DNSClient IO completion event handler.
+    ///
+    /// @param status is the outcome of the DNS update packet exchange.
+    virtual void operator()(DNSClient::Status status);
+
+    /// @brief Checks if the request updates a name used by the batch.
+    ///
+    /// The prerequisites of all the requests of an update message are
+    /// checked before any of the updates is applied, so the requests
+    /// touching the same owner name cannot share the message.
+    ///
+    /// @param request request to check.
+    ///
+    /// @return true if any of the owner names of the request's
+    /// prerequisites or updates is used by the batch.
+    bool conflicts(const D2UpdateMessage& request) const;
+
+    /// @brief Adds the member to the batch.
+    ///
+    /// @param member member to add.
+    void addMember(const D2BatchMember& member);
+
+    /// @brief Removes the member with the given callback from the batch.
+    ///
+    /// @param callback callback of the member.
+    ///
+    /// @return true if the member was found.
+    bool removeMember(DNSClient::Callback* callback);
+
+    /// @brief Builds the update message merging the members' requests.
+    ///
+    /// The message has the zone of the batch, then the prerequisites and
+    /// the updates of all members in the order they were added.
+    ///
+    /// @return pointer to the new update message.
+    D2UpdateMessagePtr buildRequest() const;
+
+    /// @brief Returns the key of the batch.
+    const std::string& getKey() const {
+        return (key_);
+    }
+
+    /// @brief Returns the members of the batch.
+    MemberList& getMembers() {
+        return (members_);
+    }
+
+    /// @brief Returns the DNS server address.
+    const asiolink::IOAddress& getServerAddress() const {
+        return (ns_addr_);
+    }
+
+    /// @brief Returns the DNS server port.
+    uint16_t getServerPort() const {
+        return (ns_port_);
+    }
+
+    /// @brief Returns the timeout for the response in milliseconds.
+    unsigned int getWait() const {
+        return (wait_);
+    }
+
+    /// @brief Returns the TSIG key.
+    const dns::TSIGKeyPtr& getTSIGKey() const {
+        return (tsig_key_);
+    }
+
+    /// @brief Returns the merged update message once the batch was sent.
+    const D2UpdateMessagePtr& getRequest() const {
+        return (request_);
+    }
+
+    /// @brief Returns the response to the merged update message.
+    D2UpdateMessagePtr& getResponse() {
+        return (response_);
+    }
+
+    /// @brief Returns the timer which sends the batch.
+    asiolink::IntervalTimer& getTimer() {
+        return (timer_);
+    }
+
+    /// @brief Sends the merged update message to the server.
+    ///
+    /// @param io_service IO service to be used to run the message exchange.
+    ///
+    /// @throw any exception thrown by the @c DNSClient.
+    void send(asiolink::IOService& io_service);
+
+private:
+    /// @brief Batcher to which the response is handed over.
+    D2UpdateBatcher& batcher_;
+
+    /// @brief Key of the batch.
+    std::string key_;
+
+    /// @brief DNS server address.
+    asiolink::IOAddress ns_addr_;
+
+    /// @brief DNS server port.
+    uint16_t ns_port_;
+
+    /// @brief Name of the zone to update.
+    dns::Name zone_name_;
+
+    /// @brief Class of the zone to update.
+    dns::RRClass zone_class_;
+
+    /// @brief Timeout for the response in milliseconds.
+    unsigned int wait_;
+
+    /// @brief TSIG key used to sign the update.
+    dns::TSIGKeyPtr tsig_key_;
+
+    /// @brief Transport protocol used to send the update.
+    DNSClient::Protocol proto_;
+
+    /// @brief Members of the batch.
+    MemberList members_;
+
+    /// @brief Owner names used by the members.
+    std::set<dns::Name> names_;
+
+    /// @brief Merged update message.
+    D2UpdateMessagePtr request_;
+
+    /// @brief Response to the merged update message.
+    D2UpdateMessagePtr response_;
+
+    /// @brief DNSClient which sends the merged update message.
+    DNSClientPtr client_;
+
+    /// @brief Timer which sends the batch when its window ends.
+    asiolink::IntervalTimer timer_;
+};
+
+/// @brief Defines a pointer to a D2UpdateBatch instance.
+typedef boost::shared_ptr<D2UpdateBatch> D2UpdateBatchPtr;
+
+/// @brief D2UpdateBatcher coalesces the DNS updates for the same zone.
+///
+/// When many transactions are in progress, e.g. during renumbering, most
+/// of them update the same few zones on the same primary servers, each
+/// sending a separate update message for a single name and waiting for
+/// the response. When the batching is enabled, the transactions submit
+/// their requests to the batcher instead of sending them. The requests
+/// for the same server, zone and TSIG key submitted within a short window
+/// are merged into a single update message, so the server applies all of
+/// them in one update and a single response completes all transactions.
+///
+/// The prerequisites of the merged message are checked together and if
+/// any of them is not satisfied none of the updates is applied. Because
+/// the prerequisites tell a transaction what to do next, e.g. an add
+/// which finds the name in use proceeds to replace it, a single response
+/// code cannot be attributed to the individual requests. Therefore, when
+/// the merged message fails on a prerequisite (YXDOMAIN, YXRRSET, NXDOMAIN,
+/// NXRRSET or NOTZONE), each request is sent again alone using the
+/// transaction's own @c DNSClient and the transaction receives the response
+/// to its own request. The requests touching the same owner name are never
+/// merged into the same message, so the prerequisites of each request are
+/// evaluated against the zone contents as if it was sent alone. Any other
+/// outcome, i.e. success, an error response or an IO failure, applies to
+/// all requests of the message and is delivered to each transaction.
+///
+/// A transaction gets exactly one completion callback per submitted request,
+/// just as if it had sent the request itself. A transaction destroyed
+/// before its request completes must cancel it.
+class D2UpdateBatcher : public boost::noncopyable {
+public:
+    /// @brief Constructor
+    ///
+    /// @param io_service IO service used to send the update messages.
+    /// @param window time in milliseconds during which the requests are
+    /// collected before they are sent.
+    /// @param max_size maximum number of requests in a batch. The batch
+    /// is sent as soon as it is full.
+    /// @param tcp_pool pool of the TCP connections used to send the batches
+    /// to the servers configured to use TCP. If it is null, each batch
+    /// opens its own connection.
+    ///
+    /// @throw D2UpdateBatcherError if the IO service is null or if either the
+    /// window or the maximum size is 0.
+    D2UpdateBatcher(const asiolink::IOServicePtr& io_service,
+                    const size_t window, const size_t max_size,
+                    const DNSTCPConnectionPoolPtr& tcp_pool =
+                    DNSTCPConnectionPoolPtr());
+
+    /// @brief Destructor
+    virtual ~D2UpdateBatcher();
+
+    /// @brief Submits the request to be sent within a batch.
+    ///
+    /// The arguments are those of @c DNSClient::doUpdate, plus the
+    /// transaction's @c DNSClient and the response placeholder and callback
+    /// it was created with. The callback is invoked when the request
+    /// completes, and never from within this method.
+    ///
+    /// @param client DNSClient of the transaction.
+    /// @param response placeholder for the response.
+    /// @param callback callback to invoke when the request completes.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param request DNS update request.
+    /// @param wait timeout (in milliseconds) for the response.
+    /// @param tsig_key TSIG key used to sign the request, may be null.
+    /// @param proto transport protocol of the server. Only the requests
+    /// using the same protocol are merged.
+    ///
+    /// @throw any exception thrown by the @c DNSClient when the request
+    /// is sent alone.
+    void submit(const DNSClientPtr& client, D2UpdateMessagePtr& response,
+                DNSClient::Callback* callback,
+                const asiolink::IOAddress& ns_addr, const uint16_t ns_port,
+                const D2UpdateMessagePtr& request, const unsigned int wait,
+                const dns::TSIGKeyPtr& tsig_key,
+                const DNSClient::Protocol proto = DNSClient::UDP);
+
+    /// @brief Cancels the request submitted with the given callback.
+    ///
+    /// The callback will not be invoked for the request. Cancelling a
+    /// request which was already completed has no effect.
+    ///
+    /// @param callback callback of the request.
+    void cancel(DNSClient::Callback* callback);
+
+    /// @brief Sends all batches collecting the requests immediately.
+    void flush();
+
+    /// @brief Returns the window in milliseconds.
+    size_t getWindow() const {
+        return (window_);
+    }
+
+    /// @brief Returns the maximum number of requests in a batch.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+    /// @brief Returns the pool of the TCP connections, may be null.
+    const DNSTCPConnectionPoolPtr& getTCPPool() const {
+        return (tcp_pool_);
+    }
+
+    /// @brief Returns the number of requests waiting to be sent.
+    size_t getQueuedCount() const;
+
+    /// @brief Returns the number of batches sent and waiting for the
+    /// response.
+    size_t getInFlightCount() const {
+        return (in_flight_.size());
+    }
+
+    /// @brief Builds the key of the batch to which the request belongs.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param zone zone of the request.
+    /// @param tsig_key TSIG key used to sign the request, may be null.
+    /// @param proto transport protocol of the server.
+    ///
+    /// @return key of the batch.
+    static std::string makeKey(const asiolink::IOAddress& ns_addr,
+                               const uint16_t ns_port, const D2Zone& zone,
+                               const dns::TSIGKeyPtr& tsig_key,
+                               const DNSClient::Protocol proto =
+                               DNSClient::UDP);
+
+    /// @brief Processes the outcome of the batch.
+    ///
+    /// Called by the batch when its update message exchange completes.
+    ///
+    /// @param batch batch which completed.
+    /// @param status outcome of the update message exchange.
+    void batchCompleted(D2UpdateBatch& batch, DNSClient::Status status);
+
+protected:
+    /// @brief Sends the update message merging the batch's requests.
+    ///
+    /// @param batch batch to send.
+    ///
+    /// @throw any exception thrown by the @c DNSClient.
+    virtual void sendMerged(const D2UpdateBatchPtr& batch);
+
+    /// @brief Sends the member's request alone.
+    ///
+    /// @param member member to send.
+    ///
+    /// @throw any exception thrown by the @c DNSClient.
+    virtual void sendMember(const D2BatchMember& member);
+
+private:
+    /// @brief Map of the batches collecting the requests, by key.
+    typedef boost::unordered_map<std::string, D2UpdateBatchPtr> BatchMap;
+
+    /// @brief Sends the batch collecting the requests under the key.
+    ///
+    /// @param key key of the batch.
+    void windowExpired(const std::string& key);
+
+    /// @brief Removes the batch from the collecting batches and sends it.
+    ///
+    /// @param it position of the batch.
+    void dispatch(BatchMap::iterator it);
+
+    /// @brief Sends the batch.
+    ///
+    /// Invoked when the window of the batch ends or the batch is full.
+    /// A batch with a single member is sent as that member's own request.
+    /// If the batch cannot be sent, its members are completed with
+    /// @c DNSClient::OTHER status from the IO service.
+    ///
+    /// @param batch batch to send.
+    void sendBatch(const D2UpdateBatchPtr& batch);
+
+    /// @brief Sends the members' requests alone.
+    ///
+    /// A member which cannot be sent is completed with @c DNSClient::OTHER
+    /// status.
+    ///
+    /// @param batch batch which members are to be sent.
+    void resendMembers(const D2UpdateBatchPtr& batch);
+
+    /// @brief Completes all members of the batch.
+    ///
+    /// The batch is kept in flight until all members are completed, so
+    /// the members cancelled meanwhile are not completed.
+    ///
+    /// @param batch batch which members are to be completed.
+    /// @param status status passed to the members' callbacks.
+    void completeMembers(const D2UpdateBatchPtr& batch,
+                         DNSClient::Status status);
+
+    /// @brief IO service used to send the update messages.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Time in milliseconds during which requests are collected.
+    size_t window_;
+
+    /// @brief Maximum number of requests in a batch.
+    size_t max_size_;
+
+    /// @brief Pool of the TCP connections to the servers, may be null.
+    DNSTCPConnectionPoolPtr tcp_pool_;
+
+    /// @brief Batches collecting the requests.
+    BatchMap collecting_;
+
+    /// @brief Batches sent and waiting for the response.
+    std::set<D2UpdateBatchPtr> in_flight_;
+};
+
+/// @brief Defines a pointer to a D2UpdateBatcher instance.
+typedef boost::shared_ptr<D2UpdateBatcher> D2UpdateBatcherPtr;
+
+} // namespace isc::d2
+} // namespace isc
+
+#endif
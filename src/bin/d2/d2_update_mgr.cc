@@ -10,6 +10,8 @@
 #include <d2/nc_add.h>
 #include <d2/nc_remove.h>
 
+#include <boost/bind.hpp>
+
 #include <sstream>
 #include <iostream>
 #include <vector>
@@ -22,7 +24,9 @@ const size_t D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT;
 D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                          asiolink::IOServicePtr& io_service,
                          const size_t max_transactions)
-    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service) {
+    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service),
+    blocked_count_(0), update_batcher_(),
+    tcp_pool_(new DNSTCPConnectionPool()) {
     if (!queue_mgr_) {
         isc_throw(D2UpdateMgrError, "D2UpdateMgr queue manager cannot be null");
     }
@@ -41,78 +45,122 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
 }
 
 D2UpdateMgr::~D2UpdateMgr() {
-    transaction_list_.clear();
+    clearTransactionList();
 }
 
 void D2UpdateMgr::sweep() {
     // cleanup finished transactions;
     checkFinishedTransactions();
 
-    // if the queue isn't empty, find the next suitable job and
-    // start a transaction for it.
-    // @todo - Do we want to queue max transactions? The logic here will only
-    // start one new transaction per invocation.  On the other hand a busy
-    // system will generate many IO events and this method will be called
-    // frequently.  It will likely achieve max transactions quickly on its own.
-    if (getQueueCount() > 0)  {
-        if (getTransactionCount() >= max_transactions_) {
-            LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
-                      DHCP_DDNS_AT_MAX_TRANSACTIONS).arg(getQueueCount())
-                      .arg(getMaxTransactions());
-
+    // Fill all of the free transaction slots with eligible jobs.
+    while (getTransactionCount() < max_transactions_) {
+        if (!pickNextJob()) {
             return;
         }
+    }
 
-        // We are not at maximum transactions, so pick and start the next job.
-        pickNextJob();
+    if (getQueueCount() > 0) {
+        LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                  DHCP_DDNS_AT_MAX_TRANSACTIONS).arg(getQueueCount())
+                  .arg(getMaxTransactions());
     }
 }
 
 void
 D2UpdateMgr::checkFinishedTransactions() {
-    // Cycle through transaction list and do whatever needs to be done
-    // for finished transactions.
-    // At the moment all we do is remove them from the list. This is likely
-    // to expand as DHCP_DDNS matures.
-    // NOTE: One must use postfix increments of the iterator on the calls
-    // to erase.  This replaces the old iterator which becomes invalid by the
-    // erase with a the next valid iterator.  Prefix incrementing will not
-    // work.
-    TransactionList::iterator it = transaction_list_.begin();
-    while (it != transaction_list_.end()) {
-        NameChangeTransactionPtr trans = (*it).second;
-        if (trans->isModelDone()) {
-            // @todo  Additional actions based on NCR status could be
-            // performed here.
-            transaction_list_.erase(it++);
-        } else {
-            ++it;
+    // Go through the transactions which have notified their completion
+    // and do whatever needs to be done for them.
+    // At the moment all we do is remove them from the list and release
+    // the requests waiting for them. This is likely to expand as
+    // DHCP_DDNS matures.
+    std::vector<TransactionKey> finished;
+    finished.swap(finished_transactions_);
+    for (std::vector<TransactionKey>::const_iterator key = finished.begin();
+         key != finished.end(); ++key) {
+        // The transaction may have been removed in the meantime.
+        TransactionList::iterator pos = findTransaction(*key);
+        if ((pos == transactionListEnd()) || !pos->second->isModelDone()) {
+            continue;
+        }
+
+        // @todo  Additional actions based on NCR status could be
+        // performed here.
+        transaction_list_.erase(pos);
+
+        // If there are requests for this DHCID, the oldest may be started.
+        if (blocked_requests_.count(*key) > 0) {
+            ready_keys_.push_back(*key);
         }
     }
 }
 
-void D2UpdateMgr::pickNextJob() {
-    // Start at the front of the queue, looking for the first entry for
-    // which no transaction is in progress.  If we find an eligible entry
-    // remove it from the queue and  make a transaction for it.
+bool D2UpdateMgr::pickNextJob() {
     // Requests and transactions are associated by DHCID.  If a request has
     // the same DHCID as a transaction, they are presumed to be for the same
-    // "end user".
-    size_t queue_count = getQueueCount();
-    for (size_t index = 0; index < queue_count; ++index) {
-        dhcp_ddns::NameChangeRequestPtr found_ncr = queue_mgr_->peekAt(index);
-        if (!hasTransaction(found_ncr->getDhcid())) {
-            queue_mgr_->dequeueAt(index);
-            makeTransaction(found_ncr);
-            return;
+    // "end user".  The blocked requests released by completed transactions
+    // go first as they were received before any request in the queue.
+    while (!ready_keys_.empty()) {
+        const TransactionKey key = ready_keys_.front();
+        ready_keys_.pop_front();
+        BlockedRequestMap::iterator blocked = blocked_requests_.find(key);
+        if ((blocked == blocked_requests_.end()) || hasTransaction(key)) {
+            continue;
+        }
+
+        dhcp_ddns::NameChangeRequestPtr found_ncr = blocked->second.front();
+        blocked->second.pop_front();
+        --blocked_count_;
+        if (blocked->second.empty()) {
+            blocked_requests_.erase(blocked);
+        }
+
+        makeTransaction(found_ncr);
+
+        // If no transaction was made for the request, the next one for
+        // the same DHCID may be started.
+        if (!hasTransaction(key) && (blocked_requests_.count(key) > 0)) {
+            ready_keys_.push_back(key);
+        }
+        return (true);
+    }
+
+    // Take the requests from the front of the queue. Those for which a
+    // transaction is in progress are set aside until it completes.
+    while (queue_mgr_->getQueueSize() > 0) {
+        dhcp_ddns::NameChangeRequestPtr found_ncr = queue_mgr_->peek();
+        const TransactionKey& key = found_ncr->getDhcid();
+        if (hasTransaction(key) || (blocked_requests_.count(key) > 0)) {
+            // Leave the request in the queue rather than hold more blocked
+            // requests than the queue itself may hold.
+            if (blocked_count_ >= queue_mgr_->getMaxQueueSize()) {
+                break;
+            }
+
+            queue_mgr_->dequeue();
+            blocked_requests_[key].push_back(found_ncr);
+            ++blocked_count_;
+            continue;
         }
+
+        queue_mgr_->dequeue();
+        makeTransaction(found_ncr);
+        return (true);
     }
 
     // There were no eligible jobs. All of the current DHCIDs already have
     // transactions pending.
-    LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
-              DHCP_DDNS_NO_ELIGIBLE_JOBS)
-        .arg(getQueueCount()).arg(getTransactionCount());
+    if (getQueueCount() > 0) {
+        LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
+                  DHCP_DDNS_NO_ELIGIBLE_JOBS)
+            .arg(getQueueCount()).arg(getTransactionCount());
+    }
+
+    return (false);
+}
+
+void
+D2UpdateMgr::transactionFinished(const TransactionKey& key) {
+    finished_transactions_.push_back(key);
 }
 
 void
@@ -209,10 +257,36 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
+    // Have it tell us when it is done.
+    trans->setCompletionHandler(boost::bind(&D2UpdateMgr::transactionFinished,
+                                            this, _1));
+
+    // Have it merge its DNS updates with those of the others if enabled.
+    trans->setUpdateBatcher(getUpdateBatcher());
+
+    // Have it share the TCP connections to the servers with the others.
+    trans->setTCPPool(tcp_pool_);
+
     // Start it.
     trans->startTransaction();
 }
 
+const D2UpdateBatcherPtr&
+D2UpdateMgr::getUpdateBatcher() {
+    D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
+    const size_t window = d2_params->getDnsUpdateBatchWindow();
+    const size_t max_size = d2_params->getDnsUpdateBatchSize();
+    if (window == 0) {
+        update_batcher_.reset();
+    } else if (!update_batcher_ || (update_batcher_->getWindow() != window) ||
+               (update_batcher_->getMaxSize() != max_size)) {
+        update_batcher_.reset(new D2UpdateBatcher(io_service_, window,
+                                                  max_size, tcp_pool_));
+    }
+
+    return (update_batcher_);
+}
+
 TransactionList::iterator
 D2UpdateMgr::findTransaction(const TransactionKey& key) {
     return (transaction_list_.find(key));
@@ -245,7 +319,26 @@ void
 D2UpdateMgr::clearTransactionList() {
     // @todo for now this just wipes them out. We might need something
     // more elegant, that allows a cancel first.
+    for (TransactionList::iterator it = transaction_list_.begin();
+         it != transaction_list_.end(); ++it) {
+        // The transaction may outlive the list if it has IO pending.
+        it->second->setCompletionHandler(CompletionHandler());
+
+        // Requests waiting for the transaction are no longer blocked.
+        if (blocked_requests_.count(it->first) > 0) {
+            ready_keys_.push_back(it->first);
+        }
+    }
+
     transaction_list_.clear();
+    finished_transactions_.clear();
+}
+
+void
+D2UpdateMgr::clearBlockedRequests() {
+    blocked_requests_.clear();
+    blocked_count_ = 0;
+    ready_keys_.clear();
 }
 
 void
@@ -268,7 +361,7 @@ D2UpdateMgr::setMaxTransactions(const size_t new_trans_max) {
 
 size_t
 D2UpdateMgr::getQueueCount() const {
-    return (queue_mgr_->getQueueSize());
+    return (queue_mgr_->getQueueSize() + blocked_count_);
 }
 
 size_t
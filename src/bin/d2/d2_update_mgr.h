@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,9 +16,13 @@
 #include <d2/d2_cfg_mgr.h>
 #include <d2/nc_trans.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+#include <deque>
 #include <map>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -33,6 +37,24 @@ public:
 /// @brief Defines a list of transactions.
 typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 
+/// @brief Hash function of the transaction key.
+struct TransactionKeyHash {
+    /// @brief Returns the hash of the DHCID bytes.
+    ///
+    /// @param key the transaction key to hash.
+    size_t operator()(const TransactionKey& key) const {
+        const std::vector<uint8_t>& bytes = key.getBytes();
+        return (boost::hash_range(bytes.begin(), bytes.end()));
+    }
+};
+
+/// @brief Defines a map of requests waiting for a transaction in progress,
+/// keyed by their DHCID.
+///
+/// The requests for the same DHCID are kept in the order they were received.
+typedef boost::unordered_map<TransactionKey, RequestQueue,
+                             TransactionKeyHash> BlockedRequestMap;
+
 /// @brief D2UpdateMgr creates and manages update transactions.
 ///
 /// D2UpdateMgr is the DHCP_DDNS task master, instantiating and then supervising
@@ -62,6 +84,16 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
 /// manner.
 ///
+/// Only one transaction at a time may exist for a given DHCID.  A request
+/// for a DHCID which has a transaction in progress (or requests already
+/// waiting for it) is moved from the queue to a map of blocked requests
+/// keyed by DHCID, so it is never examined again until that transaction
+/// completes.  Transactions notify the manager when they complete, and the
+/// DHCIDs with blocked requests are then put on a ready list from which
+/// their oldest blocked request is started.  Thus neither the queue nor the
+/// transaction list is scanned and each sweep costs time proportional to
+/// the number of transactions started or finished.
+///
 class D2UpdateMgr : public boost::noncopyable {
 public:
     /// @brief Maximum number of concurrent transactions
@@ -106,36 +138,48 @@ public:
     ///
     /// - Removes all completed transactions from the transaction list.
     ///
-    /// - If the request queue is not empty and the number of transactions
-    /// in the transaction list has not reached maximum allowed, then select
-    /// a request from the queue.
-    ///
-    /// - If a request was selected, start a new transaction for it and
-    /// add the transaction to the list of transactions.
+    /// - As long as the number of transactions in the transaction list has
+    /// not reached maximum allowed and there are eligible requests, select
+    /// a request and start a new transaction for it, adding the transaction
+    /// to the list of transactions.
     void sweep();
 
 protected:
     /// @brief Performs post-completion cleanup on completed transactions.
     ///
-    /// Iterates through the list of transactions and removes any that have
-    /// reached completion.  This method may expand in complexity or even
-    /// disappear altogether as the implementation matures.
+    /// Removes the transactions which have notified their completion from
+    /// the transaction list.  If there are requests blocked by a removed
+    /// transaction, its DHCID is put on the ready list.  This method may
+    /// expand in complexity or even disappear altogether as the
+    /// implementation matures.
     void checkFinishedTransactions();
 
-    /// @brief Starts a transaction for the next eligible request in the queue.
+    /// @brief Starts a transaction for the next eligible request.
     ///
-    /// This method will scan the request queue for the next request to
-    /// dequeue.  The current implementation starts at the front of the queue
-    /// and looks for the first request for whose DHCID there is no current
-    /// transaction in progress.
+    /// The oldest blocked request of a DHCID on the ready list is selected
+    /// first.  Otherwise, requests are dequeued from the front of the
+    /// queue.  A request for whose DHCID there is a transaction in progress
+    /// or already blocked requests is moved to the blocked requests, until
+    /// a request without such a transaction is found or the number of
+    /// blocked requests reaches the maximum queue size.
     ///
-    /// If a request is selected, it is removed from the queue and transaction
-    /// is constructed for it.
+    /// If a request is selected, a transaction is constructed for it.
     ///
     /// It is possible that no such request exists, though this is likely to be
     /// rather rare unless a system is frequently seeing requests for the same
     /// clients in quick succession.
-    void pickNextJob();
+    ///
+    /// @return true if a request was selected, false otherwise.
+    bool pickNextJob();
+
+    /// @brief Handles the completion notification of a transaction.
+    ///
+    /// It is invoked by the transaction while it is still executing, so it
+    /// only records the key.  The transaction is removed from the list by
+    /// the next @c checkFinishedTransactions.
+    ///
+    /// @param key the key of the completed transaction.
+    void transactionFinished(const TransactionKey& key);
 
     /// @brief Create a new transaction for the given request.
     ///
@@ -161,6 +205,16 @@ protected:
     /// exists. Note this would be programmatic error.
     void makeTransaction(isc::dhcp_ddns::NameChangeRequestPtr& ncr);
 
+    /// @brief Returns the batcher the new transactions should use.
+    ///
+    /// The batcher is created when the DNS update batching is enabled in
+    /// the current configuration and replaced when its parameters change.
+    /// The transactions in progress keep using the batcher they were given.
+    ///
+    /// @return pointer to the batcher or an empty pointer if the batching
+    /// is disabled.
+    const D2UpdateBatcherPtr& getUpdateBatcher();
+
 public:
     /// @brief Gets the D2UpdateMgr's IOService.
     ///
@@ -215,13 +269,26 @@ public:
 
     /// @brief Immediately discards all entries in the transaction list.
     ///
+    /// The requests blocked by the discarded transactions become eligible.
+    ///
     /// @todo For now this just wipes them out. We might need something
     /// more elegant, that allows a cancel first.
     void clearTransactionList();
 
+    /// @brief Immediately discards all blocked requests.
+    void clearBlockedRequests();
+
     /// @brief Convenience method that returns the number of requests queued.
+    ///
+    /// This includes the requests blocked by transactions in progress.
     size_t getQueueCount() const;
 
+    /// @brief Returns the number of requests blocked by transactions in
+    /// progress.
+    size_t getBlockedCount() const {
+        return (blocked_count_);
+    }
+
     /// @brief Returns the current number of transactions.
     size_t getTransactionCount() const;
 
@@ -245,6 +312,26 @@ private:
 
     /// @brief List of transactions.
     TransactionList transaction_list_;
+
+    /// @brief Keys of the transactions which have notified their completion.
+    std::vector<TransactionKey> finished_transactions_;
+
+    /// @brief Requests waiting for a transaction in progress, by DHCID.
+    BlockedRequestMap blocked_requests_;
+
+    /// @brief Number of requests in the blocked requests map.
+    size_t blocked_count_;
+
+    /// @brief DHCIDs whose oldest blocked request may be started.
+    std::deque<TransactionKey> ready_keys_;
+
+    /// @brief Batcher merging the DNS updates of the transactions, if
+    /// the batching is enabled.
+    D2UpdateBatcherPtr update_batcher_;
+
+    /// @brief Pool of the persistent TCP connections to the DNS servers
+    /// shared by the transactions.
+    DNSTCPConnectionPoolPtr tcp_pool_;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
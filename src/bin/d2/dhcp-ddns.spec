@@ -34,6 +34,18 @@
         "item_optional": true,
         "item_default": "JSON"
     },
+    {
+        "item_name": "dns-update-batch-window",
+        "item_type": "integer",
+        "item_optional": true,
+        "item_default": 0
+    },
+    {
+        "item_name": "dns-update-batch-size",
+        "item_type": "integer",
+        "item_optional": true,
+        "item_default": 16
+    },
     {
         "item_name": "tsig-keys",
         "item_type": "list",
@@ -133,6 +145,12 @@
                             "item_type": "integer",
                             "item_optional": true,
                             "item_default": 53 
+                        },
+                        {
+                            "item_name": "protocol",
+                            "item_type": "string",
+                            "item_optional": true,
+                            "item_default": "UDP"
                         }]
                     }
                 }]
@@ -201,6 +219,12 @@
                             "item_type": "integer",
                             "item_optional": true,
                             "item_default": 53 
+                        },
+                        {
+                            "item_name": "protocol",
+                            "item_type": "string",
+                            "item_optional": true,
+                            "item_default": "UDP"
                         }]
                     }
                 }]
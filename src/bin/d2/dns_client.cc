@@ -7,7 +7,10 @@
 #include <config.h>
 #include <d2/dns_client.h>
 #include <d2/d2_log.h>
+#include <asiolink/interval_timer.h>
 #include <dns/messagerenderer.h>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <limits>
 
 namespace isc {
@@ -29,10 +32,10 @@ using namespace isc::dns;
 
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
-// Currently, implementation uses IOFetch object to handle asynchronous
-// communication with the DNS. This design may be revisited in the future. If
-// implementation is changed, the DNSClient API will remain unchanged thanks
-// to this separation.
+// The implementation uses IOFetch object to handle asynchronous UDP
+// communication with the DNS and a DNSTCPConnection taken from the pool for
+// TCP. If implementation is changed, the DNSClient API will remain unchanged
+// thanks to this separation.
 class DNSClientImpl : public asiodns::IOFetch::Callback {
 public:
     // A buffer holding response from a DNS.
@@ -55,11 +58,20 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // Pool of the TCP connections used when the protocol is TCP.
+    DNSTCPConnectionPoolPtr tcp_pool_;
+    // TCP connection over which the current request was sent, if any.
+    DNSTCPConnectionPtr tcp_conn_;
+    // ID of the current request sent over TCP.
+    uint16_t tcp_qid_;
+    // Timer measuring the timeout of the current request sent over TCP.
+    boost::scoped_ptr<asiolink::IntervalTimer> tcp_timer_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                   DNSClient::Callback* callback,
-                  const DNSClient::Protocol proto);
+                  const DNSClient::Protocol proto,
+                  const DNSTCPConnectionPoolPtr& tcp_pool);
     virtual ~DNSClientImpl();
 
     // This internal callback is called when the DNS update message exchange is
@@ -68,6 +80,29 @@ public:
     // type, representing a response from the server is set.
     virtual void operator()(asiodns::IOFetch::Result result);
 
+    // Parses the response held in in_buf_ if the exchange succeeded and
+    // invokes the external callback.
+    void completeExchange(DNSClient::Status status);
+
+    // Sends the rendered message over a TCP connection from the pool.
+    void doTCPUpdate(asiolink::IOService& io_service,
+                     const asiolink::IOAddress& ns_addr,
+                     const uint16_t ns_port,
+                     const util::OutputBufferPtr& msg_buf,
+                     const unsigned int wait);
+
+    // Called when the response to the request sent over TCP is received
+    // or the connection fails.
+    void tcpResponseHandler(const bool success, const uint8_t* data,
+                            const size_t length);
+
+    // Called when the response to the request sent over TCP is not
+    // received in time.
+    void tcpTimeoutHandler();
+
+    // Abandons the request sent over TCP, if any.
+    void cancelTCPRequest();
+
     // Starts asynchronous DNS Update using TSIG.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
@@ -82,9 +117,11 @@ public:
 
 DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
-                             const DNSClient::Protocol proto)
+                             const DNSClient::Protocol proto,
+                             const DNSTCPConnectionPoolPtr& tcp_pool)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
-      response_(response_placeholder), callback_(callback), proto_(proto) {
+      response_(response_placeholder), callback_(callback), proto_(proto),
+      tcp_pool_(tcp_pool), tcp_conn_(), tcp_qid_(0), tcp_timer_() {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -92,17 +129,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -115,16 +141,26 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                       << proto_ << "' specified for DNS Updates");
         }
     }
+
+    // Without a shared pool the client keeps its connection to itself.
+    if ((proto_ == DNSClient::TCP) && !tcp_pool_) {
+        tcp_pool_.reset(new DNSTCPConnectionPool(1));
+    }
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    cancelTCPRequest();
 }
 
 void
 DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     // Get the status from IO. If no success, we just call user's callback
     // and pass the status code.
-    DNSClient::Status status = getStatus(result);
+    completeExchange(getStatus(result));
+}
+
+void
+DNSClientImpl::completeExchange(DNSClient::Status status) {
     if (status == DNSClient::SUCCESS) {
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
@@ -174,6 +210,85 @@ DNSClientImpl::getStatus(const asiodns::IOFetch::Result result) {
     }
     return (DNSClient::OTHER);
 }
+
+void
+DNSClientImpl::doTCPUpdate(asiolink::IOService& io_service,
+                           const IOAddress& ns_addr,
+                           const uint16_t ns_port,
+                           const OutputBufferPtr& msg_buf,
+                           const unsigned int wait) {
+    cancelTCPRequest();
+
+    // The ID identifies the response among others on the connection.
+    const uint16_t qid = (static_cast<uint16_t>((*msg_buf)[0]) << 8) |
+        (*msg_buf)[1];
+    DNSTCPConnectionPtr conn = tcp_pool_->getConnection(io_service, ns_addr,
+                                                        ns_port, qid);
+    if (!conn || !conn->send(msg_buf,
+                             boost::bind(&DNSClientImpl::tcpResponseHandler,
+                                         this, _1, _2, _3))) {
+        // All connections to the server have a request with this ID
+        // in progress. This is very unlikely as the IDs are random, so
+        // it is reported as any other IO error. The error is reported
+        // from the timer rather than a handler posted to the IO service,
+        // so it is canceled with the timer if this object is destroyed
+        // before it runs.
+        tcp_timer_.reset(new IntervalTimer(io_service));
+        tcp_timer_->setup(boost::bind(&DNSClientImpl::completeExchange, this,
+                                      DNSClient::OTHER),
+                          1, IntervalTimer::ONE_SHOT);
+        return;
+    }
+
+    tcp_conn_ = conn;
+    tcp_qid_ = qid;
+    tcp_timer_.reset(new IntervalTimer(io_service));
+    tcp_timer_->setup(boost::bind(&DNSClientImpl::tcpTimeoutHandler, this),
+                      static_cast<long>(wait), IntervalTimer::ONE_SHOT);
+}
+
+void
+DNSClientImpl::tcpResponseHandler(const bool success, const uint8_t* data,
+                                  const size_t length) {
+    tcp_conn_.reset();
+    if (tcp_timer_) {
+        tcp_timer_->cancel();
+    }
+
+    if (!success) {
+        completeExchange(DNSClient::OTHER);
+        return;
+    }
+
+    in_buf_->clear();
+    in_buf_->writeData(data, length);
+    completeExchange(DNSClient::SUCCESS);
+}
+
+void
+DNSClientImpl::tcpTimeoutHandler() {
+    if (!tcp_conn_) {
+        return;
+    }
+
+    // The connection stays open for the other requests, a late response
+    // to this one is dropped.
+    cancelTCPRequest();
+    completeExchange(DNSClient::TIMEOUT);
+}
+
+void
+DNSClientImpl::cancelTCPRequest() {
+    if (tcp_conn_) {
+        tcp_conn_->cancel(tcp_qid_);
+        tcp_conn_.reset();
+    }
+
+    if (tcp_timer_) {
+        tcp_timer_->cancel();
+    }
+}
+
 void
 DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                         const IOAddress& ns_addr,
@@ -213,6 +328,11 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    if (proto_ == DNSClient::TCP) {
+        doTCPUpdate(io_service, ns_addr, ns_port, msg_buf, wait);
+        return;
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
@@ -230,8 +350,10 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
 }
 
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
-                     Callback* callback, const DNSClient::Protocol proto)
-    : impl_(new DNSClientImpl(response_placeholder, callback, proto)) {
+                     Callback* callback, const DNSClient::Protocol proto,
+                     const DNSTCPConnectionPoolPtr& tcp_pool)
+    : impl_(new DNSClientImpl(response_placeholder, callback, proto,
+                              tcp_pool)) {
 }
 
 DNSClient::~DNSClient() {
@@ -244,6 +366,11 @@ DNSClient::getMaxTimeout() {
     return (max_timeout);
 }
 
+DNSClient::Protocol
+DNSClient::getProtocol() const {
+    return (impl_->proto_);
+}
+
 void
 DNSClient::doUpdate(asiolink::IOService& io_service,
                     const IOAddress& ns_addr,
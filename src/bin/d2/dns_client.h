@@ -8,6 +8,7 @@
 #define DNS_CLIENT_H
 
 #include <d2/d2_update_message.h>
+#include <d2/dns_tcp_pool.h>
 
 #include <asiolink/io_service.h>
 #include <util/buffer.h>
@@ -39,13 +40,16 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// Both UDP and TCP Transport are supported. With UDP each message exchange
+/// uses its own socket. With TCP the messages are sent over the persistent
+/// connections taken from a @c DNSTCPConnectionPool, so many exchanges
+/// with the same server share a connection and are pipelined over it. The
+/// pool may be shared by many @c DNSClient instances, otherwise each
+/// instance uses its own.
+///
+/// @todo The @c DNSClient logic could use the other protocol on its own
+/// discretion, when there is a legitimate reason to do so. For example, if
+/// communication with the server using preferred protocol fails.
 class DNSClient {
 public:
 
@@ -92,8 +96,12 @@ public:
     /// if an error occurs. NULL value disables callback invocation.
     /// @param proto caller's preference regarding Transport layer protocol to
     /// be used by DNS Client to communicate with a server.
+    /// @param tcp_pool pool of the TCP connections used when the protocol is
+    /// TCP. If it is null, the client creates its own pool.
     DNSClient(D2UpdateMessagePtr& response_placeholder, Callback* callback,
-              const Protocol proto = UDP);
+              const Protocol proto = UDP,
+              const DNSTCPConnectionPoolPtr& tcp_pool =
+              DNSTCPConnectionPoolPtr());
 
     /// @brief Virtual destructor, does nothing.
     ~DNSClient();
@@ -120,6 +128,9 @@ public:
     /// @return maximal allowed timeout value accepted by @c DNSClient::doUpdate
     static unsigned int getMaxTimeout();
 
+    /// @brief Returns the Transport layer protocol used by the client.
+    Protocol getProtocol() const;
+
     /// @brief Start asynchronous DNS Update with TSIG.
     ///
     /// This function starts asynchronous DNS Update and returns. The DNS Update
@@ -129,7 +140,8 @@ public:
     ///
     /// An address and port of the DNS server is specified through the function
     /// arguments so as the same instance of the @c DNSClient can be used to
-    /// initiate multiple message exchanges.
+    /// initiate multiple message exchanges. With TCP only one exchange may
+    /// be in progress at a time, starting a new one abandons the previous.
     ///
     /// @param io_service IO service to be used to run the message exchange.
     /// @param ns_addr DNS server address.
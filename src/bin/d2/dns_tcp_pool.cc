@@ -0,0 +1,339 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_log.h>
+#include <d2/dns_tcp_pool.h>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/bind.hpp>
+#include <limits>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace isc {
+namespace d2 {
+
+// *********************** DNSTCPConnection  *************************
+
+DNSTCPConnection::DNSTCPConnection(IOService& io_service,
+                                   const IOAddress& ns_addr,
+                                   const uint16_t ns_port)
+    : io_service_(io_service),
+      endpoint_(boost::asio::ip::address::from_string(ns_addr.toText()),
+                ns_port),
+      socket_(io_service.get_io_service()), state_(CLOSED), generation_(0),
+      write_queue_(), writing_(false), pending_(), failing_(),
+      read_buf_() {
+}
+
+DNSTCPConnection::~DNSTCPConnection() {
+    close();
+}
+
+bool
+DNSTCPConnection::send(const OutputBufferPtr& request,
+                       const ResponseHandler& handler) {
+    if (!request || (request->getLength() < sizeof(uint16_t))) {
+        isc_throw(DNSTCPConnectionError, "DNS request is too short");
+    }
+
+    if (request->getLength() > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(DNSTCPConnectionError, "DNS request of "
+                  << request->getLength() << " bytes is too long for TCP");
+    }
+
+    const uint16_t qid = (static_cast<uint16_t>((*request)[0]) << 8) |
+        (*request)[1];
+    if (isPending(qid)) {
+        return (false);
+    }
+
+    // Prepend the length, so the request is written at once.
+    OutputBufferPtr framed(new OutputBuffer(request->getLength() + 2));
+    framed->writeUint16(static_cast<uint16_t>(request->getLength()));
+    framed->writeData(request->getData(), request->getLength());
+
+    pending_[qid] = handler;
+    write_queue_.push_back(QueuedRequest(qid, framed));
+
+    if (state_ == CLOSED) {
+        connect();
+    } else if (state_ == CONNECTED) {
+        writeNext();
+    }
+    return (true);
+}
+
+void
+DNSTCPConnection::cancel(const uint16_t qid) {
+    pending_.erase(qid);
+    failing_.erase(qid);
+
+    // The request being written must stay in the queue until the write
+    // completes.
+    std::deque<QueuedRequest>::iterator it = write_queue_.begin();
+    if (writing_ && (it != write_queue_.end())) {
+        ++it;
+    }
+    while (it != write_queue_.end()) {
+        if (it->first == qid) {
+            it = write_queue_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+DNSTCPConnection::close() {
+    ++generation_;
+    if (state_ != CLOSED) {
+        boost::system::error_code ignored;
+        socket_.close(ignored);
+        state_ = CLOSED;
+    }
+    write_queue_.clear();
+    writing_ = false;
+    pending_.clear();
+    failing_.clear();
+}
+
+void
+DNSTCPConnection::connect() {
+    state_ = CONNECTING;
+    socket_.async_connect(endpoint_,
+                          boost::bind(&DNSTCPConnection::connectHandler,
+                                      shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::connectHandler(const uint64_t generation,
+                                 const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_CONNECT_FAILED)
+            .arg(endpoint_.address().to_string()).arg(endpoint_.port())
+            .arg(ec.message());
+        fail();
+        return;
+    }
+
+    LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              DHCP_DDNS_TCP_CONNECTED)
+        .arg(endpoint_.address().to_string()).arg(endpoint_.port());
+    state_ = CONNECTED;
+    readLength();
+    writeNext();
+}
+
+void
+DNSTCPConnection::writeNext() {
+    if (writing_ || write_queue_.empty()) {
+        return;
+    }
+
+    writing_ = true;
+    const OutputBufferPtr& framed = write_queue_.front().second;
+    boost::asio::async_write(socket_,
+                             boost::asio::buffer(framed->getData(),
+                                                 framed->getLength()),
+                             boost::bind(&DNSTCPConnection::writeHandler,
+                                         shared_from_this(), generation_,
+                                         _1));
+}
+
+void
+DNSTCPConnection::writeHandler(const uint64_t generation,
+                               const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    writing_ = false;
+    write_queue_.pop_front();
+    if (ec) {
+        fail();
+        return;
+    }
+    writeNext();
+}
+
+void
+DNSTCPConnection::readLength() {
+    boost::asio::async_read(socket_,
+                            boost::asio::buffer(length_buf_,
+                                                sizeof(length_buf_)),
+                            boost::bind(&DNSTCPConnection::lengthHandler,
+                                        shared_from_this(), generation_,
+                                        _1));
+}
+
+void
+DNSTCPConnection::lengthHandler(const uint64_t generation,
+                                const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    const size_t length = (static_cast<size_t>(length_buf_[0]) << 8) |
+        length_buf_[1];
+    if (ec || (length < sizeof(uint16_t))) {
+        fail();
+        return;
+    }
+
+    read_buf_.resize(length);
+    boost::asio::async_read(socket_,
+                            boost::asio::buffer(&read_buf_[0],
+                                                read_buf_.size()),
+                            boost::bind(&DNSTCPConnection::responseHandler,
+                                        shared_from_this(), generation_,
+                                        _1));
+}
+
+void
+DNSTCPConnection::responseHandler(const uint64_t generation,
+                                  const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        fail();
+        return;
+    }
+
+    // The handler may send another request over this connection, so
+    // the response is handed over and the next read started first.
+    std::vector<uint8_t> response;
+    response.swap(read_buf_);
+    readLength();
+
+    const uint16_t qid = (static_cast<uint16_t>(response[0]) << 8) |
+        response[1];
+    std::map<uint16_t, ResponseHandler>::iterator it = pending_.find(qid);
+    if (it == pending_.end()) {
+        // Late response to a cancelled or timed out request.
+        return;
+    }
+
+    ResponseHandler handler = it->second;
+    pending_.erase(it);
+    handler(true, &response[0], response.size());
+}
+
+void
+DNSTCPConnection::fail() {
+    if (state_ == CONNECTED) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_TCP_CONNECTION_CLOSED)
+            .arg(endpoint_.address().to_string()).arg(endpoint_.port())
+            .arg(pending_.size());
+    }
+
+    // The handlers may already send new requests which reopen the
+    // connection, or cancel the requests of others, so the failed
+    // requests are kept apart from the pending ones.
+    std::map<uint16_t, ResponseHandler> failed;
+    failed.swap(pending_);
+    close();
+    failing_.swap(failed);
+
+    while (!failing_.empty()) {
+        ResponseHandler handler = failing_.begin()->second;
+        failing_.erase(failing_.begin());
+        handler(false, NULL, 0);
+    }
+}
+
+// *********************** DNSTCPConnectionPool  *************************
+
+const size_t DNSTCPConnectionPool::MAX_CONNECTIONS_DEFAULT;
+const size_t DNSTCPConnectionPool::PIPELINE_DEPTH_DEFAULT;
+
+DNSTCPConnectionPool::DNSTCPConnectionPool(const size_t max_connections,
+                                           const size_t pipeline_depth)
+    : max_connections_(max_connections), pipeline_depth_(pipeline_depth),
+      connections_() {
+    if (max_connections_ == 0) {
+        isc_throw(DNSTCPConnectionError,
+                  "maximum number of connections must be greater than 0");
+    }
+
+    if (pipeline_depth_ == 0) {
+        isc_throw(DNSTCPConnectionError,
+                  "pipeline depth must be greater than 0");
+    }
+}
+
+DNSTCPConnectionPool::~DNSTCPConnectionPool() {
+    clear();
+}
+
+DNSTCPConnectionPtr
+DNSTCPConnectionPool::getConnection(IOService& io_service,
+                                    const IOAddress& ns_addr,
+                                    const uint16_t ns_port,
+                                    const uint16_t qid) {
+    ConnectionList& list = connections_[std::make_pair(ns_addr, ns_port)];
+
+    // Find the least busy connection which can take the request.
+    DNSTCPConnectionPtr best;
+    size_t usable = 0;
+    for (ConnectionList::const_iterator it = list.begin(); it != list.end();
+         ++it) {
+        if (&(*it)->getIOService() != &io_service) {
+            continue;
+        }
+        ++usable;
+        if ((*it)->isPending(qid)) {
+            continue;
+        }
+        if (!best || ((*it)->getPendingCount() < best->getPendingCount())) {
+            best = *it;
+        }
+    }
+
+    if (usable < max_connections_) {
+        if (!best || (best->getPendingCount() >= pipeline_depth_)) {
+            best.reset(new DNSTCPConnection(io_service, ns_addr, ns_port));
+            list.push_back(best);
+        }
+    }
+
+    return (best);
+}
+
+size_t
+DNSTCPConnectionPool::getConnectionCount(const IOAddress& ns_addr,
+                                         const uint16_t ns_port) const {
+    ConnectionMap::const_iterator it =
+        connections_.find(std::make_pair(ns_addr, ns_port));
+    return (it == connections_.end() ? 0 : it->second.size());
+}
+
+void
+DNSTCPConnectionPool::clear() {
+    for (ConnectionMap::iterator it = connections_.begin();
+         it != connections_.end(); ++it) {
+        for (ConnectionList::iterator conn = it->second.begin();
+             conn != it->second.end(); ++conn) {
+            (*conn)->close();
+        }
+    }
+    connections_.clear();
+}
+
+} // namespace d2
+} // namespace isc
@@ -0,0 +1,314 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DNS_TCP_POOL_H
+#define DNS_TCP_POOL_H
+
+/// @file dns_tcp_pool.h This file defines the classes which maintain the
+/// persistent TCP connections to the DNS servers.
+
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <exceptions/exceptions.h>
+#include <util/buffer.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Thrown if the DNS TCP connection pool encounters a general error.
+class DNSTCPConnectionError : public isc::Exception {
+public:
+    DNSTCPConnectionError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Persistent TCP connection to a DNS server.
+///
+/// The connection carries any number of DNS messages, each preceded by
+/// the two byte length field as described in RFC 1035, section 4.2.2.
+/// The messages are written one after another in the order in which they
+/// were sent and the responses are read continuously, so multiple
+/// requests may be outstanding at the same time (pipelining). Because
+/// the server may answer in any order, a response is matched with its
+/// request by the message ID, i.e. the first two bytes of the message.
+/// Therefore the IDs of the outstanding requests must be unique within
+/// the connection.
+///
+/// The connection is opened with the first request sent over it. When
+/// the server closes the connection or an IO error occurs, all
+/// outstanding requests fail and the connection is closed. The next
+/// request opens it again.
+///
+/// The response handlers are always invoked from the IO service, never
+/// from within the @c send call.
+class DNSTCPConnection :
+        public boost::enable_shared_from_this<DNSTCPConnection>,
+        public boost::noncopyable {
+public:
+    /// @brief Handler invoked when the exchange completes.
+    ///
+    /// The first argument is true when the response was received and false
+    /// when the connection failed. The remaining arguments point to the
+    /// response data and its length.
+    typedef boost::function<void (const bool, const uint8_t*, const size_t)>
+    ResponseHandler;
+
+    /// @brief Constructor
+    ///
+    /// @param io_service IO service used to run the connection.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    DNSTCPConnection(asiolink::IOService& io_service,
+                     const asiolink::IOAddress& ns_addr,
+                     const uint16_t ns_port);
+
+    /// @brief Destructor
+    ///
+    /// Closes the connection without invoking the pending handlers.
+    ~DNSTCPConnection();
+
+    /// @brief Sends a request over the connection.
+    ///
+    /// The request is queued to be written once the connection is open and
+    /// the requests sent before it are written.
+    ///
+    /// @param request buffer holding the request in wire format.
+    /// @param handler handler invoked when the response is received or the
+    /// connection fails.
+    ///
+    /// @return false if a request with the same ID is already pending on
+    /// this connection, true otherwise.
+    /// @throw DNSTCPConnectionError if the request is too short to hold the
+    /// message ID or too long to fit the length field.
+    bool send(const util::OutputBufferPtr& request,
+              const ResponseHandler& handler);
+
+    /// @brief Cancels the request with the given ID.
+    ///
+    /// The handler of the request will not be invoked. If the request was
+    /// not written yet, it is never written.
+    ///
+    /// @param qid ID of the request.
+    void cancel(const uint16_t qid);
+
+    /// @brief Closes the connection.
+    ///
+    /// The pending requests are discarded without invoking their handlers.
+    void close();
+
+    /// @brief Checks if a request with the given ID is pending.
+    ///
+    /// @param qid ID of the request.
+    bool isPending(const uint16_t qid) const {
+        return (pending_.count(qid) > 0);
+    }
+
+    /// @brief Returns the number of the pending requests.
+    size_t getPendingCount() const {
+        return (pending_.size());
+    }
+
+    /// @brief Checks if the connection is established.
+    bool isConnected() const {
+        return (state_ == CONNECTED);
+    }
+
+    /// @brief Returns the IO service used by the connection.
+    asiolink::IOService& getIOService() const {
+        return (io_service_);
+    }
+
+private:
+    /// @brief State of the connection.
+    enum State {
+        CLOSED,
+        CONNECTING,
+        CONNECTED
+    };
+
+    /// @brief Starts connecting to the server.
+    void connect();
+
+    /// @brief Handles the completion of the connect.
+    ///
+    /// @param generation generation of the connection the handler was
+    /// installed for.
+    /// @param ec error code.
+    void connectHandler(const uint64_t generation,
+                        const boost::system::error_code& ec);
+
+    /// @brief Writes the first queued request, if not writing already.
+    void writeNext();
+
+    /// @brief Handles the completion of the write.
+    ///
+    /// @param generation generation of the connection.
+    /// @param ec error code.
+    void writeHandler(const uint64_t generation,
+                      const boost::system::error_code& ec);
+
+    /// @brief Starts reading the length of the next response.
+    void readLength();
+
+    /// @brief Handles the completion of the length read.
+    ///
+    /// @param generation generation of the connection.
+    /// @param ec error code.
+    void lengthHandler(const uint64_t generation,
+                       const boost::system::error_code& ec);
+
+    /// @brief Handles the completion of the response read.
+    ///
+    /// @param generation generation of the connection.
+    /// @param ec error code.
+    void responseHandler(const uint64_t generation,
+                         const boost::system::error_code& ec);
+
+    /// @brief Closes the connection and fails the pending requests.
+    void fail();
+
+    /// @brief Request queued for writing, i.e. the ID and the framed data.
+    typedef std::pair<uint16_t, util::OutputBufferPtr> QueuedRequest;
+
+    /// @brief IO service used to run the connection.
+    asiolink::IOService& io_service_;
+
+    /// @brief Server endpoint.
+    boost::asio::ip::tcp::endpoint endpoint_;
+
+    /// @brief Connection socket.
+    boost::asio::ip::tcp::socket socket_;
+
+    /// @brief State of the connection.
+    State state_;
+
+    /// @brief Incremented whenever the connection is closed, so the IO
+    /// handlers of the previous connection are ignored.
+    uint64_t generation_;
+
+    /// @brief Requests waiting to be written.
+    std::deque<QueuedRequest> write_queue_;
+
+    /// @brief Indicates if the first queued request is being written.
+    bool writing_;
+
+    /// @brief Handlers of the pending requests by the request ID.
+    std::map<uint16_t, ResponseHandler> pending_;
+
+    /// @brief Handlers of the requests failed by the connection failure
+    /// which are yet to be invoked.
+    std::map<uint16_t, ResponseHandler> failing_;
+
+    /// @brief Buffer for the length of the response.
+    uint8_t length_buf_[2];
+
+    /// @brief Buffer for the response.
+    std::vector<uint8_t> read_buf_;
+};
+
+/// @brief Defines a pointer to a DNSTCPConnection.
+typedef boost::shared_ptr<DNSTCPConnection> DNSTCPConnectionPtr;
+
+/// @brief Pool of the persistent TCP connections to the DNS servers.
+///
+/// The pool keeps up to the given number of connections per DNS server
+/// (address and port). A request is sent over the least busy connection
+/// to the server. A new connection is opened only when all existing ones
+/// have at least the given number of requests outstanding, so the updates
+/// are normally pipelined over a single connection and the cost of the
+/// TCP handshake is paid once rather than per update.
+///
+/// The pool is not bound to an IO service, a connection is used only by
+/// the requests run by the IO service it was opened with.
+class DNSTCPConnectionPool : public boost::noncopyable {
+public:
+    /// @brief Default maximum number of connections per server.
+    static const size_t MAX_CONNECTIONS_DEFAULT = 4;
+
+    /// @brief Default number of pending requests above which a new
+    /// connection is opened.
+    static const size_t PIPELINE_DEPTH_DEFAULT = 32;
+
+    /// @brief Constructor
+    ///
+    /// @param max_connections maximum number of connections per server.
+    /// @param pipeline_depth number of pending requests on each connection
+    /// at which a new one is opened.
+    ///
+    /// @throw DNSTCPConnectionError if either value is 0.
+    DNSTCPConnectionPool(const size_t max_connections =
+                         MAX_CONNECTIONS_DEFAULT,
+                         const size_t pipeline_depth =
+                         PIPELINE_DEPTH_DEFAULT);
+
+    /// @brief Destructor
+    ///
+    /// Closes all connections.
+    ~DNSTCPConnectionPool();
+
+    /// @brief Returns a connection to send a request over.
+    ///
+    /// @param io_service IO service which runs the request.
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    /// @param qid ID of the request.
+    ///
+    /// @return pointer to the connection or an empty pointer if all
+    /// connections to the server already have a request with this ID
+    /// pending and no more connections may be opened.
+    DNSTCPConnectionPtr getConnection(asiolink::IOService& io_service,
+                                      const asiolink::IOAddress& ns_addr,
+                                      const uint16_t ns_port,
+                                      const uint16_t qid);
+
+    /// @brief Returns the number of connections to the server.
+    ///
+    /// @param ns_addr DNS server address.
+    /// @param ns_port DNS server port.
+    size_t getConnectionCount(const asiolink::IOAddress& ns_addr,
+                              const uint16_t ns_port) const;
+
+    /// @brief Closes and removes all connections.
+    void clear();
+
+private:
+    /// @brief Connections to a server.
+    typedef std::vector<DNSTCPConnectionPtr> ConnectionList;
+
+    /// @brief Connections by the server address and port.
+    typedef std::map<std::pair<asiolink::IOAddress, uint16_t>,
+                     ConnectionList> ConnectionMap;
+
+    /// @brief Maximum number of connections per server.
+    size_t max_connections_;
+
+    /// @brief Number of pending requests at which a new connection is
+    /// opened.
+    size_t pipeline_depth_;
+
+    /// @brief Connections to the servers.
+    ConnectionMap connections_;
+};
+
+/// @brief Defines a pointer to a DNSTCPConnectionPool.
+typedef boost::shared_ptr<DNSTCPConnectionPool> DNSTCPConnectionPoolPtr;
+
+} // namespace d2
+} // namespace isc
+
+#endif // DNS_TCP_POOL_H
@@ -52,7 +52,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
-     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_(),
+     completion_handler_(), update_batcher_(), tcp_pool_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -81,6 +82,10 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
 }
 
 NameChangeTransaction::~NameChangeTransaction(){
+    // Make sure the batcher doesn't call us back.
+    if (update_batcher_) {
+        update_batcher_->cancel(this);
+    }
 }
 
 void
@@ -91,6 +96,7 @@ NameChangeTransaction::startTransaction() {
 
     setNcrStatus(dhcp_ddns::ST_PENDING);
     startModel(READY_ST);
+    notifyIfDone();
 }
 
 void
@@ -107,6 +113,29 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
               .arg(responseString());
 
     runModel(IO_COMPLETED_EVT);
+    notifyIfDone();
+}
+
+void
+NameChangeTransaction::setCompletionHandler(const CompletionHandler& handler) {
+    completion_handler_ = handler;
+}
+
+void
+NameChangeTransaction::setUpdateBatcher(const D2UpdateBatcherPtr& batcher) {
+    update_batcher_ = batcher;
+}
+
+void
+NameChangeTransaction::setTCPPool(const DNSTCPConnectionPoolPtr& tcp_pool) {
+    tcp_pool_ = tcp_pool;
+}
+
+void
+NameChangeTransaction::notifyIfDone() {
+    if (isModelDone() && completion_handler_) {
+        completion_handler_(getTransactionKey());
+    }
 }
 
 std::string
@@ -174,9 +203,21 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // for the current server.  If not we would need to add that.
 
         D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
-        dns_client_->doUpdate(*io_service_, current_server_->getIpAddress(),
-                              current_server_->getPort(), *dns_update_request_,
-                              d2_params->getDnsServerTimeout(), tsig_key_);
+        if (update_batcher_) {
+            update_batcher_->submit(dns_client_, dns_update_response_, this,
+                                    current_server_->getIpAddress(),
+                                    current_server_->getPort(),
+                                    dns_update_request_,
+                                    d2_params->getDnsServerTimeout(),
+                                    tsig_key_,
+                                    current_server_->getProtocol());
+        } else {
+            dns_client_->doUpdate(*io_service_,
+                                  current_server_->getIpAddress(),
+                                  current_server_->getPort(),
+                                  *dns_update_request_,
+                                  d2_params->getDnsServerTimeout(), tsig_key_);
+        }
         // Message is on its way, so the next event should be NOP_EVT.
         postNextEvent(NOP_EVT);
         LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
@@ -452,12 +493,11 @@ NameChangeTransaction::selectNextServer() {
         // Toss out any previous response.
         dns_update_response_.reset();
 
-        // @todo  Protocol is set on DNSClient constructor.  We need
-        // to propagate a configuration value downward, probably starting
-        // at global, then domain, then server
-        // Once that is supported we need to add it here.
+        // The protocol is configured per server. Over TCP the updates
+        // share the persistent connections of the pool.
         dns_client_.reset(new DNSClient(dns_update_response_ , this,
-                                        DNSClient::UDP));
+                                        current_server_->getProtocol(),
+                                        tcp_pool_));
         ++next_server_pos_;
         return (true);
     }
@@ -12,11 +12,13 @@
 #include <asiolink/io_service.h>
 #include <exceptions/exceptions.h>
 #include <d2/d2_cfg_mgr.h>
+#include <d2/d2_update_batcher.h>
 #include <d2/dns_client.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dns/tsig.h>
 #include <util/state_model.h>
 
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
 
@@ -34,6 +36,11 @@ public:
 /// @brief Defines the type used as the unique key for transactions.
 typedef isc::dhcp_ddns::D2Dhcid TransactionKey;
 
+/// @brief Defines the handler invoked when a transaction completes.
+///
+/// The handler is given the key of the completed transaction.
+typedef boost::function<void(const TransactionKey&)> CompletionHandler;
+
 /// @brief Embodies the "life-cycle" required to carry out a DDNS update.
 ///
 /// NameChangeTransaction is the base class that provides the common state
@@ -194,6 +201,36 @@ public:
     /// This method is exception safe.
     virtual void operator()(DNSClient::Status status);
 
+    /// @brief Sets the handler invoked when the transaction completes.
+    ///
+    /// The handler is invoked once the state model has run to its end,
+    /// either from within @c startTransaction or from the DNSClient
+    /// completion handler. It is invoked while the transaction is still
+    /// executing, so it must not destroy the transaction.
+    ///
+    /// @param handler is the handler to invoke. An empty handler disables
+    /// the notification.
+    void setCompletionHandler(const CompletionHandler& handler);
+
+    /// @brief Sets the batcher through which DNS updates are sent.
+    ///
+    /// When the batcher is set, the update requests are submitted to it
+    /// to be merged with the requests of other transactions for the same
+    /// zone and server, rather than sent directly with the DNSClient.
+    ///
+    /// @param batcher is the batcher to use. An empty pointer disables
+    /// the batching.
+    void setUpdateBatcher(const D2UpdateBatcherPtr& batcher);
+
+    /// @brief Sets the pool of the TCP connections to the DNS servers.
+    ///
+    /// The pool is used to send the DNS updates to the servers configured
+    /// to use TCP, so the transactions share the connections.
+    ///
+    /// @param tcp_pool is the pool to use. An empty pointer makes each
+    /// DNSClient open its own connection.
+    void setTCPPool(const DNSTCPConnectionPoolPtr& tcp_pool);
+
 protected:
     /// @brief Send the update request to the current server.
     ///
@@ -524,6 +561,9 @@ public:
     const dns::RRType& getAddressRRType() const;
 
 private:
+    /// @brief Invokes the completion handler if the model has ended.
+    void notifyIfDone();
+
     /// @brief The IOService which should be used to for IO processing.
     asiolink::IOServicePtr io_service_;
 
@@ -582,6 +622,15 @@ private:
 
     /// @brief Pointer to the TSIG key which should be used (if any).
     dns::TSIGKeyPtr tsig_key_;
+
+    /// @brief Handler invoked when the transaction completes.
+    CompletionHandler completion_handler_;
+
+    /// @brief Batcher through which DNS updates are sent, if any.
+    D2UpdateBatcherPtr update_batcher_;
+
+    /// @brief Pool of the TCP connections to the DNS servers, if any.
+    DNSTCPConnectionPoolPtr tcp_pool_;
 };
 
 /// @brief Defines a pointer to a NameChangeTransaction.
@@ -21,6 +21,8 @@
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 using namespace std;
 using namespace isc;
 using namespace isc::d2;
@@ -251,6 +253,10 @@ TEST_F(D2CfgMgrTest, validParamsEntry) {
     EXPECT_EQ(dhcp_ddns::NCR_UDP, d2_params_->getNcrProtocol());
     EXPECT_EQ(dhcp_ddns::FMT_JSON, d2_params_->getNcrFormat());
 
+    // DNS update batching is disabled by default.
+    EXPECT_EQ(0, d2_params_->getDnsUpdateBatchWindow());
+    EXPECT_EQ(16, d2_params_->getDnsUpdateBatchSize());
+
     // Verify that ip_address can be valid v6 address.
     config = makeParamsConfigString ("3001::5", 777, 333, "UDP", "JSON");
     RUN_CONFIG_OK(config);
@@ -262,6 +268,35 @@ TEST_F(D2CfgMgrTest, validParamsEntry) {
     // Verify the configuration summary.
     EXPECT_EQ("listening on 3001::5, port 777, using UDP",
               d2_params_->getConfigSummary());
+
+    // Verify that requests can be received in batches over TCP in the
+    // binary format.
+    config = makeParamsConfigString ("127.0.0.1", 777, 333, "TCP", "BINARY");
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(dhcp_ddns::NCR_TCP, d2_params_->getNcrProtocol());
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_params_->getNcrFormat());
+}
+
+/// @brief Tests the DNS update batching parameters.
+TEST_F(D2CfgMgrTest, dnsUpdateBatchParams) {
+    std::string config =
+            "{"
+            " \"ip-address\": \"192.0.0.1\" , "
+            " \"dns-update-batch-window\": 5 , "
+            " \"dns-update-batch-size\": 64 , "
+            "\"tsig-keys\": [], "
+            "\"forward-ddns\" : {}, "
+            "\"reverse-ddns\" : {} "
+            "}";
+
+    RUN_CONFIG_OK(config);
+    EXPECT_EQ(5, d2_params_->getDnsUpdateBatchWindow());
+    EXPECT_EQ(64, d2_params_->getDnsUpdateBatchSize());
+
+    // The batch size of 0 is rejected.
+    EXPECT_THROW(D2Params(isc::asiolink::IOAddress("192.0.0.1"), 777, 333,
+                          dhcp_ddns::NCR_UDP, dhcp_ddns::FMT_JSON, 5, 0),
+                 D2CfgError);
 }
 
 /// @brief Tests default values for D2Params.
@@ -434,15 +469,10 @@ TEST_F(D2CfgMgrTest, invalidEntry) {
     SYNTAX_ERROR(config, "<string>:1.92-98: syntax error,"
                          " unexpected constant string, expecting UDP or TCP");
 
-    // Unsupported protocol
-    config = makeParamsConfigString ("127.0.0.1", 777, 333, "TCP", "JSON");
-    LOGIC_ERROR(config, "ncr-protocol : TCP is not yet supported"
-                        "  (<string>:1:92)");
-
     // Invalid format
     config = makeParamsConfigString ("127.0.0.1", 777, 333, "UDP", "BOGUS");
     SYNTAX_ERROR(config, "<string>:1.115-121: syntax error,"
-                         " unexpected constant string, expecting JSON");
+                         " unexpected constant string, expecting JSON or BINARY");
 }
 
 // DdnsDomainList and TSIGKey tests moved to d2_simple_parser_unittest.cc
@@ -848,6 +878,72 @@ TEST_F(D2CfgMgrTest, matchReverse) {
     ASSERT_THROW(cfg_mgr_->matchReverse("", match), D2CfgError);
 }
 
+/// @brief Tests the domain matching with a large number of domains.
+/// It verifies that:
+/// 1. Each of the domains is matched by its name and its sub-domains.
+/// 2. The longest of nested domains is matched.
+/// 3. Names which don't end on the label boundary or differ in the trailing
+/// dot don't match.
+/// 4. Replacing the domain list replaces the domains used for matching.
+TEST(DdnsDomainListMgrTest, matchManyDomains) {
+    DdnsDomainListMgr mgr("reverse-ddns");
+    DnsServerInfoStoragePtr servers(new DnsServerInfoStorage());
+    DdnsDomainMapPtr domains(new DdnsDomainMap());
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 256; ++j) {
+            std::ostringstream name;
+            name << j << "." << i << ".10.IN-ADDR.ARPA.";
+            (*domains)[name.str()].reset(new DdnsDomain(name.str(), servers));
+        }
+    }
+    (*domains)["10.in-addr.arpa."].reset(new DdnsDomain("10.in-addr.arpa.",
+                                                        servers));
+    ASSERT_NO_THROW(mgr.setDomains(domains));
+    EXPECT_EQ(40 * 256 + 1, mgr.size());
+
+    DdnsDomainPtr match;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 256; j += 15) {
+            std::ostringstream name;
+            name << j << "." << i << ".10.IN-ADDR.ARPA.";
+            std::ostringstream fqdn;
+            fqdn << "7." << j << "." << i << ".10.in-addr.arpa.";
+            ASSERT_TRUE(mgr.matchDomain(fqdn.str(), match));
+            EXPECT_EQ(name.str(), match->getName());
+            ASSERT_TRUE(mgr.matchDomain(name.str(), match));
+            EXPECT_EQ(name.str(), match->getName());
+        }
+    }
+
+    // The enclosing domain matches the addresses out of the sub-domains.
+    ASSERT_TRUE(mgr.matchDomain("7.1.50.10.in-addr.arpa.", match));
+    EXPECT_EQ("10.in-addr.arpa.", match->getName());
+
+    // Partial labels and names without the trailing dot don't match.
+    match.reset();
+    EXPECT_FALSE(mgr.matchDomain("7.110.in-addr.arpa.", match));
+    EXPECT_FALSE(mgr.matchDomain("7.1.1.10.in-addr.arpa", match));
+    EXPECT_FALSE(mgr.matchDomain("in-addr.arpa.", match));
+    EXPECT_FALSE(match);
+
+    // Replace the domains with the wild card domain only.
+    domains.reset(new DdnsDomainMap());
+    (*domains)["*"].reset(new DdnsDomain("*", servers));
+    ASSERT_NO_THROW(mgr.setDomains(domains));
+    ASSERT_TRUE(mgr.matchDomain("7.1.1.10.in-addr.arpa.", match));
+    EXPECT_EQ("*", match->getName());
+
+    // Replace them with the list without the wild card domain.
+    domains.reset(new DdnsDomainMap());
+    (*domains)["example.com"].reset(new DdnsDomain("example.com", servers));
+    ASSERT_NO_THROW(mgr.setDomains(domains));
+    EXPECT_FALSE(mgr.getWildcardDomain());
+    match.reset();
+    EXPECT_FALSE(mgr.matchDomain("7.1.1.10.in-addr.arpa.", match));
+    ASSERT_TRUE(mgr.matchDomain("www.Example.Com", match));
+    EXPECT_EQ("example.com", match->getName());
+}
+
 /// @brief Tests D2 config parsing against a wide range of config permutations.
 ///
 /// It tests for both syntax errors that the JSON parsing (D2ParserContext)
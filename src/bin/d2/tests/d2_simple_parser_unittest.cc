@@ -274,7 +274,7 @@ TEST_F(D2SimpleParserTest, globalD2Defaults) {
     EXPECT_NO_THROW(num = D2SimpleParser::setAllDefaults(empty));
 
     // We expect 5 parameters to be inserted.
-    EXPECT_EQ(num, 8);
+    EXPECT_EQ(num, 10);
 
     // Let's go over all parameters we have defaults for.
     BOOST_FOREACH(SimpleDefault deflt, D2SimpleParser::D2_GLOBAL_DEFAULTS) {
@@ -845,6 +845,13 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
              "  \"ip-address\": \"192.168.5.6\" ,"
              "  \"port\": -100 }";
     PARSE_FAIL(config, "<string>:1.60-63: port must be greater than zero but less than 65536");
+
+    // Create a config with an unknown protocol.
+    // Verify that build fails.
+    config = "{ \"ip-address\": \"192.168.5.6\" ,"
+             "  \"protocol\": \"SCTP\" }";
+    PARSE_FAIL(config, "<string>:1.46-51: syntax error, unexpected "
+               "constant string, expecting UDP or TCP");
 }
 
 
@@ -880,10 +887,12 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     // Valid entries for static ip
     std::string config = " { \"hostname\" : \"\", "
                          "  \"ip-address\": \"127.0.0.1\" , "
-                         "  \"port\": 100 }";
+                         "  \"port\": 100, "
+                         "  \"protocol\": \"UDP\" }";
     PARSE_OK(config);
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "127.0.0.1", 100));
+    EXPECT_EQ(DNSClient::UDP, server_->getProtocol());
 
     // Verify unparsing.
     runToElementTest<DnsServerInfo>(config, *server_);
@@ -895,6 +904,15 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "192.168.2.5",
                             DnsServerInfo::STANDARD_DNS_PORT));
+    EXPECT_EQ(DNSClient::UDP, server_->getProtocol());
+
+    // Valid entries for static ip using TCP
+    config = " { \"ip-address\": \"192.168.2.5\", "
+             "  \"protocol\": \"TCP\" }";
+    PARSE_OK(config);
+    ASSERT_TRUE(server_);
+    EXPECT_EQ(DNSClient::TCP, server_->getProtocol());
+    EXPECT_EQ("192.168.2.5 port:53 protocol:TCP", server_->toText());
 }
 
 /// @brief Verifies that attempting to parse an invalid list of DnsServerInfo
@@ -1043,6 +1061,8 @@ TEST_F(DdnsDomainParserTest, validDomain) {
         ASSERT_NO_THROW(server_json = servers_json->getNonConst(i));
         ASSERT_NO_THROW(server_json->set("hostname",
                                          Element::create(std::string())));
+        ASSERT_NO_THROW(server_json->set("protocol",
+                                         Element::create(std::string("UDP"))));
     }
     runToElementTest<DdnsDomain>(json, *domain_);
 }
@@ -0,0 +1,291 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_service.h>
+#include <d2/d2_update_batcher.h>
+#include <dns/rcode.h>
+#include <dns/rrclass.h>
+#include <dns/rrset.h>
+#include <dns/rrttl.h>
+#include <dns/rrtype.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::d2;
+using namespace isc::dns;
+
+namespace {
+
+/// @brief Records the completions of a request.
+class TestCallback : public DNSClient::Callback {
+public:
+    /// @brief Constructor
+    TestCallback()
+        : response_(), status_(DNSClient::OTHER), calls_(0) {
+    }
+
+    /// @brief Records the status.
+    virtual void operator()(DNSClient::Status status) {
+        status_ = status;
+        ++calls_;
+    }
+
+    D2UpdateMessagePtr response_;
+    DNSClient::Status status_;
+    int calls_;
+};
+
+/// @brief Batcher recording the messages instead of sending them.
+class TestBatcher : public D2UpdateBatcher {
+public:
+    /// @brief Constructor
+    TestBatcher(const IOServicePtr& io_service, const size_t window,
+                const size_t max_size)
+        : D2UpdateBatcher(io_service, window, max_size) {
+    }
+
+    /// @brief Records the merged batch.
+    virtual void sendMerged(const D2UpdateBatchPtr& batch) {
+        merged_.push_back(batch);
+    }
+
+    /// @brief Records the request sent alone.
+    virtual void sendMember(const D2BatchMember& member) {
+        alone_.push_back(member.request_);
+    }
+
+    std::vector<D2UpdateBatchPtr> merged_;
+    std::vector<D2UpdateMessagePtr> alone_;
+};
+
+/// @brief Test fixture for testing the D2UpdateBatcher.
+class D2UpdateBatcherTest : public ::testing::Test {
+public:
+    /// @brief Constructor
+    D2UpdateBatcherTest()
+        : io_service_(new IOService()), server_("192.0.2.1") {
+    }
+
+    /// @brief Creates a request adding an address for the name.
+    ///
+    /// The request has a prerequisite that the name is not in use and
+    /// an update adding the A record.
+    ///
+    /// @param zone zone of the request.
+    /// @param name name to add.
+    D2UpdateMessagePtr makeRequest(const std::string& zone,
+                                   const std::string& name) {
+        D2UpdateMessagePtr request(new D2UpdateMessage(D2UpdateMessage::
+                                                       OUTBOUND));
+        request->setZone(Name(zone), RRClass::IN());
+        RRsetPtr prereq(new RRset(Name(name), RRClass::NONE(),
+                                  RRType::ANY(), RRTTL(0)));
+        request->addRRset(D2UpdateMessage::SECTION_PREREQUISITE, prereq);
+        RRsetPtr update(new RRset(Name(name), RRClass::IN(),
+                                  RRType::A(), RRTTL(0)));
+        request->addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+        return (request);
+    }
+
+    /// @brief Submits the request to the batcher.
+    void submit(TestBatcher& batcher, TestCallback& callback,
+                const D2UpdateMessagePtr& request,
+                const uint16_t port = 53) {
+        batcher.submit(DNSClientPtr(), callback.response_, &callback,
+                       server_, port, request, 100, TSIGKeyPtr());
+    }
+
+    /// @brief Completes the batch with the response code.
+    void respond(const D2UpdateBatchPtr& batch, const Rcode& rcode) {
+        batch->getResponse().reset(new D2UpdateMessage(D2UpdateMessage::
+                                                       OUTBOUND));
+        batch->getResponse()->setRcode(rcode);
+        (*batch)(DNSClient::SUCCESS);
+    }
+
+    IOServicePtr io_service_;
+    IOAddress server_;
+};
+
+// Verifies the batcher parameters are validated.
+TEST_F(D2UpdateBatcherTest, construction) {
+    EXPECT_THROW(D2UpdateBatcher(IOServicePtr(), 10, 16),
+                 D2UpdateBatcherError);
+    EXPECT_THROW(D2UpdateBatcher(io_service_, 0, 16), D2UpdateBatcherError);
+    EXPECT_THROW(D2UpdateBatcher(io_service_, 10, 0), D2UpdateBatcherError);
+    EXPECT_NO_THROW(D2UpdateBatcher(io_service_, 10, 16));
+}
+
+// Verifies the requests for the same zone are merged into one message
+// and its response completes all of them.
+TEST_F(D2UpdateBatcherTest, mergeAndComplete) {
+    TestBatcher batcher(io_service_, 1000, 3);
+    TestCallback callbacks[3];
+    submit(batcher, callbacks[0], makeRequest("example.com", "a.example.com"));
+    submit(batcher, callbacks[1], makeRequest("example.com", "b.example.com"));
+    EXPECT_EQ(2, batcher.getQueuedCount());
+    EXPECT_TRUE(batcher.merged_.empty());
+
+    // The third one fills the batch which is sent at once.
+    submit(batcher, callbacks[2], makeRequest("EXAMPLE.com", "c.example.com"));
+    EXPECT_EQ(0, batcher.getQueuedCount());
+    ASSERT_EQ(1, batcher.merged_.size());
+    EXPECT_EQ(1, batcher.getInFlightCount());
+    EXPECT_TRUE(batcher.alone_.empty());
+
+    // All prerequisites precede all updates.
+    D2UpdateBatchPtr batch = batcher.merged_[0];
+    D2UpdateMessagePtr request = batch->buildRequest();
+    EXPECT_EQ("example.com.", request->getZone()->getName().toText());
+    ASSERT_EQ(3, request->getRRCount(D2UpdateMessage::SECTION_PREREQUISITE));
+    ASSERT_EQ(3, request->getRRCount(D2UpdateMessage::SECTION_UPDATE));
+    RRsetIterator it =
+        request->beginSection(D2UpdateMessage::SECTION_PREREQUISITE);
+    EXPECT_EQ("a.example.com.", (*it)->getName().toText());
+    it = request->beginSection(D2UpdateMessage::SECTION_UPDATE);
+    EXPECT_EQ("a.example.com.", (*it)->getName().toText());
+    ++it;
+    EXPECT_EQ("b.example.com.", (*it)->getName().toText());
+
+    // Nobody is called back until the response arrives.
+    EXPECT_EQ(0, callbacks[0].calls_);
+    respond(batch, Rcode::NOERROR());
+    EXPECT_EQ(0, batcher.getInFlightCount());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(1, callbacks[i].calls_);
+        EXPECT_EQ(DNSClient::SUCCESS, callbacks[i].status_);
+        ASSERT_TRUE(callbacks[i].response_);
+        EXPECT_EQ(Rcode::NOERROR(), callbacks[i].response_->getRcode());
+    }
+}
+
+// Verifies the requests for different zones or servers and the requests
+// for the same name are not merged.
+TEST_F(D2UpdateBatcherTest, separateBatches) {
+    TestBatcher batcher(io_service_, 1000, 16);
+    TestCallback callbacks[4];
+    submit(batcher, callbacks[0], makeRequest("example.com", "a.example.com"));
+    submit(batcher, callbacks[1], makeRequest("example.org", "a.example.org"));
+    submit(batcher, callbacks[2], makeRequest("example.com", "b.example.com"),
+           5353);
+    EXPECT_EQ(3, batcher.getQueuedCount());
+    EXPECT_TRUE(batcher.merged_.empty());
+
+    // The name is already used by the first batch which must be sent
+    // alone before the new one collects the request.
+    submit(batcher, callbacks[3], makeRequest("example.com", "A.example.com"));
+    EXPECT_EQ(3, batcher.getQueuedCount());
+    EXPECT_TRUE(batcher.merged_.empty());
+    ASSERT_EQ(1, batcher.alone_.size());
+
+    // Flushing sends each of the remaining single requests alone.
+    batcher.flush();
+    EXPECT_EQ(0, batcher.getQueuedCount());
+    EXPECT_EQ(4, batcher.alone_.size());
+    EXPECT_TRUE(batcher.merged_.empty());
+}
+
+// Verifies the requests to the same server and zone are not merged when
+// they use different transport protocols.
+TEST_F(D2UpdateBatcherTest, separateProtocols) {
+    TestBatcher batcher(io_service_, 1000, 2);
+    TestCallback callbacks[3];
+    submit(batcher, callbacks[0], makeRequest("example.com", "a.example.com"));
+    batcher.submit(DNSClientPtr(), callbacks[1].response_, &callbacks[1],
+                   server_, 53, makeRequest("example.com", "b.example.com"),
+                   100, TSIGKeyPtr(), DNSClient::TCP);
+    EXPECT_EQ(2, batcher.getQueuedCount());
+    EXPECT_TRUE(batcher.merged_.empty());
+
+    // The second UDP request fills the UDP batch.
+    submit(batcher, callbacks[2], makeRequest("example.com", "c.example.com"));
+    EXPECT_EQ(1, batcher.getQueuedCount());
+    EXPECT_EQ(1, batcher.merged_.size());
+}
+
+// Verifies the requests are sent alone when a prerequisite of the merged
+// message fails.
+TEST_F(D2UpdateBatcherTest, prerequisiteFailure) {
+    TestBatcher batcher(io_service_, 1000, 2);
+    TestCallback callbacks[2];
+    D2UpdateMessagePtr request1 = makeRequest("example.com", "a.example.com");
+    D2UpdateMessagePtr request2 = makeRequest("example.com", "b.example.com");
+    submit(batcher, callbacks[0], request1);
+    submit(batcher, callbacks[1], request2);
+    ASSERT_EQ(1, batcher.merged_.size());
+
+    respond(batcher.merged_[0], Rcode::YXDOMAIN());
+    EXPECT_EQ(0, batcher.getInFlightCount());
+    ASSERT_EQ(2, batcher.alone_.size());
+    EXPECT_EQ(request1, batcher.alone_[0]);
+    EXPECT_EQ(request2, batcher.alone_[1]);
+    EXPECT_EQ(0, callbacks[0].calls_);
+    EXPECT_EQ(0, callbacks[1].calls_);
+}
+
+// Verifies an IO failure or other error is delivered to all requests and
+// the cancelled requests are not completed.
+TEST_F(D2UpdateBatcherTest, failureAndCancel) {
+    TestBatcher batcher(io_service_, 1000, 3);
+    TestCallback callbacks[4];
+    submit(batcher, callbacks[0], makeRequest("example.com", "a.example.com"));
+    submit(batcher, callbacks[1], makeRequest("example.com", "b.example.com"));
+
+    // Cancelling the collecting request removes it.
+    batcher.cancel(&callbacks[1]);
+    EXPECT_EQ(1, batcher.getQueuedCount());
+
+    submit(batcher, callbacks[2], makeRequest("example.com", "c.example.com"));
+    submit(batcher, callbacks[3], makeRequest("example.com", "d.example.com"));
+    ASSERT_EQ(1, batcher.merged_.size());
+
+    // Cancelling the request in flight removes it too.
+    batcher.cancel(&callbacks[3]);
+    (*batcher.merged_[0])(DNSClient::TIMEOUT);
+    EXPECT_EQ(0, batcher.getInFlightCount());
+    EXPECT_EQ(1, callbacks[0].calls_);
+    EXPECT_EQ(DNSClient::TIMEOUT, callbacks[0].status_);
+    EXPECT_EQ(0, callbacks[1].calls_);
+    EXPECT_EQ(1, callbacks[2].calls_);
+    EXPECT_EQ(DNSClient::TIMEOUT, callbacks[2].status_);
+    EXPECT_EQ(0, callbacks[3].calls_);
+
+    // The error response applies to all requests too.
+    TestCallback more[2];
+    submit(batcher, more[0], makeRequest("example.com", "a.example.com"));
+    submit(batcher, more[1], makeRequest("example.com", "b.example.com"));
+    batcher.flush();
+    ASSERT_EQ(2, batcher.merged_.size());
+    respond(batcher.merged_[1], Rcode::REFUSED());
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_EQ(1, more[i].calls_);
+        EXPECT_EQ(DNSClient::SUCCESS, more[i].status_);
+        ASSERT_TRUE(more[i].response_);
+        EXPECT_EQ(Rcode::REFUSED(), more[i].response_->getRcode());
+    }
+}
+
+// Verifies the batch is sent when its window ends.
+TEST_F(D2UpdateBatcherTest, windowExpires) {
+    TestBatcher batcher(io_service_, 10, 16);
+    TestCallback callbacks[2];
+    submit(batcher, callbacks[0], makeRequest("example.com", "a.example.com"));
+    submit(batcher, callbacks[1], makeRequest("example.com", "b.example.com"));
+    EXPECT_TRUE(batcher.merged_.empty());
+
+    // The timer is the only pending handler.
+    io_service_->run_one();
+    EXPECT_EQ(0, batcher.getQueuedCount());
+    EXPECT_EQ(1, batcher.merged_.size());
+}
+
+}
@@ -51,6 +51,7 @@ public:
     using D2UpdateMgr::checkFinishedTransactions;
     using D2UpdateMgr::pickNextJob;
     using D2UpdateMgr::makeTransaction;
+    using D2UpdateMgr::transactionFinished;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
@@ -172,6 +173,9 @@ public:
         trans->getNcr()->setStatus(status);
         // End the model.
         trans->endModel();
+        // Notify the manager as the transaction does when its model ends
+        // while processing IO.
+        update_mgr_->transactionFinished(key);
     }
 
     /// @brief Determines if any transactions are waiting for IO completion.
@@ -184,6 +188,7 @@ public:
             if (((*it).second)->isModelWaiting()) {
                 return true;
             }
+            ++it;
         }
 
         return false;
@@ -536,8 +541,9 @@ TEST_F(D2UpdateMgrTest, pickNextJob) {
     EXPECT_EQ(canned_count_, update_mgr_->getTransactionCount());
     EXPECT_EQ(1, update_mgr_->getQueueCount());
 
-    // Clear out the queue and transaction list.
+    // Clear out the queue, blocked requests and transaction list.
     queue_mgr_->clearQueue();
+    update_mgr_->clearBlockedRequests();
     update_mgr_->clearTransactionList();
 
     // Make a forward change NCR with an FQDN that has no forward match.
@@ -591,11 +597,11 @@ TEST_F(D2UpdateMgrTest, sweep) {
         EXPECT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i]));
     }
 
-    // Invoke sweep canned_count_ times which should create a
-    // transaction for each canned ncr.
+    // Invoke sweep once which should fill all of the free transaction
+    // slots, creating a transaction for each canned ncr.
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(canned_count_, update_mgr_->getTransactionCount());
     for (int i = 0; i < canned_count_; i++) {
-        EXPECT_NO_THROW(update_mgr_->sweep());
-        EXPECT_EQ(i + 1, update_mgr_->getTransactionCount());
         EXPECT_TRUE(update_mgr_->hasTransaction(canned_ncrs_[i]->getDhcid()));
     }
 
@@ -653,6 +659,63 @@ TEST_F(D2UpdateMgrTest, sweep) {
     EXPECT_EQ(0, update_mgr_->getTransactionCount());
 }
 
+/// @brief Tests D2UpdateManager's handling of requests for DHCIDs which
+/// have transactions in progress.
+/// This test verifies that:
+/// 1. Such requests are set aside without blocking the requests behind them.
+/// 2. They are started in the order received as the transactions complete.
+/// 3. Clearing the transaction list releases them.
+TEST_F(D2UpdateMgrTest, blockedRequests) {
+    // Queue up two more requests for the first DHCID followed by the
+    // canned requests.
+    std::vector<NameChangeRequestPtr> subsequent_ncrs;
+    for (int i = 0; i < 2; i++) {
+        subsequent_ncrs.push_back(NameChangeRequestPtr(
+                                  new NameChangeRequest(*(canned_ncrs_[0]))));
+    }
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[0]));
+    ASSERT_NO_THROW(queue_mgr_->enqueue(subsequent_ncrs[0]));
+    ASSERT_NO_THROW(queue_mgr_->enqueue(subsequent_ncrs[1]));
+    for (int i = 1; i < canned_count_; i++) {
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i]));
+    }
+
+    // Verify that a single sweep starts a transaction for each DHCID and
+    // sets the two subsequent requests aside.
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(canned_count_, update_mgr_->getTransactionCount());
+    EXPECT_EQ(0, queue_mgr_->getQueueSize());
+    EXPECT_EQ(2, update_mgr_->getBlockedCount());
+    EXPECT_EQ(2, update_mgr_->getQueueCount());
+
+    // Verify that completing another transaction does not release them.
+    completeTransaction(1, dhcp_ddns::ST_COMPLETED);
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(canned_count_ - 1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(2, update_mgr_->getBlockedCount());
+
+    // Verify that completing the first transaction starts the first of
+    // the subsequent requests.
+    completeTransaction(0, dhcp_ddns::ST_COMPLETED);
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(canned_count_ - 1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(1, update_mgr_->getBlockedCount());
+    TransactionList::iterator pos =
+        update_mgr_->findTransaction(canned_ncrs_[0]->getDhcid());
+    ASSERT_TRUE(pos != update_mgr_->transactionListEnd());
+    EXPECT_TRUE(pos->second->getNcr() == subsequent_ncrs[0]);
+
+    // Verify that clearing the transaction list releases the last one.
+    EXPECT_NO_THROW(update_mgr_->clearTransactionList());
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+    EXPECT_EQ(0, update_mgr_->getBlockedCount());
+    EXPECT_EQ(0, update_mgr_->getQueueCount());
+    pos = update_mgr_->findTransaction(canned_ncrs_[0]->getDhcid());
+    ASSERT_TRUE(pos != update_mgr_->transactionListEnd());
+    EXPECT_TRUE(pos->second->getNcr() == subsequent_ncrs[1]);
+}
+
 /// @brief Tests integration of NameAddTransaction
 /// This test verifies that update manager can create and manage a
 /// NameAddTransaction from start to finish.  It utilizes a fake server
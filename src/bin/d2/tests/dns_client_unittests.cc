@@ -11,12 +11,16 @@
 #include <asiodns/logger.h>
 #include <asiolink/interval_timer.h>
 #include <dns/messagerenderer.h>
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 #include <nc_test_utils.h>
+#include <algorithm>
 
 using namespace std;
 using namespace isc;
@@ -260,12 +264,11 @@ public:
     // callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
-
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
-                     isc::NotImplemented);
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
+        DNSTCPConnectionPoolPtr pool(new DNSTCPConnectionPool());
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP, pool));
+        EXPECT_EQ(DNSClient::TCP,
+                  DNSClient(response_, NULL, DNSClient::TCP).getProtocol());
     }
 
     // This test verifies that it accepted timeout values belong to the range of
@@ -558,4 +561,260 @@ TEST_F(DNSClientTest, DISABLED_concurrentSendReceive) {
     runSendReceiveTest(false, true);
 }
 
+/// @brief Stand-in DNS server accepting TCP connections.
+///
+/// The server reads the requests from the accepted connections and, once
+/// the expected number of requests is read, responds to all of them in
+/// the reverse order, so the client must match the responses with the
+/// requests by the ID. The response is the request with the QR flag set.
+class TCPStandIn {
+public:
+    /// @brief Constructor
+    ///
+    /// @param service IO service running the server.
+    /// @param expected number of requests to read before responding. If 0,
+    /// the server never responds.
+    TCPStandIn(IOService& service, const size_t expected)
+        : service_(service), acceptor_(service.get_io_service()),
+          expected_(expected), accepted_(0) {
+        tcp::endpoint endpoint(address::from_string(TEST_ADDRESS), TEST_PORT);
+        acceptor_.open(endpoint.protocol());
+        acceptor_.set_option(socket_base::reuse_address(true));
+        acceptor_.bind(endpoint);
+        acceptor_.listen();
+        accept();
+    }
+
+    /// @brief Accepts the next connection.
+    void accept() {
+        SocketPtr socket(new tcp::socket(service_.get_io_service()));
+        acceptor_.async_accept(*socket,
+                               boost::bind(&TCPStandIn::acceptHandler, this,
+                                           socket, _1));
+    }
+
+    /// @brief Starts reading the requests from the accepted connection.
+    void acceptHandler(const boost::shared_ptr<tcp::socket>& socket,
+                       const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        ++accepted_;
+        sockets_.push_back(socket);
+        readRequest(socket);
+        accept();
+    }
+
+    /// @brief Reads the next request, its length first.
+    void readRequest(const boost::shared_ptr<tcp::socket>& socket) {
+        boost::shared_ptr<std::vector<uint8_t> >
+            buf(new std::vector<uint8_t>(2));
+        boost::asio::async_read(*socket, boost::asio::buffer(&(*buf)[0], 2),
+                                boost::bind(&TCPStandIn::lengthHandler, this,
+                                            socket, buf, _1));
+    }
+
+    /// @brief Reads the request of the received length.
+    void lengthHandler(const boost::shared_ptr<tcp::socket>& socket,
+                       const boost::shared_ptr<std::vector<uint8_t> >& buf,
+                       const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        const size_t length = ((*buf)[0] << 8) | (*buf)[1];
+        buf->resize(2 + length);
+        boost::asio::async_read(*socket,
+                                boost::asio::buffer(&(*buf)[2], length),
+                                boost::bind(&TCPStandIn::requestHandler, this,
+                                            socket, buf, _1));
+    }
+
+    /// @brief Stores the request and responds when all are received.
+    void requestHandler(const boost::shared_ptr<tcp::socket>& socket,
+                        const boost::shared_ptr<std::vector<uint8_t> >& buf,
+                        const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        requests_.push_back(std::make_pair(socket, buf));
+        readRequest(socket);
+        if (requests_.size() != expected_) {
+            return;
+        }
+        while (!requests_.empty()) {
+            // See udpReceiveHandler for the QR flag.
+            std::vector<uint8_t>& response = *requests_.back().second;
+            response[2 + 2] = 0xA8;
+            boost::asio::write(*requests_.back().first,
+                               boost::asio::buffer(response));
+            requests_.pop_back();
+        }
+    }
+
+    /// @brief Pointer to a socket.
+    typedef boost::shared_ptr<tcp::socket> SocketPtr;
+
+    IOService& service_;
+    tcp::acceptor acceptor_;
+    size_t expected_;
+    size_t accepted_;
+    std::vector<SocketPtr> sockets_;
+    std::vector<std::pair<SocketPtr,
+                          boost::shared_ptr<std::vector<uint8_t> > > >
+    requests_;
+};
+
+/// @brief Callback recording the outcome of the exchanges over TCP.
+class TCPCallback : public DNSClient::Callback {
+public:
+    /// @brief Constructor
+    ///
+    /// @param service IO service stopped when all exchanges complete.
+    /// @param expected number of exchanges.
+    TCPCallback(IOService& service, const int expected)
+        : service_(service), expected_(expected), statuses_() {
+    }
+
+    /// @brief Records the status.
+    virtual void operator()(DNSClient::Status status) {
+        statuses_.push_back(status);
+        if (statuses_.size() == expected_) {
+            service_.stop();
+        }
+    }
+
+    IOService& service_;
+    size_t expected_;
+    std::vector<DNSClient::Status> statuses_;
+};
+
+/// @brief Creates a DNS Update request with the given ID.
+D2UpdateMessagePtr
+makeTCPRequest(const uint16_t id) {
+    D2UpdateMessagePtr message(new D2UpdateMessage(D2UpdateMessage::OUTBOUND));
+    message->setId(id);
+    message->setRcode(Rcode(Rcode::NOERROR_CODE));
+    message->setZone(Name("example.com"), RRClass::IN());
+    return (message);
+}
+
+// Verifies that the DNS Updates to a server configured to use TCP are
+// pipelined over a single persistent connection and the responses are
+// matched with the requests by ID.
+TEST_F(DNSClientTest, tcpPipelined) {
+    TCPStandIn server(service_, 3);
+    DNSTCPConnectionPoolPtr pool(new DNSTCPConnectionPool());
+    TCPCallback callback(service_, 3);
+
+    D2UpdateMessagePtr responses[3];
+    DNSClientPtr clients[3];
+    D2UpdateMessagePtr requests[3];
+    for (int i = 0; i < 3; ++i) {
+        clients[i].reset(new DNSClient(responses[i], &callback,
+                                       DNSClient::TCP, pool));
+        requests[i] = makeTCPRequest(100 + i);
+        ASSERT_NO_THROW(clients[i]->doUpdate(service_,
+                                             IOAddress(TEST_ADDRESS),
+                                             TEST_PORT, *requests[i], 2000));
+    }
+    EXPECT_EQ(1, pool->getConnectionCount(IOAddress(TEST_ADDRESS),
+                                          TEST_PORT));
+
+    service_.run();
+    service_.get_io_service().reset();
+
+    ASSERT_EQ(3, callback.statuses_.size());
+    EXPECT_EQ(1, server.accepted_);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(DNSClient::SUCCESS, callback.statuses_[i]);
+        ASSERT_TRUE(responses[i]);
+        EXPECT_EQ(D2UpdateMessage::RESPONSE, responses[i]->getQRFlag());
+        EXPECT_EQ(100 + i, responses[i]->getId());
+    }
+
+    // The next update reuses the open connection.
+    server.expected_ = 1;
+    TCPCallback next(service_, 1);
+    D2UpdateMessagePtr response;
+    DNSClient client(response, &next, DNSClient::TCP, pool);
+    D2UpdateMessagePtr request = makeTCPRequest(200);
+    ASSERT_NO_THROW(client.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                    TEST_PORT, *request, 2000));
+    service_.run();
+
+    ASSERT_EQ(1, next.statuses_.size());
+    EXPECT_EQ(DNSClient::SUCCESS, next.statuses_[0]);
+    EXPECT_EQ(1, server.accepted_);
+}
+
+// Verifies that a timeout is reported when the server accepts the TCP
+// connection but does not respond.
+TEST_F(DNSClientTest, tcpTimeout) {
+    TCPStandIn server(service_, 0);
+    TCPCallback callback(service_, 1);
+    D2UpdateMessagePtr response;
+    DNSClient client(response, &callback, DNSClient::TCP);
+    D2UpdateMessagePtr request = makeTCPRequest(1);
+    ASSERT_NO_THROW(client.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                    TEST_PORT, *request, 100));
+    service_.run();
+
+    ASSERT_EQ(1, callback.statuses_.size());
+    EXPECT_EQ(DNSClient::TIMEOUT, callback.statuses_[0]);
+    EXPECT_FALSE(response);
+}
+
+// Verifies that an IO error is reported when the TCP connection to the
+// server cannot be opened.
+TEST_F(DNSClientTest, tcpConnectFailure) {
+    TCPCallback callback(service_, 1);
+    D2UpdateMessagePtr response;
+    DNSClient client(response, &callback, DNSClient::TCP);
+    D2UpdateMessagePtr request = makeTCPRequest(1);
+    ASSERT_NO_THROW(client.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                    TEST_PORT, *request, 2000));
+    service_.run();
+
+    ASSERT_EQ(1, callback.statuses_.size());
+    EXPECT_EQ(DNSClient::OTHER, callback.statuses_[0]);
+}
+
+// Verifies that an IO error is reported when the request can't be sent
+// because its ID is in use on all connections, and that the error isn't
+// reported when the client is destroyed before it.
+TEST_F(DNSClientTest, tcpDuplicateId) {
+    TCPStandIn server(service_, 1);
+    DNSTCPConnectionPoolPtr pool(new DNSTCPConnectionPool(1));
+    TCPCallback callback(service_, 2);
+
+    D2UpdateMessagePtr response;
+    DNSClient client(response, &callback, DNSClient::TCP, pool);
+    D2UpdateMessagePtr request = makeTCPRequest(1);
+    ASSERT_NO_THROW(client.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                    TEST_PORT, *request, 2000));
+
+    D2UpdateMessagePtr duplicate_response;
+    DNSClient duplicate(duplicate_response, &callback, DNSClient::TCP, pool);
+    ASSERT_NO_THROW(duplicate.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                       TEST_PORT, *request, 2000));
+
+    {
+        D2UpdateMessagePtr destroyed_response;
+        DNSClient destroyed(destroyed_response, &callback, DNSClient::TCP,
+                            pool);
+        ASSERT_NO_THROW(destroyed.doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                           TEST_PORT, *request, 2000));
+    }
+
+    service_.run();
+
+    ASSERT_EQ(2, callback.statuses_.size());
+    EXPECT_EQ(1, std::count(callback.statuses_.begin(),
+                            callback.statuses_.end(), DNSClient::SUCCESS));
+    EXPECT_EQ(1, std::count(callback.statuses_.begin(),
+                            callback.statuses_.end(), DNSClient::OTHER));
+    ASSERT_TRUE(response);
+    EXPECT_FALSE(duplicate_response);
+}
+
 } // End of anonymous namespace
@@ -824,6 +824,40 @@ TEST_F(NameChangeTransactionTest, successfulUpdateTest) {
     EXPECT_TRUE(name_change->getForwardChangeCompleted());
 }
 
+/// @brief Records the keys of the completed transactions.
+///
+/// @param completed vector to which the key is appended.
+/// @param key key of the completed transaction.
+void
+recordCompletion(std::vector<TransactionKey>* completed,
+                 const TransactionKey& key) {
+    completed->push_back(key);
+}
+
+/// @brief Tests that the completion handler is invoked once the state
+/// model has run to its end.
+TEST_F(NameChangeTransactionTest, completionHandler) {
+    NameChangeStubPtr name_change;
+    ASSERT_NO_THROW(name_change = makeCannedTransaction());
+    ASSERT_TRUE(name_change->selectFwdServer());
+
+    std::vector<TransactionKey> completed;
+    name_change->setCompletionHandler(boost::bind(recordCompletion,
+                                                  &completed, _1));
+
+    // Verify that the handler is not invoked while waiting for IO.
+    ASSERT_NO_THROW(name_change->startTransaction());
+    EXPECT_TRUE(name_change->isModelWaiting());
+    EXPECT_TRUE(completed.empty());
+
+    // Verify that the handler is invoked with the transaction key once
+    // the IO completion runs the model to its end.
+    EXPECT_NO_THROW((*name_change)(DNSClient::SUCCESS));
+    EXPECT_TRUE(name_change->isModelDone());
+    ASSERT_EQ(1, completed.size());
+    EXPECT_TRUE(completed[0] == name_change->getTransactionKey());
+}
+
 /// @brief Tests the ability to use startTransaction to initiate the state
 /// model execution, and DNSClient callback, operator(), to resume the
 /// model with a update failure outcome.
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 154
-#define YY_END_OF_BUFFER 155
+#define YY_NUM_RULES 158
+#define YY_END_OF_BUFFER 159
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,143 +700,149 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1231] =
+static const flex_int16_t yy_accept[1286] =
     {   0,
-      147,  147,    0,    0,    0,    0,    0,    0,    0,    0,
-      155,  153,   10,   11,  153,    1,  147,  144,  147,  147,
-      153,  146,  145,  153,  153,  153,  153,  153,  140,  141,
-      153,  153,  153,  142,  143,    5,    5,    5,  153,  153,
-      153,   10,   11,    0,    0,  136,    0,    0,    0,    0,
+      151,  151,    0,    0,    0,    0,    0,    0,    0,    0,
+      159,  157,   10,   11,  157,    1,  151,  148,  151,  151,
+      157,  150,  149,  157,  157,  157,  157,  157,  144,  145,
+      157,  157,  157,  146,  147,    5,    5,    5,  157,  157,
+      157,   10,   11,    0,    0,  140,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      147,  147,    0,  146,  147,    3,    2,    6,    0,  147,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,  151,  151,    0,  150,  151,    3,    2,  150,    6,
+        0,  151,    0,    0,    0,    0,    0,    0,    4,    0,
 
-        0,  137,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  139,    0,    0,    0,
+        0,    9,    0,  141,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  143,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    2,  151,    0,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    2,    0,    0,    0,    0,    0,    0,    0,
-        8,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  138,    0,    0,    0,    0,
 
+        0,    0,    0,    0,  142,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   52,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   52,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  156,  154,    0,  153,  152,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  152,  150,    0,  149,  148,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  117,    0,
-      116,    0,    0,   58,    0,    0,    0,    0,    0,    0,
 
-        0,    0,   26,    0,    0,    0,    0,    0,    0,    0,
+      120,    0,  119,    0,    0,   58,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   26,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   56,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       15,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
-        0,    0,  151,  148,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  118,    0,    0,  120,    0,    0,
-        0,    0,    0,    0,    0,   59,    0,    0,    0,    0,
-
-       44,    0,    0,    0,    0,    0,   74,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   29,    0,    0,    0,
+       56,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   15,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   43,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   47,    0,   30,    0,
+        0,   16,    0,    0,    0,  155,  152,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  121,    0,
+
+        0,  124,    0,    0,    0,    0,    0,    0,    0,    0,
+       59,    0,    0,    0,    0,   44,    0,    0,    0,    0,
+        0,   74,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   29,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   72,   22,    0,
-       27,    0,    0,    0,    0,    0,    0,    0,    0,   12,
-      125,    0,  122,    0,  121,    0,    0,    0,   84,    0,
+       43,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   47,    0,   30,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   72,   22,    0,   27,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   12,  129,    0,  126,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   66,    0,    0,
+      125,    0,    0,    0,    0,   84,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   24,
+        0,    0,    0,    0,    0,   66,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       46,    0,    0,    0,    0,    0,    0,    0,    0,   85,
-        0,    0,    0,    0,    0,    0,    0,   80,    0,    0,
-        0,    0,    7,    0,    0,  123,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   24,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   46,    0,
+        0,    0,    0,    0,    0,    0,    0,   85,    0,    0,
+        0,    0,    0,    0,    0,   80,    0,    0,    0,    0,
+        7,    0,    0,    0,  127,  122,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   68,
-        0,    0,    0,    0,    0,    0,   64,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   49,    0,    0,
-        0,    0,    0,    0,    0,    0,   61,    0,    0,    0,
+       68,    0,    0,    0,    0,    0,    0,   64,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   49,    0,
+        0,    0,    0,    0,    0,    0,    0,   61,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   78,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   89,   62,    0,    0,    0,   67,   23,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+        0,   78,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,   89,   62,    0,    0,    0,
+       67,   23,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   31,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   40,
-        0,    0,    0,    0,    0,    0,  126,    0,    0,    0,
+        0,   40,    0,    0,    0,    0,    0,    0,  130,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   55,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   79,    0,    0,
+        0,    0,   34,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   28,    0,    0,
+
+        0,    0,   21,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   69,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   55,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   79,    0,    0,    0,    0,   34,
+        0,    0,   76,    0,    0,    0,    0,    0,    0,  104,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   28,    0,    0,    0,    0,   21,
+        0,    0,    0,   50,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   69,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   18,    0,    0,    0,    0,
+        0,    0,    0,  109,    0,    0,  107,    0,    0,    0,
+        0,    0,    0,    0,  134,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   76,    0,    0,
-        0,    0,    0,    0,  101,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   50,    0,
+        0,    0,   77,    0,    0,    0,    0,   81,   65,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   75,    0,   17,    0,   86,    0,    0,    0,
+        0,    0,  113,    0,    0,    0,   41,    0,    0,    0,
+        0,   88,   25,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       18,    0,    0,    0,    0,    0,    0,  106,    0,    0,
-      104,    0,    0,    0,    0,    0,    0,    0,  130,    0,
-        0,    0,    0,    0,    0,   77,    0,    0,    0,    0,
-       81,   65,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   75,    0,   17,    0,   86,
-
-        0,    0,    0,    0,    0,  110,    0,    0,    0,   41,
-        0,    0,    0,    0,   88,   25,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   45,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   83,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   45,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   83,    0,
+        0,    0,    0,  137,   42,   57,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,   37,    0,    0,    0,  110,
+        0,  108,  103,  102,    0,    0,    0,    0,    0,    0,
+      123,    0,    0,    0,   71,    0,    0,    0,    0,    0,
+        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   51,    0,    0,   32,    0,    0,    0,    0,    0,
+      112,    0,    0,    0,    0,   53,   38,    0,    0,   82,
+        0,    0,   73,    0,    0,   48,    0,  132,    0,  131,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  133,   42,   57,    0,    0,    0,
-        0,    0,    0,    0,    0,   37,    0,    0,    0,  107,
-        0,  105,  100,   99,    0,    0,    0,    0,    0,    0,
-      119,    0,    0,   71,    0,    0,    0,    0,    0,    0,
-
-       97,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       51,    0,    0,   32,    0,    0,    0,    0,  109,    0,
-        0,    0,    0,   53,   38,    0,   82,    0,    0,   73,
-        0,    0,   48,    0,  128,    0,  127,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  135,   70,    0,   35,   98,    0,
-        0,  131,  102,    0,    0,    0,    0,    0,    0,   20,
-        0,   19,    0,  108,    0,    0,   63,    0,    0,    0,
-
-        0,    0,    0,    0,    0,   36,    0,    0,    0,   33,
-        0,    0,    0,    0,    0,    0,   87,    0,    0,  132,
-        0,    0,    0,    0,    0,    0,    0,    0,  134,    0,
-      129,  124,    0,    0,   14,    0,    0,  115,    0,    0,
-        0,    0,   95,    0,    0,    0,    0,    0,   54,    0,
-        0,    0,    0,    0,    0,    0,   13,    0,    0,    0,
-      103,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       94,    0,  112,    0,    0,    0,  111,    0,    0,    0,
-       93,    0,    0,    0,  114,    0,    0,    0,    0,    0,
+        0,  139,   70,    0,   35,  101,    0,    0,  135,  105,
+        0,    0,    0,    0,    0,    0,   20,    0,   19,    0,
+      111,    0,    0,    0,   63,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   36,    0,    0,    0,    0,   33,
+        0,    0,    0,    0,    0,    0,   87,    0,    0,  136,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  113,    0,    0,    0,    0,    0,
-        0,   91,   96,   39,    0,    0,    0,   90,    0,    0,
-        0,    0,    0,    0,    0,   60,    0,    0,   92,    0
+      138,    0,  133,  128,    0,    0,    0,   14,    0,    0,
+      118,    0,    0,    0,    0,   99,   95,    0,    0,    0,
+        0,    0,    0,   54,    0,    0,    0,    0,    0,    0,
+
+        0,    0,   13,    0,    0,    0,  106,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   94,    0,
+      115,    0,    0,    0,    0,  114,    0,    0,    0,    0,
+       93,    0,    0,    0,    0,  117,    0,    0,    0,    0,
+        0,    0,    0,   98,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   97,    0,    0,    0,    0,  116,
+        0,    0,    0,    0,    0,    0,   91,   96,   39,    0,
+        0,    0,   90,    0,    0,    0,    0,    0,    0,    0,
+       60,    0,    0,   92,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -848,11 +854,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,   27,    5,   28,    5,   29,    5,   30,   31,   32,
-        5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
-       40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
+        5,   27,   28,   29,    5,   30,    5,   31,   32,   33,
+        5,   34,   35,   36,   37,   38,   39,    5,   40,    5,
+       41,   42,   43,    5,   44,    5,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
+       49,   50,   51,   52,   53,   29,   54,   55,   56,   57,
        58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
        68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -873,679 +879,852 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[72] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1
     } ;
 
-static const flex_int16_t yy_base[1243] =
+static const flex_int16_t yy_base[1286] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1593, 1594,   32, 1589,  141,    0,  201, 1594,  206,   88,
-       11,  213, 1594, 1571,  114,   25,    2,    6, 1594, 1594,
-       73,   11,   17, 1594, 1594, 1594,  104, 1577, 1532,    0,
-     1569,  107, 1584,  217,  247, 1594, 1528,  185, 1527, 1533,
-       93,   58, 1525,   91,  211,  195,   14,  273,  195, 1524,
-      181,  275,  202,  209, 1533,   66,  188, 1532,  232,  219,
-      296,  282,  207, 1515,   78,  290,  310,  304, 1534,    0,
-      348,  360,  368,  374,  377, 1594,    0, 1594,  301,  353,
-      223,  295,  196,  300,  351,  210, 1594, 1531, 1570, 1594,
-
-      319, 1594,  388, 1559,  315, 1517, 1527,  358,  301, 1522,
-      333,  365,  359,  368,  241, 1565,    0,  439,  365, 1509,
-     1511, 1507, 1515,   74, 1511, 1500, 1501,   89, 1517, 1500,
-     1509, 1509,  361, 1500,  362, 1501,  354, 1546, 1550, 1492,
-     1543, 1485, 1508, 1505, 1505, 1499,  348, 1492, 1485, 1490,
-     1484,  367, 1495, 1480, 1479, 1493,  356, 1479,  377, 1495,
-      286,  435,  379, 1492, 1493, 1491, 1473, 1475,  382, 1467,
-     1484, 1476,    0,  385,  401,  418,  408,  419,  425, 1475,
-     1594,    0, 1518,  438, 1465, 1468,  433,  439, 1476,  443,
-     1519,  450, 1518,  442, 1517, 1594,  486, 1516,  472, 1477,
-
-     1457, 1473, 1470, 1469,  414, 1510, 1504, 1470, 1449, 1457,
-     1452, 1466, 1462, 1450, 1462, 1462, 1453, 1437, 1441, 1454,
-     1454, 1446, 1436, 1454, 1594, 1449, 1452, 1433, 1432, 1482,
-     1431, 1441, 1444,  478, 1440, 1428, 1439, 1475, 1422, 1478,
-     1431,    9, 1421, 1437, 1418, 1417, 1423, 1414, 1413, 1420,
-     1422, 1467, 1425, 1424, 1418,  448, 1425, 1420, 1412, 1418,
-     1418, 1399, 1415, 1408, 1415, 1403, 1396, 1410, 1451, 1412,
-     1394, 1402,  479, 1594, 1594,  480, 1594, 1594, 1389,    0,
-      461,  389, 1391,  502,  489, 1445, 1398,  486, 1594, 1443,
-     1594, 1437,  534, 1594,  476, 1379, 1435, 1381, 1387, 1437,
-
-     1394,  477, 1594, 1392, 1434, 1389, 1386,  509, 1392, 1430,
-     1424, 1379, 1374, 1371, 1420, 1379, 1368, 1417, 1365,  530,
-     1379, 1364, 1377, 1364, 1374, 1369, 1376, 1371, 1367,  485,
-     1365, 1368, 1363, 1359, 1407,  480, 1401, 1594, 1353, 1352,
-     1345, 1347, 1351, 1340, 1353,  359, 1398, 1353, 1350, 1354,
-     1594, 1352, 1341, 1341, 1353, 1335, 1327, 1328, 1349, 1331,
-     1343, 1342, 1328, 1340, 1339, 1338, 1379, 1378, 1594, 1322,
-      555, 1335, 1594, 1594, 1334,    0, 1323, 1315,  491, 1320,
-     1371, 1370, 1328, 1368, 1594, 1316, 1366, 1594,  532,  579,
-      508, 1365, 1321, 1317, 1305, 1594, 1321, 1320, 1307, 1306,
-
-     1594, 1308, 1305,  273, 1303, 1305, 1594, 1313, 1310, 1295,
-     1308, 1303,  557, 1310, 1292, 1341, 1594, 1290, 1306, 1338,
-     1301, 1298, 1299, 1301, 1333, 1286, 1281, 1280, 1329, 1275,
-     1290, 1268, 1275, 1280, 1328, 1594, 1275, 1271, 1269, 1273,
-     1280, 1265, 1275, 1278, 1267, 1262, 1594, 1317, 1594, 1261,
-     1272, 1309, 1256, 1261, 1270, 1264, 1268, 1308, 1302, 1266,
-     1246, 1249, 1248, 1256, 1244, 1300, 1242, 1594, 1594, 1247,
-     1594, 1257, 1291, 1253,    0, 1237, 1254, 1292, 1242, 1594,
-     1594, 1239, 1594, 1245, 1594,  538,  538,  561, 1594, 1242,
-     1230, 1281, 1228, 1227, 1234, 1227, 1239, 1238, 1238, 1226,
-
-     1267, 1234, 1226, 1269, 1215, 1231, 1230, 1594, 1215, 1212,
-     1226, 1218, 1224, 1215, 1223, 1208, 1224, 1206, 1220, 1218,
-     1201, 1195, 1200, 1215, 1212, 1213, 1210, 1251, 1208, 1594,
-     1194, 1196, 1205, 1241, 1240,  545, 1203, 1186, 1187, 1184,
-     1594, 1198, 1177, 1198, 1195, 1187, 1230, 1184, 1228, 1594,
-     1175, 1189, 1192, 1224, 1223, 1170, 1221, 1594,  559, 1183,
-     1172, 1174, 1594, 1180, 1170, 1594, 1215, 1163, 1218,  549,
-      527,  524, 1168, 1211,  561, 1210, 1209, 1208, 1162, 1152,
-     1205, 1158, 1168, 1202, 1165, 1159, 1146, 1154, 1197, 1201,
-     1158, 1157, 1158, 1151, 1140, 1153, 1156, 1151, 1152, 1149,
-
-     1148, 1151, 1146, 1187, 1186, 1136, 1126, 1134, 1182, 1594,
-     1181, 1130, 1122, 1123, 1136, 1123, 1594, 1123, 1132, 1131,
-     1131, 1171, 1114, 1123, 1116, 1127, 1104, 1108, 1159, 1106,
-     1116, 1156, 1103,  538,  557, 1097,  554, 1594, 1158, 1116,
-     1105, 1109, 1099, 1111, 1114, 1151, 1594, 1145,  572, 1098,
-     1106, 1105, 1100, 1096, 1103, 1086, 1089, 1085, 1102, 1097,
-     1085, 1081, 1088, 1082, 1134, 1091, 1079, 1093, 1081, 1594,
-     1089, 1087, 1078, 1087, 1083, 1124, 1066, 1066, 1079, 1064,
-     1119, 1061, 1062, 1594, 1594, 1070, 1073, 1076, 1594, 1594,
-     1075, 1060, 1052,  529, 1058, 1056, 1103, 1052, 1106, 1594,
-
-     1051, 1053, 1053, 1045, 1101, 1054, 1042, 1036, 1047, 1056,
-     1049, 1041, 1041, 1040, 1038, 1038, 1089,   15,   70, 1594,
-      226,  225,  308,  409,  413,  428, 1594,  578,  573,  476,
-      497,  574,  567,  571,  612,  567,  562,  564,  566,  575,
-      570,  626,  585,  577, 1594,  579,  591,  576,  592,  586,
-      631,  599,  583,  584, 1594,  602,  585,  642,  587, 1594,
-      606,  586,  604,  643,  603,  593,  611,  610,  596,  611,
-      603,  599,  617,  602, 1594,  610,  616,  611,  662, 1594,
-      613,  618,  612,  624,  618,  617,  670,  616,  616,  673,
-      619, 1594,  625,  623,  622,  636,  637,  642,  681,  640,
-
-      656,  661,  635,  645,  636,  688,  633, 1594,  640,  645,
-      652,  693,  694,  643, 1594,  639,  642,  642,  662,  659,
-      664,  665,  651,  659,  668,  648,  669,  709, 1594,  664,
-      713,  714,  676,  678,  666,  663,  670,  721,  670,  668,
-      686,  725,  677,  681,  679,  677,  730,  731,  727,  687,
-     1594,  692,  685,  694,  682,  692,  688, 1594,  683,  684,
-     1594,  685,  701,  702,  703,  685,  690,  708, 1594,  698,
-      731,  722,  694,  753,  716, 1594,  699,  714,  706,  710,
-     1594, 1594,  720,  755,  704,  757,  706,  764,  709,  720,
-      712,  718,  714,  732,  733, 1594,  731, 1594,  734, 1594,
-
-      737,  727,  720,  732,  775, 1594,  732,  782,  783, 1594,
-      784,  733,  740,  782, 1594, 1594,  732,  732,  735,  749,
-      736,  793,  752,  790,  796,  746,  798,  799,  800,  761,
-      745,  757,  762,  748,  778,  807,  767, 1594,  759,  810,
-      759,  755,  771,  776,  758,  816,  771,  776, 1594,  777,
-      770,  779,  780,  777,  767,  769,  826,  775,  772,  829,
-      825,  768,  783,  833, 1594, 1594, 1594,  784,  794,  779,
-      780,  839,  841,  787,  843, 1594,  793,  795,  847, 1594,
-      810, 1594, 1594, 1594,  800,  850,  801,  853,  854,  836,
-     1594,  814,  815, 1594,  803,  802,  805,  805,  806,  802,
-
-     1594,  824,  810,  811,  826,  826,  829,  829,  826,  831,
-     1594,  823,  833, 1594,  830,  835,  837,  834, 1594,  825,
-      831,  830,  841, 1594, 1594,  880, 1594,  829,  835, 1594,
-      838,  851, 1594,  848, 1594,  845, 1594,  868,  888,  894,
-      895,  839,  897,  898,  853,  847,  901,  902,  898,  863,
-      859,  901,  851,  856,  909,  867,  911,  871,  913,  876,
-      865,  916,  860,  877,  877,  861,  917,  882,  882,  879,
-      926,  886,  899,  886, 1594, 1594,  930, 1594, 1594,  879,
-      890, 1594, 1594,  880,  929,  874,  879,  937,  887, 1594,
-      893, 1594,  940, 1594,  885,  900, 1594,  938,  906,  899,
-
-      908,  896,  906,  949,  900, 1594,  951,  952,  899, 1594,
-      903,  955,  902,  901,  959,  914, 1594,  956,  918, 1594,
-      921,  964,  907,  909,  906,  922,  931,  970, 1594,  966,
-     1594, 1594,  931,  968, 1594,  922,  929, 1594,  926,  931,
-      978,  923, 1594,  927,  939,  982,  926,  934, 1594,  945,
-      935,  934,  948,  939,  948,  950, 1594,  992,  952,  994,
-     1594,  990,  954,  935,  998,  957,  958,  959, 1002,  961,
-     1594,  966, 1594,  948, 1006,  967, 1594,  953,  953,  955,
-     1594,  960,  955,  967, 1594,  965,  969,  960, 1012,  961,
-      977,  970,  979,  970,  977,  964,  979, 1026,  985,  972,
-
-      988,  979,  993,  989, 1594, 1033, 1034, 1035,  992,  991,
-      992, 1594, 1594, 1594, 1039,  983,  999, 1594, 1037,  988,
-      987,  989, 1000, 1047,  998, 1594, 1007, 1050, 1594, 1594,
-     1056, 1061, 1066, 1071, 1076, 1081, 1086, 1089, 1063, 1068,
-     1070, 1083
+        0,    0,   71,    0,  137,    0,  139,    0,  150,    0,
+       74,    0,  155,  155,  208,  279,  339,    0,  150,  160,
+      169,  169,    0,  140,  182,  150,  124,  145,    0,    0,
+      122,  105,  120,    0,    0,    0,    0,  176,  142,  382,
+      182,    0,  199,  453,  510,    0,  145,  322,  328,  146,
+      153,  337,  491,  224,  336,  554,  503,  502,  615,  302,
+      314,  307,  533,  481,  311,  319,  312,  532,  322,  534,
+      545,  551,  543,  554,  309,  330,  486,  546,  639,  329,
+        0,    0,    0,    0,    0,    0,    0,  698,    0,    0,
+      570,  590,  740,  741,  735,  321,  325,  466,    0,  490,
+
+      796,    0,    0,    0,  862,  526,  830,  840,  486,  505,
+      840,  840,  558,  835,  843,  837,  844,  856,  923,    0,
+        0,  994,  718,  549,  564,  630,  628,  637,  726,  636,
+      627,  630,  648,  650,  636,  722,  724,  732,  719,  829,
+      723,  727,  770,  780,  724,  777,  722,  746,  745,  747,
+      743,  816,  824,  820,  828,  824,  819,  837,  825,  826,
+      841,  830,  833,  848,  854,  848, 1055,  856,  864,  870,
+      870,  856,  861,  863,  858, 1018, 1013,    0,    0, 1034,
+     1040, 1048, 1009, 1017, 1025, 1020,    0,    0,    0, 1104,
+     1065, 1058, 1059, 1014, 1019, 1046, 1052, 1054, 1057, 1080,
+
+     1064, 1078, 1059,    0,    0,    0, 1118, 1081, 1043, 1092,
+     1070, 1082, 1044, 1045, 1044, 1098, 1093, 1110, 1077, 1112,
+     1083, 1101, 1090, 1098, 1100, 1116, 1124, 1124, 1118, 1111,
+     1123, 1127, 1125, 1117, 1136,    0, 1133, 1138, 1122, 1124,
+     1176, 1127, 1139, 1144, 1181, 1143, 1145, 1145, 1185, 1134,
+     1192, 1146, 1189, 1140, 1157, 1141, 1144, 1152, 1145, 1146,
+     1155, 1158, 1206, 1165, 1166, 1162, 1161, 1172, 1169, 1165,
+     1172, 1174, 1163, 1175, 1171, 1179, 1170, 1166, 1181, 1225,
+     1187, 1172, 1181, 1211,    0,    0, 1188,    0,    0, 1174,
+     1240, 1187, 1201, 1210, 1178, 1235, 1227, 1236, 1192, 1213,
+
+        0, 1247,    0, 1246, 1279,    0, 1199, 1228, 1219, 1261,
+     1209, 1218, 1271, 1229, 1236,    0, 1229, 1274, 1231, 1230,
+     1295, 1238, 1285, 1287, 1244, 1248, 1247, 1298, 1262, 1250,
+     1301, 1251, 1309, 1268, 1256, 1270, 1260, 1272, 1269, 1278,
+     1282, 1280, 1273, 1282, 1287, 1284, 1283, 1333, 1290, 1330,
+        0, 1284, 1285, 1280, 1284, 1294, 1291, 1295, 1345, 1346,
+     1302, 1301, 1307,    0, 1307, 1300, 1302, 1315, 1300, 1294,
+     1297, 1319, 1304, 1318, 1319, 1308, 1321, 1323, 1324, 1368,
+     1369,    0, 1315, 1371, 1330,    0,    0, 1331, 1369, 1323,
+     1317, 1351, 1356, 1329, 1382, 1383, 1349, 1392,    0, 1342,
+
+     1394,    0, 1370, 1416, 1340, 1398, 1344, 1356, 1355, 1346,
+        0, 1363, 1364, 1354, 1362,    0, 1366, 1365, 1385, 1365,
+     1370,    0, 1379, 1379, 1372, 1386, 1383, 1437, 1399, 1384,
+     1435,    0, 1388, 1405, 1440, 1404, 1403, 1406, 1410, 1445,
+     1400, 1397, 1398, 1449, 1403, 1419, 1403, 1409, 1416, 1467,
+        0, 1416, 1414, 1414, 1420, 1428, 1416, 1427, 1432, 1424,
+     1421,    0, 1478,    0, 1424, 1436, 1476, 1425, 1432, 1442,
+     1438, 1444, 1487, 1483, 1448, 1431, 1436, 1437, 1446, 1437,
+     1495, 1439,    0,    0, 1446,    0, 1457, 1494, 1457, 1493,
+     1447, 1465, 1506, 1507, 1465,    0,    0, 1464,    0, 1471,
+
+        0, 1491, 1490, 1456, 1520,    0, 1469, 1475, 1466, 1519,
+     1469, 1470, 1479, 1474, 1487, 1488, 1496, 1487, 1530, 1498,
+     1493, 1539, 1488, 1505, 1506,    0, 1494, 1493, 1508, 1503,
+     1510, 1504, 1513, 1501, 1518, 1503, 1518, 1518, 1504, 1500,
+     1507, 1523, 1522, 1525, 1524, 1568, 1526,    0, 1515, 1519,
+     1529, 1568, 1569, 1575, 1534, 1520, 1523, 1522,    0, 1537,
+     1519, 1541, 1540, 1535, 1580, 1536, 1582,    0, 1531, 1546,
+     1551, 1586, 1587, 1537, 1590,    0, 1596, 1554, 1546, 1550,
+        0, 1619, 1557, 1550,    0,    0, 1597, 1547, 1604, 1655,
+     1667, 1640, 1548, 1558, 1603, 1647, 1604, 1605, 1606, 1562,
+
+     1630, 1685, 1640, 1651, 1688, 1653, 1650, 1640, 1650, 1695,
+     1702, 1658, 1660, 1663, 1658, 1650, 1664, 1708, 1666, 1672,
+     1671, 1672, 1677, 1674, 1718, 1719, 1671, 1663, 1673, 1723,
+        0, 1724, 1675, 1669, 1672, 1686, 1676,    0, 1678, 1688,
+     1689, 1691, 1734, 1679, 1689, 1685, 1697, 1677, 1683, 1736,
+     1685, 1696, 1739, 1688, 1699, 1702, 1688, 1700,    0, 1753,
+     1712, 1705, 1711, 1704, 1721, 1722, 1762,    0, 1758, 1736,
+     1715, 1724, 1717, 1726, 1723, 1722, 1730, 1730, 1721, 1719,
+     1737, 1734, 1725, 1723, 1732, 1728, 1782, 1740, 1731, 1746,
+     1742,    0, 1745, 1754, 1739, 1753, 1754, 1798, 1742, 1744,
+
+     1758, 1746, 1803, 1747, 1750,    0,    0, 1759, 1764, 1769,
+        0,    0, 1770, 1768, 1752, 1773, 1761, 1762, 1812, 1763,
+     1819,    0, 1767, 1771, 1773, 1767, 1825, 1821, 1771, 1767,
+     1780, 1790, 1785, 1780, 1782, 1783, 1783, 1785, 1838, 1800,
+     1778,    0, 1836, 1785, 1799, 1800, 1788, 1801,    0, 1820,
+     1831, 1808, 1800, 1810, 1848, 1812, 1816, 1856, 1810, 1806,
+     1807, 1803, 1812, 1817, 1863, 1821, 1814,    0, 1816, 1827,
+     1813, 1828, 1826, 1871, 1838, 1823, 1824,    0, 1841, 1826,
+     1883, 1828,    0, 1846, 1830, 1844, 1885, 1844, 1835, 1852,
+     1851, 1838, 1852, 1845, 1841, 1858, 1844,    0, 1852, 1857,
+
+     1853, 1904,    0, 1855, 1857, 1860, 1855, 1867, 1863, 1861,
+     1914, 1860, 1860, 1917, 1863,    0, 1869, 1867, 1866, 1879,
+     1880, 1885, 1925, 1883, 1899, 1904, 1879, 1888, 1926, 1907,
+     1933, 1878,    0, 1885, 1889, 1896, 1938, 1940, 1889,    0,
+     1885, 1888, 1887, 1907, 1904, 1909, 1910, 1897, 1904, 1913,
+     1894, 1916, 1957,    0, 1912, 1960, 1961, 1922, 1924, 1913,
+     1910, 1918, 1969, 1918, 1916, 1933, 1973, 1925, 1928, 1927,
+     1925, 1978, 1979, 1975, 1934,    0, 1939, 1936, 1934, 1942,
+     1931, 1940, 1937,    0, 1932, 1933,    0, 1934, 1949, 1950,
+     1951, 1955, 1939, 1956,    0, 1947, 1980, 1970, 1943, 2002,
+
+     1948, 1966,    0, 1950, 1964, 1957, 1961,    0,    0, 1970,
+     2006, 1955, 2008, 1957, 2015, 1961, 1971, 1964, 1970, 1966,
+     1983, 1985,    0, 1983,    0, 1985,    0, 1989, 1980, 1973,
+     1984, 2027,    0, 1984, 2034, 2035,    0, 2036, 1985, 1991,
+     2034,    0,    0, 1984, 1984, 1987, 2002, 2001, 1989, 2046,
+     2004, 2043, 2049, 1999, 2051, 2052, 2053, 2013, 1998, 2009,
+     2014, 2001, 2030, 2060, 2019,    0, 2019, 2013, 2064, 2013,
+     2009, 2024, 2029, 2012, 2070, 2024, 2029,    0, 2030, 2024,
+     2032, 2033, 2030, 2021, 2023, 2080, 2029, 2026, 2083, 2079,
+     2022, 2038, 2088,    0,    0,    0, 2038, 2047, 2033, 2034,
+
+     2094, 2096, 2054, 2043, 2100,    0, 2050, 2052, 2103,    0,
+     2065,    0,    0,    0, 2056, 2106, 2058, 2109, 2110, 2092,
+        0, 2069, 2072, 2072,    0, 2060, 2059, 2062, 2062, 2063,
+     2063,    0, 2080, 2067, 2068, 2083, 2083, 2086, 2086, 2083,
+     2088,    0, 2081, 2090,    0, 2087, 2093, 2094, 2099, 2092,
+        0, 2084, 2090, 2089, 2099,    0,    0, 2139, 2140,    0,
+     2089, 2095,    0, 2098, 2110,    0, 2107,    0, 2104,    0,
+     2127, 2148, 2105, 2155, 2156, 2100, 2158, 2159, 2114, 2109,
+     2163, 2164, 2160, 2124, 2120, 2163, 2113, 2118, 2171, 2128,
+     2173, 2132, 2175, 2137, 2120, 2129, 2180, 2124, 2140, 2139,
+
+     2135, 2135, 2181, 2145, 2145, 2142, 2190, 2149, 2162, 2149,
+     2155,    0,    0, 2196,    0,    0, 2145, 2155,    0,    0,
+     2146, 2195, 2140, 2145, 2203, 2153,    0, 2158,    0, 2206,
+        0, 2151, 2165, 2166,    0, 2205, 2172, 2165, 2170, 2175,
+     2164, 2173, 2217, 2168,    0, 2220, 2221, 2168, 2173,    0,
+     2173, 2225, 2171, 2170, 2229, 2183,    0, 2226, 2187,    0,
+     2190, 2234, 2235, 2178, 2180, 2177, 2200, 2193, 2202, 2242,
+        0, 2238,    0,    0, 2202, 2206, 2241,    0, 2195, 2201,
+        0, 2199, 2203, 2251, 2196,    0,    0, 2200, 2211, 2255,
+     2200, 2200, 2208,    0, 2218, 2209, 2204, 2209, 2222, 2214,
+
+     2222, 2224,    0, 2267, 2226, 2269,    0, 2227, 2266, 2229,
+     2211, 2274, 2228, 2233, 2234, 2235, 2279, 2237,    0, 2242,
+        0, 2226, 2226, 2284, 2244,    0, 2234, 2232, 2232, 2234,
+        0, 2239, 2234, 2292, 2246,    0, 2245, 2244, 2249, 2241,
+     2293, 2242, 2257,    0, 2251, 2259, 2303, 2252, 2258, 2246,
+     2260, 2308, 2266, 2254,    0, 2269, 2261, 2274, 2270,    0,
+     2315, 2316, 2317, 2273, 2272, 2273,    0,    0,    0, 2321,
+     2265, 2280,    0, 2319, 2270, 2269, 2271, 2281, 2329, 2280,
+        0, 2288, 2332,    0, 2339
     } ;
 
-static const flex_int16_t yy_def[1243] =
+static const flex_int16_t yy_def[1286] =
     {   0,
-     1231, 1231, 1232, 1232, 1231, 1231, 1231, 1231, 1231, 1231,
-     1230, 1230, 1230, 1230, 1230, 1233, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1234,
-     1230, 1230, 1230, 1235,   15, 1230,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1236,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1233,
-     1230, 1230, 1230, 1230, 1230, 1230, 1237, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1234, 1230,
-
-     1235, 1230, 1230,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1238,   45, 1236,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1237, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1239,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1238, 1230, 1236,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1240,
-       45,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-     1230,   45, 1236, 1230,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1230,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1230,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-       45,   45, 1230, 1230, 1230, 1241,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45, 1230,   45, 1236,
-       45,   45,   45,   45,   45, 1230,   45,   45,   45,   45,
-
-     1230,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1230,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1230,   45, 1230,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1230, 1230,   45,
-     1230,   45,   45, 1230, 1242,   45,   45,   45,   45, 1230,
-     1230,   45, 1230,   45, 1230,   45,   45,   45, 1230,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1230,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45, 1230,   45,   45, 1230,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1230, 1230,   45,   45,   45, 1230, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-
+     1285,    1,    1,    3,    1,    5,    5,    7,    7,    9,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,   17,   19,
+     1285,   19, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+       26,   27,   28, 1285, 1285, 1285,   13, 1285, 1285, 1285,
+     1285,   13, 1285, 1285,   15, 1285,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1285,   48,
+       49,   45,   45,   45,   52,   45,   45,   45,   45,   45,
+       45,   55,   45,   45,   45,   45,   45,   56,   57,   45,
+       16,   20,   17,   25,   22,   20, 1285, 1285,   22, 1285,
+       25, 1285, 1285, 1285, 1285,   93,   94,   95, 1285, 1285,
+
+     1285, 1285,   44, 1285, 1285,   45,   45,   45,   45,   45,
+       48,   45,   45,   45,   45,   45,  115,   55, 1285,   45,
+       45, 1285,  107,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1230,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45, 1230,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1230,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-     1230,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-       45,   45,   45,   45,   45, 1230,   45,   45,   45,   45,
-     1230, 1230,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1230,   45, 1230,   45, 1230,
-
-       45,   45,   45,   45,   45, 1230,   45,   45,   45, 1230,
-       45,   45,   45,   45, 1230, 1230,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230, 1230, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45, 1230,   45,   45,   45, 1230,
-       45, 1230, 1230, 1230,   45,   45,   45,   45,   45,   45,
-     1230,   45,   45, 1230,   45,   45,   45,   45,   45,   45,
-
-     1230,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1230,   45,   45, 1230,   45,   45,   45,   45, 1230,   45,
-       45,   45,   45, 1230, 1230,   45, 1230,   45,   45, 1230,
-       45,   45, 1230,   45, 1230,   45, 1230,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1230, 1230,   45, 1230, 1230,   45,
-       45, 1230, 1230,   45,   45,   45,   45,   45,   45, 1230,
-       45, 1230,   45, 1230,   45,   45, 1230,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1230,   45,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45, 1230,
-       45,   45,   45,   45,   45,   45,   45,   45, 1230,   45,
-     1230, 1230,   45,   45, 1230,   45,   45, 1230,   45,   45,
-       45,   45, 1230,   45,   45,   45,   45,   45, 1230,   45,
-       45,   45,   45,   45,   45,   45, 1230,   45,   45,   45,
-     1230,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1230,   45, 1230,   45,   45,   45, 1230,   45,   45,   45,
-     1230,   45,   45,   45, 1230,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1230,   45,   45,   45,   45,   45,
-       45, 1230, 1230, 1230,   45,   45,   45, 1230,   45,   45,
-       45,   45,   45,   45,   45, 1230,   45,   45, 1230,    0,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230
+       45,   45,   45,   45,   45,   45,  114,   45,   45,   45,
+       45,   45,   45,  162,   45,   45,  138,   45,   45,   45,
+       45,   45,   45,  117,   45,   45,   45,   88,   92, 1285,
+     1285, 1285,  180,  181,  182, 1285,  101, 1285,   44, 1285,
+       45,   52,  192,   45,   45,   53,  108,  197,  118,  198,
+
+      199,  200,  197,  119, 1285,  119,  122,  200,  192,  200,
+      210,  211,  212,  213,  214,  212,  200,  214,  210,  218,
+      220,  221,  210,  222,  224,  225,  210,  226,  228,  229,
+      214,  224,  211,  212,  210, 1285,  214,  210,  230,  230,
+      218,  230,  198,  213,  230,  242,  246,  214,  218,  212,
+      200,  228,  222,  242,  210,  230,  230,  221,  212,  212,
+      221,  228,  200,  224,  224,  228,  225,  210,  214,  221,
+      214,  224,  247,  214,  211,  213,  273,  212,  214,  200,
+      210,  242,  228, 1285, 1285, 1285,  284, 1285, 1285, 1285,
+     1285,  230,  277,  242,  242,  277,  214,  200,  228,  294,
+
+     1285,  200, 1285,  218,  207, 1285,  293,  293,  198,  218,
+      220,  277,  200,  214,  242, 1285,  246,  200,  198,  228,
+      218,  226,  200,  218,  221,  222,  242,  218,  308,  242,
+      218,  230,  277,  224,  242,  224,  222,  214,  228,  210,
+      214,  329,  247,  228,  214,  228,  221,  200,  246,  218,
+     1285,  225,  225,  220,  242,  329,  356,  228,  230,  200,
+      198,  228,  224, 1285,  214,  225,  277,  210,  242,  308,
+      357,  210,  242,  214,  214,  242,  214,  214,  214,  200,
+      200, 1285,  242,  218,  224, 1285, 1285, 1285, 1285,  277,
+      220,  230,  308,  225,  200,  200,  224,  200, 1285,  277,
+
+      200, 1285,  277,  305,  392,  200,  242,  246,  228,  212,
+     1285,  213,  213,  225,  225, 1285,  221,  277,  230,  225,
+      221, 1285,  213,  214,  230,  214,  228,  384,  210,  242,
+      218, 1285,  242,  210,  218,  224,  246,  224,  210,  218,
+      277,  242,  242,  218,  220,  214,  357,  242,  221,  200,
+     1285,  225,  242,  230,  277,  246,  212,  228,  214,  225,
+      230, 1285,  200, 1285,  242,  246,  218,  212,  277,  224,
+      228,  224,  200,  218,  213,  273,  242,  242,  228,  212,
+      200,  212, 1285, 1285,  277, 1285,  213,  218, 1285, 1285,
+      212,  226,  200,  200,  221, 1285, 1285,  277, 1285,  198,
+
+     1285,  225,  300,  447,  428, 1285,  225,  228,  212,  218,
+      212,  212,  221,  242,  214,  214,  224,  225,  447,  214,
+      221,  218,  220,  224,  224, 1285,  242,  212,  214,  221,
+      214,  356,  224,  242,  210,  242,  213,  224,  212,  308,
+      230,  213,  214,  213,  214,  200,  214, 1285,  242,  225,
+      214,  218,  218,  200,  224,  212,  242,  212, 1285,  214,
+      308,  213,  214,  221,  218,  356,  218, 1285,  212,  214,
+      210,  218,  218,  212,  218, 1285,  200,  214,  225,  221,
+     1285, 1285,  214,  277, 1285, 1285,  218,  230,  200,  212,
+      297,  292,  220,  221,  218,  228,  218,  218,  218,  356,
+
+      273,  218,  277,  213,  218,  224,  228,  220,  221,  218,
+      577,  214,  214,  213,  228,  230,  214,  611,  214,  213,
+      214,  214,  618,  214,  611,  611,  221,  220,  221,  611,
+     1285,  611,  356,  212,  242,  224,  222, 1285,  225,  214,
+      214,  224,  611,  230,  228,  225,  213,  308,  212,  218,
+      212,  228,  218,  212,  228,  655,  308,  277, 1285,  611,
+      224,  277,  228,  242,  618,  618,  611, 1285,  218,  392,
+      277,  665,  277,  665,  228,  221,  224,  665,  222,  230,
+      618,  665,  222,  230,  678,  222,  611,  665,  222,  618,
+      685, 1285,  691,  693,  691,  226,  665,  611,  678,  230,
+
+      665,  230,  611,  678,  242, 1285, 1285,  228,  665,  618,
+     1285, 1285,  618,  694,  273,  665,  714,  714,  718,  242,
+      611, 1285,  247,  277,  356,  678,  611,  719,  678,  308,
+      356,  693,  728,  718,  714,  714,  718,  714,  611,  618,
+      308, 1285,  719,  678,  246,  246,  678,  728, 1285,  718,
+      665,  693,  277,  694,  719,  694,  618,  611,  728,  714,
+      714,  678,  691,  748,  611,  665,  714, 1285,  277,  694,
+      678,  665,  691,  719,  618,  764,  764, 1285,  618,  764,
+      780,  780, 1285,  618,  780,  665,  719,  728,  678,  693,
+      665,  678,  785,  714,  678,  693,  780, 1285,  691,  748,
+
+      356,  611, 1285,  356,  691,  728,  718,  665,  691,  714,
+      611,  764,  780,  611,  764, 1285,  356,  718,  764,  665,
+      665,  618,  611,  665,  764,  796,  691,  694,  719,  826,
+      611,  780, 1285,  356,  728,  693,  611,  611,  714, 1285,
+      678,  764,  678,  618,  665,  618,  618,  718,  728,  618,
+      785,  830,  611, 1285,  728,  719,  611,  852,  618,  830,
+      780,  356,  611,  714,  764,  618,  611,  691,  728,  691,
+      714,  611,  611,  719,  728, 1285,  665,  728,  356,  665,
+      764,  728,  830, 1285,  678,  678, 1285,  678,  665,  665,
+      665,  852,  678,  693, 1285,  830,  751,  678,  892,  611,
+
+      764,  618, 1285,  780,  665,  830,  685, 1285, 1285,  852,
+      719,  678,  719,  678,  611,  780,  728,  764,  356,  764,
+      618,  618, 1285,  694, 1285,  693, 1285,  618,  691,  678,
+      728,  719, 1285,  691,  611,  611, 1285,  611,  714,  728,
+      719, 1285, 1285,  780,  678,  764,  693,  665,  780,  611,
+      665,  780,  611,  830,  611,  611,  611,  693,  678,  728,
+      665,  678,  780,  611,  694, 1285,  665,  356,  665,  714,
+      678,  665,  618,  678,  611,  728,  665, 1285,  665,  356,
+      665,  665,  728,  678,  780,  611,  714,  780,  611,  719,
+      447,  764,  611, 1285, 1285, 1285,  830,  665,  899,  899,
+
+      611,  611,  665,  764,  611, 1285,  830,  356,  611, 1285,
+      618, 1285, 1285, 1285,  691,  611,  356,  856,  611,  897,
+     1285,  665,  693,  665, 1285,  780,  899,  780,  678,  678,
+      899, 1285,  694,  780,  780,  665,  793,  694,  665,  728,
+      665, 1285,  830,  665, 1285,  728,  665,  665,  618,  728,
+     1285,  780,  830,  718,  793, 1285, 1285,  719,  719, 1285,
+      678,  714, 1285, 1031,  618, 1285,  665, 1285,  728, 1285,
+      830,  719,  691,  611,  611,  678,  611,  611,  728,  718,
+      611,  611,  719,  694,  728,  719,  780,  714,  611,  793,
+      611,  694,  611,  618,  678, 1064,  611,  678,  694,  793,
+
+      691, 1064,  719,  694,  665,  728,  611,  694,  898,  793,
+      618, 1285, 1285,  611, 1285, 1285,  714,  665, 1285, 1285,
+      718,  719,  892,  678,  611,  830, 1285,  728, 1285,  611,
+     1285,  780,  665,  665, 1285,  719,  618,  728,  665,  618,
+      830,  665,  611, 1064, 1285,  611,  611, 1102, 1064, 1285,
+      830,  611,  764,  678,  611,  728, 1285,  719,  748, 1285,
+      665,  611,  611,  899,  678,  892,  618,  728,  618,  611,
+     1285,  719, 1285, 1285,  694,  618,  719, 1285,  714,  728,
+     1285, 1064,  728,  611,  780, 1285, 1285,  718,  665,  611,
+      780,  678, 1064, 1285,  693,  830,  678,  718,  693, 1064,
+
+      665,  694, 1285,  611,  694,  611, 1285,  665,  719,  665,
+     1031,  611,  728,  665,  665,  665,  611,  665, 1285,  618,
+     1285,  780,  678,  611,  693, 1285,  714,  764,  780,  764,
+     1285,  830,  678,  611,  728, 1285,  691,  830,  728,  780,
+      719,  678,  665, 1285, 1064,  665,  611,  714,  728, 1102,
+      728,  611,  665,  780, 1285,  694,  830,  618,  793, 1285,
+      611,  611,  611,  748,  728,  728, 1285, 1285, 1285,  611,
+      678,  665, 1285,  719,  764,  678,  780,  728,  611, 1064,
+     1285,  665,  611, 1285,    0
     } ;
 
-static const flex_int16_t yy_nxt[1666] =
+static const flex_int16_t yy_nxt[2411] =
     {   0,
-     1230,   13,   14,   13, 1230,   15,   16, 1230,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   86,  340,
-       37,   14,   37,   87,   25,   26,   38, 1230, 1230,   27,
-       37,   14,   37,   42,   28,   42,   38,   92,   93,   29,
-      115,   30,   13,   14,   13,   91,   92,   25,   31,   93,
-       13,   14,   13,   13,   14,   13,   32,   40,  793,   13,
-       14,   13,   33,   40,  115,   92,   93,  341,   91,   34,
-       35,   13,   14,   13,   95,   15,   16,   96,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  109,   39,   91,   25,   26,   13,   14,   13,   27,
-
-       39,   85,   85,   85,   28,   42,   41,   42,   42,   29,
-       42,   30,   83,  108,   41,  111,   94,   25,   31,  109,
-      204,  161,   89,  137,   89,  162,   32,   90,   90,   90,
-      205,  138,   33,  209,  210,   83,  108,  794,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
-       45,   48,   45,   49,   50,   45,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   60,   61,   62,   63,   64,
-       65,   66,   67,   52,   68,   69,   70,   71,   72,   73,
-
-       74,   75,   76,   77,   78,   79,   57,   45,   45,   45,
-       45,   45,   81,  105,   82,   82,   82,   81,  114,   84,
-       84,   84,  102,  105,   81,   83,   84,   84,   84,  108,
-       83,  176,  122,  112,  139,  123,  795,   83,  124,  105,
-      125,  114,  126,  113,  140,  176,  141,  132,   83,  119,
-      157,  174,  108,   83,  158,  120,  112,  103,  133,  176,
-       83,   45,  147,  135,  159,  194,  148,   45,  134,   45,
-       45,  113,   45,  179,   45,   45,   45,  174,  117,  143,
-      144,   45,   45,  145,   45,   45,  149,  796,  194,  146,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
+       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   12,
+       27,   12,   12,   12,   12,   28,   12,   12,   12,   12,
+       29,   12,   30,   12,   12,   12,   12,   12,   25,   31,
+       12,   12,   12,   12,   12,   12,   32,   12,   12,   12,
+       12,   12,   33,   12,   12,   12,   12,   12,   12,   34,
+       35,   36,   37, 1285,   37,   36,   36,   36,   38,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   12,   12,   40,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   42,   43,   42,   90,
+       94,   12,   12,   85,   85,   85,   96,   12,   97,   41,
+       93, 1285,   12,   86,   86,   86,   87,   12,   95,   12,
+       98,   88,   89,   89,   89,   12,   12,   94,   99,   39,
+       91,   12,   91,   12,   93,   92,   92,   92,  100,   12,
+
+      102,   43,  106,  109,  110,   95,   12,   12,   44,   44,
+       44,   45,   45,   46,   45,   45,   45,   45,   45,   45,
+       45,   45,   47,   45,   45,   45,   45,   45,   48,   49,
+       50,   51,   45,   52,   45,   45,   53,   54,   55,   45,
+       45,   45,   45,   56,   57,   45,   58,   45,   45,   59,
+       45,   45,   60,   61,   62,   63,   64,   65,   66,   67,
+       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
+       78,   79,   80,   58,   45,   45,   45,   45,   45,   81,
+       81,  113,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       82,  107,   83,   83,   83,  108,  123,  111,  125,  127,
+      114,  128,  124,   84,  129,  140,  130,  141,  131,  142,
+      147,  126,  165,  177,  166,  183,  107,  143,  167,  184,
+      108,  111,  101,  101,  114,  101,  101,   84,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  103,  103,  103,  103,  103,  104,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  105,  103,  103,  103,  103,  103,
+
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,   45,  112,  117,  137,  118,  185,
+       45,   45,   45,   45,  168,   45,  186,  138,   45,   45,
+       45,  191,  194,  169,  170,   45,   45,  139,   45,  171,
+      117,  195,  112,  118,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   90,   90,   90,   45,  127,  499,
-      111,   45,  128,  175,  102,  129,  130,  114,  174,   45,
-      153,  188,  112,   45,  500,   45,  118,  163,  131,  150,
-      154,  151,  113,  152,  251,  155,  156,  164,  165,  175,
-      169,  252,  184,  166,  177,  112,  797,  167,  188,  103,
-      170,   85,   85,   85,  447,  171,   90,   90,   90,  190,
-      113,   81,   83,   82,   82,   82,   89,  168,   89,  175,
-      184,   90,   90,   90,   83,   81,  187,   84,   84,   84,
-       85,   85,   85,  101,  192,   83,  191,  190,   83,  193,
-
-      101,   83,  184,  190,  215,  178,  216,   83,  221,  218,
-      233,  222,  187,  193,  234,  223,  244,  245,  273,  198,
-      448,   83,  192,  191,   83,  219,  193,  379,  101,  274,
-      199,  190,  101,  239,  247,  261,  101,  248,  249,  262,
-      269,  273,  275,  263,  101,  253,  273,  274,  101,  275,
-      101,  182,  197,  197,  197,  274,  379,  798,  282,  197,
-      197,  197,  197,  197,  197,  275,  285,  288,  286,  276,
-      301,  292,  278,  277,  290,  799,  302,  800,  254,  255,
-      256,  282,  197,  197,  197,  197,  197,  197,  330,  257,
-      288,  258,  282,  259,  285,  286,  260,  290,  292,  293,
-
-      293,  293,  355,  373,  373,  356,  293,  293,  293,  293,
-      293,  293,  377,  384,  379,  295,  381,  382,  387,  404,
-      398,  803,  378,  405,  478,  383,  373,  374,  437,  293,
-      293,  293,  293,  293,  293,  417,  384,  399,  438,  331,
-      418,  478,  332,  391,  430,  431,  387,  390,  390,  390,
-      617,  649,  478,  804,  390,  390,  390,  390,  390,  390,
-      471,  486,  508,  487,  638,  472,  566,  509,  570,  488,
-      571,  572,  769,  639,  649,  650,  770,  390,  390,  390,
-      390,  390,  390,  648,  805,  651,  419,  618,  486,  712,
-      487,  420,   45,   45,   45,  570,  713,  802,  571,   45,
-
-       45,   45,   45,   45,   45,  729,  654,  714,  715,  801,
-      718,  648,  655,  806,  807,  716,  719,  808,  809,  810,
-      802,  811,   45,   45,   45,   45,   45,   45,  812,  813,
-      814,  815,  816,  729,  817,  818,  801,  819,  820,  821,
-      822,  823,  824,  825,  826,  827,  828,  829,  832,  833,
-      834,  835,  830,  836,  837,  838,  839,  840,  841,  842,
-      843,  844,  845,  847,  848,  849,  850,  851,  852,  853,
-      854,  855,  856,  846,  857,  858,  859,  860,  861,  862,
-      863,  864,  865,  866,  867,  868,  869,  870,  871,  873,
-      872,  874,  875,  876,  877,  878,  879,  880,  881,  882,
-
-      883,  884,  885,  831,  886,  887,  888,  889,  890,  891,
-      892,  893,  894,  895,  896,  897,  871,  872,  898,  900,
-      901,  902,  903,  899,  904,  905,  906,  907,  908,  909,
-      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
-      920,  921,  922,  923,  924,  925,  926,  927,  928,  929,
-      930,  931,  932,  933,  934,  935,  936,  937,  938,  939,
-      940,  941,  942,  943,  944,  945,  946,  947,  948,  949,
-      950,  951,  952,  953,  954,  955,  956,  957,  935,  958,
-      959,  960,  961,  962,  936,  963,  964,  965,  966,  967,
+       45,   45,   45,   45,   45,   45,  115,  132, 1285,  144,
+     1285,  133,  148,  149,  134,  135,  150,  116,  145,  152,
+      146,  151,  158,  153,  172,  155,  136,  156,  162,  157,
+
+      115,  159,  163,  179,  179,  179,  160,  161,  198,  210,
+      211,  164,  154,  173,  116,  119,  119,  119,  119,  119,
+      120,  119,  119,  119,  119,  119,  119,  121,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  121,  119,  119,  119,
+      121,  119,  119,  119,  121,  119,  119,  119,  119,  119,
+      119,  121,  119,  119,  119,  121,  119,  121,  122,  119,
+      119,  119,  119,  119,  119,  119,  174,  212,  213,  214,
+      217,  218,  219,  220,  221,  175,  222,  223,  178,  178,
+
+      176,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  180,
+      181,  182,  208,  215,  224,  225,  226,  228,  227,  231,
+      235,  232,  216,  209,  233,  236,  237,  238,  234,  239,
+      240,  241,  242,  243,  180,  181,  187,  187,  182,  187,
+
+      187,  188,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  189,  192,  196,
+      193,  197,  199,  201,  189,  200,  202,  229,  244,  246,
+      203,  247,  245,  248,  249,  250,  251,  252,  253,  254,
+      255,  256,  230,  257,  196,  192,  193,  197,  261,  199,
+
+      201,  200,  202,  189,  203,  258,  262,  189,  259,  260,
+      275,  189,  272,  263,  276,  277,  273,  278,  189,  279,
+      274,  280,  189,  281,  189,  190,  204,  204,  205,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  204,  204,  204,  204,  204,  204,
+      204,  204,  204,  204,  206,  206,  206,  206,  206,  206,
+
+      206,  206,  206,  206,  206,  206,  206,  207,  207,  207,
+      206,  206,  206,  206,  207,  207,  207,  207,  207,  207,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  207,  207,
+      207,  207,  207,  207,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  264,  282,  283,  284,  285,
+      287,  288,  286,  289,  290,  292,  295,  296,  293,  294,
+      297,  300,  298,  303,   45,  301,  306,  307,  302,  304,
+      311,   45,  313,  312,  285,  284,  286,   46,  316,  265,
+
+      266,  267,  293,  294,  299,  300,   45,  297,  298,  268,
+       45,  269,  302,  270,   45,  304,  271,  291,  291,  291,
+      317,  318,   45,  309,  291,  291,  291,  291,  291,  291,
+       45,  305,  305,  305,  322,   45,  308,  320,  305,  305,
+      305,  305,  305,  305,  310,  323,   45,   45,  291,  291,
+      291,  291,  291,  291,  314,   45,   45,  324,   45,  321,
+      315,  325,  305,  305,  305,  305,  305,  305,  326,   45,
+       45,  330,  329,   45,  331,  319,  327,   45,  332,  333,
+      334,  335,  336,  337,  328,  338,  339,  340,   45,  341,
+      342,  343,  346,  348,   45,  349,  350,  351,  352,  353,
+
+      355,  356,  357,   45,  347,  358,  359,  360,  361,  362,
+      363,  364,  365,  366,  367,  368,  370,  371,  369,  372,
+      373,  374,   45,  376,  377,  378,  379,  375,  380,  381,
+      382,  383,  384,  385,   45,  386,  387,  388,  394,  390,
+      392,  399,  344,  393,  400,  345,  401,  354,  391,  395,
+      396,  398,  402,  389,  389,  389,  403,   45,  397,  386,
+      389,  389,  389,  389,  389,  389,  405,   45,  392,  407,
+      393,  408,  409,  401,  410,  398,  411,  412,  415,  416,
+      413,  417,  418,  421,  389,  389,  389,  389,  389,  389,
+      422,   45,  404,  404,  404,  406,  414,  423,  424,  404,
+
+      404,  404,  404,  404,  404,  419,  425,  426,  427,  420,
+      429,  430,  431,  428,  432,  436,  437,  438,  439,  433,
+      440,  441,  442,  404,  404,  404,  404,  404,  404,   45,
+      443,  444,  445,  446,  447,  448,  449,  450,  451,  452,
+      454,  455,  456,  457,  458,   45,   45,  461,  453,  459,
+      462,  464,  465,  466,  467,  468,  460,  469,  470,  471,
+      472,  473,  474,  475,  476,  434,  477,  478,  479,  480,
+      435,  481,  482,  483,  484,  485,  486,  488,  489,  491,
+      492,  487,  490,  490,  490,  493,  495,  496,  497,  490,
+      490,  490,  490,  490,  490,  494,  498,  499,  500,  501,
+
+      502,  505,  503,  506,  507,  508,  463,  509,  510,  511,
+      512,  513,  493,  490,  490,  490,  490,  490,  490,  514,
+      515,  516,  519,  494,  520,  521,  502,  522,  503,  504,
+      504,  504,  517,  523,  524,  525,  504,  504,  504,  504,
+      504,  504,  526,  528,  529,  530,  518,  527,  531,  532,
+      533,  534,  535,  536,  537,  538,  539,  540,  541,  542,
+      504,  504,  504,  504,  504,  504,  543,  544,   45,  546,
+      547,  545,  548,  549,  550,  551,  552,  553,  554,  555,
+      556,  557,  558,  559,  560,  561,  562,  563,  564,  565,
+      566,  567,  568,  569,  570,  571,  572,  573,  574,  575,
+
+      576,  577,  578,  579,  580,  581,  582,  582,  582,  583,
+      584,  585,  586,  582,  582,  582,  582,  582,  582,  587,
+      588,  589,  590,  591,   45,  585,  593,  594,  595,  596,
+      592,  597,  598,  599,  600,  601,  602,  582,  582,  582,
+      582,  582,  582,  603,  604,  605,  606,  607,  590,  608,
+      591,  609,  610,  611,  612,  613,  614,  615,  616,  617,
+      618,  619,  620,  621,  622,  623,  624,  625,  626,  627,
+      628,  629,  630,  631,  632,  633,  634,  635,  636,  637,
+      638,  640,  641,  642,  643,  644,  645,  646,  647,  648,
+      649,  650,  651,  652,  653,  654,  655,  656,   45,  657,
+
+      658,  659,  661,  662,  663,  664,  665,  666,  667,  668,
+      660,  673,  674,  675,  678,  679,  680,  681,  639,  103,
+      103,  103,  103,  103,  104,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      105,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      669,  670,  671,  676,  682,  683,  684,  685,  686,  677,
+
+      687,  672,  688,  689,  690,  691,  693,  692,  694,  695,
+      696,  697,  698,   46,  700,  670,   45,  669,  701,  702,
+      703,  704,  705,  706,  707,  708,  709,  710,  711,  712,
+      713,  714,  715,  716,  717,  718,  719,  720,  721,  722,
+      723,  724,  725,  726,  727,  728,  729,  730,  731,  732,
+      733,  734,  699,  736,  737,  739,  740,  735,  742,  743,
+      738,  744,  741,  745,  746,   45,  748,  749,  750,  747,
+      751,  752,  753,  754,  755,  756,  757,  758,   45,  760,
+      761,  762,  763,  764,  765,  766,  767,  768,  769,  770,
+      771,  773,  759,  775,   45,   45,  772,  751,  776,   45,
+
+       45,  774,  777,  778,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  788,  789,   45,  791,  792,  794,   45,
+      795,  793,  796,  797,  798,  790,  799,  800,  801,  802,
+      803,   45,  805,  806,  807,  808,  809,  810,  811,  812,
+      813,  814,  815,  816,  817,  818,  819,  820,  821,  822,
+      823,  824,  825,   45,  827,  826,  828,  829,  830,  831,
+      832,  833,  834,  835,  836,  837,  838,   45,  840,  841,
+       45,  842,  843,  804,  844,  845,  846,  839,  825,  826,
+      847,  848,  849,  850,  851,  852,   45,  853,  854,  857,
+      858,   45,  860,  855,  859,  861,  862,  863,  864,  865,
+
+      866,  867,  868,  869,  870,  872,  873,  874,  875,  876,
+      877,  878,  879,  880,  871,  881,   45,  882,  883,  884,
+      885,  886,  887,  888,  889,  890,  891,  892,  893,  894,
+      895,  896,  897,  899,  898,  900,  901,   45,  903,  904,
+      905,  906,  907,  908,  856,  909,  910,  911,  912,  913,
+       45,  914,  915,  916,  917,  918,  919,  920,  921,  897,
+      898,  922,  923,  902,  924,  925,  927,  928,  929,  930,
+      926,  931,   45,  932,  933,  934,  935,  936,  937,  938,
+      939,  940,  941,  942,  943,  944,  945,  946,  947,  948,
+      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
+
+       45,  960,  961,  962,  963,  964,  965,  966,  967,   45,
       968,  969,  970,  971,  972,  973,  974,  975,  976,  977,
-
-      978,  980,  981,  982,  983,  984,  985,  986,  987,  988,
-      989,  990,  991,  992,  993,  994,  996,  997,  998,  999,
-     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
-     1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1019,  990,
-     1020, 1021, 1022, 1023, 1024, 1018, 1025, 1026, 1027, 1028,
-     1029,  979, 1030, 1031, 1032, 1033, 1034,  995, 1035, 1037,
-     1038, 1039, 1040, 1036, 1041, 1042, 1043, 1044, 1045, 1046,
-     1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
-     1057, 1058, 1059, 1038, 1060, 1061, 1062, 1063, 1064, 1065,
-     1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
-
-     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
-     1096, 1097, 1098, 1099, 1073, 1100, 1101, 1102, 1103, 1104,
-     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
-     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1135, 1108, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
-     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
-     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-
-     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
-     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
-     1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
-     1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
-     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1224, 1225, 1226, 1227, 1228, 1229,   12,   12,   12,   12,
-       12,   36,   36,   36,   36,   36,   80,  280,   80,   80,
-       80,   99,  376,   99,  475,   99,  101,  101,  101,  101,
-      101,  116,  116,  116,  116,  116,  173,  101,  173,  173,
-      173,  195,  195,  195,  792,  791,  790,  789,  788,  787,
-
-      786,  785,  784,  783,  782,  781,  780,  779,  778,  777,
-      776,  775,  774,  773,  772,  771,  768,  767,  766,  765,
-      764,  763,  762,  761,  760,  759,  758,  757,  756,  755,
-      754,  753,  752,  751,  750,  749,  748,  747,  746,  745,
-      744,  743,  742,  741,  740,  739,  738,  737,  736,  735,
-      734,  733,  732,  731,  730,  728,  727,  726,  725,  724,
-      723,  722,  721,  720,  717,  711,  710,  709,  708,  707,
-      706,  705,  704,  703,  702,  701,  700,  699,  698,  697,
-      696,  695,  694,  693,  692,  691,  690,  689,  688,  687,
-      686,  685,  684,  683,  682,  681,  680,  679,  678,  677,
-
-      676,  675,  674,  673,  672,  671,  670,  669,  668,  667,
-      666,  665,  664,  663,  662,  661,  660,  659,  658,  657,
-      656,  653,  652,  647,  646,  645,  644,  643,  642,  641,
-      640,  637,  636,  635,  634,  633,  632,  631,  630,  629,
-      628,  627,  626,  625,  624,  623,  622,  621,  620,  619,
-      616,  615,  614,  613,  612,  611,  610,  609,  608,  607,
-      606,  605,  604,  603,  602,  601,  600,  599,  598,  597,
-      596,  595,  594,  593,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
-      576,  575,  574,  573,  569,  568,  567,  566,  565,  564,
-
-      563,  562,  561,  560,  559,  558,  557,  556,  555,  554,
-      553,  552,  551,  550,  549,  548,  547,  546,  545,  544,
-      543,  542,  541,  540,  539,  538,  537,  536,  535,  534,
-      533,  532,  531,  530,  529,  528,  527,  526,  525,  524,
-      523,  522,  521,  520,  519,  518,  517,  516,  515,  514,
-      513,  512,  511,  510,  507,  506,  505,  504,  503,  502,
-      501,  498,  497,  496,  495,  494,  493,  492,  491,  490,
-      489,  485,  484,  483,  482,  481,  480,  479,  477,  476,
-      474,  473,  470,  469,  468,  467,  466,  465,  464,  463,
-      462,  461,  460,  459,  458,  457,  456,  455,  454,  453,
-
-      452,  451,  450,  449,  446,  445,  444,  443,  442,  441,
-      440,  439,  436,  435,  434,  433,  432,  429,  428,  427,
-      426,  425,  424,  423,  422,  421,  416,  415,  414,  413,
-      412,  411,  410,  409,  408,  407,  406,  403,  402,  401,
-      400,  397,  396,  395,  394,  393,  392,  389,  388,  386,
-      385,  380,  375,  372,  371,  370,  369,  368,  367,  366,
-      365,  364,  363,  362,  361,  360,  359,  358,  357,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      343,  342,  339,  338,  337,  336,  335,  334,  333,  329,
-      328,  327,  326,  325,  324,  323,  322,  321,  320,  319,
-
-      318,  317,  316,  315,  314,  313,  312,  311,  310,  309,
-      308,  307,  306,  305,  304,  303,  300,  299,  298,  297,
-      296,  294,  196,  291,  289,  287,  284,  283,  281,  279,
-      272,  271,  270,  268,  267,  266,  265,  264,  250,  246,
-      243,  242,  241,  240,  238,  237,  236,  235,  232,  231,
-      230,  229,  228,  227,  226,  225,  224,  220,  217,  214,
-      213,  212,  211,  208,  207,  206,  203,  202,  201,  200,
-      196,  189,  186,  185,  183,  181,  180,  172,  160,  142,
-      136,  121,  110,  107,  106,  104,   43,  100,   98,   97,
-       88,   43, 1230,   11, 1230, 1230, 1230, 1230, 1230, 1230,
-
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230
+      978,  959,  979,  980,  981,  982,  983,  984,  963,  985,
+      986,  987,  964,  988,  989,  990,  991,  992,  993,  994,
+      995,  996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004,
+     1005, 1006, 1007, 1008, 1010, 1011, 1012, 1013, 1014, 1015,
+     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
+     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+     1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+     1047, 1020, 1048, 1051, 1052, 1053, 1054, 1055, 1049, 1056,
+
+     1050, 1057, 1058, 1059, 1009, 1060, 1061, 1062, 1063, 1064,
+     1065, 1066, 1026, 1067, 1068, 1070, 1071, 1072, 1073, 1069,
+     1074, 1075, 1076, 1077, 1078, 1079,   45, 1081, 1082, 1083,
+     1080, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+     1071, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+     1112, 1113, 1114, 1115, 1116,   45, 1117, 1118, 1119, 1120,
+     1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130,
+     1131, 1132, 1133, 1109, 1134, 1135, 1136, 1137, 1138, 1139,
+       45, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+
+     1140, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
+     1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168,
+     1169, 1170, 1171, 1172, 1147, 1173, 1174, 1175, 1176, 1177,
+     1178, 1179, 1180,   45, 1181, 1182, 1183, 1184, 1185, 1186,
+     1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
+     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
+     1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
+     1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
+     1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+     1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+
+     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
+     1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
+     1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+     1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,   11, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285
     } ;
 
-static const flex_int16_t yy_chk[1666] =
+static const flex_int16_t yy_chk[2411] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  242,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  718,    8,
-        8,    8,    1,    8,   57,   27,   28,  242,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-      124,   75,   25,   66,   25,   75,    2,   25,   25,   25,
-      124,   66,    2,  128,  128,   20,   51,  719,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    3,    3,   11,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    5,    5,    7,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    9,   13,   14,   13,   24,
+       27,    5,    5,   19,   19,   19,   31,    5,   32,    9,
+       26,   20,    5,   20,   20,   20,   21,    5,   28,    5,
+       33,   21,   22,   22,   22,    5,    5,   27,   38,    5,
+       25,    7,   25,    5,   26,   25,   25,   25,   39,    5,
+
+       41,   43,   47,   50,   51,   28,    5,    5,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   48,   17,   17,   17,   19,   56,   19,
-       19,   19,   44,   59,   22,   17,   22,   22,   22,   64,
-       19,   93,   61,   55,   67,   61,  721,   22,   61,   48,
-       61,   56,   61,   55,   67,   96,   67,   63,   17,   59,
-       73,   91,   64,   19,   73,   59,   55,   44,   63,   93,
-       22,   45,   70,   64,   73,  115,   70,   45,   63,   45,
-       45,   55,   45,   96,   45,   45,   45,   91,   58,   69,
-       69,   45,   45,   69,   45,   58,   70,  722,  115,   69,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   16,
+       16,   54,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       17,   48,   17,   17,   17,   49,   60,   52,   61,   62,
+       55,   62,   60,   17,   62,   65,   62,   66,   62,   67,
+       69,   61,   75,   80,   76,   96,   48,   67,   76,   97,
+       49,   52,   40,   40,   55,   40,   40,   17,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   45,   53,   57,   64,   58,   98,
+       45,   45,   45,   45,   77,   45,  100,   64,   45,   45,
+       45,  106,  109,   77,   77,   45,   45,   64,   45,   77,
+       57,  110,   53,   58,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   58,   89,   89,   89,   58,   62,  404,
-       71,   58,   62,   92,  101,   62,   62,   78,   94,   58,
-       72,  109,   77,   58,  404,   58,   58,   76,   62,   71,
-       72,   71,   77,   71,  161,   72,   72,   76,   76,   92,
-       78,  161,  105,   76,   94,   77,  723,   77,  109,  101,
-       78,   81,   81,   81,  346,   78,   90,   90,   90,  111,
-       77,   82,   81,   82,   82,   82,   83,   77,   83,   95,
-      105,   83,   83,   83,   82,   84,  108,   84,   84,   84,
-       85,   85,   85,  103,  113,   81,  112,  111,   84,  114,
-
-      103,   85,  119,  152,  133,   95,  133,   82,  137,  135,
-      147,  137,  108,  169,  147,  137,  157,  157,  174,  119,
-      346,   84,  113,  112,   85,  135,  114,  282,  103,  175,
-      119,  152,  103,  152,  159,  163,  103,  159,  159,  163,
-      169,  177,  176,  163,  103,  162,  174,  178,  103,  179,
-      103,  103,  118,  118,  118,  175,  282,  724,  184,  118,
-      118,  118,  118,  118,  118,  176,  187,  190,  188,  177,
-      205,  194,  179,  178,  192,  725,  205,  726,  162,  162,
-      162,  184,  118,  118,  118,  118,  118,  118,  234,  162,
-      190,  162,  199,  162,  187,  188,  162,  192,  194,  197,
-
-      197,  197,  256,  273,  276,  256,  197,  197,  197,  197,
-      197,  197,  281,  285,  295,  199,  284,  284,  288,  308,
-      302,  730,  281,  308,  379,  284,  273,  276,  336,  197,
-      197,  197,  197,  197,  197,  320,  285,  302,  336,  234,
-      320,  391,  234,  295,  330,  330,  288,  293,  293,  293,
-      536,  571,  379,  731,  293,  293,  293,  293,  293,  293,
-      371,  389,  413,  389,  559,  371,  488,  413,  486,  391,
-      487,  488,  694,  559,  571,  572,  694,  293,  293,  293,
-      293,  293,  293,  570,  732,  572,  320,  536,  389,  634,
-      389,  320,  390,  390,  390,  486,  634,  729,  487,  390,
-
-      390,  390,  390,  390,  390,  649,  575,  635,  635,  728,
-      637,  570,  575,  733,  734,  635,  637,  735,  736,  737,
-      729,  738,  390,  390,  390,  390,  390,  390,  739,  740,
-      741,  742,  743,  649,  744,  746,  728,  747,  748,  749,
-      750,  751,  752,  753,  754,  756,  757,  758,  759,  761,
-      762,  763,  758,  764,  765,  766,  767,  768,  769,  770,
-      771,  772,  773,  774,  776,  777,  778,  779,  781,  782,
-      783,  784,  785,  773,  786,  787,  788,  789,  790,  791,
-      793,  794,  795,  796,  797,  798,  799,  800,  801,  803,
-      802,  804,  805,  806,  807,  809,  810,  811,  812,  813,
-
-      814,  816,  817,  758,  818,  819,  820,  821,  822,  823,
-      824,  825,  826,  827,  828,  830,  801,  802,  831,  832,
-      833,  834,  835,  831,  836,  837,  838,  839,  840,  841,
-      842,  843,  844,  845,  846,  847,  848,  849,  850,  852,
-      853,  854,  855,  856,  857,  859,  860,  862,  863,  864,
-      865,  866,  867,  868,  870,  871,  872,  873,  874,  875,
-      877,  878,  879,  880,  883,  884,  885,  886,  887,  888,
-      889,  890,  891,  892,  893,  894,  895,  897,  871,  899,
-      901,  902,  903,  904,  872,  905,  907,  908,  909,  911,
-      912,  913,  914,  917,  918,  919,  920,  921,  922,  923,
-
-      924,  925,  926,  927,  928,  929,  930,  931,  932,  933,
-      934,  935,  936,  937,  939,  940,  941,  942,  943,  944,
-      945,  946,  947,  948,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  961,  962,  963,  964,  935,
-      968,  969,  970,  971,  972,  963,  973,  974,  975,  977,
-      978,  924,  979,  981,  985,  986,  987,  940,  988,  989,
-      990,  992,  993,  988,  995,  996,  997,  998,  999, 1000,
-     1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1012,
-     1013, 1015, 1016,  990, 1017, 1018, 1020, 1021, 1022, 1023,
-     1026, 1028, 1029, 1031, 1032, 1034, 1036, 1038, 1039, 1040,
-
-     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
-     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
-     1061, 1062, 1063, 1064, 1038, 1065, 1066, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1077, 1080, 1081, 1084, 1085,
-     1086, 1087, 1088, 1089, 1091, 1093, 1095, 1096, 1098, 1099,
-     1100, 1101, 1102, 1103, 1104, 1105, 1107, 1108, 1109, 1111,
-     1112, 1073, 1113, 1114, 1115, 1116, 1118, 1119, 1121, 1122,
-     1123, 1124, 1125, 1126, 1127, 1128, 1130, 1133, 1134, 1136,
-     1137, 1139, 1140, 1141, 1142, 1144, 1145, 1146, 1147, 1148,
-     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1158, 1159, 1160,
-
-     1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1172,
-     1174, 1175, 1176, 1178, 1179, 1180, 1182, 1183, 1184, 1186,
-     1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
-     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1206, 1207,
-     1208, 1209, 1210, 1211, 1215, 1216, 1217, 1219, 1220, 1221,
-     1222, 1223, 1224, 1225, 1227, 1228, 1231, 1231, 1231, 1231,
-     1231, 1232, 1232, 1232, 1232, 1232, 1233, 1239, 1233, 1233,
-     1233, 1234, 1240, 1234, 1241, 1234, 1235, 1235, 1235, 1235,
-     1235, 1236, 1236, 1236, 1236, 1236, 1237, 1242, 1237, 1237,
-     1237, 1238, 1238, 1238,  717,  716,  715,  714,  713,  712,
-
-      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
-      701,  699,  698,  697,  696,  695,  693,  692,  691,  688,
-      687,  686,  683,  682,  681,  680,  679,  678,  677,  676,
-      675,  674,  673,  672,  671,  669,  668,  667,  666,  665,
-      664,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  653,  652,  651,  650,  648,  646,  645,  644,  643,
-      642,  641,  640,  639,  636,  633,  632,  631,  630,  629,
-      628,  627,  626,  625,  624,  623,  622,  621,  620,  619,
-      618,  616,  615,  614,  613,  612,  611,  609,  608,  607,
-      606,  605,  604,  603,  602,  601,  600,  599,  598,  597,
-
-      596,  595,  594,  593,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
-      576,  574,  573,  569,  568,  567,  565,  564,  562,  561,
-      560,  557,  556,  555,  554,  553,  552,  551,  549,  548,
-      547,  546,  545,  544,  543,  542,  540,  539,  538,  537,
-      535,  534,  533,  532,  531,  529,  528,  527,  526,  525,
-      524,  523,  522,  521,  520,  519,  518,  517,  516,  515,
-      514,  513,  512,  511,  510,  509,  507,  506,  505,  504,
-      503,  502,  501,  500,  499,  498,  497,  496,  495,  494,
-      493,  492,  491,  490,  484,  482,  479,  478,  477,  476,
-
-      474,  473,  472,  470,  467,  466,  465,  464,  463,  462,
-      461,  460,  459,  458,  457,  456,  455,  454,  453,  452,
-      451,  450,  448,  446,  445,  444,  443,  442,  441,  440,
-      439,  438,  437,  435,  434,  433,  432,  431,  430,  429,
-      428,  427,  426,  425,  424,  423,  422,  421,  420,  419,
-      418,  416,  415,  414,  412,  411,  410,  409,  408,  406,
-      405,  403,  402,  400,  399,  398,  397,  395,  394,  393,
-      392,  387,  386,  384,  383,  382,  381,  380,  378,  377,
-      375,  372,  370,  368,  367,  366,  365,  364,  363,  362,
-      361,  360,  359,  358,  357,  356,  355,  354,  353,  352,
-
-      350,  349,  348,  347,  345,  344,  343,  342,  341,  340,
-      339,  337,  335,  334,  333,  332,  331,  329,  328,  327,
-      326,  325,  324,  323,  322,  321,  319,  318,  317,  316,
-      315,  314,  313,  312,  311,  310,  309,  307,  306,  305,
-      304,  301,  300,  299,  298,  297,  296,  292,  290,  287,
-      286,  283,  279,  272,  271,  270,  269,  268,  267,  266,
-      265,  264,  263,  262,  261,  260,  259,  258,  257,  255,
-      254,  253,  252,  251,  250,  249,  248,  247,  246,  245,
-      244,  243,  241,  240,  239,  238,  237,  236,  235,  233,
-      232,  231,  230,  229,  228,  227,  226,  224,  223,  222,
-
-      221,  220,  219,  218,  217,  216,  215,  214,  213,  212,
-      211,  210,  209,  208,  207,  206,  204,  203,  202,  201,
-      200,  198,  195,  193,  191,  189,  186,  185,  183,  180,
-      172,  171,  170,  168,  167,  166,  165,  164,  160,  158,
-      156,  155,  154,  153,  151,  150,  149,  148,  146,  145,
-      144,  143,  142,  141,  140,  139,  138,  136,  134,  132,
-      131,  130,  129,  127,  126,  125,  123,  122,  121,  120,
-      116,  110,  107,  106,  104,   99,   98,   79,   74,   68,
-       65,   60,   53,   50,   49,   47,   43,   41,   39,   38,
-       24,   14,   11, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
-     1230, 1230, 1230, 1230, 1230
+       45,   45,   45,   45,   45,   45,   56,   63,   91,   68,
+       91,   63,   70,   70,   63,   63,   70,   56,   68,   71,
+       68,   70,   73,   71,   78,   72,   63,   72,   74,   72,
+
+       56,   73,   74,   92,   92,   92,   73,   73,  113,  124,
+      125,   74,   71,   78,   56,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   79,  126,  127,  128,
+      130,  131,  132,  133,  133,   79,  134,  135,   88,   88,
+
+       79,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   93,
+       94,   95,  123,  129,  136,  137,  138,  139,  138,  141,
+      143,  142,  129,  123,  142,  144,  145,  146,  142,  147,
+      148,  149,  150,  151,   93,   94,  101,  101,   95,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  105,  107,  111,
+      108,  112,  114,  116,  105,  115,  117,  140,  152,  153,
+      118,  154,  152,  155,  156,  157,  158,  159,  160,  161,
+      162,  162,  140,  163,  111,  107,  108,  112,  165,  114,
+
+      116,  115,  117,  105,  118,  164,  166,  105,  164,  164,
+      169,  105,  168,  166,  170,  171,  168,  172,  105,  173,
+      168,  174,  105,  175,  105,  105,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  122,  122,  122,  122,  122,  122,
+
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  122,
+      122,  122,  122,  122,  122,  167,  176,  177,  180,  181,
+      183,  184,  182,  185,  186,  191,  194,  195,  192,  193,
+      196,  199,  197,  202,  198,  200,  208,  209,  201,  203,
+      213,  214,  215,  214,  181,  180,  182,  210,  217,  167,
+
+      167,  167,  192,  193,  198,  199,  213,  196,  197,  167,
+      198,  167,  201,  167,  211,  203,  167,  190,  190,  190,
+      218,  219,  220,  211,  190,  190,  190,  190,  190,  190,
+      200,  207,  207,  207,  223,  212,  210,  221,  207,  207,
+      207,  207,  207,  207,  212,  224,  221,  225,  190,  190,
+      190,  190,  190,  190,  216,  222,  224,  225,  218,  222,
+      216,  226,  207,  207,  207,  207,  207,  207,  227,  228,
+      229,  231,  230,  226,  232,  220,  228,  230,  233,  234,
+      235,  237,  238,  239,  229,  240,  241,  242,  242,  243,
+      244,  245,  246,  248,  247,  249,  250,  251,  252,  253,
+
+      254,  255,  256,  246,  247,  257,  258,  259,  260,  261,
+      262,  263,  264,  265,  266,  267,  268,  269,  267,  270,
+      271,  272,  273,  274,  275,  276,  277,  273,  278,  279,
+      280,  281,  282,  283,  277,  284,  287,  290,  295,  292,
+      293,  298,  245,  294,  299,  245,  300,  253,  292,  296,
+      296,  297,  302,  291,  291,  291,  304,  293,  296,  284,
+      291,  291,  291,  291,  291,  291,  307,  308,  293,  309,
+      294,  310,  311,  300,  312,  297,  313,  314,  317,  318,
+      315,  319,  320,  322,  291,  291,  291,  291,  291,  291,
+      323,  296,  305,  305,  305,  308,  315,  324,  325,  305,
+
+      305,  305,  305,  305,  305,  321,  326,  327,  328,  321,
+      330,  331,  332,  329,  333,  334,  335,  336,  337,  333,
+      338,  339,  340,  305,  305,  305,  305,  305,  305,  329,
+      341,  342,  343,  343,  344,  345,  346,  347,  348,  349,
+      350,  352,  353,  354,  355,  356,  357,  358,  349,  356,
+      359,  360,  361,  362,  363,  365,  357,  366,  367,  368,
+      369,  370,  371,  372,  373,  333,  374,  375,  376,  377,
+      333,  378,  379,  380,  381,  383,  384,  385,  388,  390,
+      391,  384,  389,  389,  389,  392,  394,  395,  396,  389,
+      389,  389,  389,  389,  389,  393,  397,  398,  400,  401,
+
+      403,  405,  403,  406,  407,  408,  359,  409,  410,  412,
+      413,  414,  392,  389,  389,  389,  389,  389,  389,  415,
+      417,  418,  420,  393,  421,  423,  403,  424,  403,  404,
+      404,  404,  419,  425,  426,  427,  404,  404,  404,  404,
+      404,  404,  428,  429,  430,  431,  419,  428,  433,  434,
+      435,  436,  437,  438,  439,  440,  441,  442,  443,  444,
+      404,  404,  404,  404,  404,  404,  445,  446,  447,  448,
+      449,  447,  450,  452,  453,  454,  455,  456,  457,  458,
+      459,  460,  461,  463,  465,  466,  467,  468,  469,  470,
+      471,  472,  473,  474,  475,  476,  477,  478,  479,  480,
+
+      481,  482,  485,  487,  488,  489,  490,  490,  490,  491,
+      492,  493,  494,  490,  490,  490,  490,  490,  490,  495,
+      498,  500,  502,  503,  504,  505,  507,  508,  509,  510,
+      505,  511,  512,  513,  514,  515,  516,  490,  490,  490,
+      490,  490,  490,  517,  518,  519,  520,  521,  502,  522,
+      503,  523,  524,  525,  527,  528,  529,  530,  531,  532,
+      533,  534,  535,  536,  537,  538,  539,  540,  541,  542,
+      543,  544,  545,  546,  547,  549,  550,  551,  552,  553,
+      554,  555,  556,  557,  558,  560,  561,  562,  563,  564,
+      565,  566,  567,  569,  570,  571,  572,  573,  519,  574,
+
+      575,  577,  578,  579,  580,  583,  584,  587,  588,  589,
+      577,  593,  594,  595,  597,  598,  599,  600,  554,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      582,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      590,  591,  592,  596,  601,  602,  603,  604,  605,  596,
+
+      606,  592,  607,  608,  609,  610,  612,  611,  613,  614,
+      615,  616,  617,  618,  619,  591,  611,  590,  620,  621,
+      622,  623,  624,  625,  626,  627,  628,  629,  630,  632,
+      633,  634,  635,  636,  637,  639,  640,  641,  642,  643,
+      644,  645,  646,  647,  648,  649,  650,  651,  652,  653,
+      654,  655,  618,  656,  656,  657,  658,  655,  660,  661,
+      656,  662,  658,  663,  664,  665,  666,  667,  669,  665,
+      670,  671,  672,  673,  674,  675,  676,  677,  678,  679,
+      680,  681,  682,  683,  684,  685,  686,  687,  688,  689,
+      690,  693,  678,  695,  685,  691,  691,  670,  696,  693,
+
+      694,  694,  697,  698,  699,  700,  701,  702,  703,  704,
+      705,  708,  709,  710,  713,  714,  715,  716,  717,  718,
+      718,  716,  719,  720,  721,  714,  723,  724,  725,  726,
+      727,  728,  729,  729,  730,  731,  732,  733,  734,  735,
+      736,  737,  738,  739,  740,  741,  743,  744,  745,  746,
+      747,  748,  750,  748,  752,  751,  753,  754,  755,  756,
+      757,  758,  759,  760,  761,  762,  763,  764,  765,  766,
+      719,  767,  769,  728,  770,  771,  772,  764,  750,  751,
+      773,  774,  775,  776,  777,  779,  780,  780,  781,  782,
+      784,  785,  786,  781,  785,  787,  788,  789,  790,  791,
+
+      792,  793,  794,  795,  796,  797,  799,  800,  801,  802,
+      804,  805,  806,  807,  796,  808,  793,  809,  810,  811,
+      812,  813,  814,  815,  817,  818,  819,  820,  821,  822,
+      823,  824,  825,  827,  826,  828,  829,  830,  831,  832,
+      834,  835,  836,  837,  781,  838,  839,  841,  842,  843,
+      826,  844,  845,  846,  847,  848,  849,  850,  851,  825,
+      826,  852,  853,  830,  855,  856,  857,  858,  859,  860,
+      856,  861,  852,  862,  863,  864,  865,  866,  867,  868,
+      869,  870,  871,  872,  873,  874,  875,  877,  878,  879,
+      880,  881,  882,  883,  885,  886,  888,  889,  890,  891,
+
+      892,  893,  894,  896,  897,  898,  899,  900,  901,  899,
+      902,  904,  905,  906,  907,  910,  911,  912,  913,  914,
+      915,  892,  916,  917,  918,  919,  920,  921,  897,  922,
+      924,  926,  898,  928,  929,  930,  931,  932,  934,  935,
+      936,  938,  939,  940,  941,  944,  945,  946,  947,  948,
+      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
+      959,  960,  961,  962,  963,  964,  965,  967,  968,  969,
+      970,  971,  972,  973,  974,  975,  976,  977,  979,  980,
+      981,  982,  983,  984,  985,  986,  987,  988,  989,  990,
+      991,  963,  992,  993,  997,  998,  999, 1000,  992, 1001,
+
+      992, 1002, 1003, 1004,  952, 1005, 1007, 1008, 1009, 1011,
+     1015, 1016,  969, 1017, 1018, 1019, 1020, 1022, 1023, 1018,
+     1024, 1026, 1027, 1028, 1029, 1030, 1031, 1033, 1034, 1035,
+     1031, 1036, 1037, 1038, 1039, 1040, 1041, 1043, 1044, 1046,
+     1020, 1047, 1048, 1049, 1050, 1052, 1053, 1054, 1055, 1058,
+     1059, 1061, 1062, 1064, 1065, 1067, 1069, 1071, 1072, 1073,
+     1074, 1075, 1076, 1077, 1078, 1064, 1079, 1080, 1081, 1082,
+     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+     1093, 1094, 1095, 1071, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111,
+
+     1102, 1114, 1117, 1118, 1121, 1122, 1123, 1124, 1125, 1126,
+     1128, 1130, 1132, 1133, 1134, 1136, 1137, 1138, 1139, 1140,
+     1141, 1142, 1143, 1144, 1109, 1146, 1147, 1148, 1149, 1151,
+     1152, 1153, 1154, 1148, 1155, 1156, 1158, 1159, 1161, 1162,
+     1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1172, 1175,
+     1176, 1177, 1179, 1180, 1182, 1183, 1184, 1185, 1188, 1189,
+     1190, 1191, 1192, 1193, 1195, 1196, 1197, 1198, 1199, 1200,
+     1201, 1202, 1204, 1205, 1206, 1208, 1209, 1210, 1211, 1212,
+     1213, 1214, 1215, 1216, 1217, 1218, 1220, 1222, 1223, 1224,
+     1225, 1227, 1228, 1229, 1230, 1232, 1233, 1234, 1235, 1237,
+
+     1238, 1239, 1240, 1241, 1242, 1243, 1245, 1246, 1247, 1248,
+     1249, 1250, 1251, 1252, 1253, 1254, 1256, 1257, 1258, 1259,
+     1261, 1262, 1263, 1264, 1265, 1266, 1270, 1271, 1272, 1274,
+     1275, 1276, 1277, 1278, 1279, 1280, 1282, 1283, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+
+     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285
     } ;
 
+
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
 
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[154] =
+static const flex_int16_t yy_rule_linenum[158] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  195,  204,  213,  223,  232,  241,  250,
@@ -1559,11 +1738,11 @@ static const flex_int16_t yy_rule_linenum[154] =
       926,  935,  944,  953,  962,  971,  980,  989,  998, 1007,
 
      1016, 1025, 1034, 1043, 1052, 1061, 1070, 1079, 1088, 1097,
-     1106, 1115, 1124, 1133, 1142, 1151, 1161, 1171, 1181, 1191,
-     1201, 1211, 1221, 1231, 1241, 1250, 1259, 1268, 1277, 1286,
-     1295, 1305, 1315, 1327, 1338, 1351, 1449, 1454, 1459, 1464,
-     1465, 1466, 1467, 1468, 1469, 1471, 1489, 1502, 1507, 1511,
-     1513, 1515, 1517
+     1106, 1115, 1124, 1133, 1142, 1151, 1160, 1169, 1178, 1188,
+     1198, 1208, 1218, 1228, 1238, 1248, 1258, 1268, 1278, 1287,
+     1296, 1305, 1314, 1323, 1332, 1342, 1352, 1364, 1375, 1388,
+     1486, 1491, 1496, 1501, 1502, 1503, 1504, 1505, 1506, 1508,
+     1526, 1539, 1544, 1548, 1550, 1552, 1554
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1610,7 +1789,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1613 "dhcp4_lexer.cc"
+#line 1792 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1636,8 +1815,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1639 "dhcp4_lexer.cc"
-#line 1640 "dhcp4_lexer.cc"
+#line 1818 "dhcp4_lexer.cc"
+#line 1819 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1959,7 +2138,7 @@ YY_DECL
     }
 
 
-#line 1962 "dhcp4_lexer.cc"
+#line 2141 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1988,13 +2167,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1231 )
+				if ( yy_current_state >= 1286 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1230 );
+		while ( yy_current_state != 1285 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2013,13 +2192,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 154 )
+			else if ( yy_act < 158 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 154 )
+			else if ( yy_act == 158 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 155 )
+			else if ( yy_act == 159 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3183,6 +3362,42 @@ YY_RULE_SETUP
 case 97:
 YY_RULE_SETUP
 #line 980 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp4Parser::make_BACKGROUND_RECLAMATION(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("background-reclamation", driver.loc_);
+    }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 989 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp4Parser::make_RECLAIM_SLICE_LEASES(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("reclaim-slice-leases", driver.loc_);
+    }
+}
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+#line 998 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp4Parser::make_MAX_RECLAIM_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("max-reclaim-rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 1007 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3192,9 +3407,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 101:
 YY_RULE_SETUP
-#line 989 "dhcp4_lexer.ll"
+#line 1016 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3204,9 +3419,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 102:
 YY_RULE_SETUP
-#line 998 "dhcp4_lexer.ll"
+#line 1025 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3216,9 +3431,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 103:
 YY_RULE_SETUP
-#line 1007 "dhcp4_lexer.ll"
+#line 1034 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3228,9 +3443,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 104:
 YY_RULE_SETUP
-#line 1016 "dhcp4_lexer.ll"
+#line 1043 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3240,9 +3455,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 105:
 YY_RULE_SETUP
-#line 1025 "dhcp4_lexer.ll"
+#line 1052 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3252,9 +3467,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 106:
 YY_RULE_SETUP
-#line 1034 "dhcp4_lexer.ll"
+#line 1061 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3264,9 +3479,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 107:
 YY_RULE_SETUP
-#line 1043 "dhcp4_lexer.ll"
+#line 1070 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3276,9 +3491,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 108:
 YY_RULE_SETUP
-#line 1052 "dhcp4_lexer.ll"
+#line 1079 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3288,9 +3503,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 109:
 YY_RULE_SETUP
-#line 1061 "dhcp4_lexer.ll"
+#line 1088 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3300,9 +3515,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 110:
 YY_RULE_SETUP
-#line 1070 "dhcp4_lexer.ll"
+#line 1097 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3312,9 +3527,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 111:
 YY_RULE_SETUP
-#line 1079 "dhcp4_lexer.ll"
+#line 1106 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3324,9 +3539,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 112:
 YY_RULE_SETUP
-#line 1088 "dhcp4_lexer.ll"
+#line 1115 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3336,9 +3551,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 113:
 YY_RULE_SETUP
-#line 1097 "dhcp4_lexer.ll"
+#line 1124 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3348,9 +3563,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 114:
 YY_RULE_SETUP
-#line 1106 "dhcp4_lexer.ll"
+#line 1133 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3360,9 +3575,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 115:
 YY_RULE_SETUP
-#line 1115 "dhcp4_lexer.ll"
+#line 1142 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3372,9 +3587,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 116:
 YY_RULE_SETUP
-#line 1124 "dhcp4_lexer.ll"
+#line 1151 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3384,9 +3599,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 117:
 YY_RULE_SETUP
-#line 1133 "dhcp4_lexer.ll"
+#line 1160 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3396,9 +3611,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 118:
 YY_RULE_SETUP
-#line 1142 "dhcp4_lexer.ll"
+#line 1169 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3408,9 +3623,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 119:
 YY_RULE_SETUP
-#line 1151 "dhcp4_lexer.ll"
+#line 1178 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3421,9 +3636,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 117:
+case 120:
 YY_RULE_SETUP
-#line 1161 "dhcp4_lexer.ll"
+#line 1188 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3434,9 +3649,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 118:
+case 121:
 YY_RULE_SETUP
-#line 1171 "dhcp4_lexer.ll"
+#line 1198 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3447,9 +3662,22 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 119:
+case 122:
 YY_RULE_SETUP
-#line 1181 "dhcp4_lexer.ll"
+#line 1208 "dhcp4_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp4Parser::make_BINARY(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 123:
+YY_RULE_SETUP
+#line 1218 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3460,9 +3688,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 120:
+case 124:
 YY_RULE_SETUP
-#line 1191 "dhcp4_lexer.ll"
+#line 1228 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3473,9 +3701,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 121:
+case 125:
 YY_RULE_SETUP
-#line 1201 "dhcp4_lexer.ll"
+#line 1238 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3486,9 +3714,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 122:
+case 126:
 YY_RULE_SETUP
-#line 1211 "dhcp4_lexer.ll"
+#line 1248 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3499,9 +3727,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 123:
+case 127:
 YY_RULE_SETUP
-#line 1221 "dhcp4_lexer.ll"
+#line 1258 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3512,9 +3740,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 124:
+case 128:
 YY_RULE_SETUP
-#line 1231 "dhcp4_lexer.ll"
+#line 1268 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3525,9 +3753,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 125:
+case 129:
 YY_RULE_SETUP
-#line 1241 "dhcp4_lexer.ll"
+#line 1278 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3537,9 +3765,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 130:
 YY_RULE_SETUP
-#line 1250 "dhcp4_lexer.ll"
+#line 1287 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3549,9 +3777,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 131:
 YY_RULE_SETUP
-#line 1259 "dhcp4_lexer.ll"
+#line 1296 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3561,9 +3789,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 132:
 YY_RULE_SETUP
-#line 1268 "dhcp4_lexer.ll"
+#line 1305 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3573,9 +3801,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 133:
 YY_RULE_SETUP
-#line 1277 "dhcp4_lexer.ll"
+#line 1314 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3585,9 +3813,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 134:
 YY_RULE_SETUP
-#line 1286 "dhcp4_lexer.ll"
+#line 1323 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3597,9 +3825,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 135:
 YY_RULE_SETUP
-#line 1295 "dhcp4_lexer.ll"
+#line 1332 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3610,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 136:
 YY_RULE_SETUP
-#line 1305 "dhcp4_lexer.ll"
+#line 1342 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3623,9 +3851,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 137:
 YY_RULE_SETUP
-#line 1315 "dhcp4_lexer.ll"
+#line 1352 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3638,9 +3866,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 138:
 YY_RULE_SETUP
-#line 1327 "dhcp4_lexer.ll"
+#line 1364 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3652,9 +3880,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 139:
 YY_RULE_SETUP
-#line 1338 "dhcp4_lexer.ll"
+#line 1375 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3666,9 +3894,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 140:
 YY_RULE_SETUP
-#line 1351 "dhcp4_lexer.ll"
+#line 1388 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3767,65 +3995,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 137:
-/* rule 137 can match eol */
+case 141:
+/* rule 141 can match eol */
 YY_RULE_SETUP
-#line 1449 "dhcp4_lexer.ll"
+#line 1486 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 138:
-/* rule 138 can match eol */
+case 142:
+/* rule 142 can match eol */
 YY_RULE_SETUP
-#line 1454 "dhcp4_lexer.ll"
+#line 1491 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 139:
+case 143:
 YY_RULE_SETUP
-#line 1459 "dhcp4_lexer.ll"
+#line 1496 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 140:
+case 144:
 YY_RULE_SETUP
-#line 1464 "dhcp4_lexer.ll"
+#line 1501 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 141:
+case 145:
 YY_RULE_SETUP
-#line 1465 "dhcp4_lexer.ll"
+#line 1502 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 142:
+case 146:
 YY_RULE_SETUP
-#line 1466 "dhcp4_lexer.ll"
+#line 1503 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 143:
+case 147:
 YY_RULE_SETUP
-#line 1467 "dhcp4_lexer.ll"
+#line 1504 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 144:
+case 148:
 YY_RULE_SETUP
-#line 1468 "dhcp4_lexer.ll"
+#line 1505 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 145:
+case 149:
 YY_RULE_SETUP
-#line 1469 "dhcp4_lexer.ll"
+#line 1506 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 146:
+case 150:
 YY_RULE_SETUP
-#line 1471 "dhcp4_lexer.ll"
+#line 1508 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -3844,9 +4072,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 147:
+case 151:
 YY_RULE_SETUP
-#line 1489 "dhcp4_lexer.ll"
+#line 1526 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -3860,43 +4088,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 148:
+case 152:
 YY_RULE_SETUP
-#line 1502 "dhcp4_lexer.ll"
+#line 1539 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 149:
+case 153:
 YY_RULE_SETUP
-#line 1507 "dhcp4_lexer.ll"
+#line 1544 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 150:
+case 154:
 YY_RULE_SETUP
-#line 1511 "dhcp4_lexer.ll"
+#line 1548 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 151:
+case 155:
 YY_RULE_SETUP
-#line 1513 "dhcp4_lexer.ll"
+#line 1550 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 152:
+case 156:
 YY_RULE_SETUP
-#line 1515 "dhcp4_lexer.ll"
+#line 1552 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 153:
+case 157:
 YY_RULE_SETUP
-#line 1517 "dhcp4_lexer.ll"
+#line 1554 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1519 "dhcp4_lexer.ll"
+#line 1556 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -3920,12 +4148,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 154:
+case 158:
 YY_RULE_SETUP
-#line 1542 "dhcp4_lexer.ll"
+#line 1579 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3928 "dhcp4_lexer.cc"
+#line 4156 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4244,7 +4472,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1231 )
+			if ( yy_current_state >= 1286 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4277,11 +4505,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1231 )
+		if ( yy_current_state >= 1286 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1230);
+	yy_is_jam = (yy_current_state == 1285);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5030,7 +5258,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1542 "dhcp4_lexer.ll"
+#line 1579 "dhcp4_lexer.ll"
 
 
 using namespace isc::dhcp;
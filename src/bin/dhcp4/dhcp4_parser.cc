@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   parser4_lex
 
-// First part of user declarations.
 
-#line 39 "dhcp4_parser.cc" // lalr1.cc:404
-
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "dhcp4_parser.h"
 
-// User implementation prologue.
 
-#line 53 "dhcp4_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "dhcp4_parser.yy" // lalr1.cc:413
+#line 34 "dhcp4_parser.yy"
 
 #include <dhcp4/parser_context.h>
 
-#line 59 "dhcp4_parser.cc" // lalr1.cc:413
+#line 52 "dhcp4_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER4_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER4_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !PARSER4_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:479
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 145 "dhcp4_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp4Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp4_parser.cc"
 
   /// Build a parser object.
   Dhcp4Parser::Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg)
-    :
 #if PARSER4_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::~Dhcp4Parser ()
   {}
 
+  Dhcp4Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Dhcp4Parser::by_state::by_state ()
+  Dhcp4Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Dhcp4Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp4Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Dhcp4Parser::by_state::clear ()
+  Dhcp4Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Dhcp4Parser::by_state::move (by_state& that)
   {
@@ -227,56 +188,94 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  inline
-  Dhcp4Parser::by_state::by_state (state_type s)
+  Dhcp4Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Dhcp4Parser::symbol_number_type
-  Dhcp4Parser::by_state::type_get () const
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Dhcp4Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
-    {
-      case 158: // value
-      case 162: // map_value
-      case 200: // socket_type
-      case 210: // db_type
-      case 287: // hr_mode
-      case 420: // ncr_protocol_value
-      case 428: // replace_client_name_value
-        value.move< ElementPtr > (that.value);
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 144: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 143: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 142: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 141: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -284,39 +283,40 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Dhcp4Parser::stack_symbol_type&
   Dhcp4Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
-    {
-      case 158: // value
-      case 162: // map_value
-      case 200: // socket_type
-      case 210: // db_type
-      case 287: // hr_mode
-      case 420: // ncr_protocol_value
-      case 428: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 144: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 143: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 142: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 141: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -328,9 +328,51 @@ namespace isc { namespace dhcp {
     return *this;
   }
 
+  Dhcp4Parser::stack_symbol_type&
+  Dhcp4Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Dhcp4Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -341,126 +383,121 @@ namespace isc { namespace dhcp {
 #if PARSER4_DEBUG
   template <typename Base>
   void
-  Dhcp4Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp4Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 141: // "constant string"
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 364 "dhcp4_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 404 "dhcp4_parser.cc"
         break;
 
-      case 142: // "integer"
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 371 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 410 "dhcp4_parser.cc"
         break;
 
-      case 143: // "floating point"
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 378 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 416 "dhcp4_parser.cc"
         break;
 
-      case 144: // "boolean"
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 385 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 422 "dhcp4_parser.cc"
         break;
 
-      case 158: // value
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 392 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 428 "dhcp4_parser.cc"
         break;
 
-      case 162: // map_value
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 399 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_map_value: // map_value
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 434 "dhcp4_parser.cc"
         break;
 
-      case 200: // socket_type
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 406 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_socket_type: // socket_type
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 440 "dhcp4_parser.cc"
         break;
 
-      case 210: // db_type
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 413 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_db_type: // db_type
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 446 "dhcp4_parser.cc"
         break;
 
-      case 287: // hr_mode
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 420 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 452 "dhcp4_parser.cc"
         break;
 
-      case 420: // ncr_protocol_value
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 427 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 458 "dhcp4_parser.cc"
         break;
 
-      case 428: // replace_client_name_value
-
-#line 217 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 434 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 464 "dhcp4_parser.cc"
         break;
 
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 222 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 470 "dhcp4_parser.cc"
+        break;
 
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Dhcp4Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Dhcp4Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Dhcp4Parser::yypop_ (unsigned int n)
+  Dhcp4Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -492,32 +529,37 @@ namespace isc { namespace dhcp {
   }
 #endif // PARSER4_DEBUG
 
-  inline Dhcp4Parser::state_type
+  Dhcp4Parser::state_type
   Dhcp4Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Dhcp4Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Dhcp4Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -535,11 +577,11 @@ namespace isc { namespace dhcp {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -547,48 +589,70 @@ namespace isc { namespace dhcp {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -605,55 +669,58 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
-    {
-      case 158: // value
-      case 162: // map_value
-      case 200: // socket_type
-      case 210: // db_type
-      case 287: // hr_mode
-      case 420: // ncr_protocol_value
-      case 428: // replace_client_name_value
-        yylhs.value.build< ElementPtr > ();
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_ncr_format_value: // ncr_format_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 144: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 143: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 142: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 141: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -661,286 +728,289 @@ namespace isc { namespace dhcp {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 226 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 680 "dhcp4_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 231 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 750 "dhcp4_parser.cc"
     break;
 
-  case 4:
-#line 227 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 686 "dhcp4_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 232 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 756 "dhcp4_parser.cc"
     break;
 
-  case 6:
-#line 228 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 692 "dhcp4_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 233 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP4; }
+#line 762 "dhcp4_parser.cc"
     break;
 
-  case 8:
-#line 229 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 698 "dhcp4_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 234 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 768 "dhcp4_parser.cc"
     break;
 
-  case 10:
-#line 230 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.SUBNET4; }
-#line 704 "dhcp4_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 235 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET4; }
+#line 774 "dhcp4_parser.cc"
     break;
 
-  case 12:
-#line 231 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.POOLS; }
-#line 710 "dhcp4_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 236 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 780 "dhcp4_parser.cc"
     break;
 
-  case 14:
-#line 232 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 716 "dhcp4_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 237 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 786 "dhcp4_parser.cc"
     break;
 
-  case 16:
-#line 233 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 722 "dhcp4_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 238 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 792 "dhcp4_parser.cc"
     break;
 
-  case 18:
-#line 234 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 728 "dhcp4_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 239 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 798 "dhcp4_parser.cc"
     break;
 
-  case 20:
-#line 235 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 734 "dhcp4_parser.cc" // lalr1.cc:859
+  case 20: // $@10: %empty
+#line 240 "dhcp4_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 804 "dhcp4_parser.cc"
     break;
 
-  case 22:
-#line 236 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 740 "dhcp4_parser.cc" // lalr1.cc:859
+  case 22: // $@11: %empty
+#line 241 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 810 "dhcp4_parser.cc"
     break;
 
-  case 24:
-#line 244 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 746 "dhcp4_parser.cc" // lalr1.cc:859
+  case 24: // value: "integer"
+#line 249 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 816 "dhcp4_parser.cc"
     break;
 
-  case 25:
-#line 245 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 752 "dhcp4_parser.cc" // lalr1.cc:859
+  case 25: // value: "floating point"
+#line 250 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 822 "dhcp4_parser.cc"
     break;
 
-  case 26:
-#line 246 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 758 "dhcp4_parser.cc" // lalr1.cc:859
+  case 26: // value: "boolean"
+#line 251 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 828 "dhcp4_parser.cc"
     break;
 
-  case 27:
-#line 247 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 764 "dhcp4_parser.cc" // lalr1.cc:859
+  case 27: // value: "constant string"
+#line 252 "dhcp4_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 834 "dhcp4_parser.cc"
     break;
 
-  case 28:
-#line 248 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 770 "dhcp4_parser.cc" // lalr1.cc:859
+  case 28: // value: "null"
+#line 253 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 840 "dhcp4_parser.cc"
     break;
 
-  case 29:
-#line 249 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 776 "dhcp4_parser.cc" // lalr1.cc:859
+  case 29: // value: map2
+#line 254 "dhcp4_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 846 "dhcp4_parser.cc"
     break;
 
-  case 30:
-#line 250 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 782 "dhcp4_parser.cc" // lalr1.cc:859
+  case 30: // value: list_generic
+#line 255 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 852 "dhcp4_parser.cc"
     break;
 
-  case 31:
-#line 253 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 31: // sub_json: value
+#line 258 "dhcp4_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 791 "dhcp4_parser.cc" // lalr1.cc:859
+#line 861 "dhcp4_parser.cc"
     break;
 
-  case 32:
-#line 258 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 32: // $@12: %empty
+#line 263 "dhcp4_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 802 "dhcp4_parser.cc" // lalr1.cc:859
+#line 872 "dhcp4_parser.cc"
     break;
 
-  case 33:
-#line 263 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 33: // map2: "{" $@12 map_content "}"
+#line 268 "dhcp4_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 812 "dhcp4_parser.cc" // lalr1.cc:859
+#line 882 "dhcp4_parser.cc"
     break;
 
-  case 34:
-#line 269 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 818 "dhcp4_parser.cc" // lalr1.cc:859
+  case 34: // map_value: map2
+#line 274 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 888 "dhcp4_parser.cc"
     break;
 
-  case 37:
-#line 276 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 37: // not_empty_map: "constant string" ":" value
+#line 281 "dhcp4_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 827 "dhcp4_parser.cc" // lalr1.cc:859
+#line 897 "dhcp4_parser.cc"
     break;
 
-  case 38:
-#line 280 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 285 "dhcp4_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 837 "dhcp4_parser.cc" // lalr1.cc:859
+#line 907 "dhcp4_parser.cc"
     break;
 
-  case 39:
-#line 287 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 39: // $@13: %empty
+#line 292 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 846 "dhcp4_parser.cc" // lalr1.cc:859
+#line 916 "dhcp4_parser.cc"
     break;
 
-  case 40:
-#line 290 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 40: // list_generic: "[" $@13 list_content "]"
+#line 295 "dhcp4_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 854 "dhcp4_parser.cc" // lalr1.cc:859
+#line 924 "dhcp4_parser.cc"
     break;
 
-  case 43:
-#line 298 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 43: // not_empty_list: value
+#line 303 "dhcp4_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 863 "dhcp4_parser.cc" // lalr1.cc:859
+#line 933 "dhcp4_parser.cc"
     break;
 
-  case 44:
-#line 302 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 44: // not_empty_list: not_empty_list "," value
+#line 307 "dhcp4_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 872 "dhcp4_parser.cc" // lalr1.cc:859
+#line 942 "dhcp4_parser.cc"
     break;
 
-  case 45:
-#line 309 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 45: // $@14: %empty
+#line 314 "dhcp4_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 880 "dhcp4_parser.cc" // lalr1.cc:859
+#line 950 "dhcp4_parser.cc"
     break;
 
-  case 46:
-#line 311 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 46: // list_strings: "[" $@14 list_strings_content "]"
+#line 316 "dhcp4_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 889 "dhcp4_parser.cc" // lalr1.cc:859
+#line 959 "dhcp4_parser.cc"
     break;
 
-  case 49:
-#line 320 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 49: // not_empty_list_strings: "constant string"
+#line 325 "dhcp4_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 898 "dhcp4_parser.cc" // lalr1.cc:859
+#line 968 "dhcp4_parser.cc"
     break;
 
-  case 50:
-#line 324 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 50: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 329 "dhcp4_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 907 "dhcp4_parser.cc" // lalr1.cc:859
+#line 977 "dhcp4_parser.cc"
     break;
 
-  case 51:
-#line 335 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 51: // unknown_map_entry: "constant string" ":"
+#line 340 "dhcp4_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 918 "dhcp4_parser.cc" // lalr1.cc:859
+#line 988 "dhcp4_parser.cc"
     break;
 
-  case 52:
-#line 345 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 52: // $@15: %empty
+#line 350 "dhcp4_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 929 "dhcp4_parser.cc" // lalr1.cc:859
+#line 999 "dhcp4_parser.cc"
     break;
 
-  case 53:
-#line 350 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 53: // syntax_map: "{" $@15 global_objects "}"
+#line 355 "dhcp4_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 939 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1009 "dhcp4_parser.cc"
     break;
 
-  case 62:
-#line 371 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 62: // $@16: %empty
+#line 376 "dhcp4_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -948,686 +1018,713 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP4);
 }
-#line 952 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1022 "dhcp4_parser.cc"
     break;
 
-  case 63:
-#line 378 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 63: // dhcp4_object: "Dhcp4" $@16 ":" "{" global_params "}"
+#line 383 "dhcp4_parser.yy"
+                                                    {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 964 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1034 "dhcp4_parser.cc"
     break;
 
-  case 64:
-#line 388 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 64: // $@17: %empty
+#line 393 "dhcp4_parser.yy"
+                          {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 974 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1044 "dhcp4_parser.cc"
     break;
 
-  case 65:
-#line 392 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 65: // sub_dhcp4: "{" $@17 global_params "}"
+#line 397 "dhcp4_parser.yy"
+                               {
     // parsing completed
 }
-#line 982 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1052 "dhcp4_parser.cc"
     break;
 
-  case 89:
-#line 425 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 89: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 430 "dhcp4_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 991 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1061 "dhcp4_parser.cc"
     break;
 
-  case 90:
-#line 430 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 90: // renew_timer: "renew-timer" ":" "integer"
+#line 435 "dhcp4_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1000 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1070 "dhcp4_parser.cc"
     break;
 
-  case 91:
-#line 435 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 91: // rebind_timer: "rebind-timer" ":" "integer"
+#line 440 "dhcp4_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1009 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1079 "dhcp4_parser.cc"
     break;
 
-  case 92:
-#line 440 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 92: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 445 "dhcp4_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1018 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1088 "dhcp4_parser.cc"
     break;
 
-  case 93:
-#line 445 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 93: // echo_client_id: "echo-client-id" ":" "boolean"
+#line 450 "dhcp4_parser.yy"
+                                             {
+    ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1027 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1097 "dhcp4_parser.cc"
     break;
 
-  case 94:
-#line 450 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 94: // match_client_id: "match-client-id" ":" "boolean"
+#line 455 "dhcp4_parser.yy"
+                                               {
+    ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1036 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1106 "dhcp4_parser.cc"
     break;
 
-  case 95:
-#line 456 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 95: // $@18: %empty
+#line 461 "dhcp4_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1047 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1117 "dhcp4_parser.cc"
     break;
 
-  case 96:
-#line 461 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 96: // interfaces_config: "interfaces-config" $@18 ":" "{" interfaces_config_params "}"
+#line 466 "dhcp4_parser.yy"
+                                                               {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1056 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1126 "dhcp4_parser.cc"
     break;
 
-  case 102:
-#line 475 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 102: // $@19: %empty
+#line 480 "dhcp4_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1066 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1136 "dhcp4_parser.cc"
     break;
 
-  case 103:
-#line 479 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 103: // sub_interfaces4: "{" $@19 interfaces_config_params "}"
+#line 484 "dhcp4_parser.yy"
+                                          {
     // parsing completed
 }
-#line 1074 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1144 "dhcp4_parser.cc"
     break;
 
-  case 104:
-#line 483 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 104: // $@20: %empty
+#line 488 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1085 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1155 "dhcp4_parser.cc"
     break;
 
-  case 105:
-#line 488 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 105: // interfaces_list: "interfaces" $@20 ":" list_strings
+#line 493 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1094 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1164 "dhcp4_parser.cc"
     break;
 
-  case 106:
-#line 493 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 106: // $@21: %empty
+#line 498 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1102 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1172 "dhcp4_parser.cc"
     break;
 
-  case 107:
-#line 495 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 107: // dhcp_socket_type: "dhcp-socket-type" $@21 ":" socket_type
+#line 500 "dhcp4_parser.yy"
+                    {
+    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1111 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1181 "dhcp4_parser.cc"
     break;
 
-  case 108:
-#line 500 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1117 "dhcp4_parser.cc" // lalr1.cc:859
+  case 108: // socket_type: "raw"
+#line 505 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
+#line 1187 "dhcp4_parser.cc"
     break;
 
-  case 109:
-#line 501 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1123 "dhcp4_parser.cc" // lalr1.cc:859
+  case 109: // socket_type: "udp"
+#line 506 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
+#line 1193 "dhcp4_parser.cc"
     break;
 
-  case 110:
-#line 504 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 110: // re_detect: "re-detect" ":" "boolean"
+#line 509 "dhcp4_parser.yy"
+                                   {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1132 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1202 "dhcp4_parser.cc"
     break;
 
-  case 111:
-#line 510 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 111: // $@22: %empty
+#line 515 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1143 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1213 "dhcp4_parser.cc"
     break;
 
-  case 112:
-#line 515 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 112: // lease_database: "lease-database" $@22 ":" "{" database_map_params "}"
+#line 520 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1152 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1222 "dhcp4_parser.cc"
     break;
 
-  case 113:
-#line 520 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 113: // $@23: %empty
+#line 525 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1163 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1233 "dhcp4_parser.cc"
     break;
 
-  case 114:
-#line 525 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 114: // hosts_database: "hosts-database" $@23 ":" "{" database_map_params "}"
+#line 530 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1172 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1242 "dhcp4_parser.cc"
     break;
 
-  case 130:
-#line 549 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 130: // $@24: %empty
+#line 554 "dhcp4_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1180 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1250 "dhcp4_parser.cc"
     break;
 
-  case 131:
-#line 551 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 131: // database_type: "type" $@24 ":" db_type
+#line 556 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1189 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1259 "dhcp4_parser.cc"
     break;
 
-  case 132:
-#line 556 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1195 "dhcp4_parser.cc" // lalr1.cc:859
+  case 132: // db_type: "memfile"
+#line 561 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1265 "dhcp4_parser.cc"
     break;
 
-  case 133:
-#line 557 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1201 "dhcp4_parser.cc" // lalr1.cc:859
+  case 133: // db_type: "mysql"
+#line 562 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1271 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 558 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1207 "dhcp4_parser.cc" // lalr1.cc:859
+  case 134: // db_type: "postgresql"
+#line 563 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1277 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 559 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1213 "dhcp4_parser.cc" // lalr1.cc:859
+  case 135: // db_type: "cql"
+#line 564 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1283 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 562 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 136: // $@25: %empty
+#line 567 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1221 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1291 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 564 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 137: // user: "user" $@25 ":" "constant string"
+#line 569 "dhcp4_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1231 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1301 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 570 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 138: // $@26: %empty
+#line 575 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1239 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1309 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 572 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 139: // password: "password" $@26 ":" "constant string"
+#line 577 "dhcp4_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1249 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1319 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 578 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 140: // $@27: %empty
+#line 583 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1257 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1327 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 580 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 141: // host: "host" $@27 ":" "constant string"
+#line 585 "dhcp4_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1267 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1337 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 586 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 142: // port: "port" ":" "integer"
+#line 591 "dhcp4_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1276 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1346 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 591 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 143: // $@28: %empty
+#line 596 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1354 "dhcp4_parser.cc"
     break;
 
-  case 144:
-#line 593 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 144: // name: "name" $@28 ":" "constant string"
+#line 598 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1294 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1364 "dhcp4_parser.cc"
     break;
 
-  case 145:
-#line 599 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 145: // persist: "persist" ":" "boolean"
+#line 604 "dhcp4_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1303 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1373 "dhcp4_parser.cc"
     break;
 
-  case 146:
-#line 604 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 146: // lfc_interval: "lfc-interval" ":" "integer"
+#line 609 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1312 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1382 "dhcp4_parser.cc"
     break;
 
-  case 147:
-#line 609 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 147: // readonly: "readonly" ":" "boolean"
+#line 614 "dhcp4_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1321 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1391 "dhcp4_parser.cc"
     break;
 
-  case 148:
-#line 614 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 148: // connect_timeout: "connect-timeout" ":" "integer"
+#line 619 "dhcp4_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1330 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1400 "dhcp4_parser.cc"
     break;
 
-  case 149:
-#line 619 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 149: // $@29: %empty
+#line 624 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1338 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1408 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 621 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 150: // contact_points: "contact-points" $@29 ":" "constant string"
+#line 626 "dhcp4_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1348 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1418 "dhcp4_parser.cc"
     break;
 
-  case 151:
-#line 627 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 151: // $@30: %empty
+#line 632 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1356 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1426 "dhcp4_parser.cc"
     break;
 
-  case 152:
-#line 629 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 152: // keyspace: "keyspace" $@30 ":" "constant string"
+#line 634 "dhcp4_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1366 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1436 "dhcp4_parser.cc"
     break;
 
-  case 153:
-#line 636 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 153: // $@31: %empty
+#line 641 "dhcp4_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1377 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1447 "dhcp4_parser.cc"
     break;
 
-  case 154:
-#line 641 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 154: // host_reservation_identifiers: "host-reservation-identifiers" $@31 ":" "[" host_reservation_identifiers_list "]"
+#line 646 "dhcp4_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1386 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1456 "dhcp4_parser.cc"
     break;
 
-  case 162:
-#line 657 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 162: // duid_id: "duid"
+#line 662 "dhcp4_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1395 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1465 "dhcp4_parser.cc"
     break;
 
-  case 163:
-#line 662 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 163: // hw_address_id: "hw-address"
+#line 667 "dhcp4_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1404 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1474 "dhcp4_parser.cc"
     break;
 
-  case 164:
-#line 667 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 164: // circuit_id: "circuit-id"
+#line 672 "dhcp4_parser.yy"
+                        {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1413 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1483 "dhcp4_parser.cc"
     break;
 
-  case 165:
-#line 672 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 165: // client_id: "client-id"
+#line 677 "dhcp4_parser.yy"
+                      {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1422 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1492 "dhcp4_parser.cc"
     break;
 
-  case 166:
-#line 677 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 166: // flex_id: "flex-id"
+#line 682 "dhcp4_parser.yy"
+                 {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1431 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1501 "dhcp4_parser.cc"
     break;
 
-  case 167:
-#line 682 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 167: // $@32: %empty
+#line 687 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1442 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1512 "dhcp4_parser.cc"
     break;
 
-  case 168:
-#line 687 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 168: // hooks_libraries: "hooks-libraries" $@32 ":" "[" hooks_libraries_list "]"
+#line 692 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1451 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1521 "dhcp4_parser.cc"
     break;
 
-  case 173:
-#line 700 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 173: // $@33: %empty
+#line 705 "dhcp4_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1461 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1531 "dhcp4_parser.cc"
     break;
 
-  case 174:
-#line 704 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 174: // hooks_library: "{" $@33 hooks_params "}"
+#line 709 "dhcp4_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1469 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1539 "dhcp4_parser.cc"
     break;
 
-  case 175:
-#line 708 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 175: // $@34: %empty
+#line 713 "dhcp4_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1479 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1549 "dhcp4_parser.cc"
     break;
 
-  case 176:
-#line 712 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 176: // sub_hooks_library: "{" $@34 hooks_params "}"
+#line 717 "dhcp4_parser.yy"
+                              {
     // parsing completed
 }
-#line 1487 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1557 "dhcp4_parser.cc"
     break;
 
-  case 182:
-#line 725 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 182: // $@35: %empty
+#line 730 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1495 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1565 "dhcp4_parser.cc"
     break;
 
-  case 183:
-#line 727 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 183: // library: "library" $@35 ":" "constant string"
+#line 732 "dhcp4_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1505 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1575 "dhcp4_parser.cc"
     break;
 
-  case 184:
-#line 733 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 184: // $@36: %empty
+#line 738 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1513 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1583 "dhcp4_parser.cc"
     break;
 
-  case 185:
-#line 735 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 185: // parameters: "parameters" $@36 ":" value
+#line 740 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1522 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1592 "dhcp4_parser.cc"
     break;
 
-  case 186:
-#line 741 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 186: // $@37: %empty
+#line 746 "dhcp4_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1533 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1603 "dhcp4_parser.cc"
     break;
 
-  case 187:
-#line 746 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 187: // expired_leases_processing: "expired-leases-processing" $@37 ":" "{" expired_leases_params "}"
+#line 751 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1542 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1612 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 763 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 199: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 771 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1551 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1621 "dhcp4_parser.cc"
     break;
 
-  case 197:
-#line 768 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 200: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 776 "dhcp4_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1560 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1630 "dhcp4_parser.cc"
     break;
 
-  case 198:
-#line 773 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 201: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 781 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1569 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1639 "dhcp4_parser.cc"
     break;
 
-  case 199:
-#line 778 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 202: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 786 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1578 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1648 "dhcp4_parser.cc"
     break;
 
-  case 200:
-#line 783 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 203: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 791 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1587 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1657 "dhcp4_parser.cc"
     break;
 
-  case 201:
-#line 788 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 204: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 796 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1596 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1666 "dhcp4_parser.cc"
     break;
 
-  case 202:
-#line 796 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 205: // background_reclamation: "background-reclamation" ":" "boolean"
+#line 801 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr value(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("background-reclamation", value);
+}
+#line 1675 "dhcp4_parser.cc"
+    break;
+
+  case 206: // reclaim_slice_leases: "reclaim-slice-leases" ":" "integer"
+#line 806 "dhcp4_parser.yy"
+                                                         {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("reclaim-slice-leases", value);
+}
+#line 1684 "dhcp4_parser.cc"
+    break;
+
+  case 207: // max_reclaim_rate: "max-reclaim-rate" ":" "integer"
+#line 811 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("max-reclaim-rate", value);
+}
+#line 1693 "dhcp4_parser.cc"
+    break;
+
+  case 208: // $@38: %empty
+#line 819 "dhcp4_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1607 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1704 "dhcp4_parser.cc"
     break;
 
-  case 203:
-#line 801 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 209: // subnet4_list: "subnet4" $@38 ":" "[" subnet4_list_content "]"
+#line 824 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1616 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1713 "dhcp4_parser.cc"
     break;
 
-  case 208:
-#line 821 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 214: // $@39: %empty
+#line 844 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1626 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1723 "dhcp4_parser.cc"
     break;
 
-  case 209:
-#line 825 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 215: // subnet4: "{" $@39 subnet4_params "}"
+#line 848 "dhcp4_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1645,1468 +1742,1483 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1649 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1746 "dhcp4_parser.cc"
     break;
 
-  case 210:
-#line 844 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 216: // $@40: %empty
+#line 867 "dhcp4_parser.yy"
+                            {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1659 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1756 "dhcp4_parser.cc"
     break;
 
-  case 211:
-#line 848 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 217: // sub_subnet4: "{" $@40 subnet4_params "}"
+#line 871 "dhcp4_parser.yy"
+                                {
     // parsing completed
 }
-#line 1667 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1764 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 880 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 240: // $@41: %empty
+#line 903 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1675 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1772 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 882 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 241: // subnet: "subnet" $@41 ":" "constant string"
+#line 905 "dhcp4_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1685 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1782 "dhcp4_parser.cc"
     break;
 
-  case 236:
-#line 888 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 242: // $@42: %empty
+#line 911 "dhcp4_parser.yy"
+                                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1693 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1790 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 890 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 243: // subnet_4o6_interface: "4o6-interface" $@42 ":" "constant string"
+#line 913 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1703 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1800 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 896 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 244: // $@43: %empty
+#line 919 "dhcp4_parser.yy"
+                                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1711 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1808 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 898 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 245: // subnet_4o6_interface_id: "4o6-interface-id" $@43 ":" "constant string"
+#line 921 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 1721 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1818 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 904 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 246: // $@44: %empty
+#line 927 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1729 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1826 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 906 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 247: // subnet_4o6_subnet: "4o6-subnet" $@44 ":" "constant string"
+#line 929 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 1739 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1836 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 912 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 248: // $@45: %empty
+#line 935 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1747 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1844 "dhcp4_parser.cc"
     break;
 
-  case 243:
-#line 914 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 249: // interface: "interface" $@45 ":" "constant string"
+#line 937 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1757 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1854 "dhcp4_parser.cc"
     break;
 
-  case 244:
-#line 920 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 250: // $@46: %empty
+#line 943 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1765 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1862 "dhcp4_parser.cc"
     break;
 
-  case 245:
-#line 922 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 251: // interface_id: "interface-id" $@46 ":" "constant string"
+#line 945 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1775 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1872 "dhcp4_parser.cc"
     break;
 
-  case 246:
-#line 928 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 252: // $@47: %empty
+#line 951 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1783 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1880 "dhcp4_parser.cc"
     break;
 
-  case 247:
-#line 930 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 253: // client_class: "client-class" $@47 ":" "constant string"
+#line 953 "dhcp4_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1793 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1890 "dhcp4_parser.cc"
     break;
 
-  case 248:
-#line 936 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 254: // $@48: %empty
+#line 959 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 1801 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1898 "dhcp4_parser.cc"
     break;
 
-  case 249:
-#line 938 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
+  case 255: // reservation_mode: "reservation-mode" $@48 ":" hr_mode
+#line 961 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1810 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1907 "dhcp4_parser.cc"
     break;
 
-  case 250:
-#line 943 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 1816 "dhcp4_parser.cc" // lalr1.cc:859
+  case 256: // hr_mode: "disabled"
+#line 966 "dhcp4_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 1913 "dhcp4_parser.cc"
     break;
 
-  case 251:
-#line 944 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 1822 "dhcp4_parser.cc" // lalr1.cc:859
+  case 257: // hr_mode: "out-of-pool"
+#line 967 "dhcp4_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 1919 "dhcp4_parser.cc"
     break;
 
-  case 252:
-#line 945 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 1828 "dhcp4_parser.cc" // lalr1.cc:859
+  case 258: // hr_mode: "all"
+#line 968 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 1925 "dhcp4_parser.cc"
     break;
 
-  case 253:
-#line 948 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 259: // id: "id" ":" "integer"
+#line 971 "dhcp4_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1837 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1934 "dhcp4_parser.cc"
     break;
 
-  case 254:
-#line 953 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 260: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 976 "dhcp4_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1846 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1943 "dhcp4_parser.cc"
     break;
 
-  case 255:
-#line 962 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 261: // $@49: %empty
+#line 985 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1857 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1954 "dhcp4_parser.cc"
     break;
 
-  case 256:
-#line 967 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 262: // option_def_list: "option-def" $@49 ":" "[" option_def_list_content "]"
+#line 990 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1866 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1963 "dhcp4_parser.cc"
     break;
 
-  case 261:
-#line 984 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 267: // $@50: %empty
+#line 1007 "dhcp4_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1876 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1973 "dhcp4_parser.cc"
     break;
 
-  case 262:
-#line 988 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 268: // option_def_entry: "{" $@50 option_def_params "}"
+#line 1011 "dhcp4_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1884 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1981 "dhcp4_parser.cc"
     break;
 
-  case 263:
-#line 995 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 269: // $@51: %empty
+#line 1018 "dhcp4_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1894 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1991 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 999 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 270: // sub_option_def: "{" $@51 option_def_params "}"
+#line 1022 "dhcp4_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1902 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1999 "dhcp4_parser.cc"
     break;
 
-  case 278:
-#line 1025 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 284: // code: "code" ":" "integer"
+#line 1048 "dhcp4_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1911 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2008 "dhcp4_parser.cc"
     break;
 
-  case 280:
-#line 1032 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 286: // $@52: %empty
+#line 1055 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1919 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2016 "dhcp4_parser.cc"
     break;
 
-  case 281:
-#line 1034 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 287: // option_def_type: "type" $@52 ":" "constant string"
+#line 1057 "dhcp4_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1929 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2026 "dhcp4_parser.cc"
     break;
 
-  case 282:
-#line 1040 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 288: // $@53: %empty
+#line 1063 "dhcp4_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1937 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2034 "dhcp4_parser.cc"
     break;
 
-  case 283:
-#line 1042 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 289: // option_def_record_types: "record-types" $@53 ":" "constant string"
+#line 1065 "dhcp4_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1947 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2044 "dhcp4_parser.cc"
     break;
 
-  case 284:
-#line 1048 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 290: // $@54: %empty
+#line 1071 "dhcp4_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1955 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2052 "dhcp4_parser.cc"
     break;
 
-  case 285:
-#line 1050 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 291: // space: "space" $@54 ":" "constant string"
+#line 1073 "dhcp4_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1965 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2062 "dhcp4_parser.cc"
     break;
 
-  case 287:
-#line 1058 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 293: // $@55: %empty
+#line 1081 "dhcp4_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1973 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2070 "dhcp4_parser.cc"
     break;
 
-  case 288:
-#line 1060 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 294: // option_def_encapsulate: "encapsulate" $@55 ":" "constant string"
+#line 1083 "dhcp4_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1983 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2080 "dhcp4_parser.cc"
     break;
 
-  case 289:
-#line 1066 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 295: // option_def_array: "array" ":" "boolean"
+#line 1089 "dhcp4_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1992 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2089 "dhcp4_parser.cc"
     break;
 
-  case 290:
-#line 1075 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 296: // $@56: %empty
+#line 1098 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2003 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2100 "dhcp4_parser.cc"
     break;
 
-  case 291:
-#line 1080 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 297: // option_data_list: "option-data" $@56 ":" "[" option_data_list_content "]"
+#line 1103 "dhcp4_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2012 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2109 "dhcp4_parser.cc"
     break;
 
-  case 296:
-#line 1099 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 302: // $@57: %empty
+#line 1122 "dhcp4_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2022 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2119 "dhcp4_parser.cc"
     break;
 
-  case 297:
-#line 1103 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 303: // option_data_entry: "{" $@57 option_data_params "}"
+#line 1126 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2030 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2127 "dhcp4_parser.cc"
     break;
 
-  case 298:
-#line 1110 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 304: // $@58: %empty
+#line 1133 "dhcp4_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2040 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2137 "dhcp4_parser.cc"
     break;
 
-  case 299:
-#line 1114 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 305: // sub_option_data: "{" $@58 option_data_params "}"
+#line 1137 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2048 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2145 "dhcp4_parser.cc"
     break;
 
-  case 312:
-#line 1144 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 318: // $@59: %empty
+#line 1167 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2056 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2153 "dhcp4_parser.cc"
     break;
 
-  case 313:
-#line 1146 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 319: // option_data_data: "data" $@59 ":" "constant string"
+#line 1169 "dhcp4_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2066 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2163 "dhcp4_parser.cc"
     break;
 
-  case 316:
-#line 1156 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 322: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1179 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2075 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2172 "dhcp4_parser.cc"
     break;
 
-  case 317:
-#line 1161 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 323: // option_data_always_send: "always-send" ":" "boolean"
+#line 1184 "dhcp4_parser.yy"
+                                                   {
+    ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2084 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2181 "dhcp4_parser.cc"
     break;
 
-  case 318:
-#line 1169 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 324: // $@60: %empty
+#line 1192 "dhcp4_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2095 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2192 "dhcp4_parser.cc"
     break;
 
-  case 319:
-#line 1174 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 325: // pools_list: "pools" $@60 ":" "[" pools_list_content "]"
+#line 1197 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2104 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2201 "dhcp4_parser.cc"
     break;
 
-  case 324:
-#line 1189 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 330: // $@61: %empty
+#line 1212 "dhcp4_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2114 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2211 "dhcp4_parser.cc"
     break;
 
-  case 325:
-#line 1193 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 331: // pool_list_entry: "{" $@61 pool_params "}"
+#line 1216 "dhcp4_parser.yy"
+                             {
     ctx.stack_.pop_back();
 }
-#line 2122 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2219 "dhcp4_parser.cc"
     break;
 
-  case 326:
-#line 1197 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 332: // $@62: %empty
+#line 1220 "dhcp4_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2132 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2229 "dhcp4_parser.cc"
     break;
 
-  case 327:
-#line 1201 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 333: // sub_pool4: "{" $@62 pool_params "}"
+#line 1224 "dhcp4_parser.yy"
+                             {
     // parsing completed
 }
-#line 2140 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2237 "dhcp4_parser.cc"
     break;
 
-  case 334:
-#line 1215 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 340: // $@63: %empty
+#line 1238 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2148 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2245 "dhcp4_parser.cc"
     break;
 
-  case 335:
-#line 1217 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 341: // pool_entry: "pool" $@63 ":" "constant string"
+#line 1240 "dhcp4_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2158 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2255 "dhcp4_parser.cc"
     break;
 
-  case 336:
-#line 1223 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 342: // $@64: %empty
+#line 1246 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2166 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2263 "dhcp4_parser.cc"
     break;
 
-  case 337:
-#line 1225 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
+  case 343: // user_context: "user-context" $@64 ":" map_value
+#line 1248 "dhcp4_parser.yy"
+                  {
+    ctx.stack_.back()->set("user-context", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2175 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2272 "dhcp4_parser.cc"
     break;
 
-  case 338:
-#line 1233 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 344: // $@65: %empty
+#line 1256 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2186 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2283 "dhcp4_parser.cc"
     break;
 
-  case 339:
-#line 1238 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 345: // reservations: "reservations" $@65 ":" "[" reservations_list "]"
+#line 1261 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2195 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2292 "dhcp4_parser.cc"
     break;
 
-  case 344:
-#line 1251 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 350: // $@66: %empty
+#line 1274 "dhcp4_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2205 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2302 "dhcp4_parser.cc"
     break;
 
-  case 345:
-#line 1255 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 351: // reservation: "{" $@66 reservation_params "}"
+#line 1278 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2213 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2310 "dhcp4_parser.cc"
     break;
 
-  case 346:
-#line 1259 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 352: // $@67: %empty
+#line 1282 "dhcp4_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2223 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2320 "dhcp4_parser.cc"
     break;
 
-  case 347:
-#line 1263 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 353: // sub_reservation: "{" $@67 reservation_params "}"
+#line 1286 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2231 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2328 "dhcp4_parser.cc"
     break;
 
-  case 365:
-#line 1291 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 371: // $@68: %empty
+#line 1314 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2239 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2336 "dhcp4_parser.cc"
     break;
 
-  case 366:
-#line 1293 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 372: // next_server: "next-server" $@68 ":" "constant string"
+#line 1316 "dhcp4_parser.yy"
+               {
+    ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2249 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2346 "dhcp4_parser.cc"
     break;
 
-  case 367:
-#line 1299 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 373: // $@69: %empty
+#line 1322 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2257 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2354 "dhcp4_parser.cc"
     break;
 
-  case 368:
-#line 1301 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 374: // server_hostname: "server-hostname" $@69 ":" "constant string"
+#line 1324 "dhcp4_parser.yy"
+               {
+    ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2267 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2364 "dhcp4_parser.cc"
     break;
 
-  case 369:
-#line 1307 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 375: // $@70: %empty
+#line 1330 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2275 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2372 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1309 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 376: // boot_file_name: "boot-file-name" $@70 ":" "constant string"
+#line 1332 "dhcp4_parser.yy"
+               {
+    ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2285 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2382 "dhcp4_parser.cc"
     break;
 
-  case 371:
-#line 1315 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 377: // $@71: %empty
+#line 1338 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2293 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2390 "dhcp4_parser.cc"
     break;
 
-  case 372:
-#line 1317 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 378: // ip_address: "ip-address" $@71 ":" "constant string"
+#line 1340 "dhcp4_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2303 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2400 "dhcp4_parser.cc"
     break;
 
-  case 373:
-#line 1323 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 379: // $@72: %empty
+#line 1346 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2311 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2408 "dhcp4_parser.cc"
     break;
 
-  case 374:
-#line 1325 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 380: // duid: "duid" $@72 ":" "constant string"
+#line 1348 "dhcp4_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2321 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2418 "dhcp4_parser.cc"
     break;
 
-  case 375:
-#line 1331 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 381: // $@73: %empty
+#line 1354 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2329 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2426 "dhcp4_parser.cc"
     break;
 
-  case 376:
-#line 1333 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 382: // hw_address: "hw-address" $@73 ":" "constant string"
+#line 1356 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2339 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2436 "dhcp4_parser.cc"
     break;
 
-  case 377:
-#line 1339 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 383: // $@74: %empty
+#line 1362 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2347 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2444 "dhcp4_parser.cc"
     break;
 
-  case 378:
-#line 1341 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 384: // client_id_value: "client-id" $@74 ":" "constant string"
+#line 1364 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2357 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2454 "dhcp4_parser.cc"
     break;
 
-  case 379:
-#line 1347 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 385: // $@75: %empty
+#line 1370 "dhcp4_parser.yy"
+                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2365 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2462 "dhcp4_parser.cc"
     break;
 
-  case 380:
-#line 1349 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 386: // circuit_id_value: "circuit-id" $@75 ":" "constant string"
+#line 1372 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2375 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2472 "dhcp4_parser.cc"
     break;
 
-  case 381:
-#line 1355 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 387: // $@76: %empty
+#line 1378 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2383 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2480 "dhcp4_parser.cc"
     break;
 
-  case 382:
-#line 1357 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 388: // flex_id_value: "flex-id" $@76 ":" "constant string"
+#line 1380 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2393 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2490 "dhcp4_parser.cc"
     break;
 
-  case 383:
-#line 1363 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 389: // $@77: %empty
+#line 1386 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2401 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2498 "dhcp4_parser.cc"
     break;
 
-  case 384:
-#line 1365 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 390: // hostname: "hostname" $@77 ":" "constant string"
+#line 1388 "dhcp4_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2411 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2508 "dhcp4_parser.cc"
     break;
 
-  case 385:
-#line 1371 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 391: // $@78: %empty
+#line 1394 "dhcp4_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2422 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2519 "dhcp4_parser.cc"
     break;
 
-  case 386:
-#line 1376 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 392: // reservation_client_classes: "client-classes" $@78 ":" list_strings
+#line 1399 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2431 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2528 "dhcp4_parser.cc"
     break;
 
-  case 387:
-#line 1384 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 393: // $@79: %empty
+#line 1407 "dhcp4_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2442 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2539 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1389 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 394: // relay: "relay" $@79 ":" "{" relay_map "}"
+#line 1412 "dhcp4_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2451 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2548 "dhcp4_parser.cc"
     break;
 
-  case 389:
-#line 1394 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 395: // $@80: %empty
+#line 1417 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2459 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2556 "dhcp4_parser.cc"
     break;
 
-  case 390:
-#line 1396 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 396: // relay_map: "ip-address" $@80 ":" "constant string"
+#line 1419 "dhcp4_parser.yy"
+               {
+    ElementPtr ip(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2469 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2566 "dhcp4_parser.cc"
     break;
 
-  case 391:
-#line 1405 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 397: // $@81: %empty
+#line 1428 "dhcp4_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2480 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2577 "dhcp4_parser.cc"
     break;
 
-  case 392:
-#line 1410 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 398: // client_classes: "client-classes" $@81 ":" "[" client_classes_list "]"
+#line 1433 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2489 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2586 "dhcp4_parser.cc"
     break;
 
-  case 395:
-#line 1419 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 401: // $@82: %empty
+#line 1442 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2499 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2596 "dhcp4_parser.cc"
     break;
 
-  case 396:
-#line 1423 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 402: // client_class: "{" $@82 client_class_params "}"
+#line 1446 "dhcp4_parser.yy"
+                                     {
     ctx.stack_.pop_back();
 }
-#line 2507 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2604 "dhcp4_parser.cc"
     break;
 
-  case 409:
-#line 1446 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 415: // $@83: %empty
+#line 1469 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2515 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2612 "dhcp4_parser.cc"
     break;
 
-  case 410:
-#line 1448 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 416: // client_class_test: "test" $@83 ":" "constant string"
+#line 1471 "dhcp4_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2525 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2622 "dhcp4_parser.cc"
     break;
 
-  case 411:
-#line 1458 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 417: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1481 "dhcp4_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2534 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2631 "dhcp4_parser.cc"
     break;
 
-  case 412:
-#line 1465 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 418: // $@84: %empty
+#line 1488 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2545 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2642 "dhcp4_parser.cc"
     break;
 
-  case 413:
-#line 1470 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 419: // control_socket: "control-socket" $@84 ":" "{" control_socket_params "}"
+#line 1493 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2554 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2651 "dhcp4_parser.cc"
     break;
 
-  case 418:
-#line 1483 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 424: // $@85: %empty
+#line 1506 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2562 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2659 "dhcp4_parser.cc"
     break;
 
-  case 419:
-#line 1485 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 425: // control_socket_type: "socket-type" $@85 ":" "constant string"
+#line 1508 "dhcp4_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2572 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2669 "dhcp4_parser.cc"
     break;
 
-  case 420:
-#line 1491 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 426: // $@86: %empty
+#line 1514 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2580 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2677 "dhcp4_parser.cc"
     break;
 
-  case 421:
-#line 1493 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 427: // control_socket_name: "socket-name" $@86 ":" "constant string"
+#line 1516 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2590 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2687 "dhcp4_parser.cc"
     break;
 
-  case 422:
-#line 1501 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 428: // $@87: %empty
+#line 1524 "dhcp4_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2601 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2698 "dhcp4_parser.cc"
     break;
 
-  case 423:
-#line 1506 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 429: // dhcp_ddns: "dhcp-ddns" $@87 ":" "{" dhcp_ddns_params "}"
+#line 1529 "dhcp4_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2610 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2707 "dhcp4_parser.cc"
     break;
 
-  case 424:
-#line 1511 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 430: // $@88: %empty
+#line 1534 "dhcp4_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2620 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2717 "dhcp4_parser.cc"
     break;
 
-  case 425:
-#line 1515 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 431: // sub_dhcp_ddns: "{" $@88 dhcp_ddns_params "}"
+#line 1538 "dhcp4_parser.yy"
+                                  {
     // parsing completed
 }
-#line 2628 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2725 "dhcp4_parser.cc"
     break;
 
-  case 443:
-#line 1540 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 449: // enable_updates: "enable-updates" ":" "boolean"
+#line 1563 "dhcp4_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2637 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2734 "dhcp4_parser.cc"
     break;
 
-  case 444:
-#line 1545 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 450: // $@89: %empty
+#line 1568 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2645 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2742 "dhcp4_parser.cc"
     break;
 
-  case 445:
-#line 1547 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 451: // qualifying_suffix: "qualifying-suffix" $@89 ":" "constant string"
+#line 1570 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2655 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2752 "dhcp4_parser.cc"
     break;
 
-  case 446:
-#line 1553 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 452: // $@90: %empty
+#line 1576 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2663 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2760 "dhcp4_parser.cc"
     break;
 
-  case 447:
-#line 1555 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 453: // server_ip: "server-ip" $@90 ":" "constant string"
+#line 1578 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2673 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2770 "dhcp4_parser.cc"
     break;
 
-  case 448:
-#line 1561 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 454: // server_port: "server-port" ":" "integer"
+#line 1584 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2682 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2779 "dhcp4_parser.cc"
     break;
 
-  case 449:
-#line 1566 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 455: // $@91: %empty
+#line 1589 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2690 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2787 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1568 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 456: // sender_ip: "sender-ip" $@91 ":" "constant string"
+#line 1591 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2700 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2797 "dhcp4_parser.cc"
     break;
 
-  case 451:
-#line 1574 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 457: // sender_port: "sender-port" ":" "integer"
+#line 1597 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2709 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2806 "dhcp4_parser.cc"
     break;
 
-  case 452:
-#line 1579 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 458: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1602 "dhcp4_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2718 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2815 "dhcp4_parser.cc"
     break;
 
-  case 453:
-#line 1584 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 459: // $@92: %empty
+#line 1607 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2726 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2823 "dhcp4_parser.cc"
     break;
 
-  case 454:
-#line 1586 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 460: // ncr_protocol: "ncr-protocol" $@92 ":" ncr_protocol_value
+#line 1609 "dhcp4_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2735 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2832 "dhcp4_parser.cc"
     break;
 
-  case 455:
-#line 1592 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2741 "dhcp4_parser.cc" // lalr1.cc:859
+  case 461: // ncr_protocol_value: "udp"
+#line 1615 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 2838 "dhcp4_parser.cc"
     break;
 
-  case 456:
-#line 1593 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2747 "dhcp4_parser.cc" // lalr1.cc:859
+  case 462: // ncr_protocol_value: "tcp"
+#line 1616 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 2844 "dhcp4_parser.cc"
     break;
 
-  case 457:
-#line 1596 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 463: // $@93: %empty
+#line 1619 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2755 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2852 "dhcp4_parser.cc"
     break;
 
-  case 458:
-#line 1598 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
-    ctx.stack_.back()->set("ncr-format", json);
+  case 464: // ncr_format: "ncr-format" $@93 ":" ncr_format_value
+#line 1621 "dhcp4_parser.yy"
+                         {
+    ctx.stack_.back()->set("ncr-format", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2765 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2861 "dhcp4_parser.cc"
     break;
 
-  case 459:
-#line 1604 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 465: // ncr_format_value: "JSON"
+#line 1627 "dhcp4_parser.yy"
+         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("JSON", ctx.loc2pos(yystack_[0].location))); }
+#line 2867 "dhcp4_parser.cc"
+    break;
+
+  case 466: // ncr_format_value: "BINARY"
+#line 1628 "dhcp4_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("BINARY", ctx.loc2pos(yystack_[0].location))); }
+#line 2873 "dhcp4_parser.cc"
+    break;
+
+  case 467: // always_include_fqdn: "always-include-fqdn" ":" "boolean"
+#line 1631 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2774 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2882 "dhcp4_parser.cc"
     break;
 
-  case 460:
-#line 1609 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 468: // override_no_update: "override-no-update" ":" "boolean"
+#line 1636 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2783 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2891 "dhcp4_parser.cc"
     break;
 
-  case 461:
-#line 1614 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 469: // override_client_update: "override-client-update" ":" "boolean"
+#line 1641 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2792 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2900 "dhcp4_parser.cc"
     break;
 
-  case 462:
-#line 1619 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 470: // $@94: %empty
+#line 1646 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2800 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2908 "dhcp4_parser.cc"
     break;
 
-  case 463:
-#line 1621 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 471: // replace_client_name: "replace-client-name" $@94 ":" replace_client_name_value
+#line 1648 "dhcp4_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2809 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2917 "dhcp4_parser.cc"
     break;
 
-  case 464:
-#line 1627 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
+  case 472: // replace_client_name_value: "when-present"
+#line 1654 "dhcp4_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2817 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2925 "dhcp4_parser.cc"
     break;
 
-  case 465:
-#line 1630 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 473: // replace_client_name_value: "never"
+#line 1657 "dhcp4_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2825 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2933 "dhcp4_parser.cc"
     break;
 
-  case 466:
-#line 1633 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 474: // replace_client_name_value: "always"
+#line 1660 "dhcp4_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2833 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2941 "dhcp4_parser.cc"
     break;
 
-  case 467:
-#line 1636 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 475: // replace_client_name_value: "when-not-present"
+#line 1663 "dhcp4_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2841 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2949 "dhcp4_parser.cc"
     break;
 
-  case 468:
-#line 1639 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 476: // replace_client_name_value: "boolean"
+#line 1666 "dhcp4_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2850 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2958 "dhcp4_parser.cc"
     break;
 
-  case 469:
-#line 1645 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 477: // $@95: %empty
+#line 1672 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2858 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2966 "dhcp4_parser.cc"
     break;
 
-  case 470:
-#line 1647 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 478: // generated_prefix: "generated-prefix" $@95 ":" "constant string"
+#line 1674 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2868 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2976 "dhcp4_parser.cc"
     break;
 
-  case 471:
-#line 1655 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 479: // $@96: %empty
+#line 1682 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2876 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2984 "dhcp4_parser.cc"
     break;
 
-  case 472:
-#line 1657 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 480: // dhcp6_json_object: "Dhcp6" $@96 ":" value
+#line 1684 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2885 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2993 "dhcp4_parser.cc"
     break;
 
-  case 473:
-#line 1662 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 481: // $@97: %empty
+#line 1689 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2893 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3001 "dhcp4_parser.cc"
     break;
 
-  case 474:
-#line 1664 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 482: // dhcpddns_json_object: "DhcpDdns" $@97 ":" value
+#line 1691 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2902 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3010 "dhcp4_parser.cc"
     break;
 
-  case 475:
-#line 1669 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 483: // $@98: %empty
+#line 1696 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2910 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3018 "dhcp4_parser.cc"
     break;
 
-  case 476:
-#line 1671 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 484: // control_agent_json_object: "Control-agent" $@98 ":" value
+#line 1698 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2919 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3027 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1681 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 485: // $@99: %empty
+#line 1708 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2930 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3038 "dhcp4_parser.cc"
     break;
 
-  case 478:
-#line 1686 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 486: // logging_object: "Logging" $@99 ":" "{" logging_params "}"
+#line 1713 "dhcp4_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2939 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3047 "dhcp4_parser.cc"
     break;
 
-  case 482:
-#line 1703 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 490: // $@100: %empty
+#line 1730 "dhcp4_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2950 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3058 "dhcp4_parser.cc"
     break;
 
-  case 483:
-#line 1708 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 491: // loggers: "loggers" $@100 ":" "[" loggers_entries "]"
+#line 1735 "dhcp4_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2959 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3067 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1720 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 494: // $@101: %empty
+#line 1747 "dhcp4_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 2969 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3077 "dhcp4_parser.cc"
     break;
 
-  case 487:
-#line 1724 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 495: // logger_entry: "{" $@101 logger_params "}"
+#line 1751 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 2977 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3085 "dhcp4_parser.cc"
     break;
 
-  case 495:
-#line 1739 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 503: // debuglevel: "debuglevel" ":" "integer"
+#line 1766 "dhcp4_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 2986 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3094 "dhcp4_parser.cc"
     break;
 
-  case 496:
-#line 1744 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 504: // $@102: %empty
+#line 1771 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2994 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3102 "dhcp4_parser.cc"
     break;
 
-  case 497:
-#line 1746 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 505: // severity: "severity" $@102 ":" "constant string"
+#line 1773 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3004 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3112 "dhcp4_parser.cc"
     break;
 
-  case 498:
-#line 1752 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 506: // $@103: %empty
+#line 1779 "dhcp4_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3015 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3123 "dhcp4_parser.cc"
     break;
 
-  case 499:
-#line 1757 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 507: // output_options_list: "output_options" $@103 ":" "[" output_options_list_content "]"
+#line 1784 "dhcp4_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3024 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3132 "dhcp4_parser.cc"
     break;
 
-  case 502:
-#line 1766 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 510: // $@104: %empty
+#line 1793 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3034 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3142 "dhcp4_parser.cc"
     break;
 
-  case 503:
-#line 1770 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 511: // output_entry: "{" $@104 output_params_list "}"
+#line 1797 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3042 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3150 "dhcp4_parser.cc"
     break;
 
-  case 510:
-#line 1784 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 518: // $@105: %empty
+#line 1811 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3050 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3158 "dhcp4_parser.cc"
     break;
 
-  case 511:
-#line 1786 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 519: // output: "output" $@105 ":" "constant string"
+#line 1813 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3060 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3168 "dhcp4_parser.cc"
     break;
 
-  case 512:
-#line 1792 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 520: // flush: "flush" ":" "boolean"
+#line 1819 "dhcp4_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3069 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3177 "dhcp4_parser.cc"
     break;
 
-  case 513:
-#line 1797 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 521: // maxsize: "maxsize" ":" "integer"
+#line 1824 "dhcp4_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3078 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3186 "dhcp4_parser.cc"
     break;
 
-  case 514:
-#line 1802 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 522: // maxver: "maxver" ":" "integer"
+#line 1829 "dhcp4_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3087 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3195 "dhcp4_parser.cc"
     break;
 
 
-#line 3091 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3199 "dhcp4_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3115,7 +3227,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3126,7 +3240,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3143,69 +3257,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3213,6 +3339,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3221,12 +3348,12 @@ namespace isc { namespace dhcp {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -3237,26 +3364,112 @@ namespace isc { namespace dhcp {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Dhcp4Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp4Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp4Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
 
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp4Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp4Parser::context.
+  Dhcp4Parser::context::context (const Dhcp4Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp4Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp4Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3275,41 +3488,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp4Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3318,22 +3522,23 @@ namespace isc { namespace dhcp {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3342,574 +3547,587 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -486;
+  const short Dhcp4Parser::yypact_ninf_ = -490;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   Dhcp4Parser::yypact_[] =
   {
-     119,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,    33,    19,    35,    39,    54,    81,    83,   114,
-     127,   136,   149,   158,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,    19,   -43,    17,    30,
-     269,    18,   -16,    99,   131,    79,   -46,    91,  -486,   166,
-     181,   231,   255,   265,  -486,  -486,  -486,  -486,  -486,   267,
-    -486,    32,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   270,
-     271,  -486,  -486,  -486,   272,   279,   282,   284,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,   285,  -486,  -486,  -486,    42,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   286,    57,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,   288,   289,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,    86,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   109,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,   261,   291,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   292,  -486,  -486,  -486,   301,  -486,  -486,   299,   306,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   308,   309,  -486,  -486,  -486,  -486,   302,   311,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   165,
-    -486,  -486,  -486,   312,  -486,  -486,   314,  -486,   315,   316,
-    -486,  -486,   318,   319,   320,  -486,  -486,  -486,   209,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,    19,    19,  -486,   184,   322,
-     323,   324,   325,   327,  -486,    17,  -486,   328,   189,   190,
-     331,   332,   333,   196,   197,   198,   199,   338,   339,   340,
-     341,   342,   343,   344,   207,   346,   347,    30,  -486,   348,
-     349,   210,   269,  -486,    66,   351,   352,   356,   357,   358,
-     359,   360,   223,   224,   362,   363,   365,   366,    18,  -486,
-     367,   368,   -16,  -486,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,  -486,    99,   379,   380,   243,   382,
-     383,   384,   245,  -486,   131,   386,   247,   248,  -486,    79,
-     389,   390,   -17,  -486,   251,   392,   393,   256,   395,   260,
-     262,   396,   397,   263,   264,   266,   399,   401,    91,  -486,
-    -486,  -486,   402,   404,   405,    19,    19,    19,  -486,   406,
-    -486,  -486,   268,   407,   408,  -486,  -486,  -486,  -486,   411,
-     412,   413,   414,   415,   416,   417,  -486,   418,   419,  -486,
-     422,    60,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   420,   426,  -486,  -486,  -486,   281,   290,   293,   425,
-     294,   295,   296,  -486,  -486,   142,   297,   427,   433,  -486,
-     300,   435,  -486,   305,   310,   422,   317,   326,   329,   330,
-     334,   335,   336,  -486,   337,   345,  -486,   350,   353,   354,
-    -486,  -486,   355,  -486,  -486,  -486,   361,    19,  -486,  -486,
-     364,   381,  -486,   385,  -486,  -486,    14,   387,  -486,  -486,
-    -486,    25,   388,  -486,    19,    30,   304,  -486,  -486,  -486,
-     269,  -486,    73,    73,   436,   440,   443,   128,    23,   445,
-      61,    41,    91,  -486,  -486,  -486,  -486,  -486,   429,  -486,
-      66,  -486,  -486,  -486,   446,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   448,   398,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   215,  -486,   216,  -486,  -486,   218,  -486,  -486,  -486,
-    -486,   453,   455,   456,   457,   459,  -486,  -486,  -486,   219,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   222,  -486,   458,   462,  -486,  -486,   466,
-     465,  -486,  -486,   468,   476,  -486,  -486,  -486,  -486,  -486,
-    -486,    28,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   151,
-    -486,   475,   479,  -486,   480,   481,   483,   484,   485,   486,
-     225,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-     226,  -486,  -486,  -486,   228,   391,   394,  -486,  -486,   477,
-     489,  -486,  -486,   487,   494,  -486,  -486,   490,  -486,   495,
-     304,  -486,  -486,   497,   499,   500,   502,   400,   403,   409,
-     410,   421,   503,   504,    73,  -486,  -486,    18,  -486,   436,
-     131,  -486,   440,    79,  -486,   443,   128,  -486,    23,  -486,
-     -46,  -486,   445,   423,   424,   428,   430,   431,   432,    61,
-    -486,   505,   506,    41,  -486,  -486,  -486,   507,   508,  -486,
-     -16,  -486,   446,    99,  -486,   448,   510,  -486,   511,  -486,
-     275,   434,   437,   438,  -486,  -486,  -486,  -486,  -486,   439,
-     441,  -486,   235,  -486,   509,  -486,   512,  -486,  -486,  -486,
-     236,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   442,
-     444,  -486,  -486,   447,   238,  -486,   513,  -486,   449,   516,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   239,  -486,    44,   516,  -486,  -486,   514,  -486,  -486,
-    -486,   257,  -486,  -486,  -486,  -486,  -486,   515,   450,   520,
-      44,  -486,   522,  -486,   452,  -486,   518,  -486,  -486,   258,
-    -486,   -70,   518,  -486,  -486,   524,   526,   527,   259,  -486,
-    -486,  -486,  -486,  -486,  -486,   529,   451,   454,   460,   -70,
-    -486,   463,  -486,  -486,  -486,  -486,  -486
+      92,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,    33,    19,    37,    43,    54,   104,   112,   118,
+     139,   152,   163,   188,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,    19,  -107,    17,    30,
+     105,    18,   -17,    76,    80,    56,   -55,   148,  -490,    96,
+     158,   277,   198,   211,  -490,  -490,  -490,  -490,  -490,   282,
+    -490,    31,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   284,
+     285,  -490,  -490,  -490,   286,   290,   292,   301,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,   303,  -490,  -490,  -490,    57,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   305,    85,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,   306,   308,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,    86,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,    95,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,   234,   262,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,   309,  -490,  -490,  -490,   310,  -490,  -490,   311,   280,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,   312,   314,  -490,  -490,  -490,  -490,   315,   317,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   165,
+    -490,  -490,  -490,   318,  -490,  -490,   320,  -490,   321,   322,
+    -490,  -490,   323,   324,   325,  -490,  -490,  -490,   166,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,    19,    19,  -490,   186,   328,
+     329,   330,   331,   332,  -490,    17,  -490,   333,   190,   191,
+     336,   337,   338,   197,   199,   203,   205,   340,   342,   343,
+     344,   346,   348,   349,   208,   351,   352,    30,  -490,   356,
+     357,   214,   105,  -490,    66,   359,   360,   361,   362,   363,
+     364,   365,   224,   223,   368,   369,   370,   371,    18,  -490,
+     372,   373,   -17,  -490,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,  -490,    76,   384,   385,   244,   387,
+     388,   389,   246,  -490,    80,   391,   248,   249,  -490,    56,
+     394,   395,   -10,  -490,   252,   397,   398,   257,   400,   259,
+     263,   402,   403,   265,   266,   267,   404,   406,   148,  -490,
+    -490,  -490,   407,   405,   409,    19,    19,    19,  -490,   410,
+    -490,  -490,   273,   412,   413,  -490,  -490,  -490,  -490,   416,
+     417,   418,   419,   420,   421,   422,  -490,   423,   424,  -490,
+     427,    53,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,   425,   431,  -490,  -490,  -490,   283,   291,   293,   430,
+     295,   296,   297,  -490,  -490,   155,   298,   432,   439,  -490,
+     302,   443,  -490,   307,   313,   427,   316,   319,   326,   327,
+     334,   335,   339,  -490,   341,   345,  -490,   347,   350,   353,
+    -490,  -490,   354,  -490,  -490,  -490,   355,    19,  -490,  -490,
+     358,   366,  -490,   367,  -490,  -490,    25,   159,  -490,  -490,
+    -490,    24,   386,  -490,    19,    30,   304,  -490,  -490,  -490,
+     105,  -490,   147,   147,   444,   446,   448,   122,    39,   450,
+      99,    35,   148,  -490,  -490,  -490,  -490,  -490,   455,  -490,
+      66,  -490,  -490,  -490,   453,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   456,   392,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   200,  -490,   201,  -490,  -490,   202,  -490,
+    -490,  -490,  -490,   461,   463,   464,   466,   471,  -490,  -490,
+    -490,   204,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,   210,  -490,   470,   474,  -490,
+    -490,   472,   478,  -490,  -490,   476,   480,  -490,  -490,  -490,
+    -490,  -490,  -490,    29,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,   154,  -490,   479,   484,  -490,   485,   487,   489,   490,
+     492,   493,   497,   498,   500,   212,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   235,  -490,
+    -490,  -490,   236,   390,   393,  -490,  -490,   482,   502,  -490,
+    -490,   501,   503,  -490,  -490,   505,  -490,   504,   304,  -490,
+    -490,   506,   510,   511,   512,   396,   399,   408,   401,   411,
+     513,   514,   147,  -490,  -490,    18,  -490,   444,    80,  -490,
+     446,    56,  -490,   448,   122,  -490,    39,  -490,   -55,  -490,
+     450,   414,   415,   426,   428,   429,   433,   434,   435,   437,
+      99,  -490,   515,   516,    35,  -490,  -490,  -490,   517,   518,
+    -490,   -17,  -490,   453,    76,  -490,   456,   520,  -490,   521,
+    -490,   275,   440,   441,   442,  -490,  -490,  -490,  -490,  -490,
+     445,   447,  -490,   237,  -490,   519,  -490,   522,  -490,  -490,
+    -490,   238,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   449,   451,  -490,  -490,   452,   260,  -490,
+     524,  -490,   454,   526,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,   268,  -490,    -4,   526,  -490,
+    -490,   525,  -490,  -490,  -490,   261,  -490,  -490,  -490,  -490,
+    -490,   530,   438,   532,    -4,  -490,   523,  -490,   457,  -490,
+     533,  -490,  -490,   279,  -490,   -74,   533,  -490,  -490,   535,
+     537,   539,   264,  -490,  -490,  -490,  -490,  -490,  -490,   540,
+     458,   459,   462,   -74,  -490,   465,  -490,  -490,  -490,  -490,
+    -490
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     1,    39,    32,    28,    27,    24,
       25,    26,    31,     3,    29,    30,    52,     5,    64,     7,
-     102,     9,   210,    11,   326,    13,   346,    15,   263,    17,
-     298,    19,   175,    21,   424,    23,    41,    35,     0,     0,
-       0,     0,     0,   348,   265,   300,     0,     0,    43,     0,
-      42,     0,     0,    36,    62,   477,   471,   473,   475,     0,
+     102,     9,   216,    11,   332,    13,   352,    15,   269,    17,
+     304,    19,   175,    21,   430,    23,    41,    35,     0,     0,
+       0,     0,     0,   354,   271,   306,     0,     0,    43,     0,
+      42,     0,     0,    36,    62,   485,   479,   481,   483,     0,
       61,     0,    54,    56,    58,    59,    60,    57,    95,     0,
-       0,   365,   111,   113,     0,     0,     0,     0,   202,   255,
-     290,   153,   391,   167,   186,     0,   412,   422,    88,     0,
+       0,   371,   111,   113,     0,     0,     0,     0,   208,   261,
+     296,   153,   397,   167,   186,     0,   418,   428,    88,     0,
       66,    68,    69,    70,    71,    85,    86,    73,    74,    75,
       76,    80,    81,    72,    78,    79,    87,    77,    82,    83,
-      84,   104,   106,     0,     0,    97,    99,   100,   101,   395,
-     236,   238,   240,   318,   234,   242,   244,     0,     0,   248,
-     246,   338,   387,   233,   214,   215,   216,   228,     0,   212,
-     219,   230,   231,   232,   220,   221,   224,   226,   222,   223,
-     217,   218,   225,   229,   227,   334,   336,   333,   331,     0,
-     328,   330,   332,   367,   369,   385,   373,   375,   379,   377,
-     383,   381,   371,   364,   360,     0,   349,   350,   361,   362,
-     363,   357,   352,   358,   354,   355,   356,   359,   353,   280,
-     143,     0,   284,   282,   287,     0,   276,   277,     0,   266,
-     267,   269,   279,   270,   271,   272,   286,   273,   274,   275,
-     312,     0,     0,   310,   311,   314,   315,     0,   301,   302,
-     304,   305,   306,   307,   308,   309,   182,   184,   179,     0,
-     177,   180,   181,     0,   444,   446,     0,   449,     0,     0,
-     453,   457,     0,     0,     0,   462,   469,   442,     0,   426,
-     428,   429,   430,   431,   432,   433,   434,   435,   436,   437,
-     438,   439,   440,   441,    40,     0,     0,    33,     0,     0,
+      84,   104,   106,     0,     0,    97,    99,   100,   101,   401,
+     242,   244,   246,   324,   240,   248,   250,     0,     0,   254,
+     252,   344,   393,   239,   220,   221,   222,   234,     0,   218,
+     225,   236,   237,   238,   226,   227,   230,   232,   228,   229,
+     223,   224,   231,   235,   233,   340,   342,   339,   337,     0,
+     334,   336,   338,   373,   375,   391,   379,   381,   385,   383,
+     389,   387,   377,   370,   366,     0,   355,   356,   367,   368,
+     369,   363,   358,   364,   360,   361,   362,   365,   359,   286,
+     143,     0,   290,   288,   293,     0,   282,   283,     0,   272,
+     273,   275,   285,   276,   277,   278,   292,   279,   280,   281,
+     318,     0,     0,   316,   317,   320,   321,     0,   307,   308,
+     310,   311,   312,   313,   314,   315,   182,   184,   179,     0,
+     177,   180,   181,     0,   450,   452,     0,   455,     0,     0,
+     459,   463,     0,     0,     0,   470,   477,   448,     0,   432,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,    40,     0,     0,    33,     0,     0,
        0,     0,     0,     0,    51,     0,    53,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    65,     0,
-       0,     0,     0,   103,   397,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   211,
-       0,     0,     0,   327,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   347,     0,     0,     0,     0,     0,
-       0,     0,     0,   264,     0,     0,     0,     0,   299,     0,
+       0,     0,     0,   103,   403,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   217,
+       0,     0,     0,   333,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   353,     0,     0,     0,     0,     0,
+       0,     0,     0,   270,     0,     0,     0,     0,   305,     0,
        0,     0,     0,   176,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   425,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   431,
       44,    37,     0,     0,     0,     0,     0,     0,    55,     0,
       93,    94,     0,     0,     0,    89,    90,    91,    92,     0,
-       0,     0,     0,     0,     0,     0,   411,     0,     0,    67,
-       0,     0,   110,    98,   409,   407,   408,   403,   404,   405,
-     406,     0,   398,   399,   401,   402,     0,     0,     0,     0,
-       0,     0,     0,   253,   254,     0,     0,     0,     0,   213,
-       0,     0,   329,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   351,     0,     0,   278,     0,     0,     0,
-     289,   268,     0,   316,   317,   303,     0,     0,   178,   443,
-       0,     0,   448,     0,   451,   452,     0,     0,   459,   460,
-     461,     0,     0,   427,     0,     0,     0,   472,   474,   476,
-       0,   366,     0,     0,   204,   257,   292,     0,     0,   169,
-       0,     0,     0,    45,   105,   108,   109,   107,     0,   396,
-       0,   237,   239,   241,   320,   235,   243,   245,   250,   251,
-     252,   249,   247,   340,     0,   335,    34,   337,   368,   370,
-     386,   374,   376,   380,   378,   384,   382,   372,   281,   144,
-     285,   283,   288,   313,   183,   185,   445,   447,   450,   455,
-     456,   454,   458,   464,   465,   466,   467,   468,   463,   470,
-      38,     0,   482,     0,   479,   481,     0,   130,   136,   138,
-     140,     0,     0,     0,     0,     0,   149,   151,   129,     0,
-     115,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,     0,   208,     0,   205,   206,   261,     0,
-     258,   259,   296,     0,   293,   294,   162,   163,   164,   165,
-     166,     0,   155,   157,   158,   159,   160,   161,   393,     0,
-     173,     0,   170,   171,     0,     0,     0,     0,     0,     0,
-       0,   188,   190,   191,   192,   193,   194,   195,   418,   420,
-       0,   414,   416,   417,     0,    47,     0,   400,   324,     0,
-     321,   322,   344,     0,   341,   342,   389,     0,    63,     0,
-       0,   478,    96,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   112,   114,     0,   203,     0,
-     265,   256,     0,   300,   291,     0,     0,   154,     0,   392,
-       0,   168,     0,     0,     0,     0,     0,     0,     0,     0,
-     187,     0,     0,     0,   413,   423,    49,     0,    48,   410,
-       0,   319,     0,   348,   339,     0,     0,   388,     0,   480,
-       0,     0,     0,     0,   142,   145,   146,   147,   148,     0,
-       0,   116,     0,   207,     0,   260,     0,   295,   156,   394,
-       0,   172,   196,   197,   198,   199,   200,   201,   189,     0,
-       0,   415,    46,     0,     0,   323,     0,   343,     0,     0,
-     132,   133,   134,   135,   131,   137,   139,   141,   150,   152,
-     209,   262,   297,   174,   419,   421,    50,   325,   345,   390,
-     486,     0,   484,     0,     0,   483,   498,     0,   496,   494,
-     490,     0,   488,   492,   493,   491,   485,     0,     0,     0,
-       0,   487,     0,   495,     0,   489,     0,   497,   502,     0,
-     500,     0,     0,   499,   510,     0,     0,     0,     0,   504,
-     506,   507,   508,   509,   501,     0,     0,     0,     0,     0,
-     503,     0,   512,   513,   514,   505,   511
+       0,     0,     0,     0,     0,     0,   417,     0,     0,    67,
+       0,     0,   110,    98,   415,   413,   414,   409,   410,   411,
+     412,     0,   404,   405,   407,   408,     0,     0,     0,     0,
+       0,     0,     0,   259,   260,     0,     0,     0,     0,   219,
+       0,     0,   335,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   357,     0,     0,   284,     0,     0,     0,
+     295,   274,     0,   322,   323,   309,     0,     0,   178,   449,
+       0,     0,   454,     0,   457,   458,     0,     0,   467,   468,
+     469,     0,     0,   433,     0,     0,     0,   480,   482,   484,
+       0,   372,     0,     0,   210,   263,   298,     0,     0,   169,
+       0,     0,     0,    45,   105,   108,   109,   107,     0,   402,
+       0,   243,   245,   247,   326,   241,   249,   251,   256,   257,
+     258,   255,   253,   346,     0,   341,    34,   343,   374,   376,
+     392,   380,   382,   386,   384,   390,   388,   378,   287,   144,
+     291,   289,   294,   319,   183,   185,   451,   453,   456,   461,
+     462,   460,   465,   466,   464,   472,   473,   474,   475,   476,
+     471,   478,    38,     0,   490,     0,   487,   489,     0,   130,
+     136,   138,   140,     0,     0,     0,     0,     0,   149,   151,
+     129,     0,   115,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,     0,   214,     0,   211,   212,
+     267,     0,   264,   265,   302,     0,   299,   300,   162,   163,
+     164,   165,   166,     0,   155,   157,   158,   159,   160,   161,
+     399,     0,   173,     0,   170,   171,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   188,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   424,   426,     0,   420,
+     422,   423,     0,    47,     0,   406,   330,     0,   327,   328,
+     350,     0,   347,   348,   395,     0,    63,     0,     0,   486,
+      96,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   112,   114,     0,   209,     0,   271,   262,
+       0,   306,   297,     0,     0,   154,     0,   398,     0,   168,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   187,     0,     0,     0,   419,   429,    49,     0,    48,
+     416,     0,   325,     0,   354,   345,     0,     0,   394,     0,
+     488,     0,     0,     0,     0,   142,   145,   146,   147,   148,
+       0,     0,   116,     0,   213,     0,   266,     0,   301,   156,
+     400,     0,   172,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   189,     0,     0,   421,    46,     0,     0,   329,
+       0,   349,     0,     0,   132,   133,   134,   135,   131,   137,
+     139,   141,   150,   152,   215,   268,   303,   174,   425,   427,
+      50,   331,   351,   396,   494,     0,   492,     0,     0,   491,
+     506,     0,   504,   502,   498,     0,   496,   500,   501,   499,
+     493,     0,     0,     0,     0,   495,     0,   503,     0,   497,
+       0,   505,   510,     0,   508,     0,     0,   507,   518,     0,
+       0,     0,     0,   512,   514,   515,   516,   517,   509,     0,
+       0,     0,     0,     0,   511,     0,   520,   521,   522,   513,
+     519
   };
 
-  const short int
+  const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   -38,  -486,    64,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,    82,  -486,  -486,  -486,   -58,  -486,
-    -486,  -486,   217,  -486,  -486,  -486,  -486,    43,   227,   -60,
-     -59,   -40,  -486,  -486,   -39,  -486,  -486,    34,   214,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,    36,  -144,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   -54,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -155,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -159,  -486,  -486,  -486,
-    -154,   173,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -161,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -140,  -486,  -486,  -486,  -137,   220,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -485,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -139,
-    -486,  -486,  -486,  -138,  -486,   191,  -486,   -52,  -486,  -486,
-    -486,  -486,  -486,   -48,  -486,  -486,  -486,  -486,  -486,   -47,
-    -486,  -486,  -486,  -136,  -486,  -486,  -486,  -133,  -486,   187,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -165,  -486,  -486,  -486,  -158,   229,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -164,  -486,  -486,  -486,  -156,
-    -486,   213,   -51,  -486,  -305,  -486,  -304,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,    49,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -149,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,    65,   188,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,   -89,  -486,  -486,  -486,  -210,
-    -486,  -486,  -224,  -486,  -486,  -486,  -486,  -486,  -486,  -235,
-    -486,  -486,  -250,  -486,  -486,  -486,  -486,  -486
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   -38,  -490,    58,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,    67,  -490,  -490,  -490,   -58,  -490,
+    -490,  -490,   230,  -490,  -490,  -490,  -490,    42,   228,   -60,
+     -59,   -40,  -490,  -490,   -39,  -490,  -490,    46,   226,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,    47,  -141,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,   -54,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -152,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -157,  -490,  -490,  -490,
+    -153,   184,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -162,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -138,  -490,  -490,  -490,  -133,   225,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -489,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -136,  -490,  -490,  -490,  -132,  -490,   206,  -490,
+     -52,  -490,  -490,  -490,  -490,  -490,   -48,  -490,  -490,  -490,
+    -490,  -490,   -47,  -490,  -490,  -490,  -135,  -490,  -490,  -490,
+    -134,  -490,   196,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -164,  -490,  -490,  -490,  -160,   231,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -159,  -490,
+    -490,  -490,  -158,  -490,   233,   -51,  -490,  -304,  -490,  -301,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,    60,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -146,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,    77,   207,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
+    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   -87,
+    -490,  -490,  -490,  -215,  -490,  -490,  -226,  -490,  -490,  -490,
+    -490,  -490,  -490,  -236,  -490,  -490,  -252,  -490,  -490,  -490,
+    -490,  -490
   };
 
-  const short int
+  const short
   Dhcp4Parser::yydefgoto_[] =
   {
-      -1,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+       0,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    32,    33,    34,    57,   537,    72,    73,
-      35,    56,    69,    70,   514,   655,   717,   718,   108,    37,
+      35,    56,    69,    70,   514,   663,   728,   729,   108,    37,
       58,    81,    82,    83,   289,    39,    59,   109,   110,   111,
      112,   113,   114,   115,   116,   117,   297,   134,   135,    41,
       60,   136,   319,   137,   320,   517,   138,   118,   301,   119,
-     302,   589,   590,   591,   673,   774,   592,   674,   593,   675,
-     594,   676,   595,   217,   357,   597,   598,   599,   600,   601,
-     682,   602,   683,   120,   310,   621,   622,   623,   624,   625,
-     626,   627,   121,   312,   631,   632,   633,   700,    53,    66,
-     249,   250,   251,   370,   252,   371,   122,   313,   640,   641,
-     642,   643,   644,   645,   646,   647,   123,   307,   605,   606,
-     607,   687,    43,    61,   158,   159,   160,   329,   161,   325,
-     162,   326,   163,   327,   164,   330,   165,   331,   166,   335,
-     167,   334,   531,   168,   169,   124,   308,   609,   610,   611,
-     690,    49,    64,   218,   219,   220,   221,   222,   223,   224,
-     356,   225,   360,   226,   359,   227,   228,   361,   229,   125,
-     309,   613,   614,   615,   693,    51,    65,   237,   238,   239,
-     240,   241,   365,   242,   243,   244,   245,   171,   328,   659,
-     660,   661,   720,    45,    62,   179,   180,   181,   340,   182,
-     341,   172,   336,   663,   664,   665,   723,    47,    63,   195,
-     196,   197,   126,   300,   199,   344,   200,   345,   201,   353,
-     202,   347,   203,   348,   204,   350,   205,   349,   206,   352,
-     207,   351,   208,   346,   174,   337,   667,   726,   127,   311,
-     629,   324,   431,   432,   433,   434,   435,   518,   128,   129,
-     315,   650,   651,   652,   711,   653,   712,   130,   316,    55,
-      67,   268,   269,   270,   271,   375,   272,   376,   273,   274,
-     378,   275,   276,   277,   381,   561,   278,   382,   279,   280,
-     281,   282,   386,   568,   283,   387,    84,   291,    85,   292,
-      86,   293,    87,   290,   573,   574,   575,   669,   791,   792,
-     793,   801,   802,   803,   804,   809,   805,   807,   819,   820,
-     821,   828,   829,   830,   835,   831,   832,   833
+     302,   591,   592,   593,   681,   788,   594,   682,   595,   683,
+     596,   684,   597,   217,   357,   599,   600,   601,   602,   603,
+     690,   604,   691,   120,   310,   623,   624,   625,   626,   627,
+     628,   629,   121,   312,   633,   634,   635,   708,    53,    66,
+     249,   250,   251,   370,   252,   371,   122,   313,   645,   646,
+     647,   648,   649,   650,   651,   652,   653,   654,   655,   123,
+     307,   607,   608,   609,   695,    43,    61,   158,   159,   160,
+     329,   161,   325,   162,   326,   163,   327,   164,   330,   165,
+     331,   166,   335,   167,   334,   531,   168,   169,   124,   308,
+     611,   612,   613,   698,    49,    64,   218,   219,   220,   221,
+     222,   223,   224,   356,   225,   360,   226,   359,   227,   228,
+     361,   229,   125,   309,   615,   616,   617,   701,    51,    65,
+     237,   238,   239,   240,   241,   365,   242,   243,   244,   245,
+     171,   328,   667,   668,   669,   731,    45,    62,   179,   180,
+     181,   340,   182,   341,   172,   336,   671,   672,   673,   734,
+      47,    63,   195,   196,   197,   126,   300,   199,   344,   200,
+     345,   201,   353,   202,   347,   203,   348,   204,   350,   205,
+     349,   206,   352,   207,   351,   208,   346,   174,   337,   675,
+     737,   127,   311,   631,   324,   431,   432,   433,   434,   435,
+     518,   128,   129,   315,   658,   659,   660,   722,   661,   723,
+     130,   316,    55,    67,   268,   269,   270,   271,   375,   272,
+     376,   273,   274,   378,   275,   276,   277,   381,   561,   278,
+     382,   564,   279,   280,   281,   282,   386,   570,   283,   387,
+      84,   291,    85,   292,    86,   293,    87,   290,   575,   576,
+     577,   677,   805,   806,   807,   815,   816,   817,   818,   823,
+     819,   821,   833,   834,   835,   842,   843,   844,   849,   845,
+     846,   847
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yytable_[] =
   {
       80,   154,   155,   153,   177,   193,   216,   233,   248,   267,
-     173,   234,   198,   235,   170,   178,   194,   236,    68,   429,
-     430,   156,   157,   628,    25,   139,    26,    74,    27,   559,
-     139,   696,   100,    24,   697,   295,    90,    91,   246,   247,
-     296,    88,    36,   175,   176,   317,    38,    89,    90,    91,
-     318,   824,    92,    93,   825,   826,   827,    94,    95,    96,
-     322,    40,   140,   141,   142,   323,   100,   246,   247,    94,
-      95,    96,    97,    98,   515,   516,   143,    99,   100,   144,
-     145,   146,   147,   148,   149,    91,   183,   184,    42,   338,
-      44,   150,   151,   210,   339,    79,   150,   577,    71,   152,
-     101,   102,   578,   579,   580,   581,   582,   583,   584,   585,
-     586,   587,   342,   103,   100,   210,   104,   343,    91,   183,
-     184,    46,   210,   105,   106,    79,   560,   107,   210,   230,
-     211,   212,   231,   232,    48,    75,   648,   649,   424,   563,
-     564,   565,   566,    50,    76,    77,    78,   100,   634,   635,
-     636,   637,   638,   639,   698,   209,    52,   699,    79,    79,
-      28,    29,    30,    31,   796,    54,   797,   798,   372,   567,
-     185,    79,   284,   373,   186,   187,   188,   189,   190,   191,
-     210,   192,   211,   212,   285,    79,   213,   214,   215,   253,
+     173,   234,   198,   235,   170,   178,   194,   236,    68,   630,
+     429,   156,   157,   430,    25,   139,    26,    74,    27,   246,
+     247,   100,   704,    24,   295,   705,    90,    91,    71,   296,
+     559,    88,   175,   176,    36,   210,   139,    89,    90,    91,
+      38,   838,    92,    93,   839,   840,   841,    94,    95,    96,
+     317,    40,   140,   141,   142,   318,   100,   515,   516,    94,
+      95,    96,    97,    98,   246,   247,   143,    99,   100,   144,
+     145,   146,   147,   148,   149,    91,   183,   184,   322,   338,
+      79,   150,   151,   323,   339,    91,   183,   184,   342,   152,
+     101,   102,   284,   343,   209,   210,   230,   211,   212,   231,
+     232,    42,   150,   103,   100,   210,   104,   131,   132,    44,
+     810,   133,   811,   812,   100,    46,   105,   106,    79,   210,
+     107,   211,   212,   656,   657,   213,   214,   215,   424,    75,
+     560,    79,   565,   566,   567,   568,    48,   185,    76,    77,
+      78,   186,   187,   188,   189,   190,   191,   706,   192,    50,
+     707,   285,    79,    79,    28,    29,    30,    31,   372,   388,
+      52,   579,   569,   373,   389,    79,   580,   581,   582,   583,
+     584,   585,   586,   587,   588,   589,   636,   637,   638,   639,
+     640,   641,   642,   643,   644,    54,   210,   618,   619,   620,
+     621,    79,   622,   317,   678,   322,   287,   692,   676,   679,
+     680,    79,   693,   692,   288,   720,   429,   760,   694,   430,
+     721,    79,   528,   529,   530,    79,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    80,   724,   388,
+     338,   372,   354,   725,   726,   794,   797,   390,   391,   253,
      254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
-     264,   265,   266,   616,   617,   618,   619,    79,   620,   528,
-     529,   530,   388,   749,    79,   429,   430,   389,   317,   670,
-      79,   322,   684,   668,   671,   684,   672,   685,   709,   713,
-     686,   388,    79,   710,   714,   286,   715,    80,   338,   372,
-      79,   342,   794,   780,   783,   795,   787,   390,   391,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-     810,   822,   839,   287,   823,   811,   425,   840,   288,   354,
-     426,   294,    79,   428,   298,   299,   303,   427,   154,   155,
-     153,   131,   132,   304,   177,   133,   305,   173,   306,   314,
-     321,   170,   332,   333,   355,   178,   358,   193,   156,   157,
-     770,   771,   772,   773,   198,   362,   216,   363,   194,   364,
-     368,   233,   366,   367,   369,   234,   374,   235,   377,   379,
-     380,   236,   383,   384,   385,   392,   393,   394,   395,   396,
-     267,   397,   399,   400,   401,   402,   403,   404,   405,   406,
-     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
-     417,   418,   420,   421,   422,   436,   437,   497,   498,   499,
-     438,   439,   440,   441,   442,   443,   445,   446,   444,   447,
-     448,   450,   451,   453,   454,   455,   456,   457,   458,   459,
-     460,   461,   462,   464,   465,   466,   467,   468,   469,   470,
-     472,   473,   474,   476,   477,   479,   480,   481,   482,   483,
-     486,   487,   484,   491,   485,   492,   494,   488,   489,   501,
-     490,   495,   496,   500,   502,   503,   504,   505,   506,   507,
-     508,   509,   521,   572,   510,   511,   512,   513,   519,   520,
-     524,   522,   533,   656,   523,   525,   526,   527,   532,   555,
-     534,   535,    26,   604,   588,   588,   538,   608,   596,   596,
-     612,   539,   630,   658,   267,   662,   570,   677,   541,   678,
-     679,   680,   425,   681,   688,   689,   426,   542,   692,   428,
-     543,   544,   691,   427,   694,   545,   546,   547,   548,   695,
-     666,   701,   702,   721,   703,   704,   549,   705,   706,   707,
-     708,   550,   722,   724,   551,   552,   553,   725,   727,   728,
-     562,   730,   554,   731,   732,   556,   733,   739,   740,   759,
-     760,   763,   398,   762,   768,   536,   769,   781,   808,   812,
-     782,   788,   557,   790,   814,   818,   558,   816,   836,   569,
-     837,   838,   716,   841,   576,   719,   423,   540,   571,   603,
-     741,   748,   734,   751,   419,   478,   750,   735,   758,   743,
-     742,   736,   744,   745,   737,   471,   475,   765,   449,   747,
-     746,   767,   764,   738,   761,   752,   753,   766,   463,   657,
-     754,   452,   755,   756,   757,   775,   493,   654,   776,   777,
-     778,   729,   779,   784,   806,   785,   815,   834,   786,   845,
-     789,     0,   813,   817,     0,   842,   843,     0,     0,     0,
-       0,     0,   844,     0,   846,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   588,   154,   155,   153,
-     596,     0,   216,     0,     0,   233,   173,     0,     0,   234,
-     170,   235,   248,     0,     0,   236,     0,   156,   157,     0,
+     264,   265,   266,   342,   824,   355,   425,   853,   801,   825,
+     426,   808,   854,   428,   809,   562,   563,   427,   154,   155,
+     153,   286,   836,   364,   177,   837,   294,   173,   298,   299,
+     303,   170,    79,    79,   304,   178,   305,   193,   156,   157,
+     784,   785,   786,   787,   198,   306,   216,   314,   194,   321,
+     332,   233,   333,   358,   362,   234,   366,   235,   367,   363,
+     369,   236,   374,   368,   377,   379,   380,   383,   384,   385,
+     267,   392,   393,   394,   395,   396,   397,   399,   400,   401,
+     402,   403,   404,   405,   409,   406,   410,   411,   412,   407,
+     413,   408,   414,   415,   416,   417,   418,   497,   498,   499,
+     420,   421,   422,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   450,   451,   453,   454,
+     455,   456,   457,   458,   459,   460,   461,   462,   464,   465,
+     466,   467,   468,   469,   470,   472,   473,   474,   476,   477,
+     479,   480,   481,   482,   483,   484,   486,   487,   491,   485,
+     492,   494,   495,   488,   489,   490,   496,   500,   501,   502,
+     503,   504,   505,   506,   507,   508,   509,   574,   521,   510,
+     511,   512,   513,   519,   520,   524,   522,   533,   523,   555,
+     525,   526,   527,   532,   590,   590,   534,   535,   598,   598,
+      26,   606,   538,   610,   267,   614,   572,   632,   539,   664,
+     666,   541,   425,   670,   542,   685,   426,   686,   687,   428,
+     688,   543,   544,   427,   674,   689,   696,   697,   699,   545,
+     546,   700,   702,   703,   547,   709,   548,   710,   732,   711,
+     549,   712,   550,   713,   714,   551,   715,   716,   552,   553,
+     554,   717,   718,   556,   719,   733,   736,   735,   739,   536,
+     741,   557,   558,   738,   742,   743,   744,   750,   751,   773,
+     774,   777,   540,   776,   782,   398,   783,   795,   830,   822,
+     796,   571,   802,   804,   826,   727,   828,   573,   730,   850,
+     832,   851,   745,   852,   855,   419,   578,   746,   423,   748,
+     605,   752,   759,   762,   747,   761,   478,   749,   772,   754,
+     763,   764,   753,   449,   756,   475,   755,   757,   758,   779,
+     471,   778,   765,   452,   766,   767,   780,   781,   775,   768,
+     665,   770,   769,   771,   827,   789,   790,   791,   463,   662,
+     792,   740,   793,   820,   798,   493,   799,   800,   829,   803,
+     848,   859,   831,     0,     0,   857,   856,     0,   858,     0,
+     860,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   177,     0,     0,   193,     0,     0,     0,     0,
-       0,     0,   198,   178,     0,     0,   194,     0,     0,     0,
+       0,     0,     0,     0,   590,   154,   155,   153,   598,     0,
+     216,     0,     0,   233,   173,     0,     0,   234,   170,   235,
+     248,     0,     0,   236,     0,   156,   157,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   177,     0,     0,   193,     0,     0,     0,
+       0,     0,     0,   198,   178,     0,     0,   194,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   799,     0,     0,     0,   800,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   799,     0,     0,     0,   800
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   813,
+       0,     0,     0,   814,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   813,     0,     0,     0,
+     814
   };
 
-  const short int
+  const short
   Dhcp4Parser::yycheck_[] =
   {
       58,    61,    61,    61,    62,    63,    64,    65,    66,    67,
-      61,    65,    63,    65,    61,    62,    63,    65,    56,   324,
-     324,    61,    61,   508,     5,     7,     7,    10,     9,    15,
-       7,     3,    48,     0,     6,     3,    18,    19,    84,    85,
-       8,    11,     7,    59,    60,     3,     7,    17,    18,    19,
-       8,   121,    22,    23,   124,   125,   126,    39,    40,    41,
-       3,     7,    44,    45,    46,     8,    48,    84,    85,    39,
-      40,    41,    42,    43,    14,    15,    58,    47,    48,    61,
-      62,    63,    64,    65,    66,    19,    20,    21,     7,     3,
-       7,    73,    74,    49,     8,   141,    73,    24,   141,    81,
-      70,    71,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,     3,    83,    48,    49,    86,     8,    19,    20,
-      21,     7,    49,    93,    94,   141,   112,    97,    49,    50,
-      51,    52,    53,    54,     7,   118,    95,    96,    72,   114,
-     115,   116,   117,     7,   127,   128,   129,    48,    87,    88,
-      89,    90,    91,    92,     3,    24,     7,     6,   141,   141,
-     141,   142,   143,   144,   120,     7,   122,   123,     3,   144,
-      71,   141,     6,     8,    75,    76,    77,    78,    79,    80,
-      49,    82,    51,    52,     3,   141,    55,    56,    57,    98,
-      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,    75,    76,    77,    78,   141,    80,    67,
-      68,    69,     3,   698,   141,   520,   520,     8,     3,     3,
-     141,     3,     3,     8,     8,     3,     8,     8,     3,     3,
-       8,     3,   141,     8,     8,     4,     8,   295,     3,     3,
-     141,     3,     3,     8,     8,     6,     8,   285,   286,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-       3,     3,     3,     8,     6,     8,   324,     8,     3,     8,
-     324,     4,   141,   324,     4,     4,     4,   324,   338,   338,
-     338,    12,    13,     4,   342,    16,     4,   338,     4,     4,
-       4,   338,     4,     4,     3,   342,     4,   355,   338,   338,
-      25,    26,    27,    28,   355,     4,   364,     8,   355,     3,
-       8,   369,     4,     4,     3,   369,     4,   369,     4,     4,
-       4,   369,     4,     4,     4,   141,     4,     4,     4,     4,
-     388,     4,     4,   144,   144,     4,     4,     4,   142,   142,
-     142,   142,     4,     4,     4,     4,     4,     4,     4,   142,
-       4,     4,     4,     4,   144,     4,     4,   395,   396,   397,
-       4,     4,     4,     4,     4,   142,     4,     4,   144,     4,
+      61,    65,    63,    65,    61,    62,    63,    65,    56,   508,
+     324,    61,    61,   324,     5,     7,     7,    10,     9,    84,
+      85,    48,     3,     0,     3,     6,    18,    19,   145,     8,
+      15,    11,    59,    60,     7,    49,     7,    17,    18,    19,
+       7,   125,    22,    23,   128,   129,   130,    39,    40,    41,
+       3,     7,    44,    45,    46,     8,    48,    14,    15,    39,
+      40,    41,    42,    43,    84,    85,    58,    47,    48,    61,
+      62,    63,    64,    65,    66,    19,    20,    21,     3,     3,
+     145,    73,    74,     8,     8,    19,    20,    21,     3,    81,
+      70,    71,     6,     8,    24,    49,    50,    51,    52,    53,
+      54,     7,    73,    83,    48,    49,    86,    12,    13,     7,
+     124,    16,   126,   127,    48,     7,    96,    97,   145,    49,
+     100,    51,    52,    98,    99,    55,    56,    57,    72,   122,
+     115,   145,   118,   119,   120,   121,     7,    71,   131,   132,
+     133,    75,    76,    77,    78,    79,    80,     3,    82,     7,
+       6,     3,   145,   145,   145,   146,   147,   148,     3,     3,
+       7,    24,   148,     8,     8,   145,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,     7,    49,    75,    76,    77,
+      78,   145,    80,     3,     3,     3,     8,     3,     8,     8,
+       8,   145,     8,     3,     3,     3,   520,   706,     8,   520,
+       8,   145,    67,    68,    69,   145,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   295,     3,     3,
+       3,     3,     8,     8,     8,     8,     8,   285,   286,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,     3,     3,     3,   324,     3,     8,     8,
+     324,     3,     8,   324,     6,   116,   117,   324,   338,   338,
+     338,     4,     3,     3,   342,     6,     4,   338,     4,     4,
+       4,   338,   145,   145,     4,   342,     4,   355,   338,   338,
+      25,    26,    27,    28,   355,     4,   364,     4,   355,     4,
+       4,   369,     4,     4,     4,   369,     4,   369,     4,     8,
+       3,   369,     4,     8,     4,     4,     4,     4,     4,     4,
+     388,   145,     4,     4,     4,     4,     4,     4,   148,   148,
+       4,     4,     4,   146,     4,   146,     4,     4,     4,   146,
+       4,   146,     4,     4,   146,     4,     4,   395,   396,   397,
+       4,     4,   148,     4,     4,     4,     4,     4,     4,     4,
+     146,   148,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   142,     4,     4,     4,   144,
-       4,   144,   144,     4,     4,   144,     4,     4,   142,     4,
-       4,     4,   142,     4,   142,     4,     4,   144,   144,   141,
-     144,     7,     7,     7,     7,     7,     5,     5,     5,     5,
-       5,     5,   141,   119,     7,     7,     7,     5,     8,     3,
-       5,   141,     5,     4,   141,   141,   141,   141,   141,   477,
-       7,   141,     7,     7,   502,   503,   141,     7,   502,   503,
-       7,   141,     7,     7,   512,     7,   494,     4,   141,     4,
-       4,     4,   520,     4,     6,     3,   520,   141,     3,   520,
-     141,   141,     6,   520,     6,   141,   141,   141,   141,     3,
-      82,     6,     3,     6,     4,     4,   141,     4,     4,     4,
-       4,   141,     3,     6,   141,   141,   141,     3,     8,     4,
-     113,     4,   141,     4,     4,   141,     4,     4,     4,     4,
-       4,     3,   295,     6,     4,   451,     5,     8,     4,     4,
-       8,     8,   141,     7,     4,     7,   141,     5,     4,   141,
-       4,     4,   141,     4,   500,   141,   322,   455,   495,   503,
-     684,   696,   142,   702,   317,   372,   700,   144,   709,   689,
-     687,   142,   690,   692,   144,   364,   369,   722,   338,   695,
-     693,   725,   720,   142,   713,   142,   142,   723,   355,   520,
-     142,   342,   142,   142,   142,   141,   388,   512,   141,   141,
-     141,   670,   141,   141,   794,   141,   810,   822,   141,   839,
-     141,    -1,   142,   141,    -1,   144,   142,    -1,    -1,    -1,
-      -1,    -1,   142,    -1,   141,    -1,    -1,    -1,    -1,    -1,
+     146,     4,     4,     4,   148,     4,   148,   148,     4,     4,
+     148,     4,     4,   146,     4,   146,     4,     4,     4,   146,
+       4,     4,     7,   148,   148,   148,     7,     7,   145,     7,
+       7,     5,     5,     5,     5,     5,     5,   123,   145,     7,
+       7,     7,     5,     8,     3,     5,   145,     5,   145,   477,
+     145,   145,   145,   145,   502,   503,     7,   145,   502,   503,
+       7,     7,   145,     7,   512,     7,   494,     7,   145,     4,
+       7,   145,   520,     7,   145,     4,   520,     4,     4,   520,
+       4,   145,   145,   520,    82,     4,     6,     3,     6,   145,
+     145,     3,     6,     3,   145,     6,   145,     3,     6,     4,
+     145,     4,   145,     4,     4,   145,     4,     4,   145,   145,
+     145,     4,     4,   145,     4,     3,     3,     6,     4,   451,
+       4,   145,   145,     8,     4,     4,     4,     4,     4,     4,
+       4,     3,   455,     6,     4,   295,     5,     8,     5,     4,
+       8,   145,     8,     7,     4,   145,     4,   495,   145,     4,
+       7,     4,   146,     4,     4,   317,   500,   148,   322,   148,
+     503,   692,   704,   710,   146,   708,   372,   146,   720,   697,
+     146,   146,   695,   338,   700,   369,   698,   701,   703,   733,
+     364,   731,   146,   342,   146,   146,   734,   736,   724,   146,
+     520,   146,   148,   146,   146,   145,   145,   145,   355,   512,
+     145,   678,   145,   808,   145,   388,   145,   145,   824,   145,
+     836,   853,   145,    -1,    -1,   146,   148,    -1,   146,    -1,
+     145,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   684,   687,   687,   687,
-     684,    -1,   690,    -1,    -1,   693,   687,    -1,    -1,   693,
-     687,   693,   700,    -1,    -1,   693,    -1,   687,   687,    -1,
+      -1,    -1,    -1,    -1,   692,   695,   695,   695,   692,    -1,
+     698,    -1,    -1,   701,   695,    -1,    -1,   701,   695,   701,
+     708,    -1,    -1,   701,    -1,   695,   695,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   720,    -1,    -1,   723,    -1,    -1,    -1,    -1,
-      -1,    -1,   723,   720,    -1,    -1,   723,    -1,    -1,    -1,
+      -1,    -1,    -1,   731,    -1,    -1,   734,    -1,    -1,    -1,
+      -1,    -1,    -1,   734,   731,    -1,    -1,   734,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   793,    -1,    -1,    -1,   793,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   810,    -1,    -1,    -1,   810
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   807,
+      -1,    -1,    -1,   807,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   824,    -1,    -1,    -1,
+     824
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   130,   131,   132,   133,   134,   135,   136,   137,   138,
-     139,   140,   146,   147,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,     0,     5,     7,     9,   141,   142,
-     143,   144,   158,   159,   160,   165,     7,   174,     7,   180,
-       7,   194,     7,   267,     7,   338,     7,   352,     7,   296,
-       7,   320,     7,   243,     7,   404,   166,   161,   175,   181,
-     195,   268,   339,   353,   297,   321,   244,   405,   158,   167,
-     168,   141,   163,   164,    10,   118,   127,   128,   129,   141,
-     173,   176,   177,   178,   431,   433,   435,   437,    11,    17,
+       0,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,     0,     5,     7,     9,   145,   146,
+     147,   148,   162,   163,   164,   169,     7,   178,     7,   184,
+       7,   198,     7,   274,     7,   345,     7,   359,     7,   303,
+       7,   327,     7,   247,     7,   411,   170,   165,   179,   185,
+     199,   275,   346,   360,   304,   328,   248,   412,   162,   171,
+     172,   145,   167,   168,    10,   122,   131,   132,   133,   145,
+     177,   180,   181,   182,   439,   441,   443,   445,    11,    17,
       18,    19,    22,    23,    39,    40,    41,    42,    43,    47,
-      48,    70,    71,    83,    86,    93,    94,    97,   173,   182,
-     183,   184,   185,   186,   187,   188,   189,   190,   202,   204,
-     228,   237,   251,   261,   290,   314,   357,   383,   393,   394,
-     402,    12,    13,    16,   192,   193,   196,   198,   201,     7,
+      48,    70,    71,    83,    86,    96,    97,   100,   177,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   206,   208,
+     232,   241,   255,   268,   297,   321,   364,   390,   400,   401,
+     409,    12,    13,    16,   196,   197,   200,   202,   205,     7,
       44,    45,    46,    58,    61,    62,    63,    64,    65,    66,
-      73,    74,    81,   173,   184,   185,   186,   189,   269,   270,
-     271,   273,   275,   277,   279,   281,   283,   285,   288,   289,
-     314,   332,   346,   357,   379,    59,    60,   173,   314,   340,
-     341,   342,   344,    20,    21,    71,    75,    76,    77,    78,
-      79,    80,    82,   173,   314,   354,   355,   356,   357,   359,
-     361,   363,   365,   367,   369,   371,   373,   375,   377,    24,
-      49,    51,    52,    55,    56,    57,   173,   218,   298,   299,
-     300,   301,   302,   303,   304,   306,   308,   310,   311,   313,
-      50,    53,    54,   173,   218,   302,   308,   322,   323,   324,
-     325,   326,   328,   329,   330,   331,    84,    85,   173,   245,
-     246,   247,   249,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   173,   406,   407,
-     408,   409,   411,   413,   414,   416,   417,   418,   421,   423,
-     424,   425,   426,   429,     6,     3,     4,     8,     3,   179,
-     438,   432,   434,   436,     4,     3,     8,   191,     4,     4,
-     358,   203,   205,     4,     4,     4,     4,   262,   291,   315,
-     229,   384,   238,   252,     4,   395,   403,     3,     8,   197,
-     199,     4,     3,     8,   386,   274,   276,   278,   333,   272,
-     280,   282,     4,     4,   286,   284,   347,   380,     3,     8,
-     343,   345,     3,     8,   360,   362,   378,   366,   368,   372,
-     370,   376,   374,   364,     8,     3,   305,   219,     4,   309,
-     307,   312,     4,     8,     3,   327,     4,     4,     8,     3,
-     248,   250,     3,     8,     4,   410,   412,     4,   415,     4,
-       4,   419,   422,     4,     4,     4,   427,   430,     3,     8,
-     158,   158,   141,     4,     4,     4,     4,     4,   177,     4,
-     144,   144,     4,     4,     4,   142,   142,   142,   142,     4,
-       4,     4,     4,     4,     4,     4,   142,     4,     4,   183,
-       4,     4,   144,   193,    72,   173,   218,   314,   357,   359,
-     361,   387,   388,   389,   390,   391,     4,     4,     4,     4,
-       4,     4,     4,   142,   144,     4,     4,     4,     4,   270,
-       4,     4,   341,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,   356,     4,     4,   142,     4,     4,     4,
-     144,   300,     4,   144,   144,   324,     4,     4,   246,   144,
-       4,     4,   142,     4,   142,   142,     4,     4,   144,   144,
-     144,     4,     4,   407,     4,     7,     7,   158,   158,   158,
-       7,   141,     7,     7,     5,     5,     5,     5,     5,     5,
-       7,     7,     7,     5,   169,    14,    15,   200,   392,     8,
-       3,   141,   141,   141,     5,   141,   141,   141,    67,    68,
-      69,   287,   141,     5,     7,   141,   160,   162,   141,   141,
-     169,   141,   141,   141,   141,   141,   141,   141,   141,   141,
-     141,   141,   141,   141,   141,   158,   141,   141,   141,    15,
-     112,   420,   113,   114,   115,   116,   117,   144,   428,   141,
-     158,   182,   119,   439,   440,   441,   192,    24,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,   173,   206,
-     207,   208,   211,   213,   215,   217,   218,   220,   221,   222,
-     223,   224,   226,   206,     7,   263,   264,   265,     7,   292,
-     293,   294,     7,   316,   317,   318,    75,    76,    77,    78,
-      80,   230,   231,   232,   233,   234,   235,   236,   283,   385,
-       7,   239,   240,   241,    87,    88,    89,    90,    91,    92,
-     253,   254,   255,   256,   257,   258,   259,   260,    95,    96,
-     396,   397,   398,   400,   406,   170,     4,   389,     7,   334,
-     335,   336,     7,   348,   349,   350,    82,   381,     8,   442,
-       3,     8,     8,   209,   212,   214,   216,     4,     4,     4,
-       4,     4,   225,   227,     3,     8,     8,   266,     6,     3,
-     295,     6,     3,   319,     6,     3,     3,     6,     3,     6,
-     242,     6,     3,     4,     4,     4,     4,     4,     4,     3,
-       8,   399,   401,     3,     8,     8,   141,   171,   172,   141,
-     337,     6,     3,   351,     6,     3,   382,     8,     4,   440,
-       4,     4,     4,     4,   142,   144,   142,   144,   142,     4,
-       4,   207,   269,   265,   298,   294,   322,   318,   231,   283,
-     245,   241,   142,   142,   142,   142,   142,   142,   254,     4,
-       4,   397,     6,     3,   340,   336,   354,   350,     4,     5,
-      25,    26,    27,    28,   210,   141,   141,   141,   141,   141,
-       8,     8,     8,     8,   141,   141,   141,     8,     8,   141,
-       7,   443,   444,   445,     3,     6,   120,   122,   123,   173,
-     218,   446,   447,   448,   449,   451,   444,   452,     4,   450,
-       3,     8,     4,   142,     4,   447,     5,   141,     7,   453,
-     454,   455,     3,     6,   121,   124,   125,   126,   456,   457,
-     458,   460,   461,   462,   454,   459,     4,     4,     4,     3,
-       8,     4,   144,   142,   142,   457,   141
+      73,    74,    81,   177,   188,   189,   190,   193,   276,   277,
+     278,   280,   282,   284,   286,   288,   290,   292,   295,   296,
+     321,   339,   353,   364,   386,    59,    60,   177,   321,   347,
+     348,   349,   351,    20,    21,    71,    75,    76,    77,    78,
+      79,    80,    82,   177,   321,   361,   362,   363,   364,   366,
+     368,   370,   372,   374,   376,   378,   380,   382,   384,    24,
+      49,    51,    52,    55,    56,    57,   177,   222,   305,   306,
+     307,   308,   309,   310,   311,   313,   315,   317,   318,   320,
+      50,    53,    54,   177,   222,   309,   315,   329,   330,   331,
+     332,   333,   335,   336,   337,   338,    84,    85,   177,   249,
+     250,   251,   253,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   177,   413,   414,
+     415,   416,   418,   420,   421,   423,   424,   425,   428,   431,
+     432,   433,   434,   437,     6,     3,     4,     8,     3,   183,
+     446,   440,   442,   444,     4,     3,     8,   195,     4,     4,
+     365,   207,   209,     4,     4,     4,     4,   269,   298,   322,
+     233,   391,   242,   256,     4,   402,   410,     3,     8,   201,
+     203,     4,     3,     8,   393,   281,   283,   285,   340,   279,
+     287,   289,     4,     4,   293,   291,   354,   387,     3,     8,
+     350,   352,     3,     8,   367,   369,   385,   373,   375,   379,
+     377,   383,   381,   371,     8,     3,   312,   223,     4,   316,
+     314,   319,     4,     8,     3,   334,     4,     4,     8,     3,
+     252,   254,     3,     8,     4,   417,   419,     4,   422,     4,
+       4,   426,   429,     4,     4,     4,   435,   438,     3,     8,
+     162,   162,   145,     4,     4,     4,     4,     4,   181,     4,
+     148,   148,     4,     4,     4,   146,   146,   146,   146,     4,
+       4,     4,     4,     4,     4,     4,   146,     4,     4,   187,
+       4,     4,   148,   197,    72,   177,   222,   321,   364,   366,
+     368,   394,   395,   396,   397,   398,     4,     4,     4,     4,
+       4,     4,     4,   146,   148,     4,     4,     4,     4,   277,
+       4,     4,   348,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,   363,     4,     4,   146,     4,     4,     4,
+     148,   307,     4,   148,   148,   331,     4,     4,   250,   148,
+       4,     4,   146,     4,   146,   146,     4,     4,   148,   148,
+     148,     4,     4,   414,     4,     7,     7,   162,   162,   162,
+       7,   145,     7,     7,     5,     5,     5,     5,     5,     5,
+       7,     7,     7,     5,   173,    14,    15,   204,   399,     8,
+       3,   145,   145,   145,     5,   145,   145,   145,    67,    68,
+      69,   294,   145,     5,     7,   145,   164,   166,   145,   145,
+     173,   145,   145,   145,   145,   145,   145,   145,   145,   145,
+     145,   145,   145,   145,   145,   162,   145,   145,   145,    15,
+     115,   427,   116,   117,   430,   118,   119,   120,   121,   148,
+     436,   145,   162,   186,   123,   447,   448,   449,   196,    24,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+     177,   210,   211,   212,   215,   217,   219,   221,   222,   224,
+     225,   226,   227,   228,   230,   210,     7,   270,   271,   272,
+       7,   299,   300,   301,     7,   323,   324,   325,    75,    76,
+      77,    78,    80,   234,   235,   236,   237,   238,   239,   240,
+     290,   392,     7,   243,   244,   245,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,    98,    99,   403,   404,
+     405,   407,   413,   174,     4,   396,     7,   341,   342,   343,
+       7,   355,   356,   357,    82,   388,     8,   450,     3,     8,
+       8,   213,   216,   218,   220,     4,     4,     4,     4,     4,
+     229,   231,     3,     8,     8,   273,     6,     3,   302,     6,
+       3,   326,     6,     3,     3,     6,     3,     6,   246,     6,
+       3,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       3,     8,   406,   408,     3,     8,     8,   145,   175,   176,
+     145,   344,     6,     3,   358,     6,     3,   389,     8,     4,
+     448,     4,     4,     4,     4,   146,   148,   146,   148,   146,
+       4,     4,   211,   276,   272,   305,   301,   329,   325,   235,
+     290,   249,   245,   146,   146,   146,   146,   146,   146,   148,
+     146,   146,   258,     4,     4,   404,     6,     3,   347,   343,
+     361,   357,     4,     5,    25,    26,    27,    28,   214,   145,
+     145,   145,   145,   145,     8,     8,     8,     8,   145,   145,
+     145,     8,     8,   145,     7,   451,   452,   453,     3,     6,
+     124,   126,   127,   177,   222,   454,   455,   456,   457,   459,
+     452,   460,     4,   458,     3,     8,     4,   146,     4,   455,
+       5,   145,     7,   461,   462,   463,     3,     6,   125,   128,
+     129,   130,   464,   465,   466,   468,   469,   470,   462,   467,
+       4,     4,     4,     3,     8,     4,   148,   146,   146,   465,
+     145
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   145,   147,   146,   148,   146,   149,   146,   150,   146,
-     151,   146,   152,   146,   153,   146,   154,   146,   155,   146,
-     156,   146,   157,   146,   158,   158,   158,   158,   158,   158,
-     158,   159,   161,   160,   162,   163,   163,   164,   164,   166,
-     165,   167,   167,   168,   168,   170,   169,   171,   171,   172,
-     172,   173,   175,   174,   176,   176,   177,   177,   177,   177,
-     177,   177,   179,   178,   181,   180,   182,   182,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,   183,   183,   184,
-     185,   186,   187,   188,   189,   191,   190,   192,   192,   193,
-     193,   193,   195,   194,   197,   196,   199,   198,   200,   200,
-     201,   203,   202,   205,   204,   206,   206,   207,   207,   207,
-     207,   207,   207,   207,   207,   207,   207,   207,   207,   207,
-     209,   208,   210,   210,   210,   210,   212,   211,   214,   213,
-     216,   215,   217,   219,   218,   220,   221,   222,   223,   225,
-     224,   227,   226,   229,   228,   230,   230,   231,   231,   231,
-     231,   231,   232,   233,   234,   235,   236,   238,   237,   239,
-     239,   240,   240,   242,   241,   244,   243,   245,   245,   245,
-     246,   246,   248,   247,   250,   249,   252,   251,   253,   253,
-     254,   254,   254,   254,   254,   254,   255,   256,   257,   258,
-     259,   260,   262,   261,   263,   263,   264,   264,   266,   265,
-     268,   267,   269,   269,   270,   270,   270,   270,   270,   270,
-     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
-     270,   270,   270,   270,   272,   271,   274,   273,   276,   275,
-     278,   277,   280,   279,   282,   281,   284,   283,   286,   285,
-     287,   287,   287,   288,   289,   291,   290,   292,   292,   293,
-     293,   295,   294,   297,   296,   298,   298,   299,   299,   300,
-     300,   300,   300,   300,   300,   300,   300,   301,   302,   303,
-     305,   304,   307,   306,   309,   308,   310,   312,   311,   313,
-     315,   314,   316,   316,   317,   317,   319,   318,   321,   320,
-     322,   322,   323,   323,   324,   324,   324,   324,   324,   324,
-     324,   325,   327,   326,   328,   329,   330,   331,   333,   332,
-     334,   334,   335,   335,   337,   336,   339,   338,   340,   340,
-     341,   341,   341,   341,   343,   342,   345,   344,   347,   346,
-     348,   348,   349,   349,   351,   350,   353,   352,   354,   354,
-     355,   355,   356,   356,   356,   356,   356,   356,   356,   356,
-     356,   356,   356,   356,   356,   358,   357,   360,   359,   362,
-     361,   364,   363,   366,   365,   368,   367,   370,   369,   372,
-     371,   374,   373,   376,   375,   378,   377,   380,   379,   382,
-     381,   384,   383,   385,   385,   386,   283,   387,   387,   388,
-     388,   389,   389,   389,   389,   389,   389,   389,   390,   392,
-     391,   393,   395,   394,   396,   396,   397,   397,   399,   398,
-     401,   400,   403,   402,   405,   404,   406,   406,   407,   407,
-     407,   407,   407,   407,   407,   407,   407,   407,   407,   407,
-     407,   407,   407,   408,   410,   409,   412,   411,   413,   415,
-     414,   416,   417,   419,   418,   420,   420,   422,   421,   423,
-     424,   425,   427,   426,   428,   428,   428,   428,   428,   430,
-     429,   432,   431,   434,   433,   436,   435,   438,   437,   439,
-     439,   440,   442,   441,   443,   443,   445,   444,   446,   446,
-     447,   447,   447,   447,   447,   448,   450,   449,   452,   451,
-     453,   453,   455,   454,   456,   456,   457,   457,   457,   457,
-     459,   458,   460,   461,   462
+       0,   149,   151,   150,   152,   150,   153,   150,   154,   150,
+     155,   150,   156,   150,   157,   150,   158,   150,   159,   150,
+     160,   150,   161,   150,   162,   162,   162,   162,   162,   162,
+     162,   163,   165,   164,   166,   167,   167,   168,   168,   170,
+     169,   171,   171,   172,   172,   174,   173,   175,   175,   176,
+     176,   177,   179,   178,   180,   180,   181,   181,   181,   181,
+     181,   181,   183,   182,   185,   184,   186,   186,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   188,
+     189,   190,   191,   192,   193,   195,   194,   196,   196,   197,
+     197,   197,   199,   198,   201,   200,   203,   202,   204,   204,
+     205,   207,   206,   209,   208,   210,   210,   211,   211,   211,
+     211,   211,   211,   211,   211,   211,   211,   211,   211,   211,
+     213,   212,   214,   214,   214,   214,   216,   215,   218,   217,
+     220,   219,   221,   223,   222,   224,   225,   226,   227,   229,
+     228,   231,   230,   233,   232,   234,   234,   235,   235,   235,
+     235,   235,   236,   237,   238,   239,   240,   242,   241,   243,
+     243,   244,   244,   246,   245,   248,   247,   249,   249,   249,
+     250,   250,   252,   251,   254,   253,   256,   255,   257,   257,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   269,   268,
+     270,   270,   271,   271,   273,   272,   275,   274,   276,   276,
+     277,   277,   277,   277,   277,   277,   277,   277,   277,   277,
+     277,   277,   277,   277,   277,   277,   277,   277,   277,   277,
+     279,   278,   281,   280,   283,   282,   285,   284,   287,   286,
+     289,   288,   291,   290,   293,   292,   294,   294,   294,   295,
+     296,   298,   297,   299,   299,   300,   300,   302,   301,   304,
+     303,   305,   305,   306,   306,   307,   307,   307,   307,   307,
+     307,   307,   307,   308,   309,   310,   312,   311,   314,   313,
+     316,   315,   317,   319,   318,   320,   322,   321,   323,   323,
+     324,   324,   326,   325,   328,   327,   329,   329,   330,   330,
+     331,   331,   331,   331,   331,   331,   331,   332,   334,   333,
+     335,   336,   337,   338,   340,   339,   341,   341,   342,   342,
+     344,   343,   346,   345,   347,   347,   348,   348,   348,   348,
+     350,   349,   352,   351,   354,   353,   355,   355,   356,   356,
+     358,   357,   360,   359,   361,   361,   362,   362,   363,   363,
+     363,   363,   363,   363,   363,   363,   363,   363,   363,   363,
+     363,   365,   364,   367,   366,   369,   368,   371,   370,   373,
+     372,   375,   374,   377,   376,   379,   378,   381,   380,   383,
+     382,   385,   384,   387,   386,   389,   388,   391,   390,   392,
+     392,   393,   290,   394,   394,   395,   395,   396,   396,   396,
+     396,   396,   396,   396,   397,   399,   398,   400,   402,   401,
+     403,   403,   404,   404,   406,   405,   408,   407,   410,   409,
+     412,   411,   413,   413,   414,   414,   414,   414,   414,   414,
+     414,   414,   414,   414,   414,   414,   414,   414,   414,   415,
+     417,   416,   419,   418,   420,   422,   421,   423,   424,   426,
+     425,   427,   427,   429,   428,   430,   430,   431,   432,   433,
+     435,   434,   436,   436,   436,   436,   436,   438,   437,   440,
+     439,   442,   441,   444,   443,   446,   445,   447,   447,   448,
+     450,   449,   451,   451,   453,   452,   454,   454,   455,   455,
+     455,   455,   455,   456,   458,   457,   460,   459,   461,   461,
+     463,   462,   464,   464,   465,   465,   465,   465,   467,   466,
+     468,   469,   470
   };
 
-  const unsigned char
+  const signed char
   Dhcp4Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -3931,50 +4149,51 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
        1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
        1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
        0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       1,     1,     1,     3,     3,     0,     6,     0,     1,     1,
-       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
-       0,     4,     0,     4,     0,     4,     1,     0,     4,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     1,     1,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     6,     0,
-       4,     0,     6,     1,     3,     0,     4,     0,     1,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     0,     6,     1,     3,     1,     1,     0,     4,
-       0,     4,     0,     6,     0,     4,     1,     3,     1,     1,
+       0,     4,     0,     4,     0,     4,     1,     1,     1,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     0,     4,     0,     4,
+       0,     4,     1,     0,     4,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     1,     3,     3,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     0,     4,     0,     4,     3,     0,
-       4,     3,     3,     0,     4,     1,     1,     0,     4,     3,
-       3,     3,     0,     4,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     6,     1,
-       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     3,     0,     4,     0,     6,
-       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
-       0,     4,     3,     3,     3
+       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     6,     0,     4,     0,     6,     1,
+       3,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     4,     3,     0,     6,
+       1,     3,     1,     1,     0,     4,     0,     4,     0,     6,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       0,     4,     0,     4,     3,     0,     4,     3,     3,     0,
+       4,     1,     1,     0,     4,     1,     1,     3,     3,     3,
+       0,     4,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     6,     1,     3,     1,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     3,     0,     4,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     0,     4,
+       3,     3,     3
   };
 
 
-
+#if PARSER4_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp4Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
   "\"interfaces-config\"", "\"interfaces\"", "\"dhcp-socket-type\"",
   "\"raw\"", "\"udp\"", "\"re-detect\"", "\"echo-client-id\"",
   "\"match-client-id\"", "\"next-server\"", "\"server-hostname\"",
@@ -3999,13 +4218,15 @@ namespace isc { namespace dhcp {
   "\"reclaim-timer-wait-time\"", "\"flush-reclaimed-timer-wait-time\"",
   "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"",
-  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
-  "\"socket-name\"", "\"dhcp-ddns\"", "\"enable-updates\"",
-  "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
-  "\"sender-ip\"", "\"sender-port\"", "\"max-queue-size\"",
-  "\"ncr-protocol\"", "\"ncr-format\"", "\"always-include-fqdn\"",
-  "\"override-no-update\"", "\"override-client-update\"",
-  "\"replace-client-name\"", "\"generated-prefix\"", "\"tcp\"", "\"JSON\"",
+  "\"background-reclamation\"", "\"reclaim-slice-leases\"",
+  "\"max-reclaim-rate\"", "\"dhcp4o6-port\"", "\"control-socket\"",
+  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
+  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
+  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
+  "\"always-include-fqdn\"", "\"override-no-update\"",
+  "\"override-client-update\"", "\"replace-client-name\"",
+  "\"generated-prefix\"", "\"tcp\"", "\"JSON\"", "\"BINARY\"",
   "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
   "\"Logging\"", "\"loggers\"", "\"output_options\"", "\"output\"",
   "\"debuglevel\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
@@ -4041,7 +4262,8 @@ namespace isc { namespace dhcp {
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@38",
+  "unwarned_reclaim_cycles", "background_reclamation",
+  "reclaim_slice_leases", "max_reclaim_rate", "subnet4_list", "$@38",
   "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@39",
   "sub_subnet4", "$@40", "subnet4_params", "subnet4_param", "subnet",
   "$@41", "subnet_4o6_interface", "$@42", "subnet_4o6_interface_id",
@@ -4079,7 +4301,7 @@ namespace isc { namespace dhcp {
   "$@88", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
   "qualifying_suffix", "$@89", "server_ip", "$@90", "server_port",
   "sender_ip", "$@91", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@92", "ncr_protocol_value", "ncr_format", "$@93",
+  "$@92", "ncr_protocol_value", "ncr_format", "$@93", "ncr_format_value",
   "always_include_fqdn", "override_no_update", "override_client_update",
   "replace_client_name", "$@94", "replace_client_name_value",
   "generated_prefix", "$@95", "dhcp6_json_object", "$@96",
@@ -4091,87 +4313,88 @@ namespace isc { namespace dhcp {
   "output_params_list", "output_params", "output", "$@105", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER4_DEBUG
-  const unsigned short int
+  const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   226,   226,   226,   227,   227,   228,   228,   229,   229,
-     230,   230,   231,   231,   232,   232,   233,   233,   234,   234,
-     235,   235,   236,   236,   244,   245,   246,   247,   248,   249,
-     250,   253,   258,   258,   269,   272,   273,   276,   280,   287,
-     287,   294,   295,   298,   302,   309,   309,   316,   317,   320,
-     324,   335,   345,   345,   358,   359,   363,   364,   365,   366,
-     367,   368,   371,   371,   388,   388,   396,   397,   402,   403,
-     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
-     414,   415,   416,   417,   418,   419,   420,   421,   422,   425,
-     430,   435,   440,   445,   450,   456,   456,   466,   467,   470,
-     471,   472,   475,   475,   483,   483,   493,   493,   500,   501,
-     504,   510,   510,   520,   520,   530,   531,   534,   535,   536,
-     537,   538,   539,   540,   541,   542,   543,   544,   545,   546,
-     549,   549,   556,   557,   558,   559,   562,   562,   570,   570,
-     578,   578,   586,   591,   591,   599,   604,   609,   614,   619,
-     619,   627,   627,   636,   636,   646,   647,   650,   651,   652,
-     653,   654,   657,   662,   667,   672,   677,   682,   682,   692,
-     693,   696,   697,   700,   700,   708,   708,   716,   717,   718,
-     721,   722,   725,   725,   733,   733,   741,   741,   751,   752,
-     755,   756,   757,   758,   759,   760,   763,   768,   773,   778,
-     783,   788,   796,   796,   809,   810,   813,   814,   821,   821,
-     844,   844,   853,   854,   858,   859,   860,   861,   862,   863,
-     864,   865,   866,   867,   868,   869,   870,   871,   872,   873,
-     874,   875,   876,   877,   880,   880,   888,   888,   896,   896,
-     904,   904,   912,   912,   920,   920,   928,   928,   936,   936,
-     943,   944,   945,   948,   953,   962,   962,   974,   975,   978,
-     979,   984,   984,   995,   995,  1005,  1006,  1009,  1010,  1013,
-    1014,  1015,  1016,  1017,  1018,  1019,  1020,  1023,  1025,  1030,
-    1032,  1032,  1040,  1040,  1048,  1048,  1056,  1058,  1058,  1066,
-    1075,  1075,  1087,  1088,  1093,  1094,  1099,  1099,  1110,  1110,
-    1121,  1122,  1127,  1128,  1133,  1134,  1135,  1136,  1137,  1138,
-    1139,  1142,  1144,  1144,  1152,  1154,  1156,  1161,  1169,  1169,
-    1181,  1182,  1185,  1186,  1189,  1189,  1197,  1197,  1205,  1206,
-    1209,  1210,  1211,  1212,  1215,  1215,  1223,  1223,  1233,  1233,
-    1243,  1244,  1247,  1248,  1251,  1251,  1259,  1259,  1267,  1268,
-    1271,  1272,  1276,  1277,  1278,  1279,  1280,  1281,  1282,  1283,
-    1284,  1285,  1286,  1287,  1288,  1291,  1291,  1299,  1299,  1307,
-    1307,  1315,  1315,  1323,  1323,  1331,  1331,  1339,  1339,  1347,
-    1347,  1355,  1355,  1363,  1363,  1371,  1371,  1384,  1384,  1394,
-    1394,  1405,  1405,  1415,  1416,  1419,  1419,  1427,  1428,  1431,
-    1432,  1435,  1436,  1437,  1438,  1439,  1440,  1441,  1444,  1446,
-    1446,  1458,  1465,  1465,  1475,  1476,  1479,  1480,  1483,  1483,
-    1491,  1491,  1501,  1501,  1511,  1511,  1519,  1520,  1523,  1524,
-    1525,  1526,  1527,  1528,  1529,  1530,  1531,  1532,  1533,  1534,
-    1535,  1536,  1537,  1540,  1545,  1545,  1553,  1553,  1561,  1566,
-    1566,  1574,  1579,  1584,  1584,  1592,  1593,  1596,  1596,  1604,
-    1609,  1614,  1619,  1619,  1627,  1630,  1633,  1636,  1639,  1645,
-    1645,  1655,  1655,  1662,  1662,  1669,  1669,  1681,  1681,  1694,
-    1695,  1699,  1703,  1703,  1715,  1716,  1720,  1720,  1728,  1729,
-    1732,  1733,  1734,  1735,  1736,  1739,  1744,  1744,  1752,  1752,
-    1762,  1763,  1766,  1766,  1774,  1775,  1778,  1779,  1780,  1781,
-    1784,  1784,  1792,  1797,  1802
+       0,   231,   231,   231,   232,   232,   233,   233,   234,   234,
+     235,   235,   236,   236,   237,   237,   238,   238,   239,   239,
+     240,   240,   241,   241,   249,   250,   251,   252,   253,   254,
+     255,   258,   263,   263,   274,   277,   278,   281,   285,   292,
+     292,   299,   300,   303,   307,   314,   314,   321,   322,   325,
+     329,   340,   350,   350,   363,   364,   368,   369,   370,   371,
+     372,   373,   376,   376,   393,   393,   401,   402,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   430,
+     435,   440,   445,   450,   455,   461,   461,   471,   472,   475,
+     476,   477,   480,   480,   488,   488,   498,   498,   505,   506,
+     509,   515,   515,   525,   525,   535,   536,   539,   540,   541,
+     542,   543,   544,   545,   546,   547,   548,   549,   550,   551,
+     554,   554,   561,   562,   563,   564,   567,   567,   575,   575,
+     583,   583,   591,   596,   596,   604,   609,   614,   619,   624,
+     624,   632,   632,   641,   641,   651,   652,   655,   656,   657,
+     658,   659,   662,   667,   672,   677,   682,   687,   687,   697,
+     698,   701,   702,   705,   705,   713,   713,   721,   722,   723,
+     726,   727,   730,   730,   738,   738,   746,   746,   756,   757,
+     760,   761,   762,   763,   764,   765,   766,   767,   768,   771,
+     776,   781,   786,   791,   796,   801,   806,   811,   819,   819,
+     832,   833,   836,   837,   844,   844,   867,   867,   876,   877,
+     881,   882,   883,   884,   885,   886,   887,   888,   889,   890,
+     891,   892,   893,   894,   895,   896,   897,   898,   899,   900,
+     903,   903,   911,   911,   919,   919,   927,   927,   935,   935,
+     943,   943,   951,   951,   959,   959,   966,   967,   968,   971,
+     976,   985,   985,   997,   998,  1001,  1002,  1007,  1007,  1018,
+    1018,  1028,  1029,  1032,  1033,  1036,  1037,  1038,  1039,  1040,
+    1041,  1042,  1043,  1046,  1048,  1053,  1055,  1055,  1063,  1063,
+    1071,  1071,  1079,  1081,  1081,  1089,  1098,  1098,  1110,  1111,
+    1116,  1117,  1122,  1122,  1133,  1133,  1144,  1145,  1150,  1151,
+    1156,  1157,  1158,  1159,  1160,  1161,  1162,  1165,  1167,  1167,
+    1175,  1177,  1179,  1184,  1192,  1192,  1204,  1205,  1208,  1209,
+    1212,  1212,  1220,  1220,  1228,  1229,  1232,  1233,  1234,  1235,
+    1238,  1238,  1246,  1246,  1256,  1256,  1266,  1267,  1270,  1271,
+    1274,  1274,  1282,  1282,  1290,  1291,  1294,  1295,  1299,  1300,
+    1301,  1302,  1303,  1304,  1305,  1306,  1307,  1308,  1309,  1310,
+    1311,  1314,  1314,  1322,  1322,  1330,  1330,  1338,  1338,  1346,
+    1346,  1354,  1354,  1362,  1362,  1370,  1370,  1378,  1378,  1386,
+    1386,  1394,  1394,  1407,  1407,  1417,  1417,  1428,  1428,  1438,
+    1439,  1442,  1442,  1450,  1451,  1454,  1455,  1458,  1459,  1460,
+    1461,  1462,  1463,  1464,  1467,  1469,  1469,  1481,  1488,  1488,
+    1498,  1499,  1502,  1503,  1506,  1506,  1514,  1514,  1524,  1524,
+    1534,  1534,  1542,  1543,  1546,  1547,  1548,  1549,  1550,  1551,
+    1552,  1553,  1554,  1555,  1556,  1557,  1558,  1559,  1560,  1563,
+    1568,  1568,  1576,  1576,  1584,  1589,  1589,  1597,  1602,  1607,
+    1607,  1615,  1616,  1619,  1619,  1627,  1628,  1631,  1636,  1641,
+    1646,  1646,  1654,  1657,  1660,  1663,  1666,  1672,  1672,  1682,
+    1682,  1689,  1689,  1696,  1696,  1708,  1708,  1721,  1722,  1726,
+    1730,  1730,  1742,  1743,  1747,  1747,  1755,  1756,  1759,  1760,
+    1761,  1762,  1763,  1766,  1771,  1771,  1779,  1779,  1789,  1790,
+    1793,  1793,  1801,  1802,  1805,  1806,  1807,  1808,  1811,  1811,
+    1819,  1824,  1829
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp4Parser::yystack_print_ ()
+  Dhcp4Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp4Parser::yy_reduce_print_ (int yyrule)
+  Dhcp4Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -4180,10 +4403,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER4_DEBUG
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:1167
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4186 "dhcp4_parser.cc" // lalr1.cc:1167
-#line 1807 "dhcp4_parser.yy" // lalr1.cc:1168
+#line 4409 "dhcp4_parser.cc"
+
+#line 1834 "dhcp4_parser.yy"
 
 
 void
@@ -143,6 +143,9 @@ using namespace std;
   MAX_RECLAIM_LEASES "max-reclaim-leases"
   MAX_RECLAIM_TIME "max-reclaim-time"
   UNWARNED_RECLAIM_CYCLES "unwarned-reclaim-cycles"
+  BACKGROUND_RECLAMATION "background-reclamation"
+  RECLAIM_SLICE_LEASES "reclaim-slice-leases"
+  MAX_RECLAIM_RATE "max-reclaim-rate"
 
   DHCP4O6_PORT "dhcp4o6-port"
 
@@ -167,6 +170,7 @@ using namespace std;
   GENERATED_PREFIX "generated-prefix"
   TCP "tcp"
   JSON "JSON"
+  BINARY "BINARY"
   WHEN_PRESENT "when-present"
   NEVER "never"
   ALWAYS "always"
@@ -212,6 +216,7 @@ using namespace std;
 %type <ElementPtr> db_type
 %type <ElementPtr> hr_mode
 %type <ElementPtr> ncr_protocol_value
+%type <ElementPtr> ncr_format_value
 %type <ElementPtr> replace_client_name_value
 
 %printer { yyoutput << $$; } <*>;
@@ -758,6 +763,9 @@ expired_leases_param: reclaim_timer_wait_time
                     | max_reclaim_leases
                     | max_reclaim_time
                     | unwarned_reclaim_cycles
+                    | background_reclamation
+                    | reclaim_slice_leases
+                    | max_reclaim_rate
                     ;
 
 reclaim_timer_wait_time: RECLAIM_TIMER_WAIT_TIME COLON INTEGER {
@@ -790,6 +798,21 @@ unwarned_reclaim_cycles: UNWARNED_RECLAIM_CYCLES COLON INTEGER {
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 };
 
+background_reclamation: BACKGROUND_RECLAMATION COLON BOOLEAN {
+    ElementPtr value(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("background-reclamation", value);
+};
+
+reclaim_slice_leases: RECLAIM_SLICE_LEASES COLON INTEGER {
+    ElementPtr value(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("reclaim-slice-leases", value);
+};
+
+max_reclaim_rate: MAX_RECLAIM_RATE COLON INTEGER {
+    ElementPtr value(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("max-reclaim-rate", value);
+};
+
 // --- subnet4 ------------------------------------------
 // This defines subnet4 as a list of maps.
 // "subnet4": [ ... ]
@@ -1595,12 +1618,16 @@ ncr_protocol_value:
 
 ncr_format: NCR_FORMAT {
     ctx.enter(ctx.NCR_FORMAT);
-} COLON JSON {
-    ElementPtr json(new StringElement("JSON", ctx.loc2pos(@4)));
-    ctx.stack_.back()->set("ncr-format", json);
+} COLON ncr_format_value {
+    ctx.stack_.back()->set("ncr-format", $4);
     ctx.leave();
 };
 
+ncr_format_value:
+    JSON { $$ = ElementPtr(new StringElement("JSON", ctx.loc2pos(@1))); }
+  | BINARY { $$ = ElementPtr(new StringElement("BINARY", ctx.loc2pos(@1))); }
+  ;
+
 always_include_fqdn: ALWAYS_INCLUDE_FQDN COLON BOOLEAN {
     ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("always-include-fqdn", b);
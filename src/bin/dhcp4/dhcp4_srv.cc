@@ -84,8 +84,22 @@ struct Dhcp4Hooks {
     int hook_index_lease4_decline_;  ///< index for "lease4_decline" hook point
     int hook_index_host4_identifier_;///< index for "host4_identifier" hook point
 
-    /// Constructor that registers hook points for DHCPv4 engine
-    Dhcp4Hooks() {
+    /// Slots of the callout arguments passed by the DHCPv4 engine.
+    ArgumentSlot<Pkt4Ptr> query4_arg_;       ///< "query4" argument
+    ArgumentSlot<Pkt4Ptr> response4_arg_;    ///< "response4" argument
+    ArgumentSlot<Subnet4Ptr> subnet4_arg_;   ///< "subnet4" argument
+    ArgumentSlot<const Subnet4Collection*>
+        subnet4collection_arg_;              ///< "subnet4collection" argument
+    ArgumentSlot<Lease4Ptr> lease4_arg_;     ///< "lease4" argument
+    ArgumentSlot<Host::IdentifierType> id_type_arg_; ///< "id_type" argument
+    ArgumentSlot<std::vector<uint8_t> > id_value_arg_; ///< "id_value" argument
+
+    /// Constructor that registers hook points and arguments for DHCPv4 engine
+    Dhcp4Hooks()
+        : query4_arg_("query4"), response4_arg_("response4"),
+          subnet4_arg_("subnet4"), subnet4collection_arg_("subnet4collection"),
+          lease4_arg_("lease4"), id_type_arg_("id_type"),
+          id_value_arg_("id_value") {
         hook_index_buffer4_receive_  = HooksManager::registerHook("buffer4_receive");
         hook_index_pkt4_receive_     = HooksManager::registerHook("pkt4_receive");
         hook_index_subnet4_select_   = HooksManager::registerHook("subnet4_select");
@@ -355,16 +369,17 @@ Dhcpv4Exchange::setHostIdentifiers() {
                 callout_handle->deleteAllArguments();
 
                 // Pass incoming packet as argument
-                callout_handle->setArgument("query4", context_->query_);
-                callout_handle->setArgument("id_type", type);
-                callout_handle->setArgument("id_value", id);
+                callout_handle->setArgument(Hooks.query4_arg_,
+                                            context_->query_);
+                callout_handle->setArgument(Hooks.id_type_arg_, type);
+                callout_handle->setArgument(Hooks.id_value_arg_, id);
 
                 // Call callouts
                 HooksManager::callCallouts(Hooks.hook_index_host4_identifier_,
                                            *callout_handle);
 
-                callout_handle->getArgument("id_type", type);
-                callout_handle->getArgument("id_value", id);
+                callout_handle->getArgument(Hooks.id_type_arg_, type);
+                callout_handle->getArgument(Hooks.id_value_arg_, id);
 
                 if ((callout_handle->getStatus() == CalloutHandle::NEXT_STEP_CONTINUE) &&
                     !id.empty()) {
@@ -551,9 +566,9 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query) const {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.query4_arg_, query);
+        callout_handle->setArgument(Hooks.subnet4_arg_, subnet);
+        callout_handle->setArgument(Hooks.subnet4collection_arg_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -574,7 +589,7 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query) const {
         /// @todo: Add support for DROP status
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.subnet4_arg_, subnet);
     }
 
     if (subnet) {
@@ -655,9 +670,9 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query) const {
         callout_handle->deleteAllArguments();
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.query4_arg_, query);
+        callout_handle->setArgument(Hooks.subnet4_arg_, subnet);
+        callout_handle->setArgument(Hooks.subnet4collection_arg_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -678,7 +693,7 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query) const {
         /// @todo: Add support for DROP status
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.subnet4_arg_, subnet);
     }
 
     if (subnet) {
@@ -826,7 +841,7 @@ Dhcpv4Srv::run_one() {
             ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response4", rsp);
+            callout_handle->setArgument(Hooks.response4_arg_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
@@ -844,7 +859,7 @@ Dhcpv4Srv::run_one() {
 
             /// @todo: Add support for DROP status.
 
-            callout_handle->getArgument("response4", rsp);
+            callout_handle->getArgument(Hooks.response4_arg_, rsp);
         }
 
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
@@ -898,7 +913,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.query4_arg_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer4_receive_,
@@ -917,7 +932,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             skip_unpack = true;
         }
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.query4_arg_, query);
 
         /// @todo: add support for DROP status
     }
@@ -991,7 +1006,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.query4_arg_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_receive_,
@@ -1009,7 +1024,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
 
         /// @todo: Add support for DROP status
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.query4_arg_, query);
     }
 
     try {
@@ -1084,10 +1099,10 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt4> query_resp_options_copy(query, rsp);
 
         // Set our response
-        callout_handle->setArgument("response4", rsp);
+        callout_handle->setArgument(Hooks.response4_arg_, rsp);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.query4_arg_, query);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_send_,
@@ -2328,10 +2343,10 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release) {
             ScopedEnableOptionsCopy<Pkt4> query4_options_copy(release);
 
             // Pass the original packet
-            callout_handle->setArgument("query4", release);
+            callout_handle->setArgument(Hooks.query4_arg_, release);
 
             // Pass the lease to be updated
-            callout_handle->setArgument("lease4", lease);
+            callout_handle->setArgument(Hooks.lease4_arg_, lease);
 
             // Call all installed callouts
             HooksManager::callCallouts(Hooks.hook_index_lease4_release_,
@@ -2474,8 +2489,8 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(decline);
 
         // Pass incoming Decline and the lease to be declined.
-        callout_handle->setArgument("lease4", lease);
-        callout_handle->setArgument("query4", decline);
+        callout_handle->setArgument(Hooks.lease4_arg_, lease);
+        callout_handle->setArgument(Hooks.query4_arg_, decline);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_lease4_decline_,
@@ -10,6 +10,7 @@
 #include <dhcp4/dhcp4_log.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option_definition.h>
+#include <dhcpsrv/cfg_load_profiler.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/parsers/client_class_def_parser.h>
@@ -166,6 +167,8 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
     // the parsers.  It is declared outside the loops so in case of an error,
     // the name of the failing parser can be retrieved in the "catch" clause.
     ConfigPair config_pair;
+    // Measures the durations of the configuration stages.
+    CfgLoadProfiler profiler;
     try {
 
         SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
@@ -177,9 +180,11 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
 
         // Set all default values if not specified by the user.
         SimpleParser4::setAllDefaults(mutable_cfg);
+        profiler.mark("defaults");
 
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser4::deriveParameters(mutable_cfg);
+        profiler.mark("derive");
 
         // We need definitions first
         ConstElementPtr option_defs = mutable_cfg->get("option-def");
@@ -188,6 +193,7 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
             CfgOptionDefPtr cfg_option_def = srv_cfg->getCfgOptionDef();
             parser.parse(cfg_option_def, option_defs);
         }
+        profiler.mark("option-def");
 
         // Make parsers grouping.
         const std::map<std::string, ConstElementPtr>& values_map =
@@ -283,10 +289,12 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first == "subnet4") {
+                profiler.mark("parameters");
                 SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
                 Subnets4ListConfigParser subnets_parser;
                 // parse() returns number of subnets parsed. We may log it one day.
                 subnets_parser.parse(srv_cfg, config_pair.second);
+                profiler.mark("subnet4");
                 continue;
             }
 
@@ -311,10 +319,12 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
                       "unsupported global configuration parameter: " << config_pair.first
                       << " (" << config_pair.second->getPosition() << ")");
         }
+        profiler.mark("parameters");
 
         // Apply global options in the staging config.
         Dhcp4ConfigParser global_parser;
         global_parser.parse(srv_cfg, mutable_cfg);
+        profiler.mark("globals");
 
     } catch (const isc::Exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_PARSER_FAIL)
@@ -379,8 +389,12 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
                                                " parsing error");
             rollback = true;
         }
+        profiler.mark("commit");
     }
 
+    LOG_DEBUG(dhcp4_logger, DBG_DHCP4_COMMAND, DHCP4_CONFIG_LOAD_PROFILE)
+        .arg(profiler.toText());
+
     // Rollback changes as the configuration parsing failed.
     if (rollback) {
         // Revert to original configuration of runtime option definitions
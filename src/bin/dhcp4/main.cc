@@ -10,6 +10,7 @@
 #include <dhcp4/dhcp4_log.h>
 #include <dhcp4/parser_context.h>
 #include <dhcp4/json_config_parser.h>
+#include <config/command_mgr.h>
 #include <cc/command_interpreter.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <log/logger_support.h>
@@ -223,6 +224,11 @@ main(int argc, char* argv[]) {
         // Tell the admin we are ready to process packets
         LOG_INFO(dhcp4_logger, DHCP4_STARTED).arg(VERSION);
 
+        // Execute the commands which only read the server state, such as
+        // statistic-get-all, in a separate thread, so as they don't delay
+        // the packet processing.
+        isc::config::CommandMgr::instance().setCommandThread(true);
+
         // And run the main loop of the server.
         server.run();
 
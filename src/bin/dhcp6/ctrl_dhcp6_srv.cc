@@ -19,6 +19,8 @@
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
 #include <cfgrpt/config_report.h>
+#include <util/stopwatch.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <signal.h>
 
 using namespace isc::config;
@@ -26,6 +28,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace boost::posix_time;
 using namespace std;
 
 namespace {
@@ -44,6 +47,10 @@ static const char* SERVER_DUID_FILE = "kea-dhcp6-serverid";
 /// @param signo Signal number received.
 void signalHandler(int signo) {
     // SIGHUP signals a request to reconfigure the server.
+    // The commands in progress in the command thread must not be
+    // executed concurrently with the reconfiguration.
+    CommandMgr::instance().waitForCommandThread();
+
     if (signo == SIGHUP) {
         ControlledDhcpv6Srv::processCommand("config-reload",
                                             ConstElementPtr());
@@ -90,10 +97,14 @@ ControlledDhcpv6Srv::loadConfigFile(const std::string& file_name) {
 
         // Read contents of the file and parse it as JSON
         Parser6Context parser;
+        util::Stopwatch stopwatch;
         json = parser.parseFile(file_name, Parser6Context::PARSER_DHCP6);
+        stopwatch.stop();
         if (!json) {
             isc_throw(isc::BadValue, "no configuration found");
         }
+        LOG_DEBUG(dhcp6_logger, DBG_DHCP6_COMMAND, DHCP6_CONFIG_FILE_PARSED)
+            .arg(file_name).arg(stopwatch.logFormatLastDuration());
 
         // Let's do sanity check before we call json->get() which
         // works only for map.
@@ -483,6 +494,9 @@ ControlledDhcpv6Srv::processCommand(const std::string& command,
 isc::data::ConstElementPtr
 ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
 
+    // Time the reconfiguration for the reconfiguration-time statistics.
+    const ptime start = microsec_clock::universal_time();
+
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_COMMAND, DHCP6_CONFIG_RECEIVED)
               .arg(config->str());
 
@@ -514,7 +528,11 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
     try {
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=6");
+        const ptime db_start = microsec_clock::universal_time();
         cfg_db->createManagers();
+        StatsMgr::instance().setValue("reconfiguration-db-time",
+            static_cast<int64_t>((microsec_clock::universal_time() - db_start)
+                                 .total_milliseconds()));
 
     } catch (const std::exception& ex) {
         return (isc::config::createAnswer(1, "Unable to open database: "
@@ -583,10 +601,33 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Start the background reclamation of the expired leases if enabled.
+    try {
+        server_->reclamation_worker_.reset();
+        SrvConfigPtr staging_cfg = CfgMgr::instance().getStagingCfg();
+        ConstCfgExpirationPtr cfg_expiration = staging_cfg->getCfgExpiration();
+        if (cfg_expiration->getBackgroundReclamation()) {
+            server_->reclamation_worker_.reset(new ReclamationWorker(AF_INET6,
+                server_->alloc_engine_, cfg_expiration,
+                staging_cfg->getCfgDbAccess()->getLeaseDbAccessString()));
+            server_->reclamation_worker_->start();
+        }
+
+    } catch (const std::exception& ex) {
+        std::ostringstream err;
+        err << "unable to start the background reclamation of the expired"
+            " leases: " << ex.what() << ".";
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Finally, we can commit runtime option definitions in libdhcp++. This is
     // exception free.
     LibDHCP::commitRuntimeOptionDefs();
 
+    StatsMgr::instance().setValue("reconfiguration-time",
+        static_cast<int64_t>((microsec_clock::universal_time() - start)
+                             .total_milliseconds()));
+
     return (answer);
 }
 
@@ -671,6 +712,15 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    // These commands only read the server state and may be executed in
+    // the command thread. The statistics are protected by the StatsMgr
+    // and the current configuration is not modified while they execute.
+    CommandMgr::instance().setCommandThreadSafe("build-report");
+    CommandMgr::instance().setCommandThreadSafe("config-get");
+    CommandMgr::instance().setCommandThreadSafe("statistic-get");
+    CommandMgr::instance().setCommandThreadSafe("statistic-get-all");
+    CommandMgr::instance().setCommandThreadSafe("version-get");
 }
 
 void ControlledDhcpv6Srv::shutdown() {
@@ -682,8 +732,14 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
     try {
         cleanup();
 
+        // Stop the reclamation worker before its timer is unregistered.
+        reclamation_worker_.reset();
+
         timer_mgr_->unregisterTimers();
 
+        // Stop the command thread before the command handlers go away.
+        CommandMgr::instance().setCommandThread(false);
+
         // Close the command socket (if it exists).
         CommandMgr::instance().closeCommandSocket();
 
@@ -728,9 +784,16 @@ ControlledDhcpv6Srv::reclaimExpiredLeases(const size_t max_leases,
                                           const uint16_t timeout,
                                           const bool remove_lease,
                                           const uint16_t max_unwarned_cycles) {
-    server_->alloc_engine_->reclaimExpiredLeases6(max_leases, timeout,
-                                                  remove_lease,
-                                                  max_unwarned_cycles);
+    if (server_->reclamation_worker_) {
+        // The worker reclaims the leases in slices and returns immediately.
+        server_->reclamation_worker_->startCycle(max_leases, timeout,
+                                                 remove_lease,
+                                                 max_unwarned_cycles);
+    } else {
+        server_->alloc_engine_->reclaimExpiredLeases6(max_leases, timeout,
+                                                      remove_lease,
+                                                      max_unwarned_cycles);
+    }
     // We're using the ONE_SHOT timer so there is a need to re-schedule it.
     TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
 }
@@ -11,6 +11,7 @@
 #include <asiolink/asiolink.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <dhcpsrv/reclamation_worker.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp6/dhcp6_srv.h>
 
@@ -268,6 +269,8 @@ private:
     /// @brief Reclaims expired IPv6 leases and reschedules timer.
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases6.
+    /// If the background reclamation is enabled, it starts the reclamation
+    /// cycle in the @c ReclamationWorker instead.
     /// It reschedules the timer for leases reclamation upon completion of
     /// this method.
     ///
@@ -311,6 +314,11 @@ private:
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
 
+    /// @brief Background lease reclamation worker.
+    ///
+    /// It is NULL unless the background reclamation is enabled.
+    ReclamationWorkerPtr reclamation_worker_;
+
 };
 
 }; // namespace isc::dhcp
@@ -131,6 +131,24 @@
             "item_type": "integer",
             "item_optional": false,
             "item_default": 5
+        },
+        {
+            "item_name": "background-reclamation",
+            "item_type": "boolean",
+            "item_optional": true,
+            "item_default": false
+        },
+        {
+            "item_name": "reclaim-slice-leases",
+            "item_type": "integer",
+            "item_optional": true,
+            "item_default": 50
+        },
+        {
+            "item_name": "max-reclaim-rate",
+            "item_type": "integer",
+            "item_optional": true,
+            "item_default": 0
         }
         ]
       },
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 160
-#define YY_END_OF_BUFFER 161
+#define YY_NUM_RULES 164
+#define YY_END_OF_BUFFER 165
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,145 +700,152 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1251] =
+static const flex_int16_t yy_accept[1307] =
     {   0,
-      153,  153,    0,    0,    0,    0,    0,    0,    0,    0,
-      161,  159,   10,   11,  159,    1,  153,  150,  153,  153,
-      159,  152,  151,  159,  159,  159,  159,  159,  146,  147,
-      159,  159,  159,  148,  149,    5,    5,    5,  159,  159,
-      159,   10,   11,    0,    0,  142,    0,    0,    0,    0,
+      157,  157,    0,    0,    0,    0,    0,    0,    0,    0,
+      165,  163,   10,   11,  163,    1,  157,  154,  157,  157,
+      163,  156,  155,  163,  163,  163,  163,  163,  150,  151,
+      163,  163,  163,  152,  153,    5,    5,    5,  163,  163,
+      163,   10,   11,    0,    0,  146,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  153,
-      153,    0,  152,  153,    3,    2,    6,    0,  153,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        1,  157,  157,    0,  156,  157,    3,    2,  156,    6,
+        0,  157,    0,    0,    0,    0,    0,    0,    4,    0,
 
-      143,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  145,    0,    0,    0,
+        0,    9,    0,  147,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      149,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    2,    0,    0,    0,    0,    0,    0,    0,    8,
-        0,    0,    0,    0,  121,    0,    0,  122,    0,    0,
-        0,    0,    0,    0,    0,    0,  144,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    2,  157,    0,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
+        0,    0,    0,    0,  122,    0,    0,  123,    0,    0,
 
+        0,    0,    0,    0,    0,    0,  148,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   79,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   80,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  158,  156,    0,  155,
-      154,    0,    0,    0,    0,    0,    0,    0,  120,    0,
-        0,   27,    0,   26,    0,    0,   85,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  162,  160,
+        0,  159,  158,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,   46,    0,    0,    0,    0,    0,    0,
+        0,  121,    0,    0,   27,    0,   26,    0,    0,   86,
+        0,    0,    0,    0,    0,    0,    0,   47,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   84,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   83,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  157,  154,    0,
-        0,    0,    0,    0,    0,    0,    0,   28,    0,    0,
-       30,    0,    0,    0,    0,    0,   86,    0,    0,    0,
+        0,  161,  158,    0,    0,    0,    0,    0,    0,    0,
 
-        0,   65,    0,    0,    0,    0,    0,    0,  105,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
+        0,    0,   28,    0,    0,   31,    0,    0,    0,    0,
+        0,    0,   87,    0,    0,    0,    0,   66,    0,    0,
+        0,    0,    0,    0,  106,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   50,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   65,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   75,    0,   51,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       64,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   74,    0,   50,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  101,  125,   42,    0,   47,    0,
-        0,    0,    0,    0,    0,  139,   35,    0,   32,    0,
-       31,    0,    0,    0,  113,    0,    0,    0,    0,    0,
+      102,  126,   43,    0,   48,    0,    0,    0,    0,    0,
 
+        0,    0,  143,   36,    0,   33,    0,   32,    0,    0,
+        0,    0,  114,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
-      124,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   44,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   67,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  114,    0,
-        0,    0,    0,    0,    0,    0,    0,  109,    0,    0,
-        0,    0,    7,   33,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   95,    0,    0,    0,    0,    0,    0,    0,  125,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   45,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   68,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  115,    0,    0,
+        0,    0,    0,    0,    0,    0,  110,    0,    0,    0,
+        0,    7,    0,   34,   29,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   96,    0,    0,
-        0,    0,    0,   93,    0,    0,    0,    0,    0,    0,
-        0,    0,   69,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       76,    0,    0,    0,    0,    0,    0,   90,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  108,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   97,
+        0,    0,    0,    0,    0,   94,    0,    0,    0,    0,
+        0,    0,    0,    0,   70,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   77,    0,    0,    0,    0,    0,    0,   91,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  118,   91,    0,    0,    0,   95,   43,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   51,
+        0,  109,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  119,   92,    0,    0,
+        0,   96,   44,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   52,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   62,    0,    0,    0,    0,
+      144,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   83,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  108,    0,    0,
+        0,    0,    0,   55,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   49,   69,    0,
+        0,    0,  105,    0,    0,    0,   42,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   61,    0,    0,    0,    0,  140,    0,    0,
+       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   82,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  107,    0,    0,    0,    0,    0,   54,
+      142,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   78,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   48,   68,    0,    0,    0,  104,    0,
-        0,    0,   41,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   39,    0,
+        0,    0,    0,    0,    0,    0,    0,   16,    0,  120,
 
-        0,    0,    0,    0,    0,   98,    0,    0,    0,    0,
+       14,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  111,   98,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  138,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   77,
+        0,    0,    0,  107,  124,    0,   38,    0,  116,    0,
+        0,    0,    0,    0,    0,   20,    0,    0,   63,    0,
+        0,    0,    0,  118,   46,    0,   71,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   67,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  113,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   38,    0,    0,    0,    0,    0,    0,    0,
-       16,    0,  119,   14,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  110,
-       97,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,  106,  123,    0,   37,    0,
-      115,    0,    0,    0,    0,    0,    0,   20,    0,    0,
-       62,    0,    0,    0,    0,  117,   45,    0,   70,    0,
+
+        0,    0,    0,   88,    0,    0,    0,   64,   85,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   66,
-        0,    0,    0,    0,    0,    0,    0,    0,  112,    0,
+       59,    0,    0,    0,   17,   15,  141,  140,    0,    0,
+        0,    0,    0,   30,    0,    0,  101,    0,    0,    0,
+        0,    0,    0,  138,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   79,    0,  104,    0,   53,    0,
+        0,    0,    0,   19,    0,    0,    0,    0,    0,   81,
+       60,    0,    0,  112,    0,    0,    0,  103,    0,   76,
+        0,  145,    0,    0,    0,    0,    0,    0,    0,    0,
+       74,    0,  127,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   87,    0,    0,    0,   63,   84,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   58,
-        0,    0,    0,   17,   15,  137,  136,    0,    0,    0,
-
-        0,    0,   29,    0,  100,    0,    0,    0,    0,    0,
-        0,  134,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   78,    0,  103,    0,   52,    0,    0,    0,
-       19,    0,    0,    0,    0,    0,   80,   59,    0,  111,
-        0,    0,    0,  102,    0,   75,    0,  141,    0,    0,
-        0,    0,    0,    0,    0,   73,    0,  126,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  100,    0,   56,  139,    0,   12,    0,    0,
+        0,    0,    0,    0,    0,   41,    0,   40,   18,    0,
+        0,    0,   93,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   58,    0,    0,    0,   54,    0,   72,
+        0,    0,    0,    0,    0,  117,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   99,    0,   55,  135,    0,   12,
-        0,    0,    0,    0,    0,    0,    0,   40,    0,   39,
-
-       18,    0,    0,   92,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   57,    0,    0,   53,    0,   71,    0,
-        0,    0,    0,    0,  116,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   34,    0,
-        0,    0,    0,    0,   25,    0,    0,    0,    0,  132,
-        0,    0,    0,    0,    0,    0,    0,   81,    0,    0,
-        0,    0,    0,    0,    0,    0,   36,    0,    0,    0,
-        0,   13,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  131,    0,   22,   56,    0,    0,    0,
-        0,   21,    0,   72,    0,    0,  130,    0,    0,    0,
-
-        0,   24,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   35,    0,    0,    0,    0,    0,    0,   25,    0,
+        0,    0,    0,  137,  133,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   82,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   37,    0,    0,    0,    0,   13,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   23,    0,   88,    0,    0,    0,    0,
-        0,  128,  133,   60,    0,    0,    0,  127,    0,    0,
-        0,    0,    0,    0,    0,   89,    0,    0,  129,    0
+        0,    0,  132,    0,   22,   57,    0,    0,    0,    0,
+        0,   21,    0,    0,   73,    0,    0,  131,    0,    0,
+        0,    0,    0,   24,    0,    0,    0,    0,    0,    0,
+        0,  136,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  135,    0,    0,    0,    0,   23,
+        0,   89,    0,    0,    0,    0,    0,  129,  134,   61,
+        0,    0,    0,  128,    0,    0,    0,    0,    0,    0,
+
+        0,   90,    0,    0,  130,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -850,11 +857,11 @@ static const YY_CHAR yy_ec[256] =
         5,    8,    9,   10,   11,   12,   13,   14,   14,   14,
        14,   15,   14,   16,   14,   14,   14,   17,    5,   18,
         5,   19,   20,    5,   21,   22,   23,   24,   25,   26,
-        5,   27,    5,   28,    5,   29,    5,   30,   31,   32,
-        5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
-       40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
+        5,   27,   28,   29,    5,   30,    5,   31,   32,   33,
+        5,   34,   35,   36,   37,   38,   39,    5,   40,    5,
+       41,   42,   43,    5,   44,    5,   45,   46,   47,   48,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
+       49,   50,   51,   52,   53,   29,   54,   55,   56,   57,
        58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
        68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -875,705 +882,881 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[72] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1
     } ;
 
-static const flex_int16_t yy_base[1263] =
+static const flex_int16_t yy_base[1307] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1612, 1613,   32, 1608,  141,    0,  201, 1613,  206,   88,
-       11,  213, 1613, 1590,  114,   25,    2,    6, 1613, 1613,
-       73,   11,   17, 1613, 1613, 1613,  104, 1596, 1551,    0,
-     1588,  107, 1603,  217,  241, 1613,  185, 1547, 1553, 1573,
-       93,   58,  190,   91,  211,  200,   14,  267,  213,  175,
-      269,   64,  231, 1554,  187,   75, 1553,  274,  188,  290,
-      276,  295, 1536,  195,  296,  324,  305, 1555,    0,  334,
-      349,  364,  374,  379, 1613,    0, 1613,  267,  295,  290,
-      322,  282,  329,  352,  332, 1613, 1552, 1591, 1613,  360,
-
-     1613,  385,  345, 1539, 1549, 1588,  358,  220,  249, 1543,
-      363,  370,  367,  373,  289, 1586,    0,  436,  370, 1530,
-     1538,  359, 1534, 1523, 1524,  364, 1540, 1523, 1532,  374,
-      200,  369, 1526,  383, 1514, 1570,  321, 1517, 1568, 1510,
-     1533, 1530, 1530, 1524,  368, 1517, 1510, 1515, 1509, 1520,
-     1505, 1504, 1518,  362, 1554, 1503,  382, 1515, 1518, 1502,
-      410,  409, 1514, 1515, 1513, 1495, 1500, 1496, 1488, 1505,
-     1497,    0,  413,  424,  438,  430,  439,  448, 1496, 1613,
-        0,  455, 1487, 1490, 1613,  443,  382, 1613, 1542, 1497,
-      453, 1540,  462, 1539,  441, 1538, 1613,  497, 1537,  470,
-
-     1498, 1493, 1492,  432, 1533, 1527, 1493, 1472, 1480, 1486,
-     1474, 1488, 1484, 1485, 1485, 1480, 1472, 1474, 1458, 1462,
-     1475, 1475, 1467, 1457, 1460, 1474, 1613, 1460, 1468, 1471,
-     1452, 1451, 1501, 1450, 1460, 1498,  486, 1459, 1447, 1458,
-     1494, 1498, 1451,    9, 1441, 1457, 1438, 1440, 1436, 1442,
-     1433, 1432, 1445, 1438, 1440, 1444, 1443, 1437,   80, 1444,
-     1439, 1431, 1437, 1437, 1418, 1434, 1427, 1434, 1422, 1415,
-     1429, 1428, 1431, 1413, 1421,  468, 1613, 1613,  477, 1613,
-     1613, 1408,    0,  449, 1410,  491,  478, 1464, 1613, 1417,
-      467, 1613, 1462, 1613, 1456,  538, 1613,  465, 1398, 1408,
-
-     1458, 1415,  486, 1613, 1413, 1455, 1410, 1407, 1408,  516,
-     1412, 1450, 1400, 1395, 1392, 1388, 1390, 1439, 1398, 1387,
-     1436, 1384,  518, 1397, 1397, 1380, 1381, 1394, 1381, 1391,
-     1386, 1393, 1388, 1373,  448, 1382, 1385, 1380, 1376, 1424,
-      490, 1613, 1371, 1370, 1363, 1365, 1369, 1358, 1365, 1370,
-      526, 1415, 1370,  486, 1367, 1371, 1369, 1358, 1358, 1370,
-     1352, 1344, 1345, 1366, 1348, 1360, 1359, 1345, 1357, 1356,
-     1355, 1396, 1395, 1394, 1338,  529, 1351, 1613, 1613, 1350,
-        0,  503, 1338, 1389, 1388, 1346, 1386, 1613, 1334, 1384,
-     1613,  536,  582,  516, 1383, 1325, 1613, 1341, 1340, 1327,
-
-     1326, 1613, 1328, 1325, 1337, 1333, 1321, 1323, 1613, 1329,
-     1314, 1316, 1327, 1325, 1320,  561, 1327, 1309, 1358, 1613,
-     1307, 1323, 1355, 1359, 1317, 1311, 1313, 1314, 1316, 1348,
-     1301, 1296, 1295, 1297, 1290, 1305, 1283, 1290, 1295, 1343,
-     1613, 1290, 1286, 1289, 1296, 1281, 1291, 1294, 1283, 1282,
-     1277, 1613, 1332, 1613, 1276, 1275, 1268, 1285, 1322, 1269,
-     1274, 1283, 1277, 1281,  563, 1316, 1280, 1260, 1263, 1262,
-     1270, 1258, 1314, 1256, 1613, 1613, 1613, 1261, 1613, 1271,
-     1305, 1267,    0, 1308, 1258, 1613, 1613, 1255, 1613, 1261,
-     1613,  542,  538,  570, 1613, 1299, 1246, 1245, 1252, 1245,
-
-     1257, 1256, 1240, 1255, 1285, 1252, 1288, 1234, 1236, 1248,
-     1248, 1247, 1613, 1232, 1229, 1243, 1235, 1241, 1232, 1240,
-     1613, 1225, 1236, 1240, 1222, 1236, 1234, 1217, 1211, 1216,
-     1213, 1228, 1229, 1226, 1267, 1224, 1613, 1210, 1212, 1258,
-     1257,  549, 1220, 1203, 1204, 1209, 1200, 1613, 1214, 1200,
-      603, 1192, 1213, 1210, 1202, 1245, 1199, 1243, 1613, 1191,
-     1189, 1203, 1206, 1238, 1237, 1184, 1235, 1613,  573, 1197,
-     1186, 1188, 1613, 1613, 1231, 1179, 1234,  555,  569,  539,
-     1193, 1227, 1226, 1225, 1179, 1169, 1222, 1184, 1174, 1219,
-     1182, 1164, 1172, 1174, 1178, 1213, 1217, 1174, 1173, 1174,
-
-     1167, 1156, 1169, 1172, 1167, 1162, 1167, 1164, 1163, 1166,
-     1161, 1202, 1201, 1145, 1141, 1149, 1197, 1613, 1196, 1145,
-     1137, 1152, 1139, 1613, 1139, 1148, 1147, 1147, 1131, 1186,
-     1129, 1142, 1613, 1134, 1126, 1135, 1128, 1139, 1116, 1120,
-     1171, 1118, 1116, 1127, 1167, 1114,  518,  560, 1108,  553,
-     1613, 1169, 1127, 1116, 1120, 1127, 1164, 1613, 1158,  577,
-     1111, 1119, 1111, 1102, 1105, 1101, 1118, 1113, 1101, 1112,
-     1096, 1098, 1150, 1096, 1110, 1091, 1141, 1096, 1613, 1104,
-     1102, 1093, 1102, 1098, 1139, 1081, 1081, 1094, 1093, 1078,
-     1133, 1075, 1076, 1613, 1613, 1090, 1087, 1090, 1613, 1613,
-
-     1089, 1074,  576, 1073, 1071, 1118, 1067, 1121, 1120, 1613,
-     1065, 1077, 1075, 1116, 1064, 1064, 1056, 1112, 1065, 1053,
-     1047, 1055,    3,   78,   74,  182,  202,  566,  205,  365,
-      371,  422, 1613,  525,  493,  508,  508, 1613,  583,  596,
-      556,  565,  579,  580,  575,  576,  572,  581,  576,  627,
-      634,  583, 1613,  596,  582,  598,  588,  600,  594,  639,
-      608,  592,  593, 1613,  611,  594,  596,  652,  597, 1613,
-      616,  596,  614,  653,  613,  603,  621,  605,  620,  612,
-      608,  626,  611, 1613, 1613,  619,  664,  619, 1613,  627,
-      622,  673, 1613,  624,  629,  623,  625,  637,  631,  629,
-
-      682,  628,  684,  685,  631, 1613,  637,  635,  634,  648,
-      649,  650,  666,  671,  645,  655,  641,  648,  653,  660,
-      701,  702,  651,  655, 1613,  650,  668,  665,  704,  655,
-      673,  674,  660,  668,  677,  657,  678,  718,  719, 1613,
-      674,  723,  724,  686,  688,  671,  673,  680,  731,  680,
-      695,  734,  686,  690,  688,  686,  739,  740,  692,  742,
-      738,  698, 1613,  703,  696,  705,  699,  694,  704,  700,
-     1613,  695, 1613, 1613,  696,  712,  713,  714,  696,  701,
-      708,  741,  732,  704,  763,  708,  723,  716,  720, 1613,
-     1613,  730,  728,  714,  715,  773,  728,  733,  720,  731,
-
-      723,  729,  725,  743,  744, 1613, 1613,  743, 1613,  745,
-     1613,  730,  749,  739,  790,  745,  787, 1613,  744,  794,
-     1613,  795,  744,  751,  793, 1613, 1613,  753, 1613,  744,
-      744,  747,  761,  748,  759,  806,  765,  803,  809,  810,
-      811,  812,  773,  757,  769,  759,  789,  818,  778, 1613,
-      820,  769,  765,  781,  786,  774,  826,  785, 1613,  787,
-      786,  788,  781,  790,  791,  788,  778,  780,  837,  786,
-      839,  784,  841, 1613,  779,  794,  844, 1613, 1613,  795,
-      805,  790,  806,  792,  852,  853,  799,  855,  814, 1613,
-      806,  808,  860, 1613, 1613, 1613, 1613,  812,  863,  814,
-
-      865,  847, 1613,  825, 1613,  812,  811,  814,  814,  815,
-      873, 1613,  818,  875,  830,  821,  836,  836,  839,  839,
-      836,  841, 1613,  833, 1613,  843, 1613,  844,  845,  842,
-     1613,  834,  840,  839,  851,  851, 1613, 1613,  890, 1613,
-      855,  840,  846, 1613,  861, 1613,  858, 1613,  877,  897,
-      903,  847,  905,  906,  861, 1613,  908, 1613,  848,  905,
-      870,  866,  908,  858,  863,  916,  874,  918,  919,  882,
-      871,  922,  866,  883,  868,  883,  867,  924,  925,  890,
-      886,  933,  905,  892, 1613,  936, 1613, 1613,  885, 1613,
-      938,  886,  935,  880,  885,  944,  894, 1613,  900, 1613,
-
-     1613,  891,  906, 1613,  944,  912,  905,  906,  915,  902,
-      904,  914,  907, 1613,  958,  905, 1613,  909, 1613,  912,
-      908,  907,  965,  920, 1613,  962,  924,  927,  970,  913,
-      915,  923,  913,  929,  923,  939,  978,  974, 1613,  939,
-      976,  940,  931,  938, 1613,  935,  940,  987,  932, 1613,
-      936,  948,  949,  992,  936,  937,  945, 1613,  956,  946,
-      945,  948,  960,  951,  960,  962, 1613, 1004,  964, 1006,
-     1007, 1613, 1003,  963,  968,  949, 1012,  971, 1014,  973,
-      974, 1017,  976, 1613,  981, 1613, 1613,  963,  969, 1022,
-      983, 1613,  969, 1613,  969,  971, 1613,  976,  971,  983,
-
-      979, 1613,  982,  986,  977, 1029,  978,  994,  987,  982,
-      997,  988,  995,  982,  997, 1044, 1003, 1046,  991, 1007,
-      998, 1012, 1008, 1613, 1052, 1613, 1053, 1054, 1011, 1010,
-     1011, 1613, 1613, 1613, 1058, 1002, 1018, 1613, 1056, 1007,
-     1006, 1008, 1019, 1066, 1017, 1613, 1026, 1069, 1613, 1613,
-     1075, 1080, 1085, 1090, 1095, 1100, 1105, 1108, 1082, 1087,
-     1089, 1102
+        0,    0,   71,    0,  137,    0,  139,    0,  150,    0,
+       74,    0,  155,  155,  208,  279,  339,    0,  150,  160,
+      169,  169,    0,  140,  182,  150,  124,  145,    0,    0,
+      122,  105,  120,    0,    0,    0,    0,  176,  142,  382,
+      182,    0,  199,  453,  504,    0,  322,  328,  145,  152,
+      174,  337,  509,  327,  523,  550,  550,  548,  611,  304,
+      237,  308,  537,  304,  305,  313,  309,  321,  324,  489,
+      531,  329,  528,  546,  315,  487,  634,  528,  526,  486,
+        0,    0,    0,    0,    0,    0,    0,  695,    0,    0,
+      594,  594,  737,  738,  542,  482,  490,  482,    0,  538,
+
+      793,    0,    0,    0,  859,  730,  835,  545,  637,  679,
+      838,  837,  861,  635,  833,  837,  836,  843,  850,  920,
+        0,    0,  991,  715,  626,  641,  636,  723,  635,  626,
+      631,  727,  648,  710,  722,  840,  729,  825,  720,  728,
+      710,  768,  872,  721,  774,  719,  744,  744,  831,  828,
+      837,  824,  819,  826,  822,  836,  825,  827,  842,  845,
+      883,  847,  852,  862,  867,  856, 1052, 1007,  870,  873,
+      873, 1003, 1010, 1008, 1003, 1021, 1016,    0,    0, 1038,
+     1046, 1053, 1012, 1020, 1028, 1024,    0,    0,    0, 1070,
+     1059, 1060, 1061, 1024,    0, 1068, 1077,    0, 1082, 1084,
+
+     1064, 1104, 1087, 1115, 1091,    0,    0,    0, 1128, 1117,
+     1080, 1081, 1083, 1084, 1078, 1082, 1123, 1120, 1095, 1135,
+     1092, 1106, 1098, 1113, 1111, 1114, 1116, 1114, 1109, 1119,
+     1114, 1117, 1119, 1122, 1117, 1117, 1123, 1138,    0, 1128,
+     1137, 1142, 1126, 1127, 1180, 1135, 1142, 1183, 1184, 1147,
+     1150, 1149, 1190, 1196, 1150, 1193, 1144, 1161, 1145, 1150,
+     1149, 1157, 1150, 1151, 1165, 1161, 1164, 1170, 1171, 1167,
+     1166, 1177, 1174, 1170, 1177, 1179, 1168, 1180, 1176, 1185,
+     1174, 1171, 1186, 1187, 1192, 1177, 1186, 1215,    0,    0,
+     1192,    0,    0, 1178, 1244, 1204, 1213, 1182, 1238, 1230,
+
+     1239,    0, 1195, 1222,    0, 1251,    0, 1250, 1281,    0,
+     1195, 1231, 1222, 1218, 1270, 1228, 1237,    0, 1228, 1274,
+     1230, 1231, 1235, 1297, 1241, 1282, 1245, 1242, 1248, 1246,
+     1250, 1302, 1264, 1253, 1304, 1255, 1312, 1270, 1272, 1258,
+     1261, 1276, 1266, 1284, 1281, 1290, 1287, 1275, 1278, 1287,
+     1292, 1289, 1288, 1338, 1295,    0, 1294, 1289, 1284, 1288,
+     1295, 1294, 1297, 1303, 1351, 1352, 1308, 1312, 1309, 1315,
+     1315, 1308, 1310, 1323, 1309, 1303, 1306, 1328, 1314, 1327,
+     1328, 1317, 1330, 1331, 1332, 1376, 1377, 1378, 1324, 1380,
+     1339,    0,    0, 1340, 1378, 1354, 1350, 1337, 1390, 1391,
+
+     1350, 1399,    0, 1349, 1401,    0, 1377, 1416, 1347, 1405,
+     1351, 1351,    0, 1368, 1370, 1361, 1362,    0, 1366, 1365,
+     1384, 1385, 1377, 1388,    0, 1395, 1383, 1387, 1399, 1399,
+     1396, 1444, 1406, 1391, 1442,    0, 1393, 1411, 1446, 1452,
+     1411, 1407, 1417, 1420, 1424, 1459, 1414, 1411, 1412, 1416,
+     1411, 1427, 1411, 1417, 1424, 1475,    0, 1424, 1422, 1427,
+     1435, 1423, 1434, 1439, 1431, 1432, 1429,    0, 1486,    0,
+     1432, 1433, 1428, 1446, 1486, 1435, 1442, 1452, 1448, 1454,
+     1497, 1493, 1458, 1441, 1446, 1448, 1457, 1448, 1506, 1450,
+        0,    0,    0, 1457,    0, 1468, 1505, 1468, 1504, 1515,
+
+     1516, 1468,    0,    0, 1467,    0, 1480,    0, 1500, 1499,
+     1465, 1529,    0, 1478, 1526, 1475, 1476, 1486, 1481, 1494,
+     1495, 1482, 1498, 1531, 1499, 1544, 1492, 1496, 1510, 1513,
+     1514,    0, 1502, 1548, 1516, 1511, 1518, 1512, 1521,    0,
+     1509, 1521, 1527, 1512, 1527, 1527, 1513, 1509, 1516, 1515,
+     1531, 1534, 1533, 1577, 1535,    0, 1524, 1528, 1576, 1577,
+     1583, 1542, 1528, 1531, 1538, 1531,    0, 1546, 1535, 1591,
+     1530, 1552, 1552, 1548, 1593, 1549, 1595,    0, 1545, 1545,
+     1560, 1565, 1601, 1602, 1551, 1604,    0, 1610, 1568, 1560,
+     1564,    0, 1640,    0,    0, 1609, 1559, 1616, 1676, 1688,
+
+     1571, 1559, 1578, 1617, 1618, 1619, 1575, 1569, 1624, 1587,
+     1580, 1627, 1591, 1650, 1660, 1663, 1669, 1707, 1713, 1671,
+     1672, 1675, 1670, 1662, 1676, 1681, 1678, 1675, 1682, 1681,
+     1682, 1687, 1684, 1728, 1729, 1675, 1674, 1685, 1735,    0,
+     1736, 1687, 1681, 1697, 1740,    0, 1689, 1699, 1700, 1702,
+     1689, 1746, 1691, 1705,    0, 1700, 1694, 1704, 1700, 1712,
+     1692, 1698, 1751, 1700, 1700, 1712, 1755, 1704, 1715, 1716,
+     1702, 1714,    0, 1766, 1725, 1719, 1725, 1734, 1774,    0,
+     1770, 1747, 1726, 1773, 1728, 1737, 1724, 1729, 1727, 1745,
+     1742, 1735, 1747, 1734, 1738, 1792, 1741, 1756, 1741, 1793,
+
+     1750,    0, 1759, 1759, 1753, 1764, 1762, 1807, 1751, 1754,
+     1768, 1769, 1757, 1814, 1758, 1762,    0,    0, 1777, 1776,
+     1781,    0,    0, 1782, 1770, 1784, 1772, 1772, 1821, 1773,
+     1829, 1830,    0, 1777, 1790, 1790, 1834, 1784, 1786, 1780,
+     1838, 1799, 1784, 1780, 1790, 1794, 1804, 1800, 1795, 1797,
+     1808, 1799, 1852, 1814, 1792,    0, 1850, 1799, 1813, 1813,
+        0, 1832, 1843, 1822, 1819, 1823, 1827, 1820, 1816, 1817,
+     1814, 1823, 1822, 1869, 1875, 1824,    0, 1836, 1822, 1837,
+     1828, 1839, 1834, 1879, 1848, 1833, 1834,    0, 1851, 1836,
+     1838, 1894, 1839,    0, 1857, 1841, 1855, 1896, 1855, 1846,
+
+     1863, 1848, 1865, 1855, 1851, 1869, 1855,    0,    0, 1863,
+     1908, 1863,    0, 1870, 1866, 1917,    0, 1868, 1870, 1874,
+     1870, 1871, 1882, 1877, 1875, 1928, 1874, 1930, 1931, 1877,
+        0, 1883, 1881, 1880, 1893, 1894, 1895, 1911, 1916, 1891,
+     1900, 1938, 1888, 1895, 1899, 1906, 1948, 1949, 1899, 1903,
+        0, 1898, 1915, 1912, 1951, 1902, 1919, 1920, 1907, 1914,
+     1923, 1904, 1924, 1965, 1968,    0, 1922, 1970, 1971, 1932,
+     1934, 1918, 1920, 1927, 1978, 1927, 1941, 1981, 1933, 1936,
+     1935, 1933, 1986, 1987, 1939, 1989, 1985, 1944,    0, 1949,
+     1946, 1944, 1952, 1947, 1942, 1951, 1948,    0, 1943,    0,
+
+        0, 1944, 1959, 1960, 1961, 1961, 1949, 1956, 1989, 1979,
+     1952, 2011, 1957, 1959, 1973, 1966, 1970,    0,    0, 1979,
+     1977, 1964, 1966, 2024, 1978, 1983, 1971, 1982, 1975, 1981,
+     1978, 1995, 1996,    0,    0, 1995,    0, 1997,    0, 1983,
+     2001, 1992, 2042, 1996, 2039,    0, 1996, 2046,    0, 2047,
+     1996, 2002, 2045,    0,    0, 2004,    0, 1996, 1996, 1999,
+     2014, 2013, 2001, 2011, 2059, 2017, 2056, 2062, 2063, 2064,
+     2065, 2025, 2010, 2021, 2012, 2041, 2071, 2030,    0, 2030,
+     2074, 2027, 2019, 2034, 2039, 2029, 2081, 2039,    0, 2041,
+     2040, 2042, 2036, 2044, 2046, 2043, 2034, 2036, 2093, 2042,
+
+     2095, 2040, 2098,    0, 2036, 2051, 2101,    0,    0, 2051,
+     2060, 2046, 2061, 2049, 2109, 2110, 2068, 2058, 2114, 2072,
+        0, 2065, 2068, 2119,    0,    0,    0,    0, 2071, 2121,
+     2072, 2123, 2105,    0, 2082, 2085,    0, 2071, 2070, 2073,
+     2073, 2074, 2132,    0, 2077, 2134, 2088, 2080, 2094, 2094,
+     2097, 2097, 2094, 2099,    0, 2092,    0, 2101,    0, 2102,
+     2103, 2108, 2102,    0, 2094, 2100, 2099, 2110, 2110,    0,
+        0, 2150, 2151,    0, 2115, 2101, 2107,    0, 2121,    0,
+     2118,    0, 2137, 2158, 2115, 2165, 2109, 2167, 2168, 2122,
+        0, 2170,    0, 2110, 2167, 2131, 2127, 2170, 2120, 2125,
+
+     2178, 2135, 2180, 2181, 2143, 2126, 2134, 2185, 2129, 2145,
+     2132, 2146, 2142, 2142, 2188, 2189, 2153, 2149, 2197, 2168,
+     2155, 2161,    0, 2201,    0,    0, 2151,    0, 2204, 2152,
+     2201, 2146, 2151, 2210, 2160,    0, 2165,    0,    0, 2157,
+     2171, 2172,    0, 2211, 2178, 2171, 2172, 2177, 2182, 2170,
+     2172, 2181, 2176,    0, 2227, 2174, 2179,    0, 2179,    0,
+     2182, 2177, 2176, 2235, 2189,    0, 2232, 2193, 2196, 2240,
+     2241, 2184, 2186, 2194, 2184, 2207, 2200, 2195, 2210, 2250,
+     2246,    0, 2210, 2214, 2249, 2212, 2204, 2210,    0, 2208,
+     2212, 2260, 2205,    0,    0, 2209, 2220, 2221, 2265, 2210,
+
+     2210, 2211, 2219,    0, 2229, 2220, 2215, 2220, 2223, 2234,
+     2226, 2234, 2236,    0, 2279, 2238, 2281, 2282,    0, 2240,
+     2279, 2238, 2243, 2233, 2288, 2242, 2247, 2291, 2249, 2250,
+     2294, 2253,    0, 2258,    0,    0, 2242, 2242, 2248, 2301,
+     2261,    0, 2251, 2249,    0, 2249, 2251,    0, 2256, 2251,
+     2309, 2263, 2260,    0, 2263, 2262, 2267, 2259, 2311, 2260,
+     2275,    0, 2269, 2264, 2278, 2322, 2271, 2277, 2265, 2279,
+     2327, 2285, 2329, 2274,    0, 2289, 2281, 2294, 2290,    0,
+     2335,    0, 2336, 2337, 2293, 2292, 2293,    0,    0,    0,
+     2341, 2285, 2300,    0, 2339, 2290, 2289, 2291, 2301, 2349,
+
+     2300,    0, 2308, 2352,    0, 2359
     } ;
 
-static const flex_int16_t yy_def[1263] =
+static const flex_int16_t yy_def[1307] =
     {   0,
-     1251, 1251, 1252, 1252, 1251, 1251, 1251, 1251, 1251, 1251,
-     1250, 1250, 1250, 1250, 1250, 1253, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1254,
-     1250, 1250, 1250, 1255,   15, 1250,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1256,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1253, 1250,
-     1250, 1250, 1250, 1250, 1250, 1257, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1254, 1250, 1255,
-
-     1250, 1250,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1258,   45, 1256,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1257, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1259,   45,   45,   45, 1250,   45,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45, 1258, 1250, 1256,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1250,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1260,   45,   45,   45,   45,   45, 1250,   45,
-       45, 1250,   45, 1250,   45, 1256, 1250,   45,   45,   45,
-
-       45,   45,   45, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1250,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1250, 1250, 1250,
-     1261,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-     1250,   45, 1256,   45,   45,   45, 1250,   45,   45,   45,
-
-       45, 1250,   45,   45,   45,   45,   45,   45, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1250,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1250,   45, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1250, 1250, 1250,   45, 1250,   45,
-       45, 1250, 1262,   45,   45, 1250, 1250,   45, 1250,   45,
-     1250,   45,   45,   45, 1250,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45,   45,   45,   45,   45,   45,   45,
-     1250,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1250,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-       45,   45, 1250, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-       45,   45,   45, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1250,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250, 1250,   45,   45,   45, 1250, 1250,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1306,    1,    1,    3,    1,    5,    5,    7,    7,    9,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,   17,   19,
+     1306,   19, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+       26,   27,   28, 1306, 1306, 1306,   13, 1306, 1306, 1306,
+     1306,   13, 1306, 1306,   15, 1306,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1306,   47,
+       48,   45,   45,   45,   52,   45,   45,   45,   45,   45,
+       45,   55,   45,   45,   45,   45,   45,   56,   57,   45,
+       16,   20,   17,   25,   22,   20, 1306, 1306,   22, 1306,
+       25, 1306, 1306, 1306, 1306,   93,   94,   95, 1306, 1306,
+
+     1306, 1306,   44, 1306, 1306,   45,   45,   45,   45,   45,
+       47,   45,   45,   45,   45,   45,   45,  116,   55, 1306,
+       45,   45, 1306,  106,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45,   45,   45,   45, 1250,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250,   45,   45,   45,   45,   45, 1250,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250, 1250,   45,   45,   45, 1250,   45,
-       45,   45, 1250,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1250,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1250,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45,   45,   45,   45,   45,   45,   45,
-     1250,   45, 1250, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-     1250,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1250, 1250,   45, 1250,   45,
-     1250,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-     1250,   45,   45,   45,   45, 1250, 1250,   45, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45,   45, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250,   45,   45,   45, 1250, 1250,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1250,
-       45,   45,   45, 1250, 1250, 1250, 1250,   45,   45,   45,
-
-       45,   45, 1250,   45, 1250,   45,   45,   45,   45,   45,
-       45, 1250,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1250,   45, 1250,   45, 1250,   45,   45,   45,
-     1250,   45,   45,   45,   45,   45, 1250, 1250,   45, 1250,
-       45,   45,   45, 1250,   45, 1250,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45, 1250,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1250,   45, 1250, 1250,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45, 1250,   45, 1250,
-
-     1250,   45,   45, 1250,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250,   45,   45, 1250,   45, 1250,   45,
-       45,   45,   45,   45, 1250,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1250,   45,
-       45,   45,   45,   45, 1250,   45,   45,   45,   45, 1250,
-       45,   45,   45,   45,   45,   45,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45,   45, 1250,   45,   45,   45,
-       45, 1250,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250,   45, 1250, 1250,   45,   45,   45,
-       45, 1250,   45, 1250,   45,   45, 1250,   45,   45,   45,
-
-       45, 1250,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1250,   45, 1250,   45,   45,   45,   45,
-       45, 1250, 1250, 1250,   45,   45,   45, 1250,   45,   45,
-       45,   45,   45,   45,   45, 1250,   45,   45, 1250,    0,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250
+       45,   45,  160,   45,   45,   45,  137,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   88,   92, 1306,
+     1306, 1306,  180,  181,  182, 1306,  101, 1306,   44, 1306,
+       52,  191,  192,  193, 1306,   53,  107, 1306,  194,  199,
+
+      119,  199,  201,  199,  197,  120, 1306,  120,  123,  199,
+      191,  200,  212,  213,  214,  193,  199,  214,  212,  218,
+      220,  214,  194,  212,  221,  225,  212,  214,  221,  226,
+      230,  231,  214,  225,  213,  193,  194,  212, 1306,  232,
+      214,  212,  232,  232,  218,  240,  200,  218,  232,  246,
+      250,  214,  218,  199,  230,  218,  246,  212,  232,  194,
+      232,  221,  193,  193,  250,  221,  230,  225,  225,  230,
+      221,  212,  214,  221,  214,  225,  251,  214,  213,  277,
+      240,  193,  214,  214,  212,  246,  230, 1306, 1306, 1306,
+      288, 1306, 1306, 1306, 1306,  280,  246,  246,  280,  214,
+
+      199, 1306,  230,  297, 1306,  199, 1306,  218,  209, 1306,
+      296,  296,  200,  240,  199,  214,  246, 1306,  250,  199,
+      200,  230,  200,  218,  226,  199,  221,  194,  246,  220,
+      246,  218,  312,  246,  218,  232,  240,  214,  225,  193,
+      246,  225,  194,  214,  230,  212,  214,  232,  251,  230,
+      214,  230,  221,  199,  250, 1306,  333,  357,  220,  246,
+      357,  361,  357,  230,  232,  199,  200,  230,  230,  225,
+      214,  357,  240,  212,  246,  312,  362,  212,  246,  214,
+      214,  246,  214,  214,  214,  199,  199,  199,  246,  218,
+      225, 1306, 1306, 1306, 1306,  232,  312,  357,  199,  199,
+
+      225,  199, 1306,  240,  199, 1306,  240,  309,  396,  199,
+      246,  193, 1306,  280,  280,  357,  357, 1306,  221,  240,
+      212,  225,  357,  221, 1306,  214,  232,  194,  225,  214,
+      230,  390,  212,  246,  218, 1306,  246,  212,  218,  199,
+      225,  230,  250,  225,  212,  218,  240,  246,  246,  357,
+      220,  214,  362,  246,  221,  199, 1306,  357,  246,  240,
+      250,  193,  230,  214,  357,  357,  232, 1306,  199, 1306,
+      246,  246,  231,  250,  218,  193,  240,  225,  230,  225,
+      432,  218,  280,  277,  246,  246,  230,  193,  199,  193,
+     1306, 1306, 1306,  240, 1306,  280,  218, 1306, 1306,  199,
+
+      199,  221, 1306, 1306,  240, 1306,  200, 1306,  357,  304,
+      453,  481, 1306,  357,  218,  193,  193,  221,  246,  214,
+      214,  193,  225,  453,  214,  218,  220,  246,  214,  225,
+      225, 1306,  246,  524,  214,  221,  214,  361,  225, 1306,
+      246,  250,  212,  246,  280,  225,  534,  312,  232,  220,
+      214,  280,  214,  199,  214, 1306,  246,  357,  218,  218,
+      199,  225,  534,  246,  221,  534, 1306,  214,  246,  512,
+      312,  280,  214,  221,  218,  361,  218, 1306,  232,  534,
+      214,  212,  218,  218,  534,  218, 1306,  524,  214,  357,
+      221, 1306, 1306, 1306, 1306,  218,  232,  588,  534,  300,
+
+      232,  220,  280,  218,  218,  218,  361,  277,  218,  214,
+      240,  218,  225,  220,  221,  230,  225,  218,  598,  214,
+      214,  280,  230,  232,  214,  212,  214,  230,  280,  214,
+      214,  212,  214,  598,  598,  246,  220,  221,  598, 1306,
+      598,  361,  534,  225,  598, 1306,  357,  214,  214,  225,
+      232,  598,  232,  214, 1306,  221,  232,  230,  357,  280,
+      312,  534,  218,  534,  220,  230,  218,  534,  645,  669,
+      312,  534, 1306,  598,  225,  240,  230,  645,  598, 1306,
+      678,  396,  240,  681,  240,  684,  534,  645,  232,  678,
+      684,  645,  686,  232,  645,  598,  645,  678,  232,  681,
+
+      686, 1306,  280,  693,  686,  693,  684,  598,  534,  232,
+      684,  684,  232,  598,  534,  246, 1306, 1306,  280,  684,
+      678, 1306, 1306,  678,  357,  684,  357,  645,  681,  246,
+      598,  598, 1306,  251,  693,  684,  598,  240,  361,  534,
+      598,  706,  534,  312,  645,  361,  280,  742,  645,  357,
+      693,  357,  598,  678,  312, 1306,  681,  534,  250,  742,
+     1306,  645,  684,  280,  760,  693,  678,  742,  357,  357,
+      534,  686,  765,  681,  598,  357, 1306,  693,  534,  684,
+      645,  684,  686,  681,  678,  773,  773, 1306,  678,  773,
+      773,  790,  790, 1306,  678,  790,  684,  681,  742,  534,
+
+      796,  534,  801,  357,  534,  801,  790, 1306, 1306,  686,
+      681,  765, 1306,  760,  361,  598, 1306,  361,  686,  742,
+      645,  645,  684,  686,  357,  598,  773,  598,  598,  773,
+     1306,  361,  645,  773,  684,  684,  684,  773,  765,  686,
+      693,  681,  790,  361,  742,  801,  598,  598,  357,  686,
+     1306,  773,  678,  684,  681,  773,  678,  678,  645,  742,
+      678,  796,  706,  598,  598, 1306,  742,  681,  684,  706,
+      678,  790,  790,  361,  598,  357,  678,  598,  686,  742,
+      686,  357,  598,  598,  686,  598,  681,  742, 1306,  684,
+      742,  361,  684,  686,  773,  742,  765, 1306,  534, 1306,
+
+     1306,  534,  684,  684,  684,  803,  534,  765,  763,  599,
+      906,  598,  773,  790,  684,  765,  911, 1306, 1306,  706,
+      684,  534,  534,  598,  742,  684,  790,  742,  773,  361,
+      773,  678,  678, 1306, 1306,  693, 1306,  801, 1306,  790,
+      678,  686,  598,  742,  681, 1306,  686,  598, 1306,  598,
+      357,  742,  681, 1306, 1306,  742, 1306,  790,  534,  773,
+      801,  684,  790,  742,  598,  684,  790,  598,  598,  598,
+      598,  801,  534,  742,  534,  790,  598,  693, 1306,  684,
+      869,  917,  534,  684,  678,  765,  598,  684, 1306,  693,
+      803,  684,  982,  684,  684,  742,  534,  790,  598,  982,
+
+      598,  790,  598, 1306,  453,  773,  598, 1306, 1306,  765,
+      684,  911,  803,  911,  598,  598,  684,  773,  598,  684,
+     1306,  765,  993,  598, 1306, 1306, 1306, 1306,  686,  598,
+      993,  598,  909, 1306,  684,  801, 1306,  790,  911,  790,
+      534,  534,  598, 1306,  790,  598,  742,  790,  684,  803,
+      693,  684,  742,  684, 1306,  765, 1306,  684, 1306,  684,
+      684,  678,  742, 1306,  790,  765,  645,  684,  803, 1306,
+     1306,  681,  681, 1306,  693,  534,  982, 1306,  678, 1306,
+      684, 1306,  839,  681,  686,  598,  534,  598,  598,  742,
+     1306,  598, 1306,  906,  681,  693,  742,  681,  790,  982,
+
+      598,  803,  598,  598,  678,  534,  993,  598,  534,  693,
+      534,  803,  686,  993,  681,  681,  693,  742,  598,  910,
+      803,  678, 1306,  598, 1306, 1306,  982, 1306,  868,  645,
+      681,  906,  534,  598,  765, 1306,  742, 1306, 1306,  790,
+      684,  684, 1306,  681,  678,  742,  742,  684,  678,  982,
+      765,  684,  993, 1306,  598, 1114,  993, 1306,  765, 1306,
+      686,  773,  534,  598,  742, 1306,  681,  760,  684,  598,
+      598,  911,  534,  993,  906,  678,  742,  645,  678,  598,
+      681, 1306,  693,  678,  681,  684,  982,  742, 1306,  993,
+      742,  598,  790, 1306, 1306,  645,  684,  684,  598,  790,
+
+      534,  534,  993, 1306,  801,  765,  534,  645,  765,  801,
+      993,  684,  693, 1306,  598,  693,  598,  598, 1306,  684,
+      681,  742,  684, 1156,  598,  742,  684,  598,  684,  684,
+      598,  684, 1306,  678, 1306, 1306,  790,  534,  982,  598,
+      801, 1306,  982,  773, 1306,  790,  773, 1306,  765,  534,
+      598,  742,  765, 1306,  686,  765,  742,  790,  681,  534,
+      684, 1306,  993,  790,  684,  598,  982,  742, 1114,  742,
+      598,  684,  598,  790, 1306,  693,  765,  678,  803, 1306,
+      598, 1306,  598,  598,  760,  742,  742, 1306, 1306, 1306,
+      598,  534,  684, 1306,  681,  773,  534,  790,  742,  598,
+
+      993, 1306,  684,  598, 1306,    0
     } ;
 
-static const flex_int16_t yy_nxt[1685] =
+static const flex_int16_t yy_nxt[2431] =
     {   0,
-     1250,   13,   14,   13, 1250,   15,   16, 1250,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  344,
-       37,   14,   37,   86,   25,   26,   38, 1250, 1250,   27,
-       37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
-      115,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40,  798,   13,
-       14,   13,   33,   40,  115,   91,   92,  345,   90,   34,
-       35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  108,   39,   90,   25,   26,   13,   14,   13,   27,
-
-       39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
-       42,   30,   82,  107,   41,  111,   93,   25,   31,  108,
-      130,  137,   88,  799,   88,  800,   32,   89,   89,   89,
-      131,  138,   33,  139,  360,   82,  107,  361,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
+       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   12,
+       27,   12,   12,   12,   12,   28,   12,   12,   12,   12,
+       29,   12,   30,   12,   12,   12,   12,   12,   25,   31,
+       12,   12,   12,   12,   12,   12,   32,   12,   12,   12,
+       12,   12,   33,   12,   12,   12,   12,   12,   12,   34,
+       35,   36,   37, 1306,   37,   36,   36,   36,   38,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   12,   12,   40,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   42,   43,   42,   90,
+       94,   12,   12,   85,   85,   85,   96,   12,   97,   41,
+       93, 1306,   12,   86,   86,   86,   87,   12,   95,   12,
+       98,   88,   89,   89,   89,   12,   12,   94,   99,   39,
+       91,   12,   91,   12,   93,   92,   92,   92,  100,   12,
+
+      102,   43,  108,  109,  110,   95,   12,   12,   44,   44,
+       44,   45,   45,   46,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   47,   48,
+       49,   50,   51,   52,   45,   45,   53,   54,   55,   45,
+       45,   45,   45,   56,   57,   45,   58,   45,   45,   59,
+       45,   45,   60,   61,   62,   63,   64,   65,   66,   67,
+       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
+       78,   79,   80,   58,   45,   45,   45,   45,   45,   81,
+       81,  126,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       82,  106,   83,   83,   83,  107,  113,  111,  124,  138,
+      136,  139,  127,   84,  125,  128,  140,  129,  143,  130,
+      137,  141,  146,  154,  142,  155,  106,  144,  165,  145,
+      107,  111,  101,  101,  114,  101,  101,   84,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  103,  103,  103,  103,  103,  104,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  105,  103,  103,  103,  103,  103,
+
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,   45,   45,   45,   45,   45,   45,
+      177,  166,   45,   45,   45,  167,  183,  147,  148,   45,
+       45,  149,   45,  112,  184,  185,  150,  115,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   48,   49,   50,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   45,   60,   61,   62,   63,
-       64,   65,   66,   52,   67,   68,   69,   70,   71,   72,
-
-       73,   74,   75,   76,   77,   78,   57,   45,   45,   45,
-       45,   45,   80,  103,   81,   81,   81,   80,  109,   83,
-       83,   83,  101,  114,   80,   82,   83,   83,   83,  121,
-       82,  145,  122,  112,  123,  146,  124,   82,  160,  103,
-      801,  103,  161,  113,  134,  217,  114,  110,   82,  135,
-      187,  107,  136,   82,  188,  147,  112,  102,  218,  802,
-       82,   45,  805,   45,   45,   45,   45,  119,   45,   45,
-       45,  113,  117,  120,  107,   45,   45,  187,   45,   45,
-       89,   89,   89,  189,   45,  132,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   89,   89,
-       89,   45,  125,  195,  111,   45,  126,  175,  173,  127,
-      128,  141,  142,   45,  150,  143,  227,   45,  114,   45,
-      118,  144,  129,  148,  151,  149,  195,  111,  154,  152,
-      153,  155,  156,  162,  173,  175,  112,   84,   84,   84,
-      174,  114,  157,  163,  164,  158,  113,  173,   82,  165,
-       80,  169,   81,   81,   81,  101,  170,  175,  228,  112,
-      806,  166,   88,   82,   88,  167,  174,   89,   89,   89,
-      174,   82,  182,  176,  113,   80,  186,   83,   83,   83,
-      100,  168,   84,   84,   84,  178,   82,  100,   82,  191,
-
-      102,  192,  193,   82,  194,  203,  177,  182,  208,  209,
-      182,  288,  186,  236,  807,  204,  219,  214,  210,  215,
-      256,   82,  246,  247,  199,  100,   82,  191,  192,  100,
-      193,  194,  220,  100,  237,  200,  216,  222,  288,  250,
-      223,  100,  251,  252,  224,  100,  276,  100,  181,  198,
-      198,  198,  277,  257,  258,  259,  198,  198,  198,  198,
-      198,  198,  278,  276,  260,  264,  261,  277,  262,  265,
-      295,  263,  278,  266,  276,  284,  287,  291,  277,  198,
-      198,  198,  198,  198,  198,  278,  293,  382,  302,  808,
-      284,  279,  378,  280,  303,  281,  335,  295,  284,  390,
-
-      291,  378,  387,  382,  287,  384,  385,  435,  436,  293,
-      296,  296,  296,  298,  386,  378,  382,  296,  296,  296,
-      296,  296,  296,  420,  379,  387,  406,  390,  421,  399,
-      407,  452,  394,  456,  479,  809,  484,  457,  442,  480,
-      296,  296,  296,  296,  296,  296,  400,  336,  443,  484,
-      337,  393,  393,  393,  624,  810,  811,  812,  393,  393,
-      393,  393,  393,  393,  484,  492,  513,  493,  559,  726,
-      579,  514,  578,  560,  422,  574,  727,  494,  651,  423,
-      580,  393,  393,  393,  393,  393,  393,  453,  652,  659,
-      661,  625,  492,  660,  493,   45,   45,   45,  579,  578,
-
-      662,  815,   45,   45,   45,   45,   45,   45,  633,  731,
-      740,  728,  803,  634,  813,  732,  660,  659,  729,  778,
-      814,  816,  817,  779,  804,   45,   45,   45,   45,   45,
-       45,  818,  819,  820,  821,  822,  823,  824,  740,  825,
-      826,  813,  827,  814,  828,  829,  830,  831,  832,  833,
-      635,  834,  835,  836,  837,  838,  839,  840,  843,  844,
-      845,  846,  841,  847,  848,  849,  850,  851,  852,  853,
-      854,  855,  857,  858,  859,  860,  861,  862,  863,  864,
-      865,  866,  856,  867,  868,  869,  870,  871,  872,  873,
-      874,  875,  876,  877,  878,  879,  880,  881,  882,  884,
-
-      883,  885,  886,  887,  888,  889,  890,  891,  892,  893,
-      894,  895,  896,  842,  897,  898,  899,  900,  901,  902,
-      903,  904,  905,  906,  907,  908,  882,  883,  909,  911,
-      913,  914,  915,  910,  916,  917,  918,  919,  920,  921,
-      922,  923,  924,  925,  926,  927,  928,  929,  930,  931,
-      932,  933,  934,  935,  936,  937,  938,  939,  940,  941,
-      942,  943,  944,  945,  946,  947,  948,  949,  950,  951,
-      952,  912,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  962,  963,  964,  965,  966,  967,  968,  947,  969,
-      970,  971,  972,  973,  948,  974,  975,  976,  977,  978,
-
-      979,  980,  981,  982,  983,  984,  985,  986,  987,  988,
-      989,  990,  991,  992,  994,  995,  996,  997,  998,  999,
-     1000, 1001, 1002, 1003, 1004, 1005, 1007, 1008, 1009, 1010,
-     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
-     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1031,
-     1002, 1032, 1033, 1034, 1035, 1036, 1030, 1037, 1038, 1039,
-     1040, 1041, 1042, 1043,  993, 1044, 1045, 1006, 1046, 1047,
-     1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
-     1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
-     1068, 1069, 1070, 1071, 1049, 1072, 1073, 1074, 1075, 1076,
-
-     1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
-     1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
-     1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
-     1107, 1108, 1109, 1083, 1110, 1111, 1112, 1113, 1114, 1115,
-     1116, 1117, 1118, 1119, 1121, 1122, 1123, 1124, 1120, 1125,
-     1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
-     1136, 1137, 1138, 1139, 1140, 1141, 1142, 1115, 1143, 1144,
-     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
-     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
-     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
-
-     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
-     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
-     1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
-     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
-     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
-     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
-     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
-     1245, 1246, 1247, 1248, 1249,   12,   12,   12,   12,   12,
-       36,   36,   36,   36,   36,   79,  283,   79,   79,   79,
-       98,  381,   98,  483,   98,  100,  100,  100,  100,  100,
-
-      116,  116,  116,  116,  116,  172,  100,  172,  172,  172,
-      196,  196,  196,  797,  796,  795,  794,  793,  792,  791,
-      790,  789,  788,  787,  786,  785,  784,  783,  782,  781,
-      780,  777,  776,  775,  774,  773,  772,  771,  770,  769,
-      768,  767,  766,  765,  764,  763,  762,  761,  760,  759,
-      758,  757,  756,  755,  754,  753,  752,  751,  750,  749,
-      748,  747,  746,  745,  744,  743,  742,  741,  739,  738,
-      737,  736,  735,  734,  733,  730,  725,  724,  723,  722,
-      721,  720,  719,  718,  717,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
-
-      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
-      691,  690,  689,  688,  687,  686,  685,  684,  683,  682,
-      681,  680,  679,  678,  677,  676,  675,  674,  673,  672,
-      671,  670,  669,  668,  667,  666,  665,  664,  663,  658,
-      657,  656,  655,  654,  653,  650,  649,  648,  647,  646,
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  636,
-      632,  631,  630,  629,  628,  627,  626,  623,  622,  621,
-      620,  619,  618,  617,  616,  615,  614,  613,  612,  611,
-      610,  609,  608,  607,  606,  605,  604,  603,  602,  601,
-      600,  599,  598,  597,  596,  595,  594,  593,  592,  591,
-
-      590,  589,  588,  587,  586,  585,  584,  583,  582,  581,
-      577,  576,  575,  574,  573,  572,  571,  570,  569,  568,
-      567,  566,  565,  564,  563,  562,  561,  558,  557,  556,
-      555,  554,  553,  552,  551,  550,  549,  548,  547,  546,
-      545,  544,  543,  542,  541,  540,  539,  538,  537,  536,
-      535,  534,  533,  532,  531,  530,  529,  528,  527,  526,
-      525,  524,  523,  522,  521,  520,  519,  518,  517,  516,
-      515,  512,  511,  510,  509,  508,  507,  506,  505,  504,
-      503,  502,  501,  500,  499,  498,  497,  496,  495,  491,
-      490,  489,  488,  487,  486,  485,  482,  481,  478,  477,
-
-      476,  475,  474,  473,  472,  471,  470,  469,  468,  467,
-      466,  465,  464,  463,  462,  461,  460,  459,  458,  455,
-      454,  451,  450,  449,  448,  447,  446,  445,  444,  441,
-      440,  439,  438,  437,  434,  433,  432,  431,  430,  429,
-      428,  427,  426,  425,  424,  419,  418,  417,  416,  415,
-      414,  413,  412,  411,  410,  409,  408,  405,  404,  403,
-      402,  401,  398,  397,  396,  395,  392,  391,  389,  388,
-      383,  380,  377,  376,  375,  374,  373,  372,  371,  370,
-      369,  368,  367,  366,  365,  364,  363,  362,  359,  358,
-      357,  356,  355,  354,  353,  352,  351,  350,  349,  348,
-
-      347,  346,  343,  342,  341,  340,  339,  338,  334,  333,
-      332,  331,  330,  329,  328,  327,  326,  325,  324,  323,
-      322,  321,  320,  319,  318,  317,  316,  315,  314,  313,
-      312,  311,  310,  309,  308,  307,  306,  305,  304,  301,
-      300,  299,  297,  197,  294,  292,  290,  289,  286,  285,
-      282,  275,  274,  273,  272,  271,  270,  269,  268,  267,
-      255,  254,  253,  249,  248,  245,  244,  243,  242,  241,
-      240,  239,  238,  235,  234,  233,  232,  231,  230,  229,
-      226,  225,  221,  213,  212,  211,  207,  206,  205,  202,
-      201,  197,  190,  185,  184,  183,  180,  179,  171,  159,
-
-      140,  133,  106,  105,  104,   43,   99,   97,   96,   87,
-       43, 1250,   11, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250
+      112,  115,  116,  118,  119,  151,  172,  156,  182,  152,
+      173,  131,  175,  117,  186,  132,  157,  176,  133,  134,
+      160,  158,  159,  161,  162,  174,  116,  118,  153,  119,
+
+      135,  193, 1306,  163, 1306,  182,  164,  179,  179,  179,
+      117,  120,  120,  120,  120,  120,  121,  120,  120,  120,
+      120,  120,  120,  122,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  122,  120,  120,  120,  122,  120,  120,  120,
+      122,  120,  120,  120,  120,  120,  120,  122,  120,  120,
+      120,  122,  120,  122,  123,  120,  120,  120,  120,  120,
+      120,  120,  168,  194,  195,  200,  212,  213,  214,  217,
+      218,  169,  170,  219,  223,  178,  178,  171,  178,  178,
+
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  180,  181,  191,  210,
+      215,  224,  220,  221,  225,  229,  233,  237,  238,  216,
+      211,  222,  234,  241,  242,  235,  243,  230,  244,  236,
+      245,  180,  181,  187,  187,  191,  187,  187,  188,  187,
+
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  189,  192,  198,  196,  197,  202,
+      201,  189,  203,  231,  205,  204,  246,  239,  247,  250,
+      251,  252,  253,  248,  226,  254,  227,  255,  232,  256,
+      257,  192,  196,  260,  197,  202,  199,  201,  205,  203,
+
+      189,  204,  228,  249,  189,  258,  259,  261,  189,  262,
+      265,  266,  263,  264,  267,  189,  279,  280,  281,  189,
+      240,  189,  190,  206,  206,  207,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+
+      208,  208,  208,  208,  209,  209,  209,  208,  208,  208,
+      208,  209,  209,  209,  209,  209,  209,  208,  208,  208,
+      208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+      208,  208,  208,  208,  208,  209,  209,  209,  209,  209,
+      209,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+      208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
+      208,  208,  268,  276,  282,  283,  284,  277,  285,  286,
+      287,  278,  288,  291,  292,  289,  293,  290,  294,  296,
+      297,   45,  299,  295,  295,  295,   45,  302,  304,   46,
+      295,  295,  295,  295,  295,  295,  269,  270,  271,  288,
+
+      289,  290,  300,  296,  297,   45,  272,  301,  273,  305,
+      274,  306,  304,  275,  295,  295,  295,  295,  295,  295,
+      307,  308,  310,  298,  311,  312,  315,   45,  318,  300,
+      319,   45,  314,  301,  303,  306,  313,   45,  316,  320,
+       45,  309,  309,  309,  317,   45,  322,  308,  309,  309,
+      309,  309,  309,  309,  323,   45,  324,  325,  326,  327,
+      328,   45,  329,  330,   45,   45,   45,  334,   45,  335,
+      336,  331,  309,  309,  309,  309,  309,  309,  333,  337,
+      332,  338,  339,   45,  340,  341,  342,  343,  344,   45,
+      345,   45,  347,  348,  349,  346,  352,  354,  321,   45,
+
+      355,  356,  357,  358,  360,  361,  362,   45,  363,  353,
+      364,  365,  366,  367,  368,  369,  370,  371,  372,  373,
+      374,  376,  377,  375,  378,  379,  380,   45,  382,  383,
+      385,  384,  381,  386,  387,  388,  389,  390,  391,  392,
+      393,  394,  398,  396,  403,  350,  397,  404,  351,   45,
+       45,  359,  399,  400,  402,  405,  406,  395,  395,  395,
+      407,  401,  409,  392,  395,  395,  395,  395,  395,  395,
+       45,  396,  411,  397,  412,  413,  414,  417,  402,  418,
+      419,  415,  405,  420,   45,  421,  424,  425,  395,  395,
+      395,  395,  395,  395,  408,  408,  408,  416,  410,  426,
+
+      427,  408,  408,  408,  408,  408,  408,  422,  428,  429,
+      430,  423,  431,  433,  434,  432,  435,  436,  440,  441,
+      442,  443,  437,  444,  445,  408,  408,  408,  408,  408,
+      408,   45,  446,  447,  448,  449,  450,  451,  452,  453,
+      454,  455,  456,  457,  458,   45,  461,  462,  463,   45,
+      464,  460,   45,  459,  466,  467,  468,  470,  471,  465,
+      472,  474,  475,  476,  473,  477,  478,  479,  438,  480,
+      481,  482,  483,  439,  484,  485,  486,  487,  488,  489,
+      490,  491,  492,  493,  494,  495,  497,  498,  500,  501,
+      496,  499,  499,  499,  502,  503,  504,  505,  499,  499,
+
+      499,  499,  499,  499,  506,  507,  508,  509,  512,  510,
+      513,  514,  469,  515,  516,  500,  517,  501,  518,  519,
+      520,  521,  499,  499,  499,  499,  499,  499,  522,  511,
+      511,  511,  523,  509,  524,  510,  511,  511,  511,  511,
+      511,  511,  525,  526,  527,  528,  529,  530,  531,  532,
+      534,  535,  536,  537,  533,  538,  539,  540,  541,  542,
+      511,  511,  511,  511,  511,  511,  543,  544,  545,  546,
+      547,  548,  549,  550,  551,  552,   45,  554,  555,  553,
+      556,  557,  558,  559,  560,  561,  562,  563,  564,  565,
+      566,  567,  568,  569,  570,  571,  572,  573,  574,  575,
+
+      576,  577,  578,  580,  581,  582,  583,  579,  584,  585,
+      586,  587,  588,  589,  590,  591,  592,  593,  593,  593,
+      594,  595,  596,  597,  593,  593,  593,  593,  593,  593,
+      598,  599,  600,   45,  594,  602,  603,  604,  605,  601,
+      606,  607,  608,  609,  610,  611,  612,  613,  593,  593,
+      593,  593,  593,  593,  614,  615,  616,  599,  617,  600,
+      618,  619,  620,   45,  622,  623,  624,  625,  626,  627,
+      628,  629,  630,  631,  632,  633,  634,  635,  636,  637,
+      638,  639,  640,  641,  642,  643,  644,  645,  646,  648,
+      649,  650,  651,  652,  653,  654,  655,  658,  659,   45,
+
+      660,  656,  661,  662,  663,  664,  665,  666,  667,  668,
+      621,  669,  670,  671,  672,  673,  675,  676,  677,  678,
+      679,  680,  685,  683,  686,  674,  647,  687,  688,  689,
+      690,   45,  684,  691,  692,  693,  694,  695,  696,  657,
+      103,  103,  103,  103,  103,  104,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  105,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  681,  682,  697,  698,  699,  700,  701,  702,  703,
+      704,  705,  706,  707,  708,  709,  710,  711,  712,  713,
+      714,  715,  716,  717,  718,  719,  682,  720,  681,  721,
+      722,  723,  724,  725,  726,   46,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  738,  739,  740,  741,
+      742,  743,  744,  745,  746,  747,  748,  749,  751,  753,
+      754,  756,  757,  750,  752,  758,  755,  759,  760,  761,
+      762,  763,  764,   45,  766,   45,  768,  769,  770,  771,
+      772,  767,   45,  773,  774,  775,  776,  777,  727,  778,
+
+      779,   45,  780,  781,  782,  783,  784,  785,  763,  786,
+      787,   45,  788,  789,   45,  790,  791,  792,  793,  794,
+      795,  765,  796,  797,  798,  799,  800,  801,  802,  804,
+      805,  806,  803,  807,  808,  809,  810,  811,  812,  813,
+      814,  815,  816,  817,   45,  819,  820,  821,  822,  823,
+      824,  818,  825,  826,  827,  828,  830,  831,  832,  833,
+      834,  835,  836,  837,  838,   45,  829,  839,  840,   45,
+      842,  843,  844,  845,  846,  841,  847,  848,   45,  850,
+      851,  852,  849,  853,  854,  855,  856,  857,  858,  859,
+      838,  839,  860,  861,  862,  863,   45,  864,  865,  866,
+
+      869,  870,   45,  872,  867,  871,  873,  874,  875,  876,
+      877,   45,  879,  880,  878,  881,  883,  884,  885,  886,
+      887,  888,  889,  890,  891,  882,  892,   45,  893,  894,
+      895,  896,  897,  898,  899,  900,  901,  902,  903,  904,
+      905,  906,  907,  908,  909,  911,  910,  912,  913,  914,
+      915,  916,  917,  918,  919,  868,  920,  921,  922,  923,
+      924,  925,  926,  927,  928,  929,  930,  931,  932,  933,
+      934,  909,  910,  935,  936,  937,  939,  941,  942,  943,
+      938,  944,  945,  946,  947,  948,  949,  950,  951,  952,
+      953,  954,  955,  956,  957,  958,  959,  960,  961,  962,
+
+      963,  964,  965,  966,  967,  968,  969,  970,  971,  972,
+       45,  974,  975,  976,  977,  978,  979,  980,   45,  940,
+      981,  982,  983,  984,  985,  986,  987,  973,  988,  989,
+      990,  991,  992,   45,  993,  994,  995,  976,  996,  997,
+      998,  977,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1025, 1026, 1027,
+     1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
+       45, 1040, 1041, 1042, 1039, 1043, 1044, 1045, 1046, 1047,
+     1048, 1049, 1050,   45, 1051, 1052, 1053, 1054, 1055, 1056,
+
+     1057, 1058, 1033, 1059, 1060, 1061, 1064, 1065, 1066, 1067,
+     1068, 1062, 1069, 1063, 1070, 1071, 1072, 1024, 1073, 1074,
+     1075, 1076, 1038, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+     1104, 1105, 1106, 1083, 1107, 1108, 1109, 1110, 1111, 1112,
+     1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+     1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132,
+     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+     1143, 1144, 1145, 1120, 1146, 1147, 1148,   45, 1150, 1151,
+
+     1152, 1153, 1154, 1155, 1156, 1157, 1158, 1149, 1159, 1160,
+     1162, 1163, 1164, 1165, 1161, 1166, 1167, 1168, 1169, 1170,
+     1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+     1155, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,   45,
+     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+     1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+     1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+     1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
+     1239, 1240,   45, 1242, 1243, 1244, 1245, 1246, 1247, 1248,
+
+     1241, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+     1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,   11, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306
     } ;
 
-static const flex_int16_t yy_chk[1685] =
+static const flex_int16_t yy_chk[2431] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  244,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  723,    8,
-        8,    8,    1,    8,   57,   27,   28,  244,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-       62,   66,   25,  724,   25,  725,    2,   25,   25,   25,
-       62,   66,    2,   66,  259,   20,   51,  259,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    3,    3,   11,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    5,    5,    7,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    9,   13,   14,   13,   24,
+       27,    5,    5,   19,   19,   19,   31,    5,   32,    9,
+       26,   20,    5,   20,   20,   20,   21,    5,   28,    5,
+       33,   21,   22,   22,   22,    5,    5,   27,   38,    5,
+       25,    7,   25,    5,   26,   25,   25,   25,   39,    5,
+
+       41,   43,   49,   50,   51,   28,    5,    5,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   53,   19,
-       19,   19,   44,   56,   22,   17,   22,   22,   22,   60,
-       19,   69,   60,   55,   60,   69,   60,   22,   74,   47,
-      726,   59,   74,   55,   65,  131,   56,   53,   17,   65,
-      108,   63,   65,   19,  109,   69,   55,   44,  131,  727,
-       22,   45,  729,   45,   45,   45,   45,   59,   45,   45,
-       45,   55,   58,   59,   63,   45,   45,  108,   45,   58,
-       88,   88,   88,  109,   45,   63,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   16,
+       16,   61,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       17,   47,   17,   17,   17,   48,   54,   52,   60,   65,
+       64,   66,   62,   17,   60,   62,   67,   62,   68,   62,
+       64,   67,   69,   72,   67,   72,   47,   68,   75,   68,
+       48,   52,   40,   40,   54,   40,   40,   17,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   45,   45,   45,   45,   45,   45,
+       80,   76,   45,   45,   45,   76,   96,   70,   70,   45,
+       45,   70,   45,   53,   97,   98,   70,   55,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   58,   89,   89,
-       89,   58,   61,  115,   70,   58,   61,   92,   90,   61,
-       61,   68,   68,   58,   71,   68,  137,   58,   77,   58,
-       58,   68,   61,   70,   71,   70,  115,   70,   72,   71,
-       71,   72,   72,   75,   90,   92,   76,   80,   80,   80,
-       91,   77,   72,   75,   75,   72,   76,   93,   80,   75,
-       81,   77,   81,   81,   81,  100,   77,   95,  137,   76,
-      730,   76,   82,   81,   82,   76,   91,   82,   82,   82,
-       94,   80,  103,   93,   76,   83,  107,   83,   83,   83,
-      102,   76,   84,   84,   84,   95,   81,  102,   83,  111,
-
-      100,  112,  113,   84,  114,  122,   94,  119,  126,  126,
-      103,  187,  107,  145,  731,  122,  132,  130,  126,  130,
-      161,   83,  154,  154,  119,  102,   84,  111,  112,  102,
-      113,  114,  132,  102,  145,  119,  130,  134,  187,  157,
-      134,  102,  157,  157,  134,  102,  173,  102,  102,  118,
-      118,  118,  174,  161,  161,  161,  118,  118,  118,  118,
-      118,  118,  175,  176,  161,  162,  161,  177,  161,  162,
-      195,  161,  178,  162,  173,  182,  186,  191,  174,  118,
-      118,  118,  118,  118,  118,  175,  193,  284,  204,  732,
-      200,  176,  276,  177,  204,  178,  237,  195,  182,  291,
-
-      191,  279,  287,  298,  186,  286,  286,  335,  335,  193,
-      198,  198,  198,  200,  286,  276,  284,  198,  198,  198,
-      198,  198,  198,  323,  279,  287,  310,  291,  323,  303,
-      310,  351,  298,  354,  376,  734,  382,  354,  341,  376,
-      198,  198,  198,  198,  198,  198,  303,  237,  341,  394,
-      237,  296,  296,  296,  542,  735,  736,  737,  296,  296,
-      296,  296,  296,  296,  382,  392,  416,  392,  465,  647,
-      493,  416,  492,  465,  323,  494,  647,  394,  569,  323,
-      494,  296,  296,  296,  296,  296,  296,  351,  569,  578,
-      580,  542,  392,  579,  392,  393,  393,  393,  493,  492,
-
-      580,  741,  393,  393,  393,  393,  393,  393,  551,  650,
-      660,  648,  728,  551,  739,  650,  579,  578,  648,  703,
-      740,  742,  743,  703,  728,  393,  393,  393,  393,  393,
-      393,  744,  745,  746,  747,  748,  749,  750,  660,  751,
-      752,  739,  754,  740,  755,  756,  757,  758,  759,  760,
-      551,  761,  762,  763,  765,  766,  767,  768,  769,  771,
-      772,  773,  768,  774,  775,  776,  777,  778,  779,  780,
-      781,  782,  783,  786,  787,  788,  790,  791,  792,  794,
-      795,  796,  782,  797,  798,  799,  800,  801,  802,  803,
-      804,  805,  807,  808,  809,  810,  811,  812,  813,  815,
-
-      814,  816,  817,  818,  819,  820,  821,  822,  823,  824,
-      826,  827,  828,  768,  829,  830,  831,  832,  833,  834,
-      835,  836,  837,  838,  839,  841,  813,  814,  842,  843,
-      844,  845,  846,  842,  847,  848,  849,  850,  851,  852,
-      853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
-      864,  865,  866,  867,  868,  869,  870,  872,  875,  876,
-      877,  878,  879,  880,  881,  882,  883,  884,  885,  886,
-      887,  843,  888,  889,  892,  893,  894,  895,  896,  897,
-      898,  899,  900,  901,  902,  903,  904,  905,  882,  908,
-      910,  912,  913,  914,  883,  915,  916,  917,  919,  920,
-
-      922,  923,  924,  925,  928,  930,  931,  932,  933,  934,
-      935,  936,  937,  938,  939,  940,  941,  942,  943,  944,
-      945,  946,  947,  948,  949,  951,  952,  953,  954,  955,
-      956,  957,  958,  960,  961,  962,  963,  964,  965,  966,
-      967,  968,  969,  970,  971,  972,  973,  975,  976,  977,
-      947,  980,  981,  982,  983,  984,  976,  985,  986,  987,
-      988,  989,  991,  992,  938,  993,  998,  951,  999, 1000,
-     1001, 1002, 1004, 1006, 1007, 1008, 1009, 1010, 1011, 1013,
-     1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1024,
-     1026, 1028, 1029, 1030, 1002, 1032, 1033, 1034, 1035, 1036,
-
-     1039, 1041, 1042, 1043, 1045, 1047, 1049, 1050, 1051, 1052,
-     1053, 1054, 1055, 1057, 1059, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-     1075, 1076, 1077, 1049, 1078, 1079, 1080, 1081, 1082, 1083,
-     1084, 1086, 1089, 1091, 1092, 1093, 1094, 1095, 1091, 1096,
-     1097, 1099, 1102, 1103, 1105, 1106, 1107, 1108, 1109, 1110,
-     1111, 1112, 1113, 1115, 1116, 1118, 1120, 1083, 1121, 1122,
-     1123, 1124, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
-     1134, 1135, 1136, 1137, 1138, 1140, 1141, 1142, 1143, 1144,
-     1146, 1147, 1148, 1149, 1151, 1152, 1153, 1154, 1155, 1156,
-
-     1157, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1168,
-     1169, 1170, 1171, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
-     1180, 1181, 1182, 1183, 1185, 1188, 1189, 1190, 1191, 1193,
-     1195, 1196, 1198, 1199, 1200, 1201, 1203, 1204, 1205, 1206,
-     1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
-     1217, 1218, 1219, 1220, 1221, 1222, 1223, 1225, 1227, 1228,
-     1229, 1230, 1231, 1235, 1236, 1237, 1239, 1240, 1241, 1242,
-     1243, 1244, 1245, 1247, 1248, 1251, 1251, 1251, 1251, 1251,
-     1252, 1252, 1252, 1252, 1252, 1253, 1259, 1253, 1253, 1253,
-     1254, 1260, 1254, 1261, 1254, 1255, 1255, 1255, 1255, 1255,
-
-     1256, 1256, 1256, 1256, 1256, 1257, 1262, 1257, 1257, 1257,
-     1258, 1258, 1258,  722,  721,  720,  719,  718,  717,  716,
-      715,  714,  713,  712,  711,  709,  708,  707,  706,  705,
-      704,  702,  701,  698,  697,  696,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
-      678,  677,  676,  675,  674,  673,  672,  671,  670,  669,
-      668,  667,  666,  665,  664,  663,  662,  661,  659,  657,
-      656,  655,  654,  653,  652,  649,  646,  645,  644,  643,
-      642,  641,  640,  639,  638,  637,  636,  635,  634,  632,
-      631,  630,  629,  628,  627,  626,  625,  623,  622,  621,
-
-      620,  619,  617,  616,  615,  614,  613,  612,  611,  610,
-      609,  608,  607,  606,  605,  604,  603,  602,  601,  600,
-      599,  598,  597,  596,  595,  594,  593,  592,  591,  590,
-      589,  588,  587,  586,  585,  584,  583,  582,  581,  577,
-      576,  575,  572,  571,  570,  567,  566,  565,  564,  563,
-      562,  561,  560,  558,  557,  556,  555,  554,  553,  552,
-      550,  549,  547,  546,  545,  544,  543,  541,  540,  539,
-      538,  536,  535,  534,  533,  532,  531,  530,  529,  528,
-      527,  526,  525,  524,  523,  522,  520,  519,  518,  517,
-      516,  515,  514,  512,  511,  510,  509,  508,  507,  506,
-
-      505,  504,  503,  502,  501,  500,  499,  498,  497,  496,
-      490,  488,  485,  484,  482,  481,  480,  478,  474,  473,
-      472,  471,  470,  469,  468,  467,  466,  464,  463,  462,
-      461,  460,  459,  458,  457,  456,  455,  453,  451,  450,
-      449,  448,  447,  446,  445,  444,  443,  442,  440,  439,
-      438,  437,  436,  435,  434,  433,  432,  431,  430,  429,
-      428,  427,  426,  425,  424,  423,  422,  421,  419,  418,
-      417,  415,  414,  413,  412,  411,  410,  408,  407,  406,
-      405,  404,  403,  401,  400,  399,  398,  396,  395,  390,
-      389,  387,  386,  385,  384,  383,  380,  377,  375,  374,
-
-      373,  372,  371,  370,  369,  368,  367,  366,  365,  364,
-      363,  362,  361,  360,  359,  358,  357,  356,  355,  353,
-      352,  350,  349,  348,  347,  346,  345,  344,  343,  340,
-      339,  338,  337,  336,  334,  333,  332,  331,  330,  329,
-      328,  327,  326,  325,  324,  322,  321,  320,  319,  318,
-      317,  316,  315,  314,  313,  312,  311,  309,  308,  307,
-      306,  305,  302,  301,  300,  299,  295,  293,  290,  288,
-      285,  282,  275,  274,  273,  272,  271,  270,  269,  268,
-      267,  266,  265,  264,  263,  262,  261,  260,  258,  257,
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-
-      246,  245,  243,  242,  241,  240,  239,  238,  236,  235,
-      234,  233,  232,  231,  230,  229,  228,  226,  225,  224,
-      223,  222,  221,  220,  219,  218,  217,  216,  215,  214,
-      213,  212,  211,  210,  209,  208,  207,  206,  205,  203,
-      202,  201,  199,  196,  194,  192,  190,  189,  184,  183,
-      179,  171,  170,  169,  168,  167,  166,  165,  164,  163,
-      160,  159,  158,  156,  155,  153,  152,  151,  150,  149,
-      148,  147,  146,  144,  143,  142,  141,  140,  139,  138,
-      136,  135,  133,  129,  128,  127,  125,  124,  123,  121,
-      120,  116,  110,  106,  105,  104,   98,   97,   78,   73,
-
-       67,   64,   50,   49,   48,   43,   41,   39,   38,   24,
-       14,   11, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-     1250, 1250, 1250, 1250
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       53,   55,   56,   57,   58,   71,   78,   73,   95,   71,
+       78,   63,   79,   56,  100,   63,   73,   79,   63,   63,
+       74,   73,   73,   74,   74,   78,   56,   57,   71,   58,
+
+       63,  108,   91,   74,   91,   95,   74,   92,   92,   92,
+       56,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   77,  109,  110,  114,  125,  126,  127,  129,
+      130,   77,   77,  131,  133,   88,   88,   77,   88,   88,
+
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   93,   94,  106,  124,
+      128,  134,  132,  132,  135,  137,  139,  141,  142,  128,
+      124,  132,  140,  144,  145,  140,  146,  137,  147,  140,
+      148,   93,   94,  101,  101,  106,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  105,  107,  113,  111,  112,  116,
+      115,  105,  117,  138,  119,  118,  149,  143,  150,  152,
+      153,  154,  155,  151,  136,  156,  136,  157,  138,  158,
+      159,  107,  111,  161,  112,  116,  113,  115,  119,  117,
+
+      105,  118,  136,  151,  105,  160,  160,  162,  105,  163,
+      164,  165,  163,  163,  166,  105,  169,  170,  171,  105,
+      143,  105,  105,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  167,  168,  172,  173,  174,  168,  175,  176,
+      177,  168,  180,  183,  184,  181,  185,  182,  186,  191,
+      192,  193,  194,  190,  190,  190,  194,  199,  201,  200,
+      190,  190,  190,  190,  190,  190,  167,  167,  167,  180,
+
+      181,  182,  196,  191,  192,  193,  167,  197,  167,  202,
+      167,  203,  201,  167,  190,  190,  190,  190,  190,  190,
+      204,  205,  210,  193,  211,  212,  215,  213,  217,  196,
+      218,  212,  214,  197,  200,  203,  213,  214,  216,  219,
+      199,  209,  209,  209,  216,  220,  221,  205,  209,  209,
+      209,  209,  209,  209,  222,  221,  223,  224,  225,  226,
+      227,  226,  228,  229,  230,  225,  231,  233,  218,  234,
+      235,  230,  209,  209,  209,  209,  209,  209,  232,  236,
+      231,  237,  238,  232,  240,  241,  242,  243,  244,  240,
+      245,  246,  247,  248,  249,  246,  250,  252,  220,  251,
+
+      253,  254,  255,  256,  257,  258,  259,  250,  260,  251,
+      261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+      271,  272,  273,  271,  274,  275,  276,  277,  278,  279,
+      281,  280,  277,  282,  283,  284,  285,  286,  287,  288,
+      291,  294,  298,  296,  301,  249,  297,  303,  249,  280,
+      296,  256,  299,  299,  300,  304,  306,  295,  295,  295,
+      308,  299,  311,  288,  295,  295,  295,  295,  295,  295,
+      312,  296,  313,  297,  314,  315,  316,  319,  300,  320,
+      321,  317,  304,  322,  299,  323,  325,  326,  295,  295,
+      295,  295,  295,  295,  309,  309,  309,  317,  312,  327,
+
+      328,  309,  309,  309,  309,  309,  309,  324,  329,  330,
+      331,  324,  332,  334,  335,  333,  336,  337,  338,  339,
+      340,  341,  337,  342,  343,  309,  309,  309,  309,  309,
+      309,  333,  344,  345,  346,  347,  348,  349,  349,  350,
+      351,  352,  353,  354,  355,  357,  358,  359,  360,  362,
+      361,  357,  361,  355,  363,  364,  365,  366,  367,  362,
+      368,  369,  370,  371,  368,  372,  373,  374,  337,  375,
+      376,  377,  378,  337,  379,  380,  381,  382,  383,  384,
+      385,  386,  387,  388,  389,  390,  391,  394,  396,  397,
+      390,  395,  395,  395,  398,  399,  400,  401,  395,  395,
+
+      395,  395,  395,  395,  402,  404,  405,  407,  409,  407,
+      410,  411,  365,  412,  414,  396,  415,  397,  416,  417,
+      419,  420,  395,  395,  395,  395,  395,  395,  421,  408,
+      408,  408,  422,  407,  423,  407,  408,  408,  408,  408,
+      408,  408,  424,  426,  427,  428,  429,  430,  431,  432,
+      433,  434,  435,  437,  432,  438,  439,  440,  441,  442,
+      408,  408,  408,  408,  408,  408,  443,  444,  445,  446,
+      447,  448,  449,  450,  451,  452,  453,  454,  455,  453,
+      456,  458,  459,  460,  461,  462,  463,  464,  465,  466,
+      467,  469,  471,  472,  473,  474,  475,  476,  477,  478,
+
+      479,  480,  481,  482,  483,  484,  485,  481,  486,  487,
+      488,  489,  490,  494,  496,  497,  498,  499,  499,  499,
+      500,  501,  502,  505,  499,  499,  499,  499,  499,  499,
+      507,  509,  510,  511,  512,  514,  515,  516,  517,  512,
+      518,  519,  520,  521,  522,  523,  524,  525,  499,  499,
+      499,  499,  499,  499,  526,  527,  528,  509,  529,  510,
+      530,  531,  533,  534,  535,  536,  537,  538,  539,  541,
+      542,  543,  544,  545,  546,  547,  548,  549,  550,  551,
+      552,  553,  554,  555,  557,  558,  559,  560,  561,  562,
+      563,  564,  565,  566,  568,  569,  570,  571,  572,  524,
+
+      573,  570,  574,  575,  576,  577,  579,  580,  581,  582,
+      534,  583,  584,  585,  586,  588,  589,  590,  591,  596,
+      597,  598,  602,  601,  603,  588,  561,  604,  605,  606,
+      607,  598,  601,  608,  609,  610,  611,  612,  613,  570,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+
+      593,  593,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  599,  600,  614,  615,  616,  617,  618,  619,  620,
+      621,  622,  623,  624,  625,  626,  627,  628,  629,  630,
+      631,  632,  633,  634,  635,  636,  600,  637,  599,  638,
+      639,  641,  642,  643,  644,  645,  647,  648,  649,  650,
+      651,  652,  653,  654,  656,  657,  658,  659,  660,  661,
+      662,  663,  664,  665,  666,  667,  668,  669,  670,  671,
+      672,  674,  675,  669,  670,  676,  672,  677,  678,  679,
+      681,  682,  683,  684,  685,  686,  687,  688,  689,  690,
+      691,  686,  678,  692,  693,  694,  695,  696,  645,  697,
+
+      698,  693,  699,  700,  701,  703,  704,  705,  682,  706,
+      707,  706,  708,  709,  681,  710,  711,  712,  713,  714,
+      715,  684,  716,  719,  720,  721,  724,  725,  726,  727,
+      728,  729,  726,  730,  731,  732,  734,  735,  736,  737,
+      738,  739,  740,  741,  742,  743,  743,  744,  745,  746,
+      747,  742,  748,  749,  750,  751,  752,  753,  754,  755,
+      757,  758,  759,  760,  762,  760,  751,  763,  764,  765,
+      766,  767,  768,  769,  770,  765,  771,  772,  773,  774,
+      775,  776,  773,  778,  779,  780,  781,  782,  783,  784,
+      762,  763,  785,  786,  787,  789,  790,  790,  791,  792,
+
+      793,  795,  796,  797,  792,  796,  798,  799,  800,  801,
+      802,  803,  804,  805,  803,  806,  807,  810,  811,  812,
+      814,  815,  816,  818,  819,  806,  820,  801,  821,  822,
+      823,  824,  825,  826,  827,  828,  829,  830,  832,  833,
+      834,  835,  836,  837,  838,  840,  839,  841,  842,  843,
+      844,  845,  846,  847,  848,  792,  849,  850,  852,  853,
+      854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
+      864,  838,  839,  865,  867,  868,  869,  870,  871,  872,
+      868,  873,  874,  875,  876,  877,  878,  879,  880,  881,
+      882,  883,  884,  885,  886,  887,  888,  890,  891,  892,
+
+      893,  894,  895,  896,  897,  899,  902,  903,  904,  905,
+      906,  907,  908,  909,  910,  911,  912,  913,  911,  869,
+      914,  915,  916,  917,  920,  921,  922,  906,  923,  924,
+      925,  926,  927,  917,  928,  929,  930,  909,  931,  932,
+      933,  910,  936,  938,  940,  941,  942,  943,  944,  945,
+      947,  948,  950,  951,  952,  953,  956,  958,  959,  960,
+      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
+      971,  972,  973,  974,  975,  976,  977,  978,  980,  981,
+      982,  983,  984,  985,  982,  986,  987,  988,  990,  991,
+      992,  993,  994,  993,  995,  996,  997,  998,  999, 1000,
+
+     1001, 1002,  976, 1003, 1005, 1006, 1007, 1010, 1011, 1012,
+     1013, 1006, 1014, 1006, 1015, 1016, 1017,  967, 1018, 1019,
+     1020, 1022,  981, 1023, 1024, 1029, 1030, 1031, 1032, 1033,
+     1035, 1036, 1038, 1039, 1040, 1041, 1042, 1043, 1045, 1046,
+     1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1056, 1058,
+     1060, 1061, 1062, 1033, 1063, 1065, 1066, 1067, 1068, 1069,
+     1072, 1073, 1075, 1076, 1077, 1079, 1081, 1083, 1084, 1085,
+     1086, 1087, 1088, 1089, 1090, 1092, 1094, 1095, 1096, 1097,
+     1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+     1108, 1109, 1110, 1083, 1111, 1112, 1113, 1114, 1115, 1116,
+
+     1117, 1118, 1119, 1120, 1121, 1122, 1124, 1114, 1127, 1129,
+     1130, 1131, 1132, 1133, 1129, 1134, 1135, 1137, 1140, 1141,
+     1142, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
+     1120, 1153, 1155, 1156, 1157, 1159, 1161, 1162, 1163, 1156,
+     1164, 1165, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1183, 1184, 1185,
+     1186, 1187, 1188, 1190, 1191, 1192, 1193, 1196, 1197, 1198,
+     1199, 1200, 1201, 1202, 1203, 1205, 1206, 1207, 1208, 1209,
+     1210, 1211, 1212, 1213, 1215, 1216, 1217, 1218, 1220, 1221,
+     1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+
+     1224, 1232, 1234, 1237, 1238, 1239, 1240, 1241, 1243, 1244,
+     1246, 1247, 1249, 1250, 1251, 1252, 1253, 1255, 1256, 1257,
+     1258, 1259, 1260, 1261, 1263, 1264, 1265, 1266, 1267, 1268,
+     1269, 1270, 1271, 1272, 1273, 1274, 1276, 1277, 1278, 1279,
+     1281, 1283, 1284, 1285, 1286, 1287, 1291, 1292, 1293, 1295,
+     1296, 1297, 1298, 1299, 1300, 1301, 1303, 1304, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306
     } ;
 
+
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
 
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[160] =
+static const flex_int16_t yy_rule_linenum[164] =
     {   0,
       135,  137,  139,  144,  145,  150,  151,  152,  164,  167,
       172,  179,  188,  197,  206,  215,  224,  233,  242,  251,
       260,  269,  278,  287,  296,  305,  315,  325,  335,  345,
-      355,  365,  375,  385,  395,  404,  413,  422,  431,  440,
-      449,  458,  470,  479,  488,  497,  506,  516,  526,  536,
-      546,  557,  567,  577,  587,  597,  607,  617,  627,  637,
-      646,  655,  664,  679,  694,  703,  712,  721,  730,  739,
-      748,  757,  766,  775,  784,  794,  803,  812,  821,  830,
-      839,  848,  857,  866,  875,  884,  894,  903,  912,  921,
-      930,  939,  948,  957,  966,  975,  985,  994, 1003, 1013,
-
-     1023, 1033, 1042, 1051, 1060, 1071, 1081, 1090, 1100, 1110,
-     1119, 1128, 1137, 1146, 1155, 1164, 1174, 1183, 1192, 1201,
-     1210, 1219, 1228, 1237, 1246, 1255, 1264, 1273, 1282, 1291,
-     1300, 1309, 1318, 1327, 1336, 1345, 1354, 1363, 1372, 1381,
-     1390, 1400, 1498, 1503, 1508, 1513, 1514, 1515, 1516, 1517,
-     1518, 1520, 1538, 1551, 1556, 1560, 1562, 1564, 1566
+      355,  365,  375,  385,  395,  405,  414,  423,  432,  441,
+      450,  459,  468,  480,  489,  498,  507,  516,  526,  536,
+      546,  556,  567,  577,  587,  597,  607,  617,  627,  637,
+      647,  656,  665,  674,  689,  704,  713,  722,  731,  740,
+      749,  758,  767,  776,  785,  794,  804,  813,  822,  831,
+      840,  849,  858,  867,  876,  885,  894,  904,  913,  922,
+      931,  940,  949,  958,  967,  976,  985,  995, 1004, 1013,
+
+     1023, 1033, 1043, 1052, 1061, 1070, 1081, 1091, 1100, 1110,
+     1120, 1129, 1138, 1147, 1156, 1165, 1174, 1184, 1193, 1202,
+     1211, 1220, 1229, 1238, 1247, 1256, 1265, 1274, 1283, 1292,
+     1301, 1310, 1319, 1328, 1337, 1346, 1355, 1364, 1373, 1382,
+     1391, 1400, 1409, 1418, 1427, 1437, 1535, 1540, 1545, 1550,
+     1551, 1552, 1553, 1554, 1555, 1557, 1575, 1588, 1593, 1597,
+     1599, 1601, 1603
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1620,7 +1803,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1623 "dhcp6_lexer.cc"
+#line 1806 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1646,8 +1829,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1649 "dhcp6_lexer.cc"
-#line 1650 "dhcp6_lexer.cc"
+#line 1832 "dhcp6_lexer.cc"
+#line 1833 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1971,7 +2154,7 @@ YY_DECL
     }
 
 
-#line 1974 "dhcp6_lexer.cc"
+#line 2157 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2000,13 +2183,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1251 )
+				if ( yy_current_state >= 1307 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1250 );
+		while ( yy_current_state != 1306 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2025,13 +2208,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 160 )
+			else if ( yy_act < 164 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 160 )
+			else if ( yy_act == 164 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 161 )
+			else if ( yy_act == 165 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2347,8 +2530,8 @@ YY_RULE_SETUP
 #line 335 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
-    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
+    if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
+        return isc::dhcp::Dhcp6Parser::make_BINARY(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2374,7 +2557,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_NEVER(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_WHEN_PRESENT(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2400,7 +2583,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_ALWAYS(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_NEVER(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2413,7 +2596,7 @@ YY_RULE_SETUP
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
-        return isc::dhcp::Dhcp6Parser::make_WHEN_NOT_PRESENT(driver.loc_);
+        return isc::dhcp::Dhcp6Parser::make_ALWAYS(driver.loc_);
     }
     std::string tmp(yytext+1);
     tmp.resize(tmp.size() - 1);
@@ -2423,6 +2606,19 @@ YY_RULE_SETUP
 case 35:
 YY_RULE_SETUP
 #line 395 "dhcp6_lexer.ll"
+{
+    /* dhcp-ddns value keywords are case insensitive */
+    if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
+        return isc::dhcp::Dhcp6Parser::make_WHEN_NOT_PRESENT(driver.loc_);
+    }
+    std::string tmp(yytext+1);
+    tmp.resize(tmp.size() - 1);
+    return isc::dhcp::Dhcp6Parser::make_STRING(tmp, driver.loc_);
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 405 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2432,9 +2628,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 404 "dhcp6_lexer.ll"
+#line 414 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2444,9 +2640,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 413 "dhcp6_lexer.ll"
+#line 423 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2456,9 +2652,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 422 "dhcp6_lexer.ll"
+#line 432 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2468,9 +2664,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 431 "dhcp6_lexer.ll"
+#line 441 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2480,9 +2676,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 440 "dhcp6_lexer.ll"
+#line 450 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2492,9 +2688,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 449 "dhcp6_lexer.ll"
+#line 459 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOSTS_DATABASE:
@@ -2504,9 +2700,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 458 "dhcp6_lexer.ll"
+#line 468 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2519,9 +2715,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 470 "dhcp6_lexer.ll"
+#line 480 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2531,9 +2727,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 479 "dhcp6_lexer.ll"
+#line 489 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2543,9 +2739,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 488 "dhcp6_lexer.ll"
+#line 498 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2555,9 +2751,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 497 "dhcp6_lexer.ll"
+#line 507 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2567,9 +2763,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 506 "dhcp6_lexer.ll"
+#line 516 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2580,9 +2776,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 516 "dhcp6_lexer.ll"
+#line 526 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2593,9 +2789,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 526 "dhcp6_lexer.ll"
+#line 536 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2606,9 +2802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 536 "dhcp6_lexer.ll"
+#line 546 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2619,9 +2815,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
 YY_RULE_SETUP
-#line 546 "dhcp6_lexer.ll"
+#line 556 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2633,9 +2829,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 53:
 YY_RULE_SETUP
-#line 557 "dhcp6_lexer.ll"
+#line 567 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2646,9 +2842,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 567 "dhcp6_lexer.ll"
+#line 577 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2659,9 +2855,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 577 "dhcp6_lexer.ll"
+#line 587 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2672,9 +2868,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 587 "dhcp6_lexer.ll"
+#line 597 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2685,9 +2881,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 597 "dhcp6_lexer.ll"
+#line 607 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2698,9 +2894,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 607 "dhcp6_lexer.ll"
+#line 617 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2711,9 +2907,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 59:
 YY_RULE_SETUP
-#line 617 "dhcp6_lexer.ll"
+#line 627 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2724,9 +2920,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 627 "dhcp6_lexer.ll"
+#line 637 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2737,9 +2933,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 637 "dhcp6_lexer.ll"
+#line 647 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2749,9 +2945,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 62:
 YY_RULE_SETUP
-#line 646 "dhcp6_lexer.ll"
+#line 656 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2761,9 +2957,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 63:
 YY_RULE_SETUP
-#line 655 "dhcp6_lexer.ll"
+#line 665 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2773,9 +2969,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 64:
 YY_RULE_SETUP
-#line 664 "dhcp6_lexer.ll"
+#line 674 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2791,9 +2987,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 65:
 YY_RULE_SETUP
-#line 679 "dhcp6_lexer.ll"
+#line 689 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2809,9 +3005,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 66:
 YY_RULE_SETUP
-#line 694 "dhcp6_lexer.ll"
+#line 704 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2821,9 +3017,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 67:
 YY_RULE_SETUP
-#line 703 "dhcp6_lexer.ll"
+#line 713 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2833,9 +3029,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 68:
 YY_RULE_SETUP
-#line 712 "dhcp6_lexer.ll"
+#line 722 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2845,9 +3041,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 69:
 YY_RULE_SETUP
-#line 721 "dhcp6_lexer.ll"
+#line 731 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2857,9 +3053,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 70:
 YY_RULE_SETUP
-#line 730 "dhcp6_lexer.ll"
+#line 740 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2869,9 +3065,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 71:
 YY_RULE_SETUP
-#line 739 "dhcp6_lexer.ll"
+#line 749 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2881,9 +3077,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 72:
 YY_RULE_SETUP
-#line 748 "dhcp6_lexer.ll"
+#line 758 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2893,9 +3089,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 73:
 YY_RULE_SETUP
-#line 757 "dhcp6_lexer.ll"
+#line 767 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2905,9 +3101,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 74:
 YY_RULE_SETUP
-#line 766 "dhcp6_lexer.ll"
+#line 776 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2917,9 +3113,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 75:
 YY_RULE_SETUP
-#line 775 "dhcp6_lexer.ll"
+#line 785 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2929,9 +3125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 76:
 YY_RULE_SETUP
-#line 784 "dhcp6_lexer.ll"
+#line 794 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2942,9 +3138,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 77:
 YY_RULE_SETUP
-#line 794 "dhcp6_lexer.ll"
+#line 804 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2954,9 +3150,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 78:
 YY_RULE_SETUP
-#line 803 "dhcp6_lexer.ll"
+#line 813 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2966,9 +3162,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 79:
 YY_RULE_SETUP
-#line 812 "dhcp6_lexer.ll"
+#line 822 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2978,9 +3174,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 80:
 YY_RULE_SETUP
-#line 821 "dhcp6_lexer.ll"
+#line 831 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2990,9 +3186,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 81:
 YY_RULE_SETUP
-#line 830 "dhcp6_lexer.ll"
+#line 840 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3002,9 +3198,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 82:
 YY_RULE_SETUP
-#line 839 "dhcp6_lexer.ll"
+#line 849 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3014,9 +3210,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 83:
 YY_RULE_SETUP
-#line 848 "dhcp6_lexer.ll"
+#line 858 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3026,9 +3222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 84:
 YY_RULE_SETUP
-#line 857 "dhcp6_lexer.ll"
+#line 867 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3038,9 +3234,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 85:
 YY_RULE_SETUP
-#line 866 "dhcp6_lexer.ll"
+#line 876 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3050,9 +3246,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 86:
 YY_RULE_SETUP
-#line 875 "dhcp6_lexer.ll"
+#line 885 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3062,9 +3258,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 87:
 YY_RULE_SETUP
-#line 884 "dhcp6_lexer.ll"
+#line 894 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3075,9 +3271,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 88:
 YY_RULE_SETUP
-#line 894 "dhcp6_lexer.ll"
+#line 904 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3087,9 +3283,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 89:
 YY_RULE_SETUP
-#line 903 "dhcp6_lexer.ll"
+#line 913 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3099,9 +3295,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 90:
 YY_RULE_SETUP
-#line 912 "dhcp6_lexer.ll"
+#line 922 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3111,9 +3307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 91:
 YY_RULE_SETUP
-#line 921 "dhcp6_lexer.ll"
+#line 931 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3123,9 +3319,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 92:
 YY_RULE_SETUP
-#line 930 "dhcp6_lexer.ll"
+#line 940 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -3135,9 +3331,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 93:
 YY_RULE_SETUP
-#line 939 "dhcp6_lexer.ll"
+#line 949 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3147,9 +3343,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 94:
 YY_RULE_SETUP
-#line 948 "dhcp6_lexer.ll"
+#line 958 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3159,9 +3355,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 95:
 YY_RULE_SETUP
-#line 957 "dhcp6_lexer.ll"
+#line 967 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3171,9 +3367,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 96:
 YY_RULE_SETUP
-#line 966 "dhcp6_lexer.ll"
+#line 976 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3183,9 +3379,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 97:
 YY_RULE_SETUP
-#line 975 "dhcp6_lexer.ll"
+#line 985 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3195,9 +3391,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 98:
 YY_RULE_SETUP
-#line 985 "dhcp6_lexer.ll"
+#line 995 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3207,9 +3403,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 99:
 YY_RULE_SETUP
-#line 994 "dhcp6_lexer.ll"
+#line 1004 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3219,9 +3415,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 100:
 YY_RULE_SETUP
-#line 1003 "dhcp6_lexer.ll"
+#line 1013 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3232,9 +3428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 101:
 YY_RULE_SETUP
-#line 1013 "dhcp6_lexer.ll"
+#line 1023 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3245,9 +3441,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 102:
 YY_RULE_SETUP
-#line 1023 "dhcp6_lexer.ll"
+#line 1033 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3258,9 +3454,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 103:
 YY_RULE_SETUP
-#line 1033 "dhcp6_lexer.ll"
+#line 1043 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3270,9 +3466,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 104:
 YY_RULE_SETUP
-#line 1042 "dhcp6_lexer.ll"
+#line 1052 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3282,9 +3478,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 105:
 YY_RULE_SETUP
-#line 1051 "dhcp6_lexer.ll"
+#line 1061 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3294,9 +3490,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 106:
 YY_RULE_SETUP
-#line 1060 "dhcp6_lexer.ll"
+#line 1070 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3308,9 +3504,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 107:
 YY_RULE_SETUP
-#line 1071 "dhcp6_lexer.ll"
+#line 1081 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3321,9 +3517,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 108:
 YY_RULE_SETUP
-#line 1081 "dhcp6_lexer.ll"
+#line 1091 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3333,9 +3529,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 109:
 YY_RULE_SETUP
-#line 1090 "dhcp6_lexer.ll"
+#line 1100 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3346,9 +3542,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 110:
 YY_RULE_SETUP
-#line 1100 "dhcp6_lexer.ll"
+#line 1110 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3359,9 +3555,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 111:
 YY_RULE_SETUP
-#line 1110 "dhcp6_lexer.ll"
+#line 1120 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3371,9 +3567,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 112:
 YY_RULE_SETUP
-#line 1119 "dhcp6_lexer.ll"
+#line 1129 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3383,9 +3579,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 113:
 YY_RULE_SETUP
-#line 1128 "dhcp6_lexer.ll"
+#line 1138 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3395,9 +3591,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 114:
 YY_RULE_SETUP
-#line 1137 "dhcp6_lexer.ll"
+#line 1147 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3407,9 +3603,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 115:
 YY_RULE_SETUP
-#line 1146 "dhcp6_lexer.ll"
+#line 1156 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3419,9 +3615,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 116:
 YY_RULE_SETUP
-#line 1155 "dhcp6_lexer.ll"
+#line 1165 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3431,9 +3627,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 117:
 YY_RULE_SETUP
-#line 1164 "dhcp6_lexer.ll"
+#line 1174 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3443,9 +3639,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 118:
 YY_RULE_SETUP
-#line 1174 "dhcp6_lexer.ll"
+#line 1184 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3455,9 +3651,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 119:
 YY_RULE_SETUP
-#line 1183 "dhcp6_lexer.ll"
+#line 1193 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3467,9 +3663,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 120:
 YY_RULE_SETUP
-#line 1192 "dhcp6_lexer.ll"
+#line 1202 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3479,9 +3675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 121:
 YY_RULE_SETUP
-#line 1201 "dhcp6_lexer.ll"
+#line 1211 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3491,9 +3687,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 122:
 YY_RULE_SETUP
-#line 1210 "dhcp6_lexer.ll"
+#line 1220 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3503,9 +3699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 123:
 YY_RULE_SETUP
-#line 1219 "dhcp6_lexer.ll"
+#line 1229 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3515,9 +3711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 124:
 YY_RULE_SETUP
-#line 1228 "dhcp6_lexer.ll"
+#line 1238 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3527,9 +3723,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 125:
 YY_RULE_SETUP
-#line 1237 "dhcp6_lexer.ll"
+#line 1247 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3539,9 +3735,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 126:
 YY_RULE_SETUP
-#line 1246 "dhcp6_lexer.ll"
+#line 1256 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3551,9 +3747,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 127:
 YY_RULE_SETUP
-#line 1255 "dhcp6_lexer.ll"
+#line 1265 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3563,9 +3759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 128:
 YY_RULE_SETUP
-#line 1264 "dhcp6_lexer.ll"
+#line 1274 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3575,9 +3771,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 129:
 YY_RULE_SETUP
-#line 1273 "dhcp6_lexer.ll"
+#line 1283 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3587,9 +3783,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 130:
 YY_RULE_SETUP
-#line 1282 "dhcp6_lexer.ll"
+#line 1292 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3599,9 +3795,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 131:
 YY_RULE_SETUP
-#line 1291 "dhcp6_lexer.ll"
+#line 1301 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3611,9 +3807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 132:
 YY_RULE_SETUP
-#line 1300 "dhcp6_lexer.ll"
+#line 1310 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3623,9 +3819,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 133:
 YY_RULE_SETUP
-#line 1309 "dhcp6_lexer.ll"
+#line 1319 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3635,9 +3831,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 134:
 YY_RULE_SETUP
-#line 1318 "dhcp6_lexer.ll"
+#line 1328 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3647,9 +3843,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 135:
+YY_RULE_SETUP
+#line 1337 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp6Parser::make_BACKGROUND_RECLAMATION(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("background-reclamation", driver.loc_);
+    }
+}
+	YY_BREAK
+case 136:
+YY_RULE_SETUP
+#line 1346 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp6Parser::make_RECLAIM_SLICE_LEASES(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("reclaim-slice-leases", driver.loc_);
+    }
+}
+	YY_BREAK
+case 137:
+YY_RULE_SETUP
+#line 1355 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp6Parser::make_MAX_RECLAIM_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("max-reclaim-rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 138:
 YY_RULE_SETUP
-#line 1327 "dhcp6_lexer.ll"
+#line 1364 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3659,9 +3891,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 139:
 YY_RULE_SETUP
-#line 1336 "dhcp6_lexer.ll"
+#line 1373 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3671,9 +3903,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 140:
 YY_RULE_SETUP
-#line 1345 "dhcp6_lexer.ll"
+#line 1382 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3683,9 +3915,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 141:
 YY_RULE_SETUP
-#line 1354 "dhcp6_lexer.ll"
+#line 1391 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3695,9 +3927,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 142:
 YY_RULE_SETUP
-#line 1363 "dhcp6_lexer.ll"
+#line 1400 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3707,9 +3939,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 143:
 YY_RULE_SETUP
-#line 1372 "dhcp6_lexer.ll"
+#line 1409 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3719,9 +3951,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 144:
 YY_RULE_SETUP
-#line 1381 "dhcp6_lexer.ll"
+#line 1418 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3731,9 +3963,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 145:
 YY_RULE_SETUP
-#line 1390 "dhcp6_lexer.ll"
+#line 1427 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3743,9 +3975,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 146:
 YY_RULE_SETUP
-#line 1400 "dhcp6_lexer.ll"
+#line 1437 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3844,65 +4076,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 143:
-/* rule 143 can match eol */
+case 147:
+/* rule 147 can match eol */
 YY_RULE_SETUP
-#line 1498 "dhcp6_lexer.ll"
+#line 1535 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 144:
-/* rule 144 can match eol */
+case 148:
+/* rule 148 can match eol */
 YY_RULE_SETUP
-#line 1503 "dhcp6_lexer.ll"
+#line 1540 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 145:
+case 149:
 YY_RULE_SETUP
-#line 1508 "dhcp6_lexer.ll"
+#line 1545 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 146:
+case 150:
 YY_RULE_SETUP
-#line 1513 "dhcp6_lexer.ll"
+#line 1550 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 147:
+case 151:
 YY_RULE_SETUP
-#line 1514 "dhcp6_lexer.ll"
+#line 1551 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 148:
+case 152:
 YY_RULE_SETUP
-#line 1515 "dhcp6_lexer.ll"
+#line 1552 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 149:
+case 153:
 YY_RULE_SETUP
-#line 1516 "dhcp6_lexer.ll"
+#line 1553 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 150:
+case 154:
 YY_RULE_SETUP
-#line 1517 "dhcp6_lexer.ll"
+#line 1554 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 151:
+case 155:
 YY_RULE_SETUP
-#line 1518 "dhcp6_lexer.ll"
+#line 1555 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 152:
+case 156:
 YY_RULE_SETUP
-#line 1520 "dhcp6_lexer.ll"
+#line 1557 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -3921,9 +4153,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 153:
+case 157:
 YY_RULE_SETUP
-#line 1538 "dhcp6_lexer.ll"
+#line 1575 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -3937,43 +4169,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 154:
+case 158:
 YY_RULE_SETUP
-#line 1551 "dhcp6_lexer.ll"
+#line 1588 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 155:
+case 159:
 YY_RULE_SETUP
-#line 1556 "dhcp6_lexer.ll"
+#line 1593 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 156:
+case 160:
 YY_RULE_SETUP
-#line 1560 "dhcp6_lexer.ll"
+#line 1597 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 157:
+case 161:
 YY_RULE_SETUP
-#line 1562 "dhcp6_lexer.ll"
+#line 1599 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 158:
+case 162:
 YY_RULE_SETUP
-#line 1564 "dhcp6_lexer.ll"
+#line 1601 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 159:
+case 163:
 YY_RULE_SETUP
-#line 1566 "dhcp6_lexer.ll"
+#line 1603 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1568 "dhcp6_lexer.ll"
+#line 1605 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -3997,12 +4229,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 160:
+case 164:
 YY_RULE_SETUP
-#line 1591 "dhcp6_lexer.ll"
+#line 1628 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4005 "dhcp6_lexer.cc"
+#line 4237 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4321,7 +4553,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1251 )
+			if ( yy_current_state >= 1307 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4354,11 +4586,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1251 )
+		if ( yy_current_state >= 1307 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1250);
+	yy_is_jam = (yy_current_state == 1306);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5107,7 +5339,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1591 "dhcp6_lexer.ll"
+#line 1628 "dhcp6_lexer.ll"
 
 
 using namespace isc::dhcp;
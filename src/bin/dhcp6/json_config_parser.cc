@@ -14,6 +14,7 @@
 #include <dhcp6/json_config_parser.h>
 #include <dhcp6/dhcp6_log.h>
 #include <dhcp/iface_mgr.h>
+#include <dhcpsrv/cfg_load_profiler.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/pool.h>
@@ -248,15 +249,19 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
     // the parsers.  It is declared outside the loop so in case of error, the
     // name of the failing parser can be retrieved within the "catch" clause.
     ConfigPair config_pair;
+    // Measures the durations of the configuration stages.
+    CfgLoadProfiler profiler;
     try {
 
         SrvConfigPtr srv_config = CfgMgr::instance().getStagingCfg();
 
         // Set all default values if not specified by the user.
         SimpleParser6::setAllDefaults(mutable_cfg);
+        profiler.mark("defaults");
 
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser6::deriveParameters(mutable_cfg);
+        profiler.mark("derive");
 
         // Make parsers grouping.
         const std::map<std::string, ConstElementPtr>& values_map =
@@ -269,6 +274,7 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
             CfgOptionDefPtr cfg_option_def = srv_config->getCfgOptionDef();
             parser.parse(cfg_option_def, option_defs);
         }
+        profiler.mark("option-def");
 
         BOOST_FOREACH(config_pair, values_map) {
             // In principle we could have the following code structured as a series
@@ -375,10 +381,12 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first == "subnet6") {
+                profiler.mark("parameters");
                 SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
                 Subnets6ListConfigParser subnets_parser;
                 // parse() returns number of subnets parsed. We may log it one day.
                 subnets_parser.parse(srv_cfg, config_pair.second);
+                profiler.mark("subnet6");
                 continue;
             }
 
@@ -406,10 +414,12 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
                       "unsupported global configuration parameter: " << config_pair.first
                       << " (" << config_pair.second->getPosition() << ")");
         }
+        profiler.mark("parameters");
 
         // Apply global options in the staging config.
         Dhcp6ConfigParser global_parser;
         global_parser.parse(srv_config, mutable_cfg);
+        profiler.mark("globals");
 
     } catch (const isc::Exception& ex) {
         LOG_ERROR(dhcp6_logger, DHCP6_PARSER_FAIL)
@@ -474,8 +484,12 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
             // An error occurred, so make sure to restore the original data.
             rollback = true;
         }
+        profiler.mark("commit");
     }
 
+    LOG_DEBUG(dhcp6_logger, DBG_DHCP6_COMMAND, DHCP6_CONFIG_LOAD_PROFILE)
+        .arg(profiler.toText());
+
     // Rollback changes as the configuration parsing failed.
     if (rollback) {
         // Revert to original configuration of runtime option definitions
@@ -10,6 +10,7 @@
 #include <dhcp6/dhcp6_log.h>
 #include <dhcp6/parser_context.h>
 #include <dhcp6/json_config_parser.h>
+#include <config/command_mgr.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
@@ -231,6 +232,11 @@ main(int argc, char* argv[]) {
         // Tell the admin we are ready to process packets
         LOG_INFO(dhcp6_logger, DHCP6_STARTED).arg(VERSION);
 
+        // Execute the commands which only read the server state, such as
+        // statistic-get-all, in a separate thread, so as they don't delay
+        // the packet processing.
+        isc::config::CommandMgr::instance().setCommandThread(true);
+
         // And run the main loop of the server.
         server.run();
 
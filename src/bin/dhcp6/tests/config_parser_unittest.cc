@@ -3813,6 +3813,37 @@ TEST_F(Dhcp6ParserTest, LibrariesSpecified) {
 
 }
 
+// Verify that unchanged hooks libraries are not reloaded.
+TEST_F(Dhcp6ParserTest, LibrariesUnchanged) {
+    // Marker files should not be present.
+    EXPECT_FALSE(checkMarkerFileExists(LOAD_MARKER_FILE));
+    EXPECT_FALSE(checkMarkerFileExists(UNLOAD_MARKER_FILE));
+
+    string config = buildHooksLibrariesConfig(CALLOUT_LIBRARY_1,
+                                              CALLOUT_LIBRARY_2);
+    ASSERT_TRUE(executeConfiguration(config,
+                                     "load two valid libraries"));
+    EXPECT_TRUE(checkMarkerFile(LOAD_MARKER_FILE, "12"));
+    EXPECT_FALSE(checkMarkerFileExists(UNLOAD_MARKER_FILE));
+
+    CfgMgr::instance().commit();
+
+    // The same libraries are kept loaded: neither the unload() nor the
+    // load() functions are called.
+    ASSERT_TRUE(executeConfiguration(config, "same libraries"));
+    EXPECT_TRUE(checkMarkerFile(LOAD_MARKER_FILE, "12"));
+    EXPECT_FALSE(checkMarkerFileExists(UNLOAD_MARKER_FILE));
+    EXPECT_EQ(2, HooksManager::getLibraryNames().size());
+
+    CfgMgr::instance().commit();
+
+    // The order of the libraries matters: they are reloaded.
+    config = buildHooksLibrariesConfig(CALLOUT_LIBRARY_2, CALLOUT_LIBRARY_1);
+    ASSERT_TRUE(executeConfiguration(config, "libraries in reverse order"));
+    EXPECT_TRUE(checkMarkerFile(LOAD_MARKER_FILE, "1221"));
+    EXPECT_TRUE(checkMarkerFile(UNLOAD_MARKER_FILE, "21"));
+}
+
 
 // This test verifies that it is possible to select subset of interfaces on
 // which server should listen.
@@ -4968,6 +4999,42 @@ TEST_F(Dhcp6ParserTest, expiredLeasesProcessing) {
     EXPECT_EQ(10, cfg->getUnwarnedReclaimCycles());
 }
 
+// Check that the background reclamation of the expired leases may be
+// configured.
+TEST_F(Dhcp6ParserTest, expiredLeasesProcessingBackground) {
+    string config = "{ " + genIfaceConfig() + "," +
+        "\"expired-leases-processing\": "
+        "{"
+        "    \"reclaim-timer-wait-time\": 20,"
+        "    \"background-reclamation\": true,"
+        "    \"reclaim-slice-leases\": 25,"
+        "    \"max-reclaim-rate\": 500"
+        "},"
+        "\"subnet6\": [ ]"
+        "}";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp6Server(srv_, json));
+    checkResult(status, 0);
+
+    CfgExpirationPtr cfg = CfgMgr::instance().getStagingCfg()->getCfgExpiration();
+    ASSERT_TRUE(cfg);
+    EXPECT_EQ(20, cfg->getReclaimTimerWaitTime());
+    EXPECT_TRUE(cfg->getBackgroundReclamation());
+    EXPECT_EQ(25, cfg->getReclaimSliceLeases());
+    EXPECT_EQ(500, cfg->getMaxReclaimRate());
+
+    // The parameters are accepted only in the expired-leases-processing map.
+    config = "{ " + genIfaceConfig() + "," +
+        "\"background-reclamation\": true,"
+        "\"subnet6\": [ ]"
+        "}";
+    EXPECT_THROW(parseDHCP6(config), Dhcp6ParseError);
+}
+
 // Check that invalid configuration for the expired leases processing is
 // causing an error.
 TEST_F(Dhcp6ParserTest, expiredLeasesProcessingError) {
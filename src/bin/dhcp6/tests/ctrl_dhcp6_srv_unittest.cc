@@ -972,10 +972,16 @@ TEST_F(CtrlChannelDhcpv6SrvTest, controlChannelStats) {
                     "  \"name\":\"bogus\" }}", response);
     EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
 
-    // Check statistic-get-all
+    // Check statistic-get-all: only the reconfiguration statistics have
+    // been set by the configuration of the server.
     sendUnixCommand("{ \"command\" : \"statistic-get-all\", "
                     "  \"arguments\": {}}", response);
-    EXPECT_EQ("{ \"arguments\": {  }, \"result\": 0 }", response);
+    ConstElementPtr stats;
+    ASSERT_NO_THROW(stats = Element::fromJSON(response));
+    ASSERT_TRUE(stats->get("arguments"));
+    EXPECT_EQ(2, stats->get("arguments")->size());
+    EXPECT_TRUE(stats->get("arguments")->contains("reconfiguration-time"));
+    EXPECT_TRUE(stats->get("arguments")->contains("reconfiguration-db-time"));
 
     // Check statistic-reset
     sendUnixCommand("{ \"command\" : \"statistic-reset\", "
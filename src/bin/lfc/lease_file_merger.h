@@ -0,0 +1,458 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_FILE_MERGER_H
+#define LEASE_FILE_MERGER_H
+
+#include <exceptions/exceptions.h>
+#include <util/csv_file.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace lfc {
+
+/// @brief Merges lease files using a bounded amount of memory.
+///
+/// The default LFC processing loads all leases from the previous and copy
+/// lease files into the in-memory storage and then writes them out. The
+/// memory used is proportional to the number of leases in the files which
+/// is a problem for the servers holding millions of leases. This class
+/// performs the same cleanup as an external sort-merge:
+///
+/// -# Each input file is read in chunks of at most @c chunk_size leases.
+///    Each chunk is sorted by lease address, the duplicates within the chunk
+///    are removed (the entry read later wins) and the chunk is written to a
+///    temporary "run" file. The entries with a valid lifetime of 0 are kept
+///    in the runs because they must remove the lease entries from the
+///    earlier runs.
+/// -# The input files are read in parallel, each in its own thread. The
+///    runs are ordered by the input file index and then by the chunk index,
+///    i.e. in the order in which the entries appear in the lease files.
+/// -# The runs are merged using a k-way merge. If there are more runs than
+///    @c MAX_MERGE_RUNS, the runs are first merged in groups into the
+///    intermediate runs to limit the number of open files. For each address
+///    the entry from the latest run wins. The leases with a valid lifetime
+///    of 0 are dropped in the final pass.
+///
+/// The result is identical to the one produced by the
+/// @c isc::dhcp::LeaseFileLoader, i.e. the latest entry for each address
+/// ordered by address, with the expired entries removed.
+///
+/// The runs and the output file are written with a large write buffer
+/// rather than flushing each row.
+///
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+template<typename LeaseObjectType, typename LeaseFileType>
+class LeaseFileMerger : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to the lease.
+    typedef boost::shared_ptr<LeaseObjectType> LeasePtrType;
+
+    /// @brief Maximum number of runs merged in a single pass.
+    static const size_t MAX_MERGE_RUNS = 64;
+
+    /// @brief Size of the buffer used to write runs and the output file.
+    static const size_t WRITE_BUFFER_SIZE = 1048576;
+
+    /// @brief Constructor.
+    ///
+    /// @param input_files Names of the lease files to be merged, the later
+    /// files holding the more recent lease entries. Non-existing files are
+    /// skipped.
+    /// @param output_file Name of the output file. It is also used as a
+    /// prefix of the run file names.
+    /// @param chunk_size Maximum number of leases held in memory for each
+    /// input file.
+    /// @param max_errors Maximum number of lease parsing errors allowed in
+    /// each input file.
+    ///
+    /// @throw isc::BadValue if the chunk size is 0.
+    LeaseFileMerger(const std::vector<std::string>& input_files,
+                    const std::string& output_file,
+                    const size_t chunk_size, const uint32_t max_errors)
+        : output_file_(output_file), chunk_size_(chunk_size),
+          max_errors_(max_errors), inputs_(), merged_runs_(),
+          max_chunk_leases_(0) {
+        if (chunk_size_ == 0) {
+            isc_throw(isc::BadValue, "chunk size must be greater than 0");
+        }
+        for (size_t i = 0; i < input_files.size(); ++i) {
+            inputs_.push_back(Input(input_files[i]));
+        }
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the run files left behind after an error.
+    ~LeaseFileMerger() {
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            removeRuns(inputs_[i].runs_);
+        }
+        removeRuns(merged_runs_);
+    }
+
+    /// @brief Merges the input files into the output file.
+    ///
+    /// @throw isc::util::CSVFileError if reading an input file failed or
+    /// the maximum number of errors has been exceeded, or if writing a
+    /// file failed.
+    void merge() {
+        // Read the input files in parallel. The first file is read by this
+        // thread to avoid spawning a thread when there is only one file.
+        std::vector<boost::shared_ptr<util::thread::Thread> > threads;
+        for (size_t i = 1; i < inputs_.size(); ++i) {
+            threads.push_back(boost::shared_ptr<util::thread::Thread>
+                (new util::thread::Thread(boost::bind(&LeaseFileMerger::read,
+                                                      this, i))));
+        }
+        if (!inputs_.empty()) {
+            read(0);
+        }
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i]->wait();
+        }
+
+        std::vector<std::string> runs;
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            if (!inputs_[i].error_.empty()) {
+                isc_throw(util::CSVFileError, inputs_[i].error_);
+            }
+            runs.insert(runs.end(), inputs_[i].runs_.begin(),
+                        inputs_[i].runs_.end());
+            max_chunk_leases_ += inputs_[i].max_chunk_leases_;
+        }
+
+        // Reduce the number of runs so as they can be merged in one pass.
+        while (runs.size() > MAX_MERGE_RUNS) {
+            std::vector<std::string> merged_runs;
+            for (size_t i = 0; i < runs.size(); i += MAX_MERGE_RUNS) {
+                std::vector<std::string> group(runs.begin() + i,
+                    runs.begin() + std::min(i + MAX_MERGE_RUNS, runs.size()));
+                std::ostringstream run_name;
+                run_name << output_file_ << ".run.merged."
+                         << merged_runs_.size();
+                merged_runs_.push_back(run_name.str());
+                LeaseFileType run(run_name.str());
+                mergeRuns(group, run, false);
+                merged_runs.push_back(run_name.str());
+                removeRuns(group);
+            }
+            runs.swap(merged_runs);
+        }
+
+        output_.reset(new LeaseFileType(output_file_));
+        mergeRuns(runs, *output_, true);
+        removeRuns(runs);
+    }
+
+    /// @brief Returns the number of leases read from the input files.
+    uint32_t getReadLeases() const {
+        uint32_t count = 0;
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            count += inputs_[i].read_leases_;
+        }
+        return (count);
+    }
+
+    /// @brief Returns the number of attempts to read a lease.
+    uint32_t getReads() const {
+        uint32_t count = 0;
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            count += inputs_[i].reads_;
+        }
+        return (count);
+    }
+
+    /// @brief Returns the number of errors when reading leases.
+    uint32_t getReadErrs() const {
+        uint32_t count = 0;
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            count += inputs_[i].read_errs_;
+        }
+        return (count);
+    }
+
+    /// @brief Returns the number of leases written to the output file.
+    uint32_t getWriteLeases() const {
+        return (output_ ? output_->getWriteLeases() : 0);
+    }
+
+    /// @brief Returns the number of attempts to write a lease.
+    uint32_t getWrites() const {
+        return (output_ ? output_->getWrites() : 0);
+    }
+
+    /// @brief Returns the number of errors when writing leases.
+    uint32_t getWriteErrs() const {
+        return (output_ ? output_->getWriteErrs() : 0);
+    }
+
+    /// @brief Returns the maximum number of leases held in memory at once
+    /// by the readers.
+    size_t getMaxChunkLeases() const {
+        return (max_chunk_leases_);
+    }
+
+private:
+
+    /// @brief State of a single input file.
+    ///
+    /// Each instance is accessed by a single reader thread until the thread
+    /// completes.
+    struct Input {
+        /// @brief Constructor.
+        ///
+        /// @param filename Name of the input file.
+        explicit Input(const std::string& filename)
+            : filename_(filename), runs_(), reads_(0), read_leases_(0),
+              read_errs_(0), max_chunk_leases_(0), error_() {
+        }
+
+        /// @brief Name of the input file.
+        std::string filename_;
+
+        /// @brief Names of the runs created from the file, in order.
+        std::vector<std::string> runs_;
+
+        /// @brief Number of attempts to read a lease.
+        uint32_t reads_;
+
+        /// @brief Number of leases read.
+        uint32_t read_leases_;
+
+        /// @brief Number of errors when reading leases.
+        uint32_t read_errs_;
+
+        /// @brief Maximum number of leases held in a chunk.
+        size_t max_chunk_leases_;
+
+        /// @brief Error which terminated the reading, empty on success.
+        std::string error_;
+    };
+
+    /// @brief Entry of the merge queue.
+    struct MergeEntry {
+        /// @brief Lease read from the run.
+        LeasePtrType lease_;
+
+        /// @brief Index of the run the lease was read from.
+        size_t run_;
+    };
+
+    /// @brief Orders the merge queue.
+    ///
+    /// The entry with the lowest address is at the top of the queue. For
+    /// the same address, the entry from the latest run is at the top.
+    struct MergeEntryCompare {
+        /// @brief Returns true if the first entry has lower priority.
+        bool operator()(const MergeEntry& a, const MergeEntry& b) const {
+            if (a.lease_->addr_ == b.lease_->addr_) {
+                return (a.run_ < b.run_);
+            }
+            return (b.lease_->addr_ < a.lease_->addr_);
+        }
+    };
+
+    /// @brief Orders the leases in a chunk by address.
+    static bool lessByAddress(const LeasePtrType& a, const LeasePtrType& b) {
+        return (a->addr_ < b->addr_);
+    }
+
+    /// @brief Reads an input file into the runs.
+    ///
+    /// This is the main function of the reader threads. It doesn't throw.
+    ///
+    /// @param index Index of the input file.
+    void read(const size_t index) {
+        Input& input = inputs_[index];
+        LeaseFileType lease_file(input.filename_);
+        try {
+            if (!lease_file.exists()) {
+                return;
+            }
+            lease_file.open();
+
+            std::vector<LeasePtrType> chunk;
+            chunk.reserve(chunk_size_);
+            uint32_t errcnt = 0;
+            while (true) {
+                LeasePtrType lease;
+                if (!lease_file.next(lease)) {
+                    if (++errcnt > max_errors_) {
+                        isc_throw(util::CSVFileError, "exceeded maximum number"
+                                  " of failures " << max_errors_ << " to read"
+                                  " a lease from the lease file "
+                                  << input.filename_);
+                    }
+                    continue;
+                }
+                if (!lease) {
+                    break;
+                }
+                chunk.push_back(lease);
+                if (chunk.size() >= chunk_size_) {
+                    writeRun(input, chunk);
+                }
+            }
+            writeRun(input, chunk);
+
+        } catch (const std::exception& ex) {
+            input.error_ = ex.what();
+        }
+
+        lease_file.close();
+        input.reads_ = lease_file.getReads();
+        input.read_leases_ = lease_file.getReadLeases();
+        input.read_errs_ = lease_file.getReadErrs();
+    }
+
+    /// @brief Sorts the chunk and writes it to a new run.
+    ///
+    /// @param input Input file the chunk has been read from.
+    /// @param [out] chunk Leases to be written. The chunk is cleared.
+    void writeRun(Input& input, std::vector<LeasePtrType>& chunk) {
+        if (chunk.empty()) {
+            return;
+        }
+        input.max_chunk_leases_ = std::max(input.max_chunk_leases_,
+                                           chunk.size());
+
+        // Stable sort preserves the order of the entries for the same
+        // address so the last one is the most recent.
+        std::stable_sort(chunk.begin(), chunk.end(), lessByAddress);
+
+        std::ostringstream run_name;
+        run_name << output_file_ << ".run." << index(input) << "."
+                 << input.runs_.size();
+        LeaseFileType run(run_name.str());
+        input.runs_.push_back(run_name.str());
+        run.setWriteBufferSize(WRITE_BUFFER_SIZE);
+        run.recreate();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            if ((i + 1 < chunk.size()) &&
+                (chunk[i + 1]->addr_ == chunk[i]->addr_)) {
+                continue;
+            }
+            run.append(*chunk[i]);
+        }
+        run.close();
+        chunk.clear();
+    }
+
+    /// @brief Merges the runs into the lease file.
+    ///
+    /// @param runs Names of the runs, in order.
+    /// @param lease_file File to which the merged leases are written.
+    /// @param drop_expired Indicates if the leases with the valid lifetime
+    /// of 0 should be dropped.
+    void mergeRuns(const std::vector<std::string>& runs,
+                   LeaseFileType& lease_file, const bool drop_expired) const {
+        std::vector<boost::shared_ptr<LeaseFileType> > files;
+        std::priority_queue<MergeEntry, std::vector<MergeEntry>,
+                            MergeEntryCompare> queue;
+        for (size_t i = 0; i < runs.size(); ++i) {
+            files.push_back(boost::shared_ptr<LeaseFileType>
+                            (new LeaseFileType(runs[i])));
+            files.back()->open();
+            pushNext(*files.back(), i, queue);
+        }
+
+        lease_file.setWriteBufferSize(WRITE_BUFFER_SIZE);
+        lease_file.recreate();
+        while (!queue.empty()) {
+            MergeEntry top = queue.top();
+            queue.pop();
+            pushNext(*files[top.run_], top.run_, queue);
+            // Discard the older entries for the same address.
+            while (!queue.empty() &&
+                   (queue.top().lease_->addr_ == top.lease_->addr_)) {
+                size_t run = queue.top().run_;
+                queue.pop();
+                pushNext(*files[run], run, queue);
+            }
+            if (!drop_expired || (top.lease_->valid_lft_ > 0)) {
+                lease_file.append(*top.lease_);
+            }
+        }
+        lease_file.close();
+    }
+
+    /// @brief Reads next lease from the run and pushes it to the queue.
+    ///
+    /// @param run Run file.
+    /// @param run_index Index of the run.
+    /// @param queue Merge queue.
+    ///
+    /// @throw isc::util::CSVFileError if the lease can't be read.
+    template<typename QueueType>
+    static void pushNext(LeaseFileType& run, const size_t run_index,
+                         QueueType& queue) {
+        MergeEntry entry;
+        if (!run.next(entry.lease_)) {
+            isc_throw(util::CSVFileError, "failed to read lease from the"
+                      " temporary file " << run.getFilename() << ": "
+                      << run.getReadMsg());
+        }
+        if (entry.lease_) {
+            entry.run_ = run_index;
+            queue.push(entry);
+        } else {
+            run.close();
+        }
+    }
+
+    /// @brief Returns the index of the input.
+    size_t index(const Input& input) const {
+        return (&input - &inputs_[0]);
+    }
+
+    /// @brief Removes the run files.
+    ///
+    /// @param runs Names of the runs to be removed.
+    static void removeRuns(const std::vector<std::string>& runs) {
+        for (size_t i = 0; i < runs.size(); ++i) {
+            static_cast<void>(remove(runs[i].c_str()));
+        }
+    }
+
+    /// @brief Name of the output file.
+    std::string output_file_;
+
+    /// @brief Maximum number of leases held in memory per input file.
+    size_t chunk_size_;
+
+    /// @brief Maximum number of errors allowed in each input file.
+    uint32_t max_errors_;
+
+    /// @brief Input files.
+    std::vector<Input> inputs_;
+
+    /// @brief Names of the intermediate runs.
+    std::vector<std::string> merged_runs_;
+
+    /// @brief Sum of the maximum chunk sizes of the inputs.
+    size_t max_chunk_leases_;
+
+    /// @brief Output file, available after the merge.
+    boost::shared_ptr<LeaseFileType> output_;
+};
+
+}; // namespace isc::lfc
+}; // namespace isc
+
+#endif // LEASE_FILE_MERGER_H
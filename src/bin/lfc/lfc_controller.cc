@@ -8,7 +8,9 @@
 
 #include <lfc/lfc_controller.h>
 #include <lfc/lfc_log.h>
+#include <lfc/lease_file_merger.h>
 #include <util/pid_file.h>
+#include <util/stopwatch.h>
 #include <exceptions/exceptions.h>
 #include <dhcpsrv/csv_lease_file4.h>
 #include <dhcpsrv/csv_lease_file6.h>
@@ -16,15 +18,19 @@
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/lease_snapshot_file4.h>
 #include <log/logger_manager.h>
 #include <log/logger_name.h>
 #include <cfgrpt/config_report.h>
 
+#include <boost/lexical_cast.hpp>
+
 #include <iostream>
 #include <sstream>
 #include <unistd.h>
 #include <stdlib.h>
 #include <cerrno>
+#include <sys/resource.h>
 
 using namespace std;
 using namespace isc::util;
@@ -34,6 +40,34 @@ using namespace isc::log;
 namespace {
 /// @brief Maximum number of errors to allow when reading leases from the file.
 const uint32_t MAX_LEASE_ERRORS = 100;
+
+/// @brief Returns the number of leases processed per second.
+///
+/// @param leases Number of leases processed.
+/// @param stopwatch Stopwatch measuring the processing time.
+uint64_t
+leasesPerSecond(const uint64_t leases, const Stopwatch& stopwatch) {
+    const long usecs = stopwatch.getTotalMicroseconds();
+    if (usecs <= 0) {
+        return (0);
+    }
+    return (leases * 1000000 / usecs);
+}
+
+/// @brief Returns the peak resident set size of the process in kilobytes.
+long
+peakMemory() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return (0);
+    }
+#ifdef __APPLE__
+    // Darwin reports the value in bytes.
+    return (usage.ru_maxrss / 1024);
+#else
+    return (usage.ru_maxrss);
+#endif
+}
 }; // namespace anonymous
 
 namespace isc {
@@ -51,7 +85,8 @@ const char* LFCController::lfc_bin_name_ = "kea-lfc";
 
 LFCController::LFCController()
     : protocol_version_(0), verbose_(false), config_file_(""), previous_file_(""),
-      copy_file_(""), output_file_(""), finish_file_(""), pid_file_("") {
+      copy_file_(""), output_file_(""), finish_file_(""), pid_file_(""),
+      snapshot_file_(""), chunk_size_(0) {
 }
 
 LFCController::~LFCController() {
@@ -108,7 +143,13 @@ LFCController::launch(int argc, char* argv[], const bool test_mode) {
           .arg(copy_file_);
 
         try {
-            if (getProtocolVersion() == 4) {
+            if (getChunkSize() > 0) {
+                if (getProtocolVersion() == 4) {
+                    mergeLeases<Lease4, CSVLeaseFile4>();
+                } else {
+                    mergeLeases<Lease6, CSVLeaseFile6>();
+                }
+            } else if (getProtocolVersion() == 4) {
                 processLeases<Lease4, CSVLeaseFile4, Lease4Storage>();
             } else {
                 processLeases<Lease6, CSVLeaseFile6, Lease6Storage>();
@@ -150,7 +191,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
 
     opterr = 0;
     optind = 1;
-    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:")) != -1) {
+    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:m:s:")) != -1) {
         switch (ch) {
         case '4':
             // Process DHCPv4 lease files.
@@ -222,6 +263,14 @@ LFCController::parseArgs(int argc, char* argv[]) {
             finish_file_ = optarg;
             break;
 
+        case 's':
+            // Snapshot file name.
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "Snapshot file name missing");
+            }
+            snapshot_file_ = optarg;
+            break;
+
         case 'c':
             // Configuration file name
             if (optarg == NULL) {
@@ -230,6 +279,21 @@ LFCController::parseArgs(int argc, char* argv[]) {
             config_file_ = optarg;
             break;
 
+        case 'm':
+            // Maximum number of leases per chunk.
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "Chunk size missing");
+            }
+            try {
+                chunk_size_ = boost::lexical_cast<size_t>(optarg);
+            } catch (const boost::bad_lexical_cast&) {
+                isc_throw(InvalidUsage, "Chunk size must be a number");
+            }
+            if ((chunk_size_ == 0) || (optarg[0] == '-')) {
+                isc_throw(InvalidUsage, "Chunk size must be greater than 0");
+            }
+            break;
+
         case 'h':
             usage("");
             exit(EXIT_SUCCESS);
@@ -283,6 +347,10 @@ LFCController::parseArgs(int argc, char* argv[]) {
         isc_throw(InvalidUsage, "Config file not specified");
     }
 
+    if (!snapshot_file_.empty() && (protocol_version_ != 4)) {
+        isc_throw(InvalidUsage, "Snapshot file is only supported for DHCPv4");
+    }
+
     // If verbose is set echo the input information
     if (verbose_) {
         std::cout << "Protocol version:    DHCPv" << protocol_version_ << std::endl
@@ -291,8 +359,14 @@ LFCController::parseArgs(int argc, char* argv[]) {
                   << "Output lease file:         " << output_file_ << std::endl
                   << "Finish file:               " << finish_file_ << std::endl
                   << "Config file:               " << config_file_ << std::endl
-                  << "PID file:                  " << pid_file_ << std::endl
-                  << std::endl;
+                  << "PID file:                  " << pid_file_ << std::endl;
+        if (!snapshot_file_.empty()) {
+            std::cout << "Snapshot file:             " << snapshot_file_ << std::endl;
+        }
+        if (chunk_size_ > 0) {
+            std::cout << "Leases per chunk:          " << chunk_size_ << std::endl;
+        }
+        std::cout << std::endl;
     }
 }
 
@@ -303,7 +377,7 @@ LFCController::usage(const std::string& text) {
     }
 
     std::cerr << "Usage: " << lfc_bin_name_ << std::endl
-              << " [-4|-6] -p file -x file -i file -o file -f file -c file" << std::endl
+              << " [-4|-6] -p file -x file -i file -o file -f file -c file [-s file] [-m leases]" << std::endl
               << "   -4 or -6 clean a set of v4 or v6 lease files" << std::endl
               << "   -p <file>: PID file" << std::endl
               << "   -x <file>: previous or ex lease file" << std::endl
@@ -311,6 +385,9 @@ LFCController::usage(const std::string& text) {
               << "   -o <file>: output lease file" << std::endl
               << "   -f <file>: finish file" << std::endl
               << "   -c <file>: configuration file" << std::endl
+              << "   -s <file>: optional, DHCPv4 lease snapshot file" << std::endl
+              << "   -m <leases>: optional, merge the files in chunks of at most" << std::endl
+              << "                <leases> leases per file to bound memory use" << std::endl
               << "   -v: print version number and exit" << std::endl
               << "   -V: print extended version information and exit" << std::endl
               << "   -d: optional, verbose output " << std::endl
@@ -335,6 +412,7 @@ template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
 void
 LFCController::processLeases() const {
     StorageType storage;
+    Stopwatch read_watch;
 
     // If a previous file exists read the entries into storage
     LeaseFileType lf_prev(getPreviousFile());
@@ -349,21 +427,69 @@ LFCController::processLeases() const {
         LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage,
                                                MAX_LEASE_ERRORS);
     }
+    read_watch.stop();
 
     // Write the result out to the output file
+    Stopwatch write_watch;
     LeaseFileType lf_output(getOutputFile());
     LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
+    write_watch.stop();
 
     // If desired log the stats
     LOG_INFO(lfc_logger, LFC_READ_STATS)
       .arg(lf_prev.getReadLeases() + lf_copy.getReadLeases())
       .arg(lf_prev.getReads() + lf_copy.getReads())
-      .arg(lf_prev.getReadErrs() + lf_copy.getReadErrs());
+      .arg(lf_prev.getReadErrs() + lf_copy.getReadErrs())
+      .arg(leasesPerSecond(lf_prev.getReadLeases() + lf_copy.getReadLeases(),
+                           read_watch))
+      .arg(peakMemory());
 
     LOG_INFO(lfc_logger, LFC_WRITE_STATS)
       .arg(lf_output.getWriteLeases())
       .arg(lf_output.getWrites())
-      .arg(lf_output.getWriteErrs());
+      .arg(lf_output.getWriteErrs())
+      .arg(leasesPerSecond(lf_output.getWriteLeases(), write_watch))
+      .arg(peakMemory());
+
+    finishOutput();
+}
+
+template<typename LeaseObjectType, typename LeaseFileType>
+void
+LFCController::mergeLeases() const {
+    // The previous file holds older entries than the copy file.
+    std::vector<std::string> input_files;
+    input_files.push_back(getPreviousFile());
+    input_files.push_back(getCopyFile());
+
+    Stopwatch watch;
+    LeaseFileMerger<LeaseObjectType, LeaseFileType>
+        merger(input_files, getOutputFile(), getChunkSize(), MAX_LEASE_ERRORS);
+    merger.merge();
+    watch.stop();
+
+    // The files are read and merged in one pass, so the rates are
+    // relative to the total processing time.
+    LOG_INFO(lfc_logger, LFC_READ_STATS)
+      .arg(merger.getReadLeases())
+      .arg(merger.getReads())
+      .arg(merger.getReadErrs())
+      .arg(leasesPerSecond(merger.getReadLeases(), watch))
+      .arg(peakMemory());
+
+    LOG_INFO(lfc_logger, LFC_WRITE_STATS)
+      .arg(merger.getWriteLeases())
+      .arg(merger.getWrites())
+      .arg(merger.getWriteErrs())
+      .arg(leasesPerSecond(merger.getWriteLeases(), watch))
+      .arg(peakMemory());
+
+    finishOutput();
+}
+
+void
+LFCController::finishOutput() const {
+    writeSnapshot();
 
     // Once we've finished the output file move it to the complete file
     if (rename(getOutputFile().c_str(), getFinishFile().c_str()) != 0) {
@@ -373,6 +499,27 @@ LFCController::processLeases() const {
     }
 }
 
+void
+LFCController::writeSnapshot() const {
+    if (snapshot_file_.empty()) {
+        return;
+    }
+
+    try {
+        Stopwatch watch;
+        const uint64_t leases = LeaseSnapshotFile4::write(getOutputFile(),
+                                                          getSnapshotFile());
+        watch.stop();
+        LOG_INFO(lfc_logger, LFC_SNAPSHOT_STATS)
+          .arg(leases)
+          .arg(snapshot_file_)
+          .arg(watch.logFormatLastDuration());
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+    }
+}
+
 void
 LFCController::fileRotate() const {
     // Remove the old previous file
@@ -149,6 +149,22 @@ public:
     std::string getPidFile() const {
         return (pid_file_);
     }
+
+    /// @brief Gets the snapshot file name
+    ///
+    /// @return Returns the path to the snapshot file or an empty string
+    /// if no snapshot is written.
+    std::string getSnapshotFile() const {
+        return (snapshot_file_);
+    }
+
+    /// @brief Gets the chunk size
+    ///
+    /// @return Returns the maximum number of leases held in memory for
+    /// each lease file or 0 if the leases are merged in memory.
+    size_t getChunkSize() const {
+        return (chunk_size_);
+    }
     //@}
 
 private:
@@ -162,6 +178,8 @@ private:
     std::string output_file_;   ///< The path to the output file
     std::string finish_file_;   ///< The path to the finished output file
     std::string pid_file_;      ///< The path to the pid file
+    std::string snapshot_file_; ///< The path to the snapshot file (if any)
+    size_t chunk_size_;         ///< Leases per chunk, 0 to merge in memory
 
     /// @brief Prints the program usage text to std error.
     ///
@@ -189,6 +207,33 @@ private:
     template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
     void processLeases() const;
 
+    /// @brief Process files in chunks.
+    ///
+    /// Merges the previous and copy files into the output file using
+    /// the @c LeaseFileMerger, which holds at most @c chunk_size_ leases
+    /// of each file in memory.  Upon completion of the write move the
+    /// file to the finish file.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    ///
+    /// @throw RunTimeFail if we can't move the file.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    void mergeLeases() const;
+
+    /// @brief Writes the snapshot of the output file and moves the output
+    /// file to the finish file.
+    ///
+    /// @throw RunTimeFail if we can't move the file.
+    void finishOutput() const;
+
+    /// @brief Writes the binary snapshot of the output file.
+    ///
+    /// The server loads the snapshot instead of parsing the lease file
+    /// when it starts. Failures are logged but don't fail the cleanup:
+    /// the server ignores a snapshot which doesn't mirror the lease file.
+    void writeSnapshot() const;
+
     ///@brief Start up the logging system
     ///
     /// @param test_mode indicates if we have have been started from the test
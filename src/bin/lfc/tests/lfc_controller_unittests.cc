@@ -8,6 +8,7 @@
 #include <util/csv_file.h>
 #include <gtest/gtest.h>
 #include <fstream>
+#include <sstream>
 #include <cerrno>
 
 using namespace isc::lfc;
@@ -271,6 +272,81 @@ TEST_F(LFCControllerTest, someBadData) {
     EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
 }
 
+/// @brief Verify that the chunk size is parsed and validated.
+/// Parse the command line with valid and invalid chunk sizes.
+TEST_F(LFCControllerTest, chunkSize) {
+    LFCController lfc_controller;
+    EXPECT_EQ(0, lfc_controller.getChunkSize());
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>("previous"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>("config"),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>("finish"),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>("pid"),
+                     const_cast<char*>("-m"),
+                     const_cast<char*>("10000") };
+    int argc = 16;
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+    EXPECT_EQ(10000, lfc_controller.getChunkSize());
+
+    // The chunk size must be a positive number.
+    argv[15] = const_cast<char*>("0");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+
+    argv[15] = const_cast<char*>("-5");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+
+    argv[15] = const_cast<char*>("many");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+
+    // The value is required.
+    argc = 15;
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+}
+
+/// @brief Verify that the snapshot file is parsed and accepted for
+/// DHCPv4 only.
+TEST_F(LFCControllerTest, snapshotFile) {
+    LFCController lfc_controller;
+    EXPECT_TRUE(lfc_controller.getSnapshotFile().empty());
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>("previous"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>("config"),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>("finish"),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>("pid"),
+                     const_cast<char*>("-s"),
+                     const_cast<char*>("snapshot") };
+    int argc = 16;
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+    EXPECT_EQ("snapshot", lfc_controller.getSnapshotFile());
+
+    // DHCPv6 leases have no snapshot.
+    LFCController lfc_controller6;
+    argv[1] = const_cast<char*>("-6");
+    EXPECT_THROW(lfc_controller6.parseArgs(argc, argv), InvalidUsage);
+}
+
 /// @brief Verify that we do file rotation correctly.  We create different
 /// files and see if we properly delete and move them.
 TEST_F(LFCControllerTest, fileRotate) {
@@ -665,6 +741,142 @@ TEST_F(LFCControllerTest, launch6) {
     EXPECT_TRUE(noExistIOFP());
 }
 
+/// @brief Verify that the files merged in chunks produce the same result
+/// as the files merged in memory.
+///
+/// The chunk size of 1 results in more runs than can be merged in a
+/// single pass, so the intermediate runs are also exercised.
+TEST_F(LFCControllerTest, launch4Chunked) {
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str()),
+                     const_cast<char*>("-m"),
+                     const_cast<char*>("1")
+    };
+    int argc = 16;
+
+    // The previous file holds 100 leases, some of them updated. The copy
+    // file updates or expires some of the leases and adds new ones.
+    std::ostringstream prev;
+    prev << v4_hdr_;
+    for (int i = 0; i < 120; ++i) {
+        prev << "192.0." << (i % 100 / 10) << "." << (i % 100)
+             << ",06:07:08:09:0a:bc,,200," << 1000 + i
+             << ",8,1,1,host.example.com,1\n";
+    }
+    std::ostringstream copy;
+    copy << v4_hdr_;
+    for (int i = 0; i < 50; ++i) {
+        copy << "192.0." << (i * 3 / 10) << "." << (i * 3)
+             << ",06:07:08:09:0a:bc,," << ((i % 4) ? 300 : 0) << ","
+             << 2000 + i << ",8,1,1,host.example.com,1\n";
+    }
+
+    // Merge in memory.
+    writeFile(xstr_, prev.str());
+    writeFile(istr_, copy.str());
+    LFCController lfc_memory;
+    launch(lfc_memory, argc - 2, argv);
+    string expected = readFile(xstr_);
+    removeTestFile();
+
+    // Merge in chunks.
+    writeFile(xstr_, prev.str());
+    writeFile(istr_, copy.str());
+    LFCController lfc_chunked;
+    launch(lfc_chunked, argc, argv);
+    EXPECT_EQ(expected, readFile(xstr_));
+    EXPECT_TRUE(noExistIOFP());
+
+    // The temporary files have been removed.
+    EXPECT_TRUE(noExist(ostr_ + ".run.0.0"));
+    EXPECT_TRUE(noExist(ostr_ + ".run.1.0"));
+    EXPECT_TRUE(noExist(ostr_ + ".run.merged.0"));
+    removeTestFile();
+
+    // A file with too many errors fails the merge and is left intact.
+    string astr = "1,\n2,\n3,\n4,\n5,\n6,\n7,\n7,\n8,\n9,\n10,\n";
+    string test_str = v4_hdr_;
+    for (int i = 0; i < 11; ++i) {
+        test_str += astr;
+    }
+    writeFile(xstr_, test_str);
+    launch(lfc_chunked, argc, argv);
+    EXPECT_EQ(readFile(xstr_), test_str);
+    EXPECT_TRUE(noExistIOFP());
+}
+
+/// @brief Verify that the v6 files merged in chunks produce the expected
+/// result.
+TEST_F(LFCControllerTest, launch6Chunked) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-6"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str()),
+                     const_cast<char*>("-m"),
+                     const_cast<char*>("2")
+    };
+    int argc = 16;
+
+    string a_1 = "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "200,200,8,100,0,7,0,1,1,host.example.com,,1\n";
+    string a_3 = "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "200,400,8,100,0,7,0,1,1,host.example.com,,1\n";
+    string a_4 = "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "0,200,8,100,0,7,0,1,1,host.example.com,,1\n";
+
+    string b_1 = "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+                 "300,300,6,150,0,8,0,0,0,,,1\n";
+    string b_2 = "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+                 "300,800,6,150,0,8,0,0,0,,,1\n";
+    string b_3 = "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+                 "300,1000,6,150,0,8,0,0,0,,,1\n";
+
+    string c_1 = "3000:1::,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "100,200,8,0,2,16,64,0,0,,,1\n";
+    string c_2 = "3000:1::,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "100,400,8,0,2,16,64,0,0,,,1\n";
+
+    string d_1 = "2001:db8:1::3,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                 "200,600,8,100,0,7,0,1,1,host.example.com,,1\n";
+
+    // The entries for the same address are spread over multiple chunks.
+    string test_str = v6_hdr_ + a_1 + b_1 + c_1 + a_3 + b_2;
+    writeFile(xstr_, test_str);
+    test_str = v6_hdr_ + b_3 + a_4 + d_1 + c_2;
+    writeFile(istr_, test_str);
+
+    launch(lfc_controller, argc, argv);
+
+    // We expect the last lease for each ip except for A which has expired.
+    test_str = v6_hdr_ + d_1 + b_3 + c_2;
+    EXPECT_EQ(readFile(xstr_), test_str);
+    EXPECT_TRUE(noExistIOFP());
+}
+
 // @todo double launch (how to do that)
 
 } // end of anonymous namespace
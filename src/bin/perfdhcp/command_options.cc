@@ -149,6 +149,10 @@ CommandOptions::reset() {
     wrapped_.clear();
     server_name_.clear();
     v6_relay_encapsulation_level_ = 0;
+    single_thread_mode_ = true;
+    senders_num_ = 1;
+    report_format_ = REPORT_TEXT;
+    lease_lifecycle_ = LeaseLifecycle();
     generateDuidTemplate();
 }
 
@@ -217,7 +221,7 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
     // In this section we collect argument values from command line
     // they will be tuned and validated elsewhere
     while((opt = getopt(argc, argv, "hv46A:r:t:R:b:n:p:d:D:l:P:a:L:M:"
-                        "s:iBc1T:X:O:E:S:I:x:w:e:f:F:")) != -1) {
+                        "s:iBc1T:X:O:E:S:I:x:w:e:f:F:g:G:y:z:")) != -1) {
         stream << " -" << static_cast<char>(opt);
         if (optarg) {
             stream << " " << optarg;
@@ -332,6 +336,21 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                                             " positive integer");
             break;
 
+        case 'g': {
+            std::string thread_mode(optarg);
+            check((thread_mode != "single") && (thread_mode != "multi"),
+                  "value of thread mode: -g<thread-mode> must be 'single'"
+                  " or 'multi'");
+            single_thread_mode_ = (thread_mode == "single");
+            break;
+        }
+
+        case 'G':
+            senders_num_ = positiveInteger("number of sender threads:"
+                                           " -G<senders> must be a positive"
+                                           " integer");
+            break;
+
         case 'h':
             usage();
             return (true);
@@ -459,6 +478,31 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                                     " -x<value> must be specified");
             break;
 
+        case 'y': {
+            std::string report_format(optarg);
+            if (report_format == "text") {
+                report_format_ = REPORT_TEXT;
+            } else if (report_format == "csv") {
+                report_format_ = REPORT_CSV;
+            } else if (report_format == "json") {
+                report_format_ = REPORT_JSON;
+            } else {
+                isc_throw(InvalidParameter, "value of report format:"
+                          " -y<report-format> must be 'text', 'csv'"
+                          " or 'json'");
+            }
+            break;
+        }
+
+        case 'z':
+            try {
+                lease_lifecycle_ = LeaseLifecycle::fromText(optarg);
+            } catch (const isc::Exception& ex) {
+                isc_throw(InvalidParameter, "value of lease lifecycle:"
+                          " -z<lifecycle> is invalid: " << ex.what());
+            }
+            break;
+
         case 'X':
             if (xid_offset_.size() < 2) {
                 offset_arg = positiveInteger("value of transaction id:"
@@ -785,6 +829,12 @@ CommandOptions::validate() const {
           "-f<renew-rate> is not compatible with -i");
     check((getExchangeMode() == DO_SA) && (getReleaseRate() != 0),
           "-F<release-rate> is not compatible with -i");
+    check((getExchangeMode() == DO_SA) && !getLeaseLifecycle().empty(),
+          "-z<lifecycle> is not compatible with -i");
+    check(!getLeaseLifecycle().empty() &&
+          ((getRenewRate() != 0) || (getReleaseRate() != 0)),
+          "-z<lifecycle> is not compatible with -f<renew-rate> and"
+          " -F<release-rate>");
     check((getExchangeMode() != DO_SA) && (isRapidCommit() != 0),
           "-i must be set to use -c");
     check((getRate() == 0) && (getReportDelay() != 0),
@@ -820,6 +870,12 @@ CommandOptions::validate() const {
           "use -I<ip-offset>");
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
+    check(isSingleThreaded() && (getSendersNum() > 1),
+          "-g multi must be set to use -G<senders>");
+    check((getRate() != 0) && (getSendersNum() > getRate()),
+          "-G<senders> must not be greater than -r<rate>");
+    check((getReportFormat() != REPORT_TEXT) && (getReportDelay() == 0),
+          "-t<report> must be set to use -y<report-format>");
 }
 
 void
@@ -970,6 +1026,19 @@ CommandOptions::printCommandLine() const {
     if (!server_name_.empty()) {
         std::cout << "server=" << server_name_ << std::endl;
     }
+    if (!single_thread_mode_) {
+        std::cout << "thread-mode=multi, senders=" << senders_num_
+                  << std::endl;
+    }
+    if (!lease_lifecycle_.empty()) {
+        std::cout << "lease-lifecycle=" << lease_lifecycle_.toText()
+                  << std::endl;
+    }
+    if (report_format_ == REPORT_CSV) {
+        std::cout << "report-format=csv" << std::endl;
+    } else if (report_format_ == REPORT_JSON) {
+        std::cout << "report-format=json" << std::endl;
+    }
 }
 
 void
@@ -984,7 +1053,8 @@ CommandOptions::usage() const {
         "         [-c] [-1] [-M<mac-list-file>] [-T<template-file>]\n"
         "         [-X<xid-offset>] [-O<random-offset] [-E<time-offset>]\n"
         "         [-S<srvid-offset>] [-I<ip-offset>] [-x<diagnostic-selector>]\n"
-        "         [-w<wrapped>] [server]\n"
+        "         [-w<wrapped>] [-g<thread-mode>] [-G<senders>]\n"
+        "         [-y<report-format>] [-z<lifecycle>] [server]\n"
         "\n"
         "The [server] argument is the name/address of the DHCP server to\n"
         "contact.  For DHCPv4 operation, exchanges are initiated by\n"
@@ -1032,6 +1102,14 @@ CommandOptions::usage() const {
         "    with the exchange rate (given by -r<rate>).  Furthermore the sum of\n"
         "    this value and the release-rate (given by -F<rate) must be equal\n"
         "    to or less than the exchange rate.\n"
+        "-g<thread-mode>: 'single' (the default) sends and receives packets\n"
+        "    in a single thread. 'multi' receives the packets in a separate\n"
+        "    thread and sends the new exchanges from one or more sender\n"
+        "    threads (see -G), so as perfdhcp itself doesn't limit the\n"
+        "    measured rate on multi-core machines.\n"
+        "-G<senders>: Number of threads initiating new exchanges in the\n"
+        "    'multi' thread mode. The rate given by -r<rate> is split among\n"
+        "    them. The default is 1.\n"
         "-h: Print this help.\n"
         "-i: Do only the initial part of an exchange: DO or SA, depending on\n"
         "    whether -6 is given.\n"
@@ -1078,6 +1156,14 @@ CommandOptions::usage() const {
         "   * 't': when finished, print timers of all successful exchanges\n"
         "   * 'T': when finished, print templates\n"
         "-X<xid-offset>: Transaction ID (aka. xid) offset in the template.\n"
+        "-z<lifecycle>: Lease lifecycle of the clients: a comma separated\n"
+        "    list of <action>:<delay> steps taken by each client after it\n"
+        "    acquires the lease. The <action> is one of: 'renew', 'rebind',\n"
+        "    'release', 'decline' and 'reboot' (DHCPv4 INIT-REBOOT or DHCPv6\n"
+        "    Confirm). The <delay> is the time in seconds since the previous\n"
+        "    step completed. The release and decline end the lifecycle, e.g.\n"
+        "    -z renew:30,rebind:52.5,release:10. This option is not\n"
+        "    compatible with -i, -f and -F.\n"
         "\n"
         "DHCPv4 only options:\n"
         "-B: Force broadcast handling.\n"
@@ -1112,6 +1198,12 @@ CommandOptions::usage() const {
         "    alternative to -n, or both options can be given, in which case the\n"
         "    testing is completed when either limit is reached.\n"
         "-t<report>: Delay in seconds between two periodic reports.\n"
+        "    Besides the packet counters, the periodic report shows the 50th,\n"
+        "    99th and 99.9th percentile of the delays of the packets received\n"
+        "    since the previous report.\n"
+        "-y<report-format>: Format of the periodic reports: 'text' (the\n"
+        "    default), 'csv' (one row per exchange type) or 'json' (one\n"
+        "    object per report, on a single line).\n"
         "\n"
         "Errors:\n"
         "- tooshort: received a too short message\n"
@@ -7,6 +7,8 @@
 #ifndef COMMAND_OPTIONS_H
 #define COMMAND_OPTIONS_H
 
+#include "lease_lifecycle.h"
+
 #include <boost/noncopyable.hpp>
 
 #include <stdint.h>
@@ -105,6 +107,13 @@ public:
         DORA_SARR
     };
 
+    /// Format of the periodic reports (cmd line param -y)
+    enum ReportFormat {
+        REPORT_TEXT,
+        REPORT_CSV,
+        REPORT_JSON
+    };
+
     /// CommandOptions is a singleton class. This method returns reference
     /// to its sole instance.
     ///
@@ -337,6 +346,29 @@ public:
     /// \return server name.
     std::string getServerName() const { return server_name_; }
 
+    /// \brief Checks if packets are sent and received in a single thread.
+    ///
+    /// \return true if the single thread mode is in use (the default),
+    /// false if the packets are received in a separate thread.
+    bool isSingleThreaded() const { return (single_thread_mode_); }
+
+    /// \brief Returns the number of threads initiating new exchanges.
+    ///
+    /// \return number of sender threads in the multi thread mode.
+    int getSendersNum() const { return (senders_num_); }
+
+    /// \brief Returns the format of the periodic reports.
+    ///
+    /// \return format of the periodic reports.
+    ReportFormat getReportFormat() const { return (report_format_); }
+
+    /// \brief Returns the lease lifecycle of the clients.
+    ///
+    /// \return lease lifecycle, empty if not specified.
+    const LeaseLifecycle& getLeaseLifecycle() const {
+        return (lease_lifecycle_);
+    }
+
     /// \brief Print command line arguments.
     void printCommandLine() const;
 
@@ -592,6 +624,16 @@ private:
     std::string server_name_;
     /// Indicates how many DHCPv6 relay agents are simulated.
     uint8_t v6_relay_encapsulation_level_;
+    /// Indicates that packets are sent and received in a single thread,
+    /// specified with -g<thread-mode>.
+    bool single_thread_mode_;
+    /// Number of threads initiating new exchanges in the multi thread
+    /// mode, specified with -G<senders>.
+    int senders_num_;
+    /// Format of the periodic reports, specified with -y<report-format>.
+    ReportFormat report_format_;
+    /// Lease lifecycle of the clients, specified with -z<lifecycle>.
+    LeaseLifecycle lease_lifecycle_;
 };
 
 } // namespace perfdhcp
@@ -0,0 +1,135 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "latency_histogram.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// Total number of buckets: the exact buckets for the values lower than
+/// the number of sub-buckets followed by the sub-buckets for each power
+/// of two up to the maximum value.
+const size_t BUCKETS_NUM =
+    (isc::perfdhcp::LatencyHistogram::MAX_VALUE_BITS -
+     isc::perfdhcp::LatencyHistogram::SUB_BUCKET_BITS + 2) *
+    isc::perfdhcp::LatencyHistogram::SUB_BUCKETS_NUM;
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+const unsigned LatencyHistogram::SUB_BUCKET_BITS;
+const unsigned LatencyHistogram::SUB_BUCKETS_NUM;
+const unsigned LatencyHistogram::MAX_VALUE_BITS;
+const uint64_t LatencyHistogram::MAX_VALUE;
+
+LatencyHistogram::LatencyHistogram()
+    : buckets_(BUCKETS_NUM, 0), count_(0),
+      min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+}
+
+void
+LatencyHistogram::add(const uint64_t value) {
+    ++buckets_[getBucketIndex(value)];
+    ++count_;
+    if (value < min_) {
+        min_ = value;
+    }
+    if (value > max_) {
+        max_ = value;
+    }
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    if (other.min_ < min_) {
+        min_ = other.min_;
+    }
+    if (other.max_ > max_) {
+        max_ = other.max_;
+    }
+}
+
+void
+LatencyHistogram::clear() {
+    buckets_.assign(buckets_.size(), 0);
+    count_ = 0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if ((percentile < 0) || (percentile > 100)) {
+        isc_throw(isc::OutOfRange, "percentile " << percentile
+                  << " is out of range 0..100");
+    }
+    if (count_ == 0) {
+        return (0);
+    }
+
+    // Number of values which must be lower or equal to the returned one.
+    uint64_t rank = static_cast<uint64_t>(ceil(percentile * count_ / 100));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        total += buckets_[i];
+        if (total >= rank) {
+            uint64_t value = getBucketUpperBound(i);
+            if (value > max_) {
+                value = max_;
+            }
+            if (value < min_) {
+                value = min_;
+            }
+            return (value);
+        }
+    }
+    return (max_);
+}
+
+size_t
+LatencyHistogram::getBucketIndex(uint64_t value) {
+    if (value > MAX_VALUE) {
+        value = MAX_VALUE;
+    }
+    if (value < SUB_BUCKETS_NUM) {
+        return (static_cast<size_t>(value));
+    }
+
+    // Find the position of the most significant bit. The value is
+    // shifted right so as the remaining bits index the sub-bucket.
+    unsigned msb = SUB_BUCKET_BITS;
+    while ((value >> (msb + 1)) != 0) {
+        ++msb;
+    }
+    const unsigned shift = msb - SUB_BUCKET_BITS;
+    return (shift * SUB_BUCKETS_NUM + static_cast<size_t>(value >> shift));
+}
+
+uint64_t
+LatencyHistogram::getBucketUpperBound(const size_t index) {
+    if (index < SUB_BUCKETS_NUM) {
+        return (index);
+    }
+    const unsigned shift = index / SUB_BUCKETS_NUM - 1;
+    const uint64_t sub_bucket = index % SUB_BUCKETS_NUM + SUB_BUCKETS_NUM;
+    return (((sub_bucket + 1) << shift) - 1);
+}
+
+} // namespace perfdhcp
+} // namespace isc
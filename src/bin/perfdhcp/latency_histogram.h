@@ -0,0 +1,120 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Histogram of packet delays with logarithmic buckets.
+///
+/// The histogram records delays expressed in microseconds. Similarly to
+/// the HDR histogram, the values are grouped by the position of their
+/// most significant bit and each such group is split into a fixed number
+/// of linear sub-buckets. Values lower than the number of sub-buckets are
+/// recorded exactly, greater values with the relative error not exceeding
+/// 1 / \c SUB_BUCKETS_NUM (around 3%).
+///
+/// The number of buckets is fixed, so the memory used by the histogram
+/// doesn't depend on the number of recorded values or on the duration of
+/// the test. Values greater than \c MAX_VALUE are recorded in the last
+/// bucket.
+class LatencyHistogram {
+public:
+
+    /// \brief Number of bits used to index sub-buckets.
+    static const unsigned SUB_BUCKET_BITS = 5;
+
+    /// \brief Number of sub-buckets for each power of two.
+    static const unsigned SUB_BUCKETS_NUM = 1 << SUB_BUCKET_BITS;
+
+    /// \brief Position of the most significant bit of the greatest value
+    /// which can be recorded accurately.
+    static const unsigned MAX_VALUE_BITS = 40;
+
+    /// \brief Greatest value which can be recorded accurately (around
+    /// 12 days in microseconds).
+    static const uint64_t MAX_VALUE = (static_cast<uint64_t>(1) <<
+                                       (MAX_VALUE_BITS + 1)) - 1;
+
+    /// \brief Constructor.
+    ///
+    /// Creates empty histogram.
+    LatencyHistogram();
+
+    /// \brief Records a value.
+    ///
+    /// \param value delay in microseconds.
+    void add(const uint64_t value);
+
+    /// \brief Adds all values recorded in other histogram.
+    ///
+    /// \param other histogram which values should be added.
+    void merge(const LatencyHistogram& other);
+
+    /// \brief Removes all recorded values.
+    void clear();
+
+    /// \brief Returns the number of recorded values.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// \brief Returns the lowest recorded value or 0 if the histogram
+    /// is empty.
+    uint64_t getMin() const {
+        return (count_ > 0 ? min_ : 0);
+    }
+
+    /// \brief Returns the greatest recorded value.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// \brief Returns the value at the given percentile.
+    ///
+    /// The returned value is the upper bound of the bucket holding the
+    /// value at the given percentile, limited to the range between the
+    /// lowest and the greatest recorded value.
+    ///
+    /// \param percentile percentile between 0 and 100, e.g. 99.9.
+    /// \throw isc::OutOfRange if the percentile is out of range.
+    /// \return value at the percentile or 0 if the histogram is empty.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// \brief Returns the index of the bucket for the value.
+    ///
+    /// \param value recorded value.
+    static size_t getBucketIndex(uint64_t value);
+
+    /// \brief Returns the greatest value recorded in the bucket.
+    ///
+    /// \param index bucket index.
+    static uint64_t getBucketUpperBound(const size_t index);
+
+private:
+
+    /// \brief Counts of the values in the buckets.
+    std::vector<uint64_t> buckets_;
+
+    /// \brief Number of recorded values.
+    uint64_t count_;
+
+    /// \brief Lowest recorded value.
+    uint64_t min_;
+
+    /// \brief Greatest recorded value.
+    uint64_t max_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
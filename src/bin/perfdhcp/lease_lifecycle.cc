@@ -0,0 +1,126 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "lease_lifecycle.h"
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <cmath>
+#include <sstream>
+
+using namespace boost::posix_time;
+
+namespace isc {
+namespace perfdhcp {
+
+const size_t LeaseLifecycle::ACTIONS_NUM;
+
+LeaseLifecycle
+LeaseLifecycle::fromText(const std::string& spec) {
+    std::vector<std::string> tokens;
+    boost::split(tokens, spec, boost::is_any_of(","));
+
+    LeaseLifecycle lifecycle;
+    for (std::vector<std::string>::const_iterator token = tokens.begin();
+         token != tokens.end(); ++token) {
+        size_t pos = token->find(':');
+        if (pos == std::string::npos) {
+            isc_throw(isc::BadValue, "invalid lifecycle step '" << *token
+                      << "', expected <action>:<delay>");
+        }
+
+        Step step;
+        const std::string action = token->substr(0, pos);
+        if (action == "renew") {
+            step.action_ = RENEW;
+        } else if (action == "rebind") {
+            step.action_ = REBIND;
+        } else if (action == "release") {
+            step.action_ = RELEASE;
+        } else if (action == "decline") {
+            step.action_ = DECLINE;
+        } else if (action == "reboot") {
+            step.action_ = REBOOT;
+        } else {
+            isc_throw(isc::BadValue, "invalid lifecycle action '" << action
+                      << "', expected renew, rebind, release, decline"
+                      " or reboot");
+        }
+
+        double delay = 0;
+        try {
+            delay = boost::lexical_cast<double>(token->substr(pos + 1));
+        } catch (const boost::bad_lexical_cast&) {
+            delay = -1;
+        }
+        if (!(delay >= 0)) {
+            isc_throw(isc::BadValue, "invalid delay of the lifecycle step '"
+                      << *token << "', expected non-negative number of"
+                      " seconds");
+        }
+        step.delay_ = microseconds(static_cast<int64_t>(round(delay * 1e6)));
+
+        // The client has no lease after releasing or declining it.
+        if (!lifecycle.steps_.empty() &&
+            ((lifecycle.steps_.back().action_ == RELEASE) ||
+             (lifecycle.steps_.back().action_ == DECLINE))) {
+            isc_throw(isc::BadValue, "release and decline must be the last"
+                      " step of the lifecycle");
+        }
+        lifecycle.steps_.push_back(step);
+    }
+    return (lifecycle);
+}
+
+std::string
+LeaseLifecycle::actionToText(const Action action) {
+    switch (action) {
+    case RENEW:
+        return ("renew");
+    case REBIND:
+        return ("rebind");
+    case RELEASE:
+        return ("release");
+    case DECLINE:
+        return ("decline");
+    case REBOOT:
+        return ("reboot");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
+std::string
+LeaseLifecycle::toText() const {
+    std::ostringstream s;
+    for (std::vector<Step>::const_iterator step = steps_.begin();
+         step != steps_.end(); ++step) {
+        if (step != steps_.begin()) {
+            s << ",";
+        }
+        s << actionToText(step->action_) << ":"
+          << step->delay_.total_microseconds() / 1e6;
+    }
+    return (s.str());
+}
+
+bool
+LeaseLifecycle::includes(const Action action) const {
+    for (std::vector<Step>::const_iterator step = steps_.begin();
+         step != steps_.end(); ++step) {
+        if (step->action_ == action) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+} // namespace perfdhcp
+} // namespace isc
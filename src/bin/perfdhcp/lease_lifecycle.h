@@ -0,0 +1,337 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_LIFECYCLE_H
+#define LEASE_LIFECYCLE_H
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Describes the lease lifecycle of the simulated clients.
+///
+/// The lifecycle is a sequence of steps, each consisting of the action
+/// taken by the client and the delay (in seconds) after which it is
+/// taken. The lifecycle starts when the client acquires the lease. The
+/// delay of each following step is counted from the moment the previous
+/// step completed, i.e. the server's response was received or, if the
+/// action has no response, the message was sent.
+///
+/// The lifecycle is specified with the -z<lifecycle> command line option
+/// as a comma separated list of the steps in the "<action>:<delay>" form,
+/// e.g. "renew:30,rebind:52.5,release:10".
+class LeaseLifecycle {
+public:
+
+    /// \brief Actions taken by the clients.
+    enum Action {
+        RENEW,    ///< Renew the lease (DHCPv4 REQUEST, DHCPv6 Renew).
+        REBIND,   ///< Rebind the lease (DHCPv4 REQUEST, DHCPv6 Rebind).
+        RELEASE,  ///< Release the lease.
+        DECLINE,  ///< Decline the lease.
+        REBOOT    ///< Reboot (DHCPv4 INIT-REBOOT REQUEST, DHCPv6 Confirm).
+    };
+
+    /// \brief Number of actions.
+    static const size_t ACTIONS_NUM = REBOOT + 1;
+
+    /// \brief Single step of the lifecycle.
+    struct Step {
+        /// \brief Action taken by the client.
+        Action action_;
+        /// \brief Delay after which the action is taken.
+        boost::posix_time::time_duration delay_;
+    };
+
+    /// \brief Constructor.
+    ///
+    /// Creates empty lifecycle.
+    LeaseLifecycle() { }
+
+    /// \brief Parses the lifecycle specification.
+    ///
+    /// \param spec lifecycle specification, e.g. "renew:30,release:10".
+    /// \throw isc::BadValue if the specification is invalid or if the
+    /// release or decline is not the last step.
+    /// \return parsed lifecycle.
+    static LeaseLifecycle fromText(const std::string& spec);
+
+    /// \brief Returns the name of the action.
+    ///
+    /// \param action action.
+    static std::string actionToText(const Action action);
+
+    /// \brief Returns textual representation of the lifecycle.
+    std::string toText() const;
+
+    /// \brief Checks if the lifecycle has no steps.
+    bool empty() const {
+        return (steps_.empty());
+    }
+
+    /// \brief Returns the number of steps.
+    size_t getStepsNum() const {
+        return (steps_.size());
+    }
+
+    /// \brief Returns the step.
+    ///
+    /// \param index index of the step.
+    const Step& getStep(const size_t index) const {
+        return (steps_[index]);
+    }
+
+    /// \brief Checks if the lifecycle includes the action.
+    ///
+    /// \param action action.
+    bool includes(const Action action) const;
+
+private:
+
+    /// \brief Steps of the lifecycle.
+    std::vector<Step> steps_;
+};
+
+/// \brief Schedules the lifecycle steps of the clients.
+///
+/// The scheduler holds the clients which have acquired the leases and
+/// are waiting for their next step, along with the server's response
+/// holding the lease, which is used to create the next message. Because
+/// the delay of each step is the same for all clients, the clients
+/// waiting for the same step are held in a queue ordered by the due
+/// time. The next due client is always at the front of one of the queues
+/// and the insertion and removal of the clients are constant time.
+///
+/// The clients which have sent the message and are waiting for the
+/// server's response are held in a hash table indexed by the transaction
+/// id. The clients which don't receive the response in time are removed
+/// from the scheduler by \ref purge, so the memory used by the scheduler
+/// is proportional to the number of active clients.
+///
+/// The scheduler is not thread safe; it is protected by the caller.
+///
+/// \tparam T Pkt4 or Pkt6 class.
+template<typename T>
+class LeaseScheduler {
+public:
+
+    /// A type which represents the pointer to a packet.
+    typedef boost::shared_ptr<T> PacketPtr;
+
+    /// \brief Client due to take the next step.
+    struct Client {
+        /// \brief Server's response holding the client's lease.
+        PacketPtr lease_;
+        /// \brief Index of the step.
+        size_t step_;
+        /// \brief Time when the step is due.
+        boost::posix_time::ptime due_;
+    };
+
+    /// \brief Constructor.
+    ///
+    /// \param lifecycle lifecycle of the clients.
+    /// \param response_timeout time after which the client waiting for
+    /// the server's response is removed from the scheduler.
+    LeaseScheduler(const LeaseLifecycle& lifecycle,
+                   const boost::posix_time::time_duration& response_timeout)
+        : lifecycle_(lifecycle), response_timeout_(response_timeout),
+          queues_(lifecycle.getStepsNum()), pending_(),
+          sent_(LeaseLifecycle::ACTIONS_NUM, 0), completed_(0), lost_(0) {
+    }
+
+    /// \brief Starts the lifecycle of the client which acquired a lease.
+    ///
+    /// \param lease server's response holding the lease.
+    /// \param now current time.
+    void leaseAcquired(const PacketPtr& lease,
+                       const boost::posix_time::ptime& now) {
+        schedule(lease, 0, now);
+    }
+
+    /// \brief Returns the next client due to take a step.
+    ///
+    /// The returned client is removed from the scheduler until
+    /// \ref messageSent is called for it.
+    ///
+    /// \param now current time.
+    /// \param [out] client client due to take a step.
+    /// \return true if a client is due, false otherwise.
+    bool getDue(const boost::posix_time::ptime& now, Client& client) {
+        std::deque<Client>* next = NULL;
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            if (!queues_[i].empty() && (queues_[i].front().due_ <= now) &&
+                (!next || (queues_[i].front().due_ < next->front().due_))) {
+                next = &queues_[i];
+            }
+        }
+        if (!next) {
+            return (false);
+        }
+        client = next->front();
+        next->pop_front();
+        return (true);
+    }
+
+    /// \brief Records that the client has sent the message.
+    ///
+    /// If the message has a response, the client is waiting for it.
+    /// Otherwise, the client proceeds to the next step.
+    ///
+    /// \param client client which has sent the message.
+    /// \param transid transaction id of the message.
+    /// \param has_response indicates if the message has a response.
+    /// \param now current time.
+    void messageSent(const Client& client, const uint32_t transid,
+                     const bool has_response,
+                     const boost::posix_time::ptime& now) {
+        ++sent_[lifecycle_.getStep(client.step_).action_];
+        if (has_response) {
+            Client pending(client);
+            pending.due_ = now + response_timeout_;
+            pending_[transid] = pending;
+        } else {
+            schedule(client.lease_, client.step_ + 1, now);
+        }
+    }
+
+    /// \brief Records that the response to the client's message has
+    /// been received.
+    ///
+    /// The client proceeds to the next step. If the client has renewed
+    /// or rebound the lease, the response is used as the new lease.
+    ///
+    /// \param response server's response.
+    /// \param now current time.
+    /// \param [out] action action of the message the response belongs to.
+    /// \return true if the response belongs to one of the clients.
+    bool responseReceived(const PacketPtr& response,
+                          const boost::posix_time::ptime& now,
+                          LeaseLifecycle::Action& action) {
+        typename PendingMap::iterator it =
+            pending_.find(response->getTransid());
+        if (it == pending_.end()) {
+            return (false);
+        }
+        const Client& client = it->second;
+        action = lifecycle_.getStep(client.step_).action_;
+        if ((action == LeaseLifecycle::RENEW) ||
+            (action == LeaseLifecycle::REBIND)) {
+            schedule(response, client.step_ + 1, now);
+        } else {
+            schedule(client.lease_, client.step_ + 1, now);
+        }
+        pending_.erase(it);
+        return (true);
+    }
+
+    /// \brief Removes the clients which haven't received the response
+    /// in time.
+    ///
+    /// \param now current time.
+    void purge(const boost::posix_time::ptime& now) {
+        for (typename PendingMap::iterator it = pending_.begin();
+             it != pending_.end(); ) {
+            if (it->second.due_ <= now) {
+                ++lost_;
+                it = pending_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /// \brief Returns the lifecycle of the clients.
+    const LeaseLifecycle& getLifecycle() const {
+        return (lifecycle_);
+    }
+
+    /// \brief Returns the number of messages sent for the action.
+    ///
+    /// \param action action.
+    uint64_t getSentNum(const LeaseLifecycle::Action action) const {
+        return (sent_[action]);
+    }
+
+    /// \brief Returns the number of clients which completed the lifecycle.
+    uint64_t getCompletedNum() const {
+        return (completed_);
+    }
+
+    /// \brief Returns the number of clients which didn't receive the
+    /// response in time.
+    uint64_t getLostNum() const {
+        return (lost_);
+    }
+
+    /// \brief Returns the number of clients waiting for their next step
+    /// or for the server's response.
+    size_t getActiveNum() const {
+        size_t active = pending_.size();
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            active += queues_[i].size();
+        }
+        return (active);
+    }
+
+private:
+
+    /// \brief Schedules the step of the client.
+    ///
+    /// \param lease server's response holding the lease.
+    /// \param step index of the step.
+    /// \param now current time.
+    void schedule(const PacketPtr& lease, const size_t step,
+                  const boost::posix_time::ptime& now) {
+        if (step >= lifecycle_.getStepsNum()) {
+            ++completed_;
+            return;
+        }
+        Client client;
+        client.lease_ = lease;
+        client.step_ = step;
+        client.due_ = now + lifecycle_.getStep(step).delay_;
+        queues_[step].push_back(client);
+    }
+
+    /// Map of the clients waiting for the response by transaction id.
+    typedef boost::unordered_map<uint32_t, Client> PendingMap;
+
+    /// \brief Lifecycle of the clients.
+    LeaseLifecycle lifecycle_;
+
+    /// \brief Time after which the client waiting for the response
+    /// is removed.
+    boost::posix_time::time_duration response_timeout_;
+
+    /// \brief Queues of the clients waiting for the steps, one per step.
+    std::vector<std::deque<Client> > queues_;
+
+    /// \brief Clients waiting for the response.
+    PendingMap pending_;
+
+    /// \brief Number of messages sent for each action.
+    std::vector<uint64_t> sent_;
+
+    /// \brief Number of clients which completed the lifecycle.
+    uint64_t completed_;
+
+    /// \brief Number of clients which didn't receive the response in time.
+    uint64_t lost_;
+};
+
+} // namespace perfdhcp
+} // namespace isc
+
+#endif // LEASE_LIFECYCLE_H
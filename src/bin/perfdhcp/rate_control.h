@@ -8,6 +8,7 @@
 #define RATE_CONTROL_H
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace isc {
 namespace perfdhcp {
@@ -166,6 +167,9 @@ protected:
 
 };
 
+/// \brief Pointer to the \c RateControl object.
+typedef boost::shared_ptr<RateControl> RateControlPtr;
+
 }
 }
 
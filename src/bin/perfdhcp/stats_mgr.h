@@ -10,6 +10,8 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include "latency_histogram.h"
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -20,9 +22,11 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <queue>
+#include <sstream>
 
 
 namespace isc {
@@ -43,6 +47,11 @@ namespace perfdhcp {
 /// stored on the list of sent packets. When packets are matched the
 /// round trip time can be calculated.
 ///
+/// The packets may be passed to the Statistics Manager from multiple
+/// threads, e.g. the sent packets from the sender threads and the received
+/// packets from the receiver thread. Each exchange and the custom counters
+/// are protected by their own mutexes.
+///
 /// \param T class representing DHCPv4 or DHCPv6 packet.
 template <class T = dhcp::Pkt4>
 class StatsMgr : public boost::noncopyable {
@@ -119,7 +128,12 @@ public:
         XCHG_SA,  ///< DHCPv6 SOLICIT-ADVERTISE
         XCHG_RR,  ///< DHCPv6 REQUEST-REPLY
         XCHG_RN,  ///< DHCPv6 RENEW-REPLY
-        XCHG_RL   ///< DHCPv6 RELEASE-REPLY
+        XCHG_RL,  ///< DHCPv6 RELEASE-REPLY
+        XCHG_RBA, ///< DHCPv4 REQUEST-ACK (rebinding)
+        XCHG_IRA, ///< DHCPv4 REQUEST-ACK (init-reboot)
+        XCHG_RB,  ///< DHCPv6 REBIND-REPLY
+        XCHG_DC,  ///< DHCPv6 DECLINE-REPLY
+        XCHG_CF   ///< DHCPv6 CONFIRM-REPLY
     };
 
     /// \brief Exchange Statistics.
@@ -287,7 +301,9 @@ public:
               ordered_lookups_(0),
               sent_packets_num_(0),
               rcvd_packets_num_(0),
-              boot_time_(boot_time)
+              boot_time_(boot_time),
+              delay_histogram_(),
+              interval_delay_histogram_()
         {
             next_sent_ = sent_packets_.begin();
         }
@@ -302,10 +318,32 @@ public:
             if (!packet) {
                 isc_throw(BadValue, "Packet is null");
             }
+            util::thread::Mutex::Locker lock(mutex_);
             ++sent_packets_num_;
             sent_packets_.template get<0>().push_back(packet);
         }
 
+        /// \brief Add new packet to list of sent packets and send it.
+        ///
+        /// The packet is sent while the exchange is locked, so the
+        /// received packets can't be matched with it while the send
+        /// path updates its timestamp.
+        ///
+        /// \param packet packet object to be added.
+        /// \param send function object sending the packet.
+        /// \throw isc::BadValue if packet is null.
+        template<typename SendFunction>
+        void appendSent(const boost::shared_ptr<T>& packet,
+                        SendFunction send) {
+            if (!packet) {
+                isc_throw(BadValue, "Packet is null");
+            }
+            util::thread::Mutex::Locker lock(mutex_);
+            ++sent_packets_num_;
+            sent_packets_.template get<0>().push_back(packet);
+            send(packet);
+        }
+
         /// \brief Add new packet to list of received packets.
         ///
         /// Method adds new packet to list of received packets.
@@ -316,6 +354,7 @@ public:
             if (!packet) {
                 isc_throw(BadValue, "Packet is null");
             }
+            util::thread::Mutex::Locker lock(mutex_);
             rcvd_packets_.push_back(packet);
         }
 
@@ -337,6 +376,7 @@ public:
                 isc_throw(BadValue, "Received packet is null");
             }
 
+            util::thread::Mutex::Locker lock(mutex_);
             boost::posix_time::ptime sent_time = sent_packet->getTimestamp();
             boost::posix_time::ptime rcvd_time = rcvd_packet->getTimestamp();
 
@@ -370,6 +410,12 @@ public:
             // mean delays.
             sum_delay_ += delta;
             sum_delay_squared_ += delta * delta;
+            // Record the delay in the histograms used to calculate
+            // the percentiles.
+            const uint64_t delta_us = static_cast<uint64_t>
+                (period.length().total_microseconds());
+            delay_histogram_.add(delta_us);
+            interval_delay_histogram_.add(delta_us);
         }
 
         /// \brief Match received packet with the corresponding sent packet.
@@ -395,6 +441,7 @@ public:
                 isc_throw(BadValue, "Received packet is null");
             }
 
+            util::thread::Mutex::Locker lock(mutex_);
             if (sent_packets_.size() == 0) {
                 // List of sent packets is empty so there is no sense
                 // to continue looking fo the packet. It also means
@@ -539,14 +586,20 @@ public:
         /// Method returns minimum delay between sent and received packet.
         ///
         /// \return minimum delay between packets.
-        double getMinDelay() const { return(min_delay_); }
+        double getMinDelay() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(min_delay_);
+        }
 
         /// \brief Return maximum delay between sent and received packet.
         ///
         /// Method returns maximum delay between sent and received packet.
         ///
         /// \return maximum delay between packets.
-        double getMaxDelay() const { return(max_delay_); }
+        double getMaxDelay() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(max_delay_);
+        }
 
         /// \brief Return average packet delay.
         ///
@@ -558,6 +611,7 @@ public:
         /// have been received yet.
         /// \return average packet delay.
         double getAvgDelay() const {
+            util::thread::Mutex::Locker lock(mutex_);
             if (rcvd_packets_num_  == 0) {
                 isc_throw(InvalidOperation, "no packets received");
             }
@@ -575,11 +629,47 @@ public:
         /// for the exchange is equal to zero.
         /// \return standard deviation of packet delay.
         double getStdDevDelay() const {
+            util::thread::Mutex::Locker lock(mutex_);
             if (rcvd_packets_num_ == 0) {
                 isc_throw(InvalidOperation, "no packets received");
             }
+            const double avg_delay = sum_delay_ / rcvd_packets_num_;
             return(sqrt(sum_delay_squared_ / rcvd_packets_num_ -
-                        getAvgDelay() * getAvgDelay()));
+                        avg_delay * avg_delay));
+        }
+
+        /// \brief Return packet delay at the given percentile.
+        ///
+        /// The delay is calculated using the histogram of the delays
+        /// of all received packets, so its accuracy is limited by the
+        /// histogram precision (see \ref LatencyHistogram).
+        ///
+        /// \param percentile percentile between 0 and 100, e.g. 99.9.
+        /// \throw isc::InvalidOperation if no packets for this exchange
+        /// have been received yet.
+        /// \throw isc::OutOfRange if the percentile is out of range.
+        /// \return packet delay at the percentile.
+        double getDelayPercentile(const double percentile) const {
+            util::thread::Mutex::Locker lock(mutex_);
+            if (delay_histogram_.getCount() == 0) {
+                isc_throw(InvalidOperation, "no packets received");
+            }
+            return(delay_histogram_.getPercentile(percentile) / 1e6);
+        }
+
+        /// \brief Return histogram of the delays since the last call.
+        ///
+        /// Method returns the histogram of the delays of the packets
+        /// received since the last call to this method and starts
+        /// collecting the new one. It is used for the intermediate
+        /// reports.
+        ///
+        /// \return histogram of the delays in microseconds.
+        LatencyHistogram takeIntervalDelayHistogram() {
+            util::thread::Mutex::Locker lock(mutex_);
+            LatencyHistogram histogram(interval_delay_histogram_);
+            interval_delay_histogram_.clear();
+            return(histogram);
         }
 
         /// \brief Return number of orphan packets.
@@ -589,7 +679,10 @@ public:
         /// for us.
         ///
         /// \return number of orphan received packets.
-        uint64_t getOrphans() const { return(orphans_); }
+        uint64_t getOrphans() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(orphans_);
+        }
 
         /// \brief Return number of garbage collected packets.
         ///
@@ -600,7 +693,10 @@ public:
         /// command line argument.
         ///
         /// \return number of garbage collected packets.
-        uint64_t getCollectedNum() const { return(collected_); }
+        uint64_t getCollectedNum() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(collected_);
+        }
 
         /// \brief Return average unordered lookup set size.
         ///
@@ -612,6 +708,7 @@ public:
         /// lookups yet.
         /// \return average unordered lookup set size.
         double getAvgUnorderedLookupSetSize() const {
+            util::thread::Mutex::Locker lock(mutex_);
             if (unordered_lookups_ == 0) {
                 isc_throw(InvalidOperation, "no unordered lookups");
             }
@@ -627,7 +724,10 @@ public:
         /// packet does not match transaction id of next sent packet.
         ///
         /// \return number of unordered lookups.
-        uint64_t getUnorderedLookups() const { return(unordered_lookups_); }
+        uint64_t getUnorderedLookups() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(unordered_lookups_);
+        }
 
         /// \brief Return number of ordered sent packets lookups
         ///
@@ -638,21 +738,30 @@ public:
         /// function will use unordered lookup (with hash table).
         ///
         /// \return number of ordered lookups.
-        uint64_t getOrderedLookups() const { return(ordered_lookups_); }
+        uint64_t getOrderedLookups() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(ordered_lookups_);
+        }
 
         /// \brief Return total number of sent packets
         ///
         /// Method returns total number of sent packets.
         ///
         /// \return number of sent packets.
-        uint64_t getSentPacketsNum() const { return(sent_packets_num_); }
+        uint64_t getSentPacketsNum() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(sent_packets_num_);
+        }
 
         /// \brief Return total number of received packets
         ///
         /// Method returns total number of received packets.
         ///
         /// \return number of received packets.
-        uint64_t getRcvdPacketsNum() const { return(rcvd_packets_num_); }
+        uint64_t getRcvdPacketsNum() const {
+            util::thread::Mutex::Locker lock(mutex_);
+            return(rcvd_packets_num_);
+        }
 
         /// \brief Return number of dropped packets.
         ///
@@ -660,9 +769,10 @@ public:
         ///
         /// \return number of dropped packets.
         uint64_t getDroppedPacketsNum() const {
+            util::thread::Mutex::Locker lock(mutex_);
             uint64_t drops = 0;
-            if (getSentPacketsNum() > getRcvdPacketsNum()) {
-                drops = getSentPacketsNum() - getRcvdPacketsNum();
+            if (sent_packets_num_ > rcvd_packets_num_) {
+                drops = sent_packets_num_ - rcvd_packets_num_;
             }
             return(drops);
         }
@@ -704,6 +814,12 @@ public:
                      << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                      << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                      << endl
+                     << "p50 delay: " << getDelayPercentile(50) * 1e3 << " ms"
+                     << endl
+                     << "p99 delay: " << getDelayPercentile(99) * 1e3 << " ms"
+                     << endl
+                     << "p99.9 delay: " << getDelayPercentile(99.9) * 1e3
+                     << " ms" << endl
                      << "collected packets: " << getCollectedNum() << endl;
             } catch (const Exception&) {
                 cout << "Delay summary unavailable! No packets received." << endl;
@@ -727,6 +843,7 @@ public:
                 isc_throw(isc::InvalidOperation,
                           "packets archive mode is disabled");
             }
+            util::thread::Mutex::Locker lock(mutex_);
             if (rcvd_packets_num_ == 0) {
                 std::cout << "Unavailable! No packets received." << std::endl;
             }
@@ -865,6 +982,15 @@ public:
         uint64_t sent_packets_num_;    ///< Total number of sent packets.
         uint64_t rcvd_packets_num_;    ///< Total number of received packets.
         boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+        /// Histogram of the delays of all received packets.
+        LatencyHistogram delay_histogram_;
+        /// Histogram of the delays of the packets received since the
+        /// last intermediate report.
+        LatencyHistogram interval_delay_histogram_;
+
+        /// Mutex protecting the lists of packets and the counters.
+        mutable util::thread::Mutex mutex_;
     };
 
     /// Pointer to ExchangeStats.
@@ -990,6 +1116,7 @@ public:
     const CustomCounter& incrementCounter(const std::string& counter_key,
                                           const uint64_t value = 1) {
         CustomCounterPtr counter = getCounter(counter_key);
+        util::thread::Mutex::Locker lock(counters_mutex_);
         *counter += value;
         return (*counter);
     }
@@ -1010,6 +1137,27 @@ public:
         xchg_stats->appendSent(packet);
     }
 
+    /// \brief Add new packet to the sent packets list and send it.
+    ///
+    /// The caller sets the packet timestamp before it calls this method,
+    /// because the receiver thread (-g multi) may match the response with
+    /// the packet as soon as it is sent. The packet is sent while its
+    /// exchange is locked, so the timestamp update made by the send path
+    /// doesn't race with the receiver thread.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param packet packet to be added to the list and sent.
+    /// \param send function object sending the packet.
+    /// \throw isc::BadValue if invalid exchange type specified or
+    /// packet is null.
+    template<typename SendFunction>
+    void passSentPacket(const ExchangeType xchg_type,
+                        const boost::shared_ptr<T>& packet,
+                        SendFunction send) {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        xchg_stats->appendSent(packet, send);
+    }
+
     /// \brief Add new received packet and match with sent packet.
     ///
     /// Method adds new packet to the list of received packets. It
@@ -1087,6 +1235,20 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return packet delay at the given percentile.
+    ///
+    /// Method returns packet delay at the given percentile for
+    /// specified exchange type.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentile between 0 and 100, e.g. 99.9.
+    /// \return packet delay at the percentile.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getDelayPercentile(percentile));
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1237,6 +1399,16 @@ public:
             return("RENEW-REPLY");
         case XCHG_RL:
             return("RELEASE-REPLY");
+        case XCHG_RBA:
+            return("REQUEST-ACK (rebinding)");
+        case XCHG_IRA:
+            return("REQUEST-ACK (init-reboot)");
+        case XCHG_RB:
+            return("REBIND-REPLY");
+        case XCHG_DC:
+            return("DECLINE-REPLY");
+        case XCHG_CF:
+            return("CONFIRM-REPLY");
         default:
             return("Unknown exchange type");
         }
@@ -1277,11 +1449,15 @@ public:
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
+    /// counters and the 50th, 99th and 99.9th percentile of the
+    /// delays of the packets received since the previous report.
     void printIntermediateStats() const {
         std::ostringstream stream_sent;
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
+        std::ostringstream stream_p50;
+        std::ostringstream stream_p99;
+        std::ostringstream stream_p999;
         std::string sep("");
         for (ExchangesMapIterator it = exchanges_.begin();
              it != exchanges_.end(); ++it) {
@@ -1292,13 +1468,93 @@ public:
             stream_sent << sep << it->second->getSentPacketsNum();
             stream_rcvd << sep << it->second->getRcvdPacketsNum();
             stream_drops << sep << it->second->getDroppedPacketsNum();
+
+            LatencyHistogram histogram =
+                it->second->takeIntervalDelayHistogram();
+            stream_p50 << sep << formatDelay(histogram, 50);
+            stream_p99 << sep << formatDelay(histogram, 99);
+            stream_p999 << sep << formatDelay(histogram, 99.9);
         }
         std::cout << "sent: " << stream_sent.str()
                   << "; received: " << stream_rcvd.str()
                   << "; drops: " << stream_drops.str()
+                  << "; delay p50: " << stream_p50.str()
+                  << "; p99: " << stream_p99.str()
+                  << "; p99.9: " << stream_p999.str() << " ms"
                   << std::endl;
     }
 
+    /// \brief Print header of the intermediate statistics in CSV format.
+    ///
+    /// The header names the columns of the rows printed by the
+    /// \ref printIntermediateStatsCsv.
+    static void printIntermediateStatsCsvHeader() {
+        std::cout << "time,exchange,sent,received,drops,interval-received,"
+                  << "p50-ms,p99-ms,p99.9-ms,max-ms" << std::endl;
+    }
+
+    /// \brief Print intermediate statistics in CSV format.
+    ///
+    /// Method prints one row for each exchange. The row holds the time
+    /// since the start of the test in seconds, the name of the exchange,
+    /// the total number of sent, received and dropped packets and the
+    /// number of packets received since the previous report along with
+    /// the percentiles and the maximum of their delays in milliseconds.
+    void printIntermediateStatsCsv() const {
+        const double time = getTestPeriod().length().total_microseconds() / 1e6;
+        // Format into a local stream to leave the std::cout flags intact.
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(3);
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            LatencyHistogram histogram =
+                it->second->takeIntervalDelayHistogram();
+            s << time << ","
+              << exchangeToString(it->first) << ","
+              << it->second->getSentPacketsNum() << ","
+              << it->second->getRcvdPacketsNum() << ","
+              << it->second->getDroppedPacketsNum() << ","
+              << histogram.getCount() << ","
+              << histogram.getPercentile(50) / 1e3 << ","
+              << histogram.getPercentile(99) / 1e3 << ","
+              << histogram.getPercentile(99.9) / 1e3 << ","
+              << histogram.getMax() / 1e3 << std::endl;
+        }
+        std::cout << s.str() << std::flush;
+    }
+
+    /// \brief Print intermediate statistics in JSON format.
+    ///
+    /// Method prints a single line holding a JSON object with the time
+    /// since the start of the test in seconds and the list of exchanges
+    /// with the same values as \ref printIntermediateStatsCsv.
+    void printIntermediateStatsJson() const {
+        const double time = getTestPeriod().length().total_microseconds() / 1e6;
+        // Format into a local stream to leave the std::cout flags intact.
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(3)
+          << "{ \"time\": " << time << ", \"exchanges\": [ ";
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            LatencyHistogram histogram =
+                it->second->takeIntervalDelayHistogram();
+            if (it != exchanges_.begin()) {
+                s << ", ";
+            }
+            s << "{ \"exchange\": \"" << exchangeToString(it->first)
+              << "\", \"sent\": " << it->second->getSentPacketsNum()
+              << ", \"received\": " << it->second->getRcvdPacketsNum()
+              << ", \"drops\": " << it->second->getDroppedPacketsNum()
+              << ", \"interval-received\": " << histogram.getCount()
+              << ", \"p50-ms\": " << histogram.getPercentile(50) / 1e3
+              << ", \"p99-ms\": " << histogram.getPercentile(99) / 1e3
+              << ", \"p99.9-ms\": " << histogram.getPercentile(99.9) / 1e3
+              << ", \"max-ms\": " << histogram.getMax() / 1e3 << " }";
+        }
+        s << " ] }";
+        std::cout << s.str() << std::endl;
+    }
+
     /// \brief Print timestamps of all packets.
     ///
     /// Method prints timestamps of all sent and received
@@ -1337,6 +1593,7 @@ public:
         if (custom_counters_.empty()) {
             isc_throw(isc::InvalidOperation, "no custom counters specified");
         }
+        util::thread::Mutex::Locker lock(counters_mutex_);
         for (CustomCountersMapIterator it = custom_counters_.begin();
              it != custom_counters_.end();
              ++it) {
@@ -1348,6 +1605,22 @@ public:
 
 private:
 
+    /// \brief Format the delay at the given percentile in milliseconds.
+    ///
+    /// \param histogram histogram of the delays in microseconds.
+    /// \param percentile percentile between 0 and 100.
+    /// \return formatted delay or "-" if the histogram is empty.
+    static std::string formatDelay(const LatencyHistogram& histogram,
+                                   const double percentile) {
+        if (histogram.getCount() == 0) {
+            return ("-");
+        }
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(3)
+          << histogram.getPercentile(percentile) / 1e3;
+        return (s.str());
+    }
+
     /// \brief Return exchange stats object for given exchange type
     ///
     /// Method returns exchange stats object for given exchange type.
@@ -1378,6 +1651,9 @@ private:
     bool archive_enabled_;
 
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
+
+    /// Mutex protecting the values of the custom counters.
+    mutable util::thread::Mutex counters_mutex_;
 };
 
 } // namespace perfdhcp
@@ -12,12 +12,14 @@
 #include <dhcp/iface_mgr.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/option6_ia.h>
+#include <util/threads/thread.h>
 #include <util/unittests/check_valgrind.h>
 #include "test_control.h"
 #include "command_options.h"
 #include "perf_pkt4.h"
 #include "perf_pkt6.h"
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/foreach.hpp>
 
@@ -36,6 +38,32 @@ using namespace boost::posix_time;
 using namespace isc;
 using namespace isc::dhcp;
 using namespace isc::asiolink;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Packet reception timeout in the receiver thread (microseconds).
+///
+/// It bounds the time the receiver thread needs to notice that the test
+/// is finished.
+const uint32_t RECEIVER_TIMEOUT = 100000;
+
+/// @brief Interval between checks of the exit conditions in the multi
+/// thread mode (microseconds).
+const uint32_t CHECK_INTERVAL = 1000;
+
+/// @brief Sends a packet through the interface manager.
+///
+/// It is passed to the statistics manager, which sends the packet
+/// while the packet's exchange is locked.
+struct PacketSender {
+    template<typename PktPtrType>
+    void operator()(const PktPtrType& pkt) const {
+        IfaceMgr::instance().send(pkt);
+    }
+};
+
+}
 
 namespace isc {
 namespace perfdhcp {
@@ -122,6 +150,7 @@ TestControl::cleanCachedPackets() {
         // since we want to randomize leases to be renewed so leave 5
         // times more packets to randomize from.
         // @todo The cache size might be controlled from the command line.
+        util::thread::Mutex::Locker lock(mutex_);
         if (reply_storage_.size() > 5 * options.getRenewRate()) {
             reply_storage_.clear(reply_storage_.size() -
                                  5 * options.getRenewRate());
@@ -334,18 +363,75 @@ TestControl::createRequestFromAck(const dhcp::Pkt4Ptr& ack) {
     return (msg);
 }
 
+Pkt4Ptr
+TestControl::createLifecycleMessage4(const LeaseLifecycle::Action action,
+                                     const dhcp::Pkt4Ptr& ack) {
+    // Renewing and rebinding clients only differ in the destination
+    // of the message, which is always the server here.
+    if ((action == LeaseLifecycle::RENEW) ||
+        (action == LeaseLifecycle::REBIND)) {
+        return (createRequestFromAck(ack));
+    }
+
+    if (!ack) {
+        isc_throw(isc::BadValue, "Unable to create DHCPv4 message from a"
+                  " null DHCPACK message");
+    } else if (ack->getYiaddr().isV4Zero()) {
+        isc_throw(isc::BadValue, "Unable to create DHCPv4 message from a"
+                  " DHCPACK message containing yiaddr of 0");
+    }
+
+    uint8_t msg_type = DHCPREQUEST;
+    if (action == LeaseLifecycle::RELEASE) {
+        msg_type = DHCPRELEASE;
+    } else if (action == LeaseLifecycle::DECLINE) {
+        msg_type = DHCPDECLINE;
+    }
+    Pkt4Ptr msg(new Pkt4(msg_type, generateTransid()));
+    msg->setHWAddr(ack->getHWAddr());
+    msg->addOption(generateClientId(msg->getHWAddr()));
+
+    if (action == LeaseLifecycle::RELEASE) {
+        msg->setCiaddr(ack->getYiaddr());
+    } else {
+        // INIT-REBOOT and DHCPDECLINE carry the address in the requested
+        // address option.
+        OptionPtr opt_requested_address =
+            OptionPtr(new Option(Option::V4, DHO_DHCP_REQUESTED_ADDRESS,
+                                 OptionBuffer()));
+        opt_requested_address->setUint32(ack->getYiaddr().toUint32());
+        msg->addOption(opt_requested_address);
+    }
+
+    // The server identifier is only sent with the DHCPRELEASE and
+    // DHCPDECLINE.
+    if (action != LeaseLifecycle::REBOOT) {
+        OptionPtr opt_serverid = ack->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+        if (!opt_serverid) {
+            isc_throw(isc::Unexpected, "failed to create DHCPv4 message"
+                      " because server identifier option has not been found"
+                      " in the DHCPACK message");
+        }
+        msg->addOption(opt_serverid);
+    }
+    return (msg);
+}
+
 Pkt6Ptr
 TestControl::createMessageFromReply(const uint16_t msg_type,
                                     const dhcp::Pkt6Ptr& reply) {
-    // Restrict messages to Release and Renew.
-    if (msg_type != DHCPV6_RENEW && msg_type != DHCPV6_RELEASE) {
+    // Restrict messages to the ones sent for the existing leases.
+    if (msg_type != DHCPV6_RENEW && msg_type != DHCPV6_RELEASE &&
+        msg_type != DHCPV6_REBIND && msg_type != DHCPV6_DECLINE &&
+        msg_type != DHCPV6_CONFIRM) {
         isc_throw(isc::BadValue, "invalid message type " << msg_type
-                  << " to be created from Reply, expected DHCPV6_RENEW or"
-                  " DHCPV6_RELEASE");
+                  << " to be created from Reply, expected DHCPV6_RENEW,"
+                  " DHCPV6_RELEASE, DHCPV6_REBIND, DHCPV6_DECLINE or"
+                  " DHCPV6_CONFIRM");
     }
     // Get the string representation of the message - to be used for error
     // logging purposes.
-    const char* msg_type_str = (msg_type == DHCPV6_RENEW ? "Renew" : "Release");
+    const char* msg_type_str = Pkt6::getName(msg_type);
     // Reply message must be specified.
     if (!reply) {
         isc_throw(isc::BadValue, "Unable to create " << msg_type_str
@@ -362,14 +448,16 @@ TestControl::createMessageFromReply(const uint16_t msg_type,
                   " in the Reply message");
     }
     msg->addOption(opt_clientid);
-    // Server id.
-    OptionPtr opt_serverid = reply->getOption(D6O_SERVERID);
-    if (!opt_serverid) {
-        isc_throw(isc::Unexpected, "failed to create " << msg_type_str
-                  << " because server id option has not been found in the"
-                  " Reply message");
+    // Server id. Rebind and Confirm are sent to any available server.
+    if (msg_type != DHCPV6_REBIND && msg_type != DHCPV6_CONFIRM) {
+        OptionPtr opt_serverid = reply->getOption(D6O_SERVERID);
+        if (!opt_serverid) {
+            isc_throw(isc::Unexpected, "failed to create " << msg_type_str
+                      << " because server id option has not been found in"
+                      " the Reply message");
+        }
+        msg->addOption(opt_serverid);
     }
-    msg->addOption(opt_serverid);
     copyIaOptions(reply, msg);
     return (msg);
 }
@@ -472,7 +560,11 @@ TestControl::generateMacAddress(uint8_t& randomized) {
     const CommandOptions::MacAddrsVector& macs = options.getMacsFromFile();
     // if we are using the -M option return a random one from the list...
     if (macs.size() > 0) {
-      uint16_t r = number_generator_();
+      uint16_t r = 0;
+      {
+          util::thread::Mutex::Locker lock(mutex_);
+          r = number_generator_();
+      }
       if (r >= macs.size()) {
         r = 0;
       }
@@ -489,7 +581,11 @@ TestControl::generateMacAddress(uint8_t& randomized) {
       if (mac_addr.size() != HW_ETHER_LEN) {
           isc_throw(BadValue, "invalid MAC address template specified");
       }
-      uint32_t r = macaddr_gen_->generate();
+      uint32_t r = 0;
+      {
+          util::thread::Mutex::Locker lock(mutex_);
+          r = macaddr_gen_->generate();
+      }
       randomized = 0;
       // Randomize MAC address octets.
       for (std::vector<uint8_t>::iterator it = mac_addr.end() - 1;
@@ -529,7 +625,11 @@ TestControl::generateDuid(uint8_t& randomized) {
     const CommandOptions::MacAddrsVector& macs = options.getMacsFromFile();
     // pick a random mac address if we are using option -M..
     if (macs.size() > 0) {
-      uint16_t r = number_generator_();
+      uint16_t r = 0;
+      {
+          util::thread::Mutex::Locker lock(mutex_);
+          r = number_generator_();
+      }
       if (r >= macs.size()) {
         r = 0;
       }
@@ -754,6 +854,26 @@ TestControl::initializeStatsMgr() {
             stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RL);
         }
     }
+
+    // Track the exchanges of the lease lifecycle actions which have
+    // responses.
+    const LeaseLifecycle& lifecycle = options.getLeaseLifecycle();
+    for (size_t i = 0; i < LeaseLifecycle::ACTIONS_NUM; ++i) {
+        const LeaseLifecycle::Action action =
+            static_cast<LeaseLifecycle::Action>(i);
+        ExchangeType xchg_type;
+        if (!lifecycle.includes(action) ||
+            !getLifecycleExchange(action, xchg_type)) {
+            continue;
+        }
+        if (options.getIpVersion() == 4) {
+            stats_mgr4_->addExchangeStats(xchg_type, options.getDropTime()[1]);
+        } else {
+            stats_mgr6_->addExchangeStats(static_cast<StatsMgr6::ExchangeType>
+                                          (xchg_type),
+                                          options.getDropTime()[1]);
+        }
+    }
     if (testDiags('i')) {
         if (options.getIpVersion() == 4) {
             stats_mgr4_->addCustomCounter("latesend", "Late sent packets");
@@ -769,6 +889,68 @@ TestControl::initializeStatsMgr() {
     }
 }
 
+void
+TestControl::initializeLeaseScheduler() {
+    CommandOptions& options = CommandOptions::instance();
+    lease_scheduler4_.reset();
+    lease_scheduler6_.reset();
+    const LeaseLifecycle& lifecycle = options.getLeaseLifecycle();
+    if (lifecycle.empty()) {
+        return;
+    }
+    // The clients which don't receive the response within the drop
+    // time are removed from the scheduler.
+    const time_duration response_timeout =
+        microseconds(static_cast<int64_t>(options.getDropTime()[1] * 1e6));
+    if (options.getIpVersion() == 4) {
+        lease_scheduler4_.reset(new LeaseScheduler4(lifecycle,
+                                                    response_timeout));
+    } else {
+        lease_scheduler6_.reset(new LeaseScheduler6(lifecycle,
+                                                    response_timeout));
+    }
+    last_lifecycle_purge_ = microsec_clock::universal_time();
+}
+
+bool
+TestControl::getLifecycleExchange(const LeaseLifecycle::Action action,
+                                  ExchangeType& xchg_type) {
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        switch (action) {
+        case LeaseLifecycle::RENEW:
+            xchg_type = StatsMgr4::XCHG_RNA;
+            return (true);
+        case LeaseLifecycle::REBIND:
+            xchg_type = StatsMgr4::XCHG_RBA;
+            return (true);
+        case LeaseLifecycle::REBOOT:
+            xchg_type = StatsMgr4::XCHG_IRA;
+            return (true);
+        default:
+            // DHCPRELEASE and DHCPDECLINE have no responses.
+            return (false);
+        }
+    }
+
+    switch (action) {
+    case LeaseLifecycle::RENEW:
+        xchg_type = StatsMgr4::XCHG_RN;
+        break;
+    case LeaseLifecycle::REBIND:
+        xchg_type = StatsMgr4::XCHG_RB;
+        break;
+    case LeaseLifecycle::RELEASE:
+        xchg_type = StatsMgr4::XCHG_RL;
+        break;
+    case LeaseLifecycle::DECLINE:
+        xchg_type = StatsMgr4::XCHG_DC;
+        break;
+    default:
+        xchg_type = StatsMgr4::XCHG_CF;
+    }
+    return (true);
+}
+
 int
 TestControl::openSocket() const {
     CommandOptions& options = CommandOptions::instance();
@@ -869,33 +1051,40 @@ TestControl::openSocket() const {
     return (sock);
 }
 
+void
+TestControl::initiateExchange(const TestControlSocket& socket,
+                              const bool preload) {
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        // No template packets means that no -T option was specified.
+        // We have to build packets ourselves.
+        if (template_buffers_.empty()) {
+            sendDiscover4(socket, preload);
+        } else {
+            // @todo add defines for packet type index that can be
+            // used to access template_buffers_.
+            sendDiscover4(socket, template_buffers_[0], preload);
+        }
+    } else {
+        // No template packets means that no -T option was specified.
+        // We have to build packets ourselves.
+        if (template_buffers_.empty()) {
+            sendSolicit6(socket, preload);
+        } else {
+            // @todo add defines for packet type index that can be
+            // used to access template_buffers_.
+            sendSolicit6(socket, template_buffers_[0], preload);
+        }
+    }
+}
+
 void
 TestControl::sendPackets(const TestControlSocket& socket,
                          const uint64_t packets_num,
                          const bool preload /* = false */) {
     CommandOptions& options = CommandOptions::instance();
     for (uint64_t i = packets_num; i > 0; --i) {
-        if (options.getIpVersion() == 4) {
-            // No template packets means that no -T option was specified.
-            // We have to build packets ourselves.
-            if (template_buffers_.empty()) {
-                sendDiscover4(socket, preload);
-            } else {
-                // @todo add defines for packet type index that can be
-                // used to access template_buffers_.
-                sendDiscover4(socket, template_buffers_[0], preload);
-            }
-        } else {
-            // No template packets means that no -T option was specified.
-            // We have to build packets ourselves.
-            if (template_buffers_.empty()) {
-                sendSolicit6(socket, preload);
-            } else {
-                // @todo add defines for packet type index that can be
-                // used to access template_buffers_.
-                sendSolicit6(socket, template_buffers_[0], preload);
-            }
-        }
+        basic_rate_control_.updateSendTime();
+        initiateExchange(socket, preload);
         // If we preload server we don't want to receive any packets.
         if (!preload) {
             uint64_t latercvd = receivePackets(socket);
@@ -1062,14 +1251,29 @@ TestControl::printIntermediateStats() {
     time_period time_since_report(last_report_, now);
     if (time_since_report.length().total_seconds() >= delay) {
         if (options.getIpVersion() == 4) {
-            stats_mgr4_->printIntermediateStats();
+            printIntermediateStats(*stats_mgr4_);
         } else if (options.getIpVersion() == 6) {
-            stats_mgr6_->printIntermediateStats();
+            printIntermediateStats(*stats_mgr6_);
         }
         last_report_ = now;
     }
 }
 
+template<class StatsMgrType>
+void
+TestControl::printIntermediateStats(const StatsMgrType& stats_mgr) const {
+    switch (CommandOptions::instance().getReportFormat()) {
+    case CommandOptions::REPORT_CSV:
+        stats_mgr.printIntermediateStatsCsv();
+        break;
+    case CommandOptions::REPORT_JSON:
+        stats_mgr.printIntermediateStatsJson();
+        break;
+    default:
+        stats_mgr.printIntermediateStats();
+    }
+}
+
 void
 TestControl::printStats() const {
     printRate();
@@ -1080,6 +1284,9 @@ TestControl::printStats() const {
                       "hasn't been initialized");
         }
         stats_mgr4_->printStats();
+        if (lease_scheduler4_) {
+            printLifecycleStats(*lease_scheduler4_);
+        }
         if (testDiags('i')) {
             stats_mgr4_->printCustomCounters();
         }
@@ -1089,12 +1296,37 @@ TestControl::printStats() const {
                       "hasn't been initialized");
         }
         stats_mgr6_->printStats();
+        if (lease_scheduler6_) {
+            printLifecycleStats(*lease_scheduler6_);
+        }
         if (testDiags('i')) {
             stats_mgr6_->printCustomCounters();
         }
     }
 }
 
+template<class SchedulerType>
+void
+TestControl::printLifecycleStats(const SchedulerType& scheduler) const {
+    util::thread::Mutex::Locker lock(mutex_);
+    std::cout << "***Lease lifecycle: " << scheduler.getLifecycle().toText()
+              << "***" << std::endl;
+    for (size_t i = 0; i < LeaseLifecycle::ACTIONS_NUM; ++i) {
+        const LeaseLifecycle::Action action =
+            static_cast<LeaseLifecycle::Action>(i);
+        if (scheduler.getLifecycle().includes(action)) {
+            std::cout << LeaseLifecycle::actionToText(action) << " sent: "
+                      << scheduler.getSentNum(action) << std::endl;
+        }
+    }
+    std::cout << "completed clients: " << scheduler.getCompletedNum()
+              << std::endl
+              << "clients without response: " << scheduler.getLostNum()
+              << std::endl
+              << "active clients: " << scheduler.getActiveNum()
+              << std::endl << std::endl;
+}
+
 std::string
 TestControl::vector2Hex(const std::vector<uint8_t>& vec,
                         const std::string& separator /* ="" */) const {
@@ -1185,10 +1417,16 @@ TestControl::processReceivedPacket4(const TestControlSocket& socket,
             // So, we may need to keep this DHCPACK in the storage if renews.
             // Note that, DHCPACK messages hold the information about
             // leases assigned. We use this information to renew.
-            if (stats_mgr4_->hasExchangeStats(StatsMgr4::XCHG_RNA)) {
+            if (lease_scheduler4_) {
+                // The client starts its lease lifecycle.
+                util::thread::Mutex::Locker lock(mutex_);
+                lease_scheduler4_->leaseAcquired(pkt4,
+                    microsec_clock::universal_time());
+            } else if (stats_mgr4_->hasExchangeStats(StatsMgr4::XCHG_RNA)) {
                 // Renew messages are sent, because StatsMgr has the
                 // specific exchange type specified. Let's append the DHCPACK.
                 // message to a storage
+                util::thread::Mutex::Locker lock(mutex_);
                 ack_storage_.append(pkt4);
             }
         // The DHCPACK message is not a server's response to the DHCPREQUEST
@@ -1196,6 +1434,20 @@ TestControl::processReceivedPacket4(const TestControlSocket& socket,
         // renewal. In this case we first check if StatsMgr has exchange type
         // for renew specified, and if it has, if there is a corresponding
         // renew message for the received DHCPACK.
+        } else if (lease_scheduler4_) {
+            // It may be a response to the message sent in the lease
+            // lifecycle step.
+            LeaseLifecycle::Action action;
+            bool matched = false;
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                matched = lease_scheduler4_->responseReceived(pkt4,
+                    microsec_clock::universal_time(), action);
+            }
+            ExchangeType xchg_type;
+            if (matched && getLifecycleExchange(action, xchg_type)) {
+                stats_mgr4_->passRcvdPacket(xchg_type, pkt4);
+            }
         } else if (stats_mgr4_->hasExchangeStats(StatsMgr4::XCHG_RNA)) {
             stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_RNA, pkt4);
         }
@@ -1234,11 +1486,17 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
             // being sent. Note that, Reply messages hold the information about
             // leases assigned. We use this information to construct Renew and
             // Release messages.
-            if (stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RN) ||
-                stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL)) {
+            if (lease_scheduler6_) {
+                // The client starts its lease lifecycle.
+                util::thread::Mutex::Locker lock(mutex_);
+                lease_scheduler6_->leaseAcquired(pkt6,
+                    microsec_clock::universal_time());
+            } else if (stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RN) ||
+                       stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL)) {
                 // Renew or Release messages are sent, because StatsMgr has the
                 // specific exchange type specified. Let's append the Reply
                 // message to a storage.
+                util::thread::Mutex::Locker lock(mutex_);
                 reply_storage_.append(pkt6);
             }
         // The Reply message is not a server's response to the Request message
@@ -1248,6 +1506,21 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
         // a corresponding Renew message for the received Reply. If not,
         // we check that StatsMgr has exchange type for Release specified,
         // as possibly the Reply has been sent in response to Release.
+        } else if (lease_scheduler6_) {
+            // It may be a response to the message sent in the lease
+            // lifecycle step.
+            LeaseLifecycle::Action action;
+            bool matched = false;
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                matched = lease_scheduler6_->responseReceived(pkt6,
+                    microsec_clock::universal_time(), action);
+            }
+            ExchangeType xchg_type;
+            if (matched && getLifecycleExchange(action, xchg_type)) {
+                stats_mgr6_->passRcvdPacket(static_cast<StatsMgr6::ExchangeType>
+                                            (xchg_type), pkt6);
+            }
         } else if (!(stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RN) &&
                      stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_RN, pkt6)) &&
                    stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL)) {
@@ -1260,13 +1533,19 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
 
 uint64_t
 TestControl::receivePackets(const TestControlSocket& socket) {
+    const bool single_threaded = CommandOptions::instance().isSingleThreaded();
     bool receiving = true;
     uint64_t received = 0;
-    while (receiving) {
+    // In the multi thread mode this is called by the receiver thread which
+    // has no sending to wait for, so the timeout only bounds the time to
+    // notice that the test is finished.
+    while (receiving && (single_threaded || !threadsStopped())) {
+        const uint32_t timeout = single_threaded ? getCurrentTimeout() :
+            RECEIVER_TIMEOUT;
         if (CommandOptions::instance().getIpVersion() == 4) {
             Pkt4Ptr pkt4;
             try {
-                pkt4 = IfaceMgr::instance().receive4(0, getCurrentTimeout());
+                pkt4 = IfaceMgr::instance().receive4(0, timeout);
             } catch (const Exception& e) {
                 std::cerr << "Failed to receive DHCPv4 packet: "
                           << e.what() <<  std::endl;
@@ -1287,7 +1566,7 @@ TestControl::receivePackets(const TestControlSocket& socket) {
         } else if (CommandOptions::instance().getIpVersion() == 6) {
             Pkt6Ptr pkt6;
             try {
-                pkt6 = IfaceMgr::instance().receive6(0, getCurrentTimeout());
+                pkt6 = IfaceMgr::instance().receive6(0, timeout);
             } catch (const Exception& e) {
                 std::cerr << "Failed to receive DHCPv6 packet: "
                           << e.what() << std::endl;
@@ -1403,6 +1682,9 @@ TestControl::reset() {
     setMacAddrGenerator(NumberGeneratorPtr());
     first_packet_serverid_.clear();
     interrupted_ = false;
+    threads_stopped_ = false;
+    lease_scheduler4_.reset();
+    lease_scheduler6_.reset();
 }
 
 int
@@ -1461,71 +1743,46 @@ TestControl::run() {
 
     // Initialize Statistics Manager. Release previous if any.
     initializeStatsMgr();
-    for (;;) {
-        // Calculate number of packets to be sent to stay
-        // catch up with rate.
-        uint64_t packets_due = basic_rate_control_.getOutboundMessageCount();
-        checkLateMessages(basic_rate_control_);
-        if ((packets_due == 0) && testDiags('i')) {
-            if (options.getIpVersion() == 4) {
-                stats_mgr4_->incrementCounter("shortwait");
-            } else if (options.getIpVersion() == 6) {
-                stats_mgr6_->incrementCounter("shortwait");
+    initializeLeaseScheduler();
+    if ((options.getReportFormat() == CommandOptions::REPORT_CSV) &&
+        (options.getReportDelay() > 0)) {
+        StatsMgr4::printIntermediateStatsCsvHeader();
+    }
+    if (!options.isSingleThreaded()) {
+        // Send and receive the packets in the separate threads.
+        runThreads(socket);
+    } else {
+        for (;;) {
+            // Calculate number of packets to be sent to stay
+            // catch up with rate.
+            uint64_t packets_due =
+                basic_rate_control_.getOutboundMessageCount();
+            checkLateMessages(basic_rate_control_);
+            if ((packets_due == 0) && testDiags('i')) {
+                if (options.getIpVersion() == 4) {
+                    stats_mgr4_->incrementCounter("shortwait");
+                } else if (options.getIpVersion() == 6) {
+                    stats_mgr6_->incrementCounter("shortwait");
+                }
             }
-        }
-
-        // @todo: set non-zero timeout for packets once we implement
-        // microseconds timeout in IfaceMgr.
-        receivePackets(socket);
-
-        // If test period finished, maximum number of packet drops
-        // has been reached or test has been interrupted we have to
-        // finish the test.
-        if (checkExitConditions()) {
-            break;
-        }
 
-        // Initiate new DHCP packet exchanges.
-        sendPackets(socket, packets_due);
+            // @todo: set non-zero timeout for packets once we implement
+            // microseconds timeout in IfaceMgr.
+            receivePackets(socket);
 
-        // If -f<renew-rate> option was specified we have to check how many
-        // Renew packets should be sent to catch up with a desired rate.
-        if (options.getRenewRate() != 0) {
-            uint64_t renew_packets_due =
-                renew_rate_control_.getOutboundMessageCount();
-            checkLateMessages(renew_rate_control_);
-
-            // Send multiple renews to satisfy the desired rate.
-            if (options.getIpVersion() == 4) {
-                sendMultipleRequests(socket, renew_packets_due);
-            } else {
-                sendMultipleMessages6(socket, DHCPV6_RENEW, renew_packets_due);
+            // If test period finished, maximum number of packet drops
+            // has been reached or test has been interrupted we have to
+            // finish the test.
+            if (checkExitConditions()) {
+                break;
             }
-        }
 
-        // If -F<release-rate> option was specified we have to check how many
-        // Release messages should be sent to catch up with a desired rate.
-        if ((options.getIpVersion() == 6) && (options.getReleaseRate() != 0)) {
-            uint64_t release_packets_due =
-                release_rate_control_.getOutboundMessageCount();
-            checkLateMessages(release_rate_control_);
-            // Send Release messages.
-            sendMultipleMessages6(socket, DHCPV6_RELEASE, release_packets_due);
-        }
+            // Initiate new DHCP packet exchanges.
+            sendPackets(socket, packets_due);
 
-        // Report delay means that user requested printing number
-        // of sent/received/dropped packets repeatedly.
-        if (options.getReportDelay() > 0) {
-            printIntermediateStats();
+            // Send Renews and Releases, print reports etc.
+            runPeriodicTasks(socket);
         }
-
-        // If we are sending Renews to the server, the Reply packets are cached
-        // so as leases for which we send Renews can be identified. The major
-        // issue with this approach is that most of the time we are caching
-        // more packets than we actually need. This function removes excessive
-        // Reply messages to reduce the memory and CPU utilization. Note that
-        // searches in the long list of Reply packets increases CPU utilization.
-        cleanCachedPackets();
     }
     printStats();
 
@@ -1568,6 +1825,188 @@ TestControl::run() {
     return (ret_code);
 }
 
+void
+TestControl::runPeriodicTasks(const TestControlSocket& socket) {
+    CommandOptions& options = CommandOptions::instance();
+
+    // If -f<renew-rate> option was specified we have to check how many
+    // Renew packets should be sent to catch up with a desired rate.
+    if (options.getRenewRate() != 0) {
+        uint64_t renew_packets_due =
+            renew_rate_control_.getOutboundMessageCount();
+        checkLateMessages(renew_rate_control_);
+
+        // Send multiple renews to satisfy the desired rate.
+        if (options.getIpVersion() == 4) {
+            sendMultipleRequests(socket, renew_packets_due);
+        } else {
+            sendMultipleMessages6(socket, DHCPV6_RENEW, renew_packets_due);
+        }
+    }
+
+    // If -F<release-rate> option was specified we have to check how many
+    // Release messages should be sent to catch up with a desired rate.
+    if ((options.getIpVersion() == 6) && (options.getReleaseRate() != 0)) {
+        uint64_t release_packets_due =
+            release_rate_control_.getOutboundMessageCount();
+        checkLateMessages(release_rate_control_);
+        // Send Release messages.
+        sendMultipleMessages6(socket, DHCPV6_RELEASE, release_packets_due);
+    }
+
+    // Send the messages of the clients whose lease lifecycle step is due.
+    sendLifecycleMessages(socket);
+
+    // Report delay means that user requested printing number
+    // of sent/received/dropped packets repeatedly.
+    if (options.getReportDelay() > 0) {
+        printIntermediateStats();
+    }
+
+    // If we are sending Renews to the server, the Reply packets are cached
+    // so as leases for which we send Renews can be identified. The major
+    // issue with this approach is that most of the time we are caching
+    // more packets than we actually need. This function removes excessive
+    // Reply messages to reduce the memory and CPU utilization. Note that
+    // searches in the long list of Reply packets increases CPU utilization.
+    cleanCachedPackets();
+}
+
+void
+TestControl::runThreads(const TestControlSocket& socket) {
+    CommandOptions& options = CommandOptions::instance();
+    {
+        util::thread::Mutex::Locker lock(mutex_);
+        threads_stopped_ = false;
+    }
+
+    std::vector<ThreadPtr> threads;
+    try {
+        threads.push_back(ThreadPtr(new Thread(
+            boost::bind(&TestControl::receiveThread, this,
+                        boost::cref(socket)))));
+
+        // The rate of the new exchanges is split among the senders. The
+        // validation of the command line guarantees that each of them gets
+        // a non-zero rate if the rate is limited.
+        const int senders_num = options.getSendersNum();
+        for (int i = 0; i < senders_num; ++i) {
+            int rate = options.getRate() / senders_num;
+            if (i < options.getRate() % senders_num) {
+                ++rate;
+            }
+            RateControlPtr rate_control(
+                new RateControl(rate, options.getAggressivity()));
+            threads.push_back(ThreadPtr(new Thread(
+                boost::bind(&TestControl::sendThread, this,
+                            boost::cref(socket), rate_control))));
+        }
+
+        // This thread checks the exit conditions and takes care of the
+        // Renews, Releases and reports until the test is finished or one
+        // of the threads fails.
+        while (!threadsStopped() && !checkExitConditions()) {
+            runPeriodicTasks(socket);
+            usleep(CHECK_INTERVAL);
+        }
+
+    } catch (...) {
+        stopThreads();
+        static_cast<void>(joinThreads(threads));
+        throw;
+    }
+
+    stopThreads();
+    std::string error = joinThreads(threads);
+    if (!error.empty()) {
+        isc_throw(Unexpected, "perfdhcp thread failed: " << error);
+    }
+}
+
+void
+TestControl::receiveThread(const TestControlSocket& socket) {
+    try {
+        while (!threadsStopped()) {
+            receivePackets(socket);
+        }
+    } catch (...) {
+        stopThreads();
+        throw;
+    }
+}
+
+void
+TestControl::sendThread(const TestControlSocket& socket,
+                        const RateControlPtr& rate_control) {
+    CommandOptions& options = CommandOptions::instance();
+    const ExchangeType xchg_type = (options.getIpVersion() == 4 ?
+                                    StatsMgr4::XCHG_DO : StatsMgr4::XCHG_SA);
+    const uint64_t num_requests = (options.getNumRequests().empty() ? 0 :
+                                   options.getNumRequests()[0]);
+    try {
+        while (!threadsStopped()) {
+            uint64_t packets_due = rate_control->getOutboundMessageCount();
+            checkLateMessages(*rate_control);
+
+            // Don't go beyond -n<num-request> while waiting for the main
+            // thread to finish the test.
+            if ((num_requests > 0) &&
+                (getSentPacketsNum(xchg_type) >= num_requests)) {
+                usleep(CHECK_INTERVAL);
+                continue;
+            }
+
+            if (packets_due == 0) {
+                // Wait until the next exchanges are due.
+                ptime now(microsec_clock::universal_time());
+                uint64_t wait = CHECK_INTERVAL;
+                if (rate_control->getDue() > now) {
+                    wait = std::min(wait, static_cast<uint64_t>
+                        (time_period(now, rate_control->getDue()).
+                         length().total_microseconds()));
+                }
+                usleep(wait);
+                continue;
+            }
+
+            for (; (packets_due > 0) && !threadsStopped(); --packets_due) {
+                rate_control->updateSendTime();
+                initiateExchange(socket, false);
+            }
+        }
+    } catch (...) {
+        stopThreads();
+        throw;
+    }
+}
+
+void
+TestControl::stopThreads() {
+    util::thread::Mutex::Locker lock(mutex_);
+    threads_stopped_ = true;
+}
+
+bool
+TestControl::threadsStopped() const {
+    util::thread::Mutex::Locker lock(mutex_);
+    return (threads_stopped_);
+}
+
+std::string
+TestControl::joinThreads(const std::vector<ThreadPtr>& threads) {
+    std::string error;
+    BOOST_FOREACH(ThreadPtr thread, threads) {
+        try {
+            thread->wait();
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+    return (error);
+}
+
 void
 TestControl::runWrapped(bool do_stop /*= false */) const {
     CommandOptions& options = CommandOptions::instance();
@@ -1588,6 +2027,7 @@ TestControl::runWrapped(bool do_stop /*= false */) const {
 void
 TestControl::saveFirstPacket(const Pkt4Ptr& pkt) {
     if (testDiags('T')) {
+        util::thread::Mutex::Locker lock(mutex_);
         if (template_packets_v4_.find(pkt->getType()) == template_packets_v4_.end()) {
             template_packets_v4_[pkt->getType()] = pkt;
         }
@@ -1597,6 +2037,7 @@ TestControl::saveFirstPacket(const Pkt4Ptr& pkt) {
 void
 TestControl::saveFirstPacket(const Pkt6Ptr& pkt) {
     if (testDiags('T')) {
+        util::thread::Mutex::Locker lock(mutex_);
         if (template_packets_v6_.find(pkt->getType()) == template_packets_v6_.end()) {
             template_packets_v6_[pkt->getType()] = pkt;
         }
@@ -1606,7 +2047,6 @@ TestControl::saveFirstPacket(const Pkt6Ptr& pkt) {
 void
 TestControl::sendDiscover4(const TestControlSocket& socket,
                            const bool preload /*= false*/) {
-    basic_rate_control_.updateSendTime();
     // Generate the MAC address to be passed in the packet.
     uint8_t randomized = 0;
     std::vector<uint8_t> mac_address = generateMacAddress(randomized);
@@ -1639,13 +2079,18 @@ TestControl::sendDiscover4(const TestControlSocket& socket,
     pkt4->addOption(generateClientId(pkt4->getHWAddr()));
 
     pkt4->pack();
-    IfaceMgr::instance().send(pkt4);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
     if (!preload) {
         if (!stats_mgr4_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                       "hasn't been initialized");
         }
-        stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4);
+        pkt4->updateTimestamp();
+        stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4,
+                                    PacketSender());
+    } else {
+        IfaceMgr::instance().send(pkt4);
     }
     saveFirstPacket(pkt4);
 }
@@ -1654,7 +2099,6 @@ void
 TestControl::sendDiscover4(const TestControlSocket& socket,
                            const std::vector<uint8_t>& template_buf,
                            const bool preload /* = false */) {
-    basic_rate_control_.updateSendTime();
     // Get the first argument if multiple the same arguments specified
     // in the command line. First one refers to DISCOVER packets.
     const uint8_t arg_idx = 0;
@@ -1689,15 +2133,20 @@ TestControl::sendDiscover4(const TestControlSocket& socket,
     // Pack the input packet buffer to output buffer so as it can
     // be sent to server.
     pkt4->rawPack();
-    IfaceMgr::instance().send(boost::static_pointer_cast<Pkt4>(pkt4));
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
     if (!preload) {
         if (!stats_mgr4_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                       "hasn't been initialized");
         }
         // Update packet stats.
+        pkt4->updateTimestamp();
         stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO,
-                                    boost::static_pointer_cast<Pkt4>(pkt4));
+                                    boost::static_pointer_cast<Pkt4>(pkt4),
+                                    PacketSender());
+    } else {
+        IfaceMgr::instance().send(boost::static_pointer_cast<Pkt4>(pkt4));
     }
     saveFirstPacket(pkt4);
 }
@@ -1708,7 +2157,11 @@ TestControl::sendRequestFromAck(const TestControlSocket& socket) {
     renew_rate_control_.updateSendTime();
 
     // Get one of the recorded DHCPACK messages.
-    Pkt4Ptr ack = ack_storage_.getRandom();
+    Pkt4Ptr ack;
+    {
+        util::thread::Mutex::Locker lock(mutex_);
+        ack = ack_storage_.getRandom();
+    }
     if (!ack) {
         return (false);
     }
@@ -1717,13 +2170,14 @@ TestControl::sendRequestFromAck(const TestControlSocket& socket) {
     Pkt4Ptr msg = createRequestFromAck(ack);
     setDefaults4(socket, msg);
     msg->pack();
-    // And send it.
-    IfaceMgr::instance().send(msg);
     if (!stats_mgr4_) {
         isc_throw(Unexpected, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
     }
-    stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RNA, msg);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    msg->updateTimestamp();
+    stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RNA, msg, PacketSender());
     return (true);
 }
 
@@ -1742,7 +2196,11 @@ TestControl::sendMessageFromReply(const uint16_t msg_type,
     } else {
         release_rate_control_.updateSendTime();
     }
-    Pkt6Ptr reply = reply_storage_.getRandom();
+    Pkt6Ptr reply;
+    {
+        util::thread::Mutex::Locker lock(mutex_);
+        reply = reply_storage_.getRandom();
+    }
     if (!reply) {
         return (false);
     }
@@ -1750,17 +2208,148 @@ TestControl::sendMessageFromReply(const uint16_t msg_type,
     Pkt6Ptr msg = createMessageFromReply(msg_type, reply);
     setDefaults6(socket, msg);
     msg->pack();
-    // And send it.
-    IfaceMgr::instance().send(msg);
     if (!stats_mgr6_) {
         isc_throw(Unexpected, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
     }
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    msg->updateTimestamp();
     stats_mgr6_->passSentPacket((msg_type == DHCPV6_RENEW ? StatsMgr6::XCHG_RN
-                                 : StatsMgr6::XCHG_RL), msg);
+                                 : StatsMgr6::XCHG_RL), msg, PacketSender());
     return (true);
 }
 
+uint64_t
+TestControl::sendLifecycleMessages(const TestControlSocket& socket) {
+    if (!lease_scheduler4_ && !lease_scheduler6_) {
+        return (0);
+    }
+
+    ptime now = microsec_clock::universal_time();
+    uint64_t sent = 0;
+    if (lease_scheduler4_) {
+        sent = sendLifecycleMessages4(socket, now);
+    } else {
+        sent = sendLifecycleMessages6(socket, now);
+    }
+
+    // Remove the clients which didn't receive the responses. This is
+    // done every second, because it requires traversing all of them.
+    if (time_period(last_lifecycle_purge_, now).length().total_seconds() >= 1) {
+        util::thread::Mutex::Locker lock(mutex_);
+        if (lease_scheduler4_) {
+            lease_scheduler4_->purge(now);
+        } else {
+            lease_scheduler6_->purge(now);
+        }
+        last_lifecycle_purge_ = now;
+    }
+    return (sent);
+}
+
+uint64_t
+TestControl::sendLifecycleMessages4(const TestControlSocket& socket,
+                                    const ptime& now) {
+    uint64_t sent = 0;
+    LeaseScheduler4::Client client;
+    for (;;) {
+        {
+            util::thread::Mutex::Locker lock(mutex_);
+            if (!lease_scheduler4_->getDue(now, client)) {
+                break;
+            }
+        }
+        const LeaseLifecycle::Action action =
+            lease_scheduler4_->getLifecycle().getStep(client.step_).action_;
+        Pkt4Ptr msg;
+        try {
+            msg = createLifecycleMessage4(action, client.lease_);
+        } catch (const isc::Exception&) {
+            // The server's response holds no usable lease, so the client
+            // can't continue its lifecycle.
+            continue;
+        }
+        setDefaults4(socket, msg);
+        msg->pack();
+        ExchangeType xchg_type;
+        const bool has_response = getLifecycleExchange(action, xchg_type);
+        {
+            util::thread::Mutex::Locker lock(mutex_);
+            lease_scheduler4_->messageSent(client, msg->getTransid(),
+                                           has_response, now);
+        }
+        // Record the packet before sending it, because the response may be
+        // processed by the receiver thread (-g multi) as soon as it is sent.
+        if (has_response) {
+            msg->updateTimestamp();
+            stats_mgr4_->passSentPacket(xchg_type, msg, PacketSender());
+        } else {
+            IfaceMgr::instance().send(msg);
+        }
+        ++sent;
+    }
+    return (sent);
+}
+
+uint64_t
+TestControl::sendLifecycleMessages6(const TestControlSocket& socket,
+                                    const ptime& now) {
+    uint64_t sent = 0;
+    LeaseScheduler6::Client client;
+    for (;;) {
+        {
+            util::thread::Mutex::Locker lock(mutex_);
+            if (!lease_scheduler6_->getDue(now, client)) {
+                break;
+            }
+        }
+        const LeaseLifecycle::Action action =
+            lease_scheduler6_->getLifecycle().getStep(client.step_).action_;
+        uint16_t msg_type = DHCPV6_CONFIRM;
+        switch (action) {
+        case LeaseLifecycle::RENEW:
+            msg_type = DHCPV6_RENEW;
+            break;
+        case LeaseLifecycle::REBIND:
+            msg_type = DHCPV6_REBIND;
+            break;
+        case LeaseLifecycle::RELEASE:
+            msg_type = DHCPV6_RELEASE;
+            break;
+        case LeaseLifecycle::DECLINE:
+            msg_type = DHCPV6_DECLINE;
+            break;
+        default:
+            ;
+        }
+        Pkt6Ptr msg;
+        try {
+            msg = createMessageFromReply(msg_type, client.lease_);
+        } catch (const isc::Exception&) {
+            // The server's response holds no usable lease, so the client
+            // can't continue its lifecycle.
+            continue;
+        }
+        setDefaults6(socket, msg);
+        msg->pack();
+        ExchangeType xchg_type;
+        getLifecycleExchange(action, xchg_type);
+        {
+            util::thread::Mutex::Locker lock(mutex_);
+            lease_scheduler6_->messageSent(client, msg->getTransid(), true,
+                                           now);
+        }
+        // Record the packet before sending it, because the response may be
+        // processed by the receiver thread (-g multi) as soon as it is sent.
+        msg->updateTimestamp();
+        stats_mgr6_->passSentPacket(static_cast<StatsMgr6::ExchangeType>
+                                    (xchg_type), msg, PacketSender());
+        ++sent;
+    }
+    return (sent);
+}
+
 void
 TestControl::sendRequest4(const TestControlSocket& socket,
                           const dhcp::Pkt4Ptr& discover_pkt4,
@@ -1815,12 +2404,14 @@ TestControl::sendRequest4(const TestControlSocket& socket,
     pkt4->setSecs(static_cast<uint16_t>(elapsed_time / 1000));
     // Prepare on wire data to send.
     pkt4->pack();
-    IfaceMgr::instance().send(pkt4);
     if (!stats_mgr4_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
     }
-    stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RA, pkt4);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    pkt4->updateTimestamp();
+    stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RA, pkt4, PacketSender());
     saveFirstPacket(pkt4);
 }
 
@@ -1923,14 +2514,16 @@ TestControl::sendRequest4(const TestControlSocket& socket,
     setDefaults4(socket, boost::static_pointer_cast<Pkt4>(pkt4));
     // Prepare on-wire data.
     pkt4->rawPack();
-    IfaceMgr::instance().send(boost::static_pointer_cast<Pkt4>(pkt4));
     if (!stats_mgr4_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
     }
-    // Update packet stats.
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    pkt4->updateTimestamp();
     stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RA,
-                                boost::static_pointer_cast<Pkt4>(pkt4));
+                                boost::static_pointer_cast<Pkt4>(pkt4),
+                                PacketSender());
     saveFirstPacket(pkt4);
 }
 
@@ -1978,12 +2571,14 @@ TestControl::sendRequest6(const TestControlSocket& socket,
     setDefaults6(socket, pkt6);
     // Prepare on-wire data.
     pkt6->pack();
-    IfaceMgr::instance().send(pkt6);
     if (!stats_mgr6_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
     }
-    stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RR, pkt6);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    pkt6->updateTimestamp();
+    stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RR, pkt6, PacketSender());
     saveFirstPacket(pkt6);
 }
 
@@ -2082,30 +2677,32 @@ TestControl::sendRequest6(const TestControlSocket& socket,
     setDefaults6(socket, pkt6);
     // Prepare on wire data.
     pkt6->rawPack();
-    // Send packet.
-    IfaceMgr::instance().send(pkt6);
     if (!stats_mgr6_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
     }
-    // Update packet stats.
-    stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RR, pkt6);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
+    pkt6->updateTimestamp();
+    stats_mgr6_->passSentPacket(StatsMgr6::XCHG_RR, pkt6, PacketSender());
 
     // When 'T' diagnostics flag is specified it means that user requested
     // printing packet contents. It will be just one (first) packet which
     // contents will be printed. Here we check if this packet has been already
     // collected. If it hasn't we save this packet so as we can print its
     // contents when test is finished.
-    if (testDiags('T') &&
-        (template_packets_v6_.find(DHCPV6_REQUEST) == template_packets_v6_.end())) {
-        template_packets_v6_[DHCPV6_REQUEST] = pkt6;
+    if (testDiags('T')) {
+        util::thread::Mutex::Locker lock(mutex_);
+        if (template_packets_v6_.find(DHCPV6_REQUEST) ==
+            template_packets_v6_.end()) {
+            template_packets_v6_[DHCPV6_REQUEST] = pkt6;
+        }
     }
 }
 
 void
 TestControl::sendSolicit6(const TestControlSocket& socket,
                           const bool preload /*= false*/) {
-    basic_rate_control_.updateSendTime();
     // Generate DUID to be passed to the packet
     uint8_t randomized = 0;
     std::vector<uint8_t> duid = generateDuid(randomized);
@@ -2138,13 +2735,18 @@ TestControl::sendSolicit6(const TestControlSocket& socket,
 
     setDefaults6(socket, pkt6);
     pkt6->pack();
-    IfaceMgr::instance().send(pkt6);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
     if (!preload) {
         if (!stats_mgr6_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                       "hasn't been initialized");
         }
-        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
+        pkt6->updateTimestamp();
+        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6,
+                                    PacketSender());
+    } else {
+        IfaceMgr::instance().send(pkt6);
     }
 
     saveFirstPacket(pkt6);
@@ -2154,7 +2756,6 @@ void
 TestControl::sendSolicit6(const TestControlSocket& socket,
                           const std::vector<uint8_t>& template_buf,
                           const bool preload /*= false*/) {
-    basic_rate_control_.updateSendTime();
     const int arg_idx = 0;
     // Get transaction id offset.
     size_t transid_offset = getTransactionIdOffset(arg_idx);
@@ -2182,15 +2783,20 @@ TestControl::sendSolicit6(const TestControlSocket& socket,
     // Prepare on-wire data.
     pkt6->rawPack();
     setDefaults6(socket, pkt6);
-    // Send solicit packet.
-    IfaceMgr::instance().send(pkt6);
+    // Record the packet before sending it, because the response may be
+    // processed by the receiver thread (-g multi) as soon as it is sent.
     if (!preload) {
         if (!stats_mgr6_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                       "hasn't been initialized");
         }
         // Update packet stats.
-        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
+        pkt6->updateTimestamp();
+        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6,
+                                    PacketSender());
+    } else {
+        // Send solicit packet.
+        IfaceMgr::instance().send(pkt6);
     }
     saveFirstPacket(pkt6);
 }
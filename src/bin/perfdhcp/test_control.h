@@ -7,6 +7,7 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "lease_lifecycle.h"
 #include "packet_storage.h"
 #include "rate_control.h"
 #include "stats_mgr.h"
@@ -16,6 +17,8 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <util/random/random_number_generator.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -135,6 +138,16 @@ public:
     typedef std::vector<uint8_t> TemplateBuffer;
     /// Packet template buffers list.
     typedef std::vector<TemplateBuffer> TemplateBufferCollection;
+    /// Scheduler of the DHCPv4 clients' lease lifecycle steps.
+    typedef LeaseScheduler<dhcp::Pkt4> LeaseScheduler4;
+    /// Pointer to the scheduler of the DHCPv4 lifecycle steps.
+    typedef boost::shared_ptr<LeaseScheduler4> LeaseScheduler4Ptr;
+    /// Scheduler of the DHCPv6 clients' lease lifecycle steps.
+    typedef LeaseScheduler<dhcp::Pkt6> LeaseScheduler6;
+    /// Pointer to the scheduler of the DHCPv6 lifecycle steps.
+    typedef boost::shared_ptr<LeaseScheduler6> LeaseScheduler6Ptr;
+    /// Pointer to a sender or receiver thread.
+    typedef boost::shared_ptr<util::thread::Thread> ThreadPtr;
 
     /// \brief Socket wrapper structure.
     ///
@@ -318,19 +331,37 @@ protected:
     /// \return Pointer to the created message.
     dhcp::Pkt4Ptr createRequestFromAck(const dhcp::Pkt4Ptr& ack);
 
+    /// \brief Creates DHCPv4 message for the lease lifecycle step.
+    ///
+    /// Renew and rebind create DHCPREQUEST with ciaddr set to the leased
+    /// address, reboot creates INIT-REBOOT DHCPREQUEST with the leased
+    /// address in the requested address option, release creates
+    /// DHCPRELEASE and decline creates DHCPDECLINE.
+    ///
+    /// \param action lifecycle action.
+    /// \param ack An instance of the DHCPACK message holding the lease.
+    ///
+    /// \return Pointer to the created message.
+    /// \throw isc::BadValue if the DHCPACK is NULL or holds no lease.
+    /// \throw isc::Unexpected if the server identifier is missing in the
+    /// DHCPACK and it is required by the message.
+    dhcp::Pkt4Ptr createLifecycleMessage4(const LeaseLifecycle::Action action,
+                                          const dhcp::Pkt4Ptr& ack);
+
     /// \brief Creates DHCPv6 message from the Reply packet.
     ///
-    /// This function creates DHCPv6 Renew or Release message using the
-    /// data from the Reply message by copying options from the Reply
-    /// message.
+    /// This function creates DHCPv6 Renew, Rebind, Release, Decline or
+    /// Confirm message using the data from the Reply message by copying
+    /// options from the Reply message. The server identifier is not
+    /// included in Rebind and Confirm.
     ///
     /// \param msg_type A type of the message to be created.
     /// \param reply An instance of the Reply packet which contents should
     /// be used to create an instance of the new message.
     ///
-    /// \return created Release or Renew message
-    /// \throw isc::BadValue if the msg_type is neither DHCPV6_RENEW nor
-    /// DHCPV6_RELEASE or if the reply is NULL.
+    /// \return created message
+    /// \throw isc::BadValue if the msg_type is not one of the above or
+    /// if the reply is NULL.
     /// \throw isc::Unexpected if mandatory options are missing in the
     /// Reply message.
     dhcp::Pkt6Ptr createMessageFromReply(const uint16_t msg_type,
@@ -494,6 +525,7 @@ protected:
     ///
     /// \return generated transaction id.
     uint32_t generateTransid() {
+        util::thread::Mutex::Locker lock(mutex_);
         return (transid_gen_->generate());
     }
 
@@ -533,6 +565,21 @@ protected:
     /// the one initialized already it is released.
     void initializeStatsMgr();
 
+    /// \brief Initializes the scheduler of the lease lifecycle steps.
+    ///
+    /// The scheduler is only created if the lifecycle has been specified
+    /// with -z<lifecycle>.
+    void initializeLeaseScheduler();
+
+    /// \brief Returns the exchange type of the lease lifecycle action.
+    ///
+    /// \param action lifecycle action.
+    /// \param [out] xchg_type exchange type.
+    /// \return false if the action has no response (DHCPv4 release and
+    /// decline), true otherwise.
+    static bool getLifecycleExchange(const LeaseLifecycle::Action action,
+                                     ExchangeType& xchg_type);
+
     /// \brief Open socket to communicate with DHCP server.
     ///
     /// Method opens socket and binds it to local address. Function will
@@ -559,6 +606,13 @@ protected:
     /// received packets and dropped packets so far.
     void printIntermediateStats();
 
+    /// \brief Print intermediate statistics in the selected format.
+    ///
+    /// \tparam StatsMgrType StatsMgr4 or StatsMgr6 class.
+    /// \param stats_mgr statistics manager holding the statistics.
+    template<class StatsMgrType>
+    void printIntermediateStats(const StatsMgrType& stats_mgr) const;
+
     /// \brief Print rate statistics.
     ///
     /// Method print packet exchange rate statistics.
@@ -571,6 +625,16 @@ protected:
     /// not initialized.
     void printStats() const;
 
+    /// \brief Print lease lifecycle statistics.
+    ///
+    /// Print the number of messages sent for each lifecycle action and
+    /// the number of clients which completed the lifecycle.
+    ///
+    /// \param scheduler scheduler of the lifecycle steps.
+    /// \tparam SchedulerType LeaseScheduler4 or LeaseScheduler6 class.
+    template<class SchedulerType>
+    void printLifecycleStats(const SchedulerType& scheduler) const;
+
     /// \brief Process received DHCPv4 packet.
     ///
     /// Method performs processing of the received DHCPv4 packet,
@@ -748,6 +812,62 @@ protected:
                      const uint64_t packets_num,
                      const bool preload = false);
 
+    /// \brief Initiate a single new exchange with the server.
+    ///
+    /// Sends DHCPDISCOVER or Solicit message, using a template packet
+    /// if it has been specified.
+    ///
+    /// \param socket socket to be used to send the packet.
+    /// \param preload preload mode, packet not included in statistics.
+    void initiateExchange(const TestControlSocket& socket,
+                          const bool preload);
+
+    /// \brief Send Renews and Releases, print intermediate report and
+    /// remove excessive cached replies.
+    ///
+    /// This function is called periodically in the main loop of the test.
+    ///
+    /// \param socket socket to be used to send packets.
+    void runPeriodicTasks(const TestControlSocket& socket);
+
+    /// \brief Run the test using the separate sender and receiver threads.
+    ///
+    /// This function is used when -g multi is specified. It starts the
+    /// receiver thread and the number of sender threads specified with
+    /// -G<senders>, dividing the exchange rate among the senders. The
+    /// calling thread checks the exit conditions, sends Renews and
+    /// Releases and prints the reports. It returns when the test is
+    /// finished and all threads have been stopped.
+    ///
+    /// \param socket socket to be used to send and receive packets.
+    /// \throw isc::Unexpected if any of the threads failed.
+    void runThreads(const TestControlSocket& socket);
+
+    /// \brief Body of the receiver thread.
+    ///
+    /// \param socket socket to be used to receive packets.
+    void receiveThread(const TestControlSocket& socket);
+
+    /// \brief Body of a sender thread.
+    ///
+    /// \param socket socket to be used to send packets.
+    /// \param rate_control rate control object of this sender.
+    void sendThread(const TestControlSocket& socket,
+                    const RateControlPtr& rate_control);
+
+    /// \brief Signal the sender and receiver threads to stop.
+    void stopThreads();
+
+    /// \brief Check if the sender and receiver threads should stop.
+    bool threadsStopped() const;
+
+    /// \brief Wait for the threads to terminate.
+    ///
+    /// \param threads threads to be waited for.
+    /// \return error message of the first failed thread or empty string.
+    static std::string
+    joinThreads(const std::vector<ThreadPtr>& threads);
+
     /// \brief Send number of DHCPREQUEST (renew) messages to a server.
     ///
     /// \param socket An object representing socket to be used to send packets.
@@ -792,6 +912,32 @@ protected:
     bool sendMessageFromReply(const uint16_t msg_type,
                               const TestControlSocket& socket);
 
+    /// \brief Send messages for the due lease lifecycle steps.
+    ///
+    /// Sends the messages of all clients whose next lifecycle step is
+    /// due and removes the clients which didn't receive the response
+    /// in time.
+    ///
+    /// \param socket socket to be used to send the messages.
+    /// \return number of messages sent.
+    uint64_t sendLifecycleMessages(const TestControlSocket& socket);
+
+    /// \brief Send DHCPv4 messages for the due lease lifecycle steps.
+    ///
+    /// \param socket socket to be used to send the messages.
+    /// \param now current time.
+    /// \return number of messages sent.
+    uint64_t sendLifecycleMessages4(const TestControlSocket& socket,
+                                    const boost::posix_time::ptime& now);
+
+    /// \brief Send DHCPv6 messages for the due lease lifecycle steps.
+    ///
+    /// \param socket socket to be used to send the messages.
+    /// \param now current time.
+    /// \return number of messages sent.
+    uint64_t sendLifecycleMessages6(const TestControlSocket& socket,
+                                    const boost::posix_time::ptime& now);
+
     /// \brief Send DHCPv4 REQUEST message.
     ///
     /// Method creates and sends DHCPv4 REQUEST message to the server.
@@ -1119,6 +1265,13 @@ protected:
     PacketStorage<dhcp::Pkt4> ack_storage_; ///< A storage for DHCPACK messages.
     PacketStorage<dhcp::Pkt6> reply_storage_; ///< A storage for reply messages.
 
+    LeaseScheduler4Ptr lease_scheduler4_; ///< DHCPv4 lifecycle scheduler.
+    LeaseScheduler6Ptr lease_scheduler6_; ///< DHCPv6 lifecycle scheduler.
+
+    /// Last time the lifecycle clients waiting for the responses were
+    /// checked for timeouts.
+    boost::posix_time::ptime last_lifecycle_purge_;
+
     NumberGeneratorPtr transid_gen_; ///< Transaction id generator.
     NumberGeneratorPtr macaddr_gen_; ///< Numbers generator for MAC address.
 
@@ -1134,6 +1287,13 @@ protected:
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
     static bool interrupted_;  ///< Is program interrupted.
+
+    /// \brief Mutex protecting the data shared between the threads
+    /// in the multi thread mode.
+    mutable util::thread::Mutex mutex_;
+
+    /// \brief Indicates that the sender and receiver threads should stop.
+    bool threads_stopped_;
 };
 
 } // namespace perfdhcp
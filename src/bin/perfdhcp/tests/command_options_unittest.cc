@@ -180,6 +180,10 @@ protected:
         EXPECT_EQ(0, opt.getReleaseRate());
         EXPECT_EQ(0, opt.getReportDelay());
         EXPECT_EQ(0, opt.getClientsNum());
+        EXPECT_TRUE(opt.isSingleThreaded());
+        EXPECT_EQ(1, opt.getSendersNum());
+        EXPECT_EQ(CommandOptions::REPORT_TEXT, opt.getReportFormat());
+        EXPECT_TRUE(opt.getLeaseLifecycle().empty());
 
         // default mac
         const uint8_t mac[6] = { 0x00, 0x0C, 0x01, 0x02, 0x03, 0x04 };
@@ -785,6 +789,80 @@ TEST_F(CommandOptionsTest, Period) {
                  isc::InvalidParameter);
 }
 
+TEST_F(CommandOptionsTest, ThreadMode) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -g single -l ethx all"));
+    EXPECT_TRUE(opt.isSingleThreaded());
+    EXPECT_EQ(1, opt.getSendersNum());
+
+    EXPECT_NO_THROW(process("perfdhcp -g multi -G 4 -r 100 -l ethx all"));
+    EXPECT_FALSE(opt.isSingleThreaded());
+    EXPECT_EQ(4, opt.getSendersNum());
+
+    // The number of senders is not limited when the rate is unlimited.
+    EXPECT_NO_THROW(process("perfdhcp -g multi -G 8 -l ethx all"));
+    EXPECT_EQ(8, opt.getSendersNum());
+
+    // Negative test cases
+    // Thread mode must be single or multi
+    EXPECT_THROW(process("perfdhcp -g many -l ethx all"),
+                 isc::InvalidParameter);
+    // Number of senders must be a positive integer
+    EXPECT_THROW(process("perfdhcp -g multi -G 0 -l ethx all"),
+                 isc::InvalidParameter);
+    // More than one sender requires multi thread mode
+    EXPECT_THROW(process("perfdhcp -G 2 -l ethx all"),
+                 isc::InvalidParameter);
+    // Each sender must have a non-zero rate
+    EXPECT_THROW(process("perfdhcp -g multi -G 4 -r 2 -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, ReportFormat) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -r 10 -t 1 -y text -l ethx all"));
+    EXPECT_EQ(CommandOptions::REPORT_TEXT, opt.getReportFormat());
+
+    EXPECT_NO_THROW(process("perfdhcp -r 10 -t 1 -y csv -l ethx all"));
+    EXPECT_EQ(CommandOptions::REPORT_CSV, opt.getReportFormat());
+
+    EXPECT_NO_THROW(process("perfdhcp -r 10 -t 1 -y json -l ethx all"));
+    EXPECT_EQ(CommandOptions::REPORT_JSON, opt.getReportFormat());
+
+    // Negative test cases
+    // Unsupported format
+    EXPECT_THROW(process("perfdhcp -r 10 -t 1 -y xml -l ethx all"),
+                 isc::InvalidParameter);
+    // Format is only used for the periodic reports
+    EXPECT_THROW(process("perfdhcp -r 10 -y csv -l ethx all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, LeaseLifecycle) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -4 -z renew:30,rebind:20,release:5"
+                            " -l ethx all"));
+    ASSERT_EQ(3, opt.getLeaseLifecycle().getStepsNum());
+    EXPECT_EQ(LeaseLifecycle::REBIND,
+              opt.getLeaseLifecycle().getStep(1).action_);
+
+    EXPECT_NO_THROW(process("perfdhcp -6 -z reboot:60 -l ethx all"));
+    ASSERT_EQ(1, opt.getLeaseLifecycle().getStepsNum());
+
+    // Negative test cases
+    // Invalid lifecycle
+    EXPECT_THROW(process("perfdhcp -z renew -l ethx all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -z release:1,renew:1 -l ethx all"),
+                 isc::InvalidParameter);
+    // The lifecycle starts after the 4-way exchange
+    EXPECT_THROW(process("perfdhcp -i -z renew:1 -l ethx all"),
+                 isc::InvalidParameter);
+    // The lifecycle replaces the renew and release rates
+    EXPECT_THROW(process("perfdhcp -6 -r 10 -f 5 -z renew:1 -l ethx all"),
+                 isc::InvalidParameter);
+}
+
 TEST_F(CommandOptionsTest, Interface) {
     // In order to make this test portable we need to know
     // at least one interface name on OS where test is run.
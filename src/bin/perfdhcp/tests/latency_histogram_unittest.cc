@@ -0,0 +1,113 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "latency_histogram.h"
+#include <gtest/gtest.h>
+
+
+using namespace isc;
+using namespace isc::perfdhcp;
+
+namespace {
+
+// This test verifies that the empty histogram returns zeros.
+TEST(LatencyHistogram, empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+    EXPECT_EQ(0, histogram.getPercentile(99.9));
+}
+
+// This test verifies that small values are recorded exactly and the
+// percentiles are calculated correctly.
+TEST(LatencyHistogram, exactValues) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 20; ++i) {
+        histogram.add(i);
+    }
+    EXPECT_EQ(20, histogram.getCount());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(20, histogram.getMax());
+    EXPECT_EQ(1, histogram.getPercentile(0));
+    EXPECT_EQ(10, histogram.getPercentile(50));
+    EXPECT_EQ(19, histogram.getPercentile(95));
+    EXPECT_EQ(20, histogram.getPercentile(99));
+    EXPECT_EQ(20, histogram.getPercentile(100));
+
+    EXPECT_THROW(histogram.getPercentile(-1), isc::OutOfRange);
+    EXPECT_THROW(histogram.getPercentile(100.1), isc::OutOfRange);
+}
+
+// This test verifies that the bucket indexes grow with the values and
+// each value is lower or equal to the upper bound of its bucket within
+// the declared precision.
+TEST(LatencyHistogram, buckets) {
+    size_t previous = 0;
+    for (uint64_t value = 1; value < LatencyHistogram::MAX_VALUE;
+         value = value * 3 / 2 + 1) {
+        size_t index = LatencyHistogram::getBucketIndex(value);
+        EXPECT_GE(index, previous);
+        previous = index;
+
+        uint64_t upper = LatencyHistogram::getBucketUpperBound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / LatencyHistogram::SUB_BUCKETS_NUM)
+            << "value " << value;
+    }
+
+    // Values out of range are recorded in the last bucket.
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(LatencyHistogram::MAX_VALUE),
+              LatencyHistogram::getBucketIndex(LatencyHistogram::MAX_VALUE *
+                                               2));
+}
+
+// This test verifies the percentiles of the widely spread values, e.g.
+// when most of the responses are fast and some of them are delayed.
+TEST(LatencyHistogram, tail) {
+    LatencyHistogram histogram;
+    // 990 responses around 1ms, 9 around 50ms and one 2s.
+    for (int i = 0; i < 990; ++i) {
+        histogram.add(1000 + i % 10);
+    }
+    for (int i = 0; i < 9; ++i) {
+        histogram.add(50000);
+    }
+    histogram.add(2000000);
+
+    EXPECT_EQ(1000, histogram.getCount());
+    EXPECT_NEAR(1000, histogram.getPercentile(50), 1000 / 32);
+    EXPECT_NEAR(1000, histogram.getPercentile(99), 1000 / 32);
+    EXPECT_NEAR(50000, histogram.getPercentile(99.9), 50000 / 32);
+    EXPECT_EQ(2000000, histogram.getPercentile(100));
+}
+
+// This test verifies that histograms can be merged and cleared.
+TEST(LatencyHistogram, mergeClear) {
+    LatencyHistogram histogram1;
+    LatencyHistogram histogram2;
+    histogram1.add(10);
+    histogram2.add(5);
+    histogram2.add(100000);
+
+    histogram1.merge(histogram2);
+    EXPECT_EQ(3, histogram1.getCount());
+    EXPECT_EQ(5, histogram1.getMin());
+    EXPECT_EQ(100000, histogram1.getMax());
+    EXPECT_EQ(10, histogram1.getPercentile(50));
+
+    histogram1.clear();
+    EXPECT_EQ(0, histogram1.getCount());
+    EXPECT_EQ(0, histogram1.getMax());
+    EXPECT_EQ(0, histogram1.getPercentile(50));
+
+    // The merged histogram is not affected.
+    EXPECT_EQ(2, histogram2.getCount());
+}
+
+}
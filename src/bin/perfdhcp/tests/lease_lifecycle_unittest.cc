@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <exceptions/exceptions.h>
+#include "lease_lifecycle.h"
+#include <gtest/gtest.h>
+
+
+using namespace isc;
+using namespace isc::perfdhcp;
+using namespace boost::posix_time;
+
+namespace {
+
+/// \brief Packet stub used to test the scheduler.
+class TestPacket {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param transid transaction id.
+    explicit TestPacket(const uint32_t transid)
+        : transid_(transid) {
+    }
+
+    /// \brief Returns transaction id.
+    uint32_t getTransid() const {
+        return (transid_);
+    }
+
+private:
+    uint32_t transid_;
+};
+
+typedef boost::shared_ptr<TestPacket> TestPacketPtr;
+typedef LeaseScheduler<TestPacket> TestScheduler;
+
+// This test verifies that the lifecycle is parsed correctly.
+TEST(LeaseLifecycle, fromText) {
+    LeaseLifecycle lifecycle;
+    ASSERT_NO_THROW(lifecycle =
+                    LeaseLifecycle::fromText("renew:30,rebind:2.5,release:0"));
+    ASSERT_EQ(3, lifecycle.getStepsNum());
+    EXPECT_EQ(LeaseLifecycle::RENEW, lifecycle.getStep(0).action_);
+    EXPECT_EQ(seconds(30), lifecycle.getStep(0).delay_);
+    EXPECT_EQ(LeaseLifecycle::REBIND, lifecycle.getStep(1).action_);
+    EXPECT_EQ(milliseconds(2500), lifecycle.getStep(1).delay_);
+    EXPECT_EQ(LeaseLifecycle::RELEASE, lifecycle.getStep(2).action_);
+    EXPECT_EQ(seconds(0), lifecycle.getStep(2).delay_);
+    EXPECT_EQ("renew:30,rebind:2.5,release:0", lifecycle.toText());
+
+    EXPECT_TRUE(lifecycle.includes(LeaseLifecycle::REBIND));
+    EXPECT_FALSE(lifecycle.includes(LeaseLifecycle::REBOOT));
+
+    ASSERT_NO_THROW(lifecycle = LeaseLifecycle::fromText("reboot:60"));
+    EXPECT_EQ(1, lifecycle.getStepsNum());
+    ASSERT_NO_THROW(lifecycle = LeaseLifecycle::fromText("decline:0"));
+    EXPECT_EQ(1, lifecycle.getStepsNum());
+}
+
+// This test verifies that invalid lifecycles are rejected.
+TEST(LeaseLifecycle, fromTextInvalid) {
+    EXPECT_THROW(LeaseLifecycle::fromText(""), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("renew"), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("renew:"), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("renew:-1"), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("renew:abc"), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("solicit:1"), isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("renew:1,"), isc::BadValue);
+    // Nothing can follow the release or decline.
+    EXPECT_THROW(LeaseLifecycle::fromText("release:1,renew:1"),
+                 isc::BadValue);
+    EXPECT_THROW(LeaseLifecycle::fromText("decline:0,reboot:1"),
+                 isc::BadValue);
+}
+
+// This test verifies that the clients take the lifecycle steps in order
+// and at the due time.
+TEST(LeaseScheduler, steps) {
+    TestScheduler scheduler(LeaseLifecycle::fromText("renew:10,release:5"),
+                            seconds(1));
+    ptime now = microsec_clock::universal_time();
+
+    TestPacketPtr lease1(new TestPacket(1));
+    TestPacketPtr lease2(new TestPacket(2));
+    scheduler.leaseAcquired(lease1, now);
+    scheduler.leaseAcquired(lease2, now + seconds(1));
+    EXPECT_EQ(2, scheduler.getActiveNum());
+
+    // Nothing is due yet.
+    TestScheduler::Client client;
+    EXPECT_FALSE(scheduler.getDue(now + seconds(9), client));
+
+    // The first client is due to renew.
+    ASSERT_TRUE(scheduler.getDue(now + seconds(10), client));
+    EXPECT_EQ(lease1, client.lease_);
+    EXPECT_EQ(0, client.step_);
+    EXPECT_FALSE(scheduler.getDue(now + seconds(10), client));
+
+    // The client sends Renew and waits for the response.
+    scheduler.messageSent(client, 100, true, now + seconds(10));
+    EXPECT_EQ(1, scheduler.getSentNum(LeaseLifecycle::RENEW));
+    EXPECT_EQ(2, scheduler.getActiveNum());
+
+    // Unrelated response is ignored.
+    LeaseLifecycle::Action action;
+    EXPECT_FALSE(scheduler.responseReceived(TestPacketPtr(new TestPacket(5)),
+                                            now + seconds(10), action));
+
+    // The response renews the lease and the client proceeds to the
+    // release step.
+    TestPacketPtr renewed(new TestPacket(100));
+    ASSERT_TRUE(scheduler.responseReceived(renewed, now + seconds(10),
+                                           action));
+    EXPECT_EQ(LeaseLifecycle::RENEW, action);
+
+    // The second client is due to renew before the first one releases.
+    ASSERT_TRUE(scheduler.getDue(now + seconds(20), client));
+    EXPECT_EQ(lease2, client.lease_);
+    EXPECT_EQ(0, client.step_);
+
+    ASSERT_TRUE(scheduler.getDue(now + seconds(20), client));
+    EXPECT_EQ(renewed, client.lease_);
+    EXPECT_EQ(1, client.step_);
+
+    // Release without the response completes the lifecycle.
+    scheduler.messageSent(client, 101, false, now + seconds(20));
+    EXPECT_EQ(1, scheduler.getSentNum(LeaseLifecycle::RELEASE));
+    EXPECT_EQ(1, scheduler.getCompletedNum());
+}
+
+// This test verifies that the clients which don't receive the response
+// are removed.
+TEST(LeaseScheduler, purge) {
+    TestScheduler scheduler(LeaseLifecycle::fromText("reboot:0"),
+                            seconds(2));
+    ptime now = microsec_clock::universal_time();
+
+    scheduler.leaseAcquired(TestPacketPtr(new TestPacket(1)), now);
+    TestScheduler::Client client;
+    ASSERT_TRUE(scheduler.getDue(now, client));
+    scheduler.messageSent(client, 7, true, now);
+
+    scheduler.purge(now + seconds(1));
+    EXPECT_EQ(1, scheduler.getActiveNum());
+    EXPECT_EQ(0, scheduler.getLostNum());
+
+    scheduler.purge(now + seconds(2));
+    EXPECT_EQ(0, scheduler.getActiveNum());
+    EXPECT_EQ(1, scheduler.getLostNum());
+
+    // The late response is ignored.
+    LeaseLifecycle::Action action;
+    EXPECT_FALSE(scheduler.responseReceived(TestPacketPtr(new TestPacket(7)),
+                                            now + seconds(3), action));
+    EXPECT_EQ(0, scheduler.getCompletedNum());
+}
+
+}
@@ -279,6 +279,8 @@ TEST_F(StatsMgrTest, Constructor) {
     EXPECT_THROW(stats_mgr->getAvgDelay(StatsMgr4::XCHG_DO), InvalidOperation);
     EXPECT_THROW(stats_mgr->getStdDevDelay(StatsMgr4::XCHG_DO),
                  InvalidOperation);
+    EXPECT_THROW(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 99),
+                 InvalidOperation);
     EXPECT_THROW(stats_mgr->getAvgUnorderedLookupSetSize(StatsMgr4::XCHG_DO),
                  InvalidOperation);
 }
@@ -411,6 +413,49 @@ TEST_F(StatsMgrTest, SendReceiveSimple) {
     EXPECT_EQ(1, stats_mgr->getOrphans(StatsMgr4::XCHG_DO));
 }
 
+/// @brief Test send function recording the packets it sends.
+struct TestPacketSender {
+    /// @brief Constructor.
+    ///
+    /// @param sent Storage for the sent packets.
+    TestPacketSender(std::vector<Pkt4Ptr>& sent)
+        : sent_(sent) {
+    }
+
+    /// @brief Records the sent packet.
+    void operator()(const Pkt4Ptr& pkt) const {
+        sent_.push_back(pkt);
+    }
+
+    /// @brief Sent packets.
+    std::vector<Pkt4Ptr>& sent_;
+};
+
+TEST_F(StatsMgrTest, SendWithSendFunction) {
+    boost::scoped_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                      common_transid));
+    boost::shared_ptr<Pkt4> rcvd_packet(createPacket4(DHCPOFFER,
+                                                      common_transid));
+    std::vector<Pkt4Ptr> sent;
+    EXPECT_THROW(stats_mgr->passSentPacket(StatsMgr4::XCHG_DO, sent_packet,
+                                           TestPacketSender(sent)),
+                 BadValue);
+    EXPECT_TRUE(sent.empty());
+
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_DO);
+    ASSERT_NO_THROW(stats_mgr->passSentPacket(StatsMgr4::XCHG_DO, sent_packet,
+                                              TestPacketSender(sent)));
+    // The packet has been both recorded and sent.
+    ASSERT_EQ(1, sent.size());
+    EXPECT_TRUE(sent[0] == sent_packet);
+    EXPECT_EQ(1, stats_mgr->getSentPacketsNum(StatsMgr4::XCHG_DO));
+    ASSERT_NO_THROW(stats_mgr->passRcvdPacket(StatsMgr4::XCHG_DO,
+                                              rcvd_packet));
+    EXPECT_EQ(1, stats_mgr->getRcvdPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(0, stats_mgr->getOrphans(StatsMgr4::XCHG_DO));
+}
+
 TEST_F(StatsMgrTest, SendReceiveUnordered) {
     const int packets_num = 10;
     boost::scoped_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
@@ -508,6 +553,14 @@ TEST_F(StatsMgrTest, Delays) {
     passDOPacketsWithDelay(stats_mgr, delay2, common_transid + 1);
     // Standard deviation is expected to be non-zero.
     EXPECT_GT(stats_mgr->getStdDevDelay(StatsMgr4::XCHG_DO), 0);
+
+    // The median is the shorter delay and the 99th percentile is the
+    // longer one, within the histogram precision.
+    EXPECT_GT(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 50), 1);
+    EXPECT_LT(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 50), 2);
+    EXPECT_GT(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 99), 2);
+    EXPECT_LE(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 99),
+              stats_mgr->getMaxDelay(StatsMgr4::XCHG_DO));
 }
 
 TEST_F(StatsMgrTest, CustomCounters) {
@@ -570,6 +623,18 @@ TEST_F(StatsMgrTest, PrintStats) {
     // exchange needed to count the average delay and std deviation.
     EXPECT_NO_THROW(stats_mgr->printStats());
 
+    // Periodic reports are printed in all formats. They must not change
+    // the formatting of the standard output.
+    std::cout.unsetf(std::ios_base::floatfield);
+    std::cout.precision(6);
+    const std::ios_base::fmtflags flags = std::cout.flags();
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStats());
+    EXPECT_NO_THROW(StatsMgr6::printIntermediateStatsCsvHeader());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStatsCsv());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStatsJson());
+    EXPECT_EQ(flags, std::cout.flags());
+    EXPECT_EQ(6, std::cout.precision());
+
     // Printing timestamps is expected to fail because by default we
     // disable packets archiving mode. Without packets we can't get
     // timestamps.
@@ -102,6 +102,7 @@ public:
     using TestControl::checkExitConditions;
     using TestControl::createMessageFromReply;
     using TestControl::createRequestFromAck;
+    using TestControl::createLifecycleMessage4;
     using TestControl::factoryElapsedTime6;
     using TestControl::factoryGeneric;
     using TestControl::factoryIana6;
@@ -1747,6 +1748,101 @@ TEST_F(TestControlTest, createRelease) {
     testCreateRenewRelease(DHCPV6_RELEASE);
 }
 
+// This test verifies that the DHCPv4 messages sent in the lease lifecycle
+// steps are created correctly from the DHCPACK message.
+TEST_F(TestControlTest, createLifecycleMessage4) {
+    ASSERT_NO_THROW(processCmdLine("perfdhcp -4 -l lo -r 10 -z reboot:1"
+                                   " -L 10067 127.0.0.1"));
+    NakedTestControl tc;
+    boost::shared_ptr<NakedTestControl::IncrementalGenerator>
+        generator(new NakedTestControl::IncrementalGenerator());
+    tc.setTransidGenerator(generator);
+
+    Pkt4Ptr ack = createAckPkt4(1);
+
+    // Rebinding DHCPREQUEST carries the address in ciaddr.
+    Pkt4Ptr msg;
+    ASSERT_NO_THROW(msg = tc.createLifecycleMessage4(LeaseLifecycle::REBIND,
+                                                     ack));
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(DHCPREQUEST, msg->getType());
+    EXPECT_EQ("127.0.0.1", msg->getCiaddr().toText());
+
+    // INIT-REBOOT DHCPREQUEST carries the address in the requested address
+    // option and has no server identifier.
+    ASSERT_NO_THROW(msg = tc.createLifecycleMessage4(LeaseLifecycle::REBOOT,
+                                                     ack));
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(DHCPREQUEST, msg->getType());
+    EXPECT_TRUE(msg->getCiaddr().isV4Zero());
+    OptionPtr opt_requested = msg->getOption(DHO_DHCP_REQUESTED_ADDRESS);
+    ASSERT_TRUE(opt_requested);
+    EXPECT_EQ(ack->getYiaddr().toUint32(), opt_requested->getUint32());
+    EXPECT_FALSE(msg->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    ASSERT_TRUE(msg->getHWAddr());
+    EXPECT_TRUE(ack->getHWAddr()->hwaddr_ == msg->getHWAddr()->hwaddr_);
+
+    // DHCPRELEASE carries the address in ciaddr and the server identifier.
+    ASSERT_NO_THROW(msg = tc.createLifecycleMessage4(LeaseLifecycle::RELEASE,
+                                                     ack));
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(DHCPRELEASE, msg->getType());
+    EXPECT_EQ("127.0.0.1", msg->getCiaddr().toText());
+    EXPECT_TRUE(msg->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+
+    // DHCPDECLINE carries the address in the requested address option
+    // and the server identifier.
+    ASSERT_NO_THROW(msg = tc.createLifecycleMessage4(LeaseLifecycle::DECLINE,
+                                                     ack));
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(DHCPDECLINE, msg->getType());
+    EXPECT_TRUE(msg->getCiaddr().isV4Zero());
+    EXPECT_TRUE(msg->getOption(DHO_DHCP_REQUESTED_ADDRESS));
+    EXPECT_TRUE(msg->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+
+    // The release can't be created without the server identifier.
+    ack->delOption(DHO_DHCP_SERVER_IDENTIFIER);
+    EXPECT_THROW(tc.createLifecycleMessage4(LeaseLifecycle::RELEASE, ack),
+                 isc::Unexpected);
+    EXPECT_THROW(tc.createLifecycleMessage4(LeaseLifecycle::REBOOT,
+                                            Pkt4Ptr()),
+                 isc::BadValue);
+}
+
+// This test verifies that the DHCPv6 Rebind and Confirm messages are
+// created from the Reply without the server identifier.
+TEST_F(TestControlTest, createRebindConfirm) {
+    ASSERT_NO_THROW(processCmdLine("perfdhcp -6 -l lo -r 10 -z rebind:1"
+                                   " -L 10547 -e address-and-prefix ::1"));
+    NakedTestControl tc;
+    boost::shared_ptr<NakedTestControl::IncrementalGenerator>
+        generator(new NakedTestControl::IncrementalGenerator());
+    tc.setTransidGenerator(generator);
+
+    Pkt6Ptr reply = createReplyPkt6(1);
+    const uint16_t msg_types[] = { DHCPV6_REBIND, DHCPV6_CONFIRM };
+    for (int i = 0; i < 2; ++i) {
+        Pkt6Ptr msg;
+        ASSERT_NO_THROW(msg = tc.createMessageFromReply(msg_types[i], reply));
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg_types[i], msg->getType());
+        EXPECT_TRUE(msg->getOption(D6O_CLIENTID));
+        EXPECT_FALSE(msg->getOption(D6O_SERVERID));
+        EXPECT_TRUE(msg->getOption(D6O_IA_NA));
+        EXPECT_TRUE(msg->getOption(D6O_IA_PD));
+    }
+
+    // Decline includes the server identifier.
+    Pkt6Ptr msg;
+    ASSERT_NO_THROW(msg = tc.createMessageFromReply(DHCPV6_DECLINE, reply));
+    ASSERT_TRUE(msg);
+    EXPECT_TRUE(msg->getOption(D6O_SERVERID));
+
+    // Messages not related to the existing leases are not created.
+    EXPECT_THROW(tc.createMessageFromReply(DHCPV6_SOLICIT, reply),
+                 isc::BadValue);
+}
+
 // This test verifies that the current timeout value for waiting for
 // the server's responses is valid. The timeout value corresponds to the
 // time period between now and the next message to be sent from the
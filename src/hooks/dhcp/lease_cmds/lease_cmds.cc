@@ -13,20 +13,27 @@
 #include <asiolink/io_address.h>
 #include <lease_cmds_log.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/memfile_lease_storage.h>
 #include <dhcpsrv/subnet_id.h>
 #include <dhcp/duid.h>
 #include <util/encode/hex.h>
 #include <util/strutil.h>
 #include <exceptions/exceptions.h>
 #include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <sstream>
 #include <string>
+#include <vector>
 
 using namespace isc::dhcp;
 using namespace isc::data;
 using namespace isc::config;
 using namespace isc::asiolink;
+using namespace isc::util;
 using namespace std;
 
 namespace isc {
@@ -240,6 +247,154 @@ private:
     static ConstElementPtr
     leaseGetHandler(const string& command, ConstElementPtr args);
 
+    /// @brief lease4-get-all, lease6-get-all commands handler
+    ///
+    /// These commands attempt to retrieve all IPv4 or IPv6 leases, or
+    /// all IPv4 or all IPv6 leases belonging to the particular subnets.
+    /// If no subnet identifiers are provided, it returns all IPv4 or IPv6
+    /// leases from the database.
+    ///
+    /// Example command for IPv4 query by subnet identifiers:
+    /// {
+    ///     "command": "lease4-get-all",
+    ///     "arguments": {
+    ///         "subnets": [ 1, 2, 3, 4 ]
+    ///     }
+    /// }
+    ///
+    /// Example command for retrieving all IPv6 leases:
+    /// {
+    ///     "command": "lease6-get-all"
+    /// }
+    ///
+    /// @param command "lease4-get-all" or "lease6-get-all"
+    /// @param args optional list of subnet identifiers.
+    /// @return result of the operation (includes lease details, if found)
+    static ConstElementPtr
+    leaseGetAllHandler(const string& command, ConstElementPtr args);
+
+    /// @brief lease4-get-page, lease6-get-page commands handler
+    ///
+    /// These commands attempt to retrieve 1 page of leases. The size of
+    /// the page is specified by the caller. The caller also specifies
+    /// the last address returned in the previous page. The new page
+    /// starts from the first address following the address specified
+    /// by the caller. If the first page should be returned the IPv4
+    /// zero address, IPv6 zero address or the keyword "start" should
+    /// be provided instead of the last address.
+    ///
+    /// The leases are returned in the ascending order of addresses so
+    /// the caller can iterate over all leases without holding any state
+    /// in the server between the calls. This limits the size of the
+    /// response sent to the caller regardless of the number of leases
+    /// in the database.
+    ///
+    /// Example command for IPv4 query:
+    /// {
+    ///     "command": "lease4-get-page",
+    ///     "arguments": {
+    ///         "from": "start",
+    ///         "limit": 1000
+    ///     }
+    /// }
+    ///
+    /// Example command for IPv6 query:
+    /// {
+    ///     "command": "lease6-get-page",
+    ///     "arguments": {
+    ///         "from": "2001:db8:1::20",
+    ///         "limit": 1000
+    ///     }
+    /// }
+    ///
+    /// @param command "lease4-get-page" or "lease6-get-page".
+    /// @param args arguments specifying the lower bound address and the
+    /// page size.
+    /// @return result of the operation (includes lease details, if found)
+    static ConstElementPtr
+    leaseGetPageHandler(const string& command, ConstElementPtr args);
+
+    /// @brief lease4-bulk-apply, lease6-bulk-apply commands handler
+    ///
+    /// These commands add or update multiple leases at once. The leases
+    /// are either specified in the "leases" list, using the same format
+    /// as for the lease4-add and lease6-add commands, or read from the
+    /// file specified with the "file" parameter. The file must use the
+    /// format of the memfile lease database. If the file contains multiple
+    /// entries for the same address, the last entry is used. The entries
+    /// with a valid lifetime of 0 (removed leases) are skipped.
+    ///
+    /// Each lease is validated against the current configuration before
+    /// any changes are made to the lease database. The valid leases are
+    /// then written to the database. If the database supports transactions,
+    /// all of them are written within a single transaction and a failure to
+    /// write any lease rolls back the whole transaction. Otherwise, each
+    /// lease is written separately and the failure to write a lease doesn't
+    /// affect the remaining leases.
+    ///
+    /// The leases that couldn't be applied are returned in the
+    /// "failed-leases" list. Each entry holds the "ip-address" of the
+    /// lease (or the "row" of the lease file if the row couldn't be
+    /// parsed) and the "error-message".
+    ///
+    /// Example command for IPv4 leases:
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "leases": [
+    ///             {
+    ///                 "ip-address": "192.0.2.202",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///                 "subnet-id": 44
+    ///             },
+    ///             {
+    ///                 "ip-address": "192.0.2.203",
+    ///                 "hw-address": "2a:2b:2c:2d:2e:2f",
+    ///                 "subnet-id": 44
+    ///             }
+    ///         ]
+    ///     }
+    /// }
+    ///
+    /// Example command for IPv6 leases read from a file:
+    /// {
+    ///     "command": "lease6-bulk-apply",
+    ///     "arguments": {
+    ///         "file": "/var/lib/kea/kea-leases6.csv"
+    ///     }
+    /// }
+    ///
+    /// @param command "lease4-bulk-apply" or "lease6-bulk-apply".
+    /// @param args list of leases or the lease file name.
+    /// @return result of the operation (includes the number of applied
+    /// leases and the leases that couldn't be applied)
+    static ConstElementPtr
+    leaseBulkApplyHandler(const string& command, ConstElementPtr args);
+
+    /// @brief lease4-export, lease6-export commands handler
+    ///
+    /// These commands write all IPv4 or IPv6 leases to the specified file
+    /// using the format of the memfile lease database. Such file can be
+    /// loaded by the memfile backend or applied on another server using the
+    /// lease4-bulk-apply or lease6-bulk-apply command. The leases are
+    /// fetched from the lease database in pages, so the whole database is
+    /// never held in memory. The file must not exist.
+    ///
+    /// Example command:
+    /// {
+    ///     "command": "lease4-export",
+    ///     "arguments": {
+    ///         "file": "/tmp/kea-leases4.csv"
+    ///     }
+    /// }
+    ///
+    /// @param command "lease4-export" or "lease6-export".
+    /// @param args arguments holding the file name.
+    /// @return result of the operation (includes the number of exported
+    /// leases)
+    static ConstElementPtr
+    leaseExportHandler(const string& command, ConstElementPtr args);
+
     /// @brief lease4-del command handler
     ///
     /// This command attempts to delete an IPv4 lease that match selected
@@ -388,6 +543,103 @@ private:
     static ConstElementPtr
     lease6WipeHandler(const string& command, ConstElementPtr args);
 
+    /// @brief Creates an answer to the command returning multiple leases.
+    ///
+    /// The leases are returned in the "leases" list of the arguments map
+    /// which also holds the "count" of the returned leases.
+    ///
+    /// @param v4 true if the leases are IPv4 leases.
+    /// @param leases_json list of leases in JSON format.
+    /// @return answer holding the leases or the empty answer if the list
+    /// is empty.
+    static ConstElementPtr
+    createLeasesAnswer(const bool v4, const ElementPtr& leases_json);
+
+    /// @brief Checks if the lease read from the lease file can be used in
+    /// the current configuration.
+    ///
+    /// @param config current configuration.
+    /// @param lease lease to be checked.
+    /// @throw BadValue if the lease subnet doesn't exist or the address
+    /// doesn't belong to the subnet.
+    static void
+    checkLeaseIntegrity(const ConstSrvConfigPtr& config, const Lease4Ptr& lease);
+
+    /// @brief Checks if the lease read from the lease file can be used in
+    /// the current configuration.
+    ///
+    /// @param config current configuration.
+    /// @param lease lease to be checked.
+    /// @throw BadValue if the lease subnet doesn't exist or the address
+    /// doesn't belong to the subnet.
+    static void
+    checkLeaseIntegrity(const ConstSrvConfigPtr& config, const Lease6Ptr& lease);
+
+    /// @brief Reads leases from the lease file.
+    ///
+    /// @param config current configuration.
+    /// @param file_name name of the lease file.
+    /// @param [out] leases leases read from the file.
+    /// @param failed list to which the rows and leases which couldn't be
+    /// used are appended.
+    /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseFileType, typename StorageType,
+             typename LeasePtrType>
+    static void
+    readLeases(const ConstSrvConfigPtr& config, const std::string& file_name,
+               std::vector<LeasePtrType>& leases, const ElementPtr& failed);
+
+    /// @brief Adds or updates the lease in the lease database.
+    ///
+    /// @param lease_mgr lease manager.
+    /// @param lease lease to be written.
+    /// @throw InvalidOperation if the lease couldn't be added.
+    static void applyLease(LeaseMgr& lease_mgr, const Lease4Ptr& lease);
+
+    /// @brief Adds or updates the lease in the lease database.
+    ///
+    /// @param lease_mgr lease manager.
+    /// @param lease lease to be written.
+    /// @throw InvalidOperation if the lease couldn't be added.
+    static void applyLease(LeaseMgr& lease_mgr, const Lease6Ptr& lease);
+
+    /// @brief Writes the leases to the lease database.
+    ///
+    /// @param leases leases to be written.
+    /// @param failed list to which the leases which couldn't be written
+    /// are appended.
+    /// @return number of leases written.
+    template<typename LeasePtrType>
+    static size_t
+    applyLeases(const std::vector<LeasePtrType>& leases, const ElementPtr& failed);
+
+    /// @brief Creates an entry of the "failed-leases" list.
+    ///
+    /// @param address address of the lease.
+    /// @param error_message reason of the failure.
+    /// @return map holding the address and the error message.
+    static ElementPtr
+    createFailedLease(const std::string& address, const std::string& error_message);
+
+    /// @brief Writes all leases to the lease file.
+    ///
+    /// @param lease_file lease file open for writing.
+    /// @param start_address zero address of the family of the leases.
+    /// @param get_page lease manager method returning a page of leases.
+    /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeaseCollectionType @c Lease4Collection or @c Lease6Collection.
+    /// @return number of leases written.
+    template<typename LeaseFileType, typename LeaseCollectionType>
+    static size_t
+    exportLeases(LeaseFileType& lease_file, const IOAddress& start_address,
+                 LeaseCollectionType (LeaseMgr::*get_page)
+                 (const IOAddress&, const LeasePageSize&) const);
+
+    /// @brief Number of leases fetched from the lease database at once
+    /// when exporting leases.
+    static const size_t EXPORT_PAGE_SIZE = 1000;
+
     /// @brief Extracts parameters required for reservation-get and reservation-del
     ///
     /// See @ref Parameters class for detailed description of what is expected
@@ -421,6 +673,26 @@ void LeaseCmdsImpl::registerCommands() {
     CommandMgr::instance().registerCommand("lease6-get",
         boost::bind(&LeaseCmdsImpl::leaseGetHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("lease4-get-all",
+        boost::bind(&LeaseCmdsImpl::leaseGetAllHandler, _1, _2));
+    CommandMgr::instance().registerCommand("lease6-get-all",
+        boost::bind(&LeaseCmdsImpl::leaseGetAllHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("lease4-get-page",
+        boost::bind(&LeaseCmdsImpl::leaseGetPageHandler, _1, _2));
+    CommandMgr::instance().registerCommand("lease6-get-page",
+        boost::bind(&LeaseCmdsImpl::leaseGetPageHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("lease4-bulk-apply",
+        boost::bind(&LeaseCmdsImpl::leaseBulkApplyHandler, _1, _2));
+    CommandMgr::instance().registerCommand("lease6-bulk-apply",
+        boost::bind(&LeaseCmdsImpl::leaseBulkApplyHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("lease4-export",
+        boost::bind(&LeaseCmdsImpl::leaseExportHandler, _1, _2));
+    CommandMgr::instance().registerCommand("lease6-export",
+        boost::bind(&LeaseCmdsImpl::leaseExportHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("lease4-del",
     boost::bind(&LeaseCmdsImpl::lease4DelHandler, _1, _2));
     CommandMgr::instance().registerCommand("lease6-del",
@@ -445,6 +717,18 @@ void LeaseCmdsImpl::deregisterCommands() {
     CommandMgr::instance().deregisterCommand("lease4-get");
     CommandMgr::instance().deregisterCommand("lease6-get");
 
+    CommandMgr::instance().deregisterCommand("lease4-get-all");
+    CommandMgr::instance().deregisterCommand("lease6-get-all");
+
+    CommandMgr::instance().deregisterCommand("lease4-get-page");
+    CommandMgr::instance().deregisterCommand("lease6-get-page");
+
+    CommandMgr::instance().deregisterCommand("lease4-bulk-apply");
+    CommandMgr::instance().deregisterCommand("lease6-bulk-apply");
+
+    CommandMgr::instance().deregisterCommand("lease4-export");
+    CommandMgr::instance().deregisterCommand("lease6-export");
+
     CommandMgr::instance().deregisterCommand("lease4-del");
     CommandMgr::instance().deregisterCommand("lease6-del");
 
@@ -682,6 +966,514 @@ LeaseCmdsImpl::leaseGetHandler(const std::string& name, ConstElementPtr params)
     return (createAnswer(CONTROL_RESULT_EMPTY, "Lease not found."));
 }
 
+ConstElementPtr
+LeaseCmdsImpl::leaseGetAllHandler(const std::string& name,
+                                  ConstElementPtr params) {
+    bool v4 = (name == "lease4-get-all");
+
+    ElementPtr leases_json = Element::createList();
+    try {
+        // The argument may contain a list of subnets for which leases should
+        // be returned.
+        if (params) {
+            ConstElementPtr subnets = params->get("subnets");
+            if (!subnets) {
+                isc_throw(BadValue, "'subnets' parameter not specified");
+            }
+            if (subnets->getType() != Element::list) {
+                isc_throw(BadValue, "'subnets' parameter must be a list");
+            }
+
+            const std::vector<ElementPtr>& subnet_ids = subnets->listValue();
+            for (std::vector<ElementPtr>::const_iterator subnet_id = subnet_ids.begin();
+                 subnet_id != subnet_ids.end();
+                 ++subnet_id) {
+                if ((*subnet_id)->getType() != Element::integer) {
+                    isc_throw(BadValue, "listed subnet identifiers must be numbers");
+                }
+
+                if (v4) {
+                    Lease4Collection leases =
+                        LeaseMgrFactory::instance().getLeases4((*subnet_id)->intValue());
+                    for (Lease4Collection::const_iterator lease = leases.begin();
+                         lease != leases.end(); ++lease) {
+                        leases_json->add((*lease)->toElement());
+                    }
+                } else {
+                    Lease6Collection leases =
+                        LeaseMgrFactory::instance().getLeases6((*subnet_id)->intValue());
+                    for (Lease6Collection::const_iterator lease = leases.begin();
+                         lease != leases.end(); ++lease) {
+                        leases_json->add((*lease)->toElement());
+                    }
+                }
+            }
+
+        } else {
+            // There is no 'subnets' argument so let's return all leases.
+            if (v4) {
+                Lease4Collection leases = LeaseMgrFactory::instance().getLeases4();
+                for (Lease4Collection::const_iterator lease = leases.begin();
+                     lease != leases.end(); ++lease) {
+                    leases_json->add((*lease)->toElement());
+                }
+            } else {
+                Lease6Collection leases = LeaseMgrFactory::instance().getLeases6();
+                for (Lease6Collection::const_iterator lease = leases.begin();
+                     lease != leases.end(); ++lease) {
+                    leases_json->add((*lease)->toElement());
+                }
+            }
+        }
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    return (createLeasesAnswer(v4, leases_json));
+}
+
+ConstElementPtr
+LeaseCmdsImpl::leaseGetPageHandler(const std::string& name,
+                                   ConstElementPtr params) {
+    bool v4 = (name == "lease4-get-page");
+
+    ElementPtr leases_json = Element::createList();
+    try {
+        if (!params) {
+            isc_throw(BadValue, "no parameters specified for the " << name
+                      << " command");
+        }
+
+        // The 'from' argument indicates the lower bound address for the
+        // returned page of leases.
+        ConstElementPtr from = params->get("from");
+        if (!from) {
+            isc_throw(BadValue, "'from' parameter is mandatory");
+        }
+
+        if (from->getType() != Element::string) {
+            isc_throw(BadValue, "'from' parameter must be a string");
+        }
+
+        // The 'start' keyword is the same as the zero address of the
+        // respective family.
+        boost::scoped_ptr<IOAddress> from_address;
+        if (from->stringValue() == "start") {
+            from_address.reset(new IOAddress(v4 ? "0.0.0.0" : "::"));
+
+        } else {
+            // Any other value is an address. The leases manager checks
+            // that the address belongs to the right family.
+            from_address.reset(new IOAddress(from->stringValue()));
+        }
+
+        // The 'limit' argument is the page size.
+        ConstElementPtr page_limit = params->get("limit");
+        if (!page_limit) {
+            isc_throw(BadValue, "'limit' parameter not specified");
+        }
+
+        if (page_limit->getType() != Element::integer) {
+            isc_throw(BadValue, "'limit' parameter must be a number");
+        }
+
+        if (page_limit->intValue() <= 0) {
+            isc_throw(OutOfRange, "page size of the retrieved leases must"
+                      " not be 0 nor negative");
+        }
+
+        // LeasePageSize checks that the limit fits in 32 bits.
+        LeasePageSize page_size(static_cast<size_t>(page_limit->intValue()));
+
+        if (v4) {
+            Lease4Collection leases =
+                LeaseMgrFactory::instance().getLeases4(*from_address, page_size);
+            for (Lease4Collection::const_iterator lease = leases.begin();
+                 lease != leases.end(); ++lease) {
+                leases_json->add((*lease)->toElement());
+            }
+
+        } else {
+            Lease6Collection leases =
+                LeaseMgrFactory::instance().getLeases6(*from_address, page_size);
+            for (Lease6Collection::const_iterator lease = leases.begin();
+                 lease != leases.end(); ++lease) {
+                leases_json->add((*lease)->toElement());
+            }
+        }
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    return (createLeasesAnswer(v4, leases_json));
+}
+
+ConstElementPtr
+LeaseCmdsImpl::createLeasesAnswer(const bool v4, const ElementPtr& leases_json) {
+    std::ostringstream s;
+    s << leases_json->size()
+      << " IPv" << (v4 ? "4" : "6")
+      << " lease(s) found.";
+    ElementPtr args = Element::createMap();
+    args->set("leases", leases_json);
+    args->set("count", Element::create(static_cast<long int>(leases_json->size())));
+    ConstElementPtr response =
+        createAnswer(leases_json->size() > 0 ? CONTROL_RESULT_SUCCESS :
+                     CONTROL_RESULT_EMPTY, s.str(), args);
+    return (response);
+}
+
+ConstElementPtr
+LeaseCmdsImpl::leaseBulkApplyHandler(const std::string& name,
+                                     ConstElementPtr params) {
+    bool v4 = (name == "lease4-bulk-apply");
+
+    ElementPtr failed = Element::createList();
+    size_t applied = 0;
+    try {
+        if (!params) {
+            isc_throw(BadValue, "no parameters specified for the " << name
+                      << " command");
+        }
+
+        ConstElementPtr leases_json = params->get("leases");
+        ConstElementPtr file = params->get("file");
+        if ((leases_json && file) || (!leases_json && !file)) {
+            isc_throw(BadValue, "either 'leases' or 'file' parameter must"
+                      " be specified");
+        }
+
+        if (leases_json && (leases_json->getType() != Element::list)) {
+            isc_throw(BadValue, "'leases' parameter must be a list");
+        }
+
+        if (file && (file->getType() != Element::string)) {
+            isc_throw(BadValue, "'file' parameter must be a string");
+        }
+
+        ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+
+        // Parse and validate all leases before writing any of them.
+        std::vector<Lease4Ptr> leases4;
+        std::vector<Lease6Ptr> leases6;
+        if (file) {
+            if (v4) {
+                readLeases<CSVLeaseFile4, Lease4Storage>(config, file->stringValue(),
+                                                         leases4, failed);
+            } else {
+                readLeases<CSVLeaseFile6, Lease6Storage>(config, file->stringValue(),
+                                                         leases6, failed);
+            }
+
+        } else {
+            const std::vector<ElementPtr>& lease_list = leases_json->listValue();
+            for (std::vector<ElementPtr>::const_iterator lease_info = lease_list.begin();
+                 lease_info != lease_list.end(); ++lease_info) {
+                try {
+                    if (v4) {
+                        Lease4Parser parser;
+                        leases4.push_back(parser.parse(config, *lease_info));
+                    } else {
+                        Lease6Parser parser;
+                        leases6.push_back(parser.parse(config, *lease_info));
+                    }
+
+                } catch (const std::exception& ex) {
+                    // Try to identify the lease by its address.
+                    std::string address;
+                    ConstElementPtr address_json = (*lease_info)->get("ip-address");
+                    if (address_json && (address_json->getType() == Element::string)) {
+                        address = address_json->stringValue();
+                    }
+                    failed->add(createFailedLease(address, ex.what()));
+                }
+            }
+        }
+
+        applied = (v4 ? applyLeases(leases4, failed) : applyLeases(leases6, failed));
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(lease_cmds_logger, v4 ? LEASE_CMDS_BULK_APPLY4_FAILED :
+                  LEASE_CMDS_BULK_APPLY6_FAILED)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    LOG_INFO(lease_cmds_logger, v4 ? LEASE_CMDS_BULK_APPLY4 :
+             LEASE_CMDS_BULK_APPLY6)
+        .arg(applied)
+        .arg(failed->size());
+
+    std::ostringstream s;
+    s << "Bulk apply of " << applied << " IPv" << (v4 ? "4" : "6")
+      << " lease(s) completed";
+    if (failed->size() > 0) {
+        s << ", " << failed->size() << " lease(s) failed";
+    }
+    s << ".";
+
+    ElementPtr args = Element::createMap();
+    args->set("applied", Element::create(static_cast<long int>(applied)));
+    args->set("failed-leases", failed);
+    return (createAnswer(applied > 0 || failed->size() == 0 ?
+                         CONTROL_RESULT_SUCCESS : CONTROL_RESULT_ERROR,
+                         s.str(), args));
+}
+
+ConstElementPtr
+LeaseCmdsImpl::leaseExportHandler(const std::string& name,
+                                  ConstElementPtr params) {
+    bool v4 = (name == "lease4-export");
+
+    size_t exported = 0;
+    std::string file_name;
+    try {
+        if (!params) {
+            isc_throw(BadValue, "no parameters specified for the " << name
+                      << " command");
+        }
+
+        SimpleParser parser;
+        file_name = parser.getString(params, "file");
+
+        // Don't overwrite any existing file, in particular the lease file
+        // used by the server.
+        if (CSVFile(file_name).exists()) {
+            isc_throw(BadValue, "file " << file_name << " already exists");
+        }
+
+        if (v4) {
+            CSVLeaseFile4 lease_file(file_name);
+            lease_file.recreate();
+            exported = exportLeases<CSVLeaseFile4, Lease4Collection>
+                (lease_file, IOAddress::IPV4_ZERO_ADDRESS(),
+                 &LeaseMgr::getLeases4);
+        } else {
+            CSVLeaseFile6 lease_file(file_name);
+            lease_file.recreate();
+            exported = exportLeases<CSVLeaseFile6, Lease6Collection>
+                (lease_file, IOAddress::IPV6_ZERO_ADDRESS(),
+                 &LeaseMgr::getLeases6);
+        }
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(lease_cmds_logger, v4 ? LEASE_CMDS_EXPORT4_FAILED :
+                  LEASE_CMDS_EXPORT6_FAILED)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    LOG_INFO(lease_cmds_logger, v4 ? LEASE_CMDS_EXPORT4 : LEASE_CMDS_EXPORT6)
+        .arg(exported)
+        .arg(file_name);
+
+    std::ostringstream s;
+    s << exported << " IPv" << (v4 ? "4" : "6") << " lease(s) exported.";
+    ElementPtr args = Element::createMap();
+    args->set("count", Element::create(static_cast<long int>(exported)));
+    return (createAnswer(CONTROL_RESULT_SUCCESS, s.str(), args));
+}
+
+void
+LeaseCmdsImpl::checkLeaseIntegrity(const ConstSrvConfigPtr& config,
+                                   const Lease4Ptr& lease) {
+    Subnet4Ptr subnet = config->getCfgSubnets4()->getSubnet(lease->subnet_id_);
+    if (!subnet) {
+        isc_throw(BadValue, "Invalid subnet-id: No IPv4 subnet with subnet-id="
+                  << lease->subnet_id_ << " currently configured.");
+    }
+
+    if (!subnet->inRange(lease->addr_)) {
+        isc_throw(BadValue, "The address " << lease->addr_ << " does not belong "
+                  "to subnet " << subnet->toText() << ", subnet-id="
+                  << lease->subnet_id_);
+    }
+}
+
+void
+LeaseCmdsImpl::checkLeaseIntegrity(const ConstSrvConfigPtr& config,
+                                   const Lease6Ptr& lease) {
+    Subnet6Ptr subnet = config->getCfgSubnets6()->getSubnet(lease->subnet_id_);
+    if (!subnet) {
+        isc_throw(BadValue, "Invalid subnet-id: No IPv6 subnet with subnet-id="
+                  << lease->subnet_id_ << " currently configured.");
+    }
+
+    // Prefixes may be delegated from outside of the subnet.
+    if ((lease->type_ != Lease::TYPE_PD) && !subnet->inRange(lease->addr_)) {
+        isc_throw(BadValue, "The address " << lease->addr_ << " does not belong "
+                  "to subnet " << subnet->toText() << ", subnet-id="
+                  << lease->subnet_id_);
+    }
+}
+
+template<typename LeaseFileType, typename StorageType, typename LeasePtrType>
+void
+LeaseCmdsImpl::readLeases(const ConstSrvConfigPtr& config,
+                          const std::string& file_name,
+                          std::vector<LeasePtrType>& leases,
+                          const ElementPtr& failed) {
+    LeaseFileType lease_file(file_name);
+    lease_file.open();
+
+    // The lease file is a journal, so there may be multiple entries for
+    // the same lease. Use the lease storage to keep the latest entries.
+    StorageType storage;
+    LeasePtrType lease;
+    while (true) {
+        if (!lease_file.next(lease)) {
+            ElementPtr failed_row = Element::createMap();
+            failed_row->set("row", Element::create(static_cast<long int>
+                                                   (lease_file.getReads())));
+            failed_row->set("error-message",
+                            Element::create(lease_file.getReadMsg()));
+            failed->add(failed_row);
+            continue;
+        }
+
+        // End of file.
+        if (!lease) {
+            break;
+        }
+
+        typename StorageType::iterator lease_it = storage.find(lease->addr_);
+        if (lease_it == storage.end()) {
+            if (lease->valid_lft_ > 0) {
+                storage.insert(lease);
+            }
+
+        } else if (lease->valid_lft_ == 0) {
+            // The lease has been removed.
+            storage.erase(lease_it);
+
+        } else {
+            storage.replace(lease_it, lease);
+        }
+    }
+    lease_file.close();
+
+    for (typename StorageType::const_iterator lease_it = storage.begin();
+         lease_it != storage.end(); ++lease_it) {
+        try {
+            checkLeaseIntegrity(config, *lease_it);
+            leases.push_back(*lease_it);
+
+        } catch (const std::exception& ex) {
+            failed->add(createFailedLease((*lease_it)->addr_.toText(), ex.what()));
+        }
+    }
+}
+
+void
+LeaseCmdsImpl::applyLease(LeaseMgr& lease_mgr, const Lease4Ptr& lease) {
+    if (lease_mgr.getLease4(lease->addr_)) {
+        lease_mgr.updateLease4(lease);
+
+    } else if (!lease_mgr.addLease(lease)) {
+        isc_throw(InvalidOperation, "unable to add lease for address "
+                  << lease->addr_);
+    }
+}
+
+void
+LeaseCmdsImpl::applyLease(LeaseMgr& lease_mgr, const Lease6Ptr& lease) {
+    if (lease_mgr.getLease6(lease->type_, lease->addr_)) {
+        lease_mgr.updateLease6(lease);
+
+    } else if (!lease_mgr.addLease(lease)) {
+        isc_throw(InvalidOperation, "unable to add lease for address "
+                  << lease->addr_);
+    }
+}
+
+template<typename LeasePtrType>
+size_t
+LeaseCmdsImpl::applyLeases(const std::vector<LeasePtrType>& leases,
+                           const ElementPtr& failed) {
+    if (leases.empty()) {
+        return (0);
+    }
+
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    const bool transaction = lease_mgr.startTransaction();
+
+    size_t applied = 0;
+    for (size_t i = 0; i < leases.size(); ++i) {
+        try {
+            applyLease(lease_mgr, leases[i]);
+            ++applied;
+
+        } catch (const std::exception& ex) {
+            failed->add(createFailedLease(leases[i]->addr_.toText(), ex.what()));
+            if (!transaction) {
+                // The other leases are not affected.
+                continue;
+            }
+
+            // None of the leases is stored when the transaction is rolled
+            // back.
+            lease_mgr.rollback();
+            for (size_t j = 0; j < leases.size(); ++j) {
+                if (j != i) {
+                    failed->add(createFailedLease(leases[j]->addr_.toText(),
+                                                  "not applied because the "
+                                                  "transaction has been "
+                                                  "rolled back"));
+                }
+            }
+            return (0);
+        }
+    }
+
+    if (transaction) {
+        lease_mgr.commit();
+    }
+
+    return (applied);
+}
+
+ElementPtr
+LeaseCmdsImpl::createFailedLease(const std::string& address,
+                                 const std::string& error_message) {
+    ElementPtr failed_lease = Element::createMap();
+    failed_lease->set("ip-address", Element::create(address));
+    failed_lease->set("error-message", Element::create(error_message));
+    return (failed_lease);
+}
+
+template<typename LeaseFileType, typename LeaseCollectionType>
+size_t
+LeaseCmdsImpl::exportLeases(LeaseFileType& lease_file,
+                            const IOAddress& start_address,
+                            LeaseCollectionType (LeaseMgr::*get_page)
+                            (const IOAddress&, const LeasePageSize&) const) {
+    const LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    const LeasePageSize page_size(EXPORT_PAGE_SIZE);
+
+    size_t exported = 0;
+    IOAddress lower_bound_address(start_address);
+    while (true) {
+        LeaseCollectionType leases = (lease_mgr.*get_page)(lower_bound_address,
+                                                           page_size);
+
+        for (typename LeaseCollectionType::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            lease_file.append(**lease);
+            ++exported;
+        }
+
+        if (leases.size() < EXPORT_PAGE_SIZE) {
+            break;
+        }
+        lower_bound_address = leases.back()->addr_;
+    }
+    lease_file.close();
+
+    return (exported);
+}
+
 ConstElementPtr
 LeaseCmdsImpl::lease4DelHandler(const std::string& , ConstElementPtr params) {
     Parameters p;
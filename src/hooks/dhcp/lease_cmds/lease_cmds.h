@@ -31,6 +31,14 @@ public:
     /// - lease6-add
     /// - lease4-get
     /// - lease6-get
+    /// - lease4-get-all
+    /// - lease6-get-all
+    /// - lease4-get-page
+    /// - lease6-get-page
+    /// - lease4-bulk-apply
+    /// - lease6-bulk-apply
+    /// - lease4-export
+    /// - lease6-export
     /// - lease4-del
     /// - lease6-del
     /// - lease4-update
@@ -48,6 +56,14 @@ public:
     /// - lease6-add
     /// - lease4-get
     /// - lease6-get
+    /// - lease4-get-all
+    /// - lease6-get-all
+    /// - lease4-get-page
+    /// - lease6-get-page
+    /// - lease4-bulk-apply
+    /// - lease6-bulk-apply
+    /// - lease4-export
+    /// - lease6-export
     /// - lease4-del
     /// - lease6-del
     /// - lease4-update
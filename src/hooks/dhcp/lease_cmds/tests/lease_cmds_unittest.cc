@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include <cc/data.h>
 #include <errno.h>
+#include <stdio.h>
 
 using namespace std;
 using namespace isc;
@@ -426,6 +427,10 @@ TEST_F(LeaseCmdsTest, commands) {
 
     vector<string> cmds = { "lease4-add",    "lease6-add",
                             "lease4-get",    "lease6-get",
+                            "lease4-get-all", "lease6-get-all",
+                            "lease4-get-page", "lease6-get-page",
+                            "lease4-bulk-apply", "lease6-bulk-apply",
+                            "lease4-export", "lease6-export",
                             "lease4-del",    "lease6-del",
                             "lease4-update", "lease6-update",
                             "lease4-wipe",   "lease6-wipe" };
@@ -1267,6 +1272,519 @@ TEST_F(LeaseCmdsTest, Lease6GetByDUID) {
     checkLease6(lease, "2001:db8::1", 0, 66, "77:77:77:77:77:77:77:77", false);
 }
 
+// Checks that lease4-get-all returns all leases or the leases in the
+// specified subnets.
+TEST_F(LeaseCmdsTest, Lease4GetAll) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    // Add another lease in a different subnet.
+    Lease4Ptr lease4 = createLease4();
+    lease4->addr_ = IOAddress("192.0.2.2");
+    lease4->hwaddr_.reset(new HWAddr(vector<uint8_t>(6, 0x09), HTYPE_ETHER));
+    lease4->client_id_.reset();
+    lease4->subnet_id_ = 45;
+    ASSERT_TRUE(lmptr_->addLease(lease4));
+
+    // Query for all leases.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\"\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "2 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(Element::list, leases->getType());
+    ASSERT_EQ(2, leases->size());
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(2, args->get("count")->intValue());
+
+    // Query for the leases in subnet 44.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {\n"
+        "        \"subnets\": [ 44 ]\n"
+        "    }\n"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv4 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    checkLease4(leases->get(0), "192.0.2.1", 44, "08:08:08:08:08:08", true);
+
+    // There are no leases in subnet 1.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {\n"
+        "        \"subnets\": [ 1 ]\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+
+    // The subnets must be specified as a list of numbers.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {\n"
+        "        \"subnets\": [ \"44\" ]\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR,
+                "listed subnet identifiers must be numbers");
+}
+
+// Checks that lease4-get-page returns the leases in pages.
+TEST_F(LeaseCmdsTest, Lease4GetPage) {
+
+    // Initialize lease manager (false = v4, false = don't add leases)
+    initLeaseMgr(false, false);
+
+    // Add 5 leases.
+    for (int i = 1; i <= 5; ++i) {
+        Lease4Ptr lease4 = createLease4();
+        std::ostringstream addr;
+        addr << "192.0.2." << i;
+        lease4->addr_ = IOAddress(addr.str());
+        lease4->hwaddr_.reset(new HWAddr(vector<uint8_t>(6, i), HTYPE_ETHER));
+        lease4->client_id_.reset();
+        ASSERT_TRUE(lmptr_->addLease(lease4));
+    }
+
+    // Fetch the leases in pages of 2.
+    std::string from = "start";
+    std::vector<std::string> addresses;
+    for (int i = 0; i < 3; ++i) {
+        string cmd =
+            "{\n"
+            "    \"command\": \"lease4-get-page\",\n"
+            "    \"arguments\": {\n"
+            "        \"from\": \"" + from + "\",\n"
+            "        \"limit\": 2\n"
+            "    }\n"
+            "}";
+        ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                          i < 2 ? "2 IPv4 lease(s) found." :
+                                          "1 IPv4 lease(s) found.");
+        ASSERT_TRUE(rsp);
+        ConstElementPtr args = rsp->get("arguments");
+        ASSERT_TRUE(args);
+        ConstElementPtr leases = args->get("leases");
+        ASSERT_TRUE(leases);
+        for (size_t j = 0; j < leases->size(); ++j) {
+            from = leases->get(j)->get("ip-address")->stringValue();
+            addresses.push_back(from);
+        }
+    }
+
+    // All leases should have been returned in the ascending order.
+    ASSERT_EQ(5, addresses.size());
+    EXPECT_EQ("192.0.2.1", addresses[0]);
+    EXPECT_EQ("192.0.2.5", addresses[4]);
+
+    // The next page is empty.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {\n"
+        "        \"from\": \"192.0.2.5\",\n"
+        "        \"limit\": 2\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, "0 IPv4 lease(s) found.");
+}
+
+// Checks that lease4-get-page sanitizes its input.
+TEST_F(LeaseCmdsTest, Lease4GetPageBadParams) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    // Missing limit.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {\n"
+        "        \"from\": \"start\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'limit' parameter not specified");
+
+    // Zero limit.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {\n"
+        "        \"from\": \"start\",\n"
+        "        \"limit\": 0\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "page size of the retrieved leases"
+                " must not be 0 nor negative");
+
+    // IPv6 address used as the lower bound.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {\n"
+        "        \"from\": \"2001:db8::1\",\n"
+        "        \"limit\": 2\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "expected IPv4 address while "
+                "retrieving leases from the lease database, got 2001:db8::1");
+}
+
+// Checks that lease6-get-all returns all leases or the leases in the
+// specified subnets.
+TEST_F(LeaseCmdsTest, Lease6GetAll) {
+
+    initLeaseMgr(true, true); // (true = v6, true = create a lease)
+
+    // Add another lease in a different subnet.
+    Lease6Ptr lease6 = createLease6();
+    lease6->addr_ = IOAddress("2001:db8::2");
+    lease6->iaid_ = 43;
+    lease6->subnet_id_ = 67;
+    ASSERT_TRUE(lmptr_->addLease(lease6));
+
+    // Query for all leases.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\"\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "2 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+
+    // Query for the leases in subnet 66.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\",\n"
+        "    \"arguments\": {\n"
+        "        \"subnets\": [ 66 ]\n"
+        "    }\n"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv6 lease(s) found.");
+    ASSERT_TRUE(rsp);
+    args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    checkLease6(leases->get(0), "2001:db8::1", 0, 66,
+                "77:77:77:77:77:77:77:77", false);
+}
+
+// Checks that lease6-get-page returns the leases in pages.
+TEST_F(LeaseCmdsTest, Lease6GetPage) {
+
+    initLeaseMgr(true, false); // (true = v6, false = don't add leases)
+
+    // Add 5 leases.
+    for (int i = 1; i <= 5; ++i) {
+        Lease6Ptr lease6 = createLease6();
+        std::ostringstream addr;
+        addr << "2001:db8::" << i;
+        lease6->addr_ = IOAddress(addr.str());
+        lease6->iaid_ = i;
+        ASSERT_TRUE(lmptr_->addLease(lease6));
+    }
+
+    // Fetch the leases in pages of 2.
+    std::string from = "start";
+    std::vector<std::string> addresses;
+    for (int i = 0; i < 3; ++i) {
+        string cmd =
+            "{\n"
+            "    \"command\": \"lease6-get-page\",\n"
+            "    \"arguments\": {\n"
+            "        \"from\": \"" + from + "\",\n"
+            "        \"limit\": 2\n"
+            "    }\n"
+            "}";
+        ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                          i < 2 ? "2 IPv6 lease(s) found." :
+                                          "1 IPv6 lease(s) found.");
+        ASSERT_TRUE(rsp);
+        ConstElementPtr args = rsp->get("arguments");
+        ASSERT_TRUE(args);
+        ConstElementPtr leases = args->get("leases");
+        ASSERT_TRUE(leases);
+        for (size_t j = 0; j < leases->size(); ++j) {
+            from = leases->get(j)->get("ip-address")->stringValue();
+            addresses.push_back(from);
+        }
+    }
+
+    // All leases should have been returned in the ascending order.
+    ASSERT_EQ(5, addresses.size());
+    EXPECT_EQ("2001:db8::1", addresses[0]);
+    EXPECT_EQ("2001:db8::5", addresses[4]);
+
+    // IPv4 address used as the lower bound.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-page\",\n"
+        "    \"arguments\": {\n"
+        "        \"from\": \"192.0.2.1\",\n"
+        "        \"limit\": 2\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "expected IPv6 address while "
+                "retrieving leases from the lease database, got 192.0.2.1");
+}
+
+// Checks that lease4-bulk-apply adds new leases, updates existing leases
+// and reports the leases which couldn't be applied.
+TEST_F(LeaseCmdsTest, Lease4BulkApply) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"leases\": [\n"
+        "            {\n"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.1\",\n"
+        "                \"hw-address\": \"08:08:08:08:08:08\",\n"
+        "                \"hostname\": \"newhost.example.com.\"\n"
+        "            },\n"
+        "            {\n"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.2\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\"\n"
+        "            },\n"
+        "            {\n"
+        "                \"subnet-id\": 1,\n"
+        "                \"ip-address\": \"192.0.2.3\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\"\n"
+        "            }\n"
+        "        ]\n"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "Bulk apply of 2 IPv4 lease(s) completed,"
+                                      " 1 lease(s) failed.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("applied"));
+    EXPECT_EQ(2, args->get("applied")->intValue());
+
+    // The lease in the non-existing subnet should be reported.
+    ConstElementPtr failed = args->get("failed-leases");
+    ASSERT_TRUE(failed);
+    ASSERT_EQ(1, failed->size());
+    ASSERT_TRUE(failed->get(0)->get("ip-address"));
+    EXPECT_EQ("192.0.2.3", failed->get(0)->get("ip-address")->stringValue());
+    EXPECT_TRUE(failed->get(0)->get("error-message"));
+
+    // The existing lease should be updated.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("newhost.example.com.", lease->hostname_);
+
+    // The new lease should be added.
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.3")));
+}
+
+// Checks that lease4-bulk-apply sanitizes its input.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyBadParams) {
+
+    // Initialize lease manager (false = v4, false = don't add leases)
+    initLeaseMgr(false, false);
+
+    // No parameters.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\"\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "no parameters specified for the"
+                " lease4-bulk-apply command");
+
+    // Both leases and file.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"leases\": [ ],\n"
+        "        \"file\": \"leases4.csv\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "either 'leases' or 'file'"
+                " parameter must be specified");
+
+    // Leases must be a list.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"leases\": { }\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "'leases' parameter must be a list");
+
+    // All leases are invalid.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"leases\": [ { \"ip-address\": \"192.0.2.1\" } ]\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "Bulk apply of 0 IPv4 lease(s)"
+                " completed, 1 lease(s) failed.");
+}
+
+// Checks that lease6-bulk-apply adds new leases and updates existing leases.
+TEST_F(LeaseCmdsTest, Lease6BulkApply) {
+
+    initLeaseMgr(true, true); // (true = v6, true = create a lease)
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"leases\": [\n"
+        "            {\n"
+        "                \"subnet-id\": 66,\n"
+        "                \"ip-address\": \"2001:db8::1\",\n"
+        "                \"duid\": \"77:77:77:77:77:77:77:77\",\n"
+        "                \"iaid\": 42,\n"
+        "                \"hostname\": \"newhost.example.com.\"\n"
+        "            },\n"
+        "            {\n"
+        "                \"subnet-id\": 66,\n"
+        "                \"ip-address\": \"2001:db8::2\",\n"
+        "                \"duid\": \"1a:1b:1c:1d:1e:1f:20:21\",\n"
+        "                \"iaid\": 1234\n"
+        "            }\n"
+        "        ]\n"
+        "    }\n"
+        "}";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS,
+                                      "Bulk apply of 2 IPv6 lease(s) completed.");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("failed-leases"));
+    EXPECT_EQ(0, args->get("failed-leases")->size());
+
+    Lease6Ptr lease = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("newhost.example.com.", lease->hostname_);
+    EXPECT_TRUE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::2")));
+}
+
+// Checks that the IPv4 leases exported with lease4-export can be applied
+// with lease4-bulk-apply.
+TEST_F(LeaseCmdsTest, Lease4ExportBulkApplyFile) {
+
+    const std::string file_name = std::string(TEST_DATA_BUILDDIR) +
+        "/export-leases4.csv";
+    static_cast<void>(remove(file_name.c_str()));
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+    Lease4Ptr lease4 = createLease4();
+    lease4->addr_ = IOAddress("192.0.2.2");
+    ASSERT_TRUE(lmptr_->addLease(lease4));
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-export\",\n"
+        "    \"arguments\": {\n"
+        "        \"file\": \"" + file_name + "\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, "2 IPv4 lease(s) exported.");
+
+    // The existing file must not be overwritten.
+    testCommand(cmd, CONTROL_RESULT_ERROR, "file " + file_name +
+                " already exists");
+
+    // Remove the leases and restore them from the file.
+    ASSERT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.1")));
+    ASSERT_TRUE(lmptr_->deleteLease(IOAddress("192.0.2.2")));
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"file\": \"" + file_name + "\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, "Bulk apply of 2 IPv4 lease(s)"
+                " completed.");
+
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.2"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(44, lease->subnet_id_);
+    EXPECT_EQ("myhost.example.com.", lease->hostname_);
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+
+    static_cast<void>(remove(file_name.c_str()));
+}
+
+// Checks that the IPv6 leases exported with lease6-export can be applied
+// with lease6-bulk-apply.
+TEST_F(LeaseCmdsTest, Lease6ExportBulkApplyFile) {
+
+    const std::string file_name = std::string(TEST_DATA_BUILDDIR) +
+        "/export-leases6.csv";
+    static_cast<void>(remove(file_name.c_str()));
+
+    initLeaseMgr(true, true); // (true = v6, true = create a lease)
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-export\",\n"
+        "    \"arguments\": {\n"
+        "        \"file\": \"" + file_name + "\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, "1 IPv6 lease(s) exported.");
+
+    // Remove the lease and restore it from the file.
+    ASSERT_TRUE(lmptr_->deleteLease(IOAddress("2001:db8::1")));
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {\n"
+        "        \"file\": \"" + file_name + "\"\n"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, "Bulk apply of 1 IPv6 lease(s)"
+                " completed.");
+
+    Lease6Ptr lease = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(42, lease->iaid_);
+    EXPECT_EQ(66, lease->subnet_id_);
+
+    static_cast<void>(remove(file_name.c_str()));
+}
+
 // Test checks if lease4-update handler refuses calls with missing parameters.
 TEST_F(LeaseCmdsTest, Lease4UpdateMissingParams) {
     // Initialize lease manager (false = v4, true = add a lease)
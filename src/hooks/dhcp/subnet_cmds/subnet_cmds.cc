@@ -0,0 +1,696 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <subnet_cmds.h>
+#include <subnet_cmds_log.h>
+#include <config/command_mgr.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <cc/simple_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
+#include <dhcpsrv/parsers/simple_parser6.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_id.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <boost/bind.hpp>
+#include <sstream>
+#include <string>
+
+using namespace isc::dhcp;
+using namespace isc::data;
+using namespace isc::config;
+using namespace isc::stats;
+using namespace std;
+
+namespace isc {
+namespace subnet_cmds {
+
+/// @brief Wrapper class around subnet command handlers.
+///
+/// The commands modify the subnets of the current configuration in place,
+/// so adding, replacing or removing a subnet neither affects the other
+/// subnets nor requires a reconfiguration. Only the statistics of the
+/// modified subnet are recomputed.
+class SubnetCmdsImpl {
+public:
+    SubnetCmdsImpl();
+
+    ~SubnetCmdsImpl();
+
+private:
+
+    /// @brief Registers commands:
+    ///
+    /// Registers:
+    /// - subnet4-list
+    /// - subnet6-list
+    /// - subnet4-get
+    /// - subnet6-get
+    /// - subnet4-add
+    /// - subnet6-add
+    /// - subnet4-update
+    /// - subnet6-update
+    /// - subnet4-del
+    /// - subnet6-del
+    ///
+    /// @throw Unexpected if CommandMgr is not available (should not happen)
+    void registerCommands();
+
+    /// @brief Deregisters commands:
+    ///
+    /// Deregisters:
+    /// - subnet4-list
+    /// - subnet6-list
+    /// - subnet4-get
+    /// - subnet6-get
+    /// - subnet4-add
+    /// - subnet6-add
+    /// - subnet4-update
+    /// - subnet6-update
+    /// - subnet4-del
+    /// - subnet6-del
+    ///
+    /// @throw Unexpected if CommandMgr is not available (should not happen)
+    void deregisterCommands();
+
+    /// @brief subnet4-list, subnet6-list command handler
+    ///
+    /// This command lists the identifiers and prefixes of all configured
+    /// subnets of the given family. It doesn't take any parameters.
+    ///
+    /// @param command should be 'subnet4-list' or 'subnet6-list'
+    /// @param args must be NULL or a map (ignored)
+    ///
+    /// @return result of the operation and the list of subnets
+    static ConstElementPtr
+    subnetListHandler(const string& command, ConstElementPtr args);
+
+    /// @brief subnet4-get, subnet6-get command handler
+    ///
+    /// This command returns the full configuration of a subnet selected
+    /// either by its identifier or by its prefix:
+    /// {
+    ///     "id": 10
+    /// }
+    /// or
+    /// {
+    ///     "subnet": "10.0.0.0/8"
+    /// }
+    ///
+    /// @param command should be 'subnet4-get' or 'subnet6-get'
+    /// @param args must contain either 'id' or 'subnet'
+    ///
+    /// @return result of the operation (includes the subnet if found)
+    static ConstElementPtr
+    subnetGetHandler(const string& command, ConstElementPtr args);
+
+    /// @brief subnet4-add, subnet6-add command handler
+    ///
+    /// This command adds a subnet to the current configuration and sets
+    /// its statistics. The subnet is specified as in the configuration
+    /// file, in a single element list:
+    /// {
+    ///     "subnet4": [ {
+    ///         "id": 123,
+    ///         "subnet": "10.20.30.0/24",
+    ///         ...
+    ///     } ]
+    /// }
+    ///
+    /// @param command should be 'subnet4-add' or 'subnet6-add'
+    /// @param args must contain a 'subnet4' or 'subnet6' list
+    ///
+    /// @return result of the operation (includes the identifier and the
+    /// prefix of the added subnet)
+    static ConstElementPtr
+    subnetAddHandler(const string& command, ConstElementPtr args);
+
+    /// @brief subnet4-update, subnet6-update command handler
+    ///
+    /// This command replaces the subnet with the same identifier as the
+    /// specified one, which takes the same parameters as subnet4-add and
+    /// subnet6-add. The subnet is left unchanged if the new one can't be
+    /// parsed or added.
+    ///
+    /// @param command should be 'subnet4-update' or 'subnet6-update'
+    /// @param args must contain a 'subnet4' or 'subnet6' list
+    ///
+    /// @return result of the operation (includes the identifier and the
+    /// prefix of the updated subnet)
+    static ConstElementPtr
+    subnetUpdateHandler(const string& command, ConstElementPtr args);
+
+    /// @brief subnet4-del, subnet6-del command handler
+    ///
+    /// This command removes the subnet with the given identifier from the
+    /// current configuration and removes its statistics. The leases and
+    /// the host reservations of the subnet are left untouched:
+    /// {
+    ///     "id": 123
+    /// }
+    ///
+    /// @param command should be 'subnet4-del' or 'subnet6-del'
+    /// @param args must contain 'id'
+    ///
+    /// @return result of the operation (includes the identifier and the
+    /// prefix of the removed subnet)
+    static ConstElementPtr
+    subnetDelHandler(const string& command, ConstElementPtr args);
+
+    /// @brief Returns the single subnet specified in a command.
+    ///
+    /// @param args arguments of the command
+    /// @param name name of the list holding the subnet ('subnet4' or
+    /// 'subnet6')
+    ///
+    /// @return subnet configuration
+    /// @throw BadValue if the arguments don't hold exactly one subnet or if
+    /// the subnet contains host reservations.
+    static ConstElementPtr
+    getSubnetArg(const ConstElementPtr& args, const string& name);
+
+    /// @brief Parses an IPv4 subnet.
+    ///
+    /// The subnet defaults are applied. The parameters which are otherwise
+    /// inherited from the global scope take their default values when not
+    /// specified, as the global values of the configuration are not kept
+    /// once it has been parsed.
+    ///
+    /// @param subnet subnet configuration
+    /// @return parsed subnet
+    static Subnet4Ptr parseSubnet4(const ConstElementPtr& subnet);
+
+    /// @brief Parses an IPv6 subnet.
+    ///
+    /// See @ref parseSubnet4.
+    ///
+    /// @param subnet subnet configuration
+    /// @return parsed subnet
+    static Subnet6Ptr parseSubnet6(const ConstElementPtr& subnet);
+
+    /// @brief Runs a subnet parser with the current option definitions.
+    ///
+    /// The subnet parsers look up the option definitions in the staging
+    /// configuration, so the option definitions of the current configuration
+    /// are copied there for the time of the parsing. The staging
+    /// configuration is discarded afterwards.
+    ///
+    /// @tparam ParserType Subnet4ConfigParser or Subnet6ConfigParser
+    /// @tparam SubnetPtrType Subnet4Ptr or Subnet6Ptr
+    /// @param subnet subnet configuration with the defaults set
+    /// @return parsed subnet
+    template<typename ParserType, typename SubnetPtrType>
+    static SubnetPtrType parseSubnet(const ConstElementPtr& subnet);
+
+    /// @brief Replaces a subnet in the given configuration.
+    ///
+    /// @tparam CfgSubnetsPtrType CfgSubnets4Ptr or CfgSubnets6Ptr
+    /// @tparam SubnetPtrType Subnet4Ptr or Subnet6Ptr
+    /// @param cfg subnets configuration
+    /// @param subnet new subnet replacing the one with the same identifier
+    /// @throw BadValue if there is no subnet with this identifier
+    /// @throw DuplicateSubnetID if the prefix of the new subnet is used by
+    /// another subnet, in which case the configuration is unchanged.
+    template<typename CfgSubnetsPtrType, typename SubnetPtrType>
+    static void replaceSubnet(const CfgSubnetsPtrType& cfg,
+                              const SubnetPtrType& subnet);
+
+    /// @brief Removes the declined addresses of a subnet from the global
+    /// statistic.
+    ///
+    /// The per-subnet value is added back to the global declined-addresses
+    /// statistic when a subnet with the same identifier is added again.
+    ///
+    /// @param subnet_id identifier of the removed subnet
+    static void discountDeclined(const SubnetID& subnet_id);
+
+    /// @brief Returns the identifier and the prefix of a subnet.
+    ///
+    /// @param subnet subnet
+    /// @return a map with the 'id' and 'subnet' parameters
+    static ElementPtr briefSubnet(const Subnet& subnet);
+
+    /// @brief Returns the arguments of a response holding one subnet.
+    ///
+    /// @param subnet subnet in the short or in the full form
+    /// @return a map with the 'subnets' list holding the subnet
+    static ElementPtr subnetsArg(const ElementPtr& subnet);
+
+    /// @brief Returns a text describing a subnet in command responses.
+    ///
+    /// @param subnet subnet
+    /// @return the prefix followed by the identifier
+    static string subnetText(const Subnet& subnet);
+};
+
+SubnetCmdsImpl::SubnetCmdsImpl() {
+    registerCommands();
+}
+
+SubnetCmdsImpl::~SubnetCmdsImpl() {
+    deregisterCommands();
+}
+
+void SubnetCmdsImpl::registerCommands() {
+    CommandMgr::instance().registerCommand("subnet4-list",
+        boost::bind(&SubnetCmdsImpl::subnetListHandler, _1, _2));
+    CommandMgr::instance().registerCommand("subnet6-list",
+        boost::bind(&SubnetCmdsImpl::subnetListHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("subnet4-get",
+        boost::bind(&SubnetCmdsImpl::subnetGetHandler, _1, _2));
+    CommandMgr::instance().registerCommand("subnet6-get",
+        boost::bind(&SubnetCmdsImpl::subnetGetHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("subnet4-add",
+        boost::bind(&SubnetCmdsImpl::subnetAddHandler, _1, _2));
+    CommandMgr::instance().registerCommand("subnet6-add",
+        boost::bind(&SubnetCmdsImpl::subnetAddHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("subnet4-update",
+        boost::bind(&SubnetCmdsImpl::subnetUpdateHandler, _1, _2));
+    CommandMgr::instance().registerCommand("subnet6-update",
+        boost::bind(&SubnetCmdsImpl::subnetUpdateHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("subnet4-del",
+        boost::bind(&SubnetCmdsImpl::subnetDelHandler, _1, _2));
+    CommandMgr::instance().registerCommand("subnet6-del",
+        boost::bind(&SubnetCmdsImpl::subnetDelHandler, _1, _2));
+}
+
+void SubnetCmdsImpl::deregisterCommands() {
+    CommandMgr::instance().deregisterCommand("subnet4-list");
+    CommandMgr::instance().deregisterCommand("subnet6-list");
+
+    CommandMgr::instance().deregisterCommand("subnet4-get");
+    CommandMgr::instance().deregisterCommand("subnet6-get");
+
+    CommandMgr::instance().deregisterCommand("subnet4-add");
+    CommandMgr::instance().deregisterCommand("subnet6-add");
+
+    CommandMgr::instance().deregisterCommand("subnet4-update");
+    CommandMgr::instance().deregisterCommand("subnet6-update");
+
+    CommandMgr::instance().deregisterCommand("subnet4-del");
+    CommandMgr::instance().deregisterCommand("subnet6-del");
+}
+
+ConstElementPtr
+SubnetCmdsImpl::subnetListHandler(const string& command, ConstElementPtr) {
+    const bool v4 = (command == "subnet4-list");
+    const string family = (v4 ? "IPv4" : "IPv6");
+
+    ElementPtr subnets = Element::createList();
+    SrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+    if (v4) {
+        const Subnet4Collection* all = config->getCfgSubnets4()->getAll();
+        for (Subnet4Collection::const_iterator subnet = all->begin();
+             subnet != all->end(); ++subnet) {
+            subnets->add(briefSubnet(**subnet));
+        }
+    } else {
+        const Subnet6Collection* all = config->getCfgSubnets6()->getAll();
+        for (Subnet6Collection::const_iterator subnet = all->begin();
+             subnet != all->end(); ++subnet) {
+            subnets->add(briefSubnet(**subnet));
+        }
+    }
+
+    if (subnets->empty()) {
+        return (createAnswer(CONTROL_RESULT_EMPTY,
+                             "No " + family + " subnets found"));
+    }
+
+    ostringstream txt;
+    txt << subnets->size() << " " << family << " subnets found";
+    ElementPtr result = Element::createMap();
+    result->set("subnets", subnets);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, txt.str(), result));
+}
+
+ConstElementPtr
+SubnetCmdsImpl::subnetGetHandler(const string& command, ConstElementPtr args) {
+    const bool v4 = (command == "subnet4-get");
+    const string family = (v4 ? "IPv4" : "IPv6");
+
+    try {
+        if (!args || (args->getType() != Element::map)) {
+            isc_throw(BadValue, "Parameters missing or are not a map.");
+        }
+
+        ConstElementPtr id = args->get("id");
+        ConstElementPtr prefix = args->get("subnet");
+        if ((id && prefix) || (!id && !prefix)) {
+            isc_throw(BadValue, "exactly one of 'id' and 'subnet' parameters"
+                      " must be specified");
+        }
+
+        SrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        ConstSubnet4Ptr subnet4;
+        ConstSubnet6Ptr subnet6;
+        if (id) {
+            SimpleParser parser;
+            SubnetID subnet_id = parser.getUint32(args, "id");
+            if (v4) {
+                subnet4 = config->getCfgSubnets4()->getBySubnetId(subnet_id);
+            } else {
+                subnet6 = config->getCfgSubnets6()->getBySubnetId(subnet_id);
+            }
+        } else {
+            if (prefix->getType() != Element::string) {
+                isc_throw(BadValue, "'subnet' parameter must be a string");
+            }
+            if (v4) {
+                subnet4 = config->getCfgSubnets4()->
+                    getByPrefix(prefix->stringValue());
+            } else {
+                subnet6 = config->getCfgSubnets6()->
+                    getByPrefix(prefix->stringValue());
+            }
+        }
+
+        ConstSubnetPtr subnet;
+        ElementPtr info;
+        if (subnet4) {
+            subnet = subnet4;
+            info = subnet4->toElement();
+        } else if (subnet6) {
+            subnet = subnet6;
+            info = subnet6->toElement();
+        } else {
+            return (createAnswer(CONTROL_RESULT_EMPTY,
+                                 "No " + family + " subnet with " +
+                                 (id ? "id " + id->str() :
+                                  "prefix " + prefix->stringValue()) +
+                                 " found"));
+        }
+
+        return (createAnswer(CONTROL_RESULT_SUCCESS,
+                             "Info about " + family + " subnet " +
+                             subnetText(*subnet) + " returned",
+                             subnetsArg(info)));
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+}
+
+ConstElementPtr
+SubnetCmdsImpl::subnetAddHandler(const string& command, ConstElementPtr args) {
+    const bool v4 = (command == "subnet4-add");
+
+    string txt = "(missing parameters)";
+    if (args) {
+        txt = args->str();
+    }
+
+    SubnetPtr added;
+    try {
+        SrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        if (v4) {
+            Subnet4Ptr subnet = parseSubnet4(getSubnetArg(args, "subnet4"));
+            CfgSubnets4Ptr cfg = config->getCfgSubnets4();
+            cfg->add(subnet);
+            cfg->updateStatistics(subnet->getID());
+            added = subnet;
+
+        } else {
+            Subnet6Ptr subnet = parseSubnet6(getSubnetArg(args, "subnet6"));
+            CfgSubnets6Ptr cfg = config->getCfgSubnets6();
+            cfg->add(subnet);
+            cfg->updateStatistics(subnet->getID());
+            added = subnet;
+        }
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger,
+                  v4 ? SUBNET_CMDS_ADD4_FAILED : SUBNET_CMDS_ADD6_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    LOG_INFO(subnet_cmds_logger, v4 ? SUBNET_CMDS_ADD4 : SUBNET_CMDS_ADD6)
+        .arg(added->toText())
+        .arg(added->getID());
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         v4 ? "IPv4 subnet added" : "IPv6 subnet added",
+                         subnetsArg(briefSubnet(*added))));
+}
+
+ConstElementPtr
+SubnetCmdsImpl::subnetUpdateHandler(const string& command,
+                                    ConstElementPtr args) {
+    const bool v4 = (command == "subnet4-update");
+
+    string txt = "(missing parameters)";
+    if (args) {
+        txt = args->str();
+    }
+
+    SubnetPtr updated;
+    try {
+        SrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        if (v4) {
+            Subnet4Ptr subnet = parseSubnet4(getSubnetArg(args, "subnet4"));
+            CfgSubnets4Ptr cfg = config->getCfgSubnets4();
+            replaceSubnet(cfg, subnet);
+            cfg->updateStatistics(subnet->getID());
+            updated = subnet;
+
+        } else {
+            Subnet6Ptr subnet = parseSubnet6(getSubnetArg(args, "subnet6"));
+            CfgSubnets6Ptr cfg = config->getCfgSubnets6();
+            replaceSubnet(cfg, subnet);
+            cfg->updateStatistics(subnet->getID());
+            updated = subnet;
+        }
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger,
+                  v4 ? SUBNET_CMDS_UPDATE4_FAILED : SUBNET_CMDS_UPDATE6_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    LOG_INFO(subnet_cmds_logger, v4 ? SUBNET_CMDS_UPDATE4 : SUBNET_CMDS_UPDATE6)
+        .arg(updated->toText())
+        .arg(updated->getID());
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         v4 ? "IPv4 subnet updated" : "IPv6 subnet updated",
+                         subnetsArg(briefSubnet(*updated))));
+}
+
+ConstElementPtr
+SubnetCmdsImpl::subnetDelHandler(const string& command, ConstElementPtr args) {
+    const bool v4 = (command == "subnet4-del");
+    const string family = (v4 ? "IPv4" : "IPv6");
+
+    string txt = "(missing parameters)";
+    if (args) {
+        txt = args->str();
+    }
+
+    ConstSubnetPtr deleted;
+    try {
+        if (!args || (args->getType() != Element::map)) {
+            isc_throw(BadValue, "Parameters missing or are not a map.");
+        }
+        SimpleParser parser;
+        SubnetID subnet_id = parser.getUint32(args, "id");
+
+        SrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        if (v4) {
+            CfgSubnets4Ptr cfg = config->getCfgSubnets4();
+            ConstSubnet4Ptr subnet = cfg->getBySubnetId(subnet_id);
+            if (subnet) {
+                cfg->del(subnet);
+                discountDeclined(subnet_id);
+                cfg->removeStatistics(subnet_id);
+            }
+            deleted = subnet;
+
+        } else {
+            CfgSubnets6Ptr cfg = config->getCfgSubnets6();
+            ConstSubnet6Ptr subnet = cfg->getBySubnetId(subnet_id);
+            if (subnet) {
+                cfg->del(subnet);
+                discountDeclined(subnet_id);
+                cfg->removeStatistics(subnet_id);
+            }
+            deleted = subnet;
+        }
+
+        if (!deleted) {
+            ostringstream msg;
+            msg << "No " << family << " subnet with id " << subnet_id
+                << " found";
+            return (createAnswer(CONTROL_RESULT_EMPTY, msg.str()));
+        }
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger,
+                  v4 ? SUBNET_CMDS_DEL4_FAILED : SUBNET_CMDS_DEL6_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+
+    LOG_INFO(subnet_cmds_logger, v4 ? SUBNET_CMDS_DEL4 : SUBNET_CMDS_DEL6)
+        .arg(deleted->toText())
+        .arg(deleted->getID());
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         family + " subnet " + subnetText(*deleted) +
+                         " deleted", subnetsArg(briefSubnet(*deleted))));
+}
+
+ConstElementPtr
+SubnetCmdsImpl::getSubnetArg(const ConstElementPtr& args, const string& name) {
+    if (!args || (args->getType() != Element::map)) {
+        isc_throw(BadValue, "Parameters missing or are not a map.");
+    }
+
+    ConstElementPtr subnets = args->get(name);
+    if (!subnets || (subnets->getType() != Element::list) ||
+        (subnets->size() != 1)) {
+        isc_throw(BadValue, "'" << name << "' parameter must be a list"
+                  " holding exactly one subnet");
+    }
+
+    ConstElementPtr subnet = subnets->get(0);
+    if (subnet->getType() != Element::map) {
+        isc_throw(BadValue, "subnet must be a map");
+    }
+    if (subnet->contains("reservations")) {
+        isc_throw(BadValue, "host reservations must not be specified in the"
+                  " subnet, use host commands to manage them");
+    }
+
+    return (subnet);
+}
+
+Subnet4Ptr
+SubnetCmdsImpl::parseSubnet4(const ConstElementPtr& subnet) {
+    ElementPtr copied = isc::data::copy(subnet);
+    SimpleParser::setDefaults(copied, SimpleParser4::SUBNET4_DEFAULTS);
+
+    ElementPtr global = Element::createMap();
+    SimpleParser::setDefaults(global, SimpleParser4::GLOBAL4_DEFAULTS);
+    SimpleParser::deriveParams(global, copied,
+                               SimpleParser4::INHERIT_GLOBAL_TO_SUBNET4);
+
+    return (parseSubnet<Subnet4ConfigParser, Subnet4Ptr>(copied));
+}
+
+Subnet6Ptr
+SubnetCmdsImpl::parseSubnet6(const ConstElementPtr& subnet) {
+    ElementPtr copied = isc::data::copy(subnet);
+    SimpleParser::setDefaults(copied, SimpleParser6::SUBNET6_DEFAULTS);
+
+    ElementPtr global = Element::createMap();
+    SimpleParser::setDefaults(global, SimpleParser6::GLOBAL6_DEFAULTS);
+    SimpleParser::deriveParams(global, copied,
+                               SimpleParser6::INHERIT_GLOBAL_TO_SUBNET6);
+
+    return (parseSubnet<Subnet6ConfigParser, Subnet6Ptr>(copied));
+}
+
+template<typename ParserType, typename SubnetPtrType>
+SubnetPtrType
+SubnetCmdsImpl::parseSubnet(const ConstElementPtr& subnet) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    cfg_mgr.rollback();
+
+    SubnetPtrType parsed;
+    try {
+        cfg_mgr.getCurrentCfg()->getCfgOptionDef()->
+            copyTo(*cfg_mgr.getStagingCfg()->getCfgOptionDef());
+        ParserType parser;
+        parsed = parser.parse(subnet);
+
+    } catch (...) {
+        cfg_mgr.rollback();
+        throw;
+    }
+
+    cfg_mgr.rollback();
+    return (parsed);
+}
+
+template<typename CfgSubnetsPtrType, typename SubnetPtrType>
+void
+SubnetCmdsImpl::replaceSubnet(const CfgSubnetsPtrType& cfg,
+                              const SubnetPtrType& subnet) {
+    typedef typename SubnetPtrType::element_type SubnetType;
+
+    boost::shared_ptr<const SubnetType> old =
+        cfg->getBySubnetId(subnet->getID());
+    if (!old) {
+        isc_throw(BadValue, "no subnet with id " << subnet->getID()
+                  << " found");
+    }
+
+    cfg->del(old);
+    try {
+        cfg->add(subnet);
+
+    } catch (...) {
+        cfg->add(boost::const_pointer_cast<SubnetType>(old));
+        throw;
+    }
+}
+
+void
+SubnetCmdsImpl::discountDeclined(const SubnetID& subnet_id) {
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined && (declined->getInteger().first != 0)) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
+}
+
+ElementPtr
+SubnetCmdsImpl::briefSubnet(const Subnet& subnet) {
+    ElementPtr brief = Element::createMap();
+    brief->set("id", Element::create(static_cast<long int>(subnet.getID())));
+    brief->set("subnet", Element::create(subnet.toText()));
+    return (brief);
+}
+
+ElementPtr
+SubnetCmdsImpl::subnetsArg(const ElementPtr& subnet) {
+    ElementPtr subnets = Element::createList();
+    subnets->add(subnet);
+    ElementPtr result = Element::createMap();
+    result->set("subnets", subnets);
+    return (result);
+}
+
+string
+SubnetCmdsImpl::subnetText(const Subnet& subnet) {
+    ostringstream txt;
+    txt << subnet.toText() << " (id " << subnet.getID() << ")";
+    return (txt.str());
+}
+
+SubnetCmds::SubnetCmds()
+    :impl_(new SubnetCmdsImpl()) {
+}
+
+SubnetCmds::~SubnetCmds() {
+    impl_.reset();
+}
+
+};
+};
@@ -0,0 +1,68 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SUBNET_CMDS_H
+#define SUBNET_CMDS_H
+
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace subnet_cmds {
+
+/// @brief Forward declaration of implementation class.
+class SubnetCmdsImpl;
+
+/// @brief A wrapper class that provides convenient initialization to the library.
+///
+/// This is a wrapper class that simply registers extra commands when
+/// instantiated and deregisters them when the instance is destroyed.
+///
+/// For an actual implementation, see @ref SubnetCmdsImpl class in
+/// subnet_cmds.cc file.
+class SubnetCmds {
+public:
+
+    /// @brief Initializes additional subnet commands.
+    ///
+    /// It registers the following commands:
+    /// - subnet4-list
+    /// - subnet6-list
+    /// - subnet4-get
+    /// - subnet6-get
+    /// - subnet4-add
+    /// - subnet6-add
+    /// - subnet4-update
+    /// - subnet6-update
+    /// - subnet4-del
+    /// - subnet6-del
+    ///
+    /// @throw Unexpected If any of the above fails.
+    SubnetCmds();
+
+    /// @brief Destructor
+    ///
+    /// Unregisters commands:
+    /// - subnet4-list
+    /// - subnet6-list
+    /// - subnet4-get
+    /// - subnet6-get
+    /// - subnet4-add
+    /// - subnet6-add
+    /// - subnet4-update
+    /// - subnet6-update
+    /// - subnet4-del
+    /// - subnet6-del
+    ~SubnetCmds();
+private:
+
+    /// Pointer to the actual implementation
+    boost::shared_ptr<SubnetCmdsImpl> impl_;
+};
+
+};
+};
+
+#endif
@@ -0,0 +1,23 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SUBNET_CMDS_LOG_H
+#define SUBNET_CMDS_LOG_H
+
+#include <log/logger_support.h>
+#include <log/macros.h>
+#include <subnet_cmds_messages.h>
+
+namespace isc {
+namespace subnet_cmds {
+
+extern isc::log::Logger subnet_cmds_logger;
+
+} // end of isc::subnet_cmds
+} // end of isc namespace
+
+
+#endif
@@ -0,0 +1,553 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <exceptions/exceptions.h>
+#include <hooks/hooks_manager.h>
+#include <config/command_mgr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <stats/stats_mgr.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace std;
+using namespace isc;
+using namespace isc::hooks;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::asiolink;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture for testing loading and unloading the subnet_cmds
+/// library
+class LibLoadTest : public ::testing::Test {
+public:
+    /// @brief Constructor
+    LibLoadTest(std::string lib_filename)
+        : lib_name_(lib_filename) {
+        CommandMgr::instance();
+        unloadLibs();
+    }
+
+    /// @brief Destructor
+    virtual ~LibLoadTest() {
+        unloadLibs();
+    }
+
+    /// @brief Adds library/parameters to list of libraries to be loaded
+    void addLib(const std::string& lib, ConstElementPtr params) {
+        libraries_.push_back(make_pair(lib, params));
+    }
+
+    /// @brief Load all specified libraries.
+    ///
+    /// The libraries are stored in libraries
+    void loadLibs() {
+        ASSERT_TRUE(HooksManager::loadLibraries(libraries_))
+            << "library loading failed";
+    }
+
+    /// @brief Unloads all libraries.
+    void unloadLibs() {
+        ASSERT_NO_THROW(HooksManager::unloadLibraries());
+    }
+
+    /// @brief Checks whether specified command is registered
+    ///
+    /// @param name name of the command to be checked
+    /// @param expect_true true - must be registered, false - must not be
+    void checkCommandRegistered(const std::string& name, bool expect_true) {
+
+        // First get the list of registered commands
+        ConstElementPtr lst = Element::fromJSON("{ \"command\": \"list-commands\" }");
+        ConstElementPtr rsp = CommandMgr::instance().processCommand(lst);
+
+        ASSERT_TRUE(rsp);
+
+        ConstElementPtr args = rsp->get("arguments");
+        ASSERT_TRUE(args);
+
+        string args_txt = args->str();
+
+        if (expect_true) {
+            EXPECT_TRUE(args_txt.find(name) != string::npos);
+        } else {
+            EXPECT_TRUE(args_txt.find(name) == string::npos);
+        }
+    }
+
+    /// @brief tests specified command and verifies response
+    ///
+    /// This method loads the library, sends specific command,
+    /// then checks if the result is as expected, checks if text response
+    /// is ok (optional, check skipped if exp_txt is empty) and then returns
+    /// the response (for possible additional checks).
+    ///
+    /// @param cmd JSON command to be sent (must be valid JSON)
+    /// @param exp_result 0 - success, 1 - error, 2 - ...
+    /// @param exp_txt expected text response (optional)
+    /// @return full response returned by the command execution.
+    ConstElementPtr testCommand(string cmd_txt, int exp_result, string exp_txt) {
+        // Let's load the library first.
+        loadLib();
+
+        ConstElementPtr cmd;
+        EXPECT_NO_THROW(cmd = Element::fromJSON(cmd_txt));
+        if (!cmd) {
+            ADD_FAILURE() << cmd_txt << " is not a valid JSON, test broken";
+            return (ConstElementPtr());
+        }
+
+        // Process the command and verify response.
+        ConstElementPtr rsp = CommandMgr::instance().processCommand(cmd);
+        checkAnswer(rsp, exp_result, exp_txt);
+
+        return (rsp);
+    }
+
+    /// @brief Compares the status in the given parse result to a given value.
+    ///
+    /// @param answer Element set containing an integer response and string
+    /// comment.
+    /// @param exp_status is an integer against which to compare the status.
+    /// @param exp_txt is expected text (not checked if "")
+    void checkAnswer(isc::data::ConstElementPtr answer,
+                     int exp_status,
+                     string exp_txt = "") {
+        int rcode = 0;
+        isc::data::ConstElementPtr comment;
+        comment = isc::config::parseAnswer(rcode, answer);
+
+        if (rcode != exp_status) {
+            ADD_FAILURE() << "Expected status code " << exp_status
+                          << " but received " << rcode << ", comment: "
+                          << (comment ? comment->str() : "(none)");
+        }
+
+        // If there are arguments, parseAnswer returns them instead of
+        // the text.
+        if (comment->getType() != Element::string) {
+            comment = answer->get("text");
+        }
+
+        if (!exp_txt.empty()) {
+            EXPECT_EQ(exp_txt, comment->stringValue());
+        }
+    }
+
+    /// @brief Loads the library specified by lib_name_
+    void loadLib() {
+        if (libraries_.empty()) {
+            data::ElementPtr params = data::Element::createMap();
+            addLib(lib_name_, params);
+        }
+        EXPECT_NO_THROW(loadLibs());
+    }
+
+    /// @brief Test checks if specified commands are provided by the library.
+    ///
+    /// @param cms a vector of string with command names
+    void testCommands(const std::vector<string> cmds) {
+
+        // The commands should not be registered yet.
+        for (auto cmd = cmds.begin(); cmd != cmds.end(); ++cmd) {
+            checkCommandRegistered(*cmd, false);
+        }
+
+        loadLib();
+
+        // The commands should be available after library was loaded.
+        for (auto cmd = cmds.begin(); cmd != cmds.end(); ++cmd) {
+            checkCommandRegistered(*cmd, true);
+        }
+
+        unloadLibs();
+
+        // and the commands should be gone now.
+        for (auto cmd = cmds.begin(); cmd != cmds.end(); ++cmd) {
+            checkCommandRegistered(*cmd, false);
+        }
+    }
+
+    /// List of libraries to be/being loaded (usually just one)
+    HookLibsCollection libraries_;
+
+    /// Path to the library filename
+    std::string lib_name_;
+};
+
+/// @brief Class dedicated to testing subnet_cmds library.
+///
+/// Configures one subnet with an assigned lease in the family under test.
+class SubnetCmdsTest : public LibLoadTest {
+public:
+
+    /// @brief Constructor
+    SubnetCmdsTest()
+        :LibLoadTest(SUBNET_CMDS_LIB_SO) {
+        LeaseMgrFactory::destroy();
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Destructor
+    virtual ~SubnetCmdsTest() {
+        // destroys lease manager first because the other order triggers
+        // a clang/boost bug
+        LeaseMgrFactory::destroy();
+        unloadLibs();
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Creates the lease manager and the initial configuration.
+    ///
+    /// The configuration holds a subnet with id 10 and a 10 address
+    /// pool (192.0.2.0/24 or 2001:db8:1::/64), and the lease manager holds
+    /// an assigned and a declined lease in this subnet and an assigned
+    /// lease in the subnet with id 20 which is not configured yet.
+    ///
+    /// @param v6 true = v6, false = v4
+    void init(bool v6) {
+        std::ostringstream s;
+        s << "type=memfile persist=false " << (v6 ? "universe=6" : "universe=4");
+        LeaseMgrFactory::create(s.str());
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+
+        CfgMgr& cfg_mgr = CfgMgr::instance();
+        if (v6) {
+            Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 64,
+                                          1, 2, 3, 4, 10));
+            subnet->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA,
+                                               IOAddress("2001:db8:1::1"),
+                                               IOAddress("2001:db8:1::a"))));
+            cfg_mgr.getStagingCfg()->getCfgSubnets6()->add(subnet);
+
+            lease_mgr.addLease(createLease6("2001:db8:1::1", 10,
+                                            Lease::STATE_DEFAULT));
+            lease_mgr.addLease(createLease6("2001:db8:1::2", 10,
+                                            Lease::STATE_DECLINED));
+            lease_mgr.addLease(createLease6("2001:db8:2::1", 20,
+                                            Lease::STATE_DEFAULT));
+        } else {
+            Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24,
+                                          1, 2, 3, 10));
+            subnet->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.2.1"),
+                                               IOAddress("192.0.2.10"))));
+            cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet);
+
+            lease_mgr.addLease(createLease4("192.0.2.1", 10,
+                                            Lease::STATE_DEFAULT));
+            lease_mgr.addLease(createLease4("192.0.2.2", 10,
+                                            Lease::STATE_DECLINED));
+            lease_mgr.addLease(createLease4("192.0.3.1", 20,
+                                            Lease::STATE_DEFAULT));
+        }
+        cfg_mgr.commit();
+    }
+
+    /// @brief Creates an IPv4 lease.
+    ///
+    /// @param address leased address
+    /// @param subnet_id subnet identifier
+    /// @param state lease state
+    Lease4Ptr createLease4(const std::string& address, SubnetID subnet_id,
+                           uint32_t state) {
+        Lease4Ptr lease(new Lease4());
+        lease->addr_ = IOAddress(address);
+        lease->hwaddr_.reset(new HWAddr(vector<uint8_t>(6, 0x08), HTYPE_ETHER));
+        lease->valid_lft_ = 3600;
+        lease->cltt_ = time(NULL);
+        lease->subnet_id_ = subnet_id;
+        lease->state_ = state;
+        return (lease);
+    }
+
+    /// @brief Creates an IPv6 lease.
+    ///
+    /// @param address leased address
+    /// @param subnet_id subnet identifier
+    /// @param state lease state
+    Lease6Ptr createLease6(const std::string& address, SubnetID subnet_id,
+                           uint32_t state) {
+        Lease6Ptr lease(new Lease6());
+        lease->addr_ = IOAddress(address);
+        lease->type_ = Lease::TYPE_NA;
+        lease->prefixlen_ = 128;
+        lease->iaid_ = 42;
+        lease->duid_ = DuidPtr(new DUID(vector<uint8_t>(8, 0x77)));
+        lease->preferred_lft_ = 1800;
+        lease->valid_lft_ = 3600;
+        lease->cltt_ = time(NULL);
+        lease->subnet_id_ = subnet_id;
+        lease->state_ = state;
+        return (lease);
+    }
+
+    /// @brief Returns the value of a statistic or -1 if it doesn't exist.
+    ///
+    /// @param name name of the global statistic
+    /// @param subnet_id subnet identifier (0 for a global statistic)
+    int64_t getStat(const std::string& name, SubnetID subnet_id = 0) {
+        std::string stat_name = name;
+        if (subnet_id != 0) {
+            stat_name = StatsMgr::generateName("subnet", subnet_id, name);
+        }
+        ObservationPtr stat = StatsMgr::instance().getObservation(stat_name);
+        if (!stat) {
+            return (-1);
+        }
+        return (stat->getInteger().first);
+    }
+};
+
+// Checks that the library can be loaded and registers the commands.
+TEST_F(SubnetCmdsTest, commands) {
+
+    vector<string> cmds = { "subnet4-list",   "subnet6-list",
+                            "subnet4-get",    "subnet6-get",
+                            "subnet4-add",    "subnet6-add",
+                            "subnet4-update", "subnet6-update",
+                            "subnet4-del",    "subnet6-del" };
+    testCommands(cmds);
+}
+
+// Checks that the IPv4 subnets are listed and returned.
+TEST_F(SubnetCmdsTest, subnet4ListGet) {
+    init(false);
+
+    ConstElementPtr rsp =
+        testCommand("{ \"command\": \"subnet4-list\" }",
+                    CONTROL_RESULT_SUCCESS, "1 IPv4 subnets found");
+    ASSERT_TRUE(rsp);
+    EXPECT_EQ("{ \"subnets\": [ { \"id\": 10, \"subnet\": \"192.0.2.0/24\" } ] }",
+              rsp->get("arguments")->str());
+
+    rsp = testCommand("{ \"command\": \"subnet4-get\","
+                      "  \"arguments\": { \"subnet\": \"192.0.2.0/24\" } }",
+                      CONTROL_RESULT_SUCCESS,
+                      "Info about IPv4 subnet 192.0.2.0/24 (id 10) returned");
+    ASSERT_TRUE(rsp);
+    ConstElementPtr subnet = rsp->get("arguments")->get("subnets")->get(0);
+    EXPECT_EQ(10, subnet->get("id")->intValue());
+    EXPECT_EQ(1, subnet->get("pools")->size());
+
+    testCommand("{ \"command\": \"subnet4-get\","
+                "  \"arguments\": { \"id\": 20 } }",
+                CONTROL_RESULT_EMPTY, "No IPv4 subnet with id 20 found");
+
+    testCommand("{ \"command\": \"subnet6-list\" }",
+                CONTROL_RESULT_EMPTY, "No IPv6 subnets found");
+}
+
+// Checks that an IPv4 subnet is added with its statistics, leaving the
+// other subnets untouched.
+TEST_F(SubnetCmdsTest, subnet4Add) {
+    init(false);
+
+    // This value would be reset by a full recount.
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 10,
+                                                         "assigned-addresses"),
+                                  static_cast<int64_t>(5));
+
+    ConstElementPtr rsp =
+        testCommand("{ \"command\": \"subnet4-add\","
+                    "  \"arguments\": { \"subnet4\": [ {"
+                    "    \"id\": 20,"
+                    "    \"subnet\": \"192.0.3.0/24\","
+                    "    \"pools\": [ { \"pool\": \"192.0.3.1 - 192.0.3.100\" } ],"
+                    "    \"option-data\": [ { \"name\": \"routers\","
+                    "                         \"data\": \"192.0.3.254\" } ]"
+                    "  } ] } }",
+                    CONTROL_RESULT_SUCCESS, "IPv4 subnet added");
+    ASSERT_TRUE(rsp);
+    EXPECT_EQ("{ \"subnets\": [ { \"id\": 20, \"subnet\": \"192.0.3.0/24\" } ] }",
+              rsp->get("arguments")->str());
+
+    ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getBySubnetId(20);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("192.0.3.0/24", subnet->toText());
+    // The global defaults are used for the inherited parameters.
+    EXPECT_EQ(7200, subnet->getValid());
+    EXPECT_TRUE(subnet->getCfgOption()->get("dhcp4", DHO_ROUTERS).option_);
+    EXPECT_EQ(2, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+
+    EXPECT_EQ(100, getStat("total-addresses", 20));
+    EXPECT_EQ(1, getStat("assigned-addresses", 20));
+    EXPECT_EQ(5, getStat("assigned-addresses", 10));
+    EXPECT_EQ(1, getStat("declined-addresses"));
+
+    // The prefix and the identifier must be unique.
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 30, \"subnet\": \"192.0.3.0/24\" } ] } }",
+                CONTROL_RESULT_ERROR, "");
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 20, \"subnet\": \"192.0.4.0/24\" } ] } }",
+                CONTROL_RESULT_ERROR, "");
+    EXPECT_EQ(2, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+}
+
+// Checks that invalid IPv4 subnets are rejected.
+TEST_F(SubnetCmdsTest, subnet4AddBadParams) {
+    init(false);
+
+    testCommand("{ \"command\": \"subnet4-add\" }",
+                CONTROL_RESULT_ERROR, "");
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ ] } }",
+                CONTROL_RESULT_ERROR, "");
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 20, \"subnet\": \"192.0.3.0/24\","
+                "    \"pools\": [ { \"pool\": \"192.0.4.1 - 192.0.4.100\" } ]"
+                "  } ] } }",
+                CONTROL_RESULT_ERROR, "");
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 20, \"subnet\": \"192.0.3.0/24\","
+                "    \"reservations\": [ { \"hw-address\": \"01:02:03:04:05:06\","
+                "                          \"ip-address\": \"192.0.3.200\" } ]"
+                "  } ] } }",
+                CONTROL_RESULT_ERROR, "");
+
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+}
+
+// Checks that an IPv4 subnet is replaced and its statistics recomputed.
+TEST_F(SubnetCmdsTest, subnet4Update) {
+    init(false);
+    EXPECT_EQ(10, getStat("total-addresses", 10));
+
+    testCommand("{ \"command\": \"subnet4-update\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 10,"
+                "    \"subnet\": \"192.0.2.0/24\","
+                "    \"valid-lifetime\": 1000,"
+                "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.50\" } ]"
+                "  } ] } }",
+                CONTROL_RESULT_SUCCESS, "IPv4 subnet updated");
+
+    ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getBySubnetId(10);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(1000, subnet->getValid());
+    EXPECT_EQ(50, getStat("total-addresses", 10));
+    EXPECT_EQ(1, getStat("assigned-addresses", 10));
+    EXPECT_EQ(1, getStat("declined-addresses", 10));
+    EXPECT_EQ(1, getStat("declined-addresses"));
+
+    // Unknown subnet.
+    testCommand("{ \"command\": \"subnet4-update\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 20, \"subnet\": \"192.0.3.0/24\" } ] } }",
+                CONTROL_RESULT_ERROR, "");
+}
+
+// Checks that an IPv4 subnet is removed with its statistics.
+TEST_F(SubnetCmdsTest, subnet4Del) {
+    init(false);
+
+    ConstElementPtr rsp =
+        testCommand("{ \"command\": \"subnet4-del\","
+                    "  \"arguments\": { \"id\": 10 } }",
+                    CONTROL_RESULT_SUCCESS,
+                    "IPv4 subnet 192.0.2.0/24 (id 10) deleted");
+    ASSERT_TRUE(rsp);
+    EXPECT_EQ("{ \"subnets\": [ { \"id\": 10, \"subnet\": \"192.0.2.0/24\" } ] }",
+              rsp->get("arguments")->str());
+
+    EXPECT_TRUE(CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+                getAll()->empty());
+    EXPECT_EQ(-1, getStat("total-addresses", 10));
+    EXPECT_EQ(-1, getStat("assigned-addresses", 10));
+    EXPECT_EQ(0, getStat("declined-addresses"));
+
+    // The leases are kept.
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.1")));
+
+    testCommand("{ \"command\": \"subnet4-del\","
+                "  \"arguments\": { \"id\": 10 } }",
+                CONTROL_RESULT_EMPTY, "No IPv4 subnet with id 10 found");
+
+    // Adding it back restores the statistics.
+    testCommand("{ \"command\": \"subnet4-add\","
+                "  \"arguments\": { \"subnet4\": [ {"
+                "    \"id\": 10, \"subnet\": \"192.0.2.0/24\" } ] } }",
+                CONTROL_RESULT_SUCCESS, "IPv4 subnet added");
+    EXPECT_EQ(1, getStat("declined-addresses", 10));
+    EXPECT_EQ(1, getStat("declined-addresses"));
+}
+
+// Checks that an IPv6 subnet is added, updated and removed.
+TEST_F(SubnetCmdsTest, subnet6) {
+    init(true);
+
+    testCommand("{ \"command\": \"subnet6-add\","
+                "  \"arguments\": { \"subnet6\": [ {"
+                "    \"id\": 20,"
+                "    \"subnet\": \"2001:db8:2::/64\","
+                "    \"pools\": [ { \"pool\": \"2001:db8:2::1 - 2001:db8:2::4\" } ],"
+                "    \"pd-pools\": [ { \"prefix\": \"3000::\", \"prefix-len\": 56,"
+                "                      \"delegated-len\": 64 } ]"
+                "  } ] } }",
+                CONTROL_RESULT_SUCCESS, "IPv6 subnet added");
+
+    ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets6()->getBySubnetId(20);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(3600, subnet->getPreferred());
+    EXPECT_EQ(4, getStat("total-nas", 20));
+    EXPECT_EQ(256, getStat("total-pds", 20));
+    EXPECT_EQ(1, getStat("assigned-nas", 20));
+    EXPECT_EQ(1, getStat("assigned-nas", 10));
+
+    testCommand("{ \"command\": \"subnet6-list\" }",
+                CONTROL_RESULT_SUCCESS, "2 IPv6 subnets found");
+
+    testCommand("{ \"command\": \"subnet6-update\","
+                "  \"arguments\": { \"subnet6\": [ {"
+                "    \"id\": 10,"
+                "    \"subnet\": \"2001:db8:1::/64\","
+                "    \"pools\": [ { \"pool\": \"2001:db8:1::1 - 2001:db8:1::2\" } ]"
+                "  } ] } }",
+                CONTROL_RESULT_SUCCESS, "IPv6 subnet updated");
+    EXPECT_EQ(2, getStat("total-nas", 10));
+    EXPECT_EQ(1, getStat("declined-addresses"));
+
+    // The prefix of the updated subnet must stay unique and the subnet
+    // is unchanged when it isn't.
+    testCommand("{ \"command\": \"subnet6-update\","
+                "  \"arguments\": { \"subnet6\": [ {"
+                "    \"id\": 10, \"subnet\": \"2001:db8:2::/64\" } ] } }",
+                CONTROL_RESULT_ERROR, "");
+    subnet = CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->
+        getBySubnetId(10);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("2001:db8:1::/64", subnet->toText());
+
+    testCommand("{ \"command\": \"subnet6-del\","
+                "  \"arguments\": { \"id\": 10 } }",
+                CONTROL_RESULT_SUCCESS,
+                "IPv6 subnet 2001:db8:1::/64 (id 10) deleted");
+    EXPECT_EQ(-1, getStat("total-nas", 10));
+    EXPECT_EQ(0, getStat("declined-addresses"));
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->
+              getAll()->size());
+}
+
+} // end of anonymous namespace
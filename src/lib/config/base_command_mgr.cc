@@ -33,6 +33,7 @@ BaseCommandMgr::registerCommand(const std::string& cmd, CommandHandler handler)
 
     HandlersPair handlers;
     handlers.handler = handler;
+    handlers.thread_safe = false;
     handlers_.insert(make_pair(cmd, handlers));
 
     LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_REGISTERED).arg(cmd);
@@ -53,6 +54,7 @@ BaseCommandMgr::registerExtendedCommand(const std::string& cmd,
 
     HandlersPair handlers;
     handlers.extended_handler = handler;
+    handlers.thread_safe = false;
     handlers_.insert(make_pair(cmd, handlers));
 
     LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_EXTENDED_REGISTERED).arg(cmd);
@@ -75,6 +77,22 @@ BaseCommandMgr::deregisterCommand(const std::string& cmd) {
     LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_DEREGISTERED).arg(cmd);
 }
 
+void
+BaseCommandMgr::setCommandThreadSafe(const std::string& cmd) {
+    HandlerContainer::iterator it = handlers_.find(cmd);
+    if (it == handlers_.end()) {
+        isc_throw(InvalidCommandName, "Handler for command '" << cmd
+                  << "' not found.");
+    }
+    it->second.thread_safe = true;
+}
+
+bool
+BaseCommandMgr::isCommandThreadSafe(const std::string& cmd) const {
+    HandlerContainer::const_iterator it = handlers_.find(cmd);
+    return ((it != handlers_.end()) && it->second.thread_safe);
+}
+
 void
 BaseCommandMgr::deregisterAll() {
 
@@ -137,6 +137,24 @@ public:
     /// @param cmd Name of the command that's no longer handled.
     void deregisterCommand(const std::string& cmd);
 
+    /// @brief Marks specified command as safe to execute in a thread other
+    /// than the thread processing packets.
+    ///
+    /// Only the commands which merely read the server state, through
+    /// facilities protecting it against concurrent modifications, should
+    /// be marked as thread safe. Such commands may be executed by the
+    /// @ref CommandMgr in its command thread.
+    ///
+    /// @param cmd Name of the command.
+    /// @throw InvalidCommandName if the command is not registered.
+    void setCommandThreadSafe(const std::string& cmd);
+
+    /// @brief Checks if specified command is marked as thread safe.
+    ///
+    /// @param cmd Name of the command.
+    /// @return true if the command is registered and marked as thread safe.
+    bool isCommandThreadSafe(const std::string& cmd) const;
+
     /// @brief Auxiliary method that removes all installed commands.
     ///
     /// The only unwipeable method is list-commands, which is internally
@@ -168,6 +186,7 @@ protected:
     struct HandlersPair {
         CommandHandler handler;
         ExtendedCommandHandler extended_handler;
+        bool thread_safe;
     };
 
     /// @brief Type of the container for command handlers.
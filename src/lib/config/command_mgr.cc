@@ -16,15 +16,23 @@
 #include <cc/json_feed.h>
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
+#include <hooks/hooks_manager.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
 #include <boost/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <array>
+#include <deque>
 #include <unistd.h>
 
 using namespace isc;
 using namespace isc::asiolink;
 using namespace isc::config;
 using namespace isc::data;
+using namespace isc::util;
+using namespace isc::util::thread;
 
 namespace {
 
@@ -35,6 +43,7 @@ const size_t BUF_SIZE = 8192;
 const unsigned short DEFAULT_CONNECTION_TIMEOUT = 10;
 
 class ConnectionPool;
+class CommandExecutor;
 
 /// @brief Represents a single connection over control socket.
 ///
@@ -54,14 +63,16 @@ public:
     /// for data transmission.
     /// @param connection_pool Reference to the connection pool to which this
     /// connection belongs.
+    /// @param executor Reference to the object executing the commands.
     /// @param timeout Connection timeout (in seconds).
     Connection(const IOServicePtr& io_service,
                const boost::shared_ptr<UnixDomainSocket>& socket,
                ConnectionPool& connection_pool,
+               CommandExecutor& executor,
                const unsigned short timeout)
         : socket_(socket), timeout_timer_(*io_service), timeout_(timeout),
-          buf_(), response_(), connection_pool_(connection_pool), feed_(),
-          response_in_progress_(false) {
+          buf_(), response_(), connection_pool_(connection_pool),
+          executor_(executor), feed_(), response_in_progress_(false) {
 
         LOG_INFO(command_logger, COMMAND_SOCKET_CONNECTION_OPENED)
             .arg(socket_->getNative());
@@ -133,14 +144,21 @@ public:
            boost::bind(&Connection::sendHandler, shared_from_this(), _1, _2));
     }
 
+    /// @brief Sends the response to the command received over the connection.
+    ///
+    /// If the response is NULL, the connection is closed.
+    ///
+    /// @param rsp Response generated by the server.
+    void sendResponse(const ConstElementPtr& rsp);
+
     /// @brief Handler invoked when the data is received over the control
     /// socket.
     ///
     /// It collects received data into the @c isc::config::JSONFeed object and
     /// schedules additional asynchronous read of data if this object signals
     /// that command is incomplete. When the entire command is received, the
-    /// handler processes this command and asynchronously responds to the
-    /// controlling client.
+    /// handler passes this command to the @c CommandExecutor which responds
+    /// to the controlling client once the command is processed.
     //
     ///
     /// @param ec Error code.
@@ -163,7 +181,8 @@ public:
     /// @brief Handler invoked when timeout has occurred.
     ///
     /// Asynchronously sends a response to the client indicating that the
-    /// timeout has occurred.
+    /// timeout has occurred, unless the command has been received and is
+    /// being processed.
     void timeoutHandler();
 
 private:
@@ -186,6 +205,9 @@ private:
     /// @brief Reference to the pool of connections.
     ConnectionPool& connection_pool_;
 
+    /// @brief Reference to the object executing the commands.
+    CommandExecutor& executor_;
+
     /// @brief State model used to receive data over the connection and detect
     /// when the command ends.
     JSONFeed feed_;
@@ -240,6 +262,347 @@ private:
 
 };
 
+/// @brief Executes the commands received over the control sockets.
+///
+/// The commands are executed in the order in which they are received. If
+/// the command thread is running, the thread safe commands are passed to
+/// this thread, which posts their responses to the IO service and marks
+/// the watch socket ready to wake up the thread processing packets. The
+/// other commands are executed in the IO service thread when there are no
+/// commands in progress in the command thread. Until then, they and the
+/// commands received after them wait in the queue of pending commands.
+///
+/// The members not protected by the mutex are only accessed from the IO
+/// service thread.
+class CommandExecutor {
+public:
+
+    /// @brief Constructor.
+    CommandExecutor()
+        : io_service_(), pending_(), threaded_(), watch_socket_(), thread_(),
+          mutex_(), cond_var_(), idle_cond_var_(), jobs_(), busy_(false),
+          stopping_(false) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Stops the command thread.
+    ~CommandExecutor() {
+        try {
+            stop();
+        } catch (...) {
+            // Destructors must not throw.
+        }
+    }
+
+    /// @brief Sets the IO service to which the responses are posted.
+    ///
+    /// @param io_service Pointer to the IO service.
+    void setIOService(const IOServicePtr& io_service) {
+        io_service_ = io_service;
+    }
+
+    /// @brief Starts the command thread.
+    void start();
+
+    /// @brief Stops the command thread.
+    ///
+    /// The thread terminates after executing the commands passed to it.
+    void stop();
+
+    /// @brief Checks if the command thread is running.
+    bool isRunning() const {
+        return (thread_.get() != NULL);
+    }
+
+    /// @brief Waits until the command thread has executed all commands
+    /// passed to it.
+    void wait();
+
+    /// @brief Executes the command received over the connection.
+    ///
+    /// @param connection Connection over which the command was received
+    /// and the response is sent.
+    /// @param cmd Command to be executed.
+    void execute(const ConnectionPtr& connection, const ConstElementPtr& cmd);
+
+private:
+
+    /// @brief Command waiting for the execution.
+    struct PendingCommand {
+        /// @brief Connection over which the response is sent.
+        ConnectionPtr connection_;
+
+        /// @brief Command to be executed.
+        ConstElementPtr command_;
+
+        /// @brief Indicates if the command can be executed in the command
+        /// thread.
+        bool thread_safe_;
+    };
+
+    /// @brief Checks if the command can be executed in the command thread.
+    ///
+    /// @param cmd Command received over the connection.
+    /// @return true if the command is well formed, is marked as thread safe
+    /// and is not handled by a hook library.
+    static bool isThreadSafe(const ConstElementPtr& cmd);
+
+    /// @brief Executes the command and catches all errors.
+    ///
+    /// @param cmd Command to be executed.
+    /// @return Response to the command.
+    static ConstElementPtr process(const ConstElementPtr& cmd);
+
+    /// @brief Executes the pending commands.
+    ///
+    /// The thread safe commands are passed to the command thread. The first
+    /// other command is executed if the command thread is idle, otherwise
+    /// it is left in the queue with the commands received after it.
+    void executePending();
+
+    /// @brief Sends the response of a command executed in the command thread.
+    ///
+    /// This handler is posted to the IO service by the command thread.
+    ///
+    /// @param rsp Response to the command.
+    void complete(const ConstElementPtr& rsp);
+
+    /// @brief Clears the watch socket.
+    ///
+    /// This is the callback of the watch socket registered in the
+    /// @c IfaceMgr.
+    void clearWatchSocket();
+
+    /// @brief Main function of the command thread.
+    void run();
+
+    /// @brief IO service to which the responses are posted.
+    IOServicePtr io_service_;
+
+    /// @brief Commands waiting for the execution.
+    std::deque<PendingCommand> pending_;
+
+    /// @brief Connections of the commands passed to the command thread, in
+    /// the order in which the commands were passed.
+    std::deque<ConnectionPtr> threaded_;
+
+    /// @brief Watch socket waking up the thread processing packets when
+    /// a response is posted.
+    boost::scoped_ptr<WatchSocket> watch_socket_;
+
+    /// @brief Command thread.
+    boost::scoped_ptr<Thread> thread_;
+
+    /// @name Members shared with the command thread.
+    ///
+    /// These members are protected by the @c mutex_.
+    //@{
+
+    /// @brief Mutex protecting the shared members.
+    Mutex mutex_;
+
+    /// @brief Condition variable signalled when a command is passed to the
+    /// command thread or the thread should terminate.
+    CondVar cond_var_;
+
+    /// @brief Condition variable signalled when the command thread becomes
+    /// idle.
+    CondVar idle_cond_var_;
+
+    /// @brief Commands to be executed by the command thread.
+    std::deque<ConstElementPtr> jobs_;
+
+    /// @brief Indicates if the command thread is executing a command.
+    bool busy_;
+
+    /// @brief Indicates if the command thread should terminate.
+    bool stopping_;
+
+    //@}
+};
+
+void
+CommandExecutor::start() {
+    if (isRunning()) {
+        return;
+    }
+
+    watch_socket_.reset(new WatchSocket());
+    isc::dhcp::IfaceMgr::instance().
+        addExternalSocket(watch_socket_->getSelectFd(),
+                          boost::bind(&CommandExecutor::clearWatchSocket, this));
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = false;
+    }
+    thread_.reset(new Thread(boost::bind(&CommandExecutor::run, this)));
+
+    LOG_INFO(command_logger, COMMAND_THREAD_STARTED);
+}
+
+void
+CommandExecutor::stop() {
+    if (!isRunning()) {
+        return;
+    }
+
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+        cond_var_.signal();
+    }
+    thread_->wait();
+    thread_.reset();
+
+    isc::dhcp::IfaceMgr::instance().
+        deleteExternalSocket(watch_socket_->getSelectFd());
+    watch_socket_.reset();
+
+    LOG_INFO(command_logger, COMMAND_THREAD_STOPPED);
+}
+
+void
+CommandExecutor::wait() {
+    if (!isRunning()) {
+        return;
+    }
+
+    Mutex::Locker lock(mutex_);
+    while (busy_ || !jobs_.empty()) {
+        idle_cond_var_.wait(mutex_);
+    }
+}
+
+void
+CommandExecutor::execute(const ConnectionPtr& connection,
+                         const ConstElementPtr& cmd) {
+    PendingCommand pending;
+    pending.connection_ = connection;
+    pending.command_ = cmd;
+    pending.thread_safe_ = isRunning() && isThreadSafe(cmd);
+    pending_.push_back(pending);
+    executePending();
+}
+
+bool
+CommandExecutor::isThreadSafe(const ConstElementPtr& cmd) {
+    std::string name;
+    try {
+        ConstElementPtr arg;
+        name = parseCommand(arg, cmd);
+
+    } catch (const std::exception&) {
+        // The malformed command is rejected in the IO service thread.
+        return (false);
+    }
+
+    // The hook libraries are not thread safe.
+    return (CommandMgr::instance().isCommandThreadSafe(name) &&
+            !isc::hooks::HooksManager::commandHandlersPresent(name));
+}
+
+ConstElementPtr
+CommandExecutor::process(const ConstElementPtr& cmd) {
+    try {
+        return (CommandMgr::instance().processCommand(cmd));
+
+    } catch (const std::exception& ex) {
+        LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what())));
+
+    } catch (...) {
+        LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg("unknown error");
+        return (createAnswer(CONTROL_RESULT_ERROR, "unknown error"));
+    }
+}
+
+void
+CommandExecutor::executePending() {
+    while (!pending_.empty()) {
+        PendingCommand next = pending_.front();
+        if (next.thread_safe_ && isRunning()) {
+            pending_.pop_front();
+            threaded_.push_back(next.connection_);
+            Mutex::Locker lock(mutex_);
+            jobs_.push_back(next.command_);
+            cond_var_.signal();
+
+        } else if (!threaded_.empty()) {
+            // The command must not be executed concurrently with the
+            // commands in the command thread. It will be executed when
+            // they complete.
+            return;
+
+        } else {
+            pending_.pop_front();
+            next.connection_->sendResponse(process(next.command_));
+        }
+    }
+}
+
+void
+CommandExecutor::complete(const ConstElementPtr& rsp) {
+    if (threaded_.empty()) {
+        return;
+    }
+    ConnectionPtr connection = threaded_.front();
+    threaded_.pop_front();
+    connection->sendResponse(rsp);
+    executePending();
+}
+
+void
+CommandExecutor::clearWatchSocket() {
+    if (watch_socket_) {
+        try {
+            watch_socket_->clearReady();
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_THREAD_WATCH_SOCKET_FAIL)
+                .arg(ex.what());
+        }
+    }
+}
+
+void
+CommandExecutor::run() {
+    for (;;) {
+        ConstElementPtr cmd;
+        {
+            Mutex::Locker lock(mutex_);
+            while (!stopping_ && jobs_.empty()) {
+                cond_var_.wait(mutex_);
+            }
+            // The commands passed to the thread are executed before it
+            // terminates, so each connection gets its response.
+            if (jobs_.empty()) {
+                return;
+            }
+            cmd = jobs_.front();
+            jobs_.pop_front();
+            busy_ = true;
+        }
+
+        ConstElementPtr rsp = process(cmd);
+        io_service_->post(boost::bind(&CommandExecutor::complete, this, rsp));
+
+        try {
+            watch_socket_->markReady();
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_THREAD_WATCH_SOCKET_FAIL)
+                .arg(ex.what());
+        }
+
+        Mutex::Locker lock(mutex_);
+        busy_ = false;
+        if (jobs_.empty()) {
+            idle_cond_var_.signal();
+        }
+    }
+}
+
 void
 Connection::terminate() {
     try {
@@ -278,6 +641,7 @@ Connection::receiveHandler(const boost::system::error_code& ec,
     LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_READ)
         .arg(bytes_transferred).arg(socket_->getNative());
 
+    ConstElementPtr cmd;
     ConstElementPtr rsp;
 
     try {
@@ -293,13 +657,7 @@ Connection::receiveHandler(const boost::system::error_code& ec,
 
         // Received entire command. Parse the command into JSON.
         if (feed_.feedOk()) {
-            ConstElementPtr cmd = feed_.toElement();
-            response_in_progress_ = true;
-
-            // If successful, then process it as a command.
-            rsp = CommandMgr::instance().processCommand(cmd);
-
-            response_in_progress_ = false;
+            cmd = feed_.toElement();
 
         } else {
             // Failed to parse command as JSON or process the received command.
@@ -313,24 +671,33 @@ Connection::receiveHandler(const boost::system::error_code& ec,
         rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
     }
 
-    // No response generated. Connection will be closed.
-    if (!rsp) {
-        LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
-        rsp = createAnswer(CONTROL_RESULT_ERROR,
-                           "internal server error: no response generated");
+    if (rsp) {
+        sendResponse(rsp);
+        return;
+    }
 
-    } else {
+    // If successful, then process it as a command. The response is sent
+    // when the command has been processed.
+    response_in_progress_ = true;
+    executor_.execute(shared_from_this(), cmd);
+}
 
-        // Let's convert JSON response to text. Note that at this stage
-        // the rsp pointer is always set.
-        response_ = rsp->str();
+void
+Connection::sendResponse(const ConstElementPtr& rsp) {
+    response_in_progress_ = false;
 
-        doSend();
+    // No response generated. Connection will be closed.
+    if (!rsp) {
+        LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
+        connection_pool_.stop(shared_from_this());
         return;
     }
 
-    // Close the connection if we have sent the entire response.
-    connection_pool_.stop(shared_from_this());
+    // Let's convert JSON response to text. Note that at this stage
+    // the rsp pointer is always set.
+    response_ = rsp->str();
+
+    doSend();
 }
 
 void
@@ -370,6 +737,12 @@ Connection::sendHandler(const boost::system::error_code& ec,
 
 void
 Connection::timeoutHandler() {
+    // The command has been received and the response will be sent when
+    // it is processed.
+    if (response_in_progress_) {
+        return;
+    }
+
     LOG_INFO(command_logger, COMMAND_SOCKET_CONNECTION_TIMEOUT)
         .arg(socket_->getNative());
 
@@ -401,7 +774,7 @@ public:
     /// @brief Constructor.
     CommandMgrImpl()
         : io_service_(), acceptor_(), socket_(), socket_name_(),
-          connection_pool_(), timeout_(DEFAULT_CONNECTION_TIMEOUT) {
+          connection_pool_(), executor_(), timeout_(DEFAULT_CONNECTION_TIMEOUT) {
     }
 
     /// @brief Opens acceptor service allowing the control clients to connect.
@@ -432,6 +805,9 @@ public:
     /// @brief Pool of connections.
     ConnectionPool connection_pool_;
 
+    /// @brief Object executing the received commands.
+    CommandExecutor executor_;
+
     /// @brief Connection timeout
     unsigned short timeout_;
 };
@@ -495,6 +871,7 @@ CommandMgrImpl::doAccept() {
             // New connection is arriving. Start asynchronous transmission.
             ConnectionPtr connection(new Connection(io_service_, socket_,
                                                     connection_pool_,
+                                                    executor_,
                                                     timeout_));
             connection_pool_.start(connection);
 
@@ -549,6 +926,31 @@ CommandMgr::instance() {
 void
 CommandMgr::setIOService(const IOServicePtr& io_service) {
     impl_->io_service_ = io_service;
+    impl_->executor_.setIOService(io_service);
+}
+
+void
+CommandMgr::setCommandThread(const bool enabled) {
+    if (enabled) {
+        if (!impl_->io_service_) {
+            isc_throw(InvalidOperation, "IO service must be set before the"
+                      " command thread is started");
+        }
+        impl_->executor_.start();
+
+    } else {
+        impl_->executor_.stop();
+    }
+}
+
+bool
+CommandMgr::hasCommandThread() const {
+    return (impl_->executor_.isRunning());
+}
+
+void
+CommandMgr::waitForCommandThread() {
+    impl_->executor_.wait();
 }
 
 void
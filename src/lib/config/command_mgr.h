@@ -38,6 +38,20 @@ class CommandMgrImpl;
 ///
 /// This class extends @ref BaseCommandMgr with the ability to receive and
 /// respond to commands over unix domain sockets.
+///
+/// The commands received over the control sockets are executed in the
+/// order in which they are received, by default in the thread running the
+/// IO service, i.e. the thread processing packets. A long running command,
+/// e.g. "statistic-get-all" on a server with many subnets, delays the
+/// packet processing until it completes. When the command thread is
+/// enabled with @ref setCommandThread, the commands marked as thread safe
+/// with @ref BaseCommandMgr::setCommandThreadSafe are executed in a
+/// separate thread and their responses are sent from the IO service
+/// thread once ready. The other commands, and the thread safe commands
+/// which are handled by hook libraries, are still executed in the IO
+/// service thread, after the commands in progress in the command thread
+/// have completed. Hence a command modifying the server state is never
+/// executed concurrently with another command.
 class CommandMgr : public HookedCommandMgr, public boost::noncopyable {
 public:
 
@@ -59,6 +73,27 @@ public:
     /// @param timeout New connection timeout in seconds.
     void setConnectionTimeout(const unsigned short timeout);
 
+    /// @brief Enables or disables the command thread.
+    ///
+    /// The command thread signals the completion of the commands through
+    /// the external socket registered in the @c IfaceMgr, so the server's
+    /// IO service is polled as soon as the response is ready. Disabling
+    /// the thread waits for the commands in progress to complete.
+    ///
+    /// @param enabled true to enable the command thread, false to disable it.
+    void setCommandThread(const bool enabled);
+
+    /// @brief Checks if the command thread is enabled.
+    bool hasCommandThread() const;
+
+    /// @brief Waits for the commands executed in the command thread.
+    ///
+    /// The server should call this method before it modifies its state
+    /// outside of a command, e.g. when it is reconfigured upon a signal.
+    /// The responses to these commands are sent when the IO service is
+    /// next polled.
+    void waitForCommandThread();
+
     /// @brief Opens control socket with parameters specified in socket_info
     ///
     /// Currently supported types are:
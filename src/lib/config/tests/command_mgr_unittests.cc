@@ -14,8 +14,14 @@
 #include <hooks/hooks_manager.h>
 #include <hooks/callout_handle.h>
 #include <hooks/library_handle.h>
+#include <util/threads/thread.h>
+#include <cstring>
 #include <string>
 #include <vector>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 using namespace isc::asiolink;
 using namespace isc::config;
@@ -45,6 +51,7 @@ public:
 
     /// Default destructor
     virtual ~CommandMgrTest() {
+        CommandMgr::instance().setCommandThread(false);
         CommandMgr::instance().deregisterAll();
         CommandMgr::instance().closeCommandSocket();
         resetCalloutIndicators();
@@ -90,6 +97,55 @@ public:
         return (createAnswer(123, "test error message"));
     }
 
+    /// @brief A command handler which records the thread it runs in.
+    static ConstElementPtr thread_handler(const std::string& /*name*/,
+                                          const ConstElementPtr& /*params*/) {
+        handler_thread_ = pthread_self();
+        handler_called_ = true;
+        return (createAnswer(0, "thread handler"));
+    }
+
+    /// @brief Sends a command over the control socket and returns the
+    /// response.
+    ///
+    /// The IO service is polled until the response is received, so the
+    /// responses sent from the command thread are delivered.
+    ///
+    /// @param command Command to be sent.
+    /// @return Response, or an empty string if none was received.
+    std::string sendCommand(const std::string& command) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            return ("");
+        }
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, getSocketPath().c_str(),
+                sizeof(addr.sun_path) - 1);
+        if ((connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                     sizeof(addr)) < 0) ||
+            (send(fd, command.c_str(), command.size(), 0) < 0)) {
+            close(fd);
+            return ("");
+        }
+
+        // Wait up to 5 seconds for the response.
+        std::string response;
+        char buf[1024];
+        for (int i = 0; (i < 5000) && response.empty(); ++i) {
+            io_service_->poll();
+            ssize_t len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT);
+            if (len > 0) {
+                response.assign(buf, len);
+            } else {
+                usleep(1000);
+            }
+        }
+        close(fd);
+        return (response);
+    }
+
     /// @brief A simple command handler used from within hook library.
     ///
     /// @param name Command name.
@@ -136,6 +192,9 @@ public:
     /// @brief Indicates whether my_handler was called
     static bool handler_called_;
 
+    /// @brief Thread in which thread_handler was called.
+    static pthread_t handler_thread_;
+
     /// @brief Holds invoked callout name.
     static std::string callout_name_;
 
@@ -152,6 +211,9 @@ ConstElementPtr CommandMgrTest::handler_params_;
 /// Indicates whether my_handler was called
 bool CommandMgrTest::handler_called_(false);
 
+/// Thread in which thread_handler was called.
+pthread_t CommandMgrTest::handler_thread_;
+
 /// Holds invoked callout name.
 std::string CommandMgrTest::callout_name_("");
 
@@ -435,3 +497,55 @@ TEST_F(CommandMgrTest, unixCreateTooLong) {
     EXPECT_THROW(CommandMgr::instance().openCommandSocket(socket_info),
                  SocketError);
 }
+
+// This test verifies that the commands can be marked as thread safe.
+TEST_F(CommandMgrTest, setCommandThreadSafe) {
+    EXPECT_THROW(CommandMgr::instance().setCommandThreadSafe("my-command"),
+                 InvalidCommandName);
+
+    EXPECT_NO_THROW(CommandMgr::instance().registerCommand("my-command",
+                                                           my_handler));
+    EXPECT_FALSE(CommandMgr::instance().isCommandThreadSafe("my-command"));
+    EXPECT_NO_THROW(CommandMgr::instance().setCommandThreadSafe("my-command"));
+    EXPECT_TRUE(CommandMgr::instance().isCommandThreadSafe("my-command"));
+    EXPECT_FALSE(CommandMgr::instance().isCommandThreadSafe("list-commands"));
+
+    // Registering the command again clears the flag.
+    CommandMgr::instance().deregisterCommand("my-command");
+    EXPECT_FALSE(CommandMgr::instance().isCommandThreadSafe("my-command"));
+    CommandMgr::instance().registerCommand("my-command", my_handler);
+    EXPECT_FALSE(CommandMgr::instance().isCommandThreadSafe("my-command"));
+}
+
+// This test verifies that the thread safe commands are executed in the
+// command thread and the other commands in the IO service thread.
+TEST_F(CommandMgrTest, commandThread) {
+    ElementPtr socket_info = Element::fromJSON("{ \"socket-type\": \"unix\" }");
+    socket_info->set("socket-name", Element::create(getSocketPath()));
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+
+    EXPECT_FALSE(CommandMgr::instance().hasCommandThread());
+    ASSERT_NO_THROW(CommandMgr::instance().setCommandThread(true));
+    EXPECT_TRUE(CommandMgr::instance().hasCommandThread());
+
+    CommandMgr::instance().registerCommand("thread-command", thread_handler);
+    CommandMgr::instance().registerCommand("main-command", thread_handler);
+    CommandMgr::instance().setCommandThreadSafe("thread-command");
+
+    // The thread safe command is executed in another thread.
+    handler_thread_ = pthread_self();
+    std::string response = sendCommand("{ \"command\": \"thread-command\" }");
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"thread handler\" }", response);
+    EXPECT_TRUE(handler_called_);
+    EXPECT_FALSE(pthread_equal(handler_thread_, pthread_self()));
+
+    // The other command is executed in this thread.
+    handler_called_ = false;
+    response = sendCommand("{ \"command\": \"main-command\" }");
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"thread handler\" }", response);
+    EXPECT_TRUE(handler_called_);
+    EXPECT_TRUE(pthread_equal(handler_thread_, pthread_self()));
+
+    EXPECT_NO_THROW(CommandMgr::instance().setCommandThread(false));
+    EXPECT_FALSE(CommandMgr::instance().hasCommandThread());
+}
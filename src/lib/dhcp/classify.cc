@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,18 +6,61 @@
 
 #include <config.h>
 #include <dhcp/classify.h>
+#include <exceptions/exceptions.h>
 #include <util/strutil.h>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/constants.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
 namespace isc {
 namespace dhcp {
 
+ClientClassRegistry&
+ClientClassRegistry::instance() {
+    static ClientClassRegistry registry;
+    return (registry);
+}
+
+ClientClassId
+ClientClassRegistry::intern(const ClientClass& name) {
+    ClientClassId id = 0;
+    if (lookup(name, id)) {
+        return (id);
+    }
+    id = static_cast<ClientClassId>(names_.size());
+    names_.push_back(name);
+    ids_[name] = id;
+    return (id);
+}
+
+bool
+ClientClassRegistry::lookup(const ClientClass& name, ClientClassId& id) const {
+    boost::unordered_map<ClientClass, ClientClassId>::const_iterator it =
+        ids_.find(name);
+    if (it == ids_.end()) {
+        return (false);
+    }
+    id = it->second;
+    return (true);
+}
+
+const ClientClass&
+ClientClassRegistry::getName(const ClientClassId id) const {
+    if (id >= names_.size()) {
+        isc_throw(isc::OutOfRange, "client class identifier " << id
+                  << " is not assigned");
+    }
+    return (names_[id]);
+}
+
+const size_t ClientClasses::BITS_PER_WORD;
+
 ClientClasses::ClientClasses(const std::string& class_names)
-    : std::set<ClientClass>() {
+    : std::set<ClientClass>(),
+      synced_(ClientClassRegistry::instance().size()) {
     std::vector<std::string> split_text;
     boost::split(split_text, class_names, boost::is_any_of(","),
                  boost::algorithm::token_compress_off);
@@ -30,6 +73,82 @@ ClientClasses::ClientClasses(const std::string& class_names)
     }
 }
 
+void
+ClientClasses::insert(const ClientClass& x) {
+    std::set<ClientClass>::insert(x);
+    // A stale bitset is recomputed by the next query.
+    if (synced_ == ClientClassRegistry::instance().size()) {
+        setBit(x);
+    }
+}
+
+size_t
+ClientClasses::erase(const ClientClass& x) {
+    const size_t erased = std::set<ClientClass>::erase(x);
+    ClientClassId id = 0;
+    if ((erased > 0) && ClientClassRegistry::instance().lookup(x, id) &&
+        (id / BITS_PER_WORD < bits_.size())) {
+        bits_[id / BITS_PER_WORD] &= ~(static_cast<uint64_t>(1) <<
+                                       (id % BITS_PER_WORD));
+    }
+    return (erased);
+}
+
+void
+ClientClasses::clear() {
+    std::set<ClientClass>::clear();
+    bits_.clear();
+    synced_ = ClientClassRegistry::instance().size();
+}
+
+bool
+ClientClasses::contains(const ClientClass& x) const {
+    ClientClassId id = 0;
+    if (ClientClassRegistry::instance().lookup(x, id)) {
+        return (contains(id));
+    }
+    return (find(x) != end());
+}
+
+bool
+ClientClasses::intersects(const ClientClasses& other) const {
+    sync();
+    other.sync();
+    const size_t words = std::min(bits_.size(), other.bits_.size());
+    for (size_t i = 0; i < words; ++i) {
+        if (bits_[i] & other.bits_[i]) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void
+ClientClasses::sync() const {
+    const size_t registered = ClientClassRegistry::instance().size();
+    if (synced_ == registered) {
+        return;
+    }
+    bits_.clear();
+    synced_ = registered;
+    for (const_iterator it = begin(); it != end(); ++it) {
+        setBit(*it);
+    }
+}
+
+void
+ClientClasses::setBit(const ClientClass& x) const {
+    ClientClassId id = 0;
+    if (!ClientClassRegistry::instance().lookup(x, id)) {
+        return;
+    }
+    const size_t word = id / BITS_PER_WORD;
+    if (word >= bits_.size()) {
+        bits_.resize(word + 1, 0);
+    }
+    bits_[word] |= (static_cast<uint64_t>(1) << (id % BITS_PER_WORD));
+}
+
 std::string
 ClientClasses::toText(const std::string& separator) const {
     std::stringstream s;
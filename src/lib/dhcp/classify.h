@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,8 +7,12 @@
 #ifndef CLASSIFY_H
 #define CLASSIFY_H
 
+#include <boost/noncopyable.hpp>
+#include <boost/unordered_map.hpp>
 #include <set>
 #include <string>
+#include <vector>
+#include <stdint.h>
 
 /// @file   classify.h
 ///
@@ -34,6 +38,70 @@ namespace dhcp {
     /// @brief Defines a single class name.
     typedef std::string ClientClass;
 
+    /// @brief Defines the identifier of a registered class name.
+    typedef uint32_t ClientClassId;
+
+    /// @brief Registry of the client class names used by the configuration.
+    ///
+    /// The registry assigns a small integer identifier to each class name
+    /// defined or referenced by the server configuration, so the classes of
+    /// a packet can be held in a bitset and the client class checks, done
+    /// for each subnet considered during the subnet selection, are bit tests
+    /// rather than string comparisons.
+    ///
+    /// The names are registered when the configuration is parsed. Identifiers
+    /// are never released, so they remain valid for the lifetime of the
+    /// process and the registry only grows with the distinct names used by
+    /// the successive configurations. The names a packet is classified into
+    /// by the server or the hooks are not registered: a name which is not
+    /// referenced by the configuration can't be matched by it anyway, and
+    /// some of these names are built from values sent by the clients.
+    class ClientClassRegistry : public boost::noncopyable {
+    public:
+
+        /// @brief Returns the sole instance of the registry.
+        static ClientClassRegistry& instance();
+
+        /// @brief Registers a class name.
+        ///
+        /// @param name Class name.
+        /// @return Identifier of the name, the existing one if the name
+        /// is already registered.
+        ClientClassId intern(const ClientClass& name);
+
+        /// @brief Looks up the identifier of a class name.
+        ///
+        /// @param name Class name.
+        /// @param [out] id Identifier of the name if it is registered.
+        /// @return true if the name is registered, false otherwise.
+        bool lookup(const ClientClass& name, ClientClassId& id) const;
+
+        /// @brief Returns the name of a registered class.
+        ///
+        /// @param id Identifier of the name.
+        /// @throw isc::OutOfRange if the identifier is not assigned.
+        const ClientClass& getName(const ClientClassId id) const;
+
+        /// @brief Returns the number of registered names.
+        ///
+        /// As the names are never removed, this is also the identifier
+        /// the next registered name will get.
+        size_t size() const {
+            return (names_.size());
+        }
+
+    private:
+
+        /// @brief Private constructor: use @ref instance.
+        ClientClassRegistry() { }
+
+        /// @brief Identifiers of the registered names.
+        boost::unordered_map<ClientClass, ClientClassId> ids_;
+
+        /// @brief Registered names indexed by their identifiers.
+        std::vector<ClientClass> names_;
+    };
+
     /// @brief Container for storing client class names
     ///
     /// Depending on how you look at it, this is either a little more than just
@@ -42,13 +110,23 @@ namespace dhcp {
     /// class names. It is expected to grow in complexity once support for
     /// client classes becomes more feature rich.
     ///
+    /// Besides the names, the container holds the bitset of the identifiers
+    /// of the names registered in the @ref ClientClassRegistry. The bitset
+    /// is refreshed when names have been registered since it was computed,
+    /// so it is consistent with the names whatever the order of the
+    /// registrations and the insertions.
+    ///
     /// Note: This class is derived from std::set which may not have Doxygen
     /// documentation. See  http://www.cplusplus.com/reference/set/set/.
+    /// The names must be added and removed with the @c insert, @c erase and
+    /// @c clear methods of this class, which maintain the bitset.
     class ClientClasses : public std::set<ClientClass> {
     public:
 
         /// @brief Default constructor.
-        ClientClasses() : std::set<ClientClass>() {
+        ClientClasses()
+            : std::set<ClientClass>(),
+              synced_(ClientClassRegistry::instance().size()) {
         }
 
         /// @brief Constructor from comma separated values.
@@ -57,21 +135,75 @@ namespace dhcp {
         /// with commas. The class names are trimmed before insertion to the set.
         ClientClasses(const std::string& class_names);
 
+        /// @brief Adds a class name.
+        ///
+        /// @param x client class to be added
+        void insert(const ClientClass& x);
+
+        /// @brief Removes a class name.
+        ///
+        /// @param x client class to be removed
+        /// @return number of removed names (0 or 1)
+        size_t erase(const ClientClass& x);
+
+        /// @brief Removes all class names.
+        void clear();
+
         /// @brief returns if class x belongs to the defined classes
         ///
+        /// The membership of a registered name is a bit test.
+        ///
         /// @param x client class to be checked
         /// @return true if x belongs to the classes
-        bool
-        contains(const ClientClass& x) const {
-            return (find(x) != end());
+        bool contains(const ClientClass& x) const;
+
+        /// @brief returns if the registered class belongs to the defined
+        /// classes
+        ///
+        /// @param id identifier of the client class to be checked
+        /// @return true if the class belongs to the classes
+        bool contains(const ClientClassId id) const {
+            sync();
+            const size_t word = id / BITS_PER_WORD;
+            return ((word < bits_.size()) &&
+                    (((bits_[word] >> (id % BITS_PER_WORD)) & 1) != 0));
         }
 
+        /// @brief returns if any of the registered classes of another
+        /// container belongs to the defined classes
+        ///
+        /// Names which are not registered are ignored.
+        ///
+        /// @param other classes to be checked
+        /// @return true if the containers share a registered class
+        bool intersects(const ClientClasses& other) const;
+
         /// @brief Returns all class names as text
         ///
         /// @param separator Separator to be used between class names. The
         /// default separator comprises comma sign followed by space
         /// character.
         std::string toText(const std::string& separator = ", ") const;
+
+    private:
+
+        /// @brief Recomputes the bitset if names have been registered
+        /// since it was computed.
+        void sync() const;
+
+        /// @brief Sets the bit of a name if it is registered.
+        ///
+        /// @param x client class
+        void setBit(const ClientClass& x) const;
+
+        /// @brief Number of bits in a word of the bitset.
+        static const size_t BITS_PER_WORD = 64;
+
+        /// @brief Bitset of the identifiers of the registered names.
+        mutable std::vector<uint64_t> bits_;
+
+        /// @brief Size of the registry when the bitset was computed.
+        mutable size_t synced_;
     };
 
 };
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,7 +6,9 @@
 
 #include <config.h>
 #include <dhcp/classify.h>
+#include <exceptions/exceptions.h>
 #include <gtest/gtest.h>
+#include <sstream>
 
 using namespace isc::dhcp;
 
@@ -131,3 +133,68 @@ TEST(ClassifyTest, ClientClassesToText) {
     // Check non-standard separator.
     EXPECT_EQ("alpha.beta.gamma", classes.toText("."));
 }
+
+// Check that the class names are registered with stable identifiers.
+TEST(ClassifyTest, ClientClassRegistry) {
+    ClientClassRegistry& registry = ClientClassRegistry::instance();
+    const size_t size = registry.size();
+    ClientClassId id = registry.intern("registry-alpha");
+    EXPECT_EQ(size, id);
+    EXPECT_EQ(id, registry.intern("registry-alpha"));
+    EXPECT_EQ(size + 1, registry.size());
+    EXPECT_EQ("registry-alpha", registry.getName(id));
+    EXPECT_THROW(registry.getName(registry.size()), isc::OutOfRange);
+
+    ClientClassId found = 0;
+    EXPECT_TRUE(registry.lookup("registry-alpha", found));
+    EXPECT_EQ(id, found);
+    EXPECT_FALSE(registry.lookup("registry-beta", found));
+}
+
+// Check that the bits of the registered classes are maintained whatever
+// the order of the registrations and the insertions.
+TEST(ClassifyTest, ClientClassesBits) {
+    ClientClassRegistry& registry = ClientClassRegistry::instance();
+    ClientClassId alpha = registry.intern("bits-alpha");
+
+    ClientClasses classes;
+    classes.insert("bits-alpha");
+    classes.insert("bits-beta");
+    EXPECT_TRUE(classes.contains(alpha));
+    EXPECT_TRUE(classes.contains("bits-beta"));
+
+    // Register a name after it was inserted.
+    ClientClassId beta = registry.intern("bits-beta");
+    EXPECT_TRUE(classes.contains(beta));
+    EXPECT_TRUE(classes.contains("bits-beta"));
+
+    ClientClasses white_list;
+    white_list.insert("bits-beta");
+    EXPECT_TRUE(classes.intersects(white_list));
+    EXPECT_TRUE(white_list.intersects(classes));
+
+    // Unregistered names don't intersect.
+    ClientClasses unregistered("bits-gamma");
+    ClientClasses other("bits-gamma");
+    EXPECT_FALSE(unregistered.intersects(other));
+
+    // Names past the first word of the bitset.
+    ClientClassId last = 0;
+    for (unsigned i = 0; i < 100; ++i) {
+        std::ostringstream name;
+        name << "bits-" << i;
+        last = registry.intern(name.str());
+    }
+    classes.insert("bits-99");
+    EXPECT_TRUE(classes.contains(last));
+    white_list.clear();
+    white_list.insert("bits-99");
+    EXPECT_TRUE(classes.intersects(white_list));
+
+    EXPECT_EQ(1, classes.erase("bits-beta"));
+    EXPECT_FALSE(classes.contains(beta));
+    EXPECT_FALSE(classes.contains("bits-beta"));
+    classes.clear();
+    EXPECT_FALSE(classes.contains(alpha));
+    EXPECT_FALSE(classes.intersects(white_list));
+}
@@ -11,6 +11,8 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
+
 namespace isc {
 namespace dhcp_ddns {
 
@@ -154,7 +156,7 @@ NameChangeListener::invokeRecvHandler(const Result result,
 NameChangeSender::NameChangeSender(RequestSendHandler& send_handler,
                                    size_t send_queue_max)
     : sending_(false), send_handler_(send_handler),
-      send_queue_max_(send_queue_max), io_service_(NULL) {
+      send_queue_max_(send_queue_max), batch_size_(0), io_service_(NULL) {
 
     // Queue size must be big enough to hold at least 1 entry.
     setQueueMaxSize(send_queue_max);
@@ -169,6 +171,7 @@ NameChangeSender::startSending(isc::asiolink::IOService& io_service) {
 
     // Clear send marker.
     ncr_to_send_.reset();
+    batch_size_ = 0;
 
     // Call implementation dependent open.
     try {
@@ -253,40 +256,100 @@ NameChangeSender::sendNext() {
 
     // If queue isn't empty, then get one from the front. Note we leave
     // it on the front of the queue until we successfully send it.
-    if (!send_queue_.empty()) {
+    while (!send_queue_.empty()) {
         ncr_to_send_ = send_queue_.front();
 
        // @todo start defense timer
        // If a send were to hang and we timed it out, then timeout
        // handler need to cycle thru open/close ?
 
-       // Call implementation dependent send.
-       doSend(ncr_to_send_);
+       // Call implementation dependent send. Derivations which support
+       // it get as many requests as they accept at once.
+       const size_t max_batch = getMaxBatchSize();
+       const size_t batch_size = std::min(max_batch, send_queue_.size());
+       try {
+           if (batch_size <= 1) {
+               batch_size_ = 1;
+               doSend(ncr_to_send_);
+           } else {
+               batch_size_ = batch_size;
+               std::vector<NameChangeRequestPtr>
+                   batch(send_queue_.begin(),
+                         send_queue_.begin() + batch_size_);
+               doSendBatch(batch);
+           }
+           return;
+
+       } catch (const NcrMessageError& ex) {
+           if (batch_size > 1) {
+               // One of the requests in the batch can't be rendered. Send
+               // the front request alone, so the bad one is eventually
+               // dropped without losing the others.
+               try {
+                   batch_size_ = 1;
+                   doSend(ncr_to_send_);
+                   return;
+               } catch (const NcrMessageError&) {
+               }
+           }
+
+           // The front request can't be rendered, so it would block the
+           // queue forever. Drop it and move on to the next one.
+           LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_SEND_RENDER_ERROR)
+                     .arg(ncr_to_send_->toText()).arg(ex.what());
+           send_queue_.pop_front();
+           ncr_to_send_.reset();
+           batch_size_ = 0;
+       }
     }
 }
 
+void
+NameChangeSender::doSendBatch(const std::vector<NameChangeRequestPtr>&) {
+    isc_throw(NotImplemented,
+              "NameChangeSender::doSendBatch is not supported");
+}
+
 void
 NameChangeSender::invokeSendHandler(const NameChangeSender::Result result) {
     // @todo reset defense timer
-    if (result == SUCCESS) {
-        // It shipped so pull it off the queue.
-        send_queue_.pop_front();
-    }
+    if ((result == SUCCESS) && (batch_size_ > 1)) {
+        // The whole batch shipped, so pull it off the queue and report
+        // each of the requests.
+        for (size_t i = 0; (i < batch_size_) && !send_queue_.empty(); ++i) {
+            NameChangeRequestPtr ncr = send_queue_.front();
+            send_queue_.pop_front();
+            try {
+                send_handler_(result, ncr);
+            } catch (const std::exception& ex) {
+                LOG_ERROR(dhcp_ddns_logger,
+                          DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
+                          .arg(ex.what());
+            }
+        }
+    } else {
+        if (result == SUCCESS) {
+            // It shipped so pull it off the queue.
+            send_queue_.pop_front();
+        }
 
-    // Invoke the completion handler passing in the result and a pointer
-    // the request involved.
-    // Surround the invocation with a try-catch. The invoked handler is
-    // not supposed to throw, but in the event it does we will at least
-    // report it.
-    try {
-        send_handler_(result, ncr_to_send_);
-    } catch (const std::exception& ex) {
-        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
-                  .arg(ex.what());
+        // Invoke the completion handler passing in the result and a pointer
+        // the request involved.
+        // Surround the invocation with a try-catch. The invoked handler is
+        // not supposed to throw, but in the event it does we will at least
+        // report it.
+        try {
+            send_handler_(result, ncr_to_send_);
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_ddns_logger,
+                      DHCP_DDNS_UNCAUGHT_NCR_SEND_HANDLER_ERROR)
+                      .arg(ex.what());
+        }
     }
 
     // Clear the pending ncr pointer.
     ncr_to_send_.reset();
+    batch_size_ = 0;
 
     // Set up the next send
     try {
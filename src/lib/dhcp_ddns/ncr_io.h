@@ -54,13 +54,12 @@
 #include <exceptions/exceptions.h>
 
 #include <deque>
+#include <vector>
 
 namespace isc {
 namespace dhcp_ddns {
 
 /// @brief Defines the list of socket protocols supported.
-/// Currently only UDP is implemented.
-/// @todo TCP is intended to be implemented prior 1.0 release.
 /// @todo Give some thought to an ANY protocol which might try
 /// first as UDP then as TCP, etc.
 enum NameChangeProtocol {
@@ -580,6 +579,10 @@ protected:
     /// a send in progress and the send queue is not empty the grab the next
     /// message on the front of the queue and call doSend().
     ///
+    /// A request which can't be rendered for sending (doSend() or
+    /// doSendBatch() throws NcrMessageError) is logged and dropped, so it
+    /// doesn't block the requests queued behind it.
+    ///
     void sendNext();
 
     /// @brief Calls the NCR send completion handler registered with the
@@ -591,6 +594,8 @@ protected:
     /// the entry at the front of the queue is removed from the queue.
     /// If not we leave it there so we can retry it.  After we invoke the
     /// handler we clear the pending ncr value and queue up the next send.
+    /// When a batch was sent with doSendBatch(), the outcome applies to
+    /// all of the requests in the batch.
     ///
     /// NOTE:
     /// The handler invoked by this method MUST NOT THROW. The handler is
@@ -642,6 +647,30 @@ protected:
     /// throw it as an isc::Exception or derivative.
     virtual void doSend(NameChangeRequestPtr& ncr) = 0;
 
+    /// @brief Returns the maximum number of requests sent at once.
+    ///
+    /// When the derivation returns a value greater than one, sendNext()
+    /// hands up to that many requests from the front of the queue to
+    /// doSendBatch() instead of sending them one at a time with doSend().
+    /// The default implementation returns one.
+    virtual size_t getMaxBatchSize() const {
+        return (1);
+    }
+
+    /// @brief Initiates an IO layer asynchronous send of several requests.
+    ///
+    /// The derivation must invoke invokeSendHandler() once, when the
+    /// whole batch is delivered or when delivering it failed. On success
+    /// all of the requests are removed from the queue and the completion
+    /// handler is invoked for each of them. On failure they all remain
+    /// queued and the handler is invoked for the first one only.
+    ///
+    /// @param ncrs requests to send, in the queue order.
+    ///
+    /// @throw NotImplemented unless overridden by a derivation which
+    /// returns a batch size greater than one.
+    virtual void doSendBatch(const std::vector<NameChangeRequestPtr>& ncrs);
+
 public:
     /// @brief Removes the request at the front of the send queue
     ///
@@ -766,6 +795,10 @@ private:
     /// @brief Pointer to the request which is in the process of being sent.
     NameChangeRequestPtr ncr_to_send_;
 
+    /// @brief Number of requests from the front of the queue which are in
+    /// the process of being sent.
+    size_t batch_size_;
+
     /// @brief Pointer to the IOService currently being used by the sender.
     /// @note We need to remember the io_service but we receive it by
     /// reference.  Use a raw pointer to store it.  This value should never be
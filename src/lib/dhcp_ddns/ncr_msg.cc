@@ -27,6 +27,10 @@ NameChangeFormat stringToNcrFormat(const std::string& fmt_str) {
         return FMT_JSON;
     }
 
+    if (boost::iequals(fmt_str, "BINARY")) {
+        return FMT_BINARY;
+    }
+
     isc_throw(BadValue, "Invalid NameChangeRequest format: " << fmt_str);
 }
 
@@ -34,6 +38,8 @@ NameChangeFormat stringToNcrFormat(const std::string& fmt_str) {
 std::string ncrFormatToString(NameChangeFormat format) {
     if (format == FMT_JSON) {
         return ("JSON");
+    } else if (format == FMT_BINARY) {
+        return ("BINARY");
     }
 
     std::ostringstream stream;
@@ -196,6 +202,18 @@ operator<<(std::ostream& os, const D2Dhcid& dhcid) {
 
 /**************************** NameChangeRequest ******************************/
 
+namespace {
+
+/// @name Flags of the binary rendition of the request.
+//@{
+/// The forward change is requested.
+const uint8_t BINARY_FORWARD_CHANGE = 0x01;
+/// The reverse change is requested.
+const uint8_t BINARY_REVERSE_CHANGE = 0x02;
+//@}
+
+}
+
 NameChangeRequest::NameChangeRequest()
     : change_type_(CHG_ADD), forward_change_(false),
     reverse_change_(false), fqdn_(""), ip_io_address_("0.0.0.0"),
@@ -253,6 +271,18 @@ NameChangeRequest::fromFormat(const NameChangeFormat format,
                       << ex.what());
         }
 
+        break;
+        }
+    case FMT_BINARY: {
+        size_t len = 0;
+        try {
+            len = buffer.readUint16();
+        } catch (isc::util::InvalidBufferPosition& ex) {
+            isc_throw(NcrMessageError, "fromFormat: buffer read error: "
+                      << ex.what());
+        }
+
+        ncr = NameChangeRequest::fromBinary(buffer, len);
         break;
         }
     default:
@@ -281,6 +311,27 @@ NameChangeRequest::toFormat(const NameChangeFormat format,
         buffer.writeData(json.c_str(), length);
         break;
         }
+    case FMT_BINARY: {
+        // Reserve the length, render the request and fill it in. On error
+        // the buffer is restored, so nothing of this request is left in it.
+        size_t start = buffer.getLength();
+        buffer.writeUint16(0);
+        try {
+            toBinary(buffer);
+        } catch (...) {
+            buffer.trim(buffer.getLength() - start);
+            throw;
+        }
+        const size_t length = buffer.getLength() - start - sizeof(uint16_t);
+        if (length > std::numeric_limits<uint16_t>::max()) {
+            buffer.trim(buffer.getLength() - start);
+            isc_throw(NcrMessageError, "toFormat: binary rendition of "
+                      << length << " bytes exceeds the maximum of "
+                      << std::numeric_limits<uint16_t>::max());
+        }
+        buffer.writeUint16At(length, start);
+        break;
+        }
     default:
         // Programmatic error, shouldn't happen.
         isc_throw(NcrMessageError, "toFormat - invalid format");
@@ -370,6 +421,105 @@ NameChangeRequest::toJSON() const  {
     return (stream.str());
 }
 
+NameChangeRequestPtr
+NameChangeRequest::fromBinary(isc::util::InputBuffer& buffer,
+                              const size_t length) {
+    NameChangeRequestPtr ncr(new NameChangeRequest());
+    try {
+        const size_t end = buffer.getPosition() + length;
+        if (end > buffer.getLength()) {
+            isc_throw(NcrMessageError, "binary NameChangeRequest of "
+                      << length << " bytes is truncated");
+        }
+
+        uint8_t change_type = buffer.readUint8();
+        if ((change_type != CHG_ADD) && (change_type != CHG_REMOVE)) {
+            isc_throw(NcrMessageError,
+                      "Invalid data value for change_type: "
+                      << static_cast<int>(change_type));
+        }
+        ncr->setChangeType(static_cast<NameChangeType>(change_type));
+
+        uint8_t flags = buffer.readUint8();
+        ncr->setForwardChange(flags & BINARY_FORWARD_CHANGE);
+        ncr->setReverseChange(flags & BINARY_REVERSE_CHANGE);
+
+        uint8_t addr_len = buffer.readUint8();
+        uint8_t addr[asiolink::V6ADDRESS_LEN];
+        if (addr_len == asiolink::V4ADDRESS_LEN) {
+            buffer.readData(addr, addr_len);
+            ncr->ip_io_address_ = asiolink::IOAddress::fromBytes(AF_INET,
+                                                                 addr);
+        } else if (addr_len == asiolink::V6ADDRESS_LEN) {
+            buffer.readData(addr, addr_len);
+            ncr->ip_io_address_ = asiolink::IOAddress::fromBytes(AF_INET6,
+                                                                 addr);
+        } else {
+            isc_throw(NcrMessageError, "Invalid ip address length: "
+                      << static_cast<int>(addr_len));
+        }
+
+        std::vector<uint8_t> vec;
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->setFqdn(std::string(vec.begin(), vec.end()));
+
+        buffer.readVector(vec, buffer.readUint16());
+        ncr->dhcid_.fromBytes(vec);
+
+        uint64_t expires = static_cast<uint64_t>(buffer.readUint32()) << 32;
+        expires |= buffer.readUint32();
+        ncr->lease_expires_on_ = expires;
+        ncr->setLeaseLength(buffer.readUint32());
+
+        if (buffer.getPosition() != end) {
+            isc_throw(NcrMessageError, "binary NameChangeRequest length "
+                      << length << " does not match its content");
+        }
+    } catch (isc::util::InvalidBufferPosition& ex) {
+        isc_throw(NcrMessageError, "fromBinary: buffer read error: "
+                  << ex.what());
+    }
+
+    ncr->validateContent();
+    return (ncr);
+}
+
+void
+NameChangeRequest::toBinary(isc::util::OutputBuffer& buffer) const {
+    // Check the lengths first, so nothing is written on error.
+    if (fqdn_.size() > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(NcrMessageError, "toBinary: FQDN length " << fqdn_.size()
+                  << " exceeds the maximum of "
+                  << std::numeric_limits<uint16_t>::max());
+    }
+
+    const std::vector<uint8_t>& dhcid = dhcid_.getBytes();
+    if (dhcid.size() > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(NcrMessageError, "toBinary: DHCID length " << dhcid.size()
+                  << " exceeds the maximum of "
+                  << std::numeric_limits<uint16_t>::max());
+    }
+
+    buffer.writeUint8(static_cast<uint8_t>(change_type_));
+    buffer.writeUint8((forward_change_ ? BINARY_FORWARD_CHANGE : 0) |
+                      (reverse_change_ ? BINARY_REVERSE_CHANGE : 0));
+
+    std::vector<uint8_t> addr = ip_io_address_.toBytes();
+    buffer.writeUint8(static_cast<uint8_t>(addr.size()));
+    buffer.writeData(&addr[0], addr.size());
+
+    buffer.writeUint16(static_cast<uint16_t>(fqdn_.size()));
+    buffer.writeData(fqdn_.c_str(), fqdn_.size());
+
+    buffer.writeUint16(static_cast<uint16_t>(dhcid.size()));
+    if (!dhcid.empty()) {
+        buffer.writeData(&dhcid[0], dhcid.size());
+    }
+
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_ >> 32));
+    buffer.writeUint32(static_cast<uint32_t>(lease_expires_on_));
+    buffer.writeUint32(lease_length_);
+}
 
 void
 NameChangeRequest::validateContent() {
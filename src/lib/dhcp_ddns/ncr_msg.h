@@ -58,13 +58,14 @@ enum NameChangeStatus  {
 
 /// @brief Defines the list of data wire formats supported.
 enum NameChangeFormat {
-  FMT_JSON
+  FMT_JSON,
+  FMT_BINARY
 };
 
 /// @brief Function which converts labels to  NameChangeFormat enum values.
 ///
 /// @param fmt_str text to convert to an enum.
-/// Valid string values: "JSON"
+/// Valid string values: "JSON", "BINARY"
 ///
 /// @return NameChangeFormat value which maps to the given string.
 ///
@@ -170,6 +171,13 @@ public:
         return (bytes_);
     }
 
+    /// @brief Sets the DHCID value from the raw bytes.
+    ///
+    /// @param bytes the DHCID in wire format.
+    void fromBytes(const std::vector<uint8_t>& bytes) {
+        bytes_ = bytes;
+    }
+
     /// @brief Compares two D2Dhcids for equality
     bool operator==(const D2Dhcid& other) const {
         return (this->bytes_ == other.bytes_);
@@ -272,7 +280,10 @@ public:
     /// is than treated as JSON which is then parsed into the data needed
     /// to create a request instance.
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: The buffer is expected to contain a two byte unsigned integer
+    /// which specifies the length of the binary rendition followed by the
+    /// rendition itself, as described under
+    /// isc::dhcp_ddns::NameChangeRequest::toFormat.
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the input buffer containing the marshalled request
@@ -297,11 +308,27 @@ public:
     /// is identical that described under
     /// isc::dhcp_ddns::NameChangeRequest::fromJSON
     ///
-    /// (NOTE currently only JSON is supported.)
+    /// BINARY: Upon completion, the buffer will contain a two byte unsigned
+    /// integer which specifies the length of the binary rendition, followed
+    /// by the rendition itself. It is much shorter than the JSON text and
+    /// is decoded without any text parsing except for the FQDN. All
+    /// integers are in network byte order:
+    ///
+    /// - change type (1 byte)
+    /// - flags (1 byte), 0x01 for the forward change, 0x02 for the reverse
+    ///   change
+    /// - address length (1 byte), 4 or 16, followed by the address
+    /// - FQDN length (2 bytes) followed by the FQDN text
+    /// - DHCID length (2 bytes) followed by the DHCID bytes
+    /// - lease expiration time (8 bytes), seconds since the epoch
+    /// - lease length (4 bytes)
     ///
     /// @param format indicates the data format to use
     /// @param buffer is the output buffer to which the request should be
     /// marshalled.
+    ///
+    /// @throw NcrMessageError if the request can't be rendered in the
+    /// BINARY format. Nothing is added to the buffer in this case.
     void toFormat(const NameChangeFormat format,
                   isc::util::OutputBuffer& buffer) const;
 
@@ -403,6 +430,29 @@ public:
     /// @return a string containing the JSON rendition of the request
     std::string toJSON() const;
 
+    /// @brief Static method for creating a NameChangeRequest from its
+    /// binary rendition.
+    ///
+    /// @param buffer is the input buffer positioned at the beginning of
+    /// the rendition (after the length).
+    /// @param length is the length of the rendition.
+    ///
+    /// @return a pointer to the new NameChangeRequest
+    ///
+    /// @throw NcrMessageError if an error occurs creating new request.
+    static NameChangeRequestPtr fromBinary(isc::util::InputBuffer& buffer,
+                                           const size_t length);
+
+    /// @brief Instance method for marshalling the contents of the request
+    /// into its binary rendition, without the leading length.
+    ///
+    /// @param buffer is the output buffer to which the request should be
+    /// marshalled.
+    ///
+    /// @throw NcrMessageError if the FQDN or the DHCID is too long to be
+    /// rendered.
+    void toBinary(isc::util::OutputBuffer& buffer) const;
+
     /// @brief Validates the content of a populated request.  This method is
     /// used by both the full constructor and from-wire marshalling to ensure
     /// that the request is content valid.  Currently it enforces the
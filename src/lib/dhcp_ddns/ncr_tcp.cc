@@ -0,0 +1,655 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp_ddns/dhcp_ddns_log.h>
+#include <dhcp_ddns/ncr_tcp.h>
+
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/bind.hpp>
+#include <limits>
+#include <sstream>
+
+namespace isc {
+namespace dhcp_ddns {
+
+namespace {
+
+/// @brief Returns the textual address and port of the connection peer.
+///
+/// @param socket connection socket.
+std::string
+peerToText(const boost::asio::ip::tcp::socket& socket) {
+    boost::system::error_code ec;
+    boost::asio::ip::tcp::endpoint peer = socket.remote_endpoint(ec);
+    if (ec) {
+        return ("unknown");
+    }
+    std::ostringstream stream;
+    stream << peer.address().to_string() << " port " << peer.port();
+    return (stream.str());
+}
+
+/// @brief Converts the address to the asio address.
+///
+/// @param address address to convert.
+boost::asio::ip::address
+toAsioAddress(const asiolink::IOAddress& address) {
+    return (boost::asio::ip::address::from_string(address.toText()));
+}
+
+}
+
+//*************************** NameChangeTCPListener ***********************
+
+const size_t NameChangeTCPListener::MAX_BATCH_LENGTH;
+
+NameChangeTCPListener::
+NameChangeTCPListener(const isc::asiolink::IOAddress& ip_address,
+                      const uint32_t port, const NameChangeFormat format,
+                      RequestReceiveHandler& ncr_recv_handler,
+                      const bool reuse_address)
+    : NameChangeListener(ncr_recv_handler), ip_address_(ip_address),
+      port_(port), format_(format), reuse_address_(reuse_address),
+      io_service_(NULL), acceptor_(), connections_(), received_(),
+      generation_(0), receive_pending_(false), delivery_posted_(false) {
+}
+
+NameChangeTCPListener::~NameChangeTCPListener() {
+    // Clean up.
+    stopListening();
+}
+
+void
+NameChangeTCPListener::open(isc::asiolink::IOService& io_service) {
+    boost::asio::ip::tcp::endpoint endpoint(toAsioAddress(ip_address_),
+                                            port_);
+    try {
+        acceptor_.reset(new boost::asio::ip::tcp::
+                        acceptor(io_service.get_io_service()));
+        acceptor_->open(endpoint.protocol());
+
+        // Set the socket option to reuse addresses if it is enabled.
+        if (reuse_address_) {
+            acceptor_->set_option(boost::asio::socket_base::
+                                  reuse_address(true));
+        }
+
+        acceptor_->bind(endpoint);
+        acceptor_->listen();
+    } catch (boost::system::system_error& ex) {
+        acceptor_.reset();
+        isc_throw(NcrTCPError, ex.code().message());
+    }
+
+    io_service_ = &io_service;
+    startAccept();
+}
+
+void
+NameChangeTCPListener::close() {
+    // Invalidate the handlers of the current sockets.
+    ++generation_;
+
+    if (acceptor_) {
+        boost::system::error_code ignored;
+        acceptor_->close(ignored);
+        acceptor_.reset();
+    }
+
+    for (std::set<NcrTCPConnectionPtr>::iterator it = connections_.begin();
+         it != connections_.end(); ++it) {
+        boost::system::error_code ignored;
+        (*it)->open_ = false;
+        (*it)->socket_.close(ignored);
+    }
+    connections_.clear();
+
+    // Whatever was not delivered was not acknowledged either.
+    received_.clear();
+    delivery_posted_ = false;
+
+    // The application waits for the cancellation of its receive.
+    if (receive_pending_ && io_service_) {
+        io_service_->post(boost::bind(&NameChangeTCPListener::stoppedHandler,
+                                      this));
+    }
+}
+
+void
+NameChangeTCPListener::doReceive() {
+    receive_pending_ = true;
+    if (!received_.empty()) {
+        scheduleDelivery();
+    }
+}
+
+void
+NameChangeTCPListener::startAccept() {
+    NcrTCPConnectionPtr conn(new NcrTCPConnection(*io_service_));
+    acceptor_->async_accept(conn->socket_,
+                            boost::bind(&NameChangeTCPListener::acceptHandler,
+                                        this, conn, generation_, _1));
+}
+
+void
+NameChangeTCPListener::acceptHandler(const NcrTCPConnectionPtr& conn,
+                                     const uint64_t generation,
+                                     const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_ACCEPT_ERROR)
+                  .arg(ec.message());
+    } else {
+        connections_.insert(conn);
+        readHeader(conn);
+    }
+
+    startAccept();
+}
+
+void
+NameChangeTCPListener::readHeader(const NcrTCPConnectionPtr& conn) {
+    boost::asio::async_read(conn->socket_,
+                            boost::asio::buffer(conn->header_,
+                                                sizeof(conn->header_)),
+                            boost::bind(&NameChangeTCPListener::headerHandler,
+                                        this, conn, generation_, _1));
+}
+
+void
+NameChangeTCPListener::headerHandler(const NcrTCPConnectionPtr& conn,
+                                     const uint64_t generation,
+                                     const boost::system::error_code& ec) {
+    if ((generation != generation_) || !conn->open_) {
+        return;
+    }
+
+    if (ec) {
+        // The sender closing its connection is the normal end of it.
+        LOG_DEBUG(dhcp_ddns_logger, isc::log::DBGLVL_TRACE_BASIC,
+                  DHCP_DDNS_NCR_TCP_CONNECTION_CLOSED)
+                  .arg(peerToText(conn->socket_)).arg(ec.message());
+        closeConnection(conn);
+        return;
+    }
+
+    isc::util::InputBuffer header(conn->header_, sizeof(conn->header_));
+    conn->count_ = header.readUint16();
+    const size_t length = header.readUint32();
+    if ((length > MAX_BATCH_LENGTH) || ((conn->count_ == 0) != (length == 0))) {
+        std::ostringstream reason;
+        reason << conn->count_ << " requests in " << length << " bytes";
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_INVALID_BATCH)
+                  .arg(peerToText(conn->socket_)).arg(reason.str());
+        closeConnection(conn);
+        return;
+    }
+
+    if (length == 0) {
+        // Nothing to deliver, acknowledge right away.
+        conn->undelivered_ = 0;
+        writeAck(conn);
+        return;
+    }
+
+    conn->data_.resize(length);
+    boost::asio::async_read(conn->socket_,
+                            boost::asio::buffer(&conn->data_[0],
+                                                conn->data_.size()),
+                            boost::bind(&NameChangeTCPListener::batchHandler,
+                                        this, conn, generation_, _1));
+}
+
+void
+NameChangeTCPListener::batchHandler(const NcrTCPConnectionPtr& conn,
+                                    const uint64_t generation,
+                                    const boost::system::error_code& ec) {
+    if ((generation != generation_) || !conn->open_) {
+        return;
+    }
+
+    if (ec) {
+        LOG_DEBUG(dhcp_ddns_logger, isc::log::DBGLVL_TRACE_BASIC,
+                  DHCP_DDNS_NCR_TCP_CONNECTION_CLOSED)
+                  .arg(peerToText(conn->socket_)).arg(ec.message());
+        closeConnection(conn);
+        return;
+    }
+
+    // Unpack the requests. Each one is preceded by its length, so an
+    // invalid request is skipped without losing track of the others.
+    const uint8_t* data = &conn->data_[0];
+    const size_t length = conn->data_.size();
+    size_t pos = 0;
+    size_t queued = 0;
+    for (uint16_t i = 0; i < conn->count_; ++i) {
+        if (pos + sizeof(uint16_t) > length) {
+            break;
+        }
+        const size_t ncr_len = sizeof(uint16_t) +
+            ((static_cast<size_t>(data[pos]) << 8) | data[pos + 1]);
+        if (pos + ncr_len > length) {
+            break;
+        }
+
+        isc::util::InputBuffer ncr_buffer(data + pos, ncr_len);
+        pos += ncr_len;
+        try {
+            NameChangeRequestPtr ncr =
+                NameChangeRequest::fromFormat(format_, ncr_buffer);
+            received_.push_back(ReceivedRequest(ncr, conn));
+            ++queued;
+        } catch (const NcrMessageError& ex) {
+            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_INVALID_NCR)
+                      .arg(ex.what());
+        }
+    }
+
+    if (pos != length) {
+        std::ostringstream reason;
+        reason << "requests do not match the batch length of " << length
+               << " bytes";
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_INVALID_BATCH)
+                  .arg(peerToText(conn->socket_)).arg(reason.str());
+        // The queued requests of the connection are dropped by the
+        // delivery as it is closed.
+        closeConnection(conn);
+        return;
+    }
+
+    conn->data_.clear();
+    conn->undelivered_ = queued;
+    if (queued == 0) {
+        writeAck(conn);
+    } else if (receive_pending_) {
+        scheduleDelivery();
+    }
+}
+
+void
+NameChangeTCPListener::writeAck(const NcrTCPConnectionPtr& conn) {
+    conn->ack_[0] = static_cast<uint8_t>(conn->count_ >> 8);
+    conn->ack_[1] = static_cast<uint8_t>(conn->count_);
+    boost::asio::async_write(conn->socket_,
+                             boost::asio::buffer(conn->ack_,
+                                                 sizeof(conn->ack_)),
+                             boost::bind(&NameChangeTCPListener::ackHandler,
+                                         this, conn, generation_, _1));
+}
+
+void
+NameChangeTCPListener::ackHandler(const NcrTCPConnectionPtr& conn,
+                                  const uint64_t generation,
+                                  const boost::system::error_code& ec) {
+    if ((generation != generation_) || !conn->open_) {
+        return;
+    }
+
+    if (ec) {
+        LOG_DEBUG(dhcp_ddns_logger, isc::log::DBGLVL_TRACE_BASIC,
+                  DHCP_DDNS_NCR_TCP_CONNECTION_CLOSED)
+                  .arg(peerToText(conn->socket_)).arg(ec.message());
+        closeConnection(conn);
+        return;
+    }
+
+    readHeader(conn);
+}
+
+void
+NameChangeTCPListener::closeConnection(const NcrTCPConnectionPtr& conn) {
+    boost::system::error_code ignored;
+    conn->open_ = false;
+    conn->socket_.close(ignored);
+    connections_.erase(conn);
+}
+
+void
+NameChangeTCPListener::scheduleDelivery() {
+    if (!delivery_posted_) {
+        delivery_posted_ = true;
+        io_service_->post(boost::bind(&NameChangeTCPListener::deliverNext,
+                                      this, generation_));
+    }
+}
+
+void
+NameChangeTCPListener::deliverNext(const uint64_t generation) {
+    if (generation != generation_) {
+        return;
+    }
+    delivery_posted_ = false;
+
+    // Drop the requests of the connections closed in the meantime. They
+    // are not acknowledged, so they will be sent again.
+    while (!received_.empty() && !received_.front().second->open_) {
+        received_.pop_front();
+    }
+
+    if (received_.empty() || !receive_pending_) {
+        return;
+    }
+
+    ReceivedRequest request = received_.front();
+    received_.pop_front();
+    receive_pending_ = false;
+
+    // This calls doReceive() again unless the application stops
+    // listening.
+    invokeRecvHandler(SUCCESS, request.first);
+
+    // Acknowledge the batch once all of its requests are delivered.
+    const NcrTCPConnectionPtr& conn = request.second;
+    if ((generation == generation_) && conn->open_ &&
+        (--conn->undelivered_ == 0)) {
+        writeAck(conn);
+    }
+}
+
+void
+NameChangeTCPListener::stoppedHandler() {
+    // A shutdown cancels the outstanding receive.  For this reason,
+    // it is an expected event, so log it as a debug message.
+    LOG_DEBUG(dhcp_ddns_logger, isc::log::DBGLVL_TRACE_BASIC,
+              DHCP_DDNS_NCR_TCP_RECV_CANCELED);
+    receive_pending_ = false;
+    NameChangeRequestPtr empty;
+    invokeRecvHandler(STOPPED, empty);
+}
+
+//*************************** NameChangeTCPSender ***********************
+
+const size_t NameChangeTCPSender::MAX_BATCH_DEFAULT;
+
+NameChangeTCPSender::
+NameChangeTCPSender(const isc::asiolink::IOAddress& ip_address,
+                    const uint32_t port,
+                    const isc::asiolink::IOAddress& server_address,
+                    const uint32_t server_port, const NameChangeFormat format,
+                    RequestSendHandler& ncr_send_handler,
+                    const size_t send_que_max, const bool reuse_address,
+                    const size_t max_batch_size)
+    : NameChangeSender(ncr_send_handler, send_que_max),
+      ip_address_(ip_address), port_(port), server_address_(server_address),
+      server_port_(server_port), format_(format),
+      reuse_address_(reuse_address), max_batch_size_(max_batch_size),
+      io_service_(NULL), socket_(), state_(CLOSED), generation_(0),
+      send_buf_(), batch_count_(0), reused_(false), awaiting_ack_(false) {
+    if ((max_batch_size_ == 0) ||
+        (max_batch_size_ > std::numeric_limits<uint16_t>::max())) {
+        isc_throw(NcrTCPError, "NameChangeTCPSender: invalid batch size: "
+                  << max_batch_size_);
+    }
+}
+
+NameChangeTCPSender::~NameChangeTCPSender() {
+    // Clean up.
+    stopSending();
+}
+
+void
+NameChangeTCPSender::open(isc::asiolink::IOService& io_service) {
+    io_service_ = &io_service;
+
+    closeWatchSocket();
+    watch_socket_.reset(new util::WatchSocket());
+}
+
+void
+NameChangeTCPSender::close() {
+    closeSocket();
+
+    closeWatchSocket();
+    watch_socket_.reset();
+}
+
+void
+NameChangeTCPSender::doSend(NameChangeRequestPtr& ncr) {
+    doSendBatch(std::vector<NameChangeRequestPtr>(1, ncr));
+}
+
+void
+NameChangeTCPSender::doSendBatch(const std::vector<NameChangeRequestPtr>&
+                                 ncrs) {
+    // Render the requests, then prepend the header.
+    isc::util::OutputBuffer ncr_buffer(ncrs.size() * 128);
+    for (std::vector<NameChangeRequestPtr>::const_iterator it = ncrs.begin();
+         it != ncrs.end(); ++it) {
+        (*it)->toFormat(format_, ncr_buffer);
+    }
+
+    send_buf_.reset(new isc::util::OutputBuffer(NCR_TCP_HEADER_LEN +
+                                                ncr_buffer.getLength()));
+    send_buf_->writeUint16(static_cast<uint16_t>(ncrs.size()));
+    send_buf_->writeUint32(static_cast<uint32_t>(ncr_buffer.getLength()));
+    send_buf_->writeData(ncr_buffer.getData(), ncr_buffer.getLength());
+    batch_count_ = static_cast<uint16_t>(ncrs.size());
+
+    // Set IO ready marker so sender activity is visible to select() or
+    // poll() while connecting and writing.
+    // Note, if this call throws it will manifest itself as a throw from
+    // from sendRequest() which the application calls directly and is
+    // documented as throwing exceptions; or caught inside
+    // invokeSendHandler() which will invoke the application's send_handler
+    // with an error status.
+    watch_socket_->markReady();
+
+    reused_ = (state_ == CONNECTED);
+    if (reused_) {
+        write();
+    } else {
+        connect();
+    }
+}
+
+void
+NameChangeTCPSender::connect() {
+    closeSocket();
+    state_ = CONNECTING;
+
+    boost::asio::ip::tcp::endpoint local(toAsioAddress(ip_address_), port_);
+    boost::asio::ip::tcp::endpoint server(toAsioAddress(server_address_),
+                                          server_port_);
+    try {
+        socket_.reset(new boost::asio::ip::tcp::
+                      socket(io_service_->get_io_service()));
+        socket_->open(local.protocol());
+
+        // Set the socket option to reuse addresses if it is enabled.
+        if (reuse_address_) {
+            socket_->set_option(boost::asio::socket_base::
+                                reuse_address(true));
+        }
+
+        socket_->bind(local);
+    } catch (boost::system::system_error& ex) {
+        closeSocket();
+        isc_throw(NcrTCPError, ex.code().message());
+    }
+
+    socket_->async_connect(server,
+                           boost::bind(&NameChangeTCPSender::connectHandler,
+                                       this, generation_, _1));
+}
+
+void
+NameChangeTCPSender::connectHandler(const uint64_t generation,
+                                    const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    state_ = CONNECTED;
+    write();
+}
+
+void
+NameChangeTCPSender::write() {
+    boost::asio::async_write(*socket_,
+                             boost::asio::buffer(send_buf_->getData(),
+                                                 send_buf_->getLength()),
+                             boost::bind(&NameChangeTCPSender::writeHandler,
+                                         this, generation_, _1));
+}
+
+void
+NameChangeTCPSender::writeHandler(const uint64_t generation,
+                                  const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    // Wait for the acknowledgement on the socket rather than keep the
+    // watch socket ready, which would make the application spin.
+    boost::asio::async_read(*socket_,
+                            boost::asio::buffer(ack_, sizeof(ack_)),
+                            boost::bind(&NameChangeTCPSender::ackHandler,
+                                        this, generation_, _1));
+    awaiting_ack_ = true;
+    try {
+        watch_socket_->clearReady();
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_CLEAR_READY_ERROR)
+                 .arg(ex.what());
+    }
+}
+
+void
+NameChangeTCPSender::ackHandler(const uint64_t generation,
+                                const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+    awaiting_ack_ = false;
+
+    if (ec) {
+        fail(ec);
+        return;
+    }
+
+    const uint16_t acked = (static_cast<uint16_t>(ack_[0]) << 8) | ack_[1];
+    if (acked != batch_count_) {
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_INVALID_ACK)
+                  .arg(acked).arg(batch_count_);
+        closeSocket();
+        complete(ERROR);
+        return;
+    }
+
+    complete(SUCCESS);
+}
+
+void
+NameChangeTCPSender::fail(const boost::system::error_code& ec) {
+    closeSocket();
+
+    // The listener may have closed the connection while it was idle, so
+    // try once more over a new one.
+    if (reused_) {
+        reused_ = false;
+        try {
+            watch_socket_->markReady();
+            connect();
+            return;
+        } catch (const std::exception& ex) {
+            LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_SEND_ERROR)
+                      .arg(ex.what());
+            complete(ERROR);
+            return;
+        }
+    }
+
+    LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_SEND_ERROR)
+              .arg(ec.message());
+    complete(ERROR);
+}
+
+void
+NameChangeTCPSender::complete(const Result result) {
+    // Clear the IO ready marker.
+    try {
+        watch_socket_->clearReady();
+    } catch (const std::exception& ex) {
+        // This can only happen if the WatchSocket's select_fd has been
+        // compromised which is a programmatic error. We'll log the error
+        // here, then continue on and process the IO result we were given.
+        LOG_ERROR(dhcp_ddns_logger, DHCP_DDNS_NCR_TCP_CLEAR_READY_ERROR)
+                 .arg(ex.what());
+    }
+
+    send_buf_.reset();
+
+    // Call the application's registered request send handler.
+    invokeSendHandler(result);
+}
+
+void
+NameChangeTCPSender::closeSocket() {
+    // Invalidate the handlers of the current socket.
+    ++generation_;
+    awaiting_ack_ = false;
+    state_ = CLOSED;
+    if (socket_) {
+        boost::system::error_code ignored;
+        socket_->close(ignored);
+        socket_.reset();
+    }
+}
+
+int
+NameChangeTCPSender::getSelectFd() {
+    if (!amSending()) {
+        isc_throw(NotImplemented, "NameChangeTCPSender::getSelectFd"
+                                  " not in send mode");
+    }
+
+    if (awaiting_ack_ && socket_) {
+        return (socket_->native_handle());
+    }
+
+    return (watch_socket_->getSelectFd());
+}
+
+bool
+NameChangeTCPSender::ioReady() {
+    if (watch_socket_) {
+        return (watch_socket_->isReady());
+    }
+
+    return (false);
+}
+
+void
+NameChangeTCPSender::closeWatchSocket() {
+    if (watch_socket_) {
+        std::string error_string;
+        watch_socket_->closeSocket(error_string);
+        if (!error_string.empty()) {
+            LOG_ERROR(dhcp_ddns_logger,
+                      DHCP_DDNS_TCP_SENDER_WATCH_SOCKET_CLOSE_ERROR)
+                .arg(error_string);
+        }
+    }
+}
+
+}; // end of isc::dhcp_ddns namespace
+}; // end of isc namespace
@@ -0,0 +1,498 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef NCR_TCP_H
+#define NCR_TCP_H
+
+/// @file ncr_tcp.h
+/// @brief This file provides TCP socket based implementation for sending and
+/// receiving NameChangeRequests
+///
+/// These classes are derived from the abstract classes, NameChangeListener
+/// and NameChangeSender (see ncr_io.h).
+///
+/// Unlike the UDP transport, which carries one request per datagram, the
+/// TCP transport carries batches of requests over a persistent connection.
+/// Each batch is acknowledged by the listener once its requests have been
+/// handed over to the application, so the sender knows the requests were
+/// received and may send the next batch. A batch is framed as follows,
+/// all integers in network byte order:
+///
+/// @code
+///     +------------------+-------------------+---------------------+
+///     | count (2 bytes)  | length (4 bytes)  | requests (length)   |
+///     +------------------+-------------------+---------------------+
+/// @endcode
+///
+/// The requests are rendered one after another by
+/// isc::dhcp_ddns::NameChangeRequest::toFormat, so each of them is preceded
+/// by its own two byte length. The acknowledgement is the two byte count
+/// of the requests the listener consumed, which must be equal to the count
+/// of the batch. Requests which are not valid are logged and dropped by the
+/// listener, but they are acknowledged, because sending them again would
+/// not help.
+///
+/// The sender keeps at most one batch outstanding, thus the sender's queue
+/// drains in batches of up to the configured size rather than one request
+/// per IO.
+
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <dhcp_ddns/ncr_io.h>
+#include <util/buffer.h>
+#include <util/watch_socket.h>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <deque>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp_ddns {
+
+/// @brief Thrown when a TCP level exception occurs.
+class NcrTCPError : public isc::Exception {
+public:
+    NcrTCPError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Length of the header preceding a batch of requests.
+const size_t NCR_TCP_HEADER_LEN = 6;
+
+/// @brief Length of the acknowledgement of a batch.
+const size_t NCR_TCP_ACK_LEN = 2;
+
+/// @brief State of a connection accepted by the NameChangeTCPListener.
+struct NcrTCPConnection {
+    /// @brief Constructor
+    ///
+    /// @param io_service IO service used to run the connection.
+    NcrTCPConnection(asiolink::IOService& io_service)
+        : socket_(io_service.get_io_service()), data_(), count_(0),
+          undelivered_(0), open_(true) {
+    }
+
+    /// @brief Connection socket.
+    boost::asio::ip::tcp::socket socket_;
+
+    /// @brief Buffer for the header of a batch.
+    uint8_t header_[NCR_TCP_HEADER_LEN];
+
+    /// @brief Buffer for the requests of a batch.
+    std::vector<uint8_t> data_;
+
+    /// @brief Number of requests in the current batch.
+    uint16_t count_;
+
+    /// @brief Number of requests of the current batch not yet handed over
+    /// to the application.
+    size_t undelivered_;
+
+    /// @brief Buffer for the acknowledgement.
+    uint8_t ack_[NCR_TCP_ACK_LEN];
+
+    /// @brief False once the connection is closed.
+    bool open_;
+};
+
+/// @brief Defines a pointer to a NcrTCPConnection.
+typedef boost::shared_ptr<NcrTCPConnection> NcrTCPConnectionPtr;
+
+/// @brief Provides the ability to receive NameChangeRequests via TCP
+///
+/// This class is a derivation of the NameChangeListener which accepts any
+/// number of connections, so several DHCP servers may send requests to the
+/// same listener. The requests received from all connections are queued
+/// and handed over to the application one at a time, as the application
+/// asks for them via the base class receive loop. A connection reads the
+/// next batch only after the previous one was acknowledged, which
+/// throttles the senders to the pace of the application.
+class NameChangeTCPListener : public NameChangeListener {
+public:
+    /// @brief Defines the maximum length of the requests in a batch.
+    static const size_t MAX_BATCH_LENGTH = 4 * 1024 * 1024;
+
+    /// @brief Constructor
+    ///
+    /// @param ip_address is the network address on which to listen
+    /// @param port is the TCP port on which to listen
+    /// @param format is the wire format of the inbound requests.
+    /// @param ncr_recv_handler the receive handler object to notify when
+    /// a receive completes.
+    /// @param reuse_address enables IP address sharing when true
+    /// It defaults to false.
+    NameChangeTCPListener(const isc::asiolink::IOAddress& ip_address,
+                          const uint32_t port,
+                          const NameChangeFormat format,
+                          RequestReceiveHandler& ncr_recv_handler,
+                          const bool reuse_address = false);
+
+    /// @brief Destructor.
+    virtual ~NameChangeTCPListener();
+
+    /// @brief Opens the listening socket and starts accepting connections.
+    ///
+    /// @param io_service the IOService which will monitor the sockets.
+    ///
+    /// @throw NcrTCPError if the open fails.
+    virtual void open(isc::asiolink::IOService& io_service);
+
+    /// @brief Closes the listening socket and all connections.
+    ///
+    /// The requests received but not yet handed over to the application
+    /// are discarded. They were not acknowledged, so the senders send them
+    /// again. If a receive is pending, the application handler is invoked
+    /// with the STOPPED result.
+    virtual void close();
+
+    /// @brief Hands the next received request to the application.
+    ///
+    /// If there is a request queued, its delivery is posted to the IO
+    /// service. Otherwise the request is delivered as soon as the next
+    /// batch arrives.
+    void doReceive();
+
+    /// @brief Returns the number of open connections.
+    size_t getConnectionCount() const {
+        return (connections_.size());
+    }
+
+private:
+    /// @brief Starts accepting the next connection.
+    void startAccept();
+
+    /// @brief Handles the completion of the accept.
+    ///
+    /// @param conn accepted connection.
+    /// @param generation generation of the listener the handler was
+    /// installed for.
+    /// @param ec error code.
+    void acceptHandler(const NcrTCPConnectionPtr& conn,
+                       const uint64_t generation,
+                       const boost::system::error_code& ec);
+
+    /// @brief Starts reading the header of the next batch.
+    ///
+    /// @param conn connection to read from.
+    void readHeader(const NcrTCPConnectionPtr& conn);
+
+    /// @brief Handles the completion of the header read.
+    ///
+    /// @param conn connection the header was read from.
+    /// @param generation generation of the listener.
+    /// @param ec error code.
+    void headerHandler(const NcrTCPConnectionPtr& conn,
+                       const uint64_t generation,
+                       const boost::system::error_code& ec);
+
+    /// @brief Handles the completion of the batch read.
+    ///
+    /// Unpacks the requests and queues them for the application.
+    ///
+    /// @param conn connection the batch was read from.
+    /// @param generation generation of the listener.
+    /// @param ec error code.
+    void batchHandler(const NcrTCPConnectionPtr& conn,
+                      const uint64_t generation,
+                      const boost::system::error_code& ec);
+
+    /// @brief Writes the acknowledgement of the current batch.
+    ///
+    /// @param conn connection to write to.
+    void writeAck(const NcrTCPConnectionPtr& conn);
+
+    /// @brief Handles the completion of the acknowledgement write.
+    ///
+    /// @param conn connection the acknowledgement was written to.
+    /// @param generation generation of the listener.
+    /// @param ec error code.
+    void ackHandler(const NcrTCPConnectionPtr& conn,
+                    const uint64_t generation,
+                    const boost::system::error_code& ec);
+
+    /// @brief Closes a connection.
+    ///
+    /// @param conn connection to close.
+    void closeConnection(const NcrTCPConnectionPtr& conn);
+
+    /// @brief Posts the delivery of the next request unless already posted.
+    void scheduleDelivery();
+
+    /// @brief Delivers the next queued request to the application.
+    ///
+    /// @param generation generation of the listener.
+    void deliverNext(const uint64_t generation);
+
+    /// @brief Reports the cancellation of the pending receive.
+    void stoppedHandler();
+
+    /// @brief Received request along with the connection it came from.
+    typedef std::pair<NameChangeRequestPtr, NcrTCPConnectionPtr>
+    ReceivedRequest;
+
+    /// @brief IP address on which to listen for requests.
+    isc::asiolink::IOAddress ip_address_;
+
+    /// @brief Port number on which to listen for requests.
+    uint32_t port_;
+
+    /// @brief Wire format of the inbound requests.
+    NameChangeFormat format_;
+
+    /// @brief Flag which enables the reuse address socket option if true.
+    bool reuse_address_;
+
+    /// @brief IO service the listener was opened with.
+    asiolink::IOService* io_service_;
+
+    /// @brief Listening socket.
+    boost::shared_ptr<boost::asio::ip::tcp::acceptor> acceptor_;
+
+    /// @brief Open connections.
+    std::set<NcrTCPConnectionPtr> connections_;
+
+    /// @brief Requests waiting to be handed over to the application.
+    std::deque<ReceivedRequest> received_;
+
+    /// @brief Incremented whenever the listener is closed, so the IO
+    /// handlers installed before are ignored.
+    uint64_t generation_;
+
+    /// @brief True when the application waits for a request.
+    bool receive_pending_;
+
+    /// @brief True when the delivery of a request is posted.
+    bool delivery_posted_;
+
+    ///
+    /// @name Copy and constructor assignment operator
+    ///
+    /// The copy constructor and assignment operator are private to avoid
+    /// potential issues with multiple listeners attempting to share sockets.
+private:
+    NameChangeTCPListener(const NameChangeTCPListener& source);
+    NameChangeTCPListener& operator=(const NameChangeTCPListener& source);
+    //@}
+};
+
+/// @brief Provides the ability to send NameChangeRequests via TCP
+///
+/// This class is a derivation of the NameChangeSender which sends the
+/// queued requests in batches over a persistent connection to the
+/// listener. The connection is opened with the first batch and reopened
+/// when it fails. A batch sent over a connection which was idle is sent
+/// once more over a new connection if the first attempt fails, as the
+/// listener may have closed the idle connection in the meantime.
+///
+/// The sender is driven by the select-fd like the UDP sender. While the
+/// connection is being opened or a batch is being written, the watch
+/// socket is marked ready. While the sender waits for the acknowledgement,
+/// the select-fd is the connection socket itself, so the application
+/// must check the select-fd whenever it has run the sender's IO.
+class NameChangeTCPSender : public NameChangeSender {
+public:
+    /// @brief Defines the default maximum number of requests in a batch.
+    static const size_t MAX_BATCH_DEFAULT = 64;
+
+    /// @brief Constructor
+    ///
+    /// @param ip_address the IP address from which to send
+    /// @param port the port from which to send, 0 for any
+    /// @param server_address the IP address of the target listener
+    /// @param server_port is the IP port  of the target listener
+    /// @param format is the wire format of the outbound requests.
+    /// @param ncr_send_handler the send handler object to notify when
+    /// when a send completes.
+    /// @param send_que_max sets the maximum number of entries allowed in
+    /// the send queue.
+    /// It defaults to NameChangeSender::MAX_QUEUE_DEFAULT
+    /// @param reuse_address enables IP address sharing when true
+    /// It defaults to false.
+    /// @param max_batch_size maximum number of requests sent in a batch.
+    /// It defaults to MAX_BATCH_DEFAULT.
+    ///
+    /// @throw NcrTCPError if the batch size is 0 or larger than the
+    /// count field of the batch header allows.
+    NameChangeTCPSender(const isc::asiolink::IOAddress& ip_address,
+        const uint32_t port, const isc::asiolink::IOAddress& server_address,
+        const uint32_t server_port, const NameChangeFormat format,
+        RequestSendHandler& ncr_send_handler,
+        const size_t send_que_max = NameChangeSender::MAX_QUEUE_DEFAULT,
+        const bool reuse_address = false,
+        const size_t max_batch_size = MAX_BATCH_DEFAULT);
+
+    /// @brief Destructor
+    virtual ~NameChangeTCPSender();
+
+    /// @brief Prepares the sender to send using the given IOService.
+    ///
+    /// The connection is not opened until the first batch is sent, so the
+    /// listener does not need to be running.
+    ///
+    /// @param io_service the IOService which will monitor the socket.
+    virtual void open(isc::asiolink::IOService& io_service);
+
+    /// @brief Closes the connection.
+    ///
+    /// The outstanding batch, if any, remains queued.
+    virtual void close();
+
+    /// @brief Sends a single request.
+    ///
+    /// @param ncr NameChangeRequest to send.
+    virtual void doSend(NameChangeRequestPtr& ncr);
+
+    /// @brief Sends a batch of requests.
+    ///
+    /// Renders the requests into a single buffer and writes it over the
+    /// connection, opening it first if necessary.
+    ///
+    /// @param ncrs requests to send.
+    virtual void doSendBatch(const std::vector<NameChangeRequestPtr>& ncrs);
+
+    /// @brief Returns the maximum number of requests sent in a batch.
+    virtual size_t getMaxBatchSize() const {
+        return (max_batch_size_);
+    }
+
+    /// @brief Returns a file descriptor suitable for use with select
+    ///
+    /// This is the connection socket while the sender waits for the
+    /// acknowledgement and the watch socket otherwise.
+    ///
+    /// @return Returns an "open" file descriptor
+    ///
+    /// @throw NotImplemented if the sender is not in send mode,
+    virtual int getSelectFd();
+
+    /// @brief Returns whether or not the sender has IO ready to process.
+    ///
+    /// @return true if the sender has at IO ready, false otherwise.
+    virtual bool ioReady();
+
+    /// @brief Checks if the connection is open.
+    bool isConnected() const {
+        return (state_ == CONNECTED);
+    }
+
+private:
+    /// @brief State of the connection.
+    enum State {
+        CLOSED,
+        CONNECTING,
+        CONNECTED
+    };
+
+    /// @brief Starts opening the connection.
+    void connect();
+
+    /// @brief Handles the completion of the connect.
+    ///
+    /// @param generation generation of the socket the handler was
+    /// installed for.
+    /// @param ec error code.
+    void connectHandler(const uint64_t generation,
+                        const boost::system::error_code& ec);
+
+    /// @brief Writes the current batch.
+    void write();
+
+    /// @brief Handles the completion of the write.
+    ///
+    /// @param generation generation of the socket.
+    /// @param ec error code.
+    void writeHandler(const uint64_t generation,
+                      const boost::system::error_code& ec);
+
+    /// @brief Handles the completion of the acknowledgement read.
+    ///
+    /// @param generation generation of the socket.
+    /// @param ec error code.
+    void ackHandler(const uint64_t generation,
+                    const boost::system::error_code& ec);
+
+    /// @brief Handles a failure of the exchange.
+    ///
+    /// Closes the connection and either sends the batch again or
+    /// completes the exchange with an error.
+    ///
+    /// @param ec error code.
+    void fail(const boost::system::error_code& ec);
+
+    /// @brief Completes the exchange of the current batch.
+    ///
+    /// @param result outcome passed to the application.
+    void complete(const Result result);
+
+    /// @brief Closes the connection socket.
+    void closeSocket();
+
+    /// @brief Closes watch socket if the socket is open.
+    void closeWatchSocket();
+
+    /// @brief IP address from which to send.
+    isc::asiolink::IOAddress ip_address_;
+
+    /// @brief Port from which to send.
+    uint32_t port_;
+
+    /// @brief IP address of the target listener.
+    isc::asiolink::IOAddress server_address_;
+
+    /// @brief Port of the target listener.
+    uint32_t server_port_;
+
+    /// @brief Wire format of the outbound requests.
+    NameChangeFormat format_;
+
+    /// @brief Flag which enables the reuse address socket option if true.
+    bool reuse_address_;
+
+    /// @brief Maximum number of requests in a batch.
+    size_t max_batch_size_;
+
+    /// @brief IO service the sender was opened with.
+    asiolink::IOService* io_service_;
+
+    /// @brief Connection socket.
+    boost::shared_ptr<boost::asio::ip::tcp::socket> socket_;
+
+    /// @brief State of the connection.
+    State state_;
+
+    /// @brief Incremented whenever the socket is closed, so the IO
+    /// handlers installed before are ignored.
+    uint64_t generation_;
+
+    /// @brief The current batch, including its header.
+    util::OutputBufferPtr send_buf_;
+
+    /// @brief Number of requests in the current batch.
+    uint16_t batch_count_;
+
+    /// @brief True if the current batch is sent over a connection which
+    /// was open before.
+    bool reused_;
+
+    /// @brief True while the sender waits for the acknowledgement.
+    bool awaiting_ack_;
+
+    /// @brief Buffer for the acknowledgement.
+    uint8_t ack_[NCR_TCP_ACK_LEN];
+
+    /// @brief Pointer to WatchSocket instance supplying the "select-fd".
+    util::WatchSocketPtr watch_socket_;
+};
+
+} // namespace isc::dhcp_ddns
+} // namespace isc
+
+#endif // NCR_TCP_H
@@ -0,0 +1,412 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/interval_timer.h>
+#include <dhcp_ddns/ncr_io.h>
+#include <dhcp_ddns/ncr_tcp.h>
+#include <test_utils.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::dhcp_ddns;
+
+namespace {
+
+/// @brief Defines a list of valid JSON NameChangeRequest test messages.
+const char *valid_msgs[] =
+{
+    // Valid Add.
+     "{"
+     " \"change-type\" : 0 , "
+     " \"forward-change\" : true , "
+     " \"reverse-change\" : false , "
+     " \"fqdn\" : \"walah.walah.com\" , "
+     " \"ip-address\" : \"192.168.2.1\" , "
+     " \"dhcid\" : \"010203040A7F8E3D\" , "
+     " \"lease-expires-on\" : \"20130121132405\" , "
+     " \"lease-length\" : 1300 "
+     "}",
+    // Valid Remove.
+     "{"
+     " \"change-type\" : 1 , "
+     " \"forward-change\" : true , "
+     " \"reverse-change\" : true , "
+     " \"fqdn\" : \"walah.walah.com\" , "
+     " \"ip-address\" : \"192.168.2.1\" , "
+     " \"dhcid\" : \"010203040A7F8E3D\" , "
+     " \"lease-expires-on\" : \"20130121132405\" , "
+     " \"lease-length\" : 1300 "
+     "}",
+     // Valid Add with IPv6 address
+     "{"
+     " \"change-type\" : 0 , "
+     " \"forward-change\" : false , "
+     " \"reverse-change\" : true , "
+     " \"fqdn\" : \"walah.walah.com\" , "
+     " \"ip-address\" : \"fe80::2acf:e9ff:fe12:e56f\" , "
+     " \"dhcid\" : \"010203040A7F8E3D\" , "
+     " \"lease-expires-on\" : \"20130121132405\" , "
+     " \"lease-length\" : 1300 "
+     "}"
+};
+
+const char* TEST_ADDRESS = "127.0.0.1";
+const uint32_t LISTENER_PORT = 5311;
+const long TEST_TIMEOUT = 5 * 1000;
+
+/// @brief A NOP derivation for constructor test purposes.
+class SimpleHandler : public NameChangeListener::RequestReceiveHandler,
+                      public NameChangeSender::RequestSendHandler {
+public:
+    virtual void operator ()(const NameChangeListener::Result,
+                             NameChangeRequestPtr&) {
+    }
+
+    virtual void operator ()(const NameChangeSender::Result,
+                             NameChangeRequestPtr&) {
+    }
+};
+
+/// @brief Tests construction of the TCP listener and sender.
+TEST(NameChangeTCPTest, constructionTests) {
+    SimpleHandler handler;
+    isc::asiolink::IOAddress ip_address(TEST_ADDRESS);
+
+    NameChangeListenerPtr listener;
+    EXPECT_NO_THROW(listener.reset(
+        new NameChangeTCPListener(ip_address, LISTENER_PORT, FMT_BINARY,
+                                  handler)));
+    EXPECT_FALSE(listener->amListening());
+
+    NameChangeSenderPtr sender;
+    EXPECT_NO_THROW(sender.reset(
+        new NameChangeTCPSender(ip_address, 0, ip_address, LISTENER_PORT,
+                                FMT_BINARY, handler)));
+    EXPECT_FALSE(sender->amSending());
+
+    // The batch size must be usable and fit in the batch header.
+    EXPECT_THROW(NameChangeTCPSender(ip_address, 0, ip_address,
+                                     LISTENER_PORT, FMT_BINARY, handler,
+                                     100, false, 0),
+                 NcrTCPError);
+    EXPECT_THROW(NameChangeTCPSender(ip_address, 0, ip_address,
+                                     LISTENER_PORT, FMT_BINARY, handler,
+                                     100, false, 65536),
+                 NcrTCPError);
+}
+
+/// @brief Text fixture for testing TCP transport between a
+/// NameChangeTCPSender and a NameChangeTCPListener.
+class NameChangeTCPTest : public virtual ::testing::Test,
+                          NameChangeListener::RequestReceiveHandler,
+                          NameChangeSender::RequestSendHandler {
+public:
+    isc::asiolink::IOService io_service_;
+    NameChangeListener::Result recv_result_;
+    NameChangeSender::Result send_result_;
+    boost::shared_ptr<NameChangeTCPListener> listener_;
+    boost::shared_ptr<NameChangeTCPSender> sender_;
+    isc::asiolink::IntervalTimer test_timer_;
+
+    std::vector<NameChangeRequestPtr> sent_ncrs_;
+    std::vector<NameChangeRequestPtr> received_ncrs_;
+    size_t send_errors_;
+
+    NameChangeTCPTest()
+        : io_service_(), recv_result_(NameChangeListener::SUCCESS),
+          send_result_(NameChangeSender::SUCCESS), test_timer_(io_service_),
+          send_errors_(0) {
+        // Set the test timeout to break any running tasks if they hang.
+        test_timer_.setup(boost::bind(&NameChangeTCPTest::testTimeoutHandler,
+                                      this),
+                          TEST_TIMEOUT);
+    }
+
+    /// @brief Creates the listener and the sender.
+    ///
+    /// The sender binds to an ephemeral port so connections can be
+    /// reopened without waiting for TIME_WAIT.
+    ///
+    /// @param format wire format used by both ends.
+    /// @param max_batch_size maximum number of requests per batch.
+    void createEnds(const NameChangeFormat format,
+                    const size_t max_batch_size) {
+        isc::asiolink::IOAddress addr(TEST_ADDRESS);
+        listener_.reset(new NameChangeTCPListener(addr, LISTENER_PORT,
+                                                  format, *this, true));
+        sender_.reset(new NameChangeTCPSender(addr, 0, addr, LISTENER_PORT,
+                                              format, *this, 100, true,
+                                              max_batch_size));
+    }
+
+    /// @brief Queues all of the test messages, repeated a number of times.
+    ///
+    /// @param repeat number of times each message is queued.
+    /// @return the number of requests queued.
+    size_t queueRequests(const size_t repeat) {
+        size_t num_msgs = sizeof(valid_msgs) / sizeof(char*);
+        for (size_t r = 0; r < repeat; ++r) {
+            for (size_t i = 0; i < num_msgs; ++i) {
+                NameChangeRequestPtr ncr =
+                    NameChangeRequest::fromJSON(valid_msgs[i]);
+                // Make each request distinct so ordering can be checked.
+                ncr->setLeaseLength(1000 + r * num_msgs + i);
+                sender_->sendRequest(ncr);
+            }
+        }
+
+        return (repeat * num_msgs);
+    }
+
+    /// @brief Runs IO until the queue is drained and the given number of
+    /// requests have been received.
+    ///
+    /// @param num_msgs number of requests expected by the listener.
+    void runUntilDelivered(const size_t num_msgs) {
+        while ((sender_->getQueueSize() > 0) ||
+               (received_ncrs_.size() < num_msgs) ||
+               (sent_ncrs_.size() < num_msgs)) {
+            ASSERT_NO_THROW(io_service_.run_one());
+        }
+    }
+
+    /// @brief Verifies that what was sent matches what was received, in
+    /// the same order.
+    void checkSentVsReceived() {
+        ASSERT_EQ(sent_ncrs_.size(), received_ncrs_.size());
+        for (size_t i = 0; i < sent_ncrs_.size(); ++i) {
+            ASSERT_TRUE(sent_ncrs_[i]);
+            ASSERT_TRUE(received_ncrs_[i]);
+            EXPECT_TRUE(*sent_ncrs_[i] == *received_ncrs_[i])
+                << "mismatch at " << i;
+        }
+    }
+
+    /// @brief Implements the receive completion handler.
+    virtual void operator ()(const NameChangeListener::Result result,
+                             NameChangeRequestPtr& ncr) {
+        recv_result_ = result;
+        if (result == NameChangeListener::SUCCESS) {
+            received_ncrs_.push_back(ncr);
+        }
+    }
+
+    /// @brief Implements the send completion handler.
+    virtual void operator ()(const NameChangeSender::Result result,
+                             NameChangeRequestPtr& ncr) {
+        send_result_ = result;
+        if (result == NameChangeSender::SUCCESS) {
+            sent_ncrs_.push_back(ncr);
+        } else {
+            ++send_errors_;
+        }
+    }
+
+    // @brief Handler invoked when test timeout is hit.
+    //
+    // This callback stops all running (hanging) tasks on IO service.
+    void testTimeoutHandler() {
+        io_service_.stop();
+        FAIL() << "Test timeout hit.";
+    }
+};
+
+/// @brief Verifies that batches of binary requests are delivered in order
+/// over a single persistent connection, and that the listener stops cleanly.
+TEST_F(NameChangeTCPTest, roundTripBinary) {
+    createEnds(FMT_BINARY, 4);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    size_t num_msgs = queueRequests(5);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(NameChangeSender::SUCCESS, send_result_);
+    EXPECT_EQ(0, send_errors_);
+    checkSentVsReceived();
+
+    // All of the batches travelled over the same connection.
+    EXPECT_TRUE(sender_->isConnected());
+    EXPECT_EQ(1, listener_->getConnectionCount());
+
+    // Verify that we can gracefully stop listening.
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_FALSE(listener_->amListening());
+
+    // Verify that IO pending is cleared by the stop event.
+    while (listener_->isIoPending()) {
+        ASSERT_NO_THROW(io_service_.run_one());
+    }
+    EXPECT_EQ(NameChangeListener::STOPPED, recv_result_);
+
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that a request whose escaped FQDN text is longer than
+/// 255 bytes is delivered in the binary format, and that the sender keeps
+/// working afterwards.
+TEST_F(NameChangeTCPTest, longFqdnBinary) {
+    createEnds(FMT_BINARY, 4);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    // Escaped characters make the text of a valid name longer than its
+    // wire format.
+    std::string label;
+    for (int i = 0; i < 60; ++i) {
+        label += "\\032";
+    }
+    std::string fqdn;
+    for (int i = 0; i < 4; ++i) {
+        fqdn += label + ".";
+    }
+    NameChangeRequestPtr ncr = NameChangeRequest::fromJSON(valid_msgs[0]);
+    ASSERT_NO_THROW(ncr->setFqdn(fqdn));
+    ASSERT_GT(ncr->getFqdn().size(), 255);
+
+    size_t num_msgs = queueRequests(1);
+    ASSERT_NO_THROW(sender_->sendRequest(ncr));
+    ++num_msgs;
+    num_msgs += queueRequests(1);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(0, send_errors_);
+    checkSentVsReceived();
+    ASSERT_EQ(num_msgs, received_ncrs_.size());
+    EXPECT_EQ(ncr->getFqdn(), received_ncrs_[3]->getFqdn());
+
+    num_msgs += queueRequests(2);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(0, send_errors_);
+    checkSentVsReceived();
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that a request which can't be rendered is dropped
+/// without blocking the requests queued around it.
+TEST_F(NameChangeTCPTest, unrenderableRequestDropped) {
+    createEnds(FMT_BINARY, 4);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    // The binary format limits the DHCID to 65535 bytes.
+    NameChangeRequestPtr ncr = NameChangeRequest::fromJSON(valid_msgs[0]);
+    ASSERT_NO_THROW(ncr->setDhcid(std::string(2 * 70000, '0')));
+
+    size_t num_msgs = queueRequests(1);
+    ASSERT_NO_THROW(sender_->sendRequest(ncr));
+    num_msgs += queueRequests(2);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(0, send_errors_);
+    EXPECT_EQ(0, sender_->getQueueSize());
+    checkSentVsReceived();
+    EXPECT_EQ(num_msgs, received_ncrs_.size());
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that the JSON format works over TCP as well.
+TEST_F(NameChangeTCPTest, roundTripJSON) {
+    createEnds(FMT_JSON, 64);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    size_t num_msgs = queueRequests(10);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(0, send_errors_);
+    checkSentVsReceived();
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that the sender reconnects transparently when the
+/// listener has closed an idle connection.
+TEST_F(NameChangeTCPTest, reconnect) {
+    createEnds(FMT_BINARY, 8);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    size_t num_msgs = queueRequests(1);
+    runUntilDelivered(num_msgs);
+    ASSERT_TRUE(sender_->isConnected());
+
+    // Restart the listener, which drops the sender's connection.
+    ASSERT_NO_THROW(listener_->stopListening());
+    while (listener_->isIoPending()) {
+        ASSERT_NO_THROW(io_service_.run_one());
+    }
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+
+    num_msgs += queueRequests(2);
+    runUntilDelivered(num_msgs);
+    EXPECT_EQ(0, send_errors_);
+    checkSentVsReceived();
+    EXPECT_EQ(1, listener_->getConnectionCount());
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies that a send fails, leaving the request queued, when
+/// nothing is listening.
+TEST_F(NameChangeTCPTest, noListener) {
+    createEnds(FMT_BINARY, 4);
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    queueRequests(1);
+    while (send_errors_ == 0) {
+        ASSERT_NO_THROW(io_service_.run_one());
+    }
+
+    EXPECT_EQ(NameChangeSender::ERROR, send_result_);
+    EXPECT_FALSE(sender_->isConnected());
+    EXPECT_TRUE(sent_ncrs_.empty());
+
+    // The error handler is invoked once for the failed request, which
+    // remains at the front of the queue.
+    EXPECT_EQ(sizeof(valid_msgs) / sizeof(char*), sender_->getQueueSize());
+
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+/// @brief Verifies the select descriptor used by the sender.
+///
+/// The descriptor is ready while a batch is waiting to be written and is
+/// the connection while the sender waits for the acknowledgement, so that
+/// an external select loop neither spins nor misses the ack.
+TEST_F(NameChangeTCPTest, selectFd) {
+    createEnds(FMT_BINARY, 4);
+    ASSERT_NO_THROW(listener_->startListening(io_service_));
+    ASSERT_NO_THROW(sender_->startSending(io_service_));
+
+    int watch_fd = sender_->getSelectFd();
+    ASSERT_NE(-1, watch_fd);
+    EXPECT_EQ(0, selectCheck(watch_fd));
+
+    queueRequests(1);
+    EXPECT_TRUE(sender_->ioReady());
+    EXPECT_LT(0, selectCheck(sender_->getSelectFd()));
+
+    size_t num_msgs = sizeof(valid_msgs) / sizeof(char*);
+    runUntilDelivered(num_msgs);
+
+    // With nothing left to send the watch descriptor is used and is idle.
+    EXPECT_EQ(watch_fd, sender_->getSelectFd());
+    EXPECT_FALSE(sender_->ioReady());
+    EXPECT_EQ(0, selectCheck(watch_fd));
+
+    EXPECT_NO_THROW(listener_->stopListening());
+    EXPECT_NO_THROW(sender_->stopSending());
+}
+
+} // end of anonymous namespace
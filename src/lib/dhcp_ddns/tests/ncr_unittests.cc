@@ -582,6 +582,145 @@ TEST(NameChangeRequestTest, toFromBufferTest) {
     ASSERT_EQ(final_str, msg_str);
 }
 
+/// @brief Tests that a request survives a round trip through the binary
+/// format, for both IPv4 and IPv6 addresses, and that the binary rendition
+/// is smaller than the JSON one.
+TEST(NameChangeRequestTest, toFromBinaryTest) {
+    const char* msgs[] = {
+        "{"
+            "\"change-type\":1,"
+            "\"forward-change\":true,"
+            "\"reverse-change\":false,"
+            "\"fqdn\":\"walah.walah.com.\","
+            "\"ip-address\":\"192.168.2.1\","
+            "\"dhcid\":\"010203040A7F8E3D\","
+            "\"lease-expires-on\":\"20130121132405\","
+            "\"lease-length\":1300"
+        "}",
+        "{"
+            "\"change-type\":0,"
+            "\"forward-change\":true,"
+            "\"reverse-change\":true,"
+            "\"fqdn\":\"walah.walah.com.\","
+            "\"ip-address\":\"2001:db8::1:2:3\","
+            "\"dhcid\":\"010203040A7F8E3D\","
+            "\"lease-expires-on\":\"20380119031407\","
+            "\"lease-length\":7200"
+        "}"
+    };
+
+    for (size_t i = 0; i < sizeof(msgs) / sizeof(char*); ++i) {
+        SCOPED_TRACE(msgs[i]);
+        NameChangeRequestPtr ncr;
+        ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(msgs[i]));
+
+        // Render the request in both formats.
+        isc::util::OutputBuffer json_buffer(1024);
+        ASSERT_NO_THROW(ncr->toFormat(FMT_JSON, json_buffer));
+        isc::util::OutputBuffer output_buffer(1024);
+        ASSERT_NO_THROW(ncr->toFormat(FMT_BINARY, output_buffer));
+        EXPECT_LT(output_buffer.getLength(), json_buffer.getLength());
+
+        // Verify that we can create a new request from the binary rendition
+        // and that it consumes the whole buffer.
+        isc::util::InputBuffer input_buffer(output_buffer.getData(),
+                                            output_buffer.getLength());
+        NameChangeRequestPtr ncr2;
+        ASSERT_NO_THROW(ncr2 =
+                        NameChangeRequest::fromFormat(FMT_BINARY,
+                                                      input_buffer));
+        EXPECT_EQ(output_buffer.getLength(), input_buffer.getPosition());
+        EXPECT_TRUE(*ncr == *ncr2);
+        EXPECT_EQ(msgs[i], ncr2->toJSON());
+    }
+}
+
+/// @brief Tests that malformed binary renditions are rejected.
+TEST(NameChangeRequestTest, invalidBinaryTest) {
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+    isc::util::OutputBuffer output_buffer(1024);
+    ASSERT_NO_THROW(ncr->toFormat(FMT_BINARY, output_buffer));
+    const uint8_t* data =
+        static_cast<const uint8_t*>(output_buffer.getData());
+    std::vector<uint8_t> good(data, data + output_buffer.getLength());
+
+    // Length prefix larger than the data.
+    std::vector<uint8_t> bad(good.begin(), good.end() - 1);
+    isc::util::InputBuffer truncated(&bad[0], bad.size());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, truncated),
+                 NcrMessageError);
+
+    // Length prefix smaller than the content.
+    bad = good;
+    bad[1] -= 1;
+    isc::util::InputBuffer short_len(&bad[0], bad.size());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, short_len),
+                 NcrMessageError);
+
+    // Invalid change type.
+    bad = good;
+    bad[2] = 7;
+    isc::util::InputBuffer bad_type(&bad[0], bad.size());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, bad_type),
+                 NcrMessageError);
+
+    // Invalid address length.
+    bad = good;
+    bad[4] = 5;
+    isc::util::InputBuffer bad_addr(&bad[0], bad.size());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, bad_addr),
+                 NcrMessageError);
+
+    // Neither forward nor reverse change requested.
+    bad = good;
+    bad[3] = 0;
+    isc::util::InputBuffer bad_flags(&bad[0], bad.size());
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, bad_flags),
+                 NcrMessageError);
+
+    // Empty buffer.
+    isc::util::InputBuffer empty(&good[0], 0);
+    EXPECT_THROW(NameChangeRequest::fromFormat(FMT_BINARY, empty),
+                 NcrMessageError);
+}
+
+/// @brief Tests that a request whose FQDN text is longer than 255 bytes
+/// is rendered in the binary format, and that a request which can't be
+/// rendered leaves the buffer untouched.
+TEST(NameChangeRequestTest, binaryLongValues) {
+    NameChangeRequestPtr ncr;
+    ASSERT_NO_THROW(ncr = NameChangeRequest::fromJSON(valid_msgs[0]));
+
+    // Escaped characters make the text of a valid name longer than
+    // its wire format.
+    std::string label;
+    for (int i = 0; i < 60; ++i) {
+        label += "\\032";
+    }
+    std::string fqdn;
+    for (int i = 0; i < 4; ++i) {
+        fqdn += label + ".";
+    }
+    ASSERT_NO_THROW(ncr->setFqdn(fqdn));
+    ASSERT_GT(ncr->getFqdn().size(), 255);
+
+    isc::util::OutputBuffer output_buffer(1024);
+    ASSERT_NO_THROW(ncr->toFormat(FMT_BINARY, output_buffer));
+    isc::util::InputBuffer input_buffer(output_buffer.getData(),
+                                        output_buffer.getLength());
+    NameChangeRequestPtr ncr2;
+    ASSERT_NO_THROW(ncr2 = NameChangeRequest::fromFormat(FMT_BINARY,
+                                                         input_buffer));
+    EXPECT_TRUE(*ncr == *ncr2);
+
+    // The DHCID length is limited to two bytes.
+    ASSERT_NO_THROW(ncr->setDhcid(std::string(2 * 70000, '0')));
+    const size_t length = output_buffer.getLength();
+    EXPECT_THROW(ncr->toFormat(FMT_BINARY, output_buffer), NcrMessageError);
+    EXPECT_EQ(length, output_buffer.getLength());
+}
+
 /// @brief Tests ip address modification and validation
 TEST(NameChangeRequestTest, ipAddresses) {
     NameChangeRequest ncr;
@@ -608,9 +747,12 @@ TEST(NameChangeRequestTest, ipAddresses) {
 TEST(NameChangeFormatTest, formatEnumConversion){
     ASSERT_EQ(stringToNcrFormat("JSON"), dhcp_ddns::FMT_JSON);
     ASSERT_EQ(stringToNcrFormat("jSoN"), dhcp_ddns::FMT_JSON);
+    ASSERT_EQ(stringToNcrFormat("BINARY"), dhcp_ddns::FMT_BINARY);
+    ASSERT_EQ(stringToNcrFormat("binary"), dhcp_ddns::FMT_BINARY);
     ASSERT_THROW(stringToNcrFormat("bogus"), isc::BadValue);
 
     ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_JSON), "JSON");
+    ASSERT_EQ(ncrFormatToString(dhcp_ddns::FMT_BINARY), "BINARY");
 }
 
 /// @brief Tests conversion of NameChangeProtocol between enum and strings.
@@ -1523,6 +1523,57 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         lease_mgr.getExpiredLeases6(leases, max_leases);
     }
 
+    // Reclaim the leases. If the timeout is hit before all leases have
+    // been processed, the reclamation pass is marked as incomplete.
+    const size_t leases_processed = reclaimLeases6(leases, remove_lease,
+                                                   timeout, stopwatch,
+                                                   incomplete_reclamation);
+
+    // Stop measuring the time.
+    stopwatch.stop();
+
+    // Mark completion of the lease reclamation routine and present some stats.
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V6_LEASES_RECLAMATION_COMPLETE)
+        .arg(leases_processed)
+        .arg(stopwatch.logFormatTotalDuration());
+
+    // Check if this was an incomplete reclamation and increase the number of
+    // consecutive incomplete reclamations.
+    if (incomplete_reclamation) {
+        ++incomplete_v6_reclamations_;
+        // If the number of incomplete reclamations is beyond the threshold, we
+        // need to issue a warning.
+        if ((max_unwarned_cycles > 0) &&
+            (incomplete_v6_reclamations_ > max_unwarned_cycles)) {
+            LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V6_LEASES_RECLAMATION_SLOW)
+                .arg(max_unwarned_cycles);
+            // We issued a warning, so let's now reset the counter.
+            incomplete_v6_reclamations_ = 0;
+        }
+
+    } else {
+        // This was a complete reclamation, so let's reset the counter.
+        incomplete_v6_reclamations_ = 0;
+
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES);
+    }
+}
+
+size_t
+AllocEngine::reclaimLeases6(const Lease6Collection& leases,
+                            const bool remove_lease, const uint16_t timeout) {
+    util::Stopwatch stopwatch;
+    bool timed_out = false;
+    return (reclaimLeases6(leases, remove_lease, timeout, stopwatch, timed_out));
+}
+
+size_t
+AllocEngine::reclaimLeases6(const Lease6Collection& leases,
+                            const bool remove_lease, const uint16_t timeout,
+                            const util::Stopwatch& stopwatch,
+                            bool& timed_out) {
     // Do not initialize the callout handle until we know if there are any
     // lease6_expire callouts installed.
     CalloutHandlePtr callout_handle;
@@ -1532,6 +1583,7 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
     }
 
     size_t leases_processed = 0;
+    size_t leases_visited = 0;
     BOOST_FOREACH(Lease6Ptr lease, leases) {
 
         try {
@@ -1550,12 +1602,9 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         // allow reclaiming at least one lease.
         if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
             // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
-                    incomplete_reclamation = true;
-                }
+            // all leases we wanted to process.
+            if (++leases_visited < leases.size()) {
+                timed_out = true;
             }
 
             LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
@@ -1563,38 +1612,10 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
                 .arg(timeout);
             break;
         }
+        ++leases_visited;
     }
 
-    // Stop measuring the time.
-    stopwatch.stop();
-
-    // Mark completion of the lease reclamation routine and present some stats.
-    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-              ALLOC_ENGINE_V6_LEASES_RECLAMATION_COMPLETE)
-        .arg(leases_processed)
-        .arg(stopwatch.logFormatTotalDuration());
-
-    // Check if this was an incomplete reclamation and increase the number of
-    // consecutive incomplete reclamations.
-    if (incomplete_reclamation) {
-        ++incomplete_v6_reclamations_;
-        // If the number of incomplete reclamations is beyond the threshold, we
-        // need to issue a warning.
-        if ((max_unwarned_cycles > 0) &&
-            (incomplete_v6_reclamations_ > max_unwarned_cycles)) {
-            LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V6_LEASES_RECLAMATION_SLOW)
-                .arg(max_unwarned_cycles);
-            // We issued a warning, so let's now reset the counter.
-            incomplete_v6_reclamations_ = 0;
-        }
-
-    } else {
-        // This was a complete reclamation, so let's reset the counter.
-        incomplete_v6_reclamations_ = 0;
-
-        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                  ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES);
-    }
+    return (leases_processed);
 }
 
 void
@@ -1663,47 +1684,11 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
     }
 
 
-    // Do not initialize the callout handle until we know if there are any
-    // lease4_expire callouts installed.
-    CalloutHandlePtr callout_handle;
-    if (!leases.empty() &&
-        HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease4_expire_)) {
-        callout_handle = HooksManager::createCalloutHandle();
-    }
-
-    size_t leases_processed = 0;
-    BOOST_FOREACH(Lease4Ptr lease, leases) {
-
-        try {
-            // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
-            ++leases_processed;
-
-        } catch (const std::exception& ex) {
-            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
-                .arg(lease->addr_.toText())
-                .arg(ex.what());
-        }
-
-        // Check if we have hit the timeout for running reclamation routine and
-        // return if we have. We're checking it here, because we always want to
-        // allow reclaiming at least one lease.
-        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
-            // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
-                    incomplete_reclamation = true;
-                }
-            }
-
-            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                      ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
-                .arg(timeout);
-            break;
-        }
-    }
+    // Reclaim the leases. If the timeout is hit before all leases have
+    // been processed, the reclamation pass is marked as incomplete.
+    const size_t leases_processed = reclaimLeases4(leases, remove_lease,
+                                                   timeout, stopwatch,
+                                                   incomplete_reclamation);
 
     // Stop measuring the time.
     stopwatch.stop();
@@ -1927,6 +1912,63 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                   int64_t(1));
 }
 
+size_t
+AllocEngine::reclaimLeases4(const Lease4Collection& leases,
+                            const bool remove_lease, const uint16_t timeout) {
+    util::Stopwatch stopwatch;
+    bool timed_out = false;
+    return (reclaimLeases4(leases, remove_lease, timeout, stopwatch, timed_out));
+}
+
+size_t
+AllocEngine::reclaimLeases4(const Lease4Collection& leases,
+                            const bool remove_lease, const uint16_t timeout,
+                            const util::Stopwatch& stopwatch,
+                            bool& timed_out) {
+    // Do not initialize the callout handle until we know if there are any
+    // lease4_expire callouts installed.
+    CalloutHandlePtr callout_handle;
+    if (!leases.empty() &&
+        HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease4_expire_)) {
+        callout_handle = HooksManager::createCalloutHandle();
+    }
+
+    size_t leases_processed = 0;
+    size_t leases_visited = 0;
+    BOOST_FOREACH(Lease4Ptr lease, leases) {
+
+        try {
+            // Reclaim the lease.
+            reclaimExpiredLease(lease, remove_lease, callout_handle);
+            ++leases_processed;
+
+        } catch (const std::exception& ex) {
+            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                .arg(lease->addr_.toText())
+                .arg(ex.what());
+        }
+
+        // Check if we have hit the timeout for running reclamation routine and
+        // return if we have. We're checking it here, because we always want to
+        // allow reclaiming at least one lease.
+        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
+            // Timeout. This will likely mean that we haven't been able to process
+            // all leases we wanted to process.
+            if (++leases_visited < leases.size()) {
+                timed_out = true;
+            }
+
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
+                .arg(timeout);
+            break;
+        }
+        ++leases_visited;
+    }
+
+    return (leases_processed);
+}
+
 void
 AllocEngine::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
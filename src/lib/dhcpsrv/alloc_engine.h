@@ -17,6 +17,7 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <hooks/callout_handle.h>
+#include <util/stopwatch.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -630,6 +631,25 @@ public:
                                const bool remove_lease,
                                const uint16_t max_unwarned_cycles = 0);
 
+    /// @brief Reclaims specified expired IPv6 leases.
+    ///
+    /// This method performs the same processing for each lease as
+    /// @c reclaimExpiredLeases6, but it doesn't fetch the leases from the
+    /// lease database. It is used by the callers which obtain the expired
+    /// leases by other means and split the reclamation into smaller chunks,
+    /// e.g. the @c ReclamationWorker.
+    ///
+    /// @param leases Collection of the leases to be reclaimed.
+    /// @param remove_lease A boolean value indicating if the lease should
+    /// be removed when it is reclaimed (if true) or it should be left in the
+    /// database in the "expired-reclaimed" state (if false).
+    /// @param timeout Maximum amount of time that the reclamation routine
+    /// may be processing expired leases, expressed in milliseconds.
+    ///
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases6(const Lease6Collection& leases,
+                          const bool remove_lease, const uint16_t timeout);
+
     /// @brief Deletes reclaimed leases expired more than specified amount
     /// of time ago.
     ///
@@ -688,6 +708,25 @@ public:
                                const bool remove_lease,
                                const uint16_t max_unwarned_cycles = 0);
 
+    /// @brief Reclaims specified expired IPv4 leases.
+    ///
+    /// This method performs the same processing for each lease as
+    /// @c reclaimExpiredLeases4, but it doesn't fetch the leases from the
+    /// lease database. It is used by the callers which obtain the expired
+    /// leases by other means and split the reclamation into smaller chunks,
+    /// e.g. the @c ReclamationWorker.
+    ///
+    /// @param leases Collection of the leases to be reclaimed.
+    /// @param remove_lease A boolean value indicating if the lease should
+    /// be removed when it is reclaimed (if true) or it should be left in the
+    /// database in the "expired-reclaimed" state (if false).
+    /// @param timeout Maximum amount of time that the reclamation routine
+    /// may be processing expired leases, expressed in milliseconds.
+    ///
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases4(const Lease4Collection& leases,
+                          const bool remove_lease, const uint16_t timeout);
+
     /// @brief Deletes reclaimed leases expired more than specified amount
     /// of time ago.
     ///
@@ -962,6 +1001,36 @@ private:
                              const DbReclaimMode& reclaim_mode,
                              const hooks::CalloutHandlePtr& callout_handle);
 
+    /// @brief Reclaims specified IPv6 leases within the timeout.
+    ///
+    /// @param leases Collection of the leases to be reclaimed.
+    /// @param remove_lease Indicates if the leases should be removed.
+    /// @param timeout Maximum processing time in milliseconds, measured by
+    /// the @c stopwatch.
+    /// @param stopwatch Stopwatch measuring processing time.
+    /// @param [out] timed_out Set to true if the timeout occurred before
+    /// all leases were processed.
+    ///
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases6(const Lease6Collection& leases,
+                          const bool remove_lease, const uint16_t timeout,
+                          const util::Stopwatch& stopwatch, bool& timed_out);
+
+    /// @brief Reclaims specified IPv4 leases within the timeout.
+    ///
+    /// @param leases Collection of the leases to be reclaimed.
+    /// @param remove_lease Indicates if the leases should be removed.
+    /// @param timeout Maximum processing time in milliseconds, measured by
+    /// the @c stopwatch.
+    /// @param stopwatch Stopwatch measuring processing time.
+    /// @param [out] timed_out Set to true if the timeout occurred before
+    /// all leases were processed.
+    ///
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases4(const Lease4Collection& leases,
+                          const bool remove_lease, const uint16_t timeout,
+                          const util::Stopwatch& stopwatch, bool& timed_out);
+
     /// @brief Marks lease as reclaimed in the database.
     ///
     /// This method is called internally by the leases reclamation routines.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,8 +22,9 @@ namespace dhcp {
 /// The DHCP servers process a single request at a time. At points where the
 /// CalloutHandle is required, the pointer to the current request (packet) is
 /// passed to this function.  If the request is a new one, a pointer to
-/// the request is stored, a new CalloutHandle is allocated (and stored) and
-/// a pointer to the latter object returned to the caller.  If the request
+/// the request is stored, the CalloutHandle of the previous request is reset
+/// or a new CalloutHandle is allocated (and stored) and a pointer to the
+/// latter object returned to the caller.  If the request
 /// matches the one stored, the pointer to the stored CalloutHandle is
 /// returned.
 ///
@@ -60,13 +61,16 @@ isc::hooks::CalloutHandlePtr getCalloutHandle(const T& pktptr) {
         // do anything as we will automatically return the stored handle.)
         if (pktptr != stored_pointer) {
 
-            // Not seen before, so store the pointer passed to us and get a new
-            // CalloutHandle.  (The latter operation frees and probably deletes
-            // (depending on other pointers) the stored one.)
+            // Not seen before, so store the pointer passed to us and get a
+            // CalloutHandle for the new packet.  The stored handle is reused
+            // when nothing else references it, otherwise the operation frees
+            // and probably deletes (depending on other pointers) the stored
+            // one.
             stored_pointer = pktptr;
-            stored_handle = isc::hooks::HooksManager::createCalloutHandle();
+            stored_handle =
+                isc::hooks::HooksManager::createCalloutHandle(stored_handle);
         }
-        
+
     } else {
 
         // Empty pointer passed, clear stored data
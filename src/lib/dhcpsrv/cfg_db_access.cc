@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
@@ -39,14 +40,34 @@ CfgDbAccess::getHostDbAccessString() const {
 
 void
 CfgDbAccess::createManagers() const {
-    // Recreate lease manager.
-    LeaseMgrFactory::destroy();
-    LeaseMgrFactory::create(getLeaseDbAccessString());
+    // Keep the lease manager if it was created with the same parameters:
+    // reconnecting to a database or reading the lease file again only
+    // delays the reconfiguration.
+    const std::string lease_db_access = getLeaseDbAccessString();
+    if (LeaseMgrFactory::isCurrent(lease_db_access)) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_CFGMGR_KEEP_LEASE_DB)
+            .arg(LeaseMgrFactory::instance().getType());
+        LeaseMgrFactory::instance().reconfigure();
+
+    } else {
+        // Recreate lease manager.
+        LeaseMgrFactory::destroy();
+        LeaseMgrFactory::create(lease_db_access);
+    }
+
+    // Keep the host data source likewise.
+    const std::string host_db_access = getHostDbAccessString();
+    if (!host_db_access.empty() &&
+        HostDataSourceFactory::isCurrent(host_db_access)) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_CFGMGR_KEEP_HOST_DB)
+            .arg(HostDataSourceFactory::getHostDataSourcePtr()->getType());
+        return;
+    }
 
     // Recreate host data source.
     HostDataSourceFactory::destroy();
     if (!host_db_access_.empty()) {
-        HostMgr::create(getHostDbAccessString());
+        HostMgr::create(host_db_access);
     }
 }
 
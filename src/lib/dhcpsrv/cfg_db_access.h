@@ -62,6 +62,11 @@ public:
 
     /// @brief Creates instance of lease manager and host data source
     /// according to the configuration specified.
+    ///
+    /// The current lease manager and host data source are kept when they
+    /// were created with the same access strings, so an unchanged database
+    /// configuration doesn't cause the database to be reopened or the
+    /// lease file to be read again on reconfiguration.
     void createManagers() const;
 
     /// @brief Unparse an access string
@@ -20,6 +20,8 @@ const uint32_t CfgExpiration::DEFAULT_HOLD_RECLAIMED_TIME = 3600;
 const uint32_t CfgExpiration::DEFAULT_MAX_RECLAIM_LEASES = 100;
 const uint16_t CfgExpiration::DEFAULT_MAX_RECLAIM_TIME = 250;
 const uint16_t CfgExpiration::DEFAULT_UNWARNED_RECLAIM_CYCLES = 5;
+const uint32_t CfgExpiration::DEFAULT_RECLAIM_SLICE_LEASES = 50;
+const uint32_t CfgExpiration::DEFAULT_MAX_RECLAIM_RATE = 0;
 
 // Maximum values.
 const uint16_t CfgExpiration::LIMIT_RECLAIM_TIMER_WAIT_TIME =
@@ -33,6 +35,9 @@ const uint32_t CfgExpiration::LIMIT_MAX_RECLAIM_LEASES =
 const uint16_t CfgExpiration::LIMIT_MAX_RECLAIM_TIME = 10000;
 const uint16_t CfgExpiration::LIMIT_UNWARNED_RECLAIM_CYCLES =
     std::numeric_limits<uint16_t>::max();
+const uint32_t CfgExpiration::LIMIT_RECLAIM_SLICE_LEASES = 100000;
+const uint32_t CfgExpiration::LIMIT_MAX_RECLAIM_RATE =
+    std::numeric_limits<uint32_t>::max();
 
 // Timers' names
 const std::string CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME =
@@ -48,6 +53,9 @@ CfgExpiration::CfgExpiration(const bool test_mode)
       max_reclaim_leases_(DEFAULT_MAX_RECLAIM_LEASES),
       max_reclaim_time_(DEFAULT_MAX_RECLAIM_TIME),
       unwarned_reclaim_cycles_(DEFAULT_UNWARNED_RECLAIM_CYCLES),
+      background_reclamation_(false),
+      reclaim_slice_leases_(DEFAULT_RECLAIM_SLICE_LEASES),
+      max_reclaim_rate_(DEFAULT_MAX_RECLAIM_RATE),
       timer_mgr_(TimerMgr::instance()),
       test_mode_(test_mode) {
 }
@@ -91,6 +99,23 @@ CfgExpiration::setUnwarnedReclaimCycles(const int64_t unwarned_reclaim_cycles) {
     unwarned_reclaim_cycles_ = unwarned_reclaim_cycles;
 }
 
+void
+CfgExpiration::setReclaimSliceLeases(const int64_t reclaim_slice_leases) {
+    rangeCheck(reclaim_slice_leases, LIMIT_RECLAIM_SLICE_LEASES,
+               "reclaim-slice-leases");
+    if (reclaim_slice_leases == 0) {
+        isc_throw(OutOfRange, "value for configuration parameter"
+                  " 'reclaim-slice-leases' must be greater than 0");
+    }
+    reclaim_slice_leases_ = reclaim_slice_leases;
+}
+
+void
+CfgExpiration::setMaxReclaimRate(const int64_t max_reclaim_rate) {
+    rangeCheck(max_reclaim_rate, LIMIT_MAX_RECLAIM_RATE, "max-reclaim-rate");
+    max_reclaim_rate_ = max_reclaim_rate;
+}
+
 void
 CfgExpiration::rangeCheck(const int64_t value, const uint64_t max_value,
                           const std::string& config_parameter_name) const {
@@ -132,6 +157,21 @@ CfgExpiration::toElement() const {
     result->set("unwarned-reclaim-cycles",
                 Element::create(static_cast<long long>
                                 (unwarned_reclaim_cycles_)));
+    // The background reclamation parameters are only meaningful when
+    // the background reclamation is enabled.
+    if (background_reclamation_) {
+        // Set background-reclamation
+        result->set("background-reclamation",
+                    Element::create(background_reclamation_));
+        // Set reclaim-slice-leases
+        result->set("reclaim-slice-leases",
+                    Element::create(static_cast<long long>
+                                    (reclaim_slice_leases_)));
+        // Set max-reclaim-rate
+        result->set("max-reclaim-rate",
+                    Element::create(static_cast<long long>
+                                    (max_reclaim_rate_)));
+    }
     return (result);
 }
 
@@ -55,6 +55,19 @@ namespace dhcp {
 ///   there are still expired leases in the database. If this value is 0,
 ///   the warning is never issued.
 ///
+/// - background-reclamation - indicates if the expired leases should be
+///   reclaimed in the background by the @c ReclamationWorker rather than
+///   in a single pass executed when the timer elapses. In the background
+///   mode, the reclamation cycle is split into a number of short slices
+///   interleaved with packet processing.
+///
+/// - reclaim-slice-leases - is the maximum number of leases reclaimed in a
+///   single slice of the background reclamation.
+///
+/// - max-reclaim-rate - is the maximum number of leases per second that the
+///   background reclamation may process. If this value is 0, the rate is
+///   not limited.
+///
 /// The @c CfgExpiration class provides a collection of accessors and
 /// modifiers to manage the data. Each accessor checks if the given value
 /// is in range allowed for this value.
@@ -82,6 +95,12 @@ public:
     /// @brief Default value for unwarned-reclaim-cycles.
     static const uint16_t DEFAULT_UNWARNED_RECLAIM_CYCLES;
 
+    /// @brief Default value for reclaim-slice-leases.
+    static const uint32_t DEFAULT_RECLAIM_SLICE_LEASES;
+
+    /// @brief Default value for max-reclaim-rate.
+    static const uint32_t DEFAULT_MAX_RECLAIM_RATE;
+
     //@}
 
     /// @name Upper limits for the parameters
@@ -105,6 +124,12 @@ public:
     /// @brief Maximum value for unwarned-reclaim-cycles.
     static const uint16_t LIMIT_UNWARNED_RECLAIM_CYCLES;
 
+    /// @brief Maximum value for reclaim-slice-leases.
+    static const uint32_t LIMIT_RECLAIM_SLICE_LEASES;
+
+    /// @brief Maximum value for max-reclaim-rate.
+    static const uint32_t LIMIT_MAX_RECLAIM_RATE;
+
     //@}
 
     /// @name Timers' names
@@ -188,6 +213,39 @@ public:
     /// @param unwarned_reclaim_cycles New value.
     void setUnwarnedReclaimCycles(const int64_t unwarned_reclaim_cycles);
 
+    /// @brief Returns background-reclamation.
+    bool getBackgroundReclamation() const {
+        return (background_reclamation_);
+    }
+
+    /// @brief Sets background-reclamation.
+    ///
+    /// @param background_reclamation New value.
+    void setBackgroundReclamation(const bool background_reclamation) {
+        background_reclamation_ = background_reclamation;
+    }
+
+    /// @brief Returns reclaim-slice-leases.
+    uint32_t getReclaimSliceLeases() const {
+        return (reclaim_slice_leases_);
+    }
+
+    /// @brief Sets reclaim-slice-leases.
+    ///
+    /// @param reclaim_slice_leases New value.
+    /// @throw isc::OutOfRange if the value is 0 or out of range.
+    void setReclaimSliceLeases(const int64_t reclaim_slice_leases);
+
+    /// @brief Returns max-reclaim-rate.
+    uint32_t getMaxReclaimRate() const {
+        return (max_reclaim_rate_);
+    }
+
+    /// @brief Sets max-reclaim-rate.
+    ///
+    /// @param max_reclaim_rate New value.
+    void setMaxReclaimRate(const int64_t max_reclaim_rate);
+
     /// @brief Setup timers for the reclamation of expired leases according
     /// to the configuration parameters.
     ///
@@ -262,6 +320,15 @@ private:
     /// @brief unwarned-reclaim-cycles.
     uint16_t unwarned_reclaim_cycles_;
 
+    /// @brief background-reclamation.
+    bool background_reclamation_;
+
+    /// @brief reclaim-slice-leases.
+    uint32_t reclaim_slice_leases_;
+
+    /// @brief max-reclaim-rate.
+    uint32_t max_reclaim_rate_;
+
     /// @brief Pointer to the instance of the Timer Manager.
     TimerMgrPtr timer_mgr_;
 
@@ -11,6 +11,8 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <exceptions/exceptions.h>
 #include <util/encode/hex.h>
+#include <algorithm>
+#include <functional>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -18,6 +20,65 @@
 using namespace isc::asiolink;
 using namespace isc::data;
 
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Checks if a host reserves at least one resource.
+///
+/// @param host Host to be checked.
+/// @return true if the host reserves a hostname, an IPv4 address, siaddr,
+/// sname, file, an IPv6 address or prefix, options or classes.
+bool
+hasResource(const Host& host) {
+    return (!host.getHostname().empty() ||
+            !host.getIPv4Reservation().isV4Zero() ||
+            host.hasIPv6Reservation() ||
+            !host.getNextServer().isV4Zero() ||
+            !host.getServerHostname().empty() ||
+            !host.getBootFileName().empty() ||
+            !host.getCfgOption4()->empty() ||
+            !host.getCfgOption6()->empty() ||
+            !host.getClientClasses4().empty() ||
+            !host.getClientClasses6().empty());
+}
+
+/// @brief Key of a host in a subnet: subnet id and host.
+typedef std::pair<SubnetID, const Host*> HostInSubnet;
+
+/// @brief Orders the hosts in a subnet by subnet id and identifier.
+struct HostInSubnetLess {
+    bool operator()(const HostInSubnet& a, const HostInSubnet& b) const {
+        if (a.first != b.first) {
+            return (a.first < b.first);
+        }
+        if (a.second->getIdentifierType() != b.second->getIdentifierType()) {
+            return (a.second->getIdentifierType() <
+                    b.second->getIdentifierType());
+        }
+        return (a.second->getIdentifier() < b.second->getIdentifier());
+    }
+};
+
+/// @brief Sorts keys and checks if some of them are equal.
+///
+/// @param keys Keys to be checked.
+/// @param less Strict weak ordering of the keys.
+/// @return true if at least two keys are equal.
+template<typename Key, typename Less>
+bool
+hasDuplicates(std::vector<Key>& keys, Less less) {
+    std::sort(keys.begin(), keys.end(), less);
+    for (size_t i = 1; i < keys.size(); ++i) {
+        if (!less(keys[i - 1], keys[i])) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -571,6 +632,86 @@ CfgHosts::add(const HostPtr& host) {
     add6(host);
 }
 
+void
+CfgHosts::add(const HostCollection& hosts) {
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_ADD_HOSTS)
+        .arg(hosts.size());
+
+    // The hosts are checked against each other only. The hosts which would
+    // be rejected are added one by one, so as the first of them in order
+    // is rejected with the same error as by the single host add.
+    if (!hosts_.empty() || !canAddInBulk(hosts)) {
+        for (HostCollection::const_iterator host = hosts.begin();
+             host != hosts.end(); ++host) {
+            add(*host);
+        }
+        return;
+    }
+
+    for (HostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        hosts_.insert(*host);
+        if ((*host)->getIPv6SubnetID() > 0) {
+            IPv6ResrvRange reservations = (*host)->getIPv6Reservations();
+            for (IPv6ResrvIterator it = reservations.first;
+                 it != reservations.second; ++it) {
+                hosts6_.insert(HostResrv6Tuple(it->second, *host));
+            }
+        }
+    }
+}
+
+bool
+CfgHosts::canAddInBulk(const HostCollection& hosts) const {
+    // Keys which must be unique, as checked by add4 and add6.
+    std::vector<HostInSubnet> ids4;
+    std::vector<HostInSubnet> ids6;
+    std::vector<std::pair<SubnetID, IOAddress> > addresses4;
+    std::vector<std::pair<SubnetID, IOAddress> > reservations6;
+    ids4.reserve(hosts.size());
+    for (HostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        if (!*host ||
+            (((*host)->getIPv4SubnetID() == 0) &&
+             ((*host)->getIPv6SubnetID() == 0)) ||
+            !hasResource(**host)) {
+            return (false);
+        }
+
+        const SubnetID subnet_id4 = (*host)->getIPv4SubnetID();
+        if (subnet_id4 > 0) {
+            if (!(*host)->getIdentifier().empty()) {
+                ids4.push_back(HostInSubnet(subnet_id4, host->get()));
+            }
+            if (!(*host)->getIPv4Reservation().isV4Zero()) {
+                addresses4.push_back(std::make_pair(subnet_id4,
+                    (*host)->getIPv4Reservation()));
+            }
+        }
+
+        const SubnetID subnet_id6 = (*host)->getIPv6SubnetID();
+        if (subnet_id6 > 0) {
+            // Only the HW address and DUID are checked in IPv6 subnets.
+            if (((*host)->getIdentifierType() == Host::IDENT_HWADDR) ||
+                ((*host)->getIdentifierType() == Host::IDENT_DUID)) {
+                ids6.push_back(HostInSubnet(subnet_id6, host->get()));
+            }
+            IPv6ResrvRange range = (*host)->getIPv6Reservations();
+            for (IPv6ResrvIterator it = range.first; it != range.second;
+                 ++it) {
+                reservations6.push_back(std::make_pair(subnet_id6,
+                    it->second.getPrefix()));
+            }
+        }
+    }
+
+    typedef std::less<std::pair<SubnetID, IOAddress> > AddressLess;
+    return (!hasDuplicates(ids4, HostInSubnetLess()) &&
+            !hasDuplicates(ids6, HostInSubnetLess()) &&
+            !hasDuplicates(addresses4, AddressLess()) &&
+            !hasDuplicates(reservations6, AddressLess()));
+}
+
 void
 CfgHosts::add4(const HostPtr& host) {
 
@@ -580,16 +721,7 @@ CfgHosts::add4(const HostPtr& host) {
     // There should be at least one resource reserved: hostname, IPv4
     // address, siaddr, sname, file or IPv6 address or prefix.
     /// @todo: this check should be done in add(), not in add4()
-    if (host->getHostname().empty() &&
-        (host->getIPv4Reservation().isV4Zero()) &&
-        !host->hasIPv6Reservation() &&
-        host->getNextServer().isV4Zero() &&
-        host->getServerHostname().empty() &&
-        host->getBootFileName().empty() &&
-        host->getCfgOption4()->empty() &&
-        host->getCfgOption6()->empty() &&
-        host->getClientClasses4().empty() &&
-        host->getClientClasses6().empty()) {
+    if (!hasResource(*host)) {
         std::ostringstream s;
         if (hwaddr) {
             s << "for DUID: " << hwaddr->toText();
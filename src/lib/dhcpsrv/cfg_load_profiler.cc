@@ -0,0 +1,77 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/cfg_load_profiler.h>
+#include <util/stopwatch_impl.h>
+#include <sstream>
+
+using namespace boost::posix_time;
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+CfgLoadProfiler::CfgLoadProfiler()
+    : stopwatch_(true), stages_() {
+}
+
+void
+CfgLoadProfiler::mark(const std::string& stage) {
+    stopwatch_.stop();
+    const time_duration duration = stopwatch_.getLastDuration();
+    stopwatch_.start();
+
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        if (stages_[i].first == stage) {
+            stages_[i].second += duration;
+            return;
+        }
+    }
+    stages_.push_back(std::make_pair(stage, duration));
+}
+
+time_duration
+CfgLoadProfiler::getDuration(const std::string& stage) const {
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        if (stages_[i].first == stage) {
+            return (stages_[i].second);
+        }
+    }
+    return (time_duration(0, 0, 0, 0));
+}
+
+time_duration
+CfgLoadProfiler::getTotalDuration() const {
+    time_duration total(0, 0, 0, 0);
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        total += stages_[i].second;
+    }
+    return (total);
+}
+
+std::vector<std::string>
+CfgLoadProfiler::getStages() const {
+    std::vector<std::string> stages;
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        stages.push_back(stages_[i].first);
+    }
+    return (stages);
+}
+
+std::string
+CfgLoadProfiler::toText() const {
+    std::ostringstream s;
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        s << stages_[i].first << " "
+          << StopwatchImpl::logFormat(stages_[i].second) << ", ";
+    }
+    s << "total " << StopwatchImpl::logFormat(getTotalDuration());
+    return (s.str());
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -267,44 +267,39 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
 
 void
 CfgSubnets4::removeStatistics() {
-    using namespace isc::stats;
-
     // For each v4 subnet currently configured, remove the statistic.
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+        removeStatistics((*subnet4)->getID());
+    }
+}
+
+void
+CfgSubnets4::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
 CfgSubnets4::updateStatistics() {
-    using namespace isc::stats;
-
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-
-        stats_mgr.setValue(StatsMgr::
-                           generateName("subnet", subnet_id, "total-addresses"),
-                                        static_cast<int64_t>
-                                        ((*subnet4)->getPoolCapacity(Lease::
-                                                                     TYPE_V4)));
+        updateTotalStatistics(**subnet4);
     }
 
     // Only recount the stats if we have subnets.
@@ -313,6 +308,27 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const SubnetID& subnet_id) {
+    ConstSubnet4Ptr subnet = getBySubnetId(subnet_id);
+    if (!subnet) {
+        isc_throw(BadValue, "no subnet with subnet-id " << subnet_id);
+    }
+    updateTotalStatistics(*subnet);
+    LeaseMgrFactory::instance().recountLeaseStats4(subnet_id);
+}
+
+void
+CfgSubnets4::updateTotalStatistics(const Subnet4& subnet) const {
+    using namespace isc::stats;
+
+    StatsMgr::instance().setValue(StatsMgr::
+                                  generateName("subnet", subnet.getID(),
+                                               "total-addresses"),
+                                  static_cast<int64_t>
+                                  (subnet.getPoolCapacity(Lease::TYPE_V4)));
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
@@ -235,6 +235,25 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of a single subnet.
+    ///
+    /// This method sets the totals of the subnet and recounts its lease
+    /// statistics, leaving the statistics of the other subnets untouched.
+    /// It is used when a subnet is added or replaced without a
+    /// reconfiguration.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @throw BadValue if there is no subnet with this identifier.
+    void updateStatistics(const SubnetID& subnet_id);
+
+    /// @brief Removes statistics of a single subnet.
+    ///
+    /// The subnet doesn't need to be configured, so this can be called
+    /// after its removal.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void removeStatistics(const SubnetID& subnet_id);
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -242,6 +261,12 @@ public:
 
 private:
 
+    /// @brief Sets the statistics of a subnet which depend only on its
+    /// configuration, i.e. the number of available addresses.
+    ///
+    /// @param subnet Subnet.
+    void updateTotalStatistics(const Subnet4& subnet) const;
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
@@ -214,53 +214,44 @@ CfgSubnets6::getSubnet(const SubnetID id) const {
 
 void
 CfgSubnets6::removeStatistics() {
-    using namespace isc::stats;
-
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, remove the statistics.
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+        removeStatistics((*subnet6)->getID());
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+void
+CfgSubnets6::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
 CfgSubnets6::updateStatistics() {
-    using namespace isc::stats;
-
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, calculate totals
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "total-nas"),
-                           static_cast<int64_t>
-                           ((*subnet6)->getPoolCapacity(Lease::TYPE_NA)));
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "total-pds"),
-                            static_cast<int64_t>
-                            ((*subnet6)->getPoolCapacity(Lease::TYPE_PD)));
+        updateTotalStatistics(**subnet6);
     }
 
     // Only recount the stats if we have subnets.
@@ -269,6 +260,32 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const SubnetID& subnet_id) {
+    ConstSubnet6Ptr subnet = getBySubnetId(subnet_id);
+    if (!subnet) {
+        isc_throw(BadValue, "no subnet with subnet-id " << subnet_id);
+    }
+    updateTotalStatistics(*subnet);
+    LeaseMgrFactory::instance().recountLeaseStats6(subnet_id);
+}
+
+void
+CfgSubnets6::updateTotalStatistics(const Subnet6& subnet) const {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet.getID(),
+                                              "total-nas"),
+                       static_cast<int64_t>
+                       (subnet.getPoolCapacity(Lease::TYPE_NA)));
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet.getID(),
+                                              "total-pds"),
+                       static_cast<int64_t>
+                       (subnet.getPoolCapacity(Lease::TYPE_PD)));
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
@@ -193,6 +193,25 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of a single subnet.
+    ///
+    /// This method sets the totals of the subnet and recounts its lease
+    /// statistics, leaving the statistics of the other subnets untouched.
+    /// It is used when a subnet is added or replaced without a
+    /// reconfiguration.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @throw BadValue if there is no subnet with this identifier.
+    void updateStatistics(const SubnetID& subnet_id);
+
+    /// @brief Removes statistics of a single subnet.
+    ///
+    /// The subnet doesn't need to be configured, so this can be called
+    /// after its removal.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void removeStatistics(const SubnetID& subnet_id);
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -200,6 +219,12 @@ public:
 
 private:
 
+    /// @brief Sets the statistics of a subnet which depend only on its
+    /// configuration, i.e. the number of available addresses and prefixes.
+    ///
+    /// @param subnet Subnet.
+    void updateTotalStatistics(const Subnet6& subnet) const;
+
     /// @brief Selects a subnet using the interface name.
     ///
     /// This method searches for the subnet using the name of the interface.
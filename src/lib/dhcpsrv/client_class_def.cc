@@ -186,6 +186,9 @@ ClientClassDictionary::addClass(ClientClassDefPtr& class_def) {
                   << class_def->getName() << " has already been defined");
     }
 
+    // Register the name so the packets classified in this class hold
+    // its bit.
+    ClientClassRegistry::instance().intern(class_def->getName());
     (*classes_)[class_def->getName()] = class_def;
 }
 
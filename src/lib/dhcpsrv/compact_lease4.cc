@@ -0,0 +1,119 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/compact_lease4.h>
+#include <exceptions/exceptions.h>
+
+#include <limits>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+const InternPool::Value*
+InternPool::acquire(const std::string& value) {
+    if (value.empty()) {
+        return (NULL);
+    }
+    ValueMap::iterator it = values_.find(value);
+    if (it == values_.end()) {
+        it = values_.insert(Value(value, 0)).first;
+    }
+    ++it->second;
+    return (&*it);
+}
+
+const InternPool::Value*
+InternPool::acquire(const uint8_t* data, const size_t size) {
+    if (size == 0) {
+        return (NULL);
+    }
+    return (acquire(std::string(reinterpret_cast<const char*>(data), size)));
+}
+
+void
+InternPool::release(const Value* value) {
+    if (value && (--const_cast<Value*>(value)->second == 0)) {
+        values_.erase(value->first);
+    }
+}
+
+const int64_t CompactLease4::CLTT_EPOCH;
+const uint8_t CompactLease4::FLAG_HWADDR;
+const uint8_t CompactLease4::FLAG_FQDN_FWD;
+const uint8_t CompactLease4::FLAG_FQDN_REV;
+
+CompactLease4::CompactLease4()
+    : client_id_(NULL), hostname_(NULL), addr_(0), subnet_id_(0),
+      valid_lft_(0), cltt_(0), t1_(0), t2_(0), state_(0), hwaddr_source_(0),
+      htype_(0), hwaddr_len_(0), flags_(0) {
+    memset(hwaddr_, 0, sizeof(hwaddr_));
+}
+
+CompactLease4::CompactLease4(const Lease4& lease,
+                             const InternPool::Value* client_id,
+                             const InternPool::Value* hostname)
+    : client_id_(client_id), hostname_(hostname),
+      addr_(lease.addr_.toUint32()), subnet_id_(lease.subnet_id_),
+      valid_lft_(lease.valid_lft_), cltt_(0), t1_(lease.t1_), t2_(lease.t2_),
+      state_(lease.state_), hwaddr_source_(0), htype_(0), hwaddr_len_(0),
+      flags_(0) {
+    const int64_t cltt = static_cast<int64_t>(lease.cltt_) - CLTT_EPOCH;
+    if ((cltt < std::numeric_limits<int32_t>::min()) ||
+        (cltt > std::numeric_limits<int32_t>::max())) {
+        isc_throw(OutOfRange, "client last transmission time "
+                  << lease.cltt_ << " of the lease for " << lease.addr_
+                  << " is out of range");
+    }
+    cltt_ = static_cast<int32_t>(cltt);
+
+    if (lease.hwaddr_) {
+        const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+        if (hwaddr.size() > HWAddr::MAX_HWADDR_LEN) {
+            isc_throw(BadValue, "hardware address of the lease for "
+                      << lease.addr_ << " is longer than "
+                      << HWAddr::MAX_HWADDR_LEN << " bytes");
+        }
+        flags_ |= FLAG_HWADDR;
+        htype_ = lease.hwaddr_->htype_;
+        hwaddr_source_ = lease.hwaddr_->source_;
+        hwaddr_len_ = static_cast<uint8_t>(hwaddr.size());
+        if (!hwaddr.empty()) {
+            memcpy(hwaddr_, &hwaddr[0], hwaddr.size());
+        }
+    }
+    if (lease.fqdn_fwd_) {
+        flags_ |= FLAG_FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        flags_ |= FLAG_FQDN_REV;
+    }
+}
+
+Lease4Ptr
+CompactLease4::toLease4() const {
+    HWAddrPtr hwaddr;
+    if (flags_ & FLAG_HWADDR) {
+        hwaddr.reset(new HWAddr(hwaddr_, hwaddr_len_, htype_));
+        hwaddr->source_ = hwaddr_source_;
+    }
+    BytesKey client_id = getClientIdKey();
+    Lease4Ptr lease(new Lease4(IOAddress(addr_), hwaddr, client_id.data_,
+                               client_id.size_, valid_lft_, t1_, t2_,
+                               getCltt(), subnet_id_,
+                               (flags_ & FLAG_FQDN_FWD) != 0,
+                               (flags_ & FLAG_FQDN_REV) != 0,
+                               hostname_ ? hostname_->first : std::string()));
+    lease->state_ = state_;
+    return (lease);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,266 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef COMPACT_LEASE4_H
+#define COMPACT_LEASE4_H
+
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <time.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Reference to a sequence of bytes used as an index key.
+///
+/// The keys of the compact lease storage indexes point into the stored
+/// records or into the interned values, so they don't copy the bytes.
+/// A key can be implicitly created from a vector, so the indexes can be
+/// searched with the identifiers held in @c HWAddr and @c ClientId
+/// objects. Keys are ordered like the vectors they refer to.
+struct BytesKey {
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the bytes.
+    /// @param size Number of bytes.
+    BytesKey(const uint8_t* data = NULL, const size_t size = 0)
+        : data_(data), size_(size) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param bytes Vector holding the bytes, which must outlive the key.
+    BytesKey(const std::vector<uint8_t>& bytes)
+        : data_(bytes.empty() ? NULL : &bytes[0]), size_(bytes.size()) {
+    }
+
+    /// @brief Compares the bytes lexicographically.
+    ///
+    /// @param other Key to compare with.
+    bool operator<(const BytesKey& other) const {
+        const size_t len = std::min(size_, other.size_);
+        const int cmp = (len > 0 ? memcmp(data_, other.data_, len) : 0);
+        return ((cmp < 0) || ((cmp == 0) && (size_ < other.size_)));
+    }
+
+    /// @brief Pointer to the bytes.
+    const uint8_t* data_;
+
+    /// @brief Number of bytes.
+    size_t size_;
+};
+
+/// @brief Pool of interned values.
+///
+/// The pool holds a single copy of each distinct value along with the
+/// number of references to it. The compact leases refer to client
+/// identifiers and hostnames held in pools, so identical values are
+/// shared and each lease only holds a pointer.
+///
+/// The pool doesn't count the references by itself: the owner of the
+/// pointers must release each pointer it acquired. Empty values are not
+/// interned and are represented by NULL pointers.
+class InternPool : public boost::noncopyable {
+public:
+
+    /// @brief Type of the container holding the values and their reference
+    /// counts.
+    typedef boost::unordered_map<std::string, uint32_t> ValueMap;
+
+    /// @brief Type of the interned value.
+    typedef ValueMap::value_type Value;
+
+    /// @brief Returns the interned copy of the value.
+    ///
+    /// @param value Value to be interned.
+    /// @return Pointer to the interned value, NULL if the value is empty.
+    const Value* acquire(const std::string& value);
+
+    /// @brief Returns the interned copy of the bytes.
+    ///
+    /// @param data Pointer to the bytes.
+    /// @param size Number of bytes.
+    /// @return Pointer to the interned value, NULL if the size is 0.
+    const Value* acquire(const uint8_t* data, const size_t size);
+
+    /// @brief Releases a reference to an interned value.
+    ///
+    /// The value is removed from the pool when its last reference is
+    /// released.
+    ///
+    /// @param value Pointer returned by @c acquire, may be NULL.
+    void release(const Value* value);
+
+    /// @brief Removes all values.
+    ///
+    /// All pointers to the values become invalid.
+    void clear() {
+        values_.clear();
+    }
+
+    /// @brief Returns the number of distinct values in the pool.
+    size_t size() const {
+        return (values_.size());
+    }
+
+private:
+
+    /// @brief Interned values and their reference counts.
+    ///
+    /// The elements of the map are not moved by insertions and erasures,
+    /// so the pointers to them remain valid.
+    ValueMap values_;
+};
+
+/// @brief Compact in-memory representation of a DHCPv4 lease.
+///
+/// The memfile backend holds millions of leases, each represented by a
+/// @c Lease4 object with its own @c HWAddr and @c ClientId objects and a
+/// hostname string, which take several hundred bytes per lease. This
+/// structure holds the same information in a fixed-size record:
+/// - the address is held as a 32-bit integer,
+/// - the hardware address is held inline,
+/// - the client identifier and the hostname are interned (see
+///   @ref InternPool),
+/// - the client last transmission time is held as a 32-bit offset
+///   relative to @ref CLTT_EPOCH.
+///
+/// The records are materialized into @c Lease4 objects by @ref toLease4
+/// when returned by the lease manager. They are created and destroyed by
+/// the storage which owns the interned values.
+struct CompactLease4 {
+
+    /// @brief Epoch of the client last transmission times: 2000-01-01.
+    ///
+    /// The offset covers the years 1932 to 2068.
+    static const int64_t CLTT_EPOCH = 946684800;
+
+    /// @brief Constructor.
+    ///
+    /// Creates a record with all fields zeroed, to be filled in by the
+    /// reader of a lease snapshot.
+    CompactLease4();
+
+    /// @brief Constructor.
+    ///
+    /// @param lease Lease to be represented.
+    /// @param client_id Interned client identifier, NULL if none.
+    /// @param hostname Interned hostname, NULL if none.
+    /// @throw BadValue if the hardware address is longer than
+    /// @c HWAddr::MAX_HWADDR_LEN.
+    /// @throw OutOfRange if the client last transmission time can't be
+    /// represented.
+    CompactLease4(const Lease4& lease, const InternPool::Value* client_id,
+                  const InternPool::Value* hostname);
+
+    /// @brief Creates the @c Lease4 object represented by this record.
+    ///
+    /// @return Pointer to a new lease object.
+    Lease4Ptr toLease4() const;
+
+    /// @brief Returns the client last transmission time.
+    time_t getCltt() const {
+        return (static_cast<time_t>(CLTT_EPOCH + cltt_));
+    }
+
+    /// @brief Returns the expiration time of the lease.
+    int64_t getExpirationTime() const {
+        return (CLTT_EPOCH + cltt_ + valid_lft_);
+    }
+
+    /// @brief Indicates if the lease is in the "expired-reclaimed" state.
+    bool stateExpiredReclaimed() const {
+        return (state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    }
+
+    /// @brief Returns the hardware address key.
+    ///
+    /// A lease without hardware address has an empty key, like in
+    /// @c Lease::getHWAddrVector.
+    BytesKey getHWAddrKey() const {
+        return (BytesKey(hwaddr_, hwaddr_len_));
+    }
+
+    /// @brief Returns the client identifier key.
+    ///
+    /// A lease without client identifier has an empty key, like in
+    /// @c Lease4::getClientIdVector.
+    BytesKey getClientIdKey() const {
+        return (client_id_ ? toKey(*client_id_) : BytesKey());
+    }
+
+    /// @brief Returns the bytes of an interned value as a key.
+    ///
+    /// @param value Interned value.
+    static BytesKey toKey(const InternPool::Value& value) {
+        return (BytesKey(reinterpret_cast<const uint8_t*>(value.first.data()),
+                         value.first.size()));
+    }
+
+    /// @brief Interned client identifier, NULL if none.
+    const InternPool::Value* client_id_;
+
+    /// @brief Interned hostname, NULL if empty.
+    const InternPool::Value* hostname_;
+
+    /// @brief IPv4 address.
+    uint32_t addr_;
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+
+    /// @brief Client last transmission time relative to @ref CLTT_EPOCH.
+    int32_t cltt_;
+
+    /// @brief Renewal timer.
+    uint32_t t1_;
+
+    /// @brief Rebinding timer.
+    uint32_t t2_;
+
+    /// @brief Lease state.
+    uint32_t state_;
+
+    /// @brief Source of the hardware address.
+    uint32_t hwaddr_source_;
+
+    /// @brief Hardware type.
+    uint16_t htype_;
+
+    /// @brief Length of the hardware address.
+    uint8_t hwaddr_len_;
+
+    /// @brief Flags: hardware address presence and FQDN directions.
+    uint8_t flags_;
+
+    /// @brief Hardware address.
+    uint8_t hwaddr_[HWAddr::MAX_HWADDR_LEN];
+
+    /// @name Bits of the flags.
+    //@{
+    static const uint8_t FLAG_HWADDR = 0x01;
+    static const uint8_t FLAG_FQDN_FWD = 0x02;
+    static const uint8_t FLAG_FQDN_REV = 0x04;
+    //@}
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // COMPACT_LEASE4_H
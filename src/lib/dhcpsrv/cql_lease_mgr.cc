@@ -1580,6 +1580,44 @@ CqlLeaseMgr::getLeases6(Lease::Type lease_type,
     return (result);
 }
 
+Lease4Collection
+CqlLeaseMgr::getLeases4(SubnetID /*subnet_id*/) const {
+    isc_throw(NotImplemented, "getLeases4(subnet_id) is not implemented for "
+              "Cassandra backend");
+}
+
+Lease4Collection
+CqlLeaseMgr::getLeases4() const {
+    isc_throw(NotImplemented, "getLeases4() is not implemented for "
+              "Cassandra backend");
+}
+
+Lease4Collection
+CqlLeaseMgr::getLeases4(const asiolink::IOAddress& /*lower_bound_address*/,
+                        const LeasePageSize& /*page_size*/) const {
+    isc_throw(NotImplemented, "getLeases4(lower_bound_address, page_size) is "
+              "not implemented for Cassandra backend");
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6(SubnetID /*subnet_id*/) const {
+    isc_throw(NotImplemented, "getLeases6(subnet_id) is not implemented for "
+              "Cassandra backend");
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6() const {
+    isc_throw(NotImplemented, "getLeases6() is not implemented for "
+              "Cassandra backend");
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6(const asiolink::IOAddress& /*lower_bound_address*/,
+                        const LeasePageSize& /*page_size*/) const {
+    isc_throw(NotImplemented, "getLeases6(lower_bound_address, page_size) is "
+              "not implemented for Cassandra backend");
+}
+
 void
 CqlLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
                                  const size_t max_leases) const {
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <dhcp/iface_mgr.h>
+#include <dhcp_ddns/ncr_tcp.h>
 #include <dhcp_ddns/ncr_udp.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
@@ -73,6 +74,19 @@ D2ClientMgr::setD2ClientConfig(D2ClientConfigPtr& new_config) {
                                                 new_config->getMaxQueueSize()));
                 break;
                 }
+            case dhcp_ddns::NCR_TCP: {
+                // Instantiate a new sender which sends the queued requests
+                // in batches over a persistent connection.
+                new_sender.reset(new dhcp_ddns::NameChangeTCPSender(
+                                                new_config->getSenderIp(),
+                                                new_config->getSenderPort(),
+                                                new_config->getServerIp(),
+                                                new_config->getServerPort(),
+                                                new_config->getNcrFormat(),
+                                                *this,
+                                                new_config->getMaxQueueSize()));
+                break;
+                }
             default:
                 // In theory you can't get here.
                 isc_throw(D2ClientError, "Invalid sender Protocol: "
@@ -381,6 +395,22 @@ D2ClientMgr::runReadyIO() {
     }
 
     name_change_sender_->runReadyIO();
+
+    // The sender may now wait for IO on a different descriptor, e.g. the
+    // TCP sender waits for the acknowledgement on its connection socket,
+    // so keep the registration with IfaceMgr up to date.
+    if (amSending() &&
+        (registered_select_fd_ != util::WatchSocket::SOCKET_NOT_VALID)) {
+        int select_fd = name_change_sender_->getSelectFd();
+        if (select_fd != registered_select_fd_) {
+            IfaceMgr::instance().deleteExternalSocket(registered_select_fd_);
+            registered_select_fd_ = select_fd;
+            IfaceMgr::instance().addExternalSocket(registered_select_fd_,
+                                                   boost::bind(&D2ClientMgr::
+                                                               runReadyIO,
+                                                               this));
+        }
+    }
 }
 
 };  // namespace dhcp
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -41,6 +41,12 @@ HostDataSourceFactory::getHostDataSourcePtr() {
     return (hostDataSourcePtr);
 }
 
+std::string&
+HostDataSourceFactory::getDbAccess() {
+    static std::string dbaccess;
+    return (dbaccess);
+}
+
 void
 HostDataSourceFactory::create(const std::string& dbaccess) {
     // Parse the access string and create a redacted string for logging.
@@ -61,6 +67,7 @@ HostDataSourceFactory::create(const std::string& dbaccess) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_HOST_DB)
             .arg(DatabaseConnection::redactedAccessString(parameters));
         getHostDataSourcePtr().reset(new MySqlHostDataSource(parameters));
+        getDbAccess() = dbaccess;
         return;
     }
 #endif
@@ -70,6 +77,7 @@ HostDataSourceFactory::create(const std::string& dbaccess) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_HOST_DB)
             .arg(DatabaseConnection::redactedAccessString(parameters));
         getHostDataSourcePtr().reset(new PgSqlHostDataSource(parameters));
+        getDbAccess() = dbaccess;
         return;
     }
 #endif
@@ -95,6 +103,12 @@ HostDataSourceFactory::destroy() {
             .arg(getHostDataSourcePtr()->getType());
     }
     getHostDataSourcePtr().reset();
+    getDbAccess().clear();
+}
+
+bool
+HostDataSourceFactory::isCurrent(const std::string& dbaccess) {
+    return (getHostDataSourcePtr() && (getDbAccess() == dbaccess));
 }
 
 #if 0
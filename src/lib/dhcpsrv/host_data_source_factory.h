@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -71,12 +71,27 @@ public:
     /// host data source is available.
     static void destroy();
 
+    /// @brief Checks if the current host data source was created with the
+    /// specified access string.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @return true if the host data source instance exists and was
+    /// created by @c create with the same access string, false otherwise.
+    static bool isCurrent(const std::string& dbaccess);
+
     /// @brief Hold pointer to host data source instance
     ///
     /// Holds a pointer to the singleton host data source.  The singleton
     /// is encapsulated in this method to avoid a "static initialization
     /// fiasco" if defined in an external static variable.
     static HostDataSourcePtr& getHostDataSourcePtr();
+
+private:
+    /// @brief Holds the access string of the current host data source.
+    ///
+    /// It is empty when there is no current host data source.
+    static std::string& getDbAccess();
 };
 
 
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <string>
@@ -27,9 +28,39 @@
 
 using namespace std;
 
+namespace {
+
+/// @brief Returns the value of an integer statistic or 0 if it doesn't exist.
+///
+/// @param name Name of the statistic.
+int64_t
+getIntegerStat(const std::string& name) {
+    isc::stats::ObservationPtr stat =
+        isc::stats::StatsMgr::instance().getObservation(name);
+    if (!stat) {
+        return (0);
+    }
+    return (stat->getInteger().first);
+}
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace dhcp {
 
+LeasePageSize::LeasePageSize(const size_t page_size)
+    : page_size_(page_size) {
+
+    if (page_size_ == 0) {
+        isc_throw(OutOfRange, "page size of retrieved leases must not be 0");
+    }
+
+    if (page_size_ > std::numeric_limits<uint32_t>::max()) {
+        isc_throw(OutOfRange, "page size of retrieved leases must not be greater than "
+                  << std::numeric_limits<uint32_t>::max());
+    }
+}
+
 Lease6Ptr
 LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
                     uint32_t iaid, SubnetID subnet_id) const {
@@ -111,6 +142,57 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    LeaseStatsQueryPtr query = startLeaseStatsQuery4();
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The global value includes the previous count of the subnet.
+    const std::string declined_name =
+        StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+    const int64_t old_declined = getIntegerStat(declined_name);
+
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-addresses"),
+                       zero);
+    stats_mgr.setValue(declined_name, zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-declined-addresses"),
+                       zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+
+    // The rows are ordered by subnet id, so stop past the subnet.
+    int64_t declined = 0;
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        if (row.subnet_id_ < subnet_id) {
+            continue;
+        } else if (row.subnet_id_ > subnet_id) {
+            break;
+        }
+        if (row.lease_state_ == Lease::STATE_DEFAULT) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+        } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+            stats_mgr.setValue(declined_name, row.state_count_);
+            declined = row.state_count_;
+        }
+    }
+
+    stats_mgr.addValue("declined-addresses", declined - old_declined);
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery4() {
     return(LeaseStatsQueryPtr());
@@ -213,6 +295,67 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    LeaseStatsQueryPtr query = startLeaseStatsQuery6();
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The global value includes the previous count of the subnet.
+    const std::string declined_name =
+        StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+    const int64_t old_declined = getIntegerStat(declined_name);
+
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-nas"),
+                       zero);
+    stats_mgr.setValue(declined_name, zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-declined-addresses"),
+                       zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-pds"),
+                       zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+
+    // The rows are ordered by subnet id, so stop past the subnet.
+    int64_t declined = 0;
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        if (row.subnet_id_ < subnet_id) {
+            continue;
+        } else if (row.subnet_id_ > subnet_id) {
+            break;
+        }
+        if (row.lease_state_ != Lease::STATE_DEFAULT) {
+            if ((row.lease_type_ == Lease::TYPE_NA) &&
+                (row.lease_state_ == Lease::STATE_DECLINED)) {
+                stats_mgr.setValue(declined_name, row.state_count_);
+                declined = row.state_count_;
+            }
+        } else if (row.lease_type_ == Lease::TYPE_NA) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-nas"),
+                               row.state_count_);
+        } else if (row.lease_type_ == Lease::TYPE_PD) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                      "assigned-pds"),
+                               row.state_count_);
+        }
+    }
+
+    stats_mgr.addValue("declined-addresses", declined - old_declined);
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
@@ -226,6 +226,24 @@ public:
 /// @brief Defines a pointer to an LeaseStatsQuery.
 typedef boost::shared_ptr<LeaseStatsQuery> LeaseStatsQueryPtr;
 
+/// @brief Wraps value holding size of the page with leases.
+///
+/// The paging functions of the @c LeaseMgr return at most this number
+/// of leases. The wrapper prevents accidental use of the page size in
+/// place of other integer arguments.
+class LeasePageSize {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param page_size page size value.
+    /// @throw OutOfRange if page size is 0 or greater than uint32_t numeric
+    /// limit.
+    explicit LeasePageSize(const size_t page_size);
+
+    const size_t page_size_; ///< Holds page size.
+};
+
 /// @brief Abstract Lease Manager
 ///
 /// This is an abstract API for lease database backends. It provides unified
@@ -412,6 +430,75 @@ public:
     Lease6Ptr getLease6(Lease::Type type, const DUID& duid,
                         uint32_t iaid, SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const = 0;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4() const = 0;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// This method implements paged browsing of the lease database. The first
+    /// parameter specifies a page size. The second parameter is optional and
+    /// specifies the starting address of the range. This address is excluded
+    /// from the returned range. The IPv4 zero address (default) denotes that
+    /// the first page should be returned. There is no guarantee about the
+    /// order of returned leases.
+    ///
+    /// The typical usage of this method is as follows:
+    /// - Get the first page of leases by specifying IPv4 zero address as the
+    ///   beginning of the range.
+    /// - Last address of the returned range should be used as a starting
+    ///   address for the next page in the subsequent call.
+    /// - If the number of leases returned is lower than the page size, it
+    ///   indicates that the last page has been retrieved.
+    /// - If there are no leases returned it indicates that the previous page
+    ///   was the last page.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw InvalidAddressFamily if the lower bound is not an IPv4 address.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const = 0;
+
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const = 0;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6() const = 0;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// This method implements paged browsing of the lease database. See
+    /// the IPv4 variant of this method for the typical usage. The IPv6
+    /// zero address denotes that the first page should be returned.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw InvalidAddressFamily if the lower bound is not an IPv6 address.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const = 0;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -498,6 +585,18 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates the IPv4 lease stats of a single subnet
+    ///
+    /// This method recalculates the per-subnet statistics listed in
+    /// @ref recountLeaseStats4() for the given subnet only and adjusts the
+    /// global declined-addresses statistic by the difference with the
+    /// previous value of the subnet. It is used when a subnet is added or
+    /// replaced without a reconfiguration, so the statistics of the other
+    /// subnets are left untouched.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void recountLeaseStats4(const SubnetID& subnet_id);
+
     /// @brief Virtual method which creates and runs the IPv4 lease stats query
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -529,6 +628,16 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates the IPv6 lease stats of a single subnet
+    ///
+    /// This method recalculates the per-subnet statistics listed in
+    /// @ref recountLeaseStats6() for the given subnet only and adjusts the
+    /// global declined-addresses statistic by the difference with the
+    /// previous value of the subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void recountLeaseStats6(const SubnetID& subnet_id);
+
     /// @brief Virtual method which creates and runs the IPv6 lease stats query
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -595,6 +704,19 @@ public:
     /// Also if B>C, some database upgrade procedure may be triggered
     virtual std::pair<uint32_t, uint32_t> getVersion() const = 0;
 
+    /// @brief Start Transaction
+    ///
+    /// Starts a transaction grouping the subsequent database operations
+    /// until @c commit or @c rollback is called. On databases that don't
+    /// support transactions, this is a no-op and each operation takes
+    /// effect immediately.
+    ///
+    /// @return true if the transaction has been started, false if the
+    /// database doesn't support transactions.
+    virtual bool startTransaction() {
+        return (false);
+    }
+
     /// @brief Commit Transactions
     ///
     /// Commits all pending database operations.  On databases that don't
@@ -606,8 +728,21 @@ public:
     /// Rolls back all pending database operations.  On databases that don't
     /// support transactions, this is a no-op.
     virtual void rollback() = 0;
+
+    /// @brief Prepares the lease manager for a new server configuration.
+    ///
+    /// The server keeps the current lease manager when it is reconfigured
+    /// with an unchanged lease database configuration. This method is then
+    /// called to restore what the reconfiguration has reset, e.g. the
+    /// timers registered by the backend. The default implementation does
+    /// nothing.
+    virtual void reconfigure() {
+    }
 };
 
+/// @brief Pointer to the lease manager.
+typedef boost::shared_ptr<LeaseMgr> LeaseMgrPtr;
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -40,8 +40,32 @@ LeaseMgrFactory::getLeaseMgrPtr() {
     return (leaseMgrPtr);
 }
 
+std::string&
+LeaseMgrFactory::getDbAccess() {
+    static std::string dbaccess;
+    return (dbaccess);
+}
+
 void
 LeaseMgrFactory::create(const std::string& dbaccess) {
+    getLeaseMgrPtr().reset(createLeaseMgr(dbaccess));
+    getDbAccess() = dbaccess;
+}
+
+LeaseMgrPtr
+LeaseMgrFactory::createStandalone(const std::string& dbaccess) {
+    return (LeaseMgrPtr(createLeaseMgr(dbaccess)));
+}
+
+bool
+LeaseMgrFactory::supportsStandalone(const std::string& dbaccess) {
+    DatabaseConnection::ParameterMap parameters = DatabaseConnection::parse(dbaccess);
+    DatabaseConnection::ParameterMap::const_iterator type = parameters.find("type");
+    return ((type != parameters.end()) && (type->second != "memfile"));
+}
+
+LeaseMgr*
+LeaseMgrFactory::createLeaseMgr(const std::string& dbaccess) {
     const std::string type = "type";
 
     // Parse the access string and create a redacted string for logging.
@@ -60,28 +84,24 @@ LeaseMgrFactory::create(const std::string& dbaccess) {
 #ifdef HAVE_MYSQL
     if (parameters[type] == string("mysql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new MySqlLeaseMgr(parameters));
-        return;
+        return (new MySqlLeaseMgr(parameters));
     }
 #endif
 #ifdef HAVE_PGSQL
     if (parameters[type] == string("postgresql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new PgSqlLeaseMgr(parameters));
-        return;
+        return (new PgSqlLeaseMgr(parameters));
     }
 #endif
 #ifdef HAVE_CQL
     if (parameters[type] == string("cql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_CQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new CqlLeaseMgr(parameters));
-        return;
+        return (new CqlLeaseMgr(parameters));
     }
 #endif
     if (parameters[type] == string("memfile")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new Memfile_LeaseMgr(parameters));
-        return;
+        return (new Memfile_LeaseMgr(parameters));
     }
 
     // Get here on no match
@@ -99,6 +119,7 @@ LeaseMgrFactory::destroy() {
             .arg(getLeaseMgrPtr()->getType());
     }
     getLeaseMgrPtr().reset();
+    getDbAccess().clear();
 }
 
 bool 
@@ -106,6 +127,11 @@ LeaseMgrFactory::haveInstance() {
     return (getLeaseMgrPtr().get());
 }
 
+bool
+LeaseMgrFactory::isCurrent(const std::string& dbaccess) {
+    return (haveInstance() && (getDbAccess() == dbaccess));
+}
+
 LeaseMgr&
 LeaseMgrFactory::instance() {
     LeaseMgr* lmptr = getLeaseMgrPtr().get();
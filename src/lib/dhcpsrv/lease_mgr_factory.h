@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -69,6 +69,38 @@ public:
     ///        identify a supported backend.
     static void create(const std::string& dbaccess);
 
+    /// @brief Create a standalone instance of a lease manager.
+    ///
+    /// This method creates a lease manager of the type specified in the
+    /// access string, but unlike @c create it doesn't replace the "current"
+    /// lease manager. The returned instance is owned by the caller. It is
+    /// used by the components which need their own connection to the lease
+    /// database, e.g. to query the database from a thread other than the
+    /// one processing DHCP packets.
+    ///
+    /// @note The in-memory backend keeps all leases in the process memory
+    /// and can't share them between instances. The caller should use this
+    /// method only for the backends for which @c supportsStandalone returns
+    /// true.
+    ///
+    /// @param dbaccess Database access parameters, as for @c create.
+    ///
+    /// @return Pointer to the new lease manager instance.
+    /// @throw isc::InvalidParameter dbaccess string does not contain the "type"
+    ///        keyword.
+    /// @throw isc::dhcp::InvalidType The "type" keyword in dbaccess does not
+    ///        identify a supported backend.
+    static LeaseMgrPtr createStandalone(const std::string& dbaccess);
+
+    /// @brief Checks if standalone lease managers can be created for the
+    /// specified database.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @return true if the backend specified in the access string keeps
+    /// leases in an external database, false otherwise.
+    static bool supportsStandalone(const std::string& dbaccess);
+
     /// @brief Destroy lease manager
     ///
     /// Destroys the current lease manager object.  This should have the effect
@@ -90,6 +122,19 @@ public:
     /// @return True if the lease manager instance exists, false otherwise.
     static bool haveInstance();
 
+    /// @brief Checks if the current lease manager was created with the
+    /// specified access string.
+    ///
+    /// This is used on reconfiguration to keep the lease manager, its
+    /// database connection or its in-memory leases, when the lease
+    /// database configuration is unchanged.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @return true if the lease manager instance exists and was created
+    /// by @c create with the same access string, false otherwise.
+    static bool isCurrent(const std::string& dbaccess);
+
 private:
     /// @brief Hold pointer to lease manager
     ///
@@ -98,6 +143,23 @@ private:
     /// fiasco" if defined in an external static variable.
     static boost::scoped_ptr<LeaseMgr>& getLeaseMgrPtr();
 
+    /// @brief Holds the access string of the current lease manager.
+    ///
+    /// It is empty when there is no current lease manager.
+    static std::string& getDbAccess();
+
+    /// @brief Creates a lease manager of the type specified in the access
+    /// string.
+    ///
+    /// This is a common implementation for @c create and
+    /// @c createStandalone.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @return Pointer to the new lease manager instance. The caller is
+    /// responsible for deleting it.
+    static LeaseMgr* createLeaseMgr(const std::string& dbaccess);
+
 };
 
 }; // end of isc::dhcp namespace
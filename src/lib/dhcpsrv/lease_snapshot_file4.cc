@@ -0,0 +1,359 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/lease_snapshot_file4.h>
+#include <util/buffer.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc::util;
+
+namespace {
+
+/// @brief Size of the snapshot header.
+const size_t HEADER_SIZE = 40;
+
+/// @brief Amount of encoded records buffered before they are written.
+const size_t WRITE_BUFFER_SIZE = 65536;
+
+/// @brief Identification of the lease file mirrored by a snapshot.
+struct LeaseFileId {
+    uint64_t inode_;
+    uint64_t size_;
+    uint64_t mtime_;
+
+    bool operator==(const LeaseFileId& other) const {
+        return ((inode_ == other.inode_) && (size_ == other.size_) &&
+                (mtime_ == other.mtime_));
+    }
+};
+
+/// @brief Retrieves the identification of a file.
+///
+/// @param file_name Name of the file.
+/// @param [out] id Identification of the file.
+/// @return true on success, false if the file can't be stat'ed.
+bool
+getLeaseFileId(const std::string& file_name, LeaseFileId& id) {
+    struct stat st;
+    if (stat(file_name.c_str(), &st) != 0) {
+        return (false);
+    }
+    id.inode_ = static_cast<uint64_t>(st.st_ino);
+    id.size_ = static_cast<uint64_t>(st.st_size);
+    id.mtime_ = static_cast<uint64_t>(st.st_mtime);
+    return (true);
+}
+
+void
+writeUint64(OutputBuffer& buf, const uint64_t value) {
+    buf.writeUint32(static_cast<uint32_t>(value >> 32));
+    buf.writeUint32(static_cast<uint32_t>(value));
+}
+
+uint64_t
+readUint64(InputBuffer& buf) {
+    const uint64_t high = buf.readUint32();
+    return ((high << 32) | buf.readUint32());
+}
+
+/// @brief Encodes the snapshot header.
+///
+/// @param buf Buffer.
+/// @param id Identification of the mirrored lease file.
+/// @param count Number of leases.
+void
+writeHeader(OutputBuffer& buf, const LeaseFileId& id, const uint64_t count) {
+    buf.writeUint32(isc::dhcp::LeaseSnapshotFile4::MAGIC);
+    buf.writeUint16(isc::dhcp::LeaseSnapshotFile4::FORMAT_VERSION);
+    buf.writeUint16(0);
+    writeUint64(buf, id.inode_);
+    writeUint64(buf, id.size_);
+    writeUint64(buf, id.mtime_);
+    writeUint64(buf, count);
+}
+
+/// @brief Read-only memory mapping of a file, unmapped on destruction.
+class MappedFile : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param file_name Name of the file.
+    /// @throw LeaseSnapshotError if the file exists but can't be mapped.
+    MappedFile(const std::string& file_name)
+        : data_(NULL), size_(0), exists_(false) {
+        int fd = open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            if (errno == ENOENT) {
+                return;
+            }
+            isc_throw(isc::dhcp::LeaseSnapshotError, "unable to open "
+                      << file_name << ": " << strerror(errno));
+        }
+        exists_ = true;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            const int err = errno;
+            close(fd);
+            isc_throw(isc::dhcp::LeaseSnapshotError, "unable to stat "
+                      << file_name << ": " << strerror(err));
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                const int err = errno;
+                close(fd);
+                isc_throw(isc::dhcp::LeaseSnapshotError, "unable to map "
+                          << file_name << ": " << strerror(err));
+            }
+            data_ = data;
+            // The records are read once, in order.
+            static_cast<void>(madvise(data_, size_, MADV_SEQUENTIAL));
+        }
+        close(fd);
+    }
+
+    /// @brief Destructor.
+    ~MappedFile() {
+        if (data_) {
+            munmap(data_, size_);
+        }
+    }
+
+    /// @brief Mapped contents.
+    void* data_;
+
+    /// @brief Size of the file.
+    size_t size_;
+
+    /// @brief Indicates if the file exists.
+    bool exists_;
+};
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const uint32_t LeaseSnapshotFile4::MAGIC;
+const uint16_t LeaseSnapshotFile4::FORMAT_VERSION;
+
+uint64_t
+LeaseSnapshotFile4::write(const std::string& lease_file,
+                          const std::string& snapshot_file) {
+    LeaseFileId id;
+    if (!getLeaseFileId(lease_file, id)) {
+        isc_throw(LeaseSnapshotError, "unable to stat " << lease_file
+                  << ": " << strerror(errno));
+    }
+
+    const std::string tmp_file = snapshot_file + ".tmp";
+    std::ofstream out(tmp_file.c_str(), std::ios::out | std::ios::binary |
+                      std::ios::trunc);
+    if (!out.good()) {
+        isc_throw(LeaseSnapshotError, "unable to create " << tmp_file);
+    }
+
+    uint64_t count = 0;
+    try {
+        CSVLeaseFile4 csv(lease_file);
+        csv.open();
+
+        // The header is rewritten with the number of leases at the end.
+        OutputBuffer buf(WRITE_BUFFER_SIZE + 512);
+        writeHeader(buf, id, 0);
+
+        uint32_t last_addr = 0;
+        Lease4Ptr lease;
+        while (true) {
+            if (!csv.next(lease)) {
+                isc_throw(LeaseSnapshotError, "unable to read a lease from "
+                          << lease_file << ": " << csv.getReadMsg());
+            }
+            if (!lease) {
+                break;
+            }
+            const CompactLease4 record(*lease, NULL, NULL);
+            if (((count > 0) && (record.addr_ <= last_addr)) ||
+                (record.valid_lft_ == 0)) {
+                isc_throw(LeaseSnapshotError, lease_file << " is not a"
+                          " cleaned-up lease file: unexpected entry for "
+                          << lease->addr_);
+            }
+            last_addr = record.addr_;
+
+            buf.writeUint32(record.addr_);
+            buf.writeUint32(record.subnet_id_);
+            buf.writeUint32(record.valid_lft_);
+            buf.writeUint32(static_cast<uint32_t>(record.cltt_));
+            buf.writeUint32(record.t1_);
+            buf.writeUint32(record.t2_);
+            buf.writeUint32(record.state_);
+            buf.writeUint32(record.hwaddr_source_);
+            buf.writeUint16(record.htype_);
+            buf.writeUint8(record.flags_);
+            buf.writeUint8(record.hwaddr_len_);
+            if (record.hwaddr_len_ > 0) {
+                buf.writeData(record.hwaddr_, record.hwaddr_len_);
+            }
+            const std::vector<uint8_t>& client_id = lease->getClientIdVector();
+            if ((client_id.size() > 0xffff) ||
+                (lease->hostname_.size() > 0xffff)) {
+                isc_throw(LeaseSnapshotError, "client identifier or hostname"
+                          " of the lease for " << lease->addr_
+                          << " is too long");
+            }
+            buf.writeUint16(static_cast<uint16_t>(client_id.size()));
+            if (!client_id.empty()) {
+                buf.writeData(&client_id[0], client_id.size());
+            }
+            buf.writeUint16(static_cast<uint16_t>(lease->hostname_.size()));
+            if (!lease->hostname_.empty()) {
+                buf.writeData(lease->hostname_.data(),
+                              lease->hostname_.size());
+            }
+            ++count;
+
+            if (buf.getLength() >= WRITE_BUFFER_SIZE) {
+                out.write(static_cast<const char*>(buf.getData()),
+                          buf.getLength());
+                buf.clear();
+            }
+        }
+        csv.close();
+        if (buf.getLength() > 0) {
+            out.write(static_cast<const char*>(buf.getData()),
+                      buf.getLength());
+        }
+
+        buf.clear();
+        writeHeader(buf, id, count);
+        out.seekp(0);
+        out.write(static_cast<const char*>(buf.getData()), buf.getLength());
+        out.close();
+        if (out.fail()) {
+            isc_throw(LeaseSnapshotError, "unable to write " << tmp_file);
+        }
+
+        if (rename(tmp_file.c_str(), snapshot_file.c_str()) != 0) {
+            isc_throw(LeaseSnapshotError, "unable to move " << tmp_file
+                      << " to " << snapshot_file << ": " << strerror(errno));
+        }
+
+    } catch (const LeaseSnapshotError&) {
+        out.close();
+        static_cast<void>(remove(tmp_file.c_str()));
+        throw;
+
+    } catch (const std::exception& ex) {
+        out.close();
+        static_cast<void>(remove(tmp_file.c_str()));
+        isc_throw(LeaseSnapshotError, "unable to create the snapshot of "
+                  << lease_file << ": " << ex.what());
+    }
+
+    return (count);
+}
+
+bool
+LeaseSnapshotFile4::load(const std::string& lease_file,
+                         const std::string& snapshot_file,
+                         CompactLease4Storage& storage) {
+    MappedFile snapshot(snapshot_file);
+    LeaseFileId id;
+    if (!snapshot.exists_ || !getLeaseFileId(lease_file, id)) {
+        return (false);
+    }
+
+    try {
+        InputBuffer buf(snapshot.data_, snapshot.size_);
+        if (buf.getLength() < HEADER_SIZE) {
+            isc_throw(LeaseSnapshotError, "truncated header");
+        }
+        if (buf.readUint32() != MAGIC) {
+            isc_throw(LeaseSnapshotError, "not a lease snapshot file");
+        }
+        const uint16_t version = buf.readUint16();
+        if (version != FORMAT_VERSION) {
+            isc_throw(LeaseSnapshotError, "unsupported version " << version);
+        }
+        buf.readUint16();
+        LeaseFileId snapshot_id;
+        snapshot_id.inode_ = readUint64(buf);
+        snapshot_id.size_ = readUint64(buf);
+        snapshot_id.mtime_ = readUint64(buf);
+        if (!(snapshot_id == id)) {
+            return (false);
+        }
+        const uint64_t count = readUint64(buf);
+
+        const uint8_t* data = static_cast<const uint8_t*>(snapshot.data_);
+        for (uint64_t i = 0; i < count; ++i) {
+            CompactLease4 record;
+            record.addr_ = buf.readUint32();
+            record.subnet_id_ = buf.readUint32();
+            record.valid_lft_ = buf.readUint32();
+            record.cltt_ = static_cast<int32_t>(buf.readUint32());
+            record.t1_ = buf.readUint32();
+            record.t2_ = buf.readUint32();
+            record.state_ = buf.readUint32();
+            record.hwaddr_source_ = buf.readUint32();
+            record.htype_ = buf.readUint16();
+            record.flags_ = buf.readUint8();
+            record.hwaddr_len_ = buf.readUint8();
+            if (record.hwaddr_len_ > sizeof(record.hwaddr_)) {
+                isc_throw(LeaseSnapshotError, "invalid hardware address"
+                          " length " << static_cast<int>(record.hwaddr_len_));
+            }
+            buf.readData(record.hwaddr_, record.hwaddr_len_);
+            // The client identifier and the hostname are interned from
+            // the mapped bytes.
+            const size_t client_id_len = buf.readUint16();
+            const uint8_t* client_id = data + buf.getPosition();
+            buf.setPosition(buf.getPosition() + client_id_len);
+            const size_t hostname_len = buf.readUint16();
+            const uint8_t* hostname = data + buf.getPosition();
+            buf.setPosition(buf.getPosition() + hostname_len);
+
+            if (!storage.append(record, client_id, client_id_len, hostname,
+                                hostname_len)) {
+                isc_throw(LeaseSnapshotError, "duplicate lease for "
+                          << asiolink::IOAddress(record.addr_));
+            }
+        }
+        if (buf.getPosition() != buf.getLength()) {
+            isc_throw(LeaseSnapshotError, "unexpected data after "
+                      << count << " leases");
+        }
+
+    } catch (const LeaseSnapshotError& ex) {
+        isc_throw(LeaseSnapshotError, "invalid lease snapshot "
+                  << snapshot_file << ": " << ex.getMessage());
+
+    } catch (const isc::util::InvalidBufferPosition&) {
+        isc_throw(LeaseSnapshotError, "invalid lease snapshot "
+                  << snapshot_file << ": truncated");
+    }
+
+    return (true);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,101 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_SNAPSHOT_FILE4_H
+#define LEASE_SNAPSHOT_FILE4_H
+
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <exceptions/exceptions.h>
+
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Exception thrown when a lease snapshot file can't be written
+/// or is invalid.
+class LeaseSnapshotError : public Exception {
+public:
+    LeaseSnapshotError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Binary snapshot of a DHCPv4 lease file.
+///
+/// When the server starts, the memfile backend loads the leases by parsing
+/// the lease files written by the %Lease File Cleanup (LFC) and replaying
+/// the lease updates appended since then. With millions of leases, parsing
+/// the CSV fields of the LFC output takes most of the startup time.
+///
+/// The snapshot holds the same leases as a cleaned-up lease file in a
+/// binary form: each lease is a record of fixed-size fields in network
+/// byte order, followed by the hardware address, the client identifier
+/// and the hostname bytes. The file is memory mapped when loaded and the
+/// records are inserted in the @c CompactLease4Storage in the address
+/// order, without creating @c Lease4 objects.
+///
+/// The snapshot header records the inode number, the size and the
+/// modification time of the lease file it was created from. These are
+/// preserved by the renames of the LFC file rotation (the output file
+/// becomes the finish file, then the previous file), so the snapshot is
+/// used only for the lease file it mirrors and ignored otherwise, e.g.
+/// if the LFC failed after writing the lease file but before writing
+/// the snapshot.
+///
+/// The file layout (version 1) is:
+/// - header: magic (32 bits), version (16 bits), reserved (16 bits),
+///   lease file inode, size and modification time, number of leases
+///   (64 bits each),
+/// - for each lease: address, subnet identifier, valid lifetime, client
+///   last transmission time relative to @c CompactLease4::CLTT_EPOCH, T1,
+///   T2, state, hardware address source (32 bits each), hardware type
+///   (16 bits), flags and hardware address length (8 bits each), the
+///   hardware address, the client identifier length (16 bits) and bytes,
+///   the hostname length (16 bits) and bytes.
+class LeaseSnapshotFile4 {
+public:
+
+    /// @brief Magic number at the beginning of the snapshot files.
+    static const uint32_t MAGIC = 0x4b4c5334;
+
+    /// @brief Version of the snapshot file layout.
+    static const uint16_t FORMAT_VERSION = 1;
+
+    /// @brief Creates the snapshot of a cleaned-up lease file.
+    ///
+    /// The snapshot is written to a temporary file which is renamed once
+    /// complete, so an existing snapshot is replaced atomically.
+    ///
+    /// @param lease_file Name of the lease file, which must have been
+    /// written by the LFC: each address appears once, in increasing
+    /// order, with a non-zero valid lifetime.
+    /// @param snapshot_file Name of the snapshot file.
+    /// @return Number of leases written.
+    /// @throw LeaseSnapshotError if the lease file can't be read or is not
+    /// a cleaned-up lease file, or if the snapshot can't be written.
+    static uint64_t write(const std::string& lease_file,
+                          const std::string& snapshot_file);
+
+    /// @brief Loads the snapshot of a lease file.
+    ///
+    /// @param lease_file Name of the lease file the snapshot must mirror.
+    /// @param snapshot_file Name of the snapshot file.
+    /// @param [out] storage Storage to which the leases are added. It
+    /// should be empty.
+    /// @return true if the leases were loaded, false if the snapshot
+    /// doesn't exist or doesn't mirror the lease file.
+    /// @throw LeaseSnapshotError if the snapshot is invalid. Some leases
+    /// may have been added to the storage.
+    static bool load(const std::string& lease_file,
+                     const std::string& snapshot_file,
+                     CompactLease4Storage& storage);
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // LEASE_SNAPSHOT_FILE4_H
@@ -8,6 +8,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/lease_snapshot_file4.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcpsrv/database_connection.h>
@@ -15,6 +16,7 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <util/stopwatch.h>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
@@ -36,6 +38,13 @@ const uint32_t MAX_LEASE_ERRORS = 100;
 /// Kea installation directory.
 const char* KEA_LFC_EXECUTABLE_ENV_NAME = "KEA_LFC_EXECUTABLE";
 
+/// @brief Maximum number of leases of each lease file held in memory by
+/// the kea-lfc program.
+///
+/// The kea-lfc is run with the -m option, so the memory it uses is bounded
+/// by the chunk size rather than by the size of the lease files.
+const size_t LFC_LEASES_PER_CHUNK = 100000;
+
 } // end of anonymous namespace
 
 using namespace isc::util;
@@ -101,6 +110,9 @@ public:
     /// @brief Returns exit code of the last completed cleanup.
     int getExitStatus() const;
 
+    /// @brief Returns the command line of the cleanup process.
+    std::string getCommandLine() const;
+
 private:
 
     /// @brief A pointer to the @c ProcessSpawn object used to execute
@@ -198,6 +210,17 @@ LFCSetup::setup(const uint32_t lfc_interval,
     args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
                                                   Memfile_LeaseMgr::FILE_PID));
 
+    // Snapshot file, only supported for the DHCPv4 leases.
+    if (lease_file4) {
+        args.push_back("-s");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_SNAPSHOT));
+    }
+
+    // Merge the files in chunks to bound the memory used.
+    args.push_back("-m");
+    args.push_back(boost::lexical_cast<std::string>(LFC_LEASES_PER_CHUNK));
+
     // The configuration file is currently unused.
     args.push_back("-c");
     args.push_back("ignored-path");
@@ -250,6 +273,15 @@ LFCSetup::getExitStatus() const {
     return (process_->getExitStatus(pid_));
 }
 
+std::string
+LFCSetup::getCommandLine() const {
+    if (!process_) {
+        isc_throw(InvalidOperation, "unable to obtain LFC command line: "
+                  " the process is NULL");
+    }
+    return (process_->getCommandLine());
+}
+
 
 /// @brief Base Memfile derivation of the statistical lease data query
 ///
@@ -303,19 +335,19 @@ protected:
 /// @brief Memfile derivation of the IPv4 statistical lease data query
 ///
 /// This class is used to recalculate IPv4 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  Rather than iterating over the storage, it copies the
+/// per subnet lease state counters which the backend maintains as the
+/// leases are added, updated and deleted.  The populated result set will
+/// contain one entry per monitored state per subnet having leases in
+/// this state.
 ///
 class MemfileLeaseStatsQuery4 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-    : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param counters4 The lease state counters of the v4 lease storage
+    MemfileLeaseStatsQuery4(const LeaseStateCounters& counters4)
+    : MemfileLeaseStatsQuery(), counters4_(counters4) {
     };
 
     /// @brief Destructor
@@ -323,92 +355,52 @@ public:
 
     /// @brief Creates the IPv4 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv4 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts are
-    /// used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per subnet.
+    /// The counters are ordered by subnet id, so the rows are appended
+    /// to the result set in ascending order by subnet id.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     void start() {
-        const Lease4StorageAddressIndex& idx
-            = storage4_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        for(Lease4StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                ++declined;
+        const LeaseStateCounters::CounterMap& counters =
+            counters4_.getCounters();
+        for (LeaseStateCounters::CounterMap::const_iterator counter =
+                 counters.begin(); counter != counters.end(); ++counter) {
+            const uint32_t state = counter->first.get<2>();
+            if ((state == Lease::STATE_DEFAULT) ||
+                (state == Lease::STATE_DECLINED)) {
+                rows_.push_back(LeaseStatsRow(counter->first.get<0>(), state,
+                                              counter->second));
             }
         }
 
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                          declined));
-        }
-
         // Set the next row position to the beginning of the rows.
         next_pos_ = rows_.begin();
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv4 leases to analyze
-    Lease4Storage& storage4_;
+    /// @brief The lease state counters of the IPv4 leases
+    const LeaseStateCounters& counters4_;
 };
 
 
 /// @brief Memfile derivation of the IPv6 statistical lease data query
 ///
 /// This class is used to recalculate IPv6 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  Rather than iterating over the storage, it copies the
+/// per subnet lease state counters which the backend maintains as the
+/// leases are added, updated and deleted.  The populated result set will
+/// contain one entry per monitored state per lease type per subnet having
+/// leases in this state.
 ///
 class MemfileLeaseStatsQuery6 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param counters6 The lease state counters of the v6 lease storage
+    MemfileLeaseStatsQuery6(const LeaseStateCounters& counters6)
+        : MemfileLeaseStatsQuery(), counters6_(counters6) {
     };
 
     /// @brief Destructor
@@ -416,100 +408,35 @@ public:
 
     /// @brief Creates the IPv6 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv6 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts
-    /// are used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per lease type per subnet.
+    /// The counters are ordered by subnet id, so the rows are appended
+    /// to the result set in ascending order by subnet id.
     ///
     /// Currently the states counted are:
     ///
-    /// - Lease::STATE_DEFAULT (i.e. assigned)
-    /// - Lease::STATE_DECLINED
+    /// - Lease::STATE_DEFAULT (i.e. assigned) of the NA and PD leases
+    /// - Lease::STATE_DECLINED of the NA leases
     virtual void start() {
-        // Get the subnet_id index
-        const Lease6StorageAddressIndex& idx
-            = storage6_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        int64_t assigned_pds = 0;
-
-        for(Lease6StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned_pds));
-                    assigned_pds = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
-                case Lease::TYPE_NA:
-                    ++assigned;
-                    break;
-                case Lease::TYPE_PD:
-                    ++assigned_pds;
-                    break;
-                default:
-                    break;
-                }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
-                    ++declined;
-                }
+        const LeaseStateCounters::CounterMap& counters =
+            counters6_.getCounters();
+        for (LeaseStateCounters::CounterMap::const_iterator counter =
+                 counters.begin(); counter != counters.end(); ++counter) {
+            const Lease::Type type = counter->first.get<1>();
+            const uint32_t state = counter->first.get<2>();
+            if (((state == Lease::STATE_DEFAULT) &&
+                 ((type == Lease::TYPE_NA) || (type == Lease::TYPE_PD))) ||
+                ((state == Lease::STATE_DECLINED) && (type == Lease::TYPE_NA))) {
+                rows_.push_back(LeaseStatsRow(counter->first.get<0>(), type,
+                                              state, counter->second));
             }
         }
 
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                          Lease::STATE_DECLINED,
-                                          declined));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                          Lease::STATE_DEFAULT,
-                                          assigned_pds));
-        }
-
         // Set the next row position to the beginning of the rows.
         next_pos_ = rows_.begin();
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv6 leases to analyze
-    Lease6Storage& storage6_;
+    /// @brief The lease state counters of the IPv6 leases
+    const LeaseStateCounters& counters6_;
 };
 
 // Explicit definition of class static constants.  Values are given in the
@@ -532,6 +459,9 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                                 lease_file4_,
                                                                 storage4_);
         }
+        // Count the loaded leases once. From now on, the counters are
+        // updated as the leases are modified.
+        counters4_.recount(storage4_);
     } else {
         std::string file6 = initLeaseFilePath(V6);
         if (!file6.empty()) {
@@ -540,6 +470,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                                 lease_file6_,
                                                                 storage6_);
         }
+        counters6_.recount(storage6_);
     }
 
     // If lease persistence have been disabled for both v4 and v6,
@@ -595,6 +526,7 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
     }
 
     storage4_.insert(lease);
+    counters4_.add(*lease);
     return (true);
 }
 
@@ -616,6 +548,7 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
     }
 
     storage6_.insert(lease);
+    counters6_.add(*lease);
     return (true);
 }
 
@@ -624,12 +557,11 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
-    const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    Lease4StorageAddressIndex::iterator l = idx.find(addr);
-    if (l == idx.end()) {
+    CompactLease4Storage::const_iterator l = storage4_.find(addr);
+    if (l == storage4_.end()) {
         return (Lease4Ptr());
     } else {
-        return (Lease4Ptr(new Lease4(**l)));
+        return (l->toLease4());
     }
 }
 
@@ -641,14 +573,14 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
 
     // Using composite index by 'hw address' and 'subnet id'. It is
     // ok to use it for searching by the 'hw address' only.
-    const Lease4StorageHWAddressSubnetIdIndex& idx =
+    const CompactLease4StorageHWAddressSubnetIdIndex& idx =
         storage4_.get<HWAddressSubnetIdIndexTag>();
-    std::pair<Lease4StorageHWAddressSubnetIdIndex::const_iterator,
-              Lease4StorageHWAddressSubnetIdIndex::const_iterator> l
+    std::pair<CompactLease4StorageHWAddressSubnetIdIndex::const_iterator,
+              CompactLease4StorageHWAddressSubnetIdIndex::const_iterator> l
         = idx.equal_range(boost::make_tuple(hwaddr.hwaddr_));
 
     for(auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease4());
     }
 
     return (collection);
@@ -661,10 +593,10 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
         .arg(hwaddr.toText());
 
     // Get the index by HW Address and Subnet Identifier.
-    const Lease4StorageHWAddressSubnetIdIndex& idx =
+    const CompactLease4StorageHWAddressSubnetIdIndex& idx =
         storage4_.get<HWAddressSubnetIdIndexTag>();
     // Try to find the lease using HWAddr and subnet id.
-    Lease4StorageHWAddressSubnetIdIndex::const_iterator lease =
+    CompactLease4StorageHWAddressSubnetIdIndex::const_iterator lease =
         idx.find(boost::make_tuple(hwaddr.hwaddr_, subnet_id));
     // Lease was not found. Return empty pointer to the caller.
     if (lease == idx.end()) {
@@ -672,7 +604,7 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     }
 
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease4());
 }
 
 Lease4Collection
@@ -682,14 +614,14 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
     Lease4Collection collection;
     // Using composite index by 'client id' and 'subnet id'. It is ok
     // to use it to search by 'client id' only.
-    const Lease4StorageClientIdSubnetIdIndex& idx =
+    const CompactLease4StorageClientIdSubnetIdIndex& idx =
         storage4_.get<ClientIdSubnetIdIndexTag>();
-    std::pair<Lease4StorageClientIdSubnetIdIndex::const_iterator,
-              Lease4StorageClientIdSubnetIdIndex::const_iterator> l
+    std::pair<CompactLease4StorageClientIdSubnetIdIndex::const_iterator,
+              CompactLease4StorageClientIdSubnetIdIndex::const_iterator> l
         = idx.equal_range(boost::make_tuple(client_id.getClientId()));
 
     for(auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease4());
     }
 
     return (collection);
@@ -705,10 +637,10 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                                                         .arg(subnet_id);
 
     // Get the index by client id, HW address and subnet id.
-    const Lease4StorageClientIdHWAddressSubnetIdIndex& idx =
+    const CompactLease4StorageClientIdHWAddressSubnetIdIndex& idx =
         storage4_.get<ClientIdHWAddressSubnetIdIndexTag>();
     // Try to get the lease using client id, hardware address and subnet id.
-    Lease4StorageClientIdHWAddressSubnetIdIndex::const_iterator lease =
+    CompactLease4StorageClientIdHWAddressSubnetIdIndex::const_iterator lease =
         idx.find(boost::make_tuple(client_id.getClientId(), hwaddr.hwaddr_,
                                    subnet_id));
 
@@ -718,7 +650,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
     }
 
     // Lease was found. Return it to the caller.
-    return (*lease);
+    return (lease->toLease4());
 }
 
 Lease4Ptr
@@ -729,17 +661,79 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
               .arg(client_id.toText());
 
     // Get the index by client and subnet id.
-    const Lease4StorageClientIdSubnetIdIndex& idx =
+    const CompactLease4StorageClientIdSubnetIdIndex& idx =
         storage4_.get<ClientIdSubnetIdIndexTag>();
     // Try to get the lease using client id and subnet id.
-    Lease4StorageClientIdSubnetIdIndex::const_iterator lease =
+    CompactLease4StorageClientIdSubnetIdIndex::const_iterator lease =
         idx.find(boost::make_tuple(client_id.getClientId(), subnet_id));
     // Lease was not found. Return empty pointer to the caller.
     if (lease == idx.end()) {
         return (Lease4Ptr());
     }
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease4());
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID4)
+        .arg(subnet_id);
+
+    const CompactLease4StorageSubnetIdIndex& idx =
+        storage4_.get<SubnetIdIndexTag>();
+    std::pair<CompactLease4StorageSubnetIdIndex::const_iterator,
+              CompactLease4StorageSubnetIdIndex::const_iterator> l =
+        idx.equal_range(subnet_id);
+
+    Lease4Collection collection;
+    for (CompactLease4StorageSubnetIdIndex::const_iterator lease = l.first;
+         lease != l.second; ++lease) {
+        collection.push_back(lease->toLease4());
+    }
+
+    return (collection);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET4);
+
+    Lease4Collection collection;
+    for (CompactLease4Storage::const_iterator lease = storage4_.begin();
+         lease != storage4_.end(); ++lease) {
+        collection.push_back(lease->toLease4());
+    }
+
+    return (collection);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                             const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidAddressFamily, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    const CompactLease4StorageAddressIndex& idx =
+        storage4_.get<AddressIndexTag>();
+    CompactLease4StorageAddressIndex::const_iterator lease =
+        idx.upper_bound(lower_bound_address.toUint32());
+
+    Lease4Collection collection;
+    for (; (lease != idx.end()) && (collection.size() < page_size.page_size_);
+         ++lease) {
+        collection.push_back(lease->toLease4());
+    }
+
+    return (collection);
 }
 
 Lease6Ptr
@@ -810,6 +804,66 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
     return (collection);
 }
 
+Lease6Collection
+Memfile_LeaseMgr::getLeases6(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID6)
+        .arg(subnet_id);
+
+    const Lease6StorageSubnetIdIndex& idx = storage6_.get<SubnetIdIndexTag>();
+    std::pair<Lease6StorageSubnetIdIndex::const_iterator,
+              Lease6StorageSubnetIdIndex::const_iterator> l =
+        idx.equal_range(subnet_id);
+
+    Lease6Collection collection;
+    for (Lease6StorageSubnetIdIndex::const_iterator lease = l.first;
+         lease != l.second; ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+
+    return (collection);
+}
+
+Lease6Collection
+Memfile_LeaseMgr::getLeases6() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET6);
+
+    Lease6Collection collection;
+    for (Lease6Storage::const_iterator lease = storage6_.begin();
+         lease != storage6_.end(); ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+
+    return (collection);
+}
+
+Lease6Collection
+Memfile_LeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                             const LeasePageSize& page_size) const {
+    // Expecting IPv6 address.
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidAddressFamily, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE6)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    const Lease6StorageAddressIndex& idx = storage6_.get<AddressIndexTag>();
+    Lease6StorageAddressIndex::const_iterator lease =
+        idx.upper_bound(lower_bound_address);
+
+    Lease6Collection collection;
+    for (; (lease != idx.end()) && (collection.size() < page_size.page_size_);
+         ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+
+    return (collection);
+}
+
 void
 Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
                                     const size_t max_leases) const {
@@ -842,21 +896,22 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
         .arg(max_leases);
 
     // Obtain the index which segragates leases by state and time.
-    const Lease4StorageExpirationIndex& index = storage4_.get<ExpirationIndexTag>();
+    const CompactLease4StorageExpirationIndex& index =
+        storage4_.get<ExpirationIndexTag>();
 
     // Retrieve leases which are not reclaimed and which haven't expired. The
     // 'less-than' operator will be used for both components of the index. So,
     // for the 'state' 'false' is less than 'true'. Also the leases with
     // expiration time lower than current time will be returned.
-    Lease4StorageExpirationIndex::const_iterator ub =
+    CompactLease4StorageExpirationIndex::const_iterator ub =
         index.upper_bound(boost::make_tuple(false, time(NULL)));
 
     // Copy only the number of leases indicated by the max_leases parameter.
-    for (Lease4StorageExpirationIndex::const_iterator lease = index.begin();
+    for (CompactLease4StorageExpirationIndex::const_iterator lease = index.begin();
          (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
                                                  max_leases));
          ++lease) {
-        expired_leases.push_back(Lease4Ptr(new Lease4(**lease)));
+        expired_leases.push_back(lease->toLease4());
     }
 }
 
@@ -865,12 +920,9 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR4).arg(lease->addr_.toText());
 
-    // Obtain 'by address' index.
-    Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
-
     // Lease must exist if it is to be updated.
-    Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
-    if (lease_it == index.end()) {
+    CompactLease4Storage::const_iterator lease_it = storage4_.find(lease->addr_);
+    if (lease_it == storage4_.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
     }
@@ -882,8 +934,12 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    // Use replace() to re-index leases. The lease may have been moved to
+    // another state or subnet, so the counters are adjusted for both the
+    // old and the new lease.
+    counters4_.remove(*lease_it);
+    storage4_.replace(lease_it, *lease);
+    counters4_.add(*lease);
 }
 
 void
@@ -908,8 +964,12 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    // Use replace() to re-index leases.
+    // Use replace() to re-index leases. The lease may have been moved to
+    // another state or subnet, so the counters are adjusted for both the
+    // old and the new lease.
+    counters6_.remove(**lease_it);
     index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    counters6_.add(*lease);
 }
 
 bool
@@ -918,20 +978,21 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(addr.toText());
     if (addr.isV4()) {
         // v4 lease
-        Lease4Storage::iterator l = storage4_.find(addr);
+        CompactLease4Storage::const_iterator l = storage4_.find(addr);
         if (l == storage4_.end()) {
             // No such lease
             return (false);
         } else {
             if (persistLeases(V4)) {
-                // Copy the lease. The valid lifetime needs to be modified and
-                // we don't modify the original lease.
-                Lease4 lease_copy = **l;
+                // Materialize the lease. The valid lifetime needs to be
+                // modified.
+                Lease4Ptr lease_copy = l->toLease4();
                 // Setting valid lifetime to 0 means that lease is being
                 // removed.
-                lease_copy.valid_lft_ = 0;
-                lease_file4_->append(lease_copy);
+                lease_copy->valid_lft_ = 0;
+                lease_file4_->append(*lease_copy);
             }
+            counters4_.remove(*l);
             storage4_.erase(l);
             return (true);
         }
@@ -953,6 +1014,7 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_file6_->append(lease_copy);
             }
 
+            counters6_.remove(**l);
             storage6_.erase(l);
             return (true);
         }
@@ -964,9 +1026,42 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
-    return (deleteExpiredReclaimedLeases<
-            Lease4StorageExpirationIndex, Lease4
-            >(secs, V4, storage4_, lease_file4_));
+
+    // Same as deleteExpiredReclaimedLeases() but the compact records are
+    // materialized for the lease file and erased through the storage,
+    // which releases their interned values.
+    const CompactLease4StorageExpirationIndex& index =
+        storage4_.get<ExpirationIndexTag>();
+    CompactLease4StorageExpirationIndex::const_iterator upper_limit =
+        index.upper_bound(boost::make_tuple(true, time(NULL) - secs));
+    CompactLease4StorageExpirationIndex::const_iterator lower_limit =
+        index.upper_bound(boost::make_tuple(true, std::numeric_limits<int64_t>::min()));
+
+    uint64_t num_leases = static_cast<uint64_t>(std::distance(lower_limit, upper_limit));
+    if (num_leases > 0) {
+
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED_START)
+            .arg(num_leases);
+
+        // Mark the leases as deleted in the lease file.
+        if (persistLeases(V4)) {
+            for (CompactLease4StorageExpirationIndex::const_iterator lease =
+                     lower_limit; lease != upper_limit; ++lease) {
+                Lease4Ptr lease_copy = lease->toLease4();
+                lease_copy->valid_lft_ = 0;
+                lease_file4_->append(*lease_copy);
+            }
+        }
+
+        // Update the counters and erase leases from memory.
+        for (CompactLease4StorageExpirationIndex::const_iterator lease =
+                 lower_limit; lease != upper_limit; ++lease) {
+            counters4_.remove(*lease);
+        }
+        storage4_.erase(lower_limit, upper_limit);
+    }
+    return (num_leases);
 }
 
 uint64_t
@@ -976,7 +1071,7 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
         .arg(secs);
     return (deleteExpiredReclaimedLeases<
             Lease6StorageExpirationIndex, Lease6
-            >(secs, V6, storage6_, lease_file6_));
+            >(secs, V6, storage6_, counters6_, lease_file6_));
 }
 
 template<typename IndexType, typename LeaseType, typename StorageType,
@@ -985,6 +1080,7 @@ uint64_t
 Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
                                                const Universe& universe,
                                                StorageType& storage,
+                                               LeaseStateCounters& counters,
                                                LeaseFileType& lease_file) const {
     // Obtain the index which segragates leases by state and time.
     IndexType& index = storage.template get<ExpirationIndexTag>();
@@ -1034,7 +1130,11 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
             }
         }
 
-        // Erase leases from memory.
+        // Update the counters and erase leases from memory.
+        for (typename IndexType::const_iterator lease = lower_limit;
+             lease != upper_limit; ++lease) {
+            counters.remove(**lease);
+        }
         index.erase(lower_limit, upper_limit);
     }
     // Return number of leases deleted.
@@ -1078,6 +1178,9 @@ Memfile_LeaseMgr::appendSuffix(const std::string& file_name,
     case FILE_PID:
         name += ".pid";
         break;
+    case FILE_SNAPSHOT:
+        name += ".snapshot";
+        break;
     default:
         // Do not append any suffix for the FILE_CURRENT.
         ;
@@ -1165,16 +1268,22 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
 
     // Load the leasefile.completed, if exists.
     bool conversion_needed = false;
+    // The leasefile.completed and the leasefile.2 are written by the LFC,
+    // which also writes their snapshot: load it instead when it mirrors
+    // the file.
     lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
     if (lease_file->exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                               MAX_LEASE_ERRORS);
-        conversion_needed = conversion_needed || lease_file->needsConversion();
+        if (!loadSnapshot(filename, lease_file->getFilename(), storage)) {
+            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
+                                                   MAX_LEASE_ERRORS);
+            conversion_needed = conversion_needed || lease_file->needsConversion();
+        }
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
         // from leasefile.2 and leasefile.1, if they exist.
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
-        if (lease_file->exists()) {
+        if (lease_file->exists() &&
+            !loadSnapshot(filename, lease_file->getFilename(), storage)) {
             LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
                                                    MAX_LEASE_ERRORS);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
@@ -1202,6 +1311,39 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     return (conversion_needed);
 }
 
+bool
+Memfile_LeaseMgr::loadSnapshot(const std::string& filename,
+                               const std::string& lease_file,
+                               CompactLease4Storage& storage) {
+    const std::string snapshot_file = appendSuffix(filename, FILE_SNAPSHOT);
+    try {
+        Stopwatch stopwatch;
+        if (!LeaseSnapshotFile4::load(lease_file, snapshot_file, storage)) {
+            // Don't mention the snapshots which don't exist.
+            CSVFile snapshot(snapshot_file);
+            if (snapshot.exists()) {
+                LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_SNAPSHOT_STALE)
+                    .arg(snapshot_file)
+                    .arg(lease_file);
+            }
+            return (false);
+        }
+        stopwatch.stop();
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_SNAPSHOT_LOADED)
+            .arg(storage.size())
+            .arg(snapshot_file)
+            .arg(stopwatch.logFormatLastDuration());
+
+    } catch (const std::exception& ex) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_SNAPSHOT_LOAD_FAILED)
+            .arg(snapshot_file)
+            .arg(ex.what())
+            .arg(lease_file);
+        storage.clear();
+        return (false);
+    }
+    return (true);
+}
 
 bool
 Memfile_LeaseMgr::isLFCRunning() const {
@@ -1213,6 +1355,16 @@ Memfile_LeaseMgr::getLFCExitStatus() const {
     return (lfc_setup_->getExitStatus());
 }
 
+std::string
+Memfile_LeaseMgr::getLFCCommandLine() const {
+    return (lfc_setup_->getCommandLine());
+}
+
+void
+Memfile_LeaseMgr::reconfigure() {
+    lfcSetup();
+}
+
 void
 Memfile_LeaseMgr::lfcCallback() {
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_START);
@@ -1311,14 +1463,14 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(counters4_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(counters6_));
     query->start();
     return(query);
 }
@@ -1328,22 +1480,23 @@ size_t Memfile_LeaseMgr::wipeLeases4(const SubnetID& subnet_id) {
         .arg(subnet_id);
 
     // Get the index by DUID, IAID, lease type.
-    const Lease4StorageSubnetIdIndex& idx = storage4_.get<SubnetIdIndexTag>();
+    const CompactLease4StorageSubnetIdIndex& idx =
+        storage4_.get<SubnetIdIndexTag>();
 
     // Try to get the lease using the DUID, IAID and lease type.
-    std::pair<Lease4StorageSubnetIdIndex::const_iterator,
-              Lease4StorageSubnetIdIndex::const_iterator> l =
+    std::pair<CompactLease4StorageSubnetIdIndex::const_iterator,
+              CompactLease4StorageSubnetIdIndex::const_iterator> l =
         idx.equal_range(subnet_id);
 
-    // Let's collect all leases.
-    Lease4Collection leases;
+    // Let's collect the addresses of all leases.
+    std::vector<uint32_t> addresses;
     for(auto lease = l.first; lease != l.second; ++lease) {
-        leases.push_back(*lease);
+        addresses.push_back(lease->addr_);
     }
 
-    size_t num = leases.size();
-    for (auto l = leases.begin(); l != leases.end(); ++l) {
-        deleteLease((*l)->addr_);
+    size_t num = addresses.size();
+    for (auto a = addresses.begin(); a != addresses.end(); ++a) {
+        deleteLease(isc::asiolink::IOAddress(*a));
     }
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES4_FINISHED)
         .arg(subnet_id).arg(num);
@@ -220,6 +220,36 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// This function returns copies of the leases. The modification in the
+    /// returned leases does not affect the instances held in the lease
+    /// storage.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// The leases are returned in ascending order by address, using the
+    /// range scan of the address index.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// This function returns a copy of the lease. The modification in the
@@ -259,6 +289,36 @@ public:
                                         uint32_t iaid,
                                         SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// This function returns copies of the leases. The modification in the
+    /// returned leases does not affect the instances held in the lease
+    /// storage.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The leases are returned in ascending order by address, using the
+    /// range scan of the address index.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -354,10 +414,11 @@ private:
 
     /// @brief Deletes all expired-reclaimed leases.
     ///
-    /// This private method is called by both of the public methods:
-    /// @c deleteExpiredReclaimedLeases4 and
+    /// This private method is called by the public method
     /// @c deleteExpiredReclaimedLeases6 to remove all expired
-    /// reclaimed DHCPv4 or DHCPv6 leases respectively.
+    /// reclaimed DHCPv6 leases. The DHCPv4 leases are held in the
+    /// @c CompactLease4Storage which erases the leases itself, so
+    /// @c deleteExpiredReclaimedLeases4 doesn't use this method.
     ///
     /// @param secs Number of seconds since expiration of leases before
     /// they can be removed. Leases which have expired later than this
@@ -365,6 +426,7 @@ private:
     /// @param universe V4 or V6.
     /// @param storage Reference to the container where leases are held.
     /// Some expired-reclaimed leases will be removed from this container.
+    /// @param counters Lease state counters associated with the storage.
     /// @param lease_file Reference to a DHCPv4 or DHCPv6 lease file
     /// instance where leases should be marked as deleted.
     ///
@@ -372,10 +434,10 @@ private:
     ///
     /// @tparam IndexType Index type to be used to search for the
     /// expired-reclaimed leases, i.e.
-    /// @c Lease4StorageExpirationIndex or @c Lease6StorageExpirationIndex.
-    /// @tparam LeaseType Lease type, i.e. @c Lease4 or @c Lease6.
+    /// @c Lease6StorageExpirationIndex.
+    /// @tparam LeaseType Lease type, i.e. @c Lease6.
     /// @tparam StorageType Type of storage where leases are held, i.e.
-    /// @c Lease4Storage or @c Lease6Storage.
+    /// @c Lease6Storage.
     /// @tparam LeaseFileType Type of the lease file, i.e. DHCPv4 or
     /// DHCPv6 lease file type.
     template<typename IndexType, typename LeaseType, typename StorageType,
@@ -383,6 +445,7 @@ private:
     uint64_t deleteExpiredReclaimedLeases(const uint32_t secs,
                                           const Universe& universe,
                                           StorageType& storage,
+                                          LeaseStateCounters& counters,
                                           LeaseFileType& lease_file) const;
 
 public:
@@ -447,7 +510,8 @@ public:
         FILE_PREVIOUS, ///< Previous %Lease File
         FILE_OUTPUT,   ///< LFC Output File
         FILE_FINISH,   ///< LFC Finish File
-        FILE_PID       ///< PID File
+        FILE_PID,      ///< PID File
+        FILE_SNAPSHOT  ///< Binary snapshot of the Previous %Lease File
     };
 
     /// @brief Appends appropriate suffix to the file name.
@@ -460,6 +524,7 @@ public:
     /// - LFC Output File: ".output"
     /// - LFC Finish File: ".completed"
     /// - LFC PID File: ".pid"
+    /// - Snapshot File: ".snapshot"
     ///
     /// See http://kea.isc.org/wiki/LFCDesign for details.
     ///
@@ -549,6 +614,11 @@ private:
     /// products of the lease file cleanups (LFC).
     /// See: http://kea.isc.org/wiki/LFCDesign for details.
     ///
+    /// The DHCPv4 leases of the <filename>.completed or <filename>.2 are
+    /// loaded from the <filename>.snapshot when it mirrors that file (see
+    /// @ref loadSnapshot), so only the lease updates appended since the
+    /// last LFC are parsed.
+    ///
     /// @note: When the server starts up or is reconfigured it will try to
     /// read leases from the lease files using this method. It is possible
     /// that the %Lease File Cleanup is performed upon the lease files to
@@ -570,7 +640,7 @@ private:
     /// @param storage A storage for leases read from the lease file.
     /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
-    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    /// @tparam StorageType @c CompactLease4Storage or @c Lease6Storage.
     ///
     /// @return Returns true if any of the files loaded need conversion from
     /// an older or newer schema.
@@ -583,12 +653,50 @@ private:
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
+    /// @brief Loads the DHCPv4 leases from the snapshot of a lease file.
+    ///
+    /// The snapshot is written by the LFC along with the cleaned-up lease
+    /// file. It is used instead of the lease file only when it mirrors it:
+    /// a missing, stale or invalid snapshot is ignored and the caller
+    /// loads the lease file.
+    ///
+    /// @param filename Name of the lease file used by the server.
+    /// @param lease_file Name of the cleaned-up lease file (the finish or
+    /// the previous file) the snapshot must mirror.
+    /// @param storage An empty storage for the leases.
+    /// @return true if the leases were loaded from the snapshot, false
+    /// otherwise. In that case the storage is empty.
+    bool loadSnapshot(const std::string& filename,
+                      const std::string& lease_file,
+                      CompactLease4Storage& storage);
+
+    /// @brief Snapshots are not supported for the DHCPv6 leases.
+    ///
+    /// @return false.
+    bool loadSnapshot(const std::string&, const std::string&,
+                      Lease6Storage&) {
+        return (false);
+    }
+
     /// @brief stores IPv4 leases
-    Lease4Storage storage4_;
+    ///
+    /// The leases are held in the compact form and materialized into
+    /// @c Lease4 objects when returned to the caller.
+    CompactLease4Storage storage4_;
 
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
 
+    /// @brief Number of IPv4 leases per subnet and lease state.
+    ///
+    /// It is updated whenever the @c storage4_ is modified.
+    LeaseStateCounters counters4_;
+
+    /// @brief Number of IPv6 leases per subnet, lease type and lease state.
+    ///
+    /// It is updated whenever the @c storage6_ is modified.
+    LeaseStateCounters counters6_;
+
     /// @brief Holds the pointer to the DHCPv4 lease file IO.
     boost::shared_ptr<CSVLeaseFile4> lease_file4_;
 
@@ -611,13 +719,17 @@ public:
     /// @brief Returns the status code returned by the last executed
     /// LFC process.
     int getLFCExitStatus() const;
+
+    /// @brief Returns the command line of the LFC process.
+    std::string getLFCCommandLine() const;
     //@}
 
     /// @brief Creates and runs the IPv4 lease stats query
     ///
     /// It creates an instance of a MemfileLeaseStatsQuery4 and then
     /// invokes its start method in which the query constructs its
-    /// statistical data result set.  The query object is then returned.
+    /// statistical data result set from the lease state counters
+    /// maintained by the backend.  The query object is then returned.
     ///
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
@@ -626,11 +738,19 @@ public:
     ///
     /// It creates an instance of a MemfileLeaseStatsQuery6 and then
     /// invokes its start method in which the query constructs its
-    /// statistical data result set.  The query object is then returned.
+    /// statistical data result set from the lease state counters
+    /// maintained by the backend.  The query object is then returned.
     ///
     /// @return The populated query as a pointer to an LeaseStatsQuery.
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Sets up the %Lease File Cleanup again after a reconfiguration.
+    ///
+    /// The leases and the lease file are kept as they are. Only the LFC
+    /// timer, which the server unregisters with the other timers when it
+    /// is reconfigured, is registered again.
+    virtual void reconfigure();
+
     /// @name Protected methods used for %Lease File Cleanup.
     /// The following methods are protected so as they can be accessed and
     /// tested by unit tests.
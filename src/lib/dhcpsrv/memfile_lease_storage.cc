@@ -0,0 +1,117 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/memfile_lease_storage.h>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+CompactLease4Storage::const_iterator
+CompactLease4Storage::find(const IOAddress& addr) const {
+    if (!addr.isV4()) {
+        return (records_.end());
+    }
+    return (records_.find(addr.toUint32()));
+}
+
+std::pair<CompactLease4Storage::iterator, bool>
+CompactLease4Storage::insert(const Lease4& lease) {
+    CompactLease4 record = makeRecord(lease);
+    std::pair<iterator, bool> result;
+    try {
+        result = records_.insert(record);
+    } catch (...) {
+        releaseRecord(record);
+        throw;
+    }
+    if (!result.second) {
+        releaseRecord(record);
+    }
+    return (result);
+}
+
+bool
+CompactLease4Storage::replace(const_iterator position, const Lease4& lease) {
+    CompactLease4 record = makeRecord(lease);
+    // The replaced record is copied as its references are released only
+    // once it has been replaced.
+    const CompactLease4 old_record = *position;
+    bool replaced = false;
+    try {
+        replaced = records_.replace(position, record);
+    } catch (...) {
+        releaseRecord(record);
+        throw;
+    }
+    releaseRecord(replaced ? old_record : record);
+    return (replaced);
+}
+
+bool
+CompactLease4Storage::append(CompactLease4 record, const uint8_t* client_id,
+                             const size_t client_id_len,
+                             const uint8_t* hostname,
+                             const size_t hostname_len) {
+    record.client_id_ = client_ids_.acquire(client_id, client_id_len);
+    record.hostname_ = hostnames_.acquire(hostname, hostname_len);
+    const size_t size = records_.size();
+    try {
+        records_.insert(records_.end(), record);
+    } catch (...) {
+        releaseRecord(record);
+        throw;
+    }
+    if (records_.size() == size) {
+        releaseRecord(record);
+        return (false);
+    }
+    return (true);
+}
+
+void
+CompactLease4Storage::erase(const_iterator position) {
+    const CompactLease4 record = *position;
+    records_.erase(position);
+    releaseRecord(record);
+}
+
+void
+CompactLease4Storage::clear() {
+    records_.clear();
+    client_ids_.clear();
+    hostnames_.clear();
+}
+
+CompactLease4
+CompactLease4Storage::makeRecord(const Lease4& lease) {
+    const InternPool::Value* client_id = NULL;
+    if (lease.client_id_) {
+        const std::vector<uint8_t>& bytes = lease.client_id_->getClientId();
+        client_id = client_ids_.acquire(bytes.empty() ? NULL : &bytes[0],
+                                        bytes.size());
+    }
+    const InternPool::Value* hostname = hostnames_.acquire(lease.hostname_);
+    try {
+        return (CompactLease4(lease, client_id, hostname));
+    } catch (...) {
+        client_ids_.release(client_id);
+        hostnames_.release(hostname);
+        throw;
+    }
+}
+
+void
+CompactLease4Storage::releaseRecord(const CompactLease4& record) {
+    client_ids_.release(record.client_id_);
+    hostnames_.release(record.hostname_);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
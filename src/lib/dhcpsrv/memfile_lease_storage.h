@@ -8,6 +8,7 @@
 #define MEMFILE_LEASE_STORAGE_H
 
 #include <asiolink/io_address.h>
+#include <dhcpsrv/compact_lease4.h>
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/subnet_id.h>
 
@@ -17,7 +18,11 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
 
+#include <map>
 #include <vector>
 
 namespace isc {
@@ -272,6 +277,393 @@ Lease4StorageClientIdHWAddressSubnetIdIndex;
 typedef Lease4Storage::index<SubnetIdIndexTag>::type Lease4StorageSubnetIdIndex;
 
 //@}
+
+/// @brief A multi index container holding the compact DHCPv4 leases.
+///
+/// It has the same indexes as @c Lease4Storage. The keys are extracted
+/// from the compact records: the addresses are 32-bit integers and the
+/// identifiers are @c BytesKey objects, which can be compared with the
+/// vectors held in @c HWAddr and @c ClientId objects.
+typedef boost::multi_index_container<
+    // It holds compact records.
+    CompactLease4,
+    // Specification of search indexes starts here.
+    boost::multi_index::indexed_by<
+        // This index sorts leases by IPv4 addresses represented as
+        // 32-bit integers.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<AddressIndexTag>,
+            boost::multi_index::member<CompactLease4, uint32_t,
+                                       &CompactLease4::addr_>
+        >,
+
+        // This index combines the hardware address and subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                CompactLease4,
+                boost::multi_index::const_mem_fun<CompactLease4, BytesKey,
+                                                  &CompactLease4::getHWAddrKey>,
+                boost::multi_index::member<CompactLease4, SubnetID,
+                                           &CompactLease4::subnet_id_>
+            >
+        >,
+
+        // This index combines the client id and subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ClientIdSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                CompactLease4,
+                boost::multi_index::const_mem_fun<CompactLease4, BytesKey,
+                                                  &CompactLease4::getClientIdKey>,
+                boost::multi_index::member<CompactLease4, SubnetID,
+                                           &CompactLease4::subnet_id_>
+            >
+        >,
+
+        // This index combines the client id, hardware address and
+        // subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ClientIdHWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                CompactLease4,
+                boost::multi_index::const_mem_fun<CompactLease4, BytesKey,
+                                                  &CompactLease4::getClientIdKey>,
+                boost::multi_index::const_mem_fun<CompactLease4, BytesKey,
+                                                  &CompactLease4::getHWAddrKey>,
+                boost::multi_index::member<CompactLease4, SubnetID,
+                                           &CompactLease4::subnet_id_>
+            >
+        >,
+
+        // This index segregates the leases by state (reclaimed or not)
+        // and expiration time.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ExpirationIndexTag>,
+            boost::multi_index::composite_key<
+                CompactLease4,
+                boost::multi_index::const_mem_fun<CompactLease4, bool,
+                                                  &CompactLease4::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<CompactLease4, int64_t,
+                                                  &CompactLease4::getExpirationTime>
+            >
+        >,
+
+        // This index sorts leases by SubnetID.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdIndexTag>,
+            boost::multi_index::member<CompactLease4, SubnetID,
+                                       &CompactLease4::subnet_id_>
+        >
+    >
+> CompactLease4Container;
+
+/// @name Indexes used by the compact DHCPv4 lease storage.
+///
+//@{
+
+/// @brief Compact DHCPv4 lease storage index by address.
+typedef CompactLease4Container::index<AddressIndexTag>::type
+CompactLease4StorageAddressIndex;
+
+/// @brief Compact DHCPv4 lease storage index by expiration time.
+typedef CompactLease4Container::index<ExpirationIndexTag>::type
+CompactLease4StorageExpirationIndex;
+
+/// @brief Compact DHCPv4 lease storage index by HW address and subnet
+/// identifier.
+typedef CompactLease4Container::index<HWAddressSubnetIdIndexTag>::type
+CompactLease4StorageHWAddressSubnetIdIndex;
+
+/// @brief Compact DHCPv4 lease storage index by client and subnet
+/// identifier.
+typedef CompactLease4Container::index<ClientIdSubnetIdIndexTag>::type
+CompactLease4StorageClientIdSubnetIdIndex;
+
+/// @brief Compact DHCPv4 lease storage index by client id, HW address and
+/// subnet id.
+typedef CompactLease4Container::index<ClientIdHWAddressSubnetIdIndexTag>::type
+CompactLease4StorageClientIdHWAddressSubnetIdIndex;
+
+/// @brief Compact DHCPv4 lease storage index by subnet id.
+typedef CompactLease4Container::index<SubnetIdIndexTag>::type
+CompactLease4StorageSubnetIdIndex;
+
+//@}
+
+/// @brief Storage of the DHCPv4 leases in the compact form.
+///
+/// This is the DHCPv4 lease storage of the Memfile backend. It holds the
+/// leases as @c CompactLease4 records and owns the pools of the interned
+/// client identifiers and hostnames. The records are modified only through
+/// this class, which maintains the references to the interned values, and
+/// are read through the indexes returned by @c get.
+///
+/// The storage provides the subset of the @c Lease4Storage interface used
+/// by the @c LeaseFileLoader, so the leases can be loaded directly into
+/// it without holding the @c Lease4 objects in memory.
+class CompactLease4Storage : public boost::noncopyable {
+public:
+
+    /// @brief Iterator over the records ordered by address.
+    typedef CompactLease4Container::iterator iterator;
+
+    /// @brief Constant iterator over the records ordered by address.
+    typedef CompactLease4Container::const_iterator const_iterator;
+
+    /// @brief Returns the index with the specified tag.
+    ///
+    /// @tparam Tag Tag of the index, e.g. @c AddressIndexTag.
+    template<typename Tag>
+    const typename CompactLease4Container::template index<Tag>::type&
+    get() const {
+        return (records_.template get<Tag>());
+    }
+
+    /// @brief Returns the iterator to the first record by address.
+    const_iterator begin() const {
+        return (records_.begin());
+    }
+
+    /// @brief Returns the iterator past the last record by address.
+    const_iterator end() const {
+        return (records_.end());
+    }
+
+    /// @brief Returns the number of leases.
+    size_t size() const {
+        return (records_.size());
+    }
+
+    /// @brief Returns the number of distinct client identifiers.
+    size_t getClientIdCount() const {
+        return (client_ids_.size());
+    }
+
+    /// @brief Returns the number of distinct non-empty hostnames.
+    size_t getHostnameCount() const {
+        return (hostnames_.size());
+    }
+
+    /// @brief Searches the lease by address.
+    ///
+    /// @param addr Address of the lease.
+    /// @return Iterator to the record, @c end() if not found or if the
+    /// address is not an IPv4 address.
+    const_iterator find(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Inserts a lease.
+    ///
+    /// @param lease Lease to be inserted.
+    /// @return Pair of the iterator to the record with the address of the
+    /// lease and a flag indicating if the lease was inserted.
+    std::pair<iterator, bool> insert(const Lease4& lease);
+
+    /// @brief Inserts a lease.
+    ///
+    /// @param lease Pointer to the lease to be inserted.
+    std::pair<iterator, bool> insert(const Lease4Ptr& lease) {
+        return (insert(*lease));
+    }
+
+    /// @brief Replaces a lease, re-indexing the record.
+    ///
+    /// @param position Iterator to the record to be replaced.
+    /// @param lease New lease.
+    /// @return true if the record was replaced, false if this would have
+    /// created a duplicate address.
+    bool replace(const_iterator position, const Lease4& lease);
+
+    /// @brief Replaces a lease, re-indexing the record.
+    ///
+    /// @param position Iterator to the record to be replaced.
+    /// @param lease Pointer to the new lease.
+    bool replace(const_iterator position, const Lease4Ptr& lease) {
+        return (replace(position, *lease));
+    }
+
+    /// @brief Appends a record after the record with the highest address.
+    ///
+    /// This is used to build the storage from the records of a snapshot,
+    /// which are ordered by address: the insertion in the address index
+    /// doesn't search the position.
+    ///
+    /// @param record Record with no interned values.
+    /// @param client_id Client identifier bytes.
+    /// @param client_id_len Client identifier length, 0 if none.
+    /// @param hostname Hostname bytes.
+    /// @param hostname_len Hostname length, 0 if none.
+    /// @return true if the record was inserted, false if the address is
+    /// already in the storage.
+    bool append(CompactLease4 record, const uint8_t* client_id,
+                const size_t client_id_len, const uint8_t* hostname,
+                const size_t hostname_len);
+
+    /// @brief Removes a lease.
+    ///
+    /// @param position Iterator to the record to be removed.
+    void erase(const_iterator position);
+
+    /// @brief Removes a range of leases of any index.
+    ///
+    /// @param first Iterator to the first record to be removed.
+    /// @param last Iterator past the last record to be removed.
+    /// @tparam IteratorType Iterator type of one of the indexes.
+    template<typename IteratorType>
+    void erase(IteratorType first, const IteratorType& last) {
+        while (first != last) {
+            erase(records_.template project<0>(first++));
+        }
+    }
+
+    /// @brief Removes all leases.
+    void clear();
+
+private:
+
+    /// @brief Creates the record of a lease, acquiring the interned values.
+    ///
+    /// @param lease Lease.
+    CompactLease4 makeRecord(const Lease4& lease);
+
+    /// @brief Releases the interned values referenced by a record.
+    ///
+    /// @param record Record being discarded.
+    void releaseRecord(const CompactLease4& record);
+
+    /// @brief Pool of the client identifiers.
+    InternPool client_ids_;
+
+    /// @brief Pool of the hostnames.
+    InternPool hostnames_;
+
+    /// @brief Records of the leases.
+    CompactLease4Container records_;
+};
+
+/// @brief Holds the number of leases per subnet, lease type and lease state.
+///
+/// The Memfile backend updates the counters as the leases are added, updated
+/// and deleted, so that the lease statistics can be recounted without
+/// iterating over all leases in the storage.
+class LeaseStateCounters {
+public:
+
+    /// @brief Key of the counter: subnet identifier, lease type, lease state.
+    typedef boost::tuple<SubnetID, Lease::Type, uint32_t> Key;
+
+    /// @brief Counters ordered by subnet identifier, lease type and state.
+    typedef std::map<Key, int64_t> CounterMap;
+
+    /// @brief Increments the counter for the IPv4 lease.
+    ///
+    /// @param lease Lease added to the storage.
+    void add(const Lease4& lease) {
+        adjust(Key(lease.subnet_id_, Lease::TYPE_V4, lease.state_), 1);
+    }
+
+    /// @brief Increments the counter for the compact IPv4 lease.
+    ///
+    /// @param lease Lease added to the storage.
+    void add(const CompactLease4& lease) {
+        adjust(Key(lease.subnet_id_, Lease::TYPE_V4, lease.state_), 1);
+    }
+
+    /// @brief Increments the counter for the IPv6 lease.
+    ///
+    /// @param lease Lease added to the storage.
+    void add(const Lease6& lease) {
+        adjust(Key(lease.subnet_id_, lease.type_, lease.state_), 1);
+    }
+
+    /// @brief Decrements the counter for the IPv4 lease.
+    ///
+    /// @param lease Lease removed from the storage.
+    void remove(const Lease4& lease) {
+        adjust(Key(lease.subnet_id_, Lease::TYPE_V4, lease.state_), -1);
+    }
+
+    /// @brief Decrements the counter for the compact IPv4 lease.
+    ///
+    /// @param lease Lease removed from the storage.
+    void remove(const CompactLease4& lease) {
+        adjust(Key(lease.subnet_id_, Lease::TYPE_V4, lease.state_), -1);
+    }
+
+    /// @brief Decrements the counter for the IPv6 lease.
+    ///
+    /// @param lease Lease removed from the storage.
+    void remove(const Lease6& lease) {
+        adjust(Key(lease.subnet_id_, lease.type_, lease.state_), -1);
+    }
+
+    /// @brief Removes all counters.
+    void clear() {
+        counters_.clear();
+    }
+
+    /// @brief Recomputes the counters from the leases in the storage.
+    ///
+    /// @param storage Lease storage.
+    /// @tparam StorageType One of @c Lease4Storage or @c Lease6Storage.
+    template<typename StorageType>
+    void recount(const StorageType& storage) {
+        clear();
+        for (typename StorageType::const_iterator lease = storage.begin();
+             lease != storage.end(); ++lease) {
+            add(**lease);
+        }
+    }
+
+    /// @brief Recomputes the counters from the leases in the compact
+    /// storage.
+    ///
+    /// @param storage Compact DHCPv4 lease storage.
+    void recount(const CompactLease4Storage& storage) {
+        clear();
+        for (CompactLease4Storage::const_iterator lease = storage.begin();
+             lease != storage.end(); ++lease) {
+            add(*lease);
+        }
+    }
+
+    /// @brief Returns the number of leases in the given state.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param lease_type Lease type, @c Lease::TYPE_V4 for IPv4 leases.
+    /// @param lease_state Lease state.
+    int64_t getCount(const SubnetID& subnet_id, const Lease::Type& lease_type,
+                     const uint32_t lease_state) const {
+        CounterMap::const_iterator counter =
+            counters_.find(Key(subnet_id, lease_type, lease_state));
+        return (counter == counters_.end() ? 0 : counter->second);
+    }
+
+    /// @brief Returns all non-zero counters.
+    const CounterMap& getCounters() const {
+        return (counters_);
+    }
+
+private:
+
+    /// @brief Adjusts the counter by the specified value.
+    ///
+    /// The counters dropping to 0 are removed.
+    ///
+    /// @param key Counter key.
+    /// @param delta Value added to the counter.
+    void adjust(const Key& key, const int64_t delta) {
+        int64_t& count = counters_[key];
+        count += delta;
+        if (count == 0) {
+            counters_.erase(key);
+        }
+    }
+
+    /// @brief Holds the counters.
+    CounterMap counters_;
+};
+
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
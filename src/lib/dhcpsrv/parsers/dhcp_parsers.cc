@@ -6,8 +6,11 @@
 
 #include <config.h>
 
+#include <dhcp/dhcp6.h>
+#include <dhcp/docsis3_option_defs.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/libdhcp++.h>
+#include <dhcp/option_space.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/dhcpsrv_log.h>
@@ -17,25 +20,173 @@
 #include <dhcpsrv/parsers/option_data_parser.h>
 #include <dhcpsrv/cfg_mac_source.h>
 #include <util/encode/hex.h>
+#include <util/stopwatch.h>
 #include <util/strutil.h>
+#include <util/threads/thread.h>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/bind.hpp>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/scoped_ptr.hpp>
 
+#include <algorithm>
+#include <exception>
 #include <map>
 #include <string>
 #include <vector>
+#include <unistd.h>
 
 using namespace std;
 using namespace isc::asiolink;
 using namespace isc::data;
 using namespace isc::util;
 
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Host reservations of a subnet.
+struct SubnetReservations {
+
+    /// @brief Constructor.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param reservations List of the host reservations of the subnet.
+    SubnetReservations(const SubnetID& subnet_id,
+                       ConstElementPtr reservations)
+        : subnet_id_(subnet_id), reservations_(reservations) {
+    }
+
+    /// @brief Identifier of the subnet.
+    SubnetID subnet_id_;
+
+    /// @brief List of the host reservations of the subnet.
+    ConstElementPtr reservations_;
+
+    /// @brief Hosts parsed from the reservations.
+    HostCollection hosts_;
+
+    /// @brief Error raised by the parsing of the reservations, if any.
+    std::exception_ptr error_;
+};
+
+/// @brief Parses the host reservations of every step-th subnet.
+///
+/// This is run by each thread parsing the reservations. The errors are
+/// recorded in the subnets, to be reported in the configuration order.
+///
+/// @tparam HostReservationParserType @c HostReservationParser4 or
+/// @c HostReservationParser6.
+/// @param subnets Reservations of the subnets.
+/// @param first Index of the first subnet to be parsed.
+/// @param step Number of threads.
+template<typename HostReservationParserType>
+void
+parseReservations(std::vector<SubnetReservations>* subnets,
+                  const size_t first, const size_t step) {
+    for (size_t i = first; i < subnets->size(); i += step) {
+        SubnetReservations& subnet = (*subnets)[i];
+        try {
+            HostReservationsListParser<HostReservationParserType> parser;
+            parser.parse(subnet.subnet_id_, subnet.reservations_,
+                         subnet.hosts_);
+        } catch (...) {
+            subnet.error_ = std::current_exception();
+        }
+    }
+}
+
+/// @brief Parses the host reservations of the subnets and adds them to
+/// the configuration.
+///
+/// @tparam HostReservationParserType @c HostReservationParser4 or
+/// @c HostReservationParser6.
+/// @param cfg Server configuration.
+/// @param subnets Reservations of the subnets.
+/// @param threads Number of threads, 0 to select it from the number of
+/// the reservations and of the processors.
+template<typename HostReservationParserType>
+void
+addReservations(SrvConfigPtr cfg, std::vector<SubnetReservations>& subnets,
+                size_t threads) {
+    Stopwatch stopwatch;
+    size_t count = 0;
+    for (size_t i = 0; i < subnets.size(); ++i) {
+        count += subnets[i].reservations_->size();
+    }
+    if (threads == 0) {
+        threads = 1;
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        if ((count >= PARALLEL_RESERVATIONS_MIN) && (processors > 1)) {
+            threads = std::min(static_cast<size_t>(processors),
+                               PARALLEL_RESERVATIONS_MAX_THREADS);
+        }
+    }
+    threads = std::min(threads, subnets.size());
+
+    if (threads > 1) {
+        // The standard option definitions are created by the first lookup,
+        // which is not thread safe.
+        LibDHCP::getOptionDefs(DHCP4_OPTION_SPACE);
+        LibDHCP::getOptionDefs(DHCP6_OPTION_SPACE);
+        LibDHCP::getVendorOption4Defs(VENDOR_ID_CABLE_LABS);
+        LibDHCP::getVendorOption6Defs(VENDOR_ID_CABLE_LABS);
+        LibDHCP::getVendorOption6Defs(ENTERPRISE_ID_ISC);
+
+        // This thread parses its share of the reservations too.
+        std::vector<boost::shared_ptr<thread::Thread> > workers;
+        try {
+            for (size_t i = 1; i < threads; ++i) {
+                workers.push_back(boost::shared_ptr<thread::Thread>(
+                    new thread::Thread(boost::bind(
+                        &parseReservations<HostReservationParserType>,
+                        &subnets, i, threads))));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < workers.size(); ++i) {
+                workers[i]->wait();
+            }
+            throw;
+        }
+        parseReservations<HostReservationParserType>(&subnets, 0, threads);
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i]->wait();
+        }
+
+    } else {
+        parseReservations<HostReservationParserType>(&subnets, 0, 1);
+    }
+
+    HostCollection hosts;
+    hosts.reserve(count);
+    for (size_t i = 0; i < subnets.size(); ++i) {
+        if (subnets[i].error_) {
+            std::rethrow_exception(subnets[i].error_);
+        }
+        hosts.insert(hosts.end(), subnets[i].hosts_.begin(),
+                     subnets[i].hosts_.end());
+    }
+    cfg->getCfgHosts()->add(hosts);
+
+    stopwatch.stop();
+    if (count > 0) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_CFGMGR_ADD_RESERVATIONS)
+            .arg(count).arg(subnets.size()).arg(threads)
+            .arg(stopwatch.logFormatLastDuration());
+    }
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
+const size_t PARALLEL_RESERVATIONS_MIN = 1000;
+
+const size_t PARALLEL_RESERVATIONS_MAX_THREADS = 8;
+
 // **************************** DebugParser *************************
 
 DebugParser::DebugParser(const std::string& param_name)
@@ -486,9 +637,10 @@ Pools4ListParser::parse(PoolStoragePtr pools, ConstElementPtr pools_list) {
 
 //****************************** SubnetConfigParser *************************
 
-SubnetConfigParser::SubnetConfigParser(uint16_t family)
+SubnetConfigParser::SubnetConfigParser(uint16_t family, bool add_hosts)
     : pools_(new PoolStorage()),
       address_family_(family),
+      add_hosts_(add_hosts),
       options_(new CfgOption()) {
     string addr = family == AF_INET ? "0.0.0.0" : "::";
     relay_info_.reset(new isc::dhcp::Subnet::RelayInfo(IOAddress(addr)));
@@ -630,8 +782,8 @@ SubnetConfigParser::createSubnet(ConstElementPtr params) {
 
 //****************************** Subnet4ConfigParser *************************
 
-Subnet4ConfigParser::Subnet4ConfigParser()
-    :SubnetConfigParser(AF_INET) {
+Subnet4ConfigParser::Subnet4ConfigParser(bool add_hosts)
+    :SubnetConfigParser(AF_INET, add_hosts) {
 }
 
 Subnet4Ptr
@@ -665,7 +817,7 @@ Subnet4ConfigParser::parse(ConstElementPtr subnet) {
 
     // Parse Host Reservations for this subnet if any.
     ConstElementPtr reservations = subnet->get("reservations");
-    if (reservations) {
+    if (reservations && add_hosts_) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser4> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
@@ -785,14 +937,25 @@ Subnet4ConfigParser::initSubnet(data::ConstElementPtr params,
 
 //**************************** Subnets4ListConfigParser **********************
 
+Subnets4ListConfigParser::Subnets4ListConfigParser(size_t threads)
+    : threads_(threads) {
+}
+
 size_t
 Subnets4ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
     size_t cnt = 0;
+    std::vector<SubnetReservations> reservations;
     BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-        Subnet4ConfigParser parser;
+        // The reservations are parsed after the subnets.
+        Subnet4ConfigParser parser(false);
         Subnet4Ptr subnet = parser.parse(subnet_json);
         if (subnet) {
+            ConstElementPtr hosts = subnet_json->get("reservations");
+            if (hosts && !hosts->empty()) {
+                reservations.push_back(SubnetReservations(subnet->getID(),
+                                                          hosts));
+            }
 
             // Adding a subnet to the Configuration Manager may fail if the
             // subnet id is invalid (duplicate). Thus, we catch exceptions
@@ -806,6 +969,7 @@ Subnets4ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list)
             }
         }
     }
+    addReservations<HostReservationParser4>(cfg, reservations, threads_);
     return (cnt);
 }
 
@@ -910,8 +1074,8 @@ PdPoolsListParser::parse(PoolStoragePtr pools, ConstElementPtr pd_pool_list) {
 
 //**************************** Subnet6ConfigParser ***********************
 
-Subnet6ConfigParser::Subnet6ConfigParser()
-    :SubnetConfigParser(AF_INET6) {
+Subnet6ConfigParser::Subnet6ConfigParser(bool add_hosts)
+    :SubnetConfigParser(AF_INET6, add_hosts) {
 }
 
 Subnet6Ptr
@@ -951,7 +1115,7 @@ Subnet6ConfigParser::parse(ConstElementPtr subnet) {
 
     // Parse Host Reservations for this subnet if any.
     ConstElementPtr reservations = subnet->get("reservations");
-    if (reservations) {
+    if (reservations && add_hosts_) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser6> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
@@ -1040,13 +1204,23 @@ Subnet6ConfigParser::initSubnet(data::ConstElementPtr params,
 
 //**************************** Subnet6ListConfigParser ********************
 
+Subnets6ListConfigParser::Subnets6ListConfigParser(size_t threads)
+    : threads_(threads) {
+}
+
 size_t
 Subnets6ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
     size_t cnt = 0;
+    std::vector<SubnetReservations> reservations;
     BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-        Subnet6ConfigParser parser;
+        // The reservations are parsed after the subnets.
+        Subnet6ConfigParser parser(false);
         Subnet6Ptr subnet = parser.parse(subnet_json);
+        ConstElementPtr hosts = subnet_json->get("reservations");
+        if (hosts && !hosts->empty()) {
+            reservations.push_back(SubnetReservations(subnet->getID(), hosts));
+        }
 
         // Adding a subnet to the Configuration Manager may fail if the
         // subnet id is invalid (duplicate). Thus, we catch exceptions
@@ -1059,6 +1233,7 @@ Subnets6ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list)
                       << subnet_json->getPosition() << ")");
         }
     }
+    addReservations<HostReservationParser6>(cfg, reservations, threads_);
     return (cnt);
 }
 
@@ -1161,14 +1336,16 @@ D2ClientConfigParser::parse(isc::data::ConstElementPtr client_config) {
     // Now we check for logical errors. This repeats what is done in
     // D2ClientConfig::validate(), but doing it here permits us to
     // emit meaningful parameter position info in the error.
-    if (ncr_format != dhcp_ddns::FMT_JSON) {
+    if ((ncr_format != dhcp_ddns::FMT_JSON) &&
+        (ncr_format != dhcp_ddns::FMT_BINARY)) {
         isc_throw(D2ClientError, "D2ClientConfig error: NCR Format: "
                   << dhcp_ddns::ncrFormatToString(ncr_format)
                   << " is not supported. ("
                   << getPosition("ncr-format", client_config) << ")");
     }
 
-    if (ncr_protocol != dhcp_ddns::NCR_UDP) {
+    if ((ncr_protocol != dhcp_ddns::NCR_UDP) &&
+        (ncr_protocol != dhcp_ddns::NCR_TCP)) {
         isc_throw(D2ClientError, "D2ClientConfig error: NCR Protocol: "
                   << dhcp_ddns::ncrProtocolToString(ncr_protocol)
                   << " is not supported. ("
@@ -557,7 +557,9 @@ public:
     /// @brief constructor
     ///
     /// @param family address family: @c AF_INET or @c AF_INET6
-    explicit SubnetConfigParser(uint16_t family);
+    /// @param add_hosts indicates if the host reservations of the subnet
+    /// are parsed and added to the staging configuration with the subnet
+    SubnetConfigParser(uint16_t family, bool add_hosts = true);
 
     /// @brief virtual destructor (does nothing)
     virtual ~SubnetConfigParser() { }
@@ -615,6 +617,9 @@ protected:
     /// @brief Address family: @c AF_INET or @c AF_INET6
     uint16_t address_family_;
 
+    /// Indicates if the host reservations are parsed with the subnet.
+    bool add_hosts_;
+
     /// Pointer to relay information
     isc::dhcp::Subnet::RelayInfoPtr relay_info_;
 
@@ -633,7 +638,12 @@ public:
     /// @brief Constructor
     ///
     /// stores global scope parameters, options, option definitions.
-    Subnet4ConfigParser();
+    ///
+    /// @param add_hosts indicates if the host reservations of the subnet
+    /// are parsed and added to the staging configuration by @c parse.
+    /// The @c Subnets4ListConfigParser adds the reservations of all
+    /// subnets at once instead.
+    explicit Subnet4ConfigParser(bool add_hosts = true);
 
     /// @brief Parses a single IPv4 subnet configuration and adds to the
     /// Configuration Manager.
@@ -659,19 +669,38 @@ protected:
 /// This is a wrapper parser that handles the whole list of Subnet4
 /// definitions. It iterates over all entries and creates Subnet4ConfigParser
 /// for each entry.
+///
+/// The subnets are parsed in order, as the subnet and pool identifiers
+/// are assigned in order. The host reservations of the subnets are parsed
+/// afterwards, in parallel for large configurations, and are added to the
+/// configuration at once (see @ref CfgHosts::add(const HostCollection&)).
 class Subnets4ListConfigParser : public isc::data::SimpleParser {
 public:
 
+    /// @brief Constructor.
+    ///
+    /// @param threads number of threads parsing the host reservations.
+    /// The default value 0 selects one thread per processor, up to
+    /// @c PARALLEL_RESERVATIONS_MAX_THREADS, when there are at least
+    /// @c PARALLEL_RESERVATIONS_MIN reservations and a single thread
+    /// otherwise.
+    explicit Subnets4ListConfigParser(size_t threads = 0);
+
     /// @brief parses contents of the list
     ///
     /// Iterates over all entries on the list, parses its content
-    /// (by instantiating Subnet6ConfigParser) and adds to specified
+    /// (by instantiating Subnet4ConfigParser) and adds to specified
     /// configuration.
     ///
     /// @param cfg Pointer to server configuration.
     /// @param subnets_list pointer to a list of IPv4 subnets
     /// @return number of subnets created
     size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list);
+
+private:
+
+    /// @brief Number of threads parsing the host reservations.
+    size_t threads_;
 };
 
 /// @brief Parser for IPv6 pool definitions.
@@ -800,7 +829,12 @@ public:
     /// @brief Constructor
     ///
     /// stores global scope parameters, options, option definitions.
-    Subnet6ConfigParser();
+    ///
+    /// @param add_hosts indicates if the host reservations of the subnet
+    /// are parsed and added to the staging configuration by @c parse.
+    /// The @c Subnets6ListConfigParser adds the reservations of all
+    /// subnets at once instead.
+    explicit Subnet6ConfigParser(bool add_hosts = true);
 
     /// @brief Parses a single IPv6 subnet configuration and adds to the
     /// Configuration Manager.
@@ -836,9 +870,18 @@ protected:
 /// This is a wrapper parser that handles the whole list of Subnet6
 /// definitions. It iterates over all entries and creates Subnet6ConfigParser
 /// for each entry.
+///
+/// As for @c Subnets4ListConfigParser, the host reservations are parsed
+/// after the subnets and are added to the configuration at once.
 class Subnets6ListConfigParser : public isc::data::SimpleParser {
 public:
 
+    /// @brief Constructor.
+    ///
+    /// @param threads number of threads parsing the host reservations,
+    /// see @ref Subnets4ListConfigParser::Subnets4ListConfigParser.
+    explicit Subnets6ListConfigParser(size_t threads = 0);
+
     /// @brief parses contents of the list
     ///
     /// Iterates over all entries on the list, parses its content
@@ -849,8 +892,21 @@ public:
     /// @param subnets_list pointer to a list of IPv6 subnets
     /// @throw DhcpConfigError if CfgMgr rejects the subnet (e.g. subnet-id is a duplicate)
     size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list);
+
+private:
+
+    /// @brief Number of threads parsing the host reservations.
+    size_t threads_;
 };
 
+/// @brief Minimum number of host reservations for which the list parsers
+/// of the subnets use several threads by default.
+extern const size_t PARALLEL_RESERVATIONS_MIN;
+
+/// @brief Maximum number of threads the list parsers of the subnets use
+/// by default to parse the host reservations.
+extern const size_t PARALLEL_RESERVATIONS_MAX_THREADS;
+
 /// @brief Parser for  D2ClientConfig
 ///
 /// This class parses the configuration element "dhcp-ddns" common to the
@@ -54,6 +54,21 @@ ExpirationConfigParser::parse(ConstElementPtr expiration_config) {
             cfg->setUnwarnedReclaimCycles(
                 getInteger(expiration_config, param));
         }
+
+        param = "background-reclamation";
+        if (expiration_config->contains(param)) {
+            cfg->setBackgroundReclamation(getBoolean(expiration_config, param));
+        }
+
+        param = "reclaim-slice-leases";
+        if (expiration_config->contains(param)) {
+            cfg->setReclaimSliceLeases(getInteger(expiration_config, param));
+        }
+
+        param = "max-reclaim-rate";
+        if (expiration_config->contains(param)) {
+            cfg->setMaxReclaimRate(getInteger(expiration_config, param));
+        }
     } catch (const DhcpConfigError&) {
         throw;
     } catch (const std::exception& ex) {
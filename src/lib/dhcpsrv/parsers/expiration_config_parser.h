@@ -27,7 +27,10 @@ namespace dhcp {
 /// - hold-reclaimed-time,
 /// - max-reclaim-leases,
 /// - max-reclaim-time,
-/// - unwarned-reclaim-cycles.
+/// - unwarned-reclaim-cycles,
+/// - background-reclamation,
+/// - reclaim-slice-leases,
+/// - max-reclaim-rate.
 ///
 /// These parameters are optional and the default values are used for
 /// those that aren't specified.
@@ -21,6 +21,31 @@ using namespace isc::data;
 
 namespace {
 
+/// @brief Creates the set of the supported parameters for DHCPv4.
+///
+/// @param identifiers_only Indicates if the set should only hold
+/// supported host identifiers (if true) or all supported parameters
+/// (if false).
+std::set<std::string>
+createSupportedParams4(const bool identifiers_only) {
+    std::set<std::string> params_set;
+    params_set.insert("hw-address");
+    params_set.insert("duid");
+    params_set.insert("circuit-id");
+    params_set.insert("client-id");
+    params_set.insert("flex-id");
+    if (!identifiers_only) {
+        params_set.insert("hostname");
+        params_set.insert("ip-address");
+        params_set.insert("option-data");
+        params_set.insert("next-server");
+        params_set.insert("server-hostname");
+        params_set.insert("boot-file-name");
+        params_set.insert("client-classes");
+    }
+    return (params_set);
+}
+
 /// @brief Returns set of the supported parameters for DHCPv4.
 ///
 /// This function returns the set of supported parameters for
@@ -31,31 +56,36 @@ namespace {
 /// parameters (if false).
 const std::set<std::string>&
 getSupportedParams4(const bool identifiers_only = false) {
+    // The sets are initialized by the first call only, which is thread
+    // safe as the reservations of the subnets may be parsed in parallel.
     // Holds set of host identifiers.
-    static std::set<std::string> identifiers_set;
+    static const std::set<std::string> identifiers_set =
+        createSupportedParams4(true);
     // Holds set of all supported parameters, including identifiers.
-    static std::set<std::string> params_set;
-    // If this is first execution of this function, we need
-    // to initialize the set.
-    if (identifiers_set.empty()) {
-        identifiers_set.insert("hw-address");
-        identifiers_set.insert("duid");
-        identifiers_set.insert("circuit-id");
-        identifiers_set.insert("client-id");
-        identifiers_set.insert("flex-id");
-    }
-    // Copy identifiers and add all other parameters.
-    if (params_set.empty()) {
-        params_set = identifiers_set;
+    static const std::set<std::string> params_set =
+        createSupportedParams4(false);
+    return (identifiers_only ? identifiers_set : params_set);
+}
+
+/// @brief Creates the set of the supported parameters for DHCPv6.
+///
+/// @param identifiers_only Indicates if the set should only hold
+/// supported host identifiers (if true) or all supported parameters
+/// (if false).
+std::set<std::string>
+createSupportedParams6(const bool identifiers_only) {
+    std::set<std::string> params_set;
+    params_set.insert("hw-address");
+    params_set.insert("duid");
+    params_set.insert("flex-id");
+    if (!identifiers_only) {
         params_set.insert("hostname");
-        params_set.insert("ip-address");
+        params_set.insert("ip-addresses");
+        params_set.insert("prefixes");
         params_set.insert("option-data");
-        params_set.insert("next-server");
-        params_set.insert("server-hostname");
-        params_set.insert("boot-file-name");
         params_set.insert("client-classes");
     }
-    return (identifiers_only ? identifiers_set : params_set);
+    return (params_set);
 }
 
 /// @brief Returns set of the supported parameters for DHCPv6.
@@ -68,26 +98,14 @@ getSupportedParams4(const bool identifiers_only = false) {
 /// parameters (if false).
 const std::set<std::string>&
 getSupportedParams6(const bool identifiers_only = false) {
+    // The sets are initialized by the first call only, see
+    // getSupportedParams4.
     // Holds set of host identifiers.
-    static std::set<std::string> identifiers_set;
+    static const std::set<std::string> identifiers_set =
+        createSupportedParams6(true);
     // Holds set of all supported parameters, including identifiers.
-    static std::set<std::string> params_set;
-    // If this is first execution of this function, we need
-    // to initialize the set.
-    if (identifiers_set.empty()) {
-        identifiers_set.insert("hw-address");
-        identifiers_set.insert("duid");
-        identifiers_set.insert("flex-id");
-    }
-    // Copy identifiers and add all other parameters.
-    if (params_set.empty()) {
-        params_set = identifiers_set;
-        params_set.insert("hostname");
-        params_set.insert("ip-addresses");
-        params_set.insert("prefixes");
-        params_set.insert("option-data");
-        params_set.insert("client-classes");
-    }
+    static const std::set<std::string> params_set =
+        createSupportedParams6(false);
     return (identifiers_only ? identifiers_set : params_set);
 }
 
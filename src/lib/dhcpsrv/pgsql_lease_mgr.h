@@ -231,6 +231,61 @@ public:
     virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
                                         uint32_t iaid, SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// The leases are returned in ascending order by address. The query
+    /// uses the primary key, so the subsequent pages are fetched using
+    /// the keyset pagination rather than an offset.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The IPv6 addresses are stored as text, so the leases are returned
+    /// in ascending order of the address text. The last address of the
+    /// page is a valid lower bound for the next page. The IPv6 zero
+    /// address denotes the first page.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -318,6 +373,8 @@ public:
     /// It creates an instance of a PgSqlLeaseStatsQuery4 and then
     /// invokes its start method, which fetches its statistical data
     /// result set by executing the RECOUNT_LEASE_STATS4 query.
+    /// The query reads the lease4_stat table, which the schema's
+    /// triggers keep up to date, rather than counting the lease4 table.
     /// The query object is then returned.
     ///
     /// @return The populated query as a pointer to an LeaseStatsQuery
@@ -328,6 +385,8 @@ public:
     /// It creates an instance of a PgSqlLeaseStatsQuery and then
     /// invokes its start method, which fetches its statistical data
     /// result set by executing the RECOUNT_LEASE_STATS6 query.
+    /// The query reads the lease6_stat table, which the schema's
+    /// triggers keep up to date, rather than counting the lease6 table.
     /// The query object is then returned.
     ///
     /// @return The populated query as a pointer to an LeaseStatsQuery
@@ -385,6 +444,15 @@ public:
     ///        failed.
     virtual std::pair<uint32_t, uint32_t> getVersion() const;
 
+    /// @brief Start Transaction
+    ///
+    /// Starts a transaction which is ended by @c commit or @c rollback.
+    ///
+    /// @return Always true.
+    ///
+    /// @throw DbOperationError If the transaction couldn't be started.
+    virtual bool startTransaction();
+
     /// @brief Commit Transactions
     ///
     /// Commits all pending database operations.
@@ -408,16 +476,22 @@ public:
         DELETE_LEASE4_STATE_EXPIRED,// Delete expired lease4s in certain state.
         DELETE_LEASE6,              // Delete from lease6 by address
         DELETE_LEASE6_STATE_EXPIRED,// Delete expired lease6s in certain state.
+        GET_LEASE4,                 // Get all lease4
         GET_LEASE4_ADDR,            // Get lease4 by address
         GET_LEASE4_CLIENTID,        // Get lease4 by client ID
         GET_LEASE4_CLIENTID_SUBID,  // Get lease4 by client ID & subnet ID
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_PAGE,            // Get page of lease4 by address
+        GET_LEASE4_SUBID,           // Get lease4 by subnet ID
+        GET_LEASE6,                 // Get all lease6
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_PAGE,            // Get page of lease6 by address
+        GET_LEASE6_SUBID,           // Get lease6 by subnet ID
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
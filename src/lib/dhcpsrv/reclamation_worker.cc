@@ -0,0 +1,469 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/reclamation_worker.h>
+#include <dhcpsrv/timer_mgr.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <sys/socket.h>
+#include <time.h>
+
+using namespace isc::asiolink;
+using namespace isc::stats;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace dhcp {
+
+const std::string ReclamationWorker::RECLAIM_SLICE_TIMER_NAME =
+    "reclaim-expired-leases-slice";
+
+const uint16_t ReclamationWorker::MAX_SLICE_TIME = 5;
+
+const size_t ReclamationWorker::SLICES_PER_FETCH = 10;
+
+ReclamationWorker::ReclamationWorker(const uint16_t family,
+                                     const AllocEnginePtr& alloc_engine,
+                                     const ConstCfgExpirationPtr& cfg,
+                                     const std::string& lease_db_access)
+    : family_(family), alloc_engine_(alloc_engine), cfg_(cfg),
+      lease_db_access_(lease_db_access), slice_interval_(1), slice_size_(1),
+      cycle_in_progress_(false), max_leases_(0), timeout_(0),
+      remove_lease_(false), max_unwarned_cycles_(0), incomplete_cycles_(0),
+      leases_processed_(0), stopwatch_(new Stopwatch(false)),
+      more_leases_(false), lease_mgr_(), thread_(), mutex_(), cond_var_(),
+      fetch_limit_(0), fetch_done_(false), fetch_error_(), stopping_(false) {
+
+    if ((family_ != AF_INET) && (family_ != AF_INET6)) {
+        isc_throw(BadValue, "invalid address family " << family_
+                  << " specified for the reclamation worker");
+    }
+
+    if (!alloc_engine_) {
+        isc_throw(BadValue, "allocation engine must not be NULL");
+    }
+
+    if (!cfg_) {
+        isc_throw(BadValue, "lease expiration configuration must not be NULL");
+    }
+
+    // Select the slice interval and size. If the rate is not limited, the
+    // slices are executed as often as possible. Otherwise, the interval
+    // is selected such that the slices of the configured size don't
+    // exceed the rate. If the rate is so high that the interval would be
+    // below 1ms, the slice size is reduced instead.
+    const uint32_t slice_leases = cfg_->getReclaimSliceLeases();
+    const uint32_t rate = cfg_->getMaxReclaimRate();
+    slice_size_ = slice_leases;
+    if (rate > 0) {
+        slice_interval_ = std::max(static_cast<uint64_t>(1),
+                                   static_cast<uint64_t>(slice_leases) * 1000 / rate);
+        slice_size_ = static_cast<size_t>
+            (std::min(static_cast<uint64_t>(slice_leases),
+                      std::max(static_cast<uint64_t>(1),
+                               static_cast<uint64_t>(rate) * slice_interval_ / 1000)));
+    }
+}
+
+ReclamationWorker::~ReclamationWorker() {
+    try {
+        stop();
+    } catch (...) {
+        // Destructors must not throw.
+    }
+}
+
+void
+ReclamationWorker::start() {
+    // Make sure that the worker isn't started twice.
+    stop();
+
+    TimerMgr::instance()->registerTimer(RECLAIM_SLICE_TIMER_NAME,
+                                        boost::bind(&ReclamationWorker::runSlice,
+                                                    this),
+                                        slice_interval_,
+                                        IntervalTimer::ONE_SHOT);
+
+    // The in-memory database can't be shared between lease manager
+    // instances, so the queries are executed in this thread.
+    if (LeaseMgrFactory::supportsStandalone(lease_db_access_)) {
+        lease_mgr_ = LeaseMgrFactory::createStandalone(lease_db_access_);
+        {
+            Mutex::Locker lock(mutex_);
+            stopping_ = false;
+            fetch_limit_ = 0;
+            fetch_done_ = false;
+        }
+        thread_.reset(new Thread(boost::bind(&ReclamationWorker::fetchThread,
+                                             this)));
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_RECLAMATION_WORKER_START)
+        .arg(isThreaded() ? "enabled" : "disabled")
+        .arg(slice_interval_)
+        .arg(slice_size_);
+}
+
+void
+ReclamationWorker::stop() {
+    if (thread_) {
+        {
+            Mutex::Locker lock(mutex_);
+            stopping_ = true;
+            cond_var_.signal();
+        }
+        thread_->wait();
+        thread_.reset();
+        lease_mgr_.reset();
+
+        fetched4_.clear();
+        fetched6_.clear();
+    }
+
+    const TimerMgrPtr& timer_mgr = TimerMgr::instance();
+    try {
+        timer_mgr->unregisterTimer(RECLAIM_SLICE_TIMER_NAME);
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_RECLAMATION_WORKER_STOP);
+    } catch (const BadValue&) {
+        // The timer hasn't been registered, i.e. the worker is not running.
+    }
+
+    cycle_in_progress_ = false;
+    pending4_.clear();
+    pending6_.clear();
+}
+
+void
+ReclamationWorker::startCycle(const size_t max_leases, const uint16_t timeout,
+                              const bool remove_lease,
+                              const uint16_t max_unwarned_cycles) {
+    // The previous cycle is still in progress. Let it finish.
+    if (cycle_in_progress_) {
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+              DHCPSRV_RECLAMATION_CYCLE_START)
+        .arg(max_leases)
+        .arg(timeout);
+
+    cycle_in_progress_ = true;
+    max_leases_ = max_leases;
+    timeout_ = timeout;
+    remove_lease_ = remove_lease;
+    max_unwarned_cycles_ = max_unwarned_cycles;
+    leases_processed_ = 0;
+    more_leases_ = false;
+    stopwatch_->reset();
+    pending4_.clear();
+    pending6_.clear();
+
+    if (isThreaded()) {
+        requestFetch();
+    }
+
+    TimerMgr::instance()->setup(RECLAIM_SLICE_TIMER_NAME);
+}
+
+void
+ReclamationWorker::runSlice() {
+    if (!cycle_in_progress_) {
+        return;
+    }
+
+    bool pending_empty = (family_ == AF_INET ? pending4_.empty() :
+                          pending6_.empty());
+
+    // There are no leases to be reclaimed. Get new leases.
+    if (pending_empty) {
+        std::string error;
+        const size_t limit = getFetchLimit();
+        if (isThreaded()) {
+            if (!takeFetchedLeases(error)) {
+                // The query is in progress. Check again later.
+                TimerMgr::instance()->setup(RECLAIM_SLICE_TIMER_NAME);
+                return;
+            }
+
+        } else {
+            try {
+                fetchLeases(LeaseMgrFactory::instance(), limit, pending4_,
+                            pending6_);
+
+            } catch (const std::exception& ex) {
+                error = ex.what();
+            }
+        }
+
+        if (!error.empty()) {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_RECLAMATION_FETCH_FAILED)
+                .arg(error);
+            finishCycle(true);
+            return;
+        }
+
+        // Find the oldest expired lease to report the reclamation lag.
+        int64_t oldest_expire = 0;
+        size_t fetched = 0;
+        if (family_ == AF_INET) {
+            fetched = pending4_.size();
+            for (Lease4Collection::const_iterator lease = pending4_.begin();
+                 lease != pending4_.end(); ++lease) {
+                if ((oldest_expire == 0) ||
+                    ((*lease)->getExpirationTime() < oldest_expire)) {
+                    oldest_expire = (*lease)->getExpirationTime();
+                }
+            }
+
+        } else {
+            fetched = pending6_.size();
+            for (Lease6Collection::const_iterator lease = pending6_.begin();
+                 lease != pending6_.end(); ++lease) {
+                if ((oldest_expire == 0) ||
+                    ((*lease)->getExpirationTime() < oldest_expire)) {
+                    oldest_expire = (*lease)->getExpirationTime();
+                }
+            }
+        }
+        updateLag(oldest_expire);
+
+        // If the query returned as many leases as requested, there are
+        // likely more expired leases in the database.
+        more_leases_ = (fetched >= limit);
+
+        if (fetched == 0) {
+            finishCycle(false);
+            return;
+        }
+    }
+
+    stopwatch_->start();
+    const size_t processed = (family_ == AF_INET ? reclaimSlice(pending4_) :
+                              reclaimSlice(pending6_));
+    stopwatch_->stop();
+
+    leases_processed_ += processed;
+    pending_empty = (family_ == AF_INET ? pending4_.empty() : pending6_.empty());
+
+    if ((max_leases_ > 0) && (leases_processed_ >= max_leases_)) {
+        // Reached the limit of leases in this cycle.
+        finishCycle(more_leases_ || !pending_empty);
+
+    } else if ((timeout_ > 0) && (stopwatch_->getTotalMilliseconds() >= timeout_)) {
+        // Reached the limit of processing time in this cycle.
+        finishCycle(more_leases_ || !pending_empty);
+
+    } else if (pending_empty && !more_leases_) {
+        // All expired leases have been reclaimed.
+        finishCycle(false);
+
+    } else {
+        // There is more work to do. Request next batch of leases if
+        // needed and schedule next slice.
+        if (pending_empty && isThreaded()) {
+            requestFetch();
+        }
+        TimerMgr::instance()->setup(RECLAIM_SLICE_TIMER_NAME);
+    }
+}
+
+template<typename LeaseCollectionType>
+size_t
+ReclamationWorker::reclaimSlice(LeaseCollectionType& leases) {
+    size_t limit = slice_size_;
+    if (max_leases_ > 0) {
+        limit = std::min(limit, max_leases_ - leases_processed_);
+    }
+
+    // Collect the leases which still need to be reclaimed. The lease
+    // may have been renewed or reclaimed by the allocation engine since
+    // it was fetched.
+    LeaseCollectionType slice;
+    typename LeaseCollectionType::iterator lease = leases.begin();
+    for (; (lease != leases.end()) && (slice.size() < limit); ++lease) {
+        typename LeaseCollectionType::value_type current = revalidate(*lease);
+        if (current) {
+            slice.push_back(current);
+        }
+    }
+    leases.erase(leases.begin(), lease);
+
+    if (slice.empty()) {
+        return (0);
+    }
+
+    // Never exceed the time remaining in this cycle.
+    uint16_t timeout = MAX_SLICE_TIME;
+    if (timeout_ > 0) {
+        const long remaining = static_cast<long>(timeout_) -
+            stopwatch_->getTotalMilliseconds();
+        timeout = static_cast<uint16_t>(std::max(1L, std::min(remaining,
+                                                              static_cast<long>(timeout))));
+    }
+
+    return (reclaimLeases(slice, timeout));
+}
+
+Lease4Ptr
+ReclamationWorker::revalidate(const Lease4Ptr& lease) const {
+    Lease4Ptr current = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    if (current && current->expired() && !current->stateExpiredReclaimed()) {
+        return (current);
+    }
+    return (Lease4Ptr());
+}
+
+Lease6Ptr
+ReclamationWorker::revalidate(const Lease6Ptr& lease) const {
+    Lease6Ptr current = LeaseMgrFactory::instance().getLease6(lease->type_,
+                                                               lease->addr_);
+    if (current && current->expired() && !current->stateExpiredReclaimed()) {
+        return (current);
+    }
+    return (Lease6Ptr());
+}
+
+size_t
+ReclamationWorker::reclaimLeases(const Lease4Collection& leases,
+                                 const uint16_t timeout) {
+    return (alloc_engine_->reclaimLeases4(leases, remove_lease_, timeout));
+}
+
+size_t
+ReclamationWorker::reclaimLeases(const Lease6Collection& leases,
+                                 const uint16_t timeout) {
+    return (alloc_engine_->reclaimLeases6(leases, remove_lease_, timeout));
+}
+
+size_t
+ReclamationWorker::getFetchLimit() const {
+    size_t limit = slice_size_ * SLICES_PER_FETCH;
+    if (max_leases_ > 0) {
+        limit = std::min(limit, max_leases_ - leases_processed_);
+    }
+    return (limit);
+}
+
+void
+ReclamationWorker::fetchLeases(LeaseMgr& lease_mgr, const size_t limit,
+                               Lease4Collection& leases4,
+                               Lease6Collection& leases6) const {
+    if (family_ == AF_INET) {
+        lease_mgr.getExpiredLeases4(leases4, limit);
+    } else {
+        lease_mgr.getExpiredLeases6(leases6, limit);
+    }
+}
+
+void
+ReclamationWorker::requestFetch() {
+    Mutex::Locker lock(mutex_);
+    fetch_limit_ = getFetchLimit();
+    fetch_done_ = false;
+    cond_var_.signal();
+}
+
+bool
+ReclamationWorker::takeFetchedLeases(std::string& error) {
+    Mutex::Locker lock(mutex_);
+    if (!fetch_done_) {
+        return (false);
+    }
+    fetch_done_ = false;
+    pending4_.swap(fetched4_);
+    pending6_.swap(fetched6_);
+    fetched4_.clear();
+    fetched6_.clear();
+    error.swap(fetch_error_);
+    fetch_error_.clear();
+    return (true);
+}
+
+void
+ReclamationWorker::fetchThread() {
+    for (;;) {
+        size_t limit = 0;
+        {
+            Mutex::Locker lock(mutex_);
+            while (!stopping_ && (fetch_limit_ == 0)) {
+                cond_var_.wait(mutex_);
+            }
+            if (stopping_) {
+                return;
+            }
+            limit = fetch_limit_;
+        }
+
+        // The lease manager is used exclusively by this thread until
+        // the thread is stopped, so the query is executed without
+        // holding the lock.
+        Lease4Collection leases4;
+        Lease6Collection leases6;
+        std::string error;
+        try {
+            fetchLeases(*lease_mgr_, limit, leases4, leases6);
+
+        } catch (const std::exception& ex) {
+            error = ex.what();
+        }
+
+        {
+            Mutex::Locker lock(mutex_);
+            fetched4_.swap(leases4);
+            fetched6_.swap(leases6);
+            fetch_error_ = error;
+            fetch_limit_ = 0;
+            fetch_done_ = true;
+        }
+    }
+}
+
+void
+ReclamationWorker::updateLag(const int64_t oldest_expire) const {
+    int64_t lag = 0;
+    if (oldest_expire > 0) {
+        lag = std::max(static_cast<int64_t>(0),
+                       static_cast<int64_t>(time(NULL)) - oldest_expire);
+    }
+    StatsMgr::instance().setValue("reclamation-lag", lag);
+}
+
+void
+ReclamationWorker::finishCycle(const bool incomplete) {
+    cycle_in_progress_ = false;
+    pending4_.clear();
+    pending6_.clear();
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+              DHCPSRV_RECLAMATION_CYCLE_COMPLETE)
+        .arg(leases_processed_)
+        .arg(stopwatch_->logFormatTotalDuration());
+
+    if (incomplete) {
+        ++incomplete_cycles_;
+        if ((max_unwarned_cycles_ > 0) &&
+            (incomplete_cycles_ > max_unwarned_cycles_)) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_RECLAMATION_CYCLE_SLOW)
+                .arg(max_unwarned_cycles_);
+            incomplete_cycles_ = 0;
+        }
+
+    } else {
+        incomplete_cycles_ = 0;
+        // All expired leases have been reclaimed.
+        updateLag(0);
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,331 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RECLAMATION_WORKER_H
+#define RECLAMATION_WORKER_H
+
+#include <dhcpsrv/alloc_engine.h>
+#include <dhcpsrv/cfg_expiration.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <util/stopwatch.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Reclaims expired leases in the background.
+///
+/// The server normally reclaims expired leases in a single pass executed
+/// when the "reclaim-expired-leases" timer elapses. The pass may last up to
+/// "max-reclaim-time" milliseconds and the server doesn't respond to the
+/// DHCP queries during that time. This class spreads the reclamation cycle
+/// over a number of short slices which are interleaved with the packet
+/// processing:
+///
+/// - The cycle is started with @c startCycle, typically from the callback
+///   of the "reclaim-expired-leases" timer. This method returns immediately.
+/// - The slices are executed by the "reclaim-expired-leases-slice" timer
+///   registered in the @c TimerMgr. Each slice reclaims at most
+///   "reclaim-slice-leases" leases and lasts at most @c MAX_SLICE_TIME
+///   milliseconds. When "max-reclaim-rate" is non-zero, the slice timer
+///   interval and the slice size are selected such that no more than the
+///   specified number of leases per second is reclaimed.
+/// - The cycle ends when there are no more expired leases, when the number
+///   of leases reclaimed reaches "max-reclaim-leases" or when the total
+///   processing time reaches "max-reclaim-time".
+///
+/// If the lease database supports multiple connections (i.e. it is not
+/// the in-memory database), the worker opens its own connection to the
+/// lease database and the potentially expensive queries for the expired
+/// leases are executed in a separate thread. The reclamation itself (hooks, DNS updates, statistics
+/// and the lease updates) is always performed in the thread processing
+/// packets because these facilities are not thread safe.
+///
+/// The leases are fetched in batches covering several slices. Since the
+/// clients may renew their leases between the slices, each lease is re-read
+/// from the current lease manager before it is reclaimed.
+///
+/// After fetching the expired leases, the worker sets the
+/// "reclamation-lag" statistic to the number of seconds elapsed since
+/// the expiration of the oldest unreclaimed lease. The value of 0 indicates
+/// that the reclamation keeps up with the lease expirations.
+class ReclamationWorker : public boost::noncopyable {
+public:
+
+    /// @brief Name of the timer driving the reclamation slices.
+    static const std::string RECLAIM_SLICE_TIMER_NAME;
+
+    /// @brief Maximum duration of a single slice in milliseconds.
+    static const uint16_t MAX_SLICE_TIME;
+
+    /// @brief Number of slices worth of leases fetched in one query.
+    static const size_t SLICES_PER_FETCH;
+
+    /// @brief Constructor.
+    ///
+    /// @param family Address family, i.e. AF_INET or AF_INET6.
+    /// @param alloc_engine Allocation engine used to reclaim leases.
+    /// @param cfg Lease expiration configuration.
+    /// @param lease_db_access Lease database access string. If it specifies
+    /// a database supporting multiple connections, the worker uses its own
+    /// connection to query for expired leases in a separate thread.
+    ///
+    /// @throw isc::BadValue if the family is invalid or the allocation
+    /// engine or configuration is NULL.
+    ReclamationWorker(const uint16_t family, const AllocEnginePtr& alloc_engine,
+                      const ConstCfgExpirationPtr& cfg,
+                      const std::string& lease_db_access);
+
+    /// @brief Destructor.
+    ///
+    /// Stops the worker.
+    ~ReclamationWorker();
+
+    /// @brief Starts the worker.
+    ///
+    /// Registers the slice timer and, if the lease database supports it,
+    /// creates the lease manager instance and the thread used to fetch
+    /// expired leases.
+    void start();
+
+    /// @brief Stops the worker.
+    ///
+    /// Unregisters the slice timer and terminates the thread fetching
+    /// expired leases. The reclamation cycle in progress is abandoned.
+    void stop();
+
+    /// @brief Starts new reclamation cycle.
+    ///
+    /// The signature of this method matches the signature of the lease
+    /// reclamation routines of the @c AllocEngine. This method is a no-op
+    /// if the cycle is already in progress.
+    ///
+    /// @param max_leases Maximum number of leases to be reclaimed in the
+    /// cycle. The value of 0 means no limit.
+    /// @param timeout Maximum total processing time of the cycle in
+    /// milliseconds. The value of 0 means no limit.
+    /// @param remove_lease Indicates if the reclaimed leases should be
+    /// removed from the lease database.
+    /// @param max_unwarned_cycles Number of consecutive incomplete cycles
+    /// after which a warning is issued. The value of 0 disables warnings.
+    void startCycle(const size_t max_leases, const uint16_t timeout,
+                    const bool remove_lease,
+                    const uint16_t max_unwarned_cycles);
+
+    /// @brief Checks if the reclamation cycle is in progress.
+    bool cycleInProgress() const {
+        return (cycle_in_progress_);
+    }
+
+    /// @brief Checks if the expired leases are fetched in a separate thread.
+    bool isThreaded() const {
+        return (thread_.get() != NULL);
+    }
+
+    /// @brief Returns the interval between the slices in milliseconds.
+    long getSliceInterval() const {
+        return (slice_interval_);
+    }
+
+    /// @brief Returns the maximum number of leases reclaimed in a slice.
+    size_t getSliceSize() const {
+        return (slice_size_);
+    }
+
+private:
+
+    /// @brief Executes a single slice of the reclamation cycle.
+    ///
+    /// This is the callback of the slice timer.
+    void runSlice();
+
+    /// @brief Reclaims next chunk of the fetched leases.
+    ///
+    /// @param leases Leases fetched from the database.
+    /// @tparam LeaseCollectionType Type of the lease collection.
+    /// @return Number of the leases processed.
+    template<typename LeaseCollectionType>
+    size_t reclaimSlice(LeaseCollectionType& leases);
+
+    /// @brief Re-reads the lease from the current lease manager and checks
+    /// if it still needs to be reclaimed.
+    ///
+    /// @param lease Lease returned by the query.
+    /// @return Pointer to the current lease instance or NULL if the lease
+    /// doesn't need to be reclaimed.
+    Lease4Ptr revalidate(const Lease4Ptr& lease) const;
+
+    /// @brief Re-reads the lease from the current lease manager and checks
+    /// if it still needs to be reclaimed.
+    ///
+    /// @param lease Lease returned by the query.
+    /// @return Pointer to the current lease instance or NULL if the lease
+    /// doesn't need to be reclaimed.
+    Lease6Ptr revalidate(const Lease6Ptr& lease) const;
+
+    /// @brief Calls the allocation engine to reclaim the leases.
+    ///
+    /// @param leases Leases to be reclaimed.
+    /// @param timeout Maximum processing time.
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases(const Lease4Collection& leases, const uint16_t timeout);
+
+    /// @brief Calls the allocation engine to reclaim the leases.
+    ///
+    /// @param leases Leases to be reclaimed.
+    /// @param timeout Maximum processing time.
+    /// @return Number of reclaimed leases.
+    size_t reclaimLeases(const Lease6Collection& leases, const uint16_t timeout);
+
+    /// @brief Returns the number of leases to be fetched by the next query.
+    size_t getFetchLimit() const;
+
+    /// @brief Fetches expired leases from the specified lease manager.
+    ///
+    /// @param lease_mgr Lease manager to query.
+    /// @param limit Maximum number of leases to fetch.
+    /// @param [out] leases4 Fetched IPv4 leases.
+    /// @param [out] leases6 Fetched IPv6 leases.
+    void fetchLeases(LeaseMgr& lease_mgr, const size_t limit,
+                     Lease4Collection& leases4,
+                     Lease6Collection& leases6) const;
+
+    /// @brief Takes the leases fetched by the thread.
+    ///
+    /// @param [out] error Error message returned by the thread.
+    /// @return true if the results of the query are available, false if
+    /// the query is still in progress.
+    bool takeFetchedLeases(std::string& error);
+
+    /// @brief Requests the thread to fetch expired leases.
+    void requestFetch();
+
+    /// @brief Main function of the thread fetching expired leases.
+    void fetchThread();
+
+    /// @brief Updates the "reclamation-lag" statistic.
+    ///
+    /// @param oldest_expire Expiration time of the oldest expired lease or
+    /// 0 if there are no expired leases.
+    void updateLag(const int64_t oldest_expire) const;
+
+    /// @brief Finishes the reclamation cycle.
+    ///
+    /// @param incomplete Indicates if there are still leases to be reclaimed.
+    void finishCycle(const bool incomplete);
+
+    /// @brief Address family.
+    uint16_t family_;
+
+    /// @brief Allocation engine.
+    AllocEnginePtr alloc_engine_;
+
+    /// @brief Lease expiration configuration.
+    ConstCfgExpirationPtr cfg_;
+
+    /// @brief Lease database access string.
+    std::string lease_db_access_;
+
+    /// @brief Interval between the slices.
+    long slice_interval_;
+
+    /// @brief Maximum number of leases reclaimed in a slice.
+    size_t slice_size_;
+
+    /// @name Reclamation cycle state.
+    ///
+    /// These members are accessed only by the thread processing packets.
+    //@{
+
+    /// @brief Indicates if the cycle is in progress.
+    bool cycle_in_progress_;
+
+    /// @brief Maximum number of leases to be reclaimed in the cycle.
+    size_t max_leases_;
+
+    /// @brief Maximum processing time in the cycle.
+    uint16_t timeout_;
+
+    /// @brief Indicates if the reclaimed leases should be removed.
+    bool remove_lease_;
+
+    /// @brief Number of incomplete cycles after which a warning is issued.
+    uint16_t max_unwarned_cycles_;
+
+    /// @brief Number of consecutive incomplete cycles.
+    uint16_t incomplete_cycles_;
+
+    /// @brief Number of leases reclaimed in the cycle so far.
+    size_t leases_processed_;
+
+    /// @brief Measures processing time of the slices in the cycle.
+    boost::scoped_ptr<util::Stopwatch> stopwatch_;
+
+    /// @brief Fetched IPv4 leases waiting for the reclamation.
+    Lease4Collection pending4_;
+
+    /// @brief Fetched IPv6 leases waiting for the reclamation.
+    Lease6Collection pending6_;
+
+    /// @brief Indicates if the last query returned as many leases as
+    /// requested, i.e. there may be more expired leases in the database.
+    bool more_leases_;
+
+    //@}
+
+    /// @name Members shared with the thread fetching expired leases.
+    ///
+    /// These members are protected by the @c mutex_.
+    //@{
+
+    /// @brief Lease manager owned by the worker.
+    LeaseMgrPtr lease_mgr_;
+
+    /// @brief Thread fetching expired leases.
+    boost::scoped_ptr<util::thread::Thread> thread_;
+
+    /// @brief Mutex protecting the shared members.
+    util::thread::Mutex mutex_;
+
+    /// @brief Condition variable signalled when the fetch is requested.
+    util::thread::CondVar cond_var_;
+
+    /// @brief Maximum number of leases requested from the thread or 0 if
+    /// there is no pending request.
+    size_t fetch_limit_;
+
+    /// @brief Indicates if the thread has finished the query.
+    bool fetch_done_;
+
+    /// @brief Error message returned by the thread.
+    std::string fetch_error_;
+
+    /// @brief Indicates if the thread should terminate.
+    bool stopping_;
+
+    /// @brief IPv4 leases returned by the thread.
+    Lease4Collection fetched4_;
+
+    /// @brief IPv6 leases returned by the thread.
+    Lease6Collection fetched6_;
+
+    //@}
+};
+
+/// @brief Pointer to the @c ReclamationWorker.
+typedef boost::shared_ptr<ReclamationWorker> ReclamationWorkerPtr;
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // RECLAMATION_WORKER_H
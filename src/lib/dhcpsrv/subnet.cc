@@ -93,18 +93,14 @@ Subnet::clientSupported(const isc::dhcp::ClientClasses& classes) const {
                        // support everyone.
     }
 
-    for (ClientClasses::const_iterator it = white_list_.begin();
-         it != white_list_.end(); ++it) {
-        if (classes.contains(*it)) {
-            return (true);
-        }
-    }
-
-    return (false);
+    // The names of the white list are registered, so this is a bitset
+    // intersection.
+    return (white_list_.intersects(classes));
 }
 
 void
 Subnet::allowClientClass(const isc::dhcp::ClientClass& class_name) {
+    ClientClassRegistry::instance().intern(class_name);
     white_list_.insert(class_name);
 }
 
@@ -311,7 +311,9 @@ public:
 
     /// @brief adds class class_name to the list of supported classes
     ///
-    /// Also see explanation note in @ref white_list_.
+    /// Also see explanation note in @ref white_list_. The class name is
+    /// registered in the @ref ClientClassRegistry, so @ref clientSupported
+    /// only tests the bits of the classes.
     ///
     /// @param class_name client class to be supported by this subnet
     void
@@ -527,6 +529,9 @@ private:
 /// @brief A generic pointer to either Subnet4 or Subnet6 object
 typedef boost::shared_ptr<Subnet> SubnetPtr;
 
+/// @brief A generic const pointer to either Subnet4 or Subnet6 object
+typedef boost::shared_ptr<const Subnet> ConstSubnetPtr;
+
 
 /// @brief A configuration holder for IPv4 subnet.
 ///
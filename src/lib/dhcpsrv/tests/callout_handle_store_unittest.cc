@@ -94,6 +94,37 @@ TEST(CalloutHandleStoreTest, StoreRetrieve) {
     EXPECT_EQ(1, pktptr_2.use_count());
 }
 
+// Check that the CalloutHandle of the previous packet is reused for a new
+// packet when it is not referenced elsewhere.
+
+TEST(CalloutHandleStoreTest, Reuse) {
+    Pkt4Ptr pktptr_1(new Pkt4(DHCPDISCOVER, 1234));
+    Pkt4Ptr pktptr_2(new Pkt4(DHCPDISCOVER, 5678));
+    Pkt4Ptr pktptr_3(new Pkt4(DHCPDISCOVER, 9012));
+
+    // Set an argument on the handle of the first packet.
+    CalloutHandle* handle_1 = getCalloutHandle(pktptr_1).get();
+    ASSERT_TRUE(handle_1);
+    handle_1->setArgument("query4", pktptr_1);
+    handle_1->setStatus(CalloutHandle::NEXT_STEP_SKIP);
+
+    // The handle is not held here, so it is reset and reused for the
+    // second packet.
+    CalloutHandlePtr chptr_2 = getCalloutHandle(pktptr_2);
+    EXPECT_EQ(handle_1, chptr_2.get());
+    EXPECT_TRUE(chptr_2->getArgumentNames().empty());
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, chptr_2->getStatus());
+    EXPECT_EQ(1, pktptr_1.use_count());
+
+    // The handle is held by chptr_2, so a new one is created for the third
+    // packet.
+    CalloutHandlePtr chptr_3 = getCalloutHandle(pktptr_3);
+    EXPECT_FALSE(chptr_2 == chptr_3);
+
+    // Clear the stored pointers.
+    getCalloutHandle(Pkt4Ptr());
+}
+
 // The followings is a trivial test to check that if the template function
 // is referred to in a separate compilation unit, only one copy of the static
 // objects stored in it are returned.  (For a change, we'll use a Pkt6 as the
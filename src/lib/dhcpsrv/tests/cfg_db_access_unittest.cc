@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <cc/data.h>
+#include <dhcp/hwaddr.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
@@ -92,6 +93,43 @@ TEST(CfgDbAccessTest, createLeaseMgr) {
     });
 }
 
+// Tests that the lease manager is kept when the lease database
+// configuration is unchanged and recreated otherwise.
+TEST(CfgDbAccessTest, keepLeaseMgr) {
+    CfgDbAccess cfg;
+    ASSERT_NO_THROW(cfg.setLeaseDbAccessString("type=memfile persist=false"));
+    cfg.setAppendedParameters("universe=4");
+    ASSERT_NO_THROW(cfg.createManagers());
+    LeaseMgr* lease_mgr = &LeaseMgrFactory::instance();
+    EXPECT_TRUE(LeaseMgrFactory::isCurrent("type=memfile persist=false universe=4"));
+
+    // Add a lease which must survive the reconfiguration.
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("00:01:02:03:04:05")));
+    Lease4Ptr lease(new Lease4(asiolink::IOAddress("192.0.2.10"), hwaddr,
+                               ClientIdPtr(), 3600, 1000, 2000, time(NULL), 1));
+    ASSERT_TRUE(lease_mgr->addLease(lease));
+
+    // Same configuration: the lease manager and its leases are kept.
+    CfgDbAccess same_cfg;
+    ASSERT_NO_THROW(same_cfg.setLeaseDbAccessString("type=memfile persist=false"));
+    same_cfg.setAppendedParameters("universe=4");
+    ASSERT_NO_THROW(same_cfg.createManagers());
+    EXPECT_EQ(lease_mgr, &LeaseMgrFactory::instance());
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(asiolink::IOAddress("192.0.2.10")));
+
+    // Different configuration: a new lease manager is created.
+    CfgDbAccess other_cfg;
+    ASSERT_NO_THROW(other_cfg.setLeaseDbAccessString("type=memfile persist=false "
+                                                     "lfc-interval=0"));
+    other_cfg.setAppendedParameters("universe=4");
+    ASSERT_NO_THROW(other_cfg.createManagers());
+    EXPECT_FALSE(LeaseMgrFactory::instance().getLease4(asiolink::IOAddress("192.0.2.10")));
+
+    // A lease manager created directly is not reused.
+    LeaseMgrFactory::destroy();
+    EXPECT_FALSE(LeaseMgrFactory::isCurrent("type=memfile persist=false universe=4"));
+}
+
 // The following tests require MySQL enabled.
 #if defined HAVE_MYSQL
 
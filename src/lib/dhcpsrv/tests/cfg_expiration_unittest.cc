@@ -112,6 +112,11 @@ TEST(CfgExpirationTest, defaults) {
               cfg.getMaxReclaimTime());
     EXPECT_EQ(CfgExpiration::DEFAULT_UNWARNED_RECLAIM_CYCLES,
               cfg.getUnwarnedReclaimCycles());
+    EXPECT_FALSE(cfg.getBackgroundReclamation());
+    EXPECT_EQ(CfgExpiration::DEFAULT_RECLAIM_SLICE_LEASES,
+              cfg.getReclaimSliceLeases());
+    EXPECT_EQ(CfgExpiration::DEFAULT_MAX_RECLAIM_RATE,
+              cfg.getMaxReclaimRate());
 }
 
 /// @brief Tests that unparse returns an expected value
@@ -127,6 +132,26 @@ TEST(CfgExpirationTest, unparse) {
     isc::test::runToElementTest<CfgExpiration>(defaults, cfg);
 }
 
+/// @brief Tests that unparse includes background reclamation parameters
+/// when the background reclamation is enabled.
+TEST(CfgExpirationTest, unparseBackgroundReclamation) {
+    CfgExpiration cfg;
+    cfg.setBackgroundReclamation(true);
+    cfg.setReclaimSliceLeases(20);
+    cfg.setMaxReclaimRate(1000);
+    std::string expected = "{\n"
+        "\"reclaim-timer-wait-time\": 10,\n"
+        "\"flush-reclaimed-timer-wait-time\": 25,\n"
+        "\"hold-reclaimed-time\": 3600,\n"
+        "\"max-reclaim-leases\": 100,\n"
+        "\"max-reclaim-time\": 250,\n"
+        "\"unwarned-reclaim-cycles\": 5,\n"
+        "\"background-reclamation\": true,\n"
+        "\"reclaim-slice-leases\": 20,\n"
+        "\"max-reclaim-rate\": 1000 }";
+    isc::test::runToElementTest<CfgExpiration>(expected, cfg);
+}
+
 // Test the {get,set}ReclaimTimerWaitTime.
 TEST(CfgExpirationTest, getReclaimTimerWaitTime) {
     testAccessModify<uint16_t>(CfgExpiration::LIMIT_RECLAIM_TIMER_WAIT_TIME,
@@ -169,6 +194,32 @@ TEST(CfgExpirationTest, getUnwarnedReclaimCycles) {
                            &CfgExpiration::getUnwarnedReclaimCycles);
 }
 
+// Test the {get,set}ReclaimSliceLeases.
+TEST(CfgExpirationTest, getReclaimSliceLeases) {
+    CfgExpiration cfg;
+    // The slice must include at least one lease.
+    EXPECT_THROW(cfg.setReclaimSliceLeases(0), OutOfRange);
+    EXPECT_THROW(cfg.setReclaimSliceLeases(-1), OutOfRange);
+    EXPECT_THROW(cfg.setReclaimSliceLeases(CfgExpiration::
+                                           LIMIT_RECLAIM_SLICE_LEASES + 1),
+                 OutOfRange);
+
+    ASSERT_NO_THROW(cfg.setReclaimSliceLeases(1));
+    EXPECT_EQ(1, cfg.getReclaimSliceLeases());
+
+    ASSERT_NO_THROW(cfg.setReclaimSliceLeases(CfgExpiration::
+                                              LIMIT_RECLAIM_SLICE_LEASES));
+    EXPECT_EQ(CfgExpiration::LIMIT_RECLAIM_SLICE_LEASES,
+              cfg.getReclaimSliceLeases());
+}
+
+// Test the {get,set}MaxReclaimRate.
+TEST(CfgExpirationTest, getMaxReclaimRate) {
+    testAccessModifyUint32(CfgExpiration::LIMIT_MAX_RECLAIM_RATE,
+                           &CfgExpiration::setMaxReclaimRate,
+                           &CfgExpiration::getMaxReclaimRate);
+}
+
 /// @brief Implements test routines for leases reclamation.
 ///
 /// This class implements two routines called by the @c CfgExpiration object
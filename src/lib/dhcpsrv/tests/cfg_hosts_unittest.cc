@@ -759,4 +759,137 @@ TEST_F(CfgHostsTest, duplicatesSubnet6DUID) {
 }
 
 
+// This test verifies that the hosts added at once can be retrieved as the
+// hosts added one by one.
+TEST_F(CfgHostsTest, addCollection) {
+    HostCollection hosts;
+    for (unsigned i = 0; i < 25; ++i) {
+        // IPv4 host reserving an address in the subnet 1 and in the
+        // subnet 2.
+        hosts.push_back(HostPtr(new Host(hwaddrs_[i]->toText(false),
+                                         "hw-address",
+                                         SubnetID(1), SubnetID(0),
+                                         addressesa_[i])));
+        hosts.push_back(HostPtr(new Host(hwaddrs_[i]->toText(false),
+                                         "hw-address",
+                                         SubnetID(2), SubnetID(0),
+                                         addressesa_[i])));
+        // IPv6 host reserving an address.
+        HostPtr host(new Host(duids_[i]->toText(), "duid",
+                              SubnetID(0), SubnetID(1),
+                              IOAddress("0.0.0.0")));
+        host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                       increase(IOAddress("2001:db8::1"), i)));
+        hosts.push_back(host);
+    }
+
+    CfgHosts cfg;
+    ASSERT_NO_THROW(cfg.add(hosts));
+
+    CfgHosts expected;
+    for (unsigned i = 0; i < hosts.size(); ++i) {
+        ASSERT_NO_THROW(expected.add(hosts[i]));
+    }
+
+    for (unsigned i = 0; i < 25; ++i) {
+        ConstHostPtr host = cfg.get4(SubnetID(1), hwaddrs_[i]);
+        ASSERT_TRUE(host);
+        EXPECT_EQ(addressesa_[i], host->getIPv4Reservation());
+        EXPECT_TRUE(cfg.get4(SubnetID(2), addressesa_[i]));
+        EXPECT_FALSE(cfg.get4(SubnetID(3), hwaddrs_[i]));
+
+        // The hosts reserving the same address are returned in the same
+        // order.
+        HostCollection all = cfg.getAll4(addressesa_[i]);
+        HostCollection expected_all = expected.getAll4(addressesa_[i]);
+        ASSERT_EQ(2, all.size());
+        ASSERT_EQ(expected_all.size(), all.size());
+        for (unsigned j = 0; j < all.size(); ++j) {
+            EXPECT_EQ(expected_all[j], all[j]);
+        }
+
+        host = cfg.get6(SubnetID(1), duids_[i]);
+        ASSERT_TRUE(host);
+        EXPECT_TRUE(host->hasReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+            increase(IOAddress("2001:db8::1"), i))));
+        EXPECT_EQ(host, cfg.get6(SubnetID(1),
+                                 increase(IOAddress("2001:db8::1"), i)));
+    }
+}
+
+// This test verifies that the hosts added at once are rejected as the
+// hosts added one by one.
+TEST_F(CfgHostsTest, addCollectionDuplicates) {
+    HostCollection hosts;
+    hosts.push_back(HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                     "hw-address",
+                                     SubnetID(10), SubnetID(0),
+                                     IOAddress("10.0.0.1"))));
+    // Same HW address in another subnet.
+    hosts.push_back(HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                     "hw-address",
+                                     SubnetID(11), SubnetID(0),
+                                     IOAddress("10.0.0.1"))));
+
+    // Same HW address in the same subnet.
+    HostCollection duplicates(hosts);
+    duplicates.push_back(HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                          "hw-address",
+                                          SubnetID(10), SubnetID(0),
+                                          IOAddress("10.0.0.10"))));
+    CfgHosts cfg;
+    EXPECT_THROW(cfg.add(duplicates), isc::dhcp::DuplicateHost);
+
+    // Same address in the same subnet.
+    duplicates = hosts;
+    duplicates.push_back(HostPtr(new Host(hwaddrs_[1]->toText(false),
+                                          "hw-address",
+                                          SubnetID(10), SubnetID(0),
+                                          IOAddress("10.0.0.1"))));
+    CfgHosts cfg_address;
+    EXPECT_THROW(cfg_address.add(duplicates), isc::dhcp::ReservedAddress);
+
+    // Same DUID in the same IPv6 subnet.
+    duplicates = hosts;
+    for (unsigned i = 0; i < 2; ++i) {
+        duplicates.push_back(HostPtr(new Host(duids_[0]->toText(), "duid",
+                                              SubnetID(0), SubnetID(1),
+                                              IOAddress("0.0.0.0"),
+                                              "foo.example.com")));
+    }
+    CfgHosts cfg_duid;
+    EXPECT_THROW(cfg_duid.add(duplicates), isc::dhcp::DuplicateHost);
+
+    // Same IPv6 address in the same IPv6 subnet.
+    duplicates = hosts;
+    for (unsigned i = 0; i < 2; ++i) {
+        HostPtr host(new Host(duids_[i]->toText(), "duid",
+                              SubnetID(0), SubnetID(1),
+                              IOAddress("0.0.0.0")));
+        host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                       IOAddress("2001:db8::1")));
+        duplicates.push_back(host);
+    }
+    CfgHosts cfg_resrv;
+    EXPECT_THROW(cfg_resrv.add(duplicates), isc::dhcp::DuplicateHost);
+
+    // No subnet.
+    duplicates = hosts;
+    duplicates.push_back(HostPtr(new Host(hwaddrs_[1]->toText(false),
+                                          "hw-address",
+                                          SubnetID(0), SubnetID(0),
+                                          IOAddress("10.0.0.2"))));
+    CfgHosts cfg_subnet;
+    EXPECT_THROW(cfg_subnet.add(duplicates), isc::BadValue);
+
+    // The hosts without duplicates are accepted.
+    EXPECT_NO_THROW(cfg.add(HostCollection()));
+    CfgHosts cfg_unique;
+    EXPECT_NO_THROW(cfg_unique.add(hosts));
+    EXPECT_EQ(2, cfg_unique.getAll(hwaddrs_[0]).size());
+
+    // The hosts are checked against the hosts already added.
+    EXPECT_THROW(cfg_unique.add(hosts), isc::dhcp::DuplicateHost);
+}
+
 } // end of anonymous namespace
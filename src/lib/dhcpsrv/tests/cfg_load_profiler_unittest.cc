@@ -0,0 +1,52 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/cfg_load_profiler.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace isc::dhcp;
+using namespace boost::posix_time;
+
+namespace {
+
+// This test verifies that the durations of the stages are recorded in
+// order and that the durations of the stages marked twice are summed.
+TEST(CfgLoadProfilerTest, mark) {
+    CfgLoadProfiler profiler;
+    EXPECT_TRUE(profiler.getStages().empty());
+    EXPECT_EQ(0, profiler.getTotalDuration().total_microseconds());
+    EXPECT_EQ("total 0.000 ms", profiler.toText());
+
+    usleep(2000);
+    profiler.mark("defaults");
+    usleep(2000);
+    profiler.mark("subnet4");
+    usleep(2000);
+    profiler.mark("defaults");
+
+    std::vector<std::string> stages = profiler.getStages();
+    ASSERT_EQ(2, stages.size());
+    EXPECT_EQ("defaults", stages[0]);
+    EXPECT_EQ("subnet4", stages[1]);
+
+    EXPECT_GE(profiler.getDuration("defaults").total_microseconds(), 4000);
+    EXPECT_GE(profiler.getDuration("subnet4").total_microseconds(), 2000);
+    EXPECT_EQ(0, profiler.getDuration("commit").total_microseconds());
+    EXPECT_EQ(profiler.getDuration("defaults") +
+              profiler.getDuration("subnet4"),
+              profiler.getTotalDuration());
+
+    const std::string text = profiler.toText();
+    EXPECT_EQ(0, text.find("defaults "));
+    EXPECT_NE(std::string::npos, text.find(" ms, subnet4 "));
+    EXPECT_NE(std::string::npos, text.find(" ms, total "));
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,153 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/compact_lease4.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// Hardware address used by the tests.
+const uint8_t HWADDR[] = { 0x08, 0x00, 0x2b, 0x02, 0x3f, 0x4e };
+
+/// Client id used by the tests.
+const uint8_t CLIENTID[] = { 0x17, 0x34, 0xe2, 0xff, 0x09, 0x92, 0x54 };
+
+/// @brief Creates a lease with all fields set.
+///
+/// @param address Leased address.
+/// @param hostname Hostname.
+Lease4Ptr createLease(const std::string& address,
+                      const std::string& hostname = "host.example.org") {
+    HWAddrPtr hwaddr(new HWAddr(HWADDR, sizeof(HWADDR), HTYPE_ETHER));
+    hwaddr->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, CLIENTID,
+                               sizeof(CLIENTID), 3600, 1800, 2700,
+                               1505000000, 42, true, false, hostname));
+    lease->state_ = Lease::STATE_DECLINED;
+    return (lease);
+}
+
+// Checks the records hold all the fields of the leases.
+TEST(CompactLease4Test, toLease4) {
+    InternPool client_ids;
+    InternPool hostnames;
+    Lease4Ptr lease = createLease("192.0.2.3");
+    CompactLease4 record(*lease,
+                         client_ids.acquire(CLIENTID, sizeof(CLIENTID)),
+                         hostnames.acquire(lease->hostname_));
+    Lease4Ptr returned = record.toLease4();
+    ASSERT_TRUE(returned);
+    EXPECT_TRUE(*returned == *lease);
+    EXPECT_EQ(HWAddr::HWADDR_SOURCE_RAW, returned->hwaddr_->source_);
+    EXPECT_EQ(lease->getExpirationTime(), record.getExpirationTime());
+
+    // No hardware address, client id nor hostname.
+    lease->hwaddr_.reset();
+    lease->client_id_.reset();
+    lease->hostname_.clear();
+    lease->cltt_ = 0;
+    CompactLease4 empty_record(*lease, NULL, NULL);
+    returned = empty_record.toLease4();
+    ASSERT_TRUE(returned);
+    EXPECT_FALSE(returned->hwaddr_);
+    EXPECT_FALSE(returned->client_id_);
+    EXPECT_TRUE(*returned == *lease);
+    EXPECT_TRUE(empty_record.getHWAddrKey().size_ == 0);
+    EXPECT_TRUE(empty_record.getClientIdKey().size_ == 0);
+
+    // An empty hardware address is not the same as none.
+    lease->hwaddr_.reset(new HWAddr(std::vector<uint8_t>(), HTYPE_ETHER));
+    returned = CompactLease4(*lease, NULL, NULL).toLease4();
+    ASSERT_TRUE(returned->hwaddr_);
+    EXPECT_TRUE(returned->hwaddr_->hwaddr_.empty());
+}
+
+// Checks the client last transmission times out of range are rejected.
+TEST(CompactLease4Test, clttRange) {
+    Lease4Ptr lease = createLease("192.0.2.3");
+    lease->cltt_ = CompactLease4::CLTT_EPOCH - 0x80000000LL;
+    EXPECT_EQ(lease->cltt_, CompactLease4(*lease, NULL, NULL).getCltt());
+    lease->cltt_ = CompactLease4::CLTT_EPOCH + 0x7fffffffLL;
+    EXPECT_EQ(lease->cltt_, CompactLease4(*lease, NULL, NULL).getCltt());
+    lease->cltt_ = CompactLease4::CLTT_EPOCH + 0x80000000LL;
+    EXPECT_THROW(CompactLease4(*lease, NULL, NULL), OutOfRange);
+}
+
+// Checks the interned values are shared and released.
+TEST(CompactLease4Test, internPool) {
+    InternPool pool;
+    EXPECT_FALSE(pool.acquire(""));
+    const InternPool::Value* first = pool.acquire("foo");
+    const InternPool::Value* second = pool.acquire("foo");
+    const InternPool::Value* other = pool.acquire("bar");
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2, pool.size());
+
+    pool.release(first);
+    EXPECT_EQ(2, pool.size());
+    pool.release(second);
+    EXPECT_EQ(1, pool.size());
+    EXPECT_EQ("bar", other->first);
+    pool.release(other);
+    EXPECT_EQ(0, pool.size());
+}
+
+// Checks the storage maintains the interned values and the indexes.
+TEST(CompactLease4StorageTest, modify) {
+    CompactLease4Storage storage;
+    ASSERT_TRUE(storage.insert(createLease("192.0.2.1", "a.example.org")).second);
+    ASSERT_TRUE(storage.insert(createLease("192.0.2.2", "b.example.org")).second);
+    EXPECT_FALSE(storage.insert(createLease("192.0.2.2")).second);
+    EXPECT_EQ(2, storage.size());
+    EXPECT_EQ(1, storage.getClientIdCount());
+    EXPECT_EQ(2, storage.getHostnameCount());
+
+    // Search by client id and by hardware address and subnet id.
+    std::vector<uint8_t> client_id(CLIENTID, CLIENTID + sizeof(CLIENTID));
+    EXPECT_EQ(2, storage.get<ClientIdSubnetIdIndexTag>().count(
+                  boost::make_tuple(client_id, 42)));
+    std::vector<uint8_t> hwaddr(HWADDR, HWADDR + sizeof(HWADDR));
+    EXPECT_EQ(2, storage.get<HWAddressSubnetIdIndexTag>().count(
+                  boost::make_tuple(hwaddr)));
+    EXPECT_EQ(0, storage.get<HWAddressSubnetIdIndexTag>().count(
+                  boost::make_tuple(hwaddr, 43)));
+
+    // Replace the lease with one without client id.
+    CompactLease4Storage::const_iterator it = storage.find(IOAddress("192.0.2.2"));
+    ASSERT_TRUE(it != storage.end());
+    Lease4Ptr lease = createLease("192.0.2.2", "a.example.org");
+    lease->client_id_.reset();
+    EXPECT_TRUE(storage.replace(it, lease));
+    EXPECT_EQ(1, storage.getClientIdCount());
+    EXPECT_EQ(1, storage.getHostnameCount());
+    EXPECT_EQ(1, storage.get<ClientIdSubnetIdIndexTag>().count(
+                  boost::make_tuple(client_id, 42)));
+
+    // Remove the leases.
+    storage.erase(storage.find(IOAddress("192.0.2.1")));
+    EXPECT_EQ(0, storage.getClientIdCount());
+    EXPECT_EQ(1, storage.getHostnameCount());
+    storage.erase(storage.begin(), storage.end());
+    EXPECT_EQ(0, storage.size());
+    EXPECT_EQ(0, storage.getHostnameCount());
+
+    // IPv6 addresses are not found.
+    EXPECT_TRUE(storage.find(IOAddress("2001:db8::1")) == storage.end());
+}
+
+}
@@ -142,9 +142,8 @@ TEST(D2ClientConfigTest, constructorsAndAccessors) {
         "}\n";
     runToElementTest<D2ClientConfig>(expected, *d2_client_config);
 
-    // Verify that constructor does not allow use of NCR_TCP.
-    /// @todo obviously this becomes invalid once TCP is supported.
-    ASSERT_THROW(d2_client_config.reset(new
+    // Verify that constructor allows use of NCR_TCP with FMT_BINARY.
+    ASSERT_NO_THROW(d2_client_config.reset(new
                                         D2ClientConfig(enable_updates,
                                                        server_ip,
                                                        server_port,
@@ -152,14 +151,15 @@ TEST(D2ClientConfigTest, constructorsAndAccessors) {
                                                        sender_port,
                                                        max_queue_size,
                                                        dhcp_ddns::NCR_TCP,
-                                                       ncr_format,
+                                                       dhcp_ddns::FMT_BINARY,
                                                        always_include_fqdn,
                                                        override_no_update,
                                                        override_client_update,
                                                        replace_client_name_mode,
                                                        generated_prefix,
-                                                       qualifying_suffix)),
-                 D2ClientError);
+                                                       qualifying_suffix)));
+    EXPECT_EQ(dhcp_ddns::NCR_TCP, d2_client_config->getNcrProtocol());
+    EXPECT_EQ(dhcp_ddns::FMT_BINARY, d2_client_config->getNcrFormat());
 
     /// @todo if additional validation is added to ctor, this test needs to
     /// expand accordingly.
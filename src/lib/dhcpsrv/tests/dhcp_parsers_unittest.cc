@@ -19,6 +19,7 @@
 #include <dhcpsrv/cfg_mac_source.h>
 #include <dhcpsrv/parsers/dhcp_parsers.h>
 #include <dhcpsrv/parsers/option_data_parser.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
 #include <dhcpsrv/tests/test_libraries.h>
 #include <dhcpsrv/testutils/config_result_check.h>
 #include <exceptions/exceptions.h>
@@ -31,7 +32,10 @@
 #include <boost/pointer_cast.hpp>
 #include <boost/scoped_ptr.hpp>
 
+#include <algorithm>
+#include <iomanip>
 #include <map>
+#include <sstream>
 #include <string>
 
 using namespace std;
@@ -2128,22 +2132,6 @@ TEST_F(ParseConfigTest, invalidD2Config) {
         "     \"qualifying-suffix\" : \"test.suffix.\" "
         "    }"
         "}",
-        // Unsupported protocol
-        "{ \"dhcp-ddns\" :"
-        "    {"
-        "     \"enable-updates\" : true, "
-        "     \"server-ip\" : \"192.0.2.0\", "
-        "     \"server-port\" : 53001, "
-        "     \"ncr-protocol\" : \"TCP\", "
-        "     \"ncr-format\" : \"JSON\", "
-        "     \"always-include-fqdn\" : true, "
-        "     \"override-no-update\" : true, "
-        "     \"override-client-update\" : true, "
-        "     \"replace-client-name\" : true, "
-        "     \"generated-prefix\" : \"test.prefix\", "
-        "     \"qualifying-suffix\" : \"test.suffix.\" "
-        "    }"
-        "}",
         // Unknown format
         "{ \"dhcp-ddns\" :"
         "    {"
@@ -2376,6 +2364,93 @@ TEST_F(ParseConfigTest, bogusRelayInfo6) {
     EXPECT_THROW(parser.parse(result, json_bogus3), DhcpConfigError);
 }
 
+/// @brief Returns a DHCPv4 configuration with reservations in each subnet.
+///
+/// @param subnets Number of subnets.
+/// @param hosts Number of reservations per subnet.
+/// @param bogus_subnets Subnets (by index) in which the last reservation
+/// has no identifier.
+/// @return Subnet list with the default values set.
+ConstElementPtr
+createSubnets4(const size_t subnets, const size_t hosts,
+               const std::vector<size_t>& bogus_subnets =
+               std::vector<size_t>()) {
+    std::ostringstream s;
+    s << "{ \"renew-timer\": 1000, \"rebind-timer\": 2000,"
+      << " \"valid-lifetime\": 4000, \"subnet4\": [ ";
+    for (size_t i = 0; i < subnets; ++i) {
+        s << (i > 0 ? ", " : "") << "{ \"id\": " << i + 1
+          << ", \"subnet\": \"10.0." << i << ".0/24\", \"reservations\": [ ";
+        for (size_t j = 0; j < hosts; ++j) {
+            s << (j > 0 ? ", " : "") << "{ ";
+            if ((j + 1 < hosts) ||
+                (std::find(bogus_subnets.begin(), bogus_subnets.end(), i) ==
+                 bogus_subnets.end())) {
+                s << "\"hw-address\": \"01:02:03:04:" << std::hex
+                  << std::setw(2) << std::setfill('0') << i << ":"
+                  << std::setw(2) << j << std::dec << "\", ";
+            }
+            s << "\"ip-address\": \"10.0." << i << "." << j + 1 << "\" }";
+        }
+        s << " ] }";
+    }
+    s << " ] }";
+    ElementPtr config = Element::fromJSON(s.str());
+    SimpleParser4::setAllDefaults(config);
+    SimpleParser4::deriveParameters(config);
+    return (config->get("subnet4"));
+}
+
+/// @brief Checks that the reservations parsed by multiple threads are
+/// the same as the reservations parsed by a single thread.
+TEST_F(ParseConfigTest, parallelReservations4) {
+    ConstElementPtr subnets = createSubnets4(10, 30);
+
+    SrvConfigPtr cfg_single(new SrvConfig());
+    Subnets4ListConfigParser parser_single(1);
+    ASSERT_NO_THROW(parser_single.parse(cfg_single, subnets));
+
+    SrvConfigPtr cfg_parallel(new SrvConfig());
+    Subnets4ListConfigParser parser_parallel(4);
+    ASSERT_EQ(10, parser_parallel.parse(cfg_parallel, subnets));
+
+    for (unsigned i = 0; i < 10; ++i) {
+        for (unsigned j = 0; j < 30; ++j) {
+            std::ostringstream address;
+            address << "10.0." << i << "." << j + 1;
+            ConstHostPtr host_single = cfg_single->getCfgHosts()->
+                get4(SubnetID(i + 1), IOAddress(address.str()));
+            ConstHostPtr host_parallel = cfg_parallel->getCfgHosts()->
+                get4(SubnetID(i + 1), IOAddress(address.str()));
+            ASSERT_TRUE(host_single);
+            ASSERT_TRUE(host_parallel);
+            EXPECT_EQ(host_single->toText(), host_parallel->toText());
+        }
+    }
+}
+
+/// @brief Checks that the error reported for the reservations parsed by
+/// multiple threads is the error of the first invalid reservation.
+TEST_F(ParseConfigTest, parallelReservations4Error) {
+    std::vector<size_t> bogus_subnets;
+    bogus_subnets.push_back(3);
+    bogus_subnets.push_back(8);
+    ConstElementPtr subnets = createSubnets4(10, 5, bogus_subnets);
+
+    SrvConfigPtr cfg(new SrvConfig());
+    Subnets4ListConfigParser parser(4);
+    try {
+        parser.parse(cfg, subnets);
+        ADD_FAILURE() << "parse of invalid reservations did not fail";
+    } catch (const DhcpConfigError& ex) {
+        // The position of the first invalid reservation is reported.
+        const ConstElementPtr bogus = subnets->get(3)->get("reservations")->get(4);
+        EXPECT_NE(std::string::npos,
+                  std::string(ex.what()).find(bogus->getPosition().str()))
+            << ex.what();
+    }
+}
+
 // There's no test for ControlSocketParser, as it is tested in the DHCPv4 code
 // (see CtrlDhcpv4SrvTest.commandSocketBasic in
 // src/bin/dhcp4/tests/ctrl_dhcp4_srv_unittest.cc).
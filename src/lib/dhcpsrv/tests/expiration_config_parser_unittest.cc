@@ -237,6 +237,27 @@ TEST_F(ExpirationConfigParserTest, outOfRangeValues) {
                    CfgExpiration::LIMIT_UNWARNED_RECLAIM_CYCLES);
 }
 
+// This test verifies that the parameters of the background reclamation
+// may be configured.
+TEST_F(ExpirationConfigParserTest, backgroundReclamation) {
+    std::string config = "{ \"background-reclamation\": true,"
+        " \"reclaim-slice-leases\": 25,"
+        " \"max-reclaim-rate\": 500 }";
+    ElementPtr config_element = Element::fromJSON(config);
+
+    ExpirationConfigParser parser;
+    ASSERT_NO_THROW(parser.parse(config_element));
+
+    CfgExpirationPtr cfg = CfgMgr::instance().getStagingCfg()->getCfgExpiration();
+    EXPECT_TRUE(cfg->getBackgroundReclamation());
+    EXPECT_EQ(25, cfg->getReclaimSliceLeases());
+    EXPECT_EQ(500, cfg->getMaxReclaimRate());
+
+    // The slice must not be empty.
+    config_element = Element::fromJSON("{ \"reclaim-slice-leases\": 0 }");
+    EXPECT_THROW(parser.parse(config_element), DhcpConfigError);
+}
+
 // This test verifies that it is not allowed to specify a value as
 // a text.
 TEST_F(ExpirationConfigParserTest, notNumberValue) {
@@ -1219,6 +1219,118 @@ GenericLeaseMgrTest::testGetLease4ClientIdSubnetId() {
     EXPECT_FALSE(returned);
 }
 
+void
+GenericLeaseMgrTest::testGetLeases4SubnetId() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // There should be no leases in subnet with id 0.
+    Lease4Collection returned = lmptr_->getLeases4(SubnetID(0));
+    EXPECT_TRUE(returned.empty());
+
+    // Leases 1 and 2 belong to the same subnet.
+    returned = lmptr_->getLeases4(leases[1]->subnet_id_);
+    ASSERT_EQ(2, returned.size());
+
+    // The order of the returned leases is unspecified.
+    for (Lease4Collection::const_iterator lease = returned.begin();
+         lease != returned.end(); ++lease) {
+        if ((*lease)->addr_ == leases[1]->addr_) {
+            detailCompareLease(leases[1], *lease);
+        } else {
+            detailCompareLease(leases[2], *lease);
+        }
+    }
+
+    // Lease 0 is the only lease in its subnet.
+    returned = lmptr_->getLeases4(leases[0]->subnet_id_);
+    ASSERT_EQ(1, returned.size());
+    detailCompareLease(leases[0], *returned.begin());
+}
+
+void
+GenericLeaseMgrTest::testGetLeases4() {
+    // There are no leases yet.
+    Lease4Collection returned = lmptr_->getLeases4();
+    EXPECT_TRUE(returned.empty());
+
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // All leases should be returned.
+    returned = lmptr_->getLeases4();
+    ASSERT_EQ(leases.size(), returned.size());
+
+    // Make sure each lease has been returned.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        bool found = false;
+        for (Lease4Collection::const_iterator lease = returned.begin();
+             lease != returned.end(); ++lease) {
+            if ((*lease)->addr_ == leases[i]->addr_) {
+                detailCompareLease(leases[i], *lease);
+                found = true;
+                break;
+            }
+        }
+        EXPECT_TRUE(found) << "lease " << leases[i]->addr_ << " not returned";
+    }
+}
+
+void
+GenericLeaseMgrTest::testGetLeases4Paged() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases in pages of 3 starting from the zero address.
+    // The last address of each page is used as lower bound for the
+    // next page.
+    Lease4Collection all_leases;
+    IOAddress last_address = IOAddress("0.0.0.0");
+    for (int i = 0; i < 4; ++i) {
+        Lease4Collection page = lmptr_->getLeases4(last_address,
+                                                     LeasePageSize(3));
+        // Each page should contain at most 3 leases.
+        ASSERT_LE(page.size(), 3);
+        if (page.empty()) {
+            break;
+        }
+
+        // Addresses within the page must be increasing and greater than
+        // the lower bound.
+        for (Lease4Collection::const_iterator lease = page.begin();
+             lease != page.end(); ++lease) {
+            EXPECT_TRUE(last_address < (*lease)->addr_);
+            last_address = (*lease)->addr_;
+        }
+
+        all_leases.insert(all_leases.end(), page.begin(), page.end());
+    }
+
+    // All leases should have been returned exactly once.
+    ASSERT_EQ(leases.size(), all_leases.size());
+    for (size_t i = 0; i < leases.size(); ++i) {
+        detailCompareLease(leases[i], all_leases[i]);
+    }
+
+    // Using the address of the last lease as lower bound returns nothing.
+    EXPECT_TRUE(lmptr_->getLeases4(leases.back()->addr_,
+                                   LeasePageSize(3)).empty());
+
+    // Address of the wrong family should be rejected.
+    EXPECT_THROW(lmptr_->getLeases4(IOAddress("2001:db8::1"),
+                                    LeasePageSize(3)),
+                 InvalidAddressFamily);
+}
+
 void
 GenericLeaseMgrTest::testGetLeases6DuidIaid() {
     // Get the leases to be used for the test.
@@ -1449,6 +1561,118 @@ GenericLeaseMgrTest::testGetLease6DuidIaidSubnetIdSize() {
     // tests.
 }
 
+void
+GenericLeaseMgrTest::testGetLeases6SubnetId() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // There should be no leases in subnet with id 0.
+    Lease6Collection returned = lmptr_->getLeases6(SubnetID(0));
+    EXPECT_TRUE(returned.empty());
+
+    // Leases 1 and 2 belong to the same subnet.
+    returned = lmptr_->getLeases6(leases[1]->subnet_id_);
+    ASSERT_EQ(2, returned.size());
+
+    // The order of the returned leases is unspecified.
+    for (Lease6Collection::const_iterator lease = returned.begin();
+         lease != returned.end(); ++lease) {
+        if ((*lease)->addr_ == leases[1]->addr_) {
+            detailCompareLease(leases[1], *lease);
+        } else {
+            detailCompareLease(leases[2], *lease);
+        }
+    }
+
+    // Lease 0 is the only lease in its subnet.
+    returned = lmptr_->getLeases6(leases[0]->subnet_id_);
+    ASSERT_EQ(1, returned.size());
+    detailCompareLease(leases[0], *returned.begin());
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6() {
+    // There are no leases yet.
+    Lease6Collection returned = lmptr_->getLeases6();
+    EXPECT_TRUE(returned.empty());
+
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // All leases should be returned.
+    returned = lmptr_->getLeases6();
+    ASSERT_EQ(leases.size(), returned.size());
+
+    // Make sure each lease has been returned.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        bool found = false;
+        for (Lease6Collection::const_iterator lease = returned.begin();
+             lease != returned.end(); ++lease) {
+            if ((*lease)->addr_ == leases[i]->addr_) {
+                detailCompareLease(leases[i], *lease);
+                found = true;
+                break;
+            }
+        }
+        EXPECT_TRUE(found) << "lease " << leases[i]->addr_ << " not returned";
+    }
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6Paged() {
+    // Get the leases to be used for the test and add to the database.
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases in pages of 3 starting from the zero address.
+    // The last address of each page is used as lower bound for the
+    // next page.
+    Lease6Collection all_leases;
+    IOAddress last_address = IOAddress("::");
+    for (int i = 0; i < 4; ++i) {
+        Lease6Collection page = lmptr_->getLeases6(last_address,
+                                                     LeasePageSize(3));
+        // Each page should contain at most 3 leases.
+        ASSERT_LE(page.size(), 3);
+        if (page.empty()) {
+            break;
+        }
+
+        // Addresses within the page must be increasing and greater than
+        // the lower bound.
+        for (Lease6Collection::const_iterator lease = page.begin();
+             lease != page.end(); ++lease) {
+            EXPECT_TRUE(last_address < (*lease)->addr_);
+            last_address = (*lease)->addr_;
+        }
+
+        all_leases.insert(all_leases.end(), page.begin(), page.end());
+    }
+
+    // All leases should have been returned exactly once.
+    ASSERT_EQ(leases.size(), all_leases.size());
+    for (size_t i = 0; i < leases.size(); ++i) {
+        detailCompareLease(leases[i], all_leases[i]);
+    }
+
+    // Using the address of the last lease as lower bound returns nothing.
+    EXPECT_TRUE(lmptr_->getLeases6(leases.back()->addr_,
+                                   LeasePageSize(3)).empty());
+
+    // Address of the wrong family should be rejected.
+    EXPECT_THROW(lmptr_->getLeases6(IOAddress("192.0.2.1"),
+                                    LeasePageSize(3)),
+                 InvalidAddressFamily);
+}
+
 void
 GenericLeaseMgrTest::testUpdateLease4() {
     // Get the leases to be used for the test and add them to the database.
@@ -200,6 +200,15 @@ public:
     /// a combination of client and subnet IDs.
     void testGetLease4ClientIdSubnetId();
 
+    /// @brief Test method which returns all IPv4 leases for Subnet ID.
+    void testGetLeases4SubnetId();
+
+    /// @brief Test method which returns all IPv4 leases.
+    void testGetLeases4();
+
+    /// @brief Test method which returns range of IPv4 leases with paging.
+    void testGetLeases4Paged();
+
     /// @brief Basic Lease4 Checks
     ///
     /// Checks that the addLease, getLease4(by address), getLease4(hwaddr,subnet_id),
@@ -267,6 +276,15 @@ public:
     /// @brief Checks that getLease6() works with different DUID sizes
     void testGetLease6DuidIaidSubnetIdSize();
 
+    /// @brief Test method which returns all IPv6 leases for Subnet ID.
+    void testGetLeases6SubnetId();
+
+    /// @brief Test method which returns all IPv6 leases.
+    void testGetLeases6();
+
+    /// @brief Test method which returns range of IPv6 leases with paging.
+    void testGetLeases6Paged();
+
     /// @brief Verify that too long hostname for Lease4 is not accepted.
     ///
     /// Checks that the it is not possible to create a lease when the hostname
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include <time.h>
@@ -162,6 +163,63 @@ public:
         return (leases6_);
     }
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4(SubnetID) const {
+        return (Lease4Collection());
+    }
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4() const {
+        return (Lease4Collection());
+    }
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& /* lower_bound_address */,
+               const LeasePageSize& /* page_size */) const {
+        return (Lease4Collection());
+    }
+
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return whatever is set in leases6_ field
+    virtual Lease6Collection getLeases6(SubnetID) const {
+        return (leases6_);
+    }
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return whatever is set in leases6_ field
+    virtual Lease6Collection getLeases6() const {
+        return (leases6_);
+    }
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return whatever is set in leases6_ field
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& /* lower_bound_address */,
+               const LeasePageSize& /* page_size */) const {
+        return (leases6_);
+    }
 
     /// @brief Returns expired DHCPv6 leases.
     ///
@@ -336,6 +394,15 @@ TEST_F(LeaseMgrTest, getLease6) {
                  MultipleRecords);
 }
 
+// Verify that the page size can't be 0 or exceed the 32-bit range.
+TEST(LeasePageSizeTest, boundaries) {
+    EXPECT_THROW(LeasePageSize(0), OutOfRange);
+    EXPECT_THROW(LeasePageSize(std::numeric_limits<uint32_t>::max() + 1ull),
+                 OutOfRange);
+    EXPECT_NO_THROW(LeasePageSize(1));
+    EXPECT_NO_THROW(LeasePageSize(std::numeric_limits<uint32_t>::max()));
+}
+
 // There's no point in calling any other methods in LeaseMgr, as they
 // are purely virtual, so we would only call ConcreteLeaseMgr methods.
 // Those methods are just stubs that do not return anything.
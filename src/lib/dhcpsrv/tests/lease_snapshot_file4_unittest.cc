@@ -0,0 +1,225 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/lease_snapshot_file4.h>
+#include <dhcpsrv/tests/lease_file_io.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <utime.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Test fixture class for @c LeaseSnapshotFile4.
+class LeaseSnapshotFile4Test : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the test files.
+    LeaseSnapshotFile4Test()
+        : lease_file_(absolutePath("leases4.csv")),
+          snapshot_file_(absolutePath("leases4.csv.snapshot")),
+          lease_io_(lease_file_), snapshot_io_(snapshot_file_),
+          tmp_io_(snapshot_file_ + ".tmp") {
+    }
+
+    /// @brief Prepends the absolute path to the file specified
+    /// as an argument.
+    ///
+    /// @param filename Name of the file.
+    /// @return Absolute path to the test file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << DHCP_DATA_DIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Creates a cleaned-up lease file.
+    ///
+    /// @param hostname Hostname of the last lease.
+    void writeLeaseFile(const std::string& hostname = "host.example.com") {
+        lease_io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,"
+                            "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n"
+                            "192.0.2.1,06:07:08:09:0a:bc,,200,1500000200,8,"
+                            "1,1,,0\n"
+                            "192.0.2.2,,a:11:01:04,200,1500000200,8,0,0,,1\n"
+                            "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                            "100,1500000100,7,1,0," + hostname + ",2\n");
+    }
+
+    /// @brief Loads the leases from the lease file.
+    ///
+    /// @param [out] storage Storage for the leases.
+    void loadLeaseFile(CompactLease4Storage& storage) {
+        CSVLeaseFile4 lease_file(lease_file_);
+        LeaseFileLoader::load<Lease4>(lease_file, storage);
+    }
+
+    /// @brief Checks that two storages hold the same leases.
+    ///
+    /// @param expected Expected leases.
+    /// @param storage Leases to be checked.
+    void checkLeases(const CompactLease4Storage& expected,
+                     const CompactLease4Storage& storage) {
+        ASSERT_EQ(expected.size(), storage.size());
+        CompactLease4Storage::const_iterator it = storage.begin();
+        for (CompactLease4Storage::const_iterator exp = expected.begin();
+             exp != expected.end(); ++exp, ++it) {
+            Lease4Ptr exp_lease = exp->toLease4();
+            Lease4Ptr lease = it->toLease4();
+            EXPECT_TRUE(*exp_lease == *lease)
+                << "expected: " << exp_lease->toText() << std::endl
+                << "actual: " << lease->toText();
+        }
+    }
+
+    /// @brief Name of the lease file.
+    std::string lease_file_;
+
+    /// @brief Name of the snapshot file.
+    std::string snapshot_file_;
+
+    /// @brief Object providing access to the lease file.
+    LeaseFileIO lease_io_;
+
+    /// @brief Object providing access to the snapshot file.
+    LeaseFileIO snapshot_io_;
+
+    /// @brief Object removing the temporary snapshot file.
+    LeaseFileIO tmp_io_;
+};
+
+// Checks that the leases loaded from the snapshot are the leases of the
+// lease file.
+TEST_F(LeaseSnapshotFile4Test, writeAndLoad) {
+    writeLeaseFile();
+    uint64_t count = 0;
+    ASSERT_NO_THROW(count = LeaseSnapshotFile4::write(lease_file_,
+                                                      snapshot_file_));
+    EXPECT_EQ(3, count);
+    EXPECT_TRUE(snapshot_io_.exists());
+    EXPECT_FALSE(tmp_io_.exists());
+
+    CompactLease4Storage expected;
+    loadLeaseFile(expected);
+
+    CompactLease4Storage storage;
+    bool loaded = false;
+    ASSERT_NO_THROW(loaded = LeaseSnapshotFile4::load(lease_file_,
+                                                      snapshot_file_,
+                                                      storage));
+    ASSERT_TRUE(loaded);
+    checkLeases(expected, storage);
+    EXPECT_EQ(2, storage.getClientIdCount());
+    EXPECT_EQ(1, storage.getHostnameCount());
+
+    // The leases can be searched by all indexes.
+    std::vector<uint8_t> hwaddr(6);
+    hwaddr[0] = 0x06; hwaddr[1] = 0x07; hwaddr[2] = 0x08;
+    hwaddr[3] = 0x09; hwaddr[4] = 0x0a; hwaddr[5] = 0xbc;
+    EXPECT_EQ(1, storage.get<HWAddressSubnetIdIndexTag>().count(
+                  boost::make_tuple(hwaddr, SubnetID(8))));
+}
+
+// Checks that the snapshot is not loaded for another lease file.
+TEST_F(LeaseSnapshotFile4Test, stale) {
+    CompactLease4Storage storage;
+
+    // No snapshot.
+    writeLeaseFile();
+    EXPECT_FALSE(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                          storage));
+
+    // The lease file has been modified since the snapshot was written.
+    ASSERT_NO_THROW(LeaseSnapshotFile4::write(lease_file_, snapshot_file_));
+    writeLeaseFile("another.example.com");
+    EXPECT_FALSE(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                          storage));
+    EXPECT_EQ(0, storage.size());
+}
+
+// Checks that the snapshot, rather than the lease file, is loaded when it
+// mirrors the lease file.
+TEST_F(LeaseSnapshotFile4Test, snapshotUsed) {
+    writeLeaseFile();
+    ASSERT_NO_THROW(LeaseSnapshotFile4::write(lease_file_, snapshot_file_));
+
+    // Rewrite the lease file with a hostname of the same length, keeping
+    // its inode, size and modification time.
+    struct stat st;
+    ASSERT_EQ(0, stat(lease_file_.c_str(), &st));
+    writeLeaseFile("HOST.EXAMPLE.COM");
+    struct utimbuf times;
+    times.actime = st.st_atime;
+    times.modtime = st.st_mtime;
+    ASSERT_EQ(0, utime(lease_file_.c_str(), &times));
+
+    CompactLease4Storage storage;
+    ASSERT_TRUE(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                         storage));
+    CompactLease4Storage::const_iterator it =
+        storage.find(IOAddress("192.0.3.15"));
+    ASSERT_TRUE(it != storage.end());
+    EXPECT_EQ("host.example.com", it->toLease4()->hostname_);
+}
+
+// Checks that a lease file which was not cleaned up is rejected.
+TEST_F(LeaseSnapshotFile4Test, notCleanedUp) {
+    lease_io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,"
+                        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n"
+                        "192.0.2.2,06:07:08:09:0a:bc,,200,200,8,1,1,,0\n"
+                        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,,0\n");
+    EXPECT_THROW(LeaseSnapshotFile4::write(lease_file_, snapshot_file_),
+                 LeaseSnapshotError);
+    EXPECT_FALSE(snapshot_io_.exists());
+    EXPECT_FALSE(tmp_io_.exists());
+
+    lease_io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,"
+                        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n"
+                        "192.0.2.1,06:07:08:09:0a:bc,,0,200,8,1,1,,0\n");
+    EXPECT_THROW(LeaseSnapshotFile4::write(lease_file_, snapshot_file_),
+                 LeaseSnapshotError);
+}
+
+// Checks that an invalid snapshot is rejected.
+TEST_F(LeaseSnapshotFile4Test, invalid) {
+    writeLeaseFile();
+    ASSERT_NO_THROW(LeaseSnapshotFile4::write(lease_file_, snapshot_file_));
+    std::string contents = snapshot_io_.readFile();
+    ASSERT_GT(contents.size(), 1);
+
+    // Truncated snapshot.
+    snapshot_io_.writeFile(contents.substr(0, contents.size() - 1));
+    CompactLease4Storage storage;
+    EXPECT_THROW(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                          storage), LeaseSnapshotError);
+
+    // Trailing data.
+    snapshot_io_.writeFile(contents + "x");
+    storage.clear();
+    EXPECT_THROW(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                          storage), LeaseSnapshotError);
+
+    // Not a snapshot.
+    snapshot_io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,"
+                           "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n");
+    storage.clear();
+    EXPECT_THROW(LeaseSnapshotFile4::load(lease_file_, snapshot_file_,
+                                          storage), LeaseSnapshotError);
+}
+
+}
@@ -13,6 +13,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/lease_snapshot_file4.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcpsrv/tests/lease_file_io.h>
@@ -160,6 +161,9 @@ public:
             LeaseFileIO io(Memfile_LeaseMgr::appendSuffix(base_name, type));
             io.removeFile();
         }
+        LeaseFileIO io(Memfile_LeaseMgr::appendSuffix(base_name,
+                                                      Memfile_LeaseMgr::FILE_SNAPSHOT));
+        io.removeFile();
     }
 
     /// @brief Return path to the lease file used by unit tests.
@@ -488,6 +492,48 @@ TEST_F(MemfileLeaseMgrTest, lfcTimerDisabled) {
     EXPECT_EQ(0, lease_mgr->getLFCCount());
 }
 
+// This test checks the arguments passed to the kea-lfc program.
+TEST_F(MemfileLeaseMgrTest, lfcCommandLine) {
+    std::string lease_file = getLeaseFilePath("leasefile4_0.csv");
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = lease_file;
+    pmap["lfc-interval"] = "1";
+
+    boost::scoped_ptr<LFCMemfileLeaseMgr>
+        lease_mgr(new LFCMemfileLeaseMgr(pmap));
+
+    std::ostringstream s;
+    s << KEA_LFC_BUILD_DIR << "/kea-lfc -4"
+      << " -x " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_PREVIOUS)
+      << " -i " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_INPUT)
+      << " -o " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_OUTPUT)
+      << " -f " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_FINISH)
+      << " -p " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_PID)
+      << " -s " << Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                  Memfile_LeaseMgr::FILE_SNAPSHOT)
+      << " -m 100000 -c ignored-path";
+    EXPECT_EQ(s.str(), lease_mgr->getLFCCommandLine());
+
+    // The snapshot is only written for the DHCPv4 leases.
+    lease_file = getLeaseFilePath("leasefile6_0.csv");
+    pmap["universe"] = "6";
+    pmap["name"] = lease_file;
+    lease_mgr.reset();
+    lease_mgr.reset(new LFCMemfileLeaseMgr(pmap));
+
+    std::string cmd = lease_mgr->getLFCCommandLine();
+    EXPECT_EQ(0, cmd.find(std::string(KEA_LFC_BUILD_DIR) + "/kea-lfc -6 "));
+    EXPECT_EQ(std::string::npos, cmd.find(" -s "));
+    EXPECT_NE(std::string::npos, cmd.find(" -m 100000 -c ignored-path"));
+}
+
 // This test checks that the callback function executing the cleanup of the
 // DHCPv4 lease file works as expected.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4) {
@@ -915,6 +961,24 @@ TEST_F(MemfileLeaseMgrTest, getLease4ClientIdSubnetId) {
     testGetLease4ClientIdSubnetId();
 }
 
+// This test checks that all IPv4 leases for a specified subnet id are returned.
+TEST_F(MemfileLeaseMgrTest, getLeases4SubnetId) {
+    startBackend(V4);
+    testGetLeases4SubnetId();
+}
+
+// This test checks that all IPv4 leases are returned.
+TEST_F(MemfileLeaseMgrTest, getLeases4) {
+    startBackend(V4);
+    testGetLeases4();
+}
+
+// Test that a range of IPv4 leases is returned with paging.
+TEST_F(MemfileLeaseMgrTest, getLeases4Paged) {
+    startBackend(V4);
+    testGetLeases4Paged();
+}
+
 /// @brief Basic Lease6 Checks
 ///
 /// Checks that the addLease, getLease6 (by address) and deleteLease (with an
@@ -1007,6 +1071,24 @@ TEST_F(MemfileLeaseMgrTest, getLease6DuidIaidSubnetIdSize) {
     testGetLease6DuidIaidSubnetIdSize();
 }
 
+// This test checks that all IPv6 leases for a specified subnet id are returned.
+TEST_F(MemfileLeaseMgrTest, getLeases6SubnetId) {
+    startBackend(V6);
+    testGetLeases6SubnetId();
+}
+
+// This test checks that all IPv6 leases are returned.
+TEST_F(MemfileLeaseMgrTest, getLeases6) {
+    startBackend(V6);
+    testGetLeases6();
+}
+
+// Test that a range of IPv6 leases is returned with paging.
+TEST_F(MemfileLeaseMgrTest, getLeases6Paged) {
+    startBackend(V6);
+    testGetLeases6Paged();
+}
+
 /// @brief Lease4 update tests
 ///
 /// Checks that we are able to update a lease in the database.
@@ -1207,6 +1289,54 @@ TEST_F(MemfileLeaseMgrTest, load4CompletedFile) {
     EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
 }
 
+// This test checks that the leases of the previous lease file are loaded
+// from its snapshot when it mirrors the file, and that the updates recorded
+// in the lease files written since then are applied.
+TEST_F(MemfileLeaseMgrTest, load4Snapshot) {
+    LeaseFileIO io2(getLeaseFilePath("leasefile4_0.csv.2"));
+    io2.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state\n"
+                  "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+                  "192.0.2.11,bb:bb:bb:bb:bb:bb,,200,200,8,1,1,,1\n");
+    std::string snapshot_file =
+        Memfile_LeaseMgr::appendSuffix(getLeaseFilePath("leasefile4_0.csv"),
+                                       Memfile_LeaseMgr::FILE_SNAPSHOT);
+    ASSERT_NO_THROW(LeaseSnapshotFile4::write(getLeaseFilePath("leasefile4_0.csv.2"),
+                                              snapshot_file));
+
+    LeaseFileIO io1(getLeaseFilePath("leasefile4_0.csv.1"));
+    io1.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state\n"
+                  "192.0.2.11,bb:bb:bb:bb:bb:bb,,200,400,8,1,1,,1\n");
+
+    LeaseFileIO io(getLeaseFilePath("leasefile4_0.csv"));
+    io.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                 "fqdn_fwd,fqdn_rev,hostname,state\n"
+                 "192.0.2.2,02:02:02:02:02:02,,0,200,8,1,1,,1\n"
+                 "192.0.2.10,0a:0a:0a:0a:0a:0a,,200,200,8,1,1,,1\n");
+
+    startBackend(V4);
+
+    // The lease of the snapshot was removed by the current file.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+
+    // The lease of the snapshot was updated by the .1 file.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.11"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(200, lease->cltt_);
+
+    lease = lmptr_->getLease4(IOAddress("192.0.2.10"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(0, lease->cltt_);
+
+    // A snapshot which doesn't mirror the previous file is ignored.
+    io2.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state\n"
+                  "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1\n");
+    startBackend(V4);
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.3")));
+}
+
 // This test checks that backend constructor refuses to load leases from the
 // lease files if the LFC is in progress.
 TEST_F(MemfileLeaseMgrTest, load4LFCInProgress) {
@@ -1894,6 +2024,104 @@ TEST_F(MemfileLeaseMgrTest, recountLeaseStats6) {
     testRecountLeaseStats6();
 }
 
+/// @brief Runs the lease statistics query and returns its rows.
+///
+/// @param query Lease statistics query.
+/// @return Lease counts indexed by subnet id, lease type and lease state.
+LeaseStateCounters::CounterMap
+getLeaseStatsRows(const LeaseStatsQueryPtr& query) {
+    LeaseStateCounters::CounterMap rows;
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        rows[LeaseStateCounters::Key(row.subnet_id_, row.lease_type_,
+                                     row.lease_state_)] = row.state_count_;
+    }
+    return (rows);
+}
+
+// Verifies that the IPv4 lease statistics query follows the lease updates
+// and deletions without recounting all leases, and that the counts are
+// restored when the leases are reloaded from the lease file.
+TEST_F(MemfileLeaseMgrTest, leaseStatsQuery4Counters) {
+    startBackend(V4);
+    makeLease4("192.0.1.1", 1);
+    makeLease4("192.0.1.2", 1);
+    makeLease4("192.0.1.3", 1, Lease::STATE_DECLINED);
+
+    LeaseStateCounters::CounterMap expected;
+    expected[LeaseStateCounters::Key(1, Lease::TYPE_NA,
+                                     Lease::STATE_DEFAULT)] = 2;
+    expected[LeaseStateCounters::Key(1, Lease::TYPE_NA,
+                                     Lease::STATE_DECLINED)] = 1;
+    EXPECT_TRUE(expected == getLeaseStatsRows(lmptr_->startLeaseStatsQuery4()));
+
+    // Decline an assigned lease.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.1.1"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    // Move an assigned lease to another subnet.
+    lease = lmptr_->getLease4(IOAddress("192.0.1.2"));
+    ASSERT_TRUE(lease);
+    lease->subnet_id_ = 2;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    // Reclaim a declined lease and remove it from the database.
+    lease = lmptr_->getLease4(IOAddress("192.0.1.3"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+    EXPECT_EQ(1, lmptr_->deleteExpiredReclaimedLeases4(0));
+
+    expected.clear();
+    expected[LeaseStateCounters::Key(1, Lease::TYPE_NA,
+                                     Lease::STATE_DECLINED)] = 1;
+    expected[LeaseStateCounters::Key(2, Lease::TYPE_NA,
+                                     Lease::STATE_DEFAULT)] = 1;
+    EXPECT_TRUE(expected == getLeaseStatsRows(lmptr_->startLeaseStatsQuery4()));
+
+    // Reload the leases from the lease file.
+    LeaseMgrFactory::destroy();
+    startBackend(V4);
+    EXPECT_TRUE(expected == getLeaseStatsRows(lmptr_->startLeaseStatsQuery4()));
+
+    // Remove all leases.
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.1.1")));
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.1.2")));
+    EXPECT_TRUE(getLeaseStatsRows(lmptr_->startLeaseStatsQuery4()).empty());
+}
+
+// Verifies that the IPv6 lease statistics query follows the lease updates
+// and deletions without recounting all leases.
+TEST_F(MemfileLeaseMgrTest, leaseStatsQuery6Counters) {
+    startBackend(V6);
+    makeLease6(Lease::TYPE_NA, "3001:1::1", 0, 1);
+    makeLease6(Lease::TYPE_NA, "3001:1::2", 0, 1);
+    makeLease6(Lease::TYPE_PD, "3001:1:2:0100::", 112, 1);
+
+    // Decline an assigned address.
+    Lease6Ptr lease = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("3001:1::1"));
+    ASSERT_TRUE(lease);
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lmptr_->updateLease6(lease));
+
+    // Remove the prefix.
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("3001:1:2:0100::")));
+
+    LeaseStateCounters::CounterMap expected;
+    expected[LeaseStateCounters::Key(1, Lease::TYPE_NA,
+                                     Lease::STATE_DEFAULT)] = 1;
+    expected[LeaseStateCounters::Key(1, Lease::TYPE_NA,
+                                     Lease::STATE_DECLINED)] = 1;
+    EXPECT_TRUE(expected == getLeaseStatsRows(lmptr_->startLeaseStatsQuery6()));
+
+    // Reload the leases from the lease file.
+    LeaseMgrFactory::destroy();
+    startBackend(V6);
+    EXPECT_TRUE(expected == getLeaseStatsRows(lmptr_->startLeaseStatsQuery6()));
+}
+
 // Tests that leases from specific subnet can be removed.
 TEST_F(MemfileLeaseMgrTest, wipeLeases4) {
     startBackend(V4);
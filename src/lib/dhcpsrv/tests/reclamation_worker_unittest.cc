@@ -0,0 +1,263 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/reclamation_worker.h>
+#include <dhcpsrv/timer_mgr.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <sys/socket.h>
+#include <time.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Number of leases created by the tests.
+const uint16_t TEST_LEASES_NUM = 100;
+
+/// @brief Test fixture class for the @c ReclamationWorker.
+class ReclamationWorkerTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the in-memory lease database, the allocation engine and
+    /// the lease expiration configuration with the background reclamation
+    /// enabled.
+    ReclamationWorkerTest()
+        : io_service_(new IOService()),
+          timer_mgr_(TimerMgr::instance()),
+          cfg_(new CfgExpiration()) {
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+        timer_mgr_->unregisterTimers();
+        timer_mgr_->setIOService(io_service_);
+        LeaseMgrFactory::create(lease_db_access_);
+        engine_.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE, 100, false));
+        cfg_->setBackgroundReclamation(true);
+    }
+
+    /// @brief Destructor.
+    virtual ~ReclamationWorkerTest() {
+        worker_.reset();
+        timer_mgr_->unregisterTimers();
+        LeaseMgrFactory::destroy();
+        StatsMgr::instance().removeAll();
+        CfgMgr::instance().clear();
+    }
+
+    /// @brief Creates expired leases in the lease database.
+    ///
+    /// @param expired_secs Number of seconds since the leases expired.
+    void createLeases(const time_t expired_secs) {
+        for (uint16_t i = 0; i < TEST_LEASES_NUM; ++i) {
+            std::ostringstream hwaddr_s;
+            hwaddr_s << "01:02:03:04:" << std::setw(2) << std::setfill('0')
+                     << (i >> 8) << ":" << std::setw(2) << std::setfill('0')
+                     << (i & 0x00FF);
+            HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText(hwaddr_s.str(),
+                                                         HTYPE_ETHER)));
+            std::ostringstream address_s;
+            address_s << "10.0." << (i >> 8) << "." << (i & 0x00FF);
+
+            Lease4Ptr lease(new Lease4(IOAddress(address_s.str()), hwaddr,
+                                       ClientIdPtr(), 60, 10, 20,
+                                       time(NULL) - 60 - expired_secs,
+                                       SubnetID(1)));
+            ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+        }
+    }
+
+    /// @brief Returns the number of leases which haven't been reclaimed.
+    size_t countExpiredLeases() const {
+        Lease4Collection leases;
+        LeaseMgrFactory::instance().getExpiredLeases4(leases, 0);
+        return (leases.size());
+    }
+
+    /// @brief Creates and starts the worker.
+    void startWorker() {
+        ASSERT_NO_THROW(worker_.reset(new ReclamationWorker(AF_INET, engine_,
+                                                            cfg_,
+                                                            lease_db_access_)));
+        ASSERT_NO_THROW(worker_->start());
+        // The in-memory database doesn't support multiple connections.
+        ASSERT_FALSE(worker_->isThreaded());
+    }
+
+    /// @brief Runs the IO service until the reclamation cycle completes
+    /// or the timeout occurs.
+    ///
+    /// @param timeout_ms Timeout in milliseconds.
+    void runUntilCycleComplete(const long timeout_ms) {
+        bool timed_out = false;
+        IntervalTimer timer(*io_service_);
+        timer.setup([&timed_out]() { timed_out = true; }, timeout_ms,
+                    IntervalTimer::ONE_SHOT);
+        while (worker_->cycleInProgress() && !timed_out) {
+            io_service_->run_one();
+        }
+        ASSERT_FALSE(timed_out) << "reclamation cycle hasn't completed";
+    }
+
+    /// @brief Lease database access string.
+    static const std::string lease_db_access_;
+
+    /// @brief Pointer to the IO service used by the tests.
+    IOServicePtr io_service_;
+
+    /// @brief Pointer to the @c TimerMgr.
+    TimerMgrPtr timer_mgr_;
+
+    /// @brief Allocation engine used to reclaim leases.
+    AllocEnginePtr engine_;
+
+    /// @brief Lease expiration configuration.
+    CfgExpirationPtr cfg_;
+
+    /// @brief Worker under test.
+    ReclamationWorkerPtr worker_;
+};
+
+const std::string ReclamationWorkerTest::lease_db_access_ =
+    "type=memfile universe=4 persist=false";
+
+// Test that the constructor validates its arguments.
+TEST_F(ReclamationWorkerTest, constructor) {
+    EXPECT_THROW(ReclamationWorker(AF_UNIX, engine_, cfg_, lease_db_access_),
+                 BadValue);
+    EXPECT_THROW(ReclamationWorker(AF_INET, AllocEnginePtr(), cfg_,
+                                   lease_db_access_),
+                 BadValue);
+    EXPECT_THROW(ReclamationWorker(AF_INET, engine_, ConstCfgExpirationPtr(),
+                                   lease_db_access_),
+                 BadValue);
+    EXPECT_NO_THROW(ReclamationWorker(AF_INET6, engine_, cfg_,
+                                      lease_db_access_));
+}
+
+// Test that the slice interval and size are selected according to the
+// configured rate limit.
+TEST_F(ReclamationWorkerTest, sliceParameters) {
+    // No rate limit: slices of the configured size as often as possible.
+    cfg_->setReclaimSliceLeases(50);
+    ReclamationWorker unlimited(AF_INET, engine_, cfg_, lease_db_access_);
+    EXPECT_EQ(1, unlimited.getSliceInterval());
+    EXPECT_EQ(50, unlimited.getSliceSize());
+
+    // 100 leases per second in slices of 50 leases: one slice every 500ms.
+    cfg_->setMaxReclaimRate(100);
+    ReclamationWorker slow(AF_INET, engine_, cfg_, lease_db_access_);
+    EXPECT_EQ(500, slow.getSliceInterval());
+    EXPECT_EQ(50, slow.getSliceSize());
+
+    // The rate is so high that the interval can't be lower than 1ms.
+    cfg_->setMaxReclaimRate(20000);
+    ReclamationWorker fast(AF_INET, engine_, cfg_, lease_db_access_);
+    EXPECT_EQ(2, fast.getSliceInterval());
+    EXPECT_EQ(40, fast.getSliceSize());
+}
+
+// Test that all expired leases are reclaimed in multiple slices.
+TEST_F(ReclamationWorkerTest, reclaimAll) {
+    cfg_->setReclaimSliceLeases(10);
+    ASSERT_NO_FATAL_FAILURE(createLeases(5));
+    ASSERT_EQ(TEST_LEASES_NUM, countExpiredLeases());
+
+    ASSERT_NO_FATAL_FAILURE(startWorker());
+    worker_->startCycle(0, 0, false, 0);
+    EXPECT_TRUE(worker_->cycleInProgress());
+
+    ASSERT_NO_FATAL_FAILURE(runUntilCycleComplete(5000));
+    EXPECT_EQ(0, countExpiredLeases());
+
+    // All leases are reclaimed so there is no lag.
+    ObservationPtr lag = StatsMgr::instance().getObservation("reclamation-lag");
+    ASSERT_TRUE(lag);
+    EXPECT_EQ(0, lag->getInteger().first);
+}
+
+// Test that the cycle ends when the maximum number of leases is reclaimed.
+TEST_F(ReclamationWorkerTest, maxLeases) {
+    cfg_->setReclaimSliceLeases(7);
+    ASSERT_NO_FATAL_FAILURE(createLeases(100));
+
+    ASSERT_NO_FATAL_FAILURE(startWorker());
+    worker_->startCycle(30, 0, true, 0);
+    ASSERT_NO_FATAL_FAILURE(runUntilCycleComplete(5000));
+
+    // The slice is trimmed such that exactly 30 leases are reclaimed.
+    EXPECT_EQ(TEST_LEASES_NUM - 30, countExpiredLeases());
+
+    // The remaining leases expired about 100 seconds ago.
+    ObservationPtr lag = StatsMgr::instance().getObservation("reclamation-lag");
+    ASSERT_TRUE(lag);
+    EXPECT_GE(lag->getInteger().first, 100);
+
+    // The next cycle reclaims the remaining leases.
+    worker_->startCycle(0, 0, true, 0);
+    ASSERT_NO_FATAL_FAILURE(runUntilCycleComplete(5000));
+    EXPECT_EQ(0, countExpiredLeases());
+}
+
+// Test that the leases renewed after they have been fetched are not
+// reclaimed.
+TEST_F(ReclamationWorkerTest, renewedLeases) {
+    cfg_->setReclaimSliceLeases(10);
+    ASSERT_NO_FATAL_FAILURE(createLeases(5));
+
+    ASSERT_NO_FATAL_FAILURE(startWorker());
+    worker_->startCycle(0, 0, false, 0);
+
+    // Renew all leases before the first slice is executed.
+    Lease4Collection leases;
+    LeaseMgrFactory::instance().getExpiredLeases4(leases, 0);
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        (*lease)->cltt_ = time(NULL);
+        LeaseMgrFactory::instance().updateLease4(*lease);
+    }
+
+    ASSERT_NO_FATAL_FAILURE(runUntilCycleComplete(5000));
+
+    for (uint16_t i = 0; i < TEST_LEASES_NUM; ++i) {
+        std::ostringstream address_s;
+        address_s << "10.0." << (i >> 8) << "." << (i & 0x00FF);
+        Lease4Ptr lease = LeaseMgrFactory::instance().
+            getLease4(IOAddress(address_s.str()));
+        ASSERT_TRUE(lease);
+        EXPECT_FALSE(lease->stateExpiredReclaimed());
+    }
+}
+
+// Test that stopping the worker abandons the cycle in progress.
+TEST_F(ReclamationWorkerTest, stop) {
+    cfg_->setReclaimSliceLeases(10);
+    ASSERT_NO_FATAL_FAILURE(createLeases(5));
+
+    ASSERT_NO_FATAL_FAILURE(startWorker());
+    worker_->startCycle(0, 0, false, 0);
+    ASSERT_TRUE(worker_->cycleInProgress());
+
+    ASSERT_NO_THROW(worker_->stop());
+    EXPECT_FALSE(worker_->cycleInProgress());
+    EXPECT_EQ(TEST_LEASES_NUM, countExpiredLeases());
+}
+
+} // end of anonymous namespace
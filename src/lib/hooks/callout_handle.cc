@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,7 +22,9 @@ namespace hooks {
 // Constructor.
 CalloutHandle::CalloutHandle(const boost::shared_ptr<CalloutManager>& manager,
                     const boost::shared_ptr<LibraryManagerCollection>& lmcoll)
-    : lm_collection_(lmcoll), arguments_(), context_collection_(),
+    : lm_collection_(lmcoll),
+      arguments_(ServerHooks::getServerHooks().getArgumentCount()),
+      context_collection_(),
       manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
       next_step_(NEXT_STEP_CONTINUE) {
 
@@ -58,20 +61,55 @@ CalloutHandle::~CalloutHandle() {
     // scope of this framework and is not addressed by it.
 }
 
-// Return the name of all argument items.
+// Reset the handle for a new request.
+
+void
+CalloutHandle::reset() {
+    manager_->callCallouts(ServerHooks::CONTEXT_DESTROY, *this);
+
+    deleteAllArguments();
+    context_collection_.clear();
+    next_step_ = NEXT_STEP_CONTINUE;
+
+    manager_->callCallouts(ServerHooks::CONTEXT_CREATE, *this);
+}
+
+// Return the name of all argument items, in alphabetical order.
 
 vector<string>
 CalloutHandle::getArgumentNames() const {
 
     vector<string> names;
-    for (ElementCollection::const_iterator i = arguments_.begin();
-         i != arguments_.end(); ++i) {
-        names.push_back(i->first);
+    for (int i = 0; i < arguments_.size(); ++i) {
+        if (!arguments_[i].empty()) {
+            names.push_back(server_hooks_.getArgumentName(i));
+        }
     }
+    sort(names.begin(), names.end());
 
     return (names);
 }
 
+// Delete all arguments, keeping the argument vector.
+
+void
+CalloutHandle::deleteAllArguments() {
+    for (vector<boost::any>::iterator i = arguments_.begin();
+         i != arguments_.end(); ++i) {
+        if (!i->empty()) {
+            *i = boost::any();
+        }
+    }
+}
+
+// Throw the exception for an argument which is not present.
+
+void
+CalloutHandle::throwNoSuchArgument(int index) const {
+    isc_throw(NoSuchArgument, "unable to find argument with name " <<
+              server_hooks_.getArgumentName(index));
+}
+
 // Return the library handle allowing the callout to access the CalloutManager
 // registration/deregistration functions.
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <exceptions/exceptions.h>
 #include <hooks/library_handle.h>
+#include <hooks/server_hooks.h>
 
 #include <boost/any.hpp>
 #include <boost/shared_ptr.hpp>
@@ -20,18 +21,6 @@
 namespace isc {
 namespace hooks {
 
-class ServerHooks;
-
-/// @brief No such argument
-///
-/// Thrown if an attempt is made access an argument that does not exist.
-
-class NoSuchArgument : public Exception {
-public:
-    NoSuchArgument(const char* file, size_t line, const char* what) :
-        isc::Exception(file, line, what) {}
-};
-
 /// @brief No such callout context item
 ///
 /// Thrown if an attempt is made to get an item of data from this callout's
@@ -50,6 +39,51 @@ class CalloutManager;
 class LibraryHandle;
 class LibraryManagerCollection;
 
+/// @brief Typed argument slot
+///
+/// Identifies a callout argument by the index registered for its name in
+/// the @c ServerHooks object, together with the type of its value.  The
+/// slots are meant to be created once, typically as static objects, and
+/// used with the @c CalloutHandle::setArgument and
+/// @c CalloutHandle::getArgument variants taking a slot, which avoid the
+/// look up of the argument name on every access.  The arguments set
+/// through a slot are visible through the name and vice versa, e.g.:
+///
+/// @code
+/// static ArgumentSlot<Pkt4Ptr> query4_arg("query4");
+///
+/// Pkt4Ptr query;
+/// handle.getArgument(query4_arg, query);
+/// @endcode
+///
+/// @tparam T Type of the argument value.
+template <typename T>
+class ArgumentSlot {
+public:
+
+    /// Type of the argument value.
+    typedef T ValueType;
+
+    /// @brief Constructor
+    ///
+    /// Registers the argument name.
+    ///
+    /// @param name Name of the argument.
+    explicit ArgumentSlot(const std::string& name)
+        : index_(ServerHooks::getServerHooks().registerArgument(name)) {
+    }
+
+    /// @brief Returns the index of the argument.
+    int getIndex() const {
+        return (index_);
+    }
+
+private:
+
+    /// Index of the argument.
+    int index_;
+};
+
 /// @brief Per-packet callout handle
 ///
 /// An object of this class is associated with every packet (or request)
@@ -149,7 +183,20 @@ public:
     /// @param value Value to set.  That can be of any data type.
     template <typename T>
     void setArgument(const std::string& name, T value) {
-        arguments_[name] = value;
+        getArgumentForSet(server_hooks_.registerArgument(name)) = value;
+    }
+
+    /// @brief Set argument through its slot
+    ///
+    /// Sets the value of an argument identified by a slot.  This is the
+    /// equivalent of setting the argument by name.
+    ///
+    /// @param slot Slot of the argument.
+    /// @param value Value to set.
+    template <typename T>
+    void setArgument(const ArgumentSlot<T>& slot,
+                     const typename ArgumentSlot<T>::ValueType& value) {
+        getArgumentForSet(slot.getIndex()) = value;
     }
 
     /// @brief Get argument
@@ -166,13 +213,33 @@ public:
     ///        the variable provided to receive the value.
     template <typename T>
     void getArgument(const std::string& name, T& value) const {
-        ElementCollection::const_iterator element_ptr = arguments_.find(name);
-        if (element_ptr == arguments_.end()) {
+        int index = server_hooks_.findArgumentIndex(name);
+        if (!isArgumentSet(index)) {
             isc_throw(NoSuchArgument, "unable to find argument with name " <<
                       name);
         }
 
-        value = boost::any_cast<T>(element_ptr->second);
+        value = boost::any_cast<T>(arguments_[index]);
+    }
+
+    /// @brief Get argument through its slot
+    ///
+    /// Gets the value of an argument identified by a slot.  This is the
+    /// equivalent of getting the argument by name.
+    ///
+    /// @param slot Slot of the argument.
+    /// @param value [out] Value to set.
+    ///
+    /// @throw NoSuchArgument The argument is not present.
+    /// @throw boost::bad_any_cast The argument is present, but the data type
+    ///        of the value is not the type of the slot.
+    template <typename T>
+    void getArgument(const ArgumentSlot<T>& slot, T& value) const {
+        if (!isArgumentSet(slot.getIndex())) {
+            throwNoSuchArgument(slot.getIndex());
+        }
+
+        value = boost::any_cast<T>(arguments_[slot.getIndex()]);
     }
 
     /// @brief Get argument names
@@ -193,7 +260,10 @@ public:
     ///
     /// @param name Name of the element in the argument list to set.
     void deleteArgument(const std::string& name) {
-        static_cast<void>(arguments_.erase(name));
+        int index = server_hooks_.findArgumentIndex(name);
+        if (isArgumentSet(index)) {
+            arguments_[index] = boost::any();
+        }
     }
 
     /// @brief Delete all arguments
@@ -202,9 +272,7 @@ public:
     ///
     /// N.B. If any elements are raw pointers, the pointed-to data is NOT
     /// deleted by this method.
-    void deleteAllArguments() {
-        arguments_.clear();
-    }
+    void deleteAllArguments();
 
     /// @brief Sets the next processing step.
     ///
@@ -337,7 +405,48 @@ public:
     /// @return Name of the current hook or the empty string if none.
     std::string getHookName() const;
 
+    /// @brief Reset the handle for a new request
+    ///
+    /// Calls the callouts on the "context_destroy" hook, deletes all
+    /// arguments and the per-packet context, and calls the callouts on the
+    /// "context_create" hook, as if the handle was destroyed and a new one
+    /// created, but keeping the storage allocated for the arguments.  This
+    /// is used by @c HooksManager::createCalloutHandle to reuse the handle
+    /// of a previous packet.
+    void reset();
+
 private:
+    /// @brief Check if an argument is set
+    ///
+    /// @param index Index of the argument, possibly invalid (e.g. -1).
+    ///
+    /// @return true if the argument is present.
+    bool isArgumentSet(int index) const {
+        return ((index >= 0) && (index < arguments_.size()) &&
+                !arguments_[index].empty());
+    }
+
+    /// @brief Return reference to an argument for setting
+    ///
+    /// Extends the argument vector if needed.
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @return Reference to the argument value.
+    boost::any& getArgumentForSet(int index) {
+        if (index >= arguments_.size()) {
+            arguments_.resize(index + 1);
+        }
+        return (arguments_[index]);
+    }
+
+    /// @brief Throw NoSuchArgument for an argument index
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @throw NoSuchArgument always.
+    void throwNoSuchArgument(int index) const;
+
     /// @brief Check index
     ///
     /// Gets the current library index, throwing an exception if it is not set
@@ -375,14 +484,20 @@ private:
     ///        associated with the current library.
     const ElementCollection& getContextForLibrary() const;
 
+    /// The HooksManager checks the callout manager of a handle before
+    /// reusing it.
+    friend class HooksManager;
+
     // Member variables
 
     /// Pointer to the collection of libraries for which this handle has been
     /// created.
     boost::shared_ptr<LibraryManagerCollection> lm_collection_;
 
-    /// Collection of arguments passed to the callouts
-    ElementCollection arguments_;
+    /// Collection of arguments passed to the callouts, indexed by the
+    /// argument indexes registered in the @c ServerHooks object.  The
+    /// elements of the arguments not present are empty.
+    std::vector<boost::any> arguments_;
 
     /// Context collection - there is one entry per library context.
     ContextCollection context_collection_;
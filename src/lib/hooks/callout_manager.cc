@@ -55,6 +55,21 @@ CalloutManager::checkLibraryIndex(int library_index) const {
               num_libraries_ << ")");
 }
 
+// Return the callout vector of a hook, copying it if it is shared with
+// callCallouts.
+
+CalloutManager::CalloutVector&
+CalloutManager::getWritableCallouts(int hook_index) {
+    CalloutVectorPtr& callouts = hook_vector_[hook_index];
+    if (!callouts) {
+        callouts.reset(new CalloutVector());
+
+    } else if (!callouts.unique()) {
+        callouts.reset(new CalloutVector(*callouts));
+    }
+    return (*callouts);
+}
+
 // Register a callout for the current library.
 
 void
@@ -73,13 +88,13 @@ CalloutManager::registerCallout(const std::string& name, CalloutPtr callout) {
     // Iterate through the callout vector for the hook from start to end,
     // looking for the first entry where the library index is greater than
     // the present index.
-    for (CalloutVector::iterator i = hook_vector_[hook_index].begin();
-         i != hook_vector_[hook_index].end(); ++i) {
+    CalloutVector& callouts = getWritableCallouts(hook_index);
+    for (CalloutVector::iterator i = callouts.begin(); i != callouts.end();
+         ++i) {
         if (i->first > current_library_) {
             // Found an element whose library index number is greater than the
             // current index, so insert the new element ahead of this one.
-            hook_vector_[hook_index].insert(i, make_pair(current_library_,
-                                                         callout));
+            callouts.insert(i, make_pair(current_library_, callout));
             return;
         }
     }
@@ -87,7 +102,7 @@ CalloutManager::registerCallout(const std::string& name, CalloutPtr callout) {
     // Reached the end of the vector, so there is no element in the (possibly
     // empty) set of callouts with a library index greater than the current
     // library index.  Inset the callout at the end of the list.
-    hook_vector_[hook_index].push_back(make_pair(current_library_, callout));
+    callouts.push_back(make_pair(current_library_, callout));
 }
 
 // Check if callouts are present for a given hook index.
@@ -101,7 +116,7 @@ CalloutManager::calloutsPresent(int hook_index) const {
     }
 
     // Valid, so are there any callouts associated with that hook?
-    return (!hook_vector_[hook_index].empty());
+    return (hook_vector_[hook_index] && !hook_vector_[hook_index]->empty());
 }
 
 bool
@@ -143,12 +158,14 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
         // determine to what hook it is attached.
         current_hook_ = hook_index;
 
-        // Duplicate the callout vector for this hook and work through that.
-        // This step is needed because we allow dynamic registration and
-        // deregistration of callouts.  If a callout attached to a hook modified
-        // the list of callouts on that hook, the underlying CalloutVector would
-        // change and potentially affect the iteration through that vector.
-        CalloutVector callouts(hook_vector_[hook_index]);
+        // Hold a reference to the callout vector for this hook and work
+        // through it.  We allow dynamic registration and deregistration of
+        // callouts: if a callout attached to a hook modifies the list of
+        // callouts on that hook, the modification is made on a copy of the
+        // vector (see getWritableCallouts()), so it doesn't affect the
+        // iteration through this one.
+        CalloutVectorPtr callouts_ptr = hook_vector_[hook_index];
+        const CalloutVector& callouts = *callouts_ptr;
 
         // This object will be used to measure execution time of each callout
         // and the total time spent in callouts for this hook point.
@@ -241,10 +258,16 @@ CalloutManager::deregisterCallout(const std::string& name, CalloutPtr callout) {
     /// we want to remove.
     CalloutEntry target(current_library_, callout);
 
+    // Nothing to remove if no callout has been registered on the hook.
+    if ((hook_index >= hook_vector_.size()) || !hook_vector_[hook_index]) {
+        return (false);
+    }
+
     /// To decide if any entries were removed, we'll record the initial size
     /// of the callout vector for the hook, and compare it with the size after
     /// the removal.
-    size_t initial_size = hook_vector_[hook_index].size();
+    CalloutVector& callouts = getWritableCallouts(hook_index);
+    size_t initial_size = callouts.size();
 
     // The next bit is standard STL (see "Item 33" in "Effective STL" by
     // Scott Meyers).
@@ -255,14 +278,12 @@ CalloutManager::deregisterCallout(const std::string& name, CalloutPtr callout) {
     // is equal to the value of the passed callout.)  The erase() call
     // removes everything from that element to the end of the vector, i.e.
     // all the matching elements.
-    hook_vector_[hook_index].erase(remove_if(hook_vector_[hook_index].begin(),
-                                             hook_vector_[hook_index].end(),
-                                             bind1st(equal_to<CalloutEntry>(),
-                                                     target)),
-                                   hook_vector_[hook_index].end());
+    callouts.erase(remove_if(callouts.begin(), callouts.end(),
+                             bind1st(equal_to<CalloutEntry>(), target)),
+                   callouts.end());
 
     // Return an indication of whether anything was removed.
-    bool removed = initial_size != hook_vector_[hook_index].size();
+    bool removed = initial_size != callouts.size();
     if (removed) {
         LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                   HOOKS_CALLOUT_DEREGISTERED).arg(current_library_).arg(name);
@@ -284,20 +305,24 @@ CalloutManager::deregisterAllCallouts(const std::string& name) {
     /// pointer is NULL as we are not checking that).
     CalloutEntry target(current_library_, static_cast<CalloutPtr>(0));
 
+    // Nothing to remove if no callout has been registered on the hook.
+    if ((hook_index >= hook_vector_.size()) || !hook_vector_[hook_index]) {
+        return (false);
+    }
+
     /// To decide if any entries were removed, we'll record the initial size
     /// of the callout vector for the hook, and compare it with the size after
     /// the removal.
-    size_t initial_size = hook_vector_[hook_index].size();
+    CalloutVector& callouts = getWritableCallouts(hook_index);
+    size_t initial_size = callouts.size();
 
     // Remove all callouts matching this library.
-    hook_vector_[hook_index].erase(remove_if(hook_vector_[hook_index].begin(),
-                                             hook_vector_[hook_index].end(),
-                                             bind1st(CalloutLibraryEqual(),
-                                                     target)),
-                                   hook_vector_[hook_index].end());
+    callouts.erase(remove_if(callouts.begin(), callouts.end(),
+                             bind1st(CalloutLibraryEqual(), target)),
+                   callouts.end());
 
     // Return an indication of whether anything was removed.
-    bool removed = initial_size != hook_vector_[hook_index].size();
+    bool removed = initial_size != callouts.size();
     if (removed) {
         LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                   HOOKS_ALL_CALLOUTS_DEREGISTERED).arg(current_library_)
@@ -145,6 +145,11 @@ private:
     /// associated with a given hook.
     typedef std::vector<CalloutEntry> CalloutVector;
 
+    /// Pointer to a vector of callouts.  The vectors are shared with the
+    /// @c callCallouts invocations iterating through them and are copied
+    /// when modified during such an invocation.
+    typedef boost::shared_ptr<CalloutVector> CalloutVectorPtr;
+
 public:
 
     /// @brief Constructor
@@ -380,6 +385,17 @@ private:
     /// @throw NoSuchLibrary Library index is not valid.
     void checkLibraryIndex(int library_index) const;
 
+    /// @brief Return callouts of a hook for modification
+    ///
+    /// If the callouts of the hook are being called, i.e. the vector is
+    /// shared with @c callCallouts, the vector is replaced with a copy so
+    /// the modification doesn't affect the callouts being called.
+    ///
+    /// @param hook_index Index of the hook.
+    ///
+    /// @return Reference to the vector of callouts of the hook.
+    CalloutVector& getWritableCallouts(int hook_index);
+
     /// @brief Compare two callout entries for library equality
     ///
     /// This is used in callout removal code when all callouts on a hook for a
@@ -417,9 +433,10 @@ private:
     int current_library_;
 
     /// Vector of callout vectors.  There is one entry in this outer vector for
-    /// each hook. Each element is itself a vector, with one entry for each
-    /// callout registered for that hook.
-    std::vector<CalloutVector> hook_vector_;
+    /// each hook. Each element points to a vector, with one entry for each
+    /// callout registered for that hook, or is null if no callout has been
+    /// registered for that hook.
+    std::vector<CalloutVectorPtr> hook_vector_;
 
     /// LibraryHandle object user by the callout to access the callout
     /// registration methods on this CalloutManager object.  The object is set
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <hooks/hooks_config.h>
+#include <hooks/hooks_log.h>
 #include <hooks/hooks_manager.h>
 
 using namespace std;
@@ -25,12 +26,11 @@ HooksConfig::verifyLibraries(const Element::Position& position) const {
     // libraries (this prevents needless reloads when anything else in the
     // configuration is changed).
     //
-    // We no longer rely on this. Parameters can change. And even if the
-    // parameters stay the same, they could point to files that could
-    // change. We can skip loading routines only if there were and there still
-    // are no libraries specified.
-    vector<string> current_libraries = HooksManager::getLibraryNames();
-    if (current_libraries.empty() && libraries_.empty()) {
+    // Parameters can change, so they are compared too. The libraries
+    // already loaded are not validated again: they are kept as they are
+    // by loadLibraries(). The files the parameters point to could still
+    // change: the "libreload" command is required to take them into account.
+    if (sameAsLoaded()) {
         return;
     }
 
@@ -57,6 +57,13 @@ HooksConfig::loadLibraries() const {
     /// the list of libraries has changed.
     /// @todo: Delete any stored CalloutHandles before reloading the
     /// libraries
+
+    // Reloading the same libraries only loses their state.
+    if (sameAsLoaded()) {
+        LOG_DEBUG(hooks_logger, HOOKS_DBG_TRACE, HOOKS_LIBRARIES_UNCHANGED)
+            .arg(libraries_.size());
+        return;
+    }
     if (!HooksManager::loadLibraries(libraries_)) {
         isc_throw(InvalidHooksLibraries,
                   "One or more hook libraries failed to load");
@@ -102,6 +109,29 @@ HooksConfig::equal(const HooksConfig& other) const {
     return (true);
 }
 
+bool
+HooksConfig::sameAsLoaded() const {
+    HookLibsCollection loaded = HooksManager::getLibraryInfo();
+    if (loaded.size() != libraries_.size()) {
+        return (false);
+    }
+    for (size_t i = 0; i < libraries_.size(); ++i) {
+        if (libraries_[i].first != loaded[i].first) {
+            return (false);
+        }
+        const ConstElementPtr& params = libraries_[i].second;
+        const ConstElementPtr& loaded_params = loaded[i].second;
+        if (isNull(params) || isNull(loaded_params)) {
+            if (!isNull(params) || !isNull(loaded_params)) {
+                return (false);
+            }
+        } else if (!params->equals(*loaded_params)) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
 ElementPtr
 HooksConfig::toElement() const {
     // hooks-libraries is a list of maps
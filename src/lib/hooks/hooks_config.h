@@ -65,11 +65,21 @@ public:
     /// @param other other hooksconfig to compare with
     bool equal(const HooksConfig& other) const;
 
+    /// @brief Checks whether the libraries are those already loaded.
+    ///
+    /// Unlike @ref equal, the order of the libraries is relevant, as it
+    /// is the order in which their callouts are called.
+    ///
+    /// @return true when the loaded libraries have the same names, in the
+    /// same order, and the same parameters as the configured ones.
+    bool sameAsLoaded() const;
+
     /// @brief Verifies that libraries stored in libraries_ are valid.
     ///
     /// This method is a smart wrapper around @ref
     /// isc::hooks::HooksManager::validateLibraries().
-    /// It tries to validate all the libraries stored in libraries_.
+    /// It tries to validate all the libraries stored in libraries_,
+    /// unless they are already loaded (see @ref sameAsLoaded).
     ///
     /// @param position position of the hooks-library map for error reporting
     /// @throw InvalidHooksLibraries if any issue is discovered.
@@ -83,6 +93,11 @@ public:
     /// different to those already loaded, this method loads the new set of
     /// libraries (and unloads the existing set).
     ///
+    /// When the libraries and their parameters are the same as those
+    /// already loaded (see @ref sameAsLoaded) nothing is done, so the
+    /// libraries keep their state. The "libreload" command forces a
+    /// reload, e.g. when a file used by a library was modified.
+    ///
     /// @throw InvalidHooksLibraries if the call to HooksManager fails.
     void loadLibraries() const;
 
@@ -148,6 +148,28 @@ HooksManager::createCalloutHandle() {
     return (getHooksManager().createCalloutHandleInternal());
 }
 
+boost::shared_ptr<CalloutHandle>
+HooksManager::createCalloutHandleInternal(const boost::shared_ptr<CalloutHandle>& handle) {
+    conditionallyInitialize();
+
+    // The handle can be reused if nothing else holds it, as callouts may
+    // have kept a reference to it, and if the libraries have not been
+    // reloaded since it was created.
+    if (handle && handle.unique() &&
+        (handle->manager_ == callout_manager_) &&
+        (handle->lm_collection_ == lm_collection_)) {
+        handle->reset();
+        return (handle);
+    }
+
+    return (createCalloutHandleInternal());
+}
+
+boost::shared_ptr<CalloutHandle>
+HooksManager::createCalloutHandle(const boost::shared_ptr<CalloutHandle>& handle) {
+    return (getHooksManager().createCalloutHandleInternal(handle));
+}
+
 // Get the list of the names of loaded libraries.
 
 std::vector<std::string>
@@ -173,6 +173,21 @@ public:
     /// @return Shared pointer to a CalloutHandle object.
     static boost::shared_ptr<CalloutHandle> createCalloutHandle();
 
+    /// @brief Return callout handle, reusing a previous one if possible
+    ///
+    /// Returns a callout handle to be associated with a new request.  If
+    /// the handle of a previous request is not referenced elsewhere and
+    /// was created for the currently loaded libraries, it is reset (see
+    /// @c CalloutHandle::reset) and returned, saving the allocation of a
+    /// new handle and of its argument storage.  Otherwise, a new handle is
+    /// created.
+    ///
+    /// @param handle Handle of a previous request.  It may be null.
+    ///
+    /// @return Shared pointer to a CalloutHandle object.
+    static boost::shared_ptr<CalloutHandle>
+    createCalloutHandle(const boost::shared_ptr<CalloutHandle>& handle);
+
     /// @brief Register Hook
     ///
     /// This is just a convenience shell around the ServerHooks::registerHook()
@@ -314,6 +329,14 @@ private:
     /// @return Shared pointer to a CalloutHandle object.
     boost::shared_ptr<CalloutHandle> createCalloutHandleInternal();
 
+    /// @brief Return callout handle, reusing a previous one if possible
+    ///
+    /// @param handle Handle of a previous request.  It may be null.
+    ///
+    /// @return Shared pointer to a CalloutHandle object.
+    boost::shared_ptr<CalloutHandle>
+    createCalloutHandleInternal(const boost::shared_ptr<CalloutHandle>& handle);
+
     /// @brief Return pre-callouts library handle
     ///
     /// @return Reference to library handle associated with pre-library callout
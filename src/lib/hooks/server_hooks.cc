@@ -74,6 +74,41 @@ ServerHooks::registerHook(const string& name) {
     return (index);
 }
 
+// Register an argument name.  As for the hooks, the index is the number of
+// names registered so far.
+
+int
+ServerHooks::registerArgument(const string& name) {
+    int index = argument_names_.size();
+    pair<HookCollection::iterator, bool> result =
+        arguments_.insert(make_pair(name, index));
+    if (!result.second) {
+        return (result.first->second);
+    }
+
+    argument_names_.push_back(name);
+    return (index);
+}
+
+// Find the index associated with an argument name.
+
+int
+ServerHooks::findArgumentIndex(const string& name) const {
+    HookCollection::const_iterator i = arguments_.find(name);
+    return (i == arguments_.end() ? -1 : i->second);
+}
+
+// Find the name associated with an argument index.
+
+std::string
+ServerHooks::getArgumentName(int index) const {
+    if ((index < 0) || (index >= argument_names_.size())) {
+        isc_throw(NoSuchArgument, "argument index " << index << " is not "
+                  "valid for the list of registered arguments");
+    }
+    return (argument_names_[index]);
+}
+
 // Set ServerHooks object to initial state.
 
 void
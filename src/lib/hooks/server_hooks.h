@@ -38,6 +38,15 @@ public:
         isc::Exception(file, line, what) {}
 };
 
+/// @brief No such argument
+///
+/// Thrown if an attempt is made access an argument that does not exist.
+class NoSuchArgument : public Exception {
+public:
+    NoSuchArgument(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) {}
+};
+
 class ServerHooks;
 typedef boost::shared_ptr<ServerHooks> ServerHooksPtr;
 
@@ -140,6 +149,47 @@ public:
     /// @return Vector of strings holding hook names.
     std::vector<std::string> getHookNames() const;
 
+    /// @brief Register a hook argument
+    ///
+    /// Assigns an index to the name of a callout argument, such as "query4".
+    /// The @c CalloutHandle stores the arguments in a vector indexed by these
+    /// numbers, so the server code and the callouts which look up the index
+    /// once, through an @c ArgumentSlot, access the arguments without
+    /// comparing their names.
+    ///
+    /// The argument names are shared by all hooks and are not removed by
+    /// @c reset(), as their indexes are held by static objects.
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Index of the argument. If the argument is already registered,
+    ///         its existing index is returned.
+    int registerArgument(const std::string& name);
+
+    /// @brief Find argument index
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Index of the argument, or -1 if no argument with this name
+    ///         has been registered.
+    int findArgumentIndex(const std::string& name) const;
+
+    /// @brief Get argument name
+    ///
+    /// @param index Index of the argument.
+    ///
+    /// @return Name of the argument.
+    ///
+    /// @throw NoSuchArgument if the argument index is invalid.
+    std::string getArgumentName(int index) const;
+
+    /// @brief Return number of arguments
+    ///
+    /// @return Number of argument names registered.
+    int getArgumentCount() const {
+        return (argument_names_.size());
+    }
+
     /// @brief Return ServerHooks object
     ///
     /// Returns the global ServerHooks object.
@@ -216,6 +266,10 @@ private:
     /// simpler than using a multi-indexed container.)
     HookCollection  hooks_;                 ///< Hook name/index collection
     InverseHookCollection inverse_hooks_;   ///< Hook index/name collection
+
+    /// Argument name/index collection and argument names by index.
+    HookCollection arguments_;
+    std::vector<std::string> argument_names_;
 };
 
 } // namespace util
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -299,6 +299,71 @@ TEST_F(CalloutHandleTest, DeleteAllArguments) {
     EXPECT_THROW(handle.getArgument("four", value), NoSuchArgument);
 }
 
+// Test that the arguments can be accessed through slots and that they are
+// the arguments accessed by name.
+
+TEST_F(CalloutHandleTest, ArgumentSlots) {
+    ArgumentSlot<int> one_slot("one");
+    ArgumentSlot<Alpha> alpha_slot("alpha");
+
+    CalloutHandle handle(getCalloutManager());
+
+    // Set through the slots, get by name.
+    handle.setArgument(one_slot, 1);
+    handle.setArgument(alpha_slot, Alpha(2, 3));
+    int value = 0;
+    handle.getArgument("one", value);
+    EXPECT_EQ(1, value);
+    Alpha alpha;
+    handle.getArgument("alpha", alpha);
+    EXPECT_EQ(2, alpha.a);
+    EXPECT_EQ(3, alpha.b);
+
+    // Set by name, get through the slot.
+    handle.setArgument("one", 4);
+    handle.getArgument(one_slot, value);
+    EXPECT_EQ(4, value);
+
+    vector<string> expected_names;
+    expected_names.push_back("alpha");
+    expected_names.push_back("one");
+    EXPECT_TRUE(expected_names == handle.getArgumentNames());
+
+    // The type of the value set by name must match the type of the slot.
+    handle.setArgument("one", 5L);
+    EXPECT_THROW(handle.getArgument(one_slot, value), boost::bad_any_cast);
+
+    // Deleted arguments are not found through the slots.
+    handle.deleteArgument("one");
+    EXPECT_THROW(handle.getArgument(one_slot, value), NoSuchArgument);
+    handle.deleteAllArguments();
+    EXPECT_THROW(handle.getArgument(alpha_slot, alpha), NoSuchArgument);
+    EXPECT_TRUE(handle.getArgumentNames().empty());
+
+    // A slot of an argument registered after the creation of the handle.
+    ArgumentSlot<int> late_slot("argument_registered_late");
+    EXPECT_THROW(handle.getArgument(late_slot, value), NoSuchArgument);
+    handle.setArgument(late_slot, 6);
+    handle.getArgument(late_slot, value);
+    EXPECT_EQ(6, value);
+}
+
+// Test that a reset deletes the arguments and clears the status.
+
+TEST_F(CalloutHandleTest, Reset) {
+    CalloutHandle handle(getCalloutManager());
+
+    handle.setArgument("one", 1);
+    handle.setStatus(CalloutHandle::NEXT_STEP_DROP);
+
+    handle.reset();
+
+    int value = 0;
+    EXPECT_THROW(handle.getArgument("one", value), NoSuchArgument);
+    EXPECT_TRUE(handle.getArgumentNames().empty());
+    EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, handle.getStatus());
+}
+
 // Test the "status" field.
 TEST_F(CalloutHandleTest, StatusField) {
     CalloutHandle handle(getCalloutManager());
@@ -588,6 +588,36 @@ TEST_F(HooksManagerTest, NoLibrariesCallCallouts) {
     executeCallCallouts(-1, 3, -1, 22, -1, 83, -1);
 }
 
+// Test that the callout handle of a previous request is reused only when
+// nothing else holds it and the libraries have not been reloaded.
+
+TEST_F(HooksManagerTest, ReuseCalloutHandle) {
+    CalloutHandlePtr handle = HooksManager::createCalloutHandle();
+    CalloutHandle* raw = handle.get();
+    handle->setArgument("query4", 1);
+
+    // The handle is reset and reused.
+    handle = HooksManager::createCalloutHandle(handle);
+    EXPECT_EQ(raw, handle.get());
+    EXPECT_TRUE(handle->getArgumentNames().empty());
+
+    // A handle held elsewhere is not reused.
+    CalloutHandlePtr copy = handle;
+    handle = HooksManager::createCalloutHandle(handle);
+    EXPECT_NE(raw, handle.get());
+    copy.reset();
+
+    // A handle created before the libraries were reloaded is not reused.
+    raw = handle.get();
+    HookLibsCollection library_names;
+    EXPECT_TRUE(HooksManager::loadLibraries(library_names));
+    handle = HooksManager::createCalloutHandle(handle);
+    EXPECT_NE(raw, handle.get());
+
+    // A null handle is replaced by a new one.
+    EXPECT_TRUE(HooksManager::createCalloutHandle(CalloutHandlePtr()));
+}
+
 // Test the encapsulation of the ServerHooks::registerHook() method.
 
 TEST_F(HooksManagerTest, RegisterHooks) {
@@ -172,6 +172,35 @@ TEST(ServerHooksTest, Reset) {
     EXPECT_EQ(1, hooks.getIndex("context_destroy"));
 }
 
+// Check that the argument names are registered once and survive a reset.
+
+TEST(ServerHooksTest, RegisterArguments) {
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    hooks.reset();
+
+    int alpha = hooks.registerArgument("argument_alpha");
+    int beta = hooks.registerArgument("argument_beta");
+
+    // Registering a name again returns its index.
+    EXPECT_EQ(alpha, hooks.registerArgument("argument_alpha"));
+    EXPECT_NE(alpha, beta);
+    EXPECT_GT(hooks.getArgumentCount(), std::max(alpha, beta));
+
+    EXPECT_EQ(alpha, hooks.findArgumentIndex("argument_alpha"));
+    EXPECT_EQ(beta, hooks.findArgumentIndex("argument_beta"));
+    EXPECT_EQ(-1, hooks.findArgumentIndex("argument_unknown"));
+    EXPECT_EQ("argument_alpha", hooks.getArgumentName(alpha));
+    EXPECT_EQ("argument_beta", hooks.getArgumentName(beta));
+    EXPECT_THROW(hooks.getArgumentName(-1), NoSuchArgument);
+    EXPECT_THROW(hooks.getArgumentName(hooks.getArgumentCount()),
+                 NoSuchArgument);
+
+    // The indexes are kept by a reset.
+    hooks.reset();
+    EXPECT_EQ(alpha, hooks.findArgumentIndex("argument_alpha"));
+    EXPECT_EQ(beta, hooks.findArgumentIndex("argument_beta"));
+}
+
 // Check that getting an unknown name throws an exception.
 
 TEST(ServerHooksTest, UnknownHookName) {
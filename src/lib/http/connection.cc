@@ -30,9 +30,13 @@ HttpConnection:: HttpConnection(asiolink::IOService& io_service,
                                 HttpConnectionPool& connection_pool,
                                 const HttpResponseCreatorPtr& response_creator,
                                 const HttpAcceptorCallback& callback,
-                                const long request_timeout)
+                                const long request_timeout,
+                                const long idle_timeout)
     : request_timer_(io_service),
       request_timeout_(request_timeout),
+      idle_timeout_(idle_timeout),
+      idle_(false),
+      persistent_(false),
       socket_(io_service),
       acceptor_(acceptor),
       connection_pool_(connection_pool),
@@ -116,6 +120,10 @@ HttpConnection::doWrite() {
             socket_.asyncSend(output_buf_.data(),
                               output_buf_.length(),
                               cb);
+        } else if (persistent_) {
+            // The whole response has been sent. Wait for the next request.
+            startNextRequest();
+
         } else {
             stopThisConnection();
         }
@@ -124,6 +132,88 @@ HttpConnection::doWrite() {
     }
 }
 
+void
+HttpConnection::respond() {
+    LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              HTTP_REQUEST_RECEIVED)
+        .arg(getRemoteEndpointAddressAsText());
+
+    // The request has been received so the Request Timeout doesn't apply
+    // while the response is created and sent.
+    request_timer_.cancel();
+
+    try {
+        request_->finalize();
+    } catch (...) {
+    }
+
+    // The connection is closed after the response to a malformed request
+    // because the next request can't be found in the data following it.
+    persistent_ = false;
+    if ((idle_timeout_ > 0) && parser_->httpParseOk()) {
+        try {
+            persistent_ = request_->isPersistent();
+        } catch (...) {
+        }
+    }
+
+    HttpResponsePtr response = response_creator_->createHttpResponse(request_);
+    if (parser_->httpParseOk()) {
+        // HTTP/1.1 connections are persistent by default, so the header is
+        // only needed when they are going to be closed. HTTP/1.0 connections
+        // are persistent only when the server confirms it.
+        if (!persistent_) {
+            response->addHeader("Connection", "close");
+
+        } else if (request_->getHttpVersion() < HttpVersion(1, 1)) {
+            response->addHeader("Connection", "keep-alive");
+        }
+    }
+
+    LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              HTTP_RESPONSE_SEND)
+        .arg(response->toBriefString())
+        .arg(getRemoteEndpointAddressAsText());
+    asyncSendResponse(response);
+}
+
+void
+HttpConnection::startNextRequest() {
+    // The data received after the last request are the beginning of the
+    // next request, possibly the whole request.
+    std::string unparsed = parser_->getUnparsedData();
+
+    request_ = response_creator_->createNewHttpRequest();
+    parser_.reset(new HttpRequestParser(*request_));
+    parser_->initModel();
+
+    if (!unparsed.empty()) {
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  HTTP_PIPELINED_REQUEST)
+            .arg(unparsed.size())
+            .arg(getRemoteEndpointAddressAsText());
+        idle_ = false;
+        setupRequestTimer();
+        parser_->postBuffer(static_cast<const void*>(unparsed.data()),
+                            unparsed.size());
+        parser_->poll();
+        if (!parser_->needData()) {
+            respond();
+            return;
+        }
+
+    } else {
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  HTTP_CONNECTION_IDLE)
+            .arg(getRemoteEndpointAddressAsText())
+            .arg(static_cast<unsigned>(idle_timeout_/1000));
+        idle_ = true;
+        setupIdleTimer();
+    }
+
+    doRead();
+}
+
 void
 HttpConnection::asyncSendResponse(const ConstHttpResponsePtr& response) {
     output_buf_ = response->toString();
@@ -141,20 +231,28 @@ HttpConnection::acceptorCallback(const boost::system::error_code& ec) {
         stopThisConnection();
     }
 
+    // The limit must be checked before the listener adds the connection
+    // waiting for the next client to the pool.
+    const bool over_limit = !ec && connection_pool_.isOverLimit();
+
     acceptor_callback_(ec);
 
     if (!ec) {
+        // Reject the connection if the server already handles as many
+        // connections as allowed.
+        if (over_limit) {
+            LOG_WARN(http_logger, HTTP_CONNECTION_LIMIT_REACHED)
+                .arg(getRemoteEndpointAddressAsText())
+                .arg(connection_pool_.getMaxConnections());
+            stopThisConnection();
+            return;
+        }
+
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
                   HTTP_REQUEST_RECEIVE_START)
             .arg(getRemoteEndpointAddressAsText())
             .arg(static_cast<unsigned>(request_timeout_/1000));
-        // Pass raw pointer rather than shared_ptr to this object,
-        // because IntervalTimer already passes shared pointer to the
-        // IntervalTimerImpl to make sure that the callback remains
-        // valid.
-        request_timer_.setup(boost::bind(&HttpConnection::requestTimeoutCallback,
-                                         this),
-                             request_timeout_, IntervalTimer::ONE_SHOT);
+        setupRequestTimer();
         doRead();
     }
 }
@@ -188,7 +286,12 @@ HttpConnection::socketReadCallback(boost::system::error_code ec, size_t length)
             .arg(length)
             .arg(getRemoteEndpointAddressAsText());
 
-        std::string s(&buf_[0], buf_[0] + length);
+        // The first data of the next request on a persistent connection.
+        if (idle_) {
+            idle_ = false;
+            setupRequestTimer();
+        }
+
         parser_->postBuffer(static_cast<void*>(buf_.data()), length);
         parser_->poll();
     }
@@ -197,20 +300,7 @@ HttpConnection::socketReadCallback(boost::system::error_code ec, size_t length)
         doRead();
 
     } else {
-        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
-                  HTTP_REQUEST_RECEIVED)
-            .arg(getRemoteEndpointAddressAsText());
-        try {
-            request_->finalize();
-        } catch (...) {
-        }
-
-        HttpResponsePtr response = response_creator_->createHttpResponse(request_);
-        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
-                  HTTP_RESPONSE_SEND)
-            .arg(response->toBriefString())
-            .arg(getRemoteEndpointAddressAsText());
-        asyncSendResponse(response);
+        respond();
     }
 }
 
@@ -227,11 +317,13 @@ HttpConnection::socketWriteCallback(boost::system::error_code ec, size_t length)
         } else if ((ec.value() != boost::asio::error::try_again) &&
                    (ec.value() != boost::asio::error::would_block)) {
             stopThisConnection();
+            return;
 
         // We got EWOULDBLOCK or EAGAIN which indicate that we may be able to
-        // read something from the socket on the next attempt.
+        // write to the socket on the next attempt. Just make sure we don't
+        // discard any data in case there is any garbage passed in length.
         } else {
-            doWrite();
+            length = 0;
         }
     }
 
@@ -253,9 +345,38 @@ HttpConnection::requestTimeoutCallback() {
     HttpResponsePtr response =
         response_creator_->createStockHttpResponse(request_,
                                                    HttpStatusCode::REQUEST_TIMEOUT);
+    // The rest of the request may still arrive, so the connection can't
+    // be used for the next request.
+    persistent_ = false;
     asyncSendResponse(response);
 }
 
+void
+HttpConnection::idleTimeoutCallback() {
+    LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              HTTP_IDLE_CONNECTION_TIMEOUT_OCCURRED)
+        .arg(getRemoteEndpointAddressAsText());
+    stopThisConnection();
+}
+
+void
+HttpConnection::setupRequestTimer() {
+    // Pass raw pointer rather than shared_ptr to this object,
+    // because IntervalTimer already passes shared pointer to the
+    // IntervalTimerImpl to make sure that the callback remains
+    // valid.
+    request_timer_.setup(boost::bind(&HttpConnection::requestTimeoutCallback,
+                                     this),
+                         request_timeout_, IntervalTimer::ONE_SHOT);
+}
+
+void
+HttpConnection::setupIdleTimer() {
+    request_timer_.setup(boost::bind(&HttpConnection::idleTimeoutCallback,
+                                     this),
+                         idle_timeout_, IntervalTimer::ONE_SHOT);
+}
+
 std::string
 HttpConnection::getRemoteEndpointAddressAsText() const {
     try {
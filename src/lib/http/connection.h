@@ -40,6 +40,14 @@ class HttpConnection;
 typedef boost::shared_ptr<HttpConnection> HttpConnectionPtr;
 
 /// @brief Accepts and handles a single HTTP connection.
+///
+/// The connection is persistent unless the client asks to close it (see
+/// @ref HttpRequest::isPersistent) or the request is malformed: once the
+/// response is sent, the connection waits for the next request. The
+/// requests pipelined by the client, i.e. sent before receiving the
+/// responses to the previous ones, are answered in order. A persistent
+/// connection which doesn't receive the next request within the idle
+/// timeout is closed.
 class HttpConnection : public boost::enable_shared_from_this<HttpConnection> {
 private:
 
@@ -92,12 +100,16 @@ public:
     /// create HTTP response from the HTTP request received.
     /// @param callback Callback invoked when new connection is accepted.
     /// @param request_timeout Configured timeout for a HTTP request.
+    /// @param idle_timeout Timeout after which a persistent connection
+    /// waiting for the next request is closed. The value of 0 disables
+    /// the persistent connections.
     HttpConnection(asiolink::IOService& io_service,
                    HttpAcceptor& acceptor,
                    HttpConnectionPool& connection_pool,
                    const HttpResponseCreatorPtr& response_creator,
                    const HttpAcceptorCallback& callback,
-                   const long request_timeout);
+                   const long request_timeout,
+                   const long idle_timeout = 0);
 
     /// @brief Destructor.
     ///
@@ -132,6 +144,22 @@ private:
     /// In case of error the connection is stopped.
     void doWrite();
 
+    /// @brief Creates the response to the parsed request and starts
+    /// sending it.
+    ///
+    /// It also determines if the connection should be kept open after
+    /// the response and adds the "Connection" header accordingly.
+    void respond();
+
+    /// @brief Prepares the connection for the next request.
+    ///
+    /// The data received after the last request, if any, are passed to the
+    /// parser of the next request. If they contain the whole request, it is
+    /// answered right away. Otherwise, the connection reads the next request
+    /// and the idle timer (or the request timer if the next request has
+    /// been partially received) is started.
+    void startNextRequest();
+
     /// @brief Sends HTTP response asynchronously.
     ///
     /// Internally it calls @ref HttpConnection::doWrite to send the data.
@@ -172,6 +200,18 @@ private:
     /// and sends it to the client.
     void requestTimeoutCallback();
 
+    /// @brief Callback invoked when the idle timeout occurs.
+    ///
+    /// This callback closes the persistent connection which hasn't received
+    /// the next request.
+    void idleTimeoutCallback();
+
+    /// @brief Starts the timer of the Request Timeout.
+    void setupRequestTimer();
+
+    /// @brief Starts the timer of the idle timeout.
+    void setupIdleTimer();
+
     /// @brief Stops current connection.
     void stopThisConnection();
 
@@ -184,6 +224,16 @@ private:
     /// @brief Configured Request Timeout in milliseconds.
     long request_timeout_;
 
+    /// @brief Configured idle timeout in milliseconds.
+    long idle_timeout_;
+
+    /// @brief Indicates if the connection is waiting for the next request.
+    bool idle_;
+
+    /// @brief Indicates if the connection is kept open after the current
+    /// response.
+    bool persistent_;
+
     /// @brief Socket used by this connection.
     asiolink::TCPSocket<SocketCallback> socket_;
 
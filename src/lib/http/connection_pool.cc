@@ -10,6 +10,10 @@
 namespace isc {
 namespace http {
 
+HttpConnectionPool::HttpConnectionPool(const size_t max_connections)
+    : max_connections_(max_connections), connections_() {
+}
+
 void
 HttpConnectionPool::start(const HttpConnectionPtr& connection) {
     connections_.insert(connections_.end(), connection);
@@ -24,10 +24,18 @@ namespace http {
 /// is received.
 ///
 /// This object is a simple container for the server connections which provides
-/// means to terminate them on request.
+/// means to terminate them on request. It also limits the number of connections
+/// the server handles simultaneously: the persistent connections are kept open
+/// between the requests and would otherwise accumulate.
 class HttpConnectionPool {
 public:
 
+    /// @brief Constructor.
+    ///
+    /// @param max_connections Maximum number of accepted connections. The
+    /// value of 0 means no limit.
+    explicit HttpConnectionPool(const size_t max_connections = 0);
+
     /// @brief Start new connection.
     ///
     /// The connection is inserted to the pool and the
@@ -46,8 +54,36 @@ public:
     /// @brief Stops all connections and removes them from the pool.
     void stopAll();
 
+    /// @brief Returns the number of connections in the pool.
+    ///
+    /// It includes the connection waiting for the next client.
+    size_t size() const {
+        return (connections_.size());
+    }
+
+    /// @brief Returns the maximum number of accepted connections.
+    size_t getMaxConnections() const {
+        return (max_connections_);
+    }
+
+    /// @brief Checks if the number of accepted connections exceeds the
+    /// limit.
+    ///
+    /// This is called by the connection which has just been accepted,
+    /// before the listener creates the connection waiting for the next
+    /// client, so all connections in the pool are accepted ones.
+    ///
+    /// @return true if the limit is set and exceeded.
+    bool isOverLimit() const {
+        return ((max_connections_ > 0) &&
+                (connections_.size() > max_connections_));
+    }
+
 protected:
 
+    /// @brief Maximum number of accepted connections.
+    size_t max_connections_;
+
     /// @brief Set of connections.
     std::list<HttpConnectionPtr> connections_;
 
@@ -17,6 +17,8 @@ using namespace isc::asiolink;
 namespace isc {
 namespace http {
 
+const long HttpListener::DEFAULT_IDLE_TIMEOUT;
+
 /// @brief Implementation of the @ref HttpListener.
 class HttpListenerImpl {
 public:
@@ -37,6 +39,10 @@ public:
     /// create @ref HttpResponseCreator instances.
     /// @param request_timeout Timeout after which the HTTP Request Timeout
     /// is generated.
+    /// @param idle_timeout Timeout after which a persistent connection
+    /// waiting for the next request is closed.
+    /// @param max_connections Maximum number of connections handled
+    /// simultaneously.
     ///
     /// @throw HttpListenerError when any of the specified parameters is
     /// invalid.
@@ -44,7 +50,9 @@ public:
                      const asiolink::IOAddress& server_address,
                      const unsigned short server_port,
                      const HttpResponseCreatorFactoryPtr& creator_factory,
-                     const long request_timeout);
+                     const long request_timeout,
+                     const long idle_timeout,
+                     const size_t max_connections);
 
     /// @brief Returns reference to the current listener endpoint.
     const TCPEndpoint& getEndpoint() const;
@@ -97,16 +105,22 @@ private:
 
     /// @brief Timeout for HTTP Request Timeout desired.
     long request_timeout_;
+
+    /// @brief Idle timeout of the persistent connections.
+    long idle_timeout_;
 };
 
 HttpListenerImpl::HttpListenerImpl(IOService& io_service,
                                    const asiolink::IOAddress& server_address,
                                    const unsigned short server_port,
                                    const HttpResponseCreatorFactoryPtr& creator_factory,
-                                   const long request_timeout)
+                                   const long request_timeout,
+                                   const long idle_timeout,
+                                   const size_t max_connections)
     : io_service_(io_service), acceptor_(io_service),
-      endpoint_(), creator_factory_(creator_factory),
-      request_timeout_(request_timeout) {
+      endpoint_(), connections_(max_connections),
+      creator_factory_(creator_factory),
+      request_timeout_(request_timeout), idle_timeout_(idle_timeout) {
     // Try creating an endpoint. This may cause exceptions.
     try {
         endpoint_.reset(new TCPEndpoint(server_address, server_port));
@@ -127,6 +141,12 @@ HttpListenerImpl::HttpListenerImpl(IOService& io_service,
         isc_throw(HttpListenerError, "Invalid desired HTTP request timeout "
                   << request_timeout_);
     }
+
+    // Idle timeout is signed and must not be negative.
+    if (idle_timeout_ < 0) {
+        isc_throw(HttpListenerError, "Invalid desired HTTP idle timeout "
+                  << idle_timeout_);
+    }
 }
 
 const TCPEndpoint&
@@ -169,7 +189,8 @@ HttpListenerImpl::accept() {
                                               connections_,
                                               response_creator,
                                               acceptor_callback,
-                                              request_timeout_));
+                                              request_timeout_,
+                                              idle_timeout_));
     // Add this new connection to the pool.
     connections_.start(conn);
 }
@@ -185,9 +206,12 @@ HttpListener::HttpListener(IOService& io_service,
                            const asiolink::IOAddress& server_address,
                            const unsigned short server_port,
                            const HttpResponseCreatorFactoryPtr& creator_factory,
-                           const long request_timeout)
+                           const long request_timeout,
+                           const long idle_timeout,
+                           const size_t max_connections)
     : impl_(new HttpListenerImpl(io_service, server_address, server_port,
-                                 creator_factory, request_timeout)) {
+                                 creator_factory, request_timeout,
+                                 idle_timeout, max_connections)) {
 }
 
 HttpListener::~HttpListener() {
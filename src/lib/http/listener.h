@@ -46,11 +46,21 @@ class HttpListenerImpl;
 /// HTTP request and sending appropriate response. The listener can handle
 /// many HTTP connections simultaneously.
 ///
+/// The connections are persistent: the clients may send many requests over
+/// the same connection, avoiding the cost of establishing a new connection
+/// for each request. A connection which doesn't receive the next request
+/// within the idle timeout is closed. The number of connections handled
+/// simultaneously can be limited, in which case the connections above the
+/// limit are closed as soon as accepted.
+///
 /// When the @ref HttpListener::stop is invoked, all active connections are
 /// closed and the listener stops accepting new connections.
 class HttpListener {
 public:
 
+    /// @brief Default idle timeout of the persistent connections (ms).
+    static const long DEFAULT_IDLE_TIMEOUT = 30000;
+
     /// @brief Constructor.
     ///
     /// This constructor creates new server endpoint using the specified IP
@@ -67,6 +77,11 @@ public:
     /// create @ref HttpResponseCreator instances.
     /// @param request_timeout Timeout after which the HTTP Request Timeout
     /// is generated.
+    /// @param idle_timeout Timeout after which a persistent connection
+    /// waiting for the next request is closed. The value of 0 disables the
+    /// persistent connections.
+    /// @param max_connections Maximum number of connections handled
+    /// simultaneously. The value of 0 means no limit.
     ///
     /// @throw HttpListenerError when any of the specified parameters is
     /// invalid.
@@ -74,7 +89,9 @@ public:
                  const asiolink::IOAddress& server_address,
                  const unsigned short server_port,
                  const HttpResponseCreatorFactoryPtr& creator_factory,
-                 const long request_timeout);
+                 const long request_timeout,
+                 const long idle_timeout = DEFAULT_IDLE_TIMEOUT,
+                 const size_t max_connections = 0);
 
     /// @brief Destructor.
     ///
@@ -185,6 +185,31 @@ HttpRequest::getBody() const {
     return (context_->body_);
 }
 
+bool
+HttpRequest::isPersistent() const {
+    checkCreated();
+
+    // The header names are case insensitive.
+    std::string connection;
+    for (auto header = headers_.cbegin(); header != headers_.cend();
+         ++header) {
+        if (boost::iequals(header->first, "Connection")) {
+            connection = header->second;
+            boost::to_lower(connection);
+            break;
+        }
+    }
+
+    // The header value is a list of tokens.
+    if (connection.find("close") != std::string::npos) {
+        return (false);
+    }
+    if (getHttpVersion() < HttpVersion(1, 1)) {
+        return (connection.find("keep-alive") != std::string::npos);
+    }
+    return (true);
+}
+
 void
 HttpRequest::checkCreated() const {
     if (!created_) {
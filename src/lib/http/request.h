@@ -197,6 +197,17 @@ public:
     /// @brief Returns HTTP message body as string.
     std::string getBody() const;
 
+    /// @brief Checks if the client wants to keep the connection open
+    /// after the response.
+    ///
+    /// The HTTP/1.1 connections are persistent unless the request carries
+    /// the "Connection: close" header. The HTTP/1.0 connections are
+    /// persistent only if the request carries the "Connection: keep-alive"
+    /// header.
+    ///
+    /// @return true if the connection should be kept open.
+    bool isPersistent() const;
+
     /// @brief Checks if the request has been successfully finalized.
     ///
     /// The request is gets finalized on successful call to
@@ -103,6 +103,11 @@ HttpRequestParser::postBuffer(const void* buf, const size_t buf_size) {
     }
 }
 
+std::string
+HttpRequestParser::getUnparsedData() const {
+    return (std::string(buffer_.begin(), buffer_.end()));
+}
+
 void
 HttpRequestParser::defineEvents() {
     StateModel::defineEvents();
@@ -446,6 +451,11 @@ HttpRequestParser::expectingNewLineHandler(const unsigned int next_state) {
                     if (content_length > 0) {
                         // There is body in this request, so let's parse it.
                         transition(HTTP_BODY_ST, DATA_READ_OK_EVT);
+
+                    } else {
+                        // Empty body, the request ends here. The next
+                        // request may follow on a persistent connection.
+                        transition(HTTP_PARSE_OK_ST, HTTP_PARSE_OK_EVT);
                     }
                 } catch (const std::exception& ex) {
                     // There is no body in this message. If the body is required
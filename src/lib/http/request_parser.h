@@ -91,6 +91,11 @@ typedef boost::shared_ptr<HttpRequestParser> HttpRequestParserPtr;
 /// @ref HttpRequestParser::httpParseOk to determine whether parsing has
 /// completed.
 ///
+/// The extraneous data are the beginning of the next request when the client
+/// pipelines the requests over a persistent connection. They can be retrieved
+/// with @ref HttpRequestParser::getUnparsedData and provided to the parser of
+/// the next request.
+///
 /// The @ref util::StateModel::runModel must not be used to run the
 /// @ref HttpRequestParser state machine, thus it is made private method.
 class HttpRequestParser : public util::StateModel {
@@ -249,6 +254,15 @@ public:
     /// @param buf_size Size of the data within the buffer.
     void postBuffer(const void* buf, const size_t buf_size);
 
+    /// @brief Returns the data provided to the parser which haven't been
+    /// parsed.
+    ///
+    /// When parsing completes, these are the data received after the
+    /// request, e.g. the next pipelined request.
+    ///
+    /// @return Unparsed data.
+    std::string getUnparsedData() const;
+
 private:
 
     /// @brief Make @ref runModel private to make sure that the caller uses
@@ -390,7 +404,7 @@ private:
     /// (excluding body). The hander then reads the "Content-Length" header to
     /// check if the request contains a body. If the "Content-Length" is greater
     /// than zero, the parser transitions to HTTP_BODY_ST. If the
-    /// "Content-Length" doesn't exist the parser transitions to
+    /// "Content-Length" is zero or doesn't exist the parser transitions to
     /// HTTP_PARSE_OK_ST.
     ///
     /// @param next_state A state to which parser should transition.
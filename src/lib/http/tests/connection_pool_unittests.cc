@@ -189,4 +189,37 @@ TEST_F(HttpConnectionPoolTest, stopInvalid) {
     ASSERT_EQ(1, pool.hasConnection(conn1));
 }
 
+// Check that the pool reports when the number of connections exceeds the
+// limit.
+TEST_F(HttpConnectionPoolTest, limit) {
+    HttpConnectionPtr conn1(new HttpConnection(io_service_, acceptor_,
+                                               connection_pool_,
+                                               response_creator_,
+                                               HttpAcceptorCallback(),
+                                               1000));
+    HttpConnectionPtr conn2(new HttpConnection(io_service_, acceptor_,
+                                               connection_pool_,
+                                               response_creator_,
+                                               HttpAcceptorCallback(),
+                                               1000));
+    HttpConnectionPool pool(1);
+    EXPECT_EQ(1, pool.getMaxConnections());
+    ASSERT_NO_THROW(pool.start(conn1));
+    EXPECT_EQ(1, pool.size());
+    EXPECT_FALSE(pool.isOverLimit());
+    ASSERT_NO_THROW(pool.start(conn2));
+    EXPECT_EQ(2, pool.size());
+    EXPECT_TRUE(pool.isOverLimit());
+    ASSERT_NO_THROW(pool.stop(conn2));
+    EXPECT_FALSE(pool.isOverLimit());
+
+    // No limit by default.
+    HttpConnectionPool unlimited;
+    EXPECT_EQ(0, unlimited.getMaxConnections());
+    ASSERT_NO_THROW(unlimited.start(conn2));
+    ASSERT_NO_THROW(unlimited.start(conn1));
+    EXPECT_FALSE(unlimited.isOverLimit());
+    unlimited.stopAll();
+}
+
 }
@@ -116,7 +116,7 @@ public:
     /// @param io_service IO service to be stopped on error.
     explicit HttpClient(IOService& io_service)
         : io_service_(io_service.get_io_service()), socket_(io_service_),
-          buf_(), response_() {
+          buf_(), response_(), expected_responses_(1), closed_(false) {
     }
 
     /// @brief Destructor.
@@ -129,7 +129,10 @@ public:
     /// @brief Send HTTP request specified in textual format.
     ///
     /// @param request HTTP request in the textual format.
-    void startRequest(const std::string& request) {
+    /// @param responses Number of responses to be received, i.e. number of
+    /// requests pipelined in the request string.
+    void startRequest(const std::string& request, const size_t responses = 1) {
+        expected_responses_ = responses;
         tcp::endpoint endpoint(address::from_string(SERVER_ADDRESS),
                                SERVER_PORT);
         socket_.async_connect(endpoint,
@@ -219,6 +222,12 @@ public:
                     // in the bytes_transferred.
                     bytes_transferred = 0;
 
+                } else if (ec.value() == boost::asio::error::eof) {
+                    // The server closed the connection.
+                    closed_ = true;
+                    io_service_.stop();
+                    return;
+
                 } else {
                     // Error occurred, bail...
                     ADD_FAILURE() << "error occurred while receiving HTTP"
@@ -234,7 +243,7 @@ public:
 
             // Two consecutive new lines end the part of the response we're
             // expecting.
-            if (response_.find("\r\n\r\n", 0) != std::string::npos) {
+            if (countResponses() >= expected_responses_) {
                 io_service_.stop();
 
             } else {
@@ -244,6 +253,26 @@ public:
         });
     }
 
+    /// @brief Waits for the server to close the connection.
+    ///
+    /// No data is expected from the server.
+    void waitForClose() {
+        socket_.async_read_some(boost::asio::buffer(buf_.data(), buf_.size()),
+                                [this](const boost::system::error_code& ec,
+                                       std::size_t) {
+            if (ec.value() == boost::asio::error::operation_aborted) {
+                return;
+
+            } else if (ec.value() == boost::asio::error::eof) {
+                closed_ = true;
+
+            } else {
+                ADD_FAILURE() << "expected the server to close the connection";
+            }
+            io_service_.stop();
+        });
+    }
+
     /// @brief Close connection.
     void close() {
         socket_.close();
@@ -253,6 +282,26 @@ public:
         return (response_);
     }
 
+    /// @brief Checks if the server closed the connection.
+    bool isClosed() const {
+        return (closed_);
+    }
+
+private:
+
+    /// @brief Returns the number of responses received, i.e. the number
+    /// of the ends of the headers.
+    ///
+    /// The tests use the responses with no body or with a JSON body.
+    size_t countResponses() const {
+        size_t count = 0;
+        for (size_t pos = response_.find("\r\n\r\n"); pos != std::string::npos;
+             pos = response_.find("\r\n\r\n", pos + 4)) {
+            ++count;
+        }
+        return (count);
+    }
+
 private:
 
     /// @brief Holds reference to the IO service.
@@ -266,6 +315,12 @@ private:
 
     /// @brief Response in the textual format.
     std::string response_;
+
+    /// @brief Number of responses to be received.
+    size_t expected_responses_;
+
+    /// @brief Indicates if the server closed the connection.
+    bool closed_;
 };
 
 /// @brief Pointer to the HttpClient.
@@ -299,10 +354,20 @@ public:
     ///
     /// This method creates HttpClient instance and retains it in the clients_
     /// list.
-    void startRequest(const std::string& request) {
+    ///
+    /// @param request HTTP request in the textual format.
+    /// @param responses Number of responses to be received.
+    void startRequest(const std::string& request, const size_t responses = 1) {
         HttpClientPtr client(new HttpClient(io_service_));
         clients_.push_back(client);
-        clients_.back()->startRequest(request);
+        clients_.back()->startRequest(request, responses);
+    }
+
+    /// @brief Runs the IO service until it is stopped by a client or
+    /// by the test timer.
+    void runIOService() {
+        io_service_.get_io_service().reset();
+        io_service_.run();
     }
 
     /// @brief Callback function invoke upon test timeout.
@@ -455,4 +520,190 @@ TEST_F(HttpListenerTest, requestTimeout) {
               client->getResponse());
 }
 
+// This test verifies that the connection is kept open after the response
+// and can be used for the next request.
+TEST_F(HttpListenerTest, keepAlive) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+    const std::string response = "HTTP/1.1 200 OK\r\n"
+        "Content-Length: 0\r\n"
+        "Content-Type: application/json\r\n"
+        "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+        "\r\n";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_EQ(response, client->getResponse());
+    EXPECT_FALSE(client->isClosed());
+
+    // Send the next request over the same connection.
+    ASSERT_NO_THROW(client->sendRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_EQ(response, client->getResponse());
+    EXPECT_FALSE(client->isClosed());
+}
+
+// This test verifies that the pipelined requests are answered in order.
+TEST_F(HttpListenerTest, pipelining) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+    const std::string bad_request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: foo\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request + request + bad_request, 3));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_EQ("HTTP/1.1 200 OK\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "HTTP/1.1 200 OK\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "HTTP/1.1 400 Bad Request\r\n"
+              "Content-Length: 40\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "{ \"result\": 400, \"text\": \"Bad Request\" }",
+              client->getResponse());
+
+    // The connection is closed after the malformed request.
+    ASSERT_NO_THROW(client->waitForClose());
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the connection is closed when the client asks
+// for it.
+TEST_F(HttpListenerTest, connectionClose) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Connection: close\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_EQ("HTTP/1.1 200 OK\r\n"
+              "Connection: close\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n",
+              client->getResponse());
+
+    ASSERT_NO_THROW(client->waitForClose());
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the HTTP/1.0 connection is kept open only when
+// the client asks for it.
+TEST_F(HttpListenerTest, keepAliveHttp10) {
+    const std::string request = "POST /foo/bar HTTP/1.0\r\n"
+        "Content-Type: application/json\r\n"
+        "Connection: Keep-Alive\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_EQ("HTTP/1.0 200 OK\r\n"
+              "Connection: keep-alive\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n",
+              client->getResponse());
+    EXPECT_FALSE(client->isClosed());
+}
+
+// This test verifies that the persistent connection is closed after the
+// idle timeout.
+TEST_F(HttpListenerTest, idleTimeout) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    // Open the listener with the idle timeout of 1 sec.
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, 1000);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_FALSE(client->isClosed());
+
+    // No other request is sent so the server should close the connection.
+    ASSERT_NO_THROW(client->waitForClose());
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the connections above the limit are rejected.
+TEST_F(HttpListenerTest, connectionLimit) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT,
+                          HttpListener::DEFAULT_IDLE_TIMEOUT, 1);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    EXPECT_FALSE(client->getResponse().empty());
+
+    // The first connection is kept open, so the second one is rejected.
+    // The second client doesn't send any data, which the server would
+    // discard when closing the connection.
+    ASSERT_NO_THROW(startRequest(""));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(2, clients_.size());
+    client = clients_.back();
+    EXPECT_TRUE(client->getResponse().empty());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the negative idle timeout can't be specified.
+TEST_F(HttpListenerTest, invalidIdleTimeout) {
+    EXPECT_THROW(HttpListener(io_service_, IOAddress(SERVER_ADDRESS),
+                              SERVER_PORT, factory_, REQUEST_TIMEOUT, -1),
+                 HttpListenerError);
+}
+
 }
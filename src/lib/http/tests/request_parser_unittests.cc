@@ -169,8 +169,58 @@ TEST_F(HttpRequestParserTest, extraneousDataInRequest) {
     EXPECT_FALSE(parser.needData());
     EXPECT_TRUE(parser.httpParseOk());
     EXPECT_TRUE(parser.getErrorMessage().empty());
+
+    // The garbage is left for the parser of the next request.
+    EXPECT_EQ("some stuff which, if parsed, will cause errors",
+              parser.getUnparsedData());
+}
+
+// This test verifies that pipelined requests are parsed by the parsers
+// of the consecutive requests.
+TEST_F(HttpRequestParserTest, pipelinedRequests) {
+    std::string http_req1 = createRequestString("POST /foo/bar HTTP/1.1\r\n"
+                                                "Content-Type: application/json\r\n",
+                                                "{ \"command\": \"foo\" }");
+    std::string http_req2 = createRequestString("POST /foo/baz HTTP/1.1\r\n"
+                                                "Content-Type: application/json\r\n",
+                                                "{ \"command\": \"bar\" }");
+    std::string http_req = http_req1 + http_req2;
+
+    PostHttpRequestJson request1;
+    HttpRequestParser parser1(request1);
+    ASSERT_NO_THROW(parser1.initModel());
+    parser1.postBuffer(&http_req[0], http_req.size());
+    ASSERT_NO_THROW(parser1.poll());
+    ASSERT_TRUE(parser1.httpParseOk());
+    EXPECT_EQ("/foo/bar", request1.getUri());
+    std::string unparsed = parser1.getUnparsedData();
+    EXPECT_EQ(http_req2, unparsed);
+
+    PostHttpRequestJson request2;
+    HttpRequestParser parser2(request2);
+    ASSERT_NO_THROW(parser2.initModel());
+    parser2.postBuffer(&unparsed[0], unparsed.size());
+    ASSERT_NO_THROW(parser2.poll());
+    ASSERT_TRUE(parser2.httpParseOk());
+    EXPECT_EQ("/foo/baz", request2.getUri());
+    EXPECT_TRUE(parser2.getUnparsedData().empty());
 }
 
+// This test verifies that the request with the zero Content-Length ends
+// after the headers.
+TEST_F(HttpRequestParserTest, zeroContentLength) {
+    std::string http_req = "GET /foo/bar HTTP/1.1\r\n"
+        "Content-Length: 0\r\n\r\n"
+        "GET /foo/baz HTTP/1.1\r\n";
+
+    HttpRequestParser parser(request_);
+    ASSERT_NO_THROW(parser.initModel());
+    parser.postBuffer(&http_req[0], http_req.size());
+    ASSERT_NO_THROW(parser.poll());
+    ASSERT_FALSE(parser.needData());
+    ASSERT_TRUE(parser.httpParseOk());
+    EXPECT_EQ("GET /foo/baz HTTP/1.1\r\n", parser.getUnparsedData());
+}
 
 // This test verifies that LWS is parsed correctly. The LWS marks line breaks
 // in the HTTP header values.
@@ -155,4 +155,30 @@ TEST_F(HttpRequestTest, requiresBody) {
     EXPECT_TRUE(request_.requiresBody());
 }
 
+// This test verifies that the persistent connections are recognized.
+TEST_F(HttpRequestTest, isPersistent) {
+    // HTTP/1.1 connections are persistent by default.
+    setContextBasics("GET", "/isc/org", HttpVersion(1, 1));
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_TRUE(request_.isPersistent());
+
+    request_.context()->headers_.clear();
+    addHeaderToContext("Connection", "Close");
+    request_.reset();
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_FALSE(request_.isPersistent());
+
+    // HTTP/1.0 connections are persistent only on request.
+    setContextBasics("GET", "/isc/org", HttpVersion(1, 0));
+    request_.context()->headers_.clear();
+    request_.reset();
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_FALSE(request_.isPersistent());
+
+    addHeaderToContext("connection", "Keep-Alive");
+    request_.reset();
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_TRUE(request_.isPersistent());
+}
+
 }
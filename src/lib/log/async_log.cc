@@ -0,0 +1,367 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_log.h>
+#include <log/async_log_buffer.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/logger.h>
+#include <log/logger_impl.h>
+#include <log/macros.h>
+#include <log/message_dictionary.h>
+
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <stdint.h>
+
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Logger used for the messages of the asynchronous logging itself.
+isc::log::Logger logger("log");
+
+/// \brief Maximum number of records consumed before the consumer mutex is
+/// released, so flush() and AsyncLogPause don't wait behind a busy thread.
+const size_t CONSUME_BATCH = 256;
+
+/// \brief Minimum interval between the reports of dropped messages, in
+/// seconds.
+const time_t REPORT_INTERVAL = 1;
+
+/// \brief Disables the asynchronous logging at exit, so the pending
+/// messages are written.
+///
+/// It is created when the asynchronous logging is first enabled, hence
+/// after the loggers and the message dictionary, and destroyed before them.
+struct ExitFlush {
+    ~ExitFlush() {
+        isc::log::AsyncLogBuffer::disable();
+    }
+};
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace log {
+
+std::atomic<AsyncLogBuffer*> AsyncLogBuffer::active_(NULL);
+
+std::string
+AsyncLogArg::toText() const {
+    switch (type_) {
+    case INT:
+        return (boost::lexical_cast<std::string>(int_));
+    case UINT:
+        return (boost::lexical_cast<std::string>(uint_));
+    case FLOAT:
+        return (boost::lexical_cast<std::string>(static_cast<float>(double_)));
+    case DOUBLE:
+        return (boost::lexical_cast<std::string>(double_));
+    default:
+        return (string_);
+    }
+}
+
+const size_t AsyncLogRecord::MAX_ARGS;
+
+AsyncLogRecord::AsyncLogRecord()
+    : sequence_(0), position_(0), buffer_(NULL), logger_(NULL),
+      severity_(NONE), ident_(NULL), num_args_(0), cancelled_(false) {
+}
+
+AsyncLogArg*
+AsyncLogRecord::nextArg() {
+    if (num_args_ >= MAX_ARGS) {
+        ++num_args_;
+        return (NULL);
+    }
+    return (&args_[num_args_++]);
+}
+
+void
+AsyncLogRecord::addArg(const std::string& value) {
+    AsyncLogArg* arg = nextArg();
+    if (arg) {
+        arg->setString(value);
+    }
+}
+
+void
+AsyncLogRecord::commit() {
+    buffer_->committed(*this);
+}
+
+void
+AsyncLogRecord::cancel() {
+    cancelled_ = true;
+    buffer_->committed(*this);
+}
+
+AsyncLogBuffer::AsyncLogBuffer(const size_t capacity, const Output& output)
+    : records_(), mask_(0), enqueue_pos_(0), dequeue_pos_(0),
+      output_(output), sleeping_(false), stopping_(false), overflows_(0),
+      drops_(0), written_(0), reported_drops_(0), reported_time_(0) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    std::vector<AsyncLogRecord>(size).swap(records_);
+    mask_ = size - 1;
+    for (size_t i = 0; i < size; ++i) {
+        records_[i].sequence_.store(i, std::memory_order_relaxed);
+        records_[i].buffer_ = this;
+    }
+}
+
+AsyncLogBuffer::~AsyncLogBuffer() {
+    stop();
+}
+
+void
+AsyncLogBuffer::start() {
+    if (thread_) {
+        return;
+    }
+    stopping_.store(false);
+    thread_.reset(new Thread(boost::bind(&AsyncLogBuffer::run, this)));
+}
+
+void
+AsyncLogBuffer::stop() {
+    if (thread_) {
+        stopping_.store(true);
+        {
+            Mutex::Locker lock(wake_mutex_);
+            wake_cond_.signal();
+        }
+        thread_->wait();
+        thread_.reset();
+    }
+
+    // Write what was committed after the thread exited.
+    flush();
+}
+
+void
+AsyncLogBuffer::flush() {
+    const size_t limit = enqueue_pos_.load();
+    Mutex::Locker lock(consumer_mutex_);
+    while (consumeOne(limit)) {
+    }
+}
+
+AsyncLogRecord*
+AsyncLogBuffer::reserve(LoggerImpl* logger, const Severity& severity,
+                        const MessageID& ident) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        AsyncLogRecord& record = records_[pos & mask_];
+        const size_t seq = record.sequence_.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) -
+            static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // The slot is free: claim it.
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   std::memory_order_relaxed)) {
+                record.position_ = pos;
+                record.logger_ = logger;
+                record.severity_ = severity;
+                record.ident_ = ident;
+                record.num_args_ = 0;
+                record.cancelled_ = false;
+                return (&record);
+            }
+        } else if (diff < 0) {
+            // The slot still holds a message from the previous lap.
+            ++overflows_;
+            if (severity < WARN) {
+                ++drops_;
+            }
+            return (NULL);
+        } else {
+            // Another thread claimed the slot.
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void
+AsyncLogBuffer::committed(AsyncLogRecord& record) {
+    // The sequential consistency of this store and of the load of
+    // sleeping_ pairs with the logging thread setting sleeping_ before
+    // checking the record, so either it sees the record or we see it
+    // sleeping.
+    record.sequence_.store(record.position_ + 1);
+    if (sleeping_.load()) {
+        Mutex::Locker lock(wake_mutex_);
+        wake_cond_.signal();
+    }
+}
+
+bool
+AsyncLogBuffer::consumeOne(const size_t limit) {
+    const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    if (pos == limit) {
+        return (false);
+    }
+    AsyncLogRecord& record = records_[pos & mask_];
+    if (record.sequence_.load() != pos + 1) {
+        return (false);
+    }
+
+    if (!record.cancelled_) {
+        try {
+            // This is what LoggerImpl::lookupMessage and the Formatter do
+            // in the synchronous mode.
+            text_.assign(record.ident_);
+            text_.push_back(' ');
+            text_.append(MessageDictionary::globalDictionary()->
+                         getText(record.ident_));
+            const size_t stored = std::min(record.num_args_,
+                                           AsyncLogRecord::MAX_ARGS);
+            for (size_t i = 0; i < stored; ++i) {
+                replacePlaceholder(&text_, record.args_[i].toText(), i + 1);
+            }
+            if (record.num_args_ > AsyncLogRecord::MAX_ARGS) {
+                text_.append(" @@Too many arguments@@");
+            }
+            checkExcessPlaceholders(&text_, record.num_args_ + 1);
+
+            if (output_) {
+                output_(record.logger_, record.severity_, text_);
+            } else {
+                record.logger_->outputRaw(record.severity_, text_);
+            }
+            ++written_;
+        } catch (...) {
+            // As in the Formatter, a message which can't be formatted or
+            // written is not output.
+        }
+    }
+
+    // Hand the slot back to the producers for the next lap.
+    record.logger_ = NULL;
+    record.sequence_.store(pos + mask_ + 1, std::memory_order_release);
+    dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+    return (true);
+}
+
+void
+AsyncLogBuffer::run() {
+    for (;;) {
+        bool more = false;
+        {
+            Mutex::Locker lock(consumer_mutex_);
+            size_t count = 0;
+            while ((count < CONSUME_BATCH) &&
+                   consumeOne(enqueue_pos_.load())) {
+                ++count;
+            }
+            more = (count == CONSUME_BATCH);
+        }
+        if (more) {
+            continue;
+        }
+
+        reportDrops();
+
+        Mutex::Locker lock(wake_mutex_);
+        if (stopping_.load()) {
+            break;
+        }
+        sleeping_.store(true);
+        const size_t pos = dequeue_pos_.load();
+        if (records_[pos & mask_].sequence_.load() != pos + 1) {
+            wake_cond_.wait(wake_mutex_);
+        }
+        sleeping_.store(false);
+    }
+}
+
+void
+AsyncLogBuffer::reportDrops() {
+    const uint64_t drops = drops_.load();
+    if (drops == reported_drops_) {
+        return;
+    }
+    const time_t now = time(NULL);
+    if (now - reported_time_ < REPORT_INTERVAL) {
+        return;
+    }
+    reported_drops_ = drops;
+    reported_time_ = now;
+
+    // This goes through the ring, which has room as it was just drained.
+    LOG_WARN(logger, LOG_ASYNC_MESSAGES_DROPPED)
+        .arg(drops)
+        .arg(overflows_.load());
+}
+
+void
+AsyncLogBuffer::enable(const size_t capacity) {
+    AsyncLogBuffer* current = active();
+    if (current && (capacity > 0) && (current->getCapacity() >= capacity)) {
+        return;
+    }
+
+    disable();
+    if (capacity == 0) {
+        return;
+    }
+
+    static ExitFlush exit_flush;
+    static_cast<void>(exit_flush);
+
+    AsyncLogBuffer* buffer = new AsyncLogBuffer(capacity);
+    buffer->start();
+    active_.store(buffer, std::memory_order_release);
+    LOG_INFO(logger, LOG_ASYNC_ENABLED).arg(buffer->getCapacity());
+}
+
+void
+AsyncLogBuffer::disable() {
+    AsyncLogBuffer* buffer = active_.exchange(NULL);
+    if (!buffer) {
+        return;
+    }
+
+    buffer->stop();
+    const uint64_t written = buffer->getWritten();
+    const uint64_t drops = buffer->getDrops();
+    const uint64_t overflows = buffer->getOverflows();
+    delete buffer;
+    LOG_INFO(logger, LOG_ASYNC_DISABLED)
+        .arg(written)
+        .arg(drops)
+        .arg(overflows);
+}
+
+void
+AsyncLogBuffer::flushActive() {
+    AsyncLogBuffer* buffer = active();
+    if (buffer) {
+        buffer->flush();
+    }
+}
+
+AsyncLogPause::AsyncLogPause() : locker_() {
+    AsyncLogBuffer* buffer = AsyncLogBuffer::active();
+    if (buffer) {
+        buffer->flush();
+        locker_.reset(new Mutex::Locker(buffer->consumer_mutex_));
+    }
+}
+
+AsyncLogPause::~AsyncLogPause() {
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,193 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LOG_H
+#define ASYNC_LOG_H
+
+#include <log/logger_level.h>
+#include <log/message_types.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/type_traits.hpp>
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace log {
+
+class AsyncLogBuffer;
+class LoggerImpl;
+
+/// \brief Tells if an argument type is captured raw by the asynchronous
+/// logging.
+///
+/// The integer and floating point arguments are stored as they are and
+/// converted to text by the logging thread. Character types are excluded
+/// as they are output as characters rather than numbers. Arguments of all
+/// other types are converted to text by the caller.
+template<typename T>
+struct AsyncLogRaw : public boost::integral_constant<bool,
+    boost::is_arithmetic<T>::value &&
+    !boost::is_same<T, char>::value &&
+    !boost::is_same<T, signed char>::value &&
+    !boost::is_same<T, unsigned char>::value &&
+    !boost::is_same<T, wchar_t>::value &&
+    !boost::is_same<T, long double>::value> {
+};
+
+/// \brief Argument of a message captured by the asynchronous logging.
+class AsyncLogArg {
+public:
+    /// \brief Type of the stored value.
+    enum Type {
+        INT,
+        UINT,
+        FLOAT,
+        DOUBLE,
+        STRING
+    };
+
+    /// \brief Constructor.
+    AsyncLogArg() : type_(STRING), int_(0) {
+    }
+
+    /// \brief Stores a signed integer.
+    void setInt(const int64_t value) {
+        type_ = INT;
+        int_ = value;
+    }
+
+    /// \brief Stores an unsigned integer.
+    void setUint(const uint64_t value) {
+        type_ = UINT;
+        uint_ = value;
+    }
+
+    /// \brief Stores a floating point number.
+    ///
+    /// \param value Value to store.
+    /// \param single Indicates if the argument was a float, which is
+    /// output with fewer digits than a double.
+    void setDouble(const double value, const bool single) {
+        type_ = single ? FLOAT : DOUBLE;
+        double_ = value;
+    }
+
+    /// \brief Stores a text.
+    ///
+    /// The string keeps its capacity across the messages so texts up to
+    /// that size don't allocate.
+    void setString(const std::string& value) {
+        type_ = STRING;
+        string_.assign(value);
+    }
+
+    /// \brief Returns the text of the argument as the Formatter would
+    /// have produced it.
+    std::string toText() const;
+
+private:
+    /// \brief Type of the stored value.
+    Type type_;
+
+    /// \brief Stored number.
+    union {
+        int64_t int_;
+        uint64_t uint_;
+        double double_;
+    };
+
+    /// \brief Stored text.
+    std::string string_;
+};
+
+/// \brief Slot of the asynchronous logging ring.
+///
+/// A record is reserved in the ring when a message is logged, filled with
+/// the arguments passed to the Formatter and committed when the Formatter
+/// is destroyed. The logging thread then looks up the message text,
+/// replaces the placeholders and writes the message.
+class AsyncLogRecord : public boost::noncopyable {
+public:
+    /// \brief Maximum number of arguments of a message.
+    static const size_t MAX_ARGS = 12;
+
+    /// \brief Constructor.
+    AsyncLogRecord();
+
+    /// \brief Adds a text argument.
+    ///
+    /// \param value Text of the argument.
+    void addArg(const std::string& value);
+
+    /// \brief Adds a numeric argument.
+    ///
+    /// This is only used for the types for which AsyncLogRaw is true.
+    ///
+    /// \param value Value of the argument.
+    template<typename T>
+    void addArg(const T& value) {
+        AsyncLogArg* arg = nextArg();
+        if (!arg) {
+            return;
+        }
+        if (boost::is_floating_point<T>::value) {
+            arg->setDouble(static_cast<double>(value),
+                           sizeof(T) == sizeof(float));
+        } else if (boost::is_signed<T>::value) {
+            arg->setInt(static_cast<int64_t>(value));
+        } else {
+            arg->setUint(static_cast<uint64_t>(value));
+        }
+    }
+
+    /// \brief Hands the record over to the logging thread.
+    void commit();
+
+    /// \brief Hands the record over to the logging thread, which discards
+    /// it.
+    void cancel();
+
+private:
+    friend class AsyncLogBuffer;
+
+    /// \brief Returns the next free argument or NULL if all are used.
+    AsyncLogArg* nextArg();
+
+    /// \brief Ring position at which the record may be used next.
+    std::atomic<size_t> sequence_;
+
+    /// \brief Ring position at which the record was reserved.
+    size_t position_;
+
+    /// \brief Ring holding the record.
+    AsyncLogBuffer* buffer_;
+
+    /// \brief Logger which will write the message.
+    LoggerImpl* logger_;
+
+    /// \brief Severity of the message.
+    Severity severity_;
+
+    /// \brief Message identifier.
+    MessageID ident_;
+
+    /// \brief Number of arguments passed, including those beyond MAX_ARGS.
+    size_t num_args_;
+
+    /// \brief Indicates if the record must be discarded.
+    bool cancelled_;
+
+    /// \brief Arguments.
+    AsyncLogArg args_[MAX_ARGS];
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // ASYNC_LOG_H
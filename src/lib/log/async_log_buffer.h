@@ -0,0 +1,223 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASYNC_LOG_BUFFER_H
+#define ASYNC_LOG_BUFFER_H
+
+#include <log/async_log.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <atomic>
+#include <ctime>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace log {
+
+/// \brief Ring of log messages written by a background thread.
+///
+/// The ring is a bounded lock-free queue of AsyncLogRecord slots: the
+/// threads logging messages reserve and commit the slots with atomic
+/// operations only, and a single consumer formats and writes them.
+/// The consumer is the logging thread started by start(), or the caller
+/// of flush(). When the ring is full, reserve() fails and counts an
+/// overflow; the caller then writes warnings and errors synchronously and
+/// drops the debug and informational messages.
+///
+/// The ring used by the Logger is set by enable(). It is normally enabled
+/// by LoggerManager::init() when the KEA_LOGGER_ASYNC environment variable
+/// gives its size. Enabling and disabling must not race with the logging
+/// from other threads.
+class AsyncLogBuffer : public boost::noncopyable {
+public:
+    /// \brief Writes a formatted message.
+    ///
+    /// The default writes the message through the logger of the record.
+    typedef boost::function<void(LoggerImpl* logger, const Severity& severity,
+                                 const std::string& message)> Output;
+
+    /// \brief Constructor.
+    ///
+    /// \param capacity Number of slots, rounded up to a power of two.
+    /// \param output Function writing the formatted messages. The
+    /// messages are written through their loggers when it is empty.
+    AsyncLogBuffer(const size_t capacity, const Output& output = Output());
+
+    /// \brief Destructor.
+    ///
+    /// Stops the logging thread, which writes the pending messages.
+    ~AsyncLogBuffer();
+
+    /// \brief Starts the logging thread.
+    void start();
+
+    /// \brief Stops the logging thread after it wrote the pending messages.
+    void stop();
+
+    /// \brief Writes the messages committed so far in the calling thread.
+    void flush();
+
+    /// \brief Reserves a record for a message.
+    ///
+    /// \param logger Logger which will write the message.
+    /// \param severity Severity of the message.
+    /// \param ident Message identifier.
+    ///
+    /// \return The record or NULL when the ring is full, in which case
+    /// the overflow is counted and, if the message is below WARN, the drop.
+    AsyncLogRecord* reserve(LoggerImpl* logger, const Severity& severity,
+                            const MessageID& ident);
+
+    /// \brief Returns the number of slots.
+    size_t getCapacity() const {
+        return (records_.size());
+    }
+
+    /// \brief Returns the number of times the ring was full.
+    uint64_t getOverflows() const {
+        return (overflows_.load());
+    }
+
+    /// \brief Returns the number of messages dropped because the ring
+    /// was full.
+    uint64_t getDrops() const {
+        return (drops_.load());
+    }
+
+    /// \brief Returns the number of messages written.
+    uint64_t getWritten() const {
+        return (written_.load());
+    }
+
+    /// \brief Returns the ring used by the Logger or NULL.
+    static AsyncLogBuffer* active() {
+        return (active_.load(std::memory_order_acquire));
+    }
+
+    /// \brief Makes the Logger use a ring of the given size.
+    ///
+    /// \param capacity Number of slots; zero disables the asynchronous
+    /// logging.
+    static void enable(const size_t capacity);
+
+    /// \brief Makes the Logger write synchronously again.
+    ///
+    /// The pending messages are written first.
+    static void disable();
+
+    /// \brief Writes the pending messages of the ring used by the Logger,
+    /// if any.
+    static void flushActive();
+
+private:
+    friend class AsyncLogRecord;
+    friend class AsyncLogPause;
+
+    /// \brief Called when a record is committed.
+    ///
+    /// Wakes the logging thread if it sleeps.
+    void committed(AsyncLogRecord& record);
+
+    /// \brief Formats and writes the next committed record.
+    ///
+    /// The consumer mutex must be held.
+    ///
+    /// \param limit Ring position not to go beyond.
+    /// \return false if there is no committed record before the limit.
+    bool consumeOne(const size_t limit);
+
+    /// \brief Body of the logging thread.
+    void run();
+
+    /// \brief Logs the counters if messages were dropped since the last
+    /// report.
+    void reportDrops();
+
+    /// \brief Slots.
+    std::vector<AsyncLogRecord> records_;
+
+    /// \brief Position mask, the capacity minus one.
+    size_t mask_;
+
+    /// \brief Next position to reserve.
+    std::atomic<size_t> enqueue_pos_;
+
+    /// \brief Next position to consume.
+    ///
+    /// It is only modified with the consumer mutex held.
+    std::atomic<size_t> dequeue_pos_;
+
+    /// \brief Function writing the formatted messages.
+    Output output_;
+
+    /// \brief Held while consuming records.
+    isc::util::thread::Mutex consumer_mutex_;
+
+    /// \brief Protects the sleeping and stopping flags for the condition.
+    isc::util::thread::Mutex wake_mutex_;
+
+    /// \brief Condition the logging thread waits on.
+    isc::util::thread::CondVar wake_cond_;
+
+    /// \brief Indicates the logging thread waits for a record.
+    std::atomic<bool> sleeping_;
+
+    /// \brief Indicates the logging thread must exit.
+    std::atomic<bool> stopping_;
+
+    /// \brief Logging thread.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+
+    /// \brief Number of times the ring was full.
+    std::atomic<uint64_t> overflows_;
+
+    /// \brief Number of dropped messages.
+    std::atomic<uint64_t> drops_;
+
+    /// \brief Number of written messages.
+    std::atomic<uint64_t> written_;
+
+    /// \brief Number of dropped messages last reported.
+    uint64_t reported_drops_;
+
+    /// \brief Time of the last report.
+    time_t reported_time_;
+
+    /// \brief Message being formatted, reused across records.
+    std::string text_;
+
+    /// \brief Ring used by the Logger.
+    static std::atomic<AsyncLogBuffer*> active_;
+};
+
+/// \brief Writes the pending messages and keeps the logging thread from
+/// formatting new ones while the message dictionary is modified.
+///
+/// It does nothing if the asynchronous logging is not enabled.
+class AsyncLogPause : public boost::noncopyable {
+public:
+    /// \brief Constructor.
+    AsyncLogPause();
+
+    /// \brief Destructor.
+    ~AsyncLogPause();
+
+private:
+    /// \brief Lock on the consumer mutex of the paused ring.
+    boost::scoped_ptr<isc::util::thread::Mutex::Locker> locker_;
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // ASYNC_LOG_BUFFER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
+#include <log/async_log.h>
 #include <log/logger_level.h>
 
 namespace isc {
@@ -99,6 +100,12 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// destroyed before any call to .arg, producing an output, and then the one
 /// the .arg calls are called on would get destroyed as well, producing output
 /// again. So, think of this behavior as soul moving from one to another.
+///
+/// When the asynchronous logging is enabled, the formatter is given a record
+/// of the logging ring instead of the message text. The arguments are then
+/// stored in the record (the numbers as they are, other values converted to
+/// text) and the record is committed by the destructor: the placeholders
+/// are replaced and the message is written by the logging thread.
 template<class Logger> class Formatter {
 private:
     /// \brief The logger we will use to output the final message.
@@ -115,6 +122,9 @@ private:
     /// \brief Which will be the next placeholder to replace
     unsigned nextPlaceholder_;
 
+    /// \brief Record of the asynchronous logging ring, or NULL.
+    AsyncLogRecord* record_;
+
 
 public:
     /// \brief Constructor of "active" formatter
@@ -131,10 +141,12 @@ public:
     ///     logger is also NULL, but it's not checked.
     /// \param logger The logger where the final output will go, or NULL
     ///     if no output is wanted.
+    /// \param record The record of the asynchronous logging ring which
+    ///     will receive the arguments, in which case message is NULL.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
-              Logger* logger = NULL) :
+              Logger* logger = NULL, AsyncLogRecord* record = NULL) :
         logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        nextPlaceholder_(0), record_(record)
     {
     }
 
@@ -145,7 +157,8 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_),
+        record_(other.record_)
     {
         other.logger_ = NULL;
     }
@@ -154,7 +167,13 @@ public:
     //
     /// This is the place where output happens if the formatter is active.
     ~ Formatter() {
-        if (logger_) {
+        if (logger_ && record_) {
+            try {
+                record_->commit();
+            } catch (...) {
+                // Catch and ignore all exceptions here.
+            }
+        } else if (logger_) {
             try {
                 checkExcessPlaceholders(message_, ++nextPlaceholder_);
                 logger_->output(severity_, *message_);
@@ -175,6 +194,7 @@ public:
             severity_ = other.severity_;
             message_ = other.message_;
             nextPlaceholder_ = other.nextPlaceholder_;
+            record_ = other.record_;
             other.logger_ = NULL;
         }
 
@@ -190,23 +210,7 @@ public:
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
         if (logger_) {
-            try {
-                return (arg(boost::lexical_cast<std::string>(value)));
-            } catch (const boost::bad_lexical_cast& ex) {
-                // The formatting of the log message got wrong, we don't want
-                // to output it.
-                deactivate();
-                // A bad_lexical_cast during a conversion to a string is
-                // *extremely* unlikely to fail.  However, there is nothing
-                // in the documentation that rules it out, so we need to handle
-                // it.  As it is a potentially very serious problem, throw the
-                // exception detailing the problem with as much information as
-                // we can.  (Note that this does not include 'value' -
-                // boost::lexical_cast failed to convert it to a string, so an
-                // attempt to do so here would probably fail as well.)
-                isc_throw(FormatFailure, "bad_lexical_cast in call to "
-                          "Formatter::arg(): " << ex.what());
-            }
+            return (convertArg(value, AsyncLogRaw<Arg>()));
         } else {
             return (*this);
         }
@@ -216,7 +220,9 @@ public:
     ///
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
-        if (logger_) {
+        if (logger_ && record_) {
+            record_->addArg(arg);
+        } else if (logger_) {
             // Note that this method does a replacement and returns the
             // modified string. If there are multiple invocations of arg() (e.g.
             // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
@@ -251,11 +257,54 @@ public:
     /// the arguments for the message.
     void deactivate() {
         if (logger_) {
+            if (record_) {
+                record_->cancel();
+                record_ = NULL;
+            }
             delete message_;
             message_ = NULL;
             logger_ = NULL;
         }
     }
+
+private:
+    /// \brief Stores a number in the record of the asynchronous logging.
+    ///
+    /// In the synchronous mode, the number is converted to text.
+    ///
+    /// \param value The argument to place into the placeholder.
+    template<class Arg>
+    Formatter& convertArg(const Arg& value, const boost::true_type&) {
+        if (record_) {
+            record_->addArg(value);
+            return (*this);
+        }
+        return (convertArg(value, boost::false_type()));
+    }
+
+    /// \brief Converts an argument to text.
+    ///
+    /// \param value The argument to place into the placeholder.
+    template<class Arg>
+    Formatter& convertArg(const Arg& value, const boost::false_type&) {
+        try {
+            return (arg(boost::lexical_cast<std::string>(value)));
+        } catch (const boost::bad_lexical_cast& ex) {
+            // The formatting of the log message got wrong, we don't want
+            // to output it.
+            deactivate();
+            // A bad_lexical_cast during a conversion to a string is
+            // *extremely* unlikely to fail.  However, there is nothing
+            // in the documentation that rules it out, so we need to handle
+            // it.  As it is a potentially very serious problem, throw the
+            // exception detailing the problem with as much information as
+            // we can.  (Note that this does not include 'value' -
+            // boost::lexical_cast failed to convert it to a string, so an
+            // attempt to do so here would probably fail as well.)
+            isc_throw(FormatFailure, "bad_lexical_cast in call to "
+                      "Formatter::arg(): " << ex.what());
+        }
+    }
 };
 
 }
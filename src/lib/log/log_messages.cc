@@ -7,6 +7,9 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DISABLED = "LOG_ASYNC_DISABLED";
+extern const isc::log::MessageID LOG_ASYNC_ENABLED = "LOG_ASYNC_ENABLED";
+extern const isc::log::MessageID LOG_ASYNC_MESSAGES_DROPPED = "LOG_ASYNC_MESSAGES_DROPPED";
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
@@ -34,6 +37,9 @@ extern const isc::log::MessageID LOG_WRITE_ERROR = "LOG_WRITE_ERROR";
 namespace {
 
 const char* values[] = {
+    "LOG_ASYNC_DISABLED", "asynchronous logging disabled: %1 messages written, %2 dropped, the ring was full %3 times",
+    "LOG_ASYNC_ENABLED", "asynchronous logging enabled with a ring of %1 messages",
+    "LOG_ASYNC_MESSAGES_DROPPED", "%1 log messages dropped so far, the asynchronous logging ring was full %2 times",
     "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
     "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
     "LOG_BAD_STREAM", "bad log console output stream: %1",
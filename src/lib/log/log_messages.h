@@ -8,6 +8,9 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DISABLED;
+extern const isc::log::MessageID LOG_ASYNC_ENABLED;
+extern const isc::log::MessageID LOG_ASYNC_MESSAGES_DROPPED;
 extern const isc::log::MessageID LOG_BAD_DESTINATION;
 extern const isc::log::MessageID LOG_BAD_SEVERITY;
 extern const isc::log::MessageID LOG_BAD_STREAM;
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include <log/async_log_buffer.h>
 #include <log/logger.h>
 #include <log/logger_impl.h>
 #include <log/logger_name.h>
@@ -132,11 +133,27 @@ Logger::output(const Severity& severity, const std::string& message) {
     getLoggerPtr()->outputRaw(severity, message);
 }
 
+Logger::Formatter
+Logger::makeFormatter(const Severity& severity,
+                      const isc::log::MessageID& ident) {
+    AsyncLogBuffer* buffer = AsyncLogBuffer::active();
+    if (buffer) {
+        AsyncLogRecord* record = buffer->reserve(getLoggerPtr(), severity,
+                                                 ident);
+        if (record) {
+            return (Formatter(severity, NULL, this, record));
+        } else if (severity < WARN) {
+            // The ring is full: the drop has been counted.
+            return (Formatter());
+        }
+    }
+    return (Formatter(severity, getLoggerPtr()->lookupMessage(ident), this));
+}
+
 Logger::Formatter
 Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
     if (isDebugEnabled(dbglevel)) {
-        return (Formatter(DEBUG, getLoggerPtr()->lookupMessage(ident),
-                          this));
+        return (makeFormatter(DEBUG, ident));
     } else {
         return (Formatter());
     }
@@ -145,8 +162,7 @@ Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
 Logger::Formatter
 Logger::info(const isc::log::MessageID& ident) {
     if (isInfoEnabled()) {
-        return (Formatter(INFO, getLoggerPtr()->lookupMessage(ident),
-                          this));
+        return (makeFormatter(INFO, ident));
     } else {
         return (Formatter());
     }
@@ -155,8 +171,7 @@ Logger::info(const isc::log::MessageID& ident) {
 Logger::Formatter
 Logger::warn(const isc::log::MessageID& ident) {
     if (isWarnEnabled()) {
-        return (Formatter(WARN, getLoggerPtr()->lookupMessage(ident),
-                          this));
+        return (makeFormatter(WARN, ident));
     } else {
         return (Formatter());
     }
@@ -165,8 +180,7 @@ Logger::warn(const isc::log::MessageID& ident) {
 Logger::Formatter
 Logger::error(const isc::log::MessageID& ident) {
     if (isErrorEnabled()) {
-        return (Formatter(ERROR, getLoggerPtr()->lookupMessage(ident),
-                          this));
+        return (makeFormatter(ERROR, ident));
     } else {
         return (Formatter());
     }
@@ -175,8 +189,7 @@ Logger::error(const isc::log::MessageID& ident) {
 Logger::Formatter
 Logger::fatal(const isc::log::MessageID& ident) {
     if (isFatalEnabled()) {
-        return (Formatter(FATAL, getLoggerPtr()->lookupMessage(ident),
-                          this));
+        return (makeFormatter(FATAL, ident));
     } else {
         return (Formatter());
     }
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -320,6 +320,16 @@ private:
     /// \param message Text of the message to be output.
     void output(const Severity& severity, const std::string& message);
 
+    /// \brief Creates the formatter of a message to be output
+    ///
+    /// With the asynchronous logging, the formatter fills a record of the
+    /// logging ring. If the ring is full, warnings and more severe messages
+    /// are output synchronously and the others are dropped.
+    ///
+    /// \param severity Severity of the message.
+    /// \param ident Message identification.
+    Formatter makeFormatter(const Severity& severity, const MessageID& ident);
+
     /// \brief Copy Constructor
     ///
     /// Disabled (marked private) as it makes no sense to copy the logger -
@@ -20,6 +20,7 @@
 #include <log4cplus/configurator.h>
 #include <log4cplus/loggingmacros.h>
 
+#include <log/async_log_buffer.h>
 #include <log/logger.h>
 #include <log/logger_impl.h>
 #include <log/logger_level.h>
@@ -75,6 +76,8 @@ LoggerImpl::LoggerImpl(const string& name) :
 // Destructor. (Here because of virtual declaration.)
 
 LoggerImpl::~LoggerImpl() {
+    // The logging thread must not use this logger once it is destroyed.
+    AsyncLogBuffer::flushActive();
     delete sync_;
 }
 
@@ -1,12 +1,14 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <algorithm>
+#include <cstdlib>
 #include <vector>
 
+#include <log/async_log_buffer.h>
 #include <log/logger.h>
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
@@ -66,6 +68,8 @@ LoggerManager::~LoggerManager() {
 // Initialize processing
 void
 LoggerManager::processInit() {
+    // Write the pending messages with the current configuration.
+    AsyncLogBuffer::flushActive();
     impl_->processInit();
 }
 
@@ -122,6 +126,13 @@ LoggerManager::init(const std::string& root, isc::log::Severity severity,
 
     // Ensure that the mutex is constructed and ready at this point.
     (void) getMutex();
+
+    // Write the messages from a background thread if KEA_LOGGER_ASYNC
+    // gives the size of the logging ring.
+    const char* async = getenv("KEA_LOGGER_ASYNC");
+    if (async) {
+        AsyncLogBuffer::enable(strtoul(async, NULL, 10));
+    }
 }
 
 void
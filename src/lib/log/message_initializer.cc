@@ -1,9 +1,10 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <log/async_log_buffer.h>
 #include <log/message_dictionary.h>
 #include <log/message_initializer.h>
 #include <algorithm>
@@ -66,7 +67,9 @@ MessageInitializer::~MessageInitializer() {
 
     } else {
         // Our messages are not pending, so they might have been loaded to
-        // the dictionary and/or duplicates.
+        // the dictionary and/or duplicates. The logging thread must not
+        // look them up while they are removed.
+        AsyncLogPause pause;
         int i = 0;
         while (values_[i]) {
             // Check if the unloaded message is registered as duplicate. If it is,
@@ -101,6 +104,8 @@ MessageInitializer::loadDictionary(bool ignore_duplicates) {
     const MessageDictionaryPtr& global = MessageDictionary::globalDictionary();
     const LoggerValuesListPtr& logger_values = getNonConstLoggerValues();
 
+    // The logging thread must not look up messages while they are added.
+    AsyncLogPause pause;
     for (LoggerValuesList::const_iterator values = logger_values->begin();
          values != logger_values->end(); ++values) {
         std::vector<std::string> repeats = global->load(*values);
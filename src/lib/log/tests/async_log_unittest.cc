@@ -0,0 +1,230 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/async_log.h>
+#include <log/async_log_buffer.h>
+#include <log/log_formatter.h>
+#include <log/logger_level.h>
+#include <log/message_dictionary.h>
+
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace isc::log;
+using namespace std;
+
+namespace {
+
+/// Messages used by the tests. The identifiers must outlive the records.
+const MessageID ASYNC_TEST_NO_ARG = "ASYNC_TEST_NO_ARG";
+const MessageID ASYNC_TEST_ONE_ARG = "ASYNC_TEST_ONE_ARG";
+const MessageID ASYNC_TEST_ARGS = "ASYNC_TEST_ARGS";
+
+class AsyncLogTest : public ::testing::Test {
+protected:
+    typedef pair<Severity, string> Output;
+    typedef Formatter<AsyncLogTest> TestFormatter;
+
+    AsyncLogTest() {
+        MessageDictionaryPtr dictionary = MessageDictionary::globalDictionary();
+        dictionary->add(ASYNC_TEST_NO_ARG, "no argument");
+        dictionary->add(ASYNC_TEST_ONE_ARG, "one argument %1");
+        dictionary->add(ASYNC_TEST_ARGS, "arguments %1 %2 %3");
+    }
+
+    ~AsyncLogTest() {
+        MessageDictionaryPtr dictionary = MessageDictionary::globalDictionary();
+        dictionary->erase(ASYNC_TEST_NO_ARG, "no argument");
+        dictionary->erase(ASYNC_TEST_ONE_ARG, "one argument %1");
+        dictionary->erase(ASYNC_TEST_ARGS, "arguments %1 %2 %3");
+    }
+
+public:
+    /// Output function of the ring.
+    void write(LoggerImpl*, const Severity& severity, const string& message) {
+        outputs.push_back(Output(severity, message));
+    }
+
+    /// Output function of the synchronous Formatter, never called here.
+    void output(const Severity&, const string& message) {
+        ADD_FAILURE() << "synchronous output: " << message;
+    }
+
+    /// Returns a ring writing to outputs.
+    AsyncLogBuffer* makeBuffer(const size_t capacity) {
+        return (new AsyncLogBuffer(capacity,
+                                   boost::bind(&AsyncLogTest::write, this,
+                                               _1, _2, _3)));
+    }
+
+    /// Reserves a record and returns a Formatter filling it.
+    TestFormatter format(AsyncLogBuffer& buffer, const Severity& severity,
+                         const MessageID& ident) {
+        AsyncLogRecord* record = buffer.reserve(NULL, severity, ident);
+        if (!record) {
+            return (TestFormatter());
+        }
+        return (TestFormatter(severity, NULL, this, record));
+    }
+
+    vector<Output> outputs;
+};
+
+// Check the capacity is rounded up to a power of two.
+TEST_F(AsyncLogTest, capacity) {
+    EXPECT_EQ(2, AsyncLogBuffer(0).getCapacity());
+    EXPECT_EQ(2, AsyncLogBuffer(2).getCapacity());
+    EXPECT_EQ(8, AsyncLogBuffer(5).getCapacity());
+    EXPECT_EQ(1024, AsyncLogBuffer(1024).getCapacity());
+}
+
+// Check the messages are formatted as in the synchronous mode.
+TEST_F(AsyncLogTest, format) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(16));
+
+    format(*buffer, INFO, ASYNC_TEST_NO_ARG);
+    format(*buffer, DEBUG, ASYNC_TEST_ONE_ARG).arg(string("text"));
+    format(*buffer, WARN, ASYNC_TEST_ARGS).arg(-5).arg(42U).arg('x');
+    format(*buffer, ERROR, ASYNC_TEST_ARGS).arg(1.5).arg(0.25f)
+        .arg(static_cast<uint64_t>(1) << 63);
+    // Nothing is written until the ring is consumed.
+    EXPECT_TRUE(outputs.empty());
+    buffer->flush();
+
+    ASSERT_EQ(4, outputs.size());
+    EXPECT_EQ(INFO, outputs[0].first);
+    EXPECT_EQ("ASYNC_TEST_NO_ARG no argument", outputs[0].second);
+    EXPECT_EQ(DEBUG, outputs[1].first);
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument text", outputs[1].second);
+    EXPECT_EQ(WARN, outputs[2].first);
+    EXPECT_EQ("ASYNC_TEST_ARGS arguments -5 42 x", outputs[2].second);
+    EXPECT_EQ(ERROR, outputs[3].first);
+    EXPECT_EQ("ASYNC_TEST_ARGS arguments 1.5 0.25 9223372036854775808",
+              outputs[3].second);
+    EXPECT_EQ(4, buffer->getWritten());
+    EXPECT_EQ(0, buffer->getOverflows());
+    EXPECT_EQ(0, buffer->getDrops());
+}
+
+#ifndef ENABLE_LOGGER_CHECKS
+// Check the missing and excess arguments are reported as in the
+// synchronous mode.
+TEST_F(AsyncLogTest, mismatchedPlaceholders) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(4));
+
+    format(*buffer, INFO, ASYNC_TEST_ARGS).arg(1).arg(2);
+    format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(1).arg(string("two"));
+    buffer->flush();
+
+    ASSERT_EQ(2, outputs.size());
+    EXPECT_EQ("ASYNC_TEST_ARGS arguments 1 2 %3 "
+              "@@Excess logger placeholders still exist@@",
+              outputs[0].second);
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument 1 "
+              "@@Missing placeholder %2 for 'two'@@",
+              outputs[1].second);
+}
+#endif /* ENABLE_LOGGER_CHECKS */
+
+// Check the records are reused once consumed.
+TEST_F(AsyncLogTest, wrap) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(4));
+
+    for (int i = 0; i < 10; ++i) {
+        format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(i);
+        format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(string("s"));
+        buffer->flush();
+    }
+    ASSERT_EQ(20, outputs.size());
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument 9", outputs[18].second);
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument s", outputs[19].second);
+    EXPECT_EQ(0, buffer->getOverflows());
+}
+
+// Check the overflow and drop counters.
+TEST_F(AsyncLogTest, overflow) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(2));
+
+    EXPECT_TRUE(buffer->reserve(NULL, INFO, ASYNC_TEST_NO_ARG));
+    EXPECT_TRUE(buffer->reserve(NULL, INFO, ASYNC_TEST_NO_ARG));
+
+    // The ring is full: debug and informational messages are dropped,
+    // the other ones are only counted as overflows as the caller writes
+    // them synchronously.
+    EXPECT_FALSE(buffer->reserve(NULL, DEBUG, ASYNC_TEST_NO_ARG));
+    EXPECT_FALSE(buffer->reserve(NULL, INFO, ASYNC_TEST_NO_ARG));
+    EXPECT_FALSE(buffer->reserve(NULL, WARN, ASYNC_TEST_NO_ARG));
+    EXPECT_FALSE(buffer->reserve(NULL, ERROR, ASYNC_TEST_NO_ARG));
+    EXPECT_EQ(4, buffer->getOverflows());
+    EXPECT_EQ(2, buffer->getDrops());
+}
+
+// Check a deactivated formatter doesn't output anything and its record
+// doesn't block the following ones.
+TEST_F(AsyncLogTest, deactivate) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(4));
+
+    format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(1).deactivate();
+    format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(2);
+    buffer->flush();
+
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument 2", outputs[0].second);
+    EXPECT_EQ(1, buffer->getWritten());
+}
+
+// Check an uncommitted record stops the consumer until it is committed.
+TEST_F(AsyncLogTest, uncommitted) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(4));
+
+    {
+        TestFormatter pending = format(*buffer, INFO, ASYNC_TEST_ONE_ARG);
+        format(*buffer, INFO, ASYNC_TEST_ONE_ARG).arg(2);
+        buffer->flush();
+        EXPECT_TRUE(outputs.empty());
+        pending.arg(1);
+    }
+    buffer->flush();
+
+    ASSERT_EQ(2, outputs.size());
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument 1", outputs[0].second);
+    EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument 2", outputs[1].second);
+}
+
+// Check the logging thread writes the messages and stop() drains the ring.
+TEST_F(AsyncLogTest, thread) {
+    boost::scoped_ptr<AsyncLogBuffer> buffer(makeBuffer(64));
+    buffer->start();
+
+    for (int i = 0; i < 1000; ++i) {
+        AsyncLogRecord* record;
+        while (!(record = buffer->reserve(NULL, INFO, ASYNC_TEST_ONE_ARG))) {
+            // Wait for the thread to make room.
+            buffer->flush();
+        }
+        TestFormatter(INFO, NULL, this, record).arg(i);
+    }
+    buffer->stop();
+
+    // The output is only accessed by the consumer, which is now this
+    // thread.
+    EXPECT_EQ(1000, buffer->getWritten());
+    ASSERT_EQ(1000, outputs.size());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ("ASYNC_TEST_ONE_ARG one argument " +
+                  boost::lexical_cast<string>(i), outputs[i].second);
+    }
+}
+
+}
@@ -12,6 +12,7 @@
 using namespace std;
 using namespace isc::data;
 using namespace isc::config;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace stats {
@@ -22,42 +23,55 @@ StatsMgr& StatsMgr::instance() {
 }
 
 StatsMgr::StatsMgr()
-    :global_(new StatContext()) {
+    :global_(new StatContext()), mutex_() {
 
 }
 
 void StatsMgr::setValue(const std::string& name, const int64_t value) {
+    Mutex::Locker lock(mutex_);
     setValueInternal(name, value);
 }
 
 void StatsMgr::setValue(const std::string& name, const double value) {
+    Mutex::Locker lock(mutex_);
     setValueInternal(name, value);
 }
 
 void StatsMgr::setValue(const std::string& name, const StatsDuration& value) {
+    Mutex::Locker lock(mutex_);
     setValueInternal(name, value);
 }
 void StatsMgr::setValue(const std::string& name, const std::string& value) {
+    Mutex::Locker lock(mutex_);
     setValueInternal(name, value);
 }
 
 void StatsMgr::addValue(const std::string& name, const int64_t value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
 void StatsMgr::addValue(const std::string& name, const double value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
 void StatsMgr::addValue(const std::string& name, const StatsDuration& value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
 void StatsMgr::addValue(const std::string& name, const std::string& value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
 ObservationPtr StatsMgr::getObservation(const std::string& name) const {
+    Mutex::Locker lock(mutex_);
+    return (getObservationInternal(name));
+}
+
+ObservationPtr StatsMgr::getObservationInternal(const std::string& name) const {
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
     return (global_->get(name));
@@ -85,7 +99,8 @@ void StatsMgr::setMaxSampleCount(const std::string& , uint32_t){
 }
 
 bool StatsMgr::reset(const std::string& name) {
-    ObservationPtr obs = getObservation(name);
+    Mutex::Locker lock(mutex_);
+    ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         obs->reset();
         return (true);
@@ -95,16 +110,19 @@ bool StatsMgr::reset(const std::string& name) {
 }
 
 bool StatsMgr::del(const std::string& name) {
+    Mutex::Locker lock(mutex_);
     return (global_->del(name));
 }
 
 void StatsMgr::removeAll() {
+    Mutex::Locker lock(mutex_);
     global_->stats_.clear();
 }
 
 isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
     isc::data::ElementPtr response = isc::data::Element::createMap(); // a map
-    ObservationPtr obs = getObservation(name);
+    Mutex::Locker lock(mutex_);
+    ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         response->set(name, obs->getJSON()); // that contains the observation
     }
@@ -112,19 +130,32 @@ isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
 }
 
 isc::data::ConstElementPtr StatsMgr::getAll() const {
+    // Copy the statistics, so as they can be updated while the (much
+    // slower) conversion to JSON is in progress.
+    std::vector<Observation> observations;
+    {
+        Mutex::Locker lock(mutex_);
+        observations.reserve(global_->stats_.size());
+        for (std::map<std::string, ObservationPtr>::const_iterator s =
+                 global_->stats_.begin(); s != global_->stats_.end(); ++s) {
+            observations.push_back(*s->second);
+        }
+    }
+
     isc::data::ElementPtr map = isc::data::Element::createMap(); // a map
 
-    // Let's iterate over all stored statistics...
-    for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
-         s != global_->stats_.end(); ++s) {
+    // Let's iterate over all copied statistics...
+    for (std::vector<Observation>::const_iterator s = observations.begin();
+         s != observations.end(); ++s) {
 
         // ... and add each of them to the map.
-        map->set(s->first, s->second->getJSON());
+        map->set(s->getName(), s->getJSON());
     }
     return (map);
 }
 
 void StatsMgr::resetAll() {
+    Mutex::Locker lock(mutex_);
     // Let's iterate over all stored statistics...
     for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
          s != global_->stats_.end(); ++s) {
@@ -135,6 +166,7 @@ void StatsMgr::resetAll() {
 }
 
 size_t StatsMgr::count() const {
+    Mutex::Locker lock(mutex_);
     return (global_->stats_.size());
 }
 
@@ -9,6 +9,7 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <util/threads/sync.h>
 #include <boost/noncopyable.hpp>
 
 #include <map>
@@ -58,6 +59,14 @@ namespace stats {
 /// If this decision is revisited in the future, the most universal places
 /// for adding logging have been marked in @ref addValueInternal and
 /// @ref setValueInternal.
+///
+/// The public methods are thread safe: the statistics may be retrieved by
+/// the commands executed in the command thread of the @c CommandMgr while
+/// the thread processing packets records the observations. In order not to
+/// delay the packet processing, @ref getAll copies the observations while
+/// holding the mutex and builds the JSON structure from the copies. The
+/// observations returned by @ref getObservation must only be modified
+/// through the methods of this class.
 class StatsMgr : public boost::noncopyable {
  public:
 
@@ -203,6 +212,7 @@ class StatsMgr : public boost::noncopyable {
     /// @brief Returns an observation.
     ///
     /// Used in testing only. Production code should use @ref get() method.
+    /// The returned observation must not be modified directly.
     /// @param name name of the statistic
     /// @return Pointer to the Observation object
     ObservationPtr getObservation(const std::string& name) const;
@@ -350,7 +360,7 @@ class StatsMgr : public boost::noncopyable {
     void setValueInternal(const std::string& name, DataType value) {
 
         // If we want to log each observation, here would be the best place for it.
-        ObservationPtr stat = getObservation(name);
+        ObservationPtr stat = getObservationInternal(name);
         if (stat) {
             stat->setValue(value);
         } else {
@@ -375,12 +385,12 @@ class StatsMgr : public boost::noncopyable {
     void addValueInternal(const std::string& name, DataType value) {
 
         // If we want to log each observation, here would be the best place for it.
-        ObservationPtr existing = getObservation(name);
+        ObservationPtr existing = getObservationInternal(name);
         if (!existing) {
             // We tried to add to a non-existing statistic. We can recover from
             // that. Simply add the new incremental value as a new statistic and
             // we're done.
-            setValue(name, value);
+            setValueInternal(name, value);
             return;
         } else {
             // Let's hope it is of correct type. If not, the underlying
@@ -389,6 +399,16 @@ class StatsMgr : public boost::noncopyable {
         }
     }
 
+    /// @private
+
+    /// @brief Returns an observation (internal version).
+    ///
+    /// The caller must hold the mutex.
+    ///
+    /// @param name name of the statistic
+    /// @return Pointer to the Observation object or NULL if not found
+    ObservationPtr getObservationInternal(const std::string& name) const;
+
     /// @public
 
     /// @brief Adds a new observation.
@@ -424,6 +444,9 @@ class StatsMgr : public boost::noncopyable {
 
     // This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
+
+    /// @brief Mutex protecting the statistics.
+    mutable isc::util::thread::Mutex mutex_;
 };
 
 };
@@ -11,7 +11,9 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <util/boost_time_utils.h>
+#include <util/threads/thread.h>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
@@ -22,6 +24,7 @@ using namespace isc;
 using namespace isc::data;
 using namespace isc::stats;
 using namespace isc::config;
+using namespace isc::util::thread;
 using namespace boost::posix_time;
 
 namespace {
@@ -288,6 +291,44 @@ TEST_F(StatsMgrTest, removeAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+/// @brief Retrieves all statistics repeatedly.
+///
+/// @param iterations Number of retrievals.
+void getAllRepeatedly(const size_t iterations) {
+    for (size_t i = 0; i < iterations; ++i) {
+        StatsMgr::instance().getAll();
+        StatsMgr::instance().get("alpha");
+    }
+}
+
+// This test checks that the statistics can be retrieved by another thread
+// while they are being updated.
+TEST_F(StatsMgrTest, concurrentGetAll) {
+    for (int i = 0; i < 100; ++i) {
+        StatsMgr::instance().setValue(StatsMgr::generateName("subnet", i,
+                                                             "assigned-addresses"),
+                                      static_cast<int64_t>(i));
+    }
+
+    Thread thread(boost::bind(&getAllRepeatedly, 200));
+    for (int i = 0; i < 100000; ++i) {
+        StatsMgr::instance().addValue("alpha", static_cast<int64_t>(1));
+        StatsMgr::instance().addValue(StatsMgr::generateName("subnet", i % 100,
+                                                             "assigned-addresses"),
+                                      static_cast<int64_t>(1));
+    }
+    ASSERT_NO_THROW(thread.wait());
+
+    EXPECT_EQ(101, StatsMgr::instance().count());
+    ObservationPtr alpha = StatsMgr::instance().getObservation("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_EQ(100000, alpha->getInteger().first);
+    ObservationPtr subnet = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", 7, "assigned-addresses"));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(1007, subnet->getInteger().first);
+}
+
 // This is a performance benchmark that checks how long does it take
 // to increment a single statistic million times.
 //
@@ -79,7 +79,8 @@ CSVRow::checkIndex(const size_t at) const {
 }
 
 CSVFile::CSVFile(const std::string& filename)
-    : filename_(filename), fs_(), cols_(0), read_msg_() {
+    : filename_(filename), fs_(), cols_(0), read_msg_(),
+      write_buffer_size_(0), write_buffer_() {
 }
 
 CSVFile::~CSVFile() {
@@ -153,7 +154,12 @@ CSVFile::append(const CSVRow& row) const {
     fs_->clear();
 
     std::string text = row.render();
-    *fs_ << text << std::endl;
+    *fs_ << text << '\n';
+    // Unless the caller requested buffered writes, make sure that the row
+    // lands in the file immediately.
+    if (write_buffer_size_ == 0) {
+        fs_->flush();
+    }
     if (!fs_->good()) {
         fs_->clear();
         isc_throw(CSVFileError, "failed to write CSV row '"
@@ -267,7 +273,7 @@ CSVFile::open(const bool seek_to_end) {
 
     } else {
         // Try to open existing file, holding some data.
-        fs_.reset(new std::fstream(filename_.c_str()));
+        openStream(std::fstream::in | std::fstream::out);
 
         // Catch exceptions so as we can close the file if error occurs.
         try {
@@ -338,7 +344,7 @@ CSVFile::recreate() {
 
     // Close any dangling files.
     close();
-    fs_.reset(new std::fstream(filename_.c_str(), std::fstream::out));
+    openStream(std::fstream::out);
     if (!fs_->is_open()) {
         close();
         isc_throw(CSVFileError, "unable to open '" << filename_ << "'");
@@ -358,6 +364,19 @@ CSVFile::recreate() {
 
 }
 
+void
+CSVFile::openStream(const std::ios_base::openmode mode) {
+    // Flush and destroy the existing stream before its buffer is reused.
+    close();
+    fs_.reset(new std::fstream());
+    // The buffer must be installed before the file is opened.
+    if (write_buffer_size_ > 0) {
+        write_buffer_.resize(write_buffer_size_);
+        fs_->rdbuf()->pubsetbuf(&write_buffer_[0], write_buffer_.size());
+    }
+    fs_->open(filename_.c_str(), mode);
+}
+
 bool
 CSVFile::validate(const CSVRow& row) {
     setReadMsg("success");
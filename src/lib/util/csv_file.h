@@ -331,6 +331,27 @@ public:
     /// @brief Flushes a file.
     void flush() const;
 
+    /// @brief Sets the size of the buffer used to write to the file.
+    ///
+    /// By default, each row is flushed to the file as soon as it is
+    /// appended, so as the file is consistent if the process is interrupted.
+    /// Tools writing large files in one pass (e.g. the lease file cleanup)
+    /// may instead buffer the rows in memory and write them in large
+    /// blocks. The buffer is flushed when it fills up and when the file is
+    /// closed. The new size takes effect the next time the file is opened
+    /// or created.
+    ///
+    /// @param size Size of the write buffer in bytes. The value of 0
+    /// selects the default behavior, i.e. flushing after each row.
+    void setWriteBufferSize(const size_t size) {
+        write_buffer_size_ = size;
+    }
+
+    /// @brief Returns the size of the write buffer.
+    size_t getWriteBufferSize() const {
+        return (write_buffer_size_);
+    }
+
     /// @brief Returns the number of columns in the file.
     size_t getColumnCount() const {
         return (cols_.size());
@@ -488,6 +509,14 @@ private:
     /// @brief Returns size of the CSV file.
     std::streampos size() const;
 
+    /// @brief Creates the file stream and opens the file.
+    ///
+    /// If the write buffer size is non-zero, the buffer is installed in the
+    /// stream before the file is opened.
+    ///
+    /// @param mode Mode in which the file is opened.
+    void openStream(const std::ios_base::openmode mode);
+
     /// @brief CSV file name.
     std::string filename_;
 
@@ -499,6 +528,13 @@ private:
 
     /// @brief Holds last error during row reading or validation.
     std::string read_msg_;
+
+    /// @brief Size of the write buffer, 0 if the rows are flushed
+    /// immediately.
+    size_t write_buffer_size_;
+
+    /// @brief Write buffer installed in the file stream.
+    std::vector<char> write_buffer_;
 };
 
 } // namespace isc::util
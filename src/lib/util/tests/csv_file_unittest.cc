@@ -431,6 +431,42 @@ TEST_F(CSVFileTest, recreate) {
               readFile());
 }
 
+// This test checks that the rows appended to the file with the write
+// buffer enabled are written to the file when the buffer is flushed or
+// when the file is closed.
+TEST_F(CSVFileTest, writeBuffer) {
+    boost::scoped_ptr<CSVFile> csv(new CSVFile(testfile_));
+    csv->addColumn("animal");
+    csv->addColumn("age");
+    EXPECT_EQ(0, csv->getWriteBufferSize());
+    csv->setWriteBufferSize(65536);
+    EXPECT_EQ(65536, csv->getWriteBufferSize());
+    ASSERT_NO_THROW(csv->recreate());
+
+    CSVRow row(2);
+    row.writeAt(0, "dog");
+    row.writeAt(1, 3);
+    ASSERT_NO_THROW(csv->append(row));
+
+    // The header has been flushed but the row is still in the buffer.
+    EXPECT_EQ("animal,age\n", readFile());
+
+    ASSERT_NO_THROW(csv->flush());
+    EXPECT_EQ("animal,age\n"
+              "dog,3\n",
+              readFile());
+
+    row.writeAt(0, "cat");
+    row.writeAt(1, 2);
+    ASSERT_NO_THROW(csv->append(row));
+    csv->close();
+
+    EXPECT_EQ("animal,age\n"
+              "dog,3\n"
+              "cat,2\n",
+              readFile());
+}
+
 // This test checks that the error is reported when the size of the row being
 // read doesn't match the number of columns of the CSV file.
 TEST_F(CSVFileTest, validate) {